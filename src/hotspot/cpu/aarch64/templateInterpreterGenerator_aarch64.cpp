@@ -2040,7 +2040,28 @@ void TemplateInterpreterGenerator::count_bytecode() {
 
 void TemplateInterpreterGenerator::histogram_bytecode(Template* t) { ; }
 
-void TemplateInterpreterGenerator::histogram_bytecode_pair(Template* t) { ; }
+void TemplateInterpreterGenerator::histogram_bytecode_pair(Template* t) {
+  Register rscratch3 = r0;
+  __ push(rscratch1);
+  __ push(rscratch2);
+  __ push(rscratch3);
+  __ push(r1);
+  // Shift the new bytecode into the pair index
+  __ mov(rscratch3, (address) &BytecodePairHistogram::_index);
+  __ ldrw(rscratch2, Address(rscratch3));
+  __ lsrw(rscratch2, rscratch2, BytecodePairHistogram::log2_number_of_codes);
+  __ movw(r1, ((int) t->bytecode()) << BytecodePairHistogram::log2_number_of_codes);
+  __ orrw(rscratch2, rscratch2, r1);
+  __ strw(rscratch2, Address(rscratch3));
+  // Count the pair
+  __ mov(rscratch3, (address) BytecodePairHistogram::_counters);
+  __ lea(rscratch3, Address(rscratch3, rscratch2, Address::uxtw(2)));
+  __ atomic_addw(noreg, 1, rscratch3);
+  __ pop(r1);
+  __ pop(rscratch3);
+  __ pop(rscratch2);
+  __ pop(rscratch1);
+}
 
 
 void TemplateInterpreterGenerator::trace_bytecode(Template* t) {
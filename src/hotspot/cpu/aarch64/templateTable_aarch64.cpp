@@ -908,13 +908,14 @@ void TemplateTable::aload_0_internal(RewriteControl rc) {
   // _aload_0, _fast_igetfield
   // _aload_0, _fast_agetfield
   // _aload_0, _fast_fgetfield
+  // _aload_0, _fast_bgetfield
+  // _aload_0, _fast_lgetfield
   //
   // occur frequently. If RewriteFrequentPairs is set, the (slow)
-  // _aload_0 bytecode checks if the next bytecode is either
-  // _fast_igetfield, _fast_agetfield or _fast_fgetfield and then
-  // rewrites the current bytecode into a pair bytecode; otherwise it
-  // rewrites the current bytecode into _fast_aload_0 that doesn't do
-  // the pair check anymore.
+  // _aload_0 bytecode checks if the next bytecode is one of these
+  // _fast_<x>getfield bytecodes and then rewrites the current bytecode
+  // into a pair bytecode; otherwise it rewrites the current bytecode
+  // into _fast_aload_0 that doesn't do the pair check anymore.
   //
   // Note: If the next bytecode is _getfield, the rewrite must be
   //       delayed, otherwise we may miss an opportunity for a pair.
@@ -953,6 +954,18 @@ void TemplateTable::aload_0_internal(RewriteControl rc) {
     __ movw(bc, Bytecodes::_fast_faccess_0);
     __ br(Assembler::EQ, rewrite);
 
+    // if _bgetfield then rewrite to _fast_baccess_0
+    assert(Bytecodes::java_code(Bytecodes::_fast_baccess_0) == Bytecodes::_aload_0, "fix bytecode definition");
+    __ cmpw(r1, Bytecodes::_fast_bgetfield);
+    __ movw(bc, Bytecodes::_fast_baccess_0);
+    __ br(Assembler::EQ, rewrite);
+
+    // if _lgetfield then rewrite to _fast_laccess_0
+    assert(Bytecodes::java_code(Bytecodes::_fast_laccess_0) == Bytecodes::_aload_0, "fix bytecode definition");
+    __ cmpw(r1, Bytecodes::_fast_lgetfield);
+    __ movw(bc, Bytecodes::_fast_laccess_0);
+    __ br(Assembler::EQ, rewrite);
+
     // else rewrite to _fast_aload0
     assert(Bytecodes::java_code(Bytecodes::_fast_aload_0) == Bytecodes::_aload_0, "fix bytecode definition");
     __ movw(bc, Bytecodes::Bytecodes::_fast_aload_0);
@@ -3151,17 +3164,23 @@ void TemplateTable::fast_xaccess(TosState state)
   // next instruction)
   __ increment(rbcp);
   __ null_check(r0);
-  switch (state) {
-  case itos:
+  switch (bytecode()) {
+  case Bytecodes::_fast_iaccess_0:
     __ access_load_at(T_INT, IN_HEAP, r0, Address(r0, r1, Address::lsl(0)), noreg, noreg);
     break;
-  case atos:
+  case Bytecodes::_fast_aaccess_0:
     do_oop_load(_masm, Address(r0, r1, Address::lsl(0)), r0, IN_HEAP);
     __ verify_oop(r0);
     break;
-  case ftos:
+  case Bytecodes::_fast_faccess_0:
     __ access_load_at(T_FLOAT, IN_HEAP, noreg /* ftos */, Address(r0, r1, Address::lsl(0)), noreg, noreg);
     break;
+  case Bytecodes::_fast_baccess_0:
+    __ access_load_at(T_BYTE, IN_HEAP, r0, Address(r0, r1, Address::lsl(0)), noreg, noreg);
+    break;
+  case Bytecodes::_fast_laccess_0:
+    __ access_load_at(T_LONG, IN_HEAP, r0, Address(r0, r1, Address::lsl(0)), noreg, noreg);
+    break;
   default:
     ShouldNotReachHere();
   }
@@ -3403,6 +3422,15 @@ void TemplateTable::invokeinterface(int byte_no) {
 
   // Preserve method for throw_AbstractMethodErrorVerbose.
   __ mov(r16, rmethod);
+  // If REFC is the declaring interface of the method, the itable lookup
+  // of the method below also does the receiver subtype check, so skip
+  // the separate itable scan for REFC.
+  Label refc_checked;
+  __ ldr(rscratch1, Address(rmethod, Method::const_offset()));
+  __ ldr(rscratch1, Address(rscratch1, ConstMethod::constants_offset()));
+  __ ldr(rscratch1, Address(rscratch1, ConstantPool::pool_holder_offset_in_bytes()));
+  __ cmp(r0, rscratch1);
+  __ br(Assembler::EQ, refc_checked);
   // Receiver subtype check against REFC.
   // Superklass in r0. Subklass in r3. Blows rscratch2, r13
   __ lookup_interface_method(// inputs: rec. class, interface, itable index
@@ -3411,6 +3439,7 @@ void TemplateTable::invokeinterface(int byte_no) {
                              rscratch2, r13,
                              no_such_interface,
                              /*return_method=*/false);
+  __ bind(refc_checked);
 
   // profile this call
   __ profile_virtual_call(r3, r13, r19);
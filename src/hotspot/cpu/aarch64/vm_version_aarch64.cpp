@@ -176,6 +176,8 @@ void VM_Version::initialize() {
   if (_features & CPU_AES)   strcat(buf, ", aes");
   if (_features & CPU_SHA1)  strcat(buf, ", sha1");
   if (_features & CPU_SHA2)  strcat(buf, ", sha256");
+  if (_features & CPU_SHA3)  strcat(buf, ", sha3");
+  if (_features & CPU_SHA512) strcat(buf, ", sha512");
   if (_features & CPU_LSE)   strcat(buf, ", lse");
 
   _features_string = os::strdup(buf);
@@ -198,6 +200,11 @@ void VM_Version::initialize() {
     FLAG_SET_DEFAULT(UseVectorizedMismatchIntrinsic, false);
   }
 
+  if (UseVectorizedHashCodeIntrinsic) {
+    warning("UseVectorizedHashCodeIntrinsic specified, but not available on this CPU.");
+    FLAG_SET_DEFAULT(UseVectorizedHashCodeIntrinsic, false);
+  }
+
   if (_features & CPU_LSE) {
     if (FLAG_IS_DEFAULT(UseLSE))
       FLAG_SET_DEFAULT(UseLSE, true);
@@ -251,7 +258,7 @@ void VM_Version::initialize() {
     FLAG_SET_DEFAULT(UseFMA, true);
   }
 
-  if (_features & (CPU_SHA1 | CPU_SHA2)) {
+  if (_features & (CPU_SHA1 | CPU_SHA2 | CPU_SHA512)) {
     if (FLAG_IS_DEFAULT(UseSHA)) {
       FLAG_SET_DEFAULT(UseSHA, true);
     }
@@ -278,7 +285,11 @@ void VM_Version::initialize() {
     FLAG_SET_DEFAULT(UseSHA256Intrinsics, false);
   }
 
-  if (UseSHA512Intrinsics) {
+  if (UseSHA && (_features & CPU_SHA512)) {
+    if (FLAG_IS_DEFAULT(UseSHA512Intrinsics)) {
+      FLAG_SET_DEFAULT(UseSHA512Intrinsics, true);
+    }
+  } else if (UseSHA512Intrinsics) {
     warning("Intrinsics for SHA-384 and SHA-512 crypto hash functions not available on this CPU.");
     FLAG_SET_DEFAULT(UseSHA512Intrinsics, false);
   }
@@ -1097,6 +1097,10 @@ void LIRGenerator::do_vectorizedMismatch(Intrinsic* x) {
   fatal("vectorizedMismatch intrinsic is not implemented on this platform");
 }
 
+void LIRGenerator::do_string_equals(Intrinsic* x) {
+  fatal("String equals intrinsic is not implemented on this platform");
+}
+
 void LIRGenerator::do_ArrayCopy(Intrinsic* x) {
   CodeEmitInfo* info = state_for(x, x->state());
   assert(x->number_of_arguments() == 5, "wrong type");
@@ -1343,7 +1347,7 @@ void LIRGenerator::do_CheckCast(CheckCast* x) {
     assert(patching_info == NULL, "can't patch this");
     stub = new DeoptimizeStub(info_for_exception,
                               Deoptimization::Reason_class_check,
-                              Deoptimization::Action_none);
+                              x->receiver_check_deopt_action());
   } else {
     stub = new SimpleExceptionStub(Runtime1::throw_class_cast_exception_id,
                                    LIR_OprFact::illegalOpr, info_for_exception);
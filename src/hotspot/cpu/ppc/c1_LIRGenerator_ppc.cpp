@@ -1090,7 +1090,7 @@ void LIRGenerator::do_CheckCast(CheckCast* x) {
     assert(patching_info == NULL, "can't patch this");
     stub = new DeoptimizeStub(info_for_exception,
                               Deoptimization::Reason_class_check,
-                              Deoptimization::Action_none);
+                              x->receiver_check_deopt_action());
   } else {
     stub = new SimpleExceptionStub(Runtime1::throw_class_cast_exception_id, obj.result(), info_for_exception);
   }
@@ -1380,3 +1380,7 @@ void LIRGenerator::do_FmaIntrinsic(Intrinsic* x) {
 void LIRGenerator::do_vectorizedMismatch(Intrinsic* x) {
   fatal("vectorizedMismatch intrinsic is not implemented on this platform");
 }
+
+void LIRGenerator::do_string_equals(Intrinsic* x) {
+  fatal("String equals intrinsic is not implemented on this platform");
+}
@@ -80,9 +80,17 @@ void CardTableBarrierSetAssembler::card_table_write(MacroAssembler* masm,
   assert_different_registers(obj, tmp, R0);
   __ load_const_optimized(tmp, (address)byte_map_base, R0);
   __ srdi(obj, obj, CardTable::card_shift);
+  Label Lalready_dirty;
+  if (UseCondCardMark) {
+    if (ct->scanned_concurrently()) { __ membar(Assembler::StoreLoad); }
+    __ lbzx(R0, tmp, obj);
+    __ cmpwi(CCR0, R0, CardTable::dirty_card_val());
+    __ beq(CCR0, Lalready_dirty);
+  }
   __ li(R0, CardTable::dirty_card_val());
   if (ct->scanned_concurrently()) { __ membar(Assembler::StoreStore); }
   __ stbx(R0, tmp, obj);
+  __ bind(Lalready_dirty);
 }
 
 void CardTableBarrierSetAssembler::card_write_barrier_post(MacroAssembler* masm, Register store_addr, Register tmp) {
@@ -1095,6 +1095,10 @@ static void pd_zero_to_words(HeapWord* tohw, size_t count) {
   pd_zero_to_bytes(tohw, count*HeapWordSize);
 }
 
+static void pd_zero_to_words_nontemporal(HeapWord* tohw, size_t count) {
+  pd_zero_to_words(tohw, count);
+}
+
 static void pd_zero_to_bytes(void* to, size_t count) {
   // JVM2008: some calls (generally), some tests frequent
 #ifdef USE_INLINE_ASM
@@ -151,7 +151,18 @@ void CardTableBarrierSetAssembler::store_check(MacroAssembler* masm, Register st
   __ z_srlg(store_addr, store_addr, CardTable::card_shift);
   __ load_absolute_address(tmp, (address)ct->byte_map_base());
   __ z_agr(store_addr, tmp);
-  __ z_mvi(0, store_addr, CardTable::dirty_card_val());
+  if (UseCondCardMark) {
+    NearLabel already_dirty;
+    if (ct->scanned_concurrently()) {
+      __ z_fence();
+    }
+    __ z_cli(0, store_addr, CardTable::dirty_card_val());
+    __ z_bre(already_dirty);
+    __ z_mvi(0, store_addr, CardTable::dirty_card_val());
+    __ bind(already_dirty);
+  } else {
+    __ z_mvi(0, store_addr, CardTable::dirty_card_val());
+  }
 }
 
 void CardTableBarrierSetAssembler::oop_store_at(MacroAssembler* masm, DecoratorSet decorators, BasicType type,
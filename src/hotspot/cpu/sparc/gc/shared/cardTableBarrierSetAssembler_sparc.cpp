@@ -75,7 +75,21 @@ void CardTableBarrierSetAssembler::card_table_write(MacroAssembler* masm,
   __ srlx(obj, CardTable::card_shift, obj);
   assert(tmp != obj, "need separate temp reg");
   __ set((address) byte_map_base, tmp);
-  __ stb(G0, tmp, obj);
+  if (UseCondCardMark) {
+    Label L_already_dirty;
+    CardTableBarrierSet* ctbs = barrier_set_cast<CardTableBarrierSet>(BarrierSet::barrier_set());
+    if (ctbs->card_table()->scanned_concurrently()) {
+      __ membar(Assembler::StoreLoad);
+    }
+    __ add(tmp, obj, obj);
+    __ ldub(obj, 0, tmp);
+    // dirty_card_val() is zero, so compare against G0.
+    __ cmp_and_br_short(tmp, G0, Assembler::equal, Assembler::pt, L_already_dirty);
+    __ stb(G0, obj, 0);
+    __ BIND(L_already_dirty);
+  } else {
+    __ stb(G0, tmp, obj);
+  }
 }
 
 void CardTableBarrierSetAssembler::card_write_barrier_post(MacroAssembler* masm, Register store_addr, Register new_val, Register tmp) {
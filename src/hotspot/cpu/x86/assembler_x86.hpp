@@ -1629,6 +1629,7 @@ private:
 
   void pcmpeqd(XMMRegister dst, XMMRegister src);
   void vpcmpeqd(XMMRegister dst, XMMRegister nds, XMMRegister src, int vector_len);
+  void vpcmpgtd(XMMRegister dst, XMMRegister nds, XMMRegister src, int vector_len);
   void evpcmpeqd(KRegister kdst, XMMRegister nds, XMMRegister src, int vector_len);
   void evpcmpeqd(KRegister kdst, XMMRegister nds, Address src, int vector_len);
 
@@ -1640,6 +1641,9 @@ private:
   void pmovmskb(Register dst, XMMRegister src);
   void vpmovmskb(Register dst, XMMRegister src);
 
+  void movmskps(Register dst, XMMRegister src);
+  void vmovmskps(Register dst, XMMRegister src, int vector_len);
+
   // SSE 4.1 extract
   void pextrd(Register dst, XMMRegister src, int imm8);
   void pextrq(Register dst, XMMRegister src, int imm8);
@@ -1666,6 +1670,7 @@ private:
 
   void vpmovzxbw( XMMRegister dst, Address src, int vector_len);
   void vpmovzxbw(XMMRegister dst, XMMRegister src, int vector_len);
+  void vpmovzxbd( XMMRegister dst, Address src, int vector_len);
   void evpmovzxbw(XMMRegister dst, KRegister mask, Address src, int vector_len);
 
   void evpmovwb(Address dst, XMMRegister src, int vector_len);
@@ -2067,6 +2072,13 @@ private:
   void vpmulld(XMMRegister dst, XMMRegister nds, Address src, int vector_len);
   void vpmullq(XMMRegister dst, XMMRegister nds, Address src, int vector_len);
 
+  // Multiply and add packed integers
+  void vpmaddubsw(XMMRegister dst, XMMRegister nds, Address src, int vector_len);
+  void vpmaddwd(XMMRegister dst, XMMRegister nds, Address src, int vector_len);
+
+  // Sum of absolute differences of packed unsigned bytes
+  void vpsadbw(XMMRegister dst, XMMRegister nds, XMMRegister src, int vector_len);
+
   // Shift left packed integers
   void psllw(XMMRegister dst, int shift);
   void pslld(XMMRegister dst, int shift);
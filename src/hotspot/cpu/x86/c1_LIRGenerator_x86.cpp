@@ -308,9 +308,9 @@ void LIRGenerator::do_MonitorEnter(MonitorEnter* x) {
 
   // "lock" stores the address of the monitor stack slot, so this is not an oop
   LIR_Opr lock = new_register(T_INT);
-  // Need a scratch register for biased locking on x86
+  // Need a scratch register for biased and lightweight locking on x86
   LIR_Opr scratch = LIR_OprFact::illegalOpr;
-  if (UseBiasedLocking) {
+  if (UseBiasedLocking || UseLightweightLocking) {
     scratch = new_register(T_INT);
   }
 
@@ -1168,6 +1168,69 @@ void LIRGenerator::do_vectorizedMismatch(Intrinsic* x) {
   __ move(result_reg, result);
 }
 
+void LIRGenerator::do_string_equals(Intrinsic* x) {
+  assert(UseVectorizedMismatchIntrinsic, "need AVX instruction support");
+
+  // Make all state_for calls early since they can emit code
+  CodeEmitInfo* info_a = state_for(x);
+  CodeEmitInfo* info_b = state_for(x);
+  LIR_Opr result = rlock_result(x);
+
+  LIRItem a(x->argument_at(0), this); // byte[]
+  LIRItem b(x->argument_at(1), this); // byte[]
+
+  a.load_item();
+  b.load_item();
+
+  LIR_Opr result_a = access_resolve(ACCESS_READ, a.result());
+  LIR_Opr result_b = access_resolve(ACCESS_READ, b.result());
+
+  // The length loads double as the null checks of the Java code.
+  LIR_Opr len_a = new_register(T_INT);
+  LIR_Opr len_b = new_register(T_INT);
+  __ load(new LIR_Address(result_a, arrayOopDesc::length_offset_in_bytes(), T_INT), len_a, info_a);
+  __ load(new LIR_Address(result_b, arrayOopDesc::length_offset_in_bytes(), T_INT), len_b, info_b);
+
+  // Arrays of different length are compared over zero bytes, for which
+  // the stub reports no mismatch; the length check is folded in below.
+  LIR_Opr len = new_register(T_INT);
+  __ cmp(lir_cond_equal, len_a, len_b);
+  __ cmove(lir_cond_equal, len_a, LIR_OprFact::intConst(0), len, T_INT);
+
+  LIR_Address* addr_a = new LIR_Address(result_a, arrayOopDesc::base_offset_in_bytes(T_BYTE), T_BYTE);
+  LIR_Address* addr_b = new LIR_Address(result_b, arrayOopDesc::base_offset_in_bytes(T_BYTE), T_BYTE);
+
+  BasicTypeList signature(4);
+  signature.append(T_ADDRESS);
+  signature.append(T_ADDRESS);
+  signature.append(T_INT);
+  signature.append(T_INT);
+  CallingConvention* cc = frame_map()->c_calling_convention(&signature);
+  const LIR_Opr result_reg = result_register_for(x->type());
+
+  LIR_Opr ptr_addr_a = new_pointer_register();
+  __ leal(LIR_OprFact::address(addr_a), ptr_addr_a);
+
+  LIR_Opr ptr_addr_b = new_pointer_register();
+  __ leal(LIR_OprFact::address(addr_b), ptr_addr_b);
+
+  __ move(ptr_addr_a, cc->at(0));
+  __ move(ptr_addr_b, cc->at(1));
+  __ move(len, cc->at(2));
+  __ move(LIR_OprFact::intConst(0), cc->at(3)); // compare bytes, UTF16 included
+
+  __ call_runtime_leaf(StubRoutines::vectorizedMismatch(), getThreadTemp(), result_reg, cc->args());
+
+  // The stub returns -1 when no mismatch was found.
+  LIR_Opr mismatch = new_register(T_INT);
+  __ move(result_reg, mismatch);
+  LIR_Opr equal_len_mismatch = new_register(T_INT);
+  __ cmp(lir_cond_equal, len_a, len_b);
+  __ cmove(lir_cond_equal, mismatch, LIR_OprFact::intConst(0), equal_len_mismatch, T_INT);
+  __ cmp(lir_cond_equal, equal_len_mismatch, LIR_OprFact::intConst(-1));
+  __ cmove(lir_cond_equal, LIR_OprFact::intConst(1), LIR_OprFact::intConst(0), result, T_BOOLEAN);
+}
+
 // _i2l, _i2f, _i2d, _l2i, _l2f, _l2d, _f2i, _f2l, _f2d, _d2i, _d2l, _d2f
 // _i2b, _i2c, _i2s
 LIR_Opr fixed_register_for(BasicType type) {
@@ -1395,7 +1458,7 @@ void LIRGenerator::do_CheckCast(CheckCast* x) {
     stub = new SimpleExceptionStub(Runtime1::throw_incompatible_class_change_error_id, LIR_OprFact::illegalOpr, info_for_exception);
   } else if (x->is_invokespecial_receiver_check()) {
     assert(patching_info == NULL, "can't patch this");
-    stub = new DeoptimizeStub(info_for_exception, Deoptimization::Reason_class_check, Deoptimization::Action_none);
+    stub = new DeoptimizeStub(info_for_exception, Deoptimization::Reason_class_check, x->receiver_check_deopt_action());
   } else {
     stub = new SimpleExceptionStub(Runtime1::throw_class_cast_exception_id, obj.result(), info_for_exception);
   }
@@ -58,6 +58,17 @@ int C1_MacroAssembler::lock_object(Register hdr, Register obj, Register disp_hdr
     null_check_offset = offset();
   }
 
+#ifdef _LP64
+  if (UseLightweightLocking) {
+    assert(scratch != noreg, "should have scratch register at this point");
+    // Load object header and try to fast-lock it; the displaced header
+    // location on the stack is not used
+    movptr(hdr, Address(obj, hdr_offset));
+    lightweight_lock(obj, hdr, r15_thread, scratch, slow_case);
+    return null_check_offset;
+  }
+#endif // _LP64
+
   // Load object header
   movptr(hdr, Address(obj, hdr_offset));
   // and mark it as unlocked
@@ -114,6 +125,20 @@ void C1_MacroAssembler::unlock_object(Register hdr, Register obj, Register disp_
     biased_locking_exit(obj, hdr, done);
   }
 
+#ifdef _LP64
+  if (UseLightweightLocking) {
+    // load object
+    movptr(obj, Address(disp_hdr, BasicObjectLock::obj_offset_in_bytes()));
+    verify_oop(obj);
+    // load object header; an inflated monitor is always exited in the runtime
+    movptr(disp_hdr, Address(obj, hdr_offset));
+    testptr(disp_hdr, markOopDesc::monitor_value);
+    jcc(Assembler::notZero, slow_case);
+    lightweight_unlock(obj, disp_hdr, hdr, slow_case);
+    return;
+  }
+#endif // _LP64
+
   // load displaced header
   movptr(hdr, Address(disp_hdr, 0));
   // if the loaded hdr is NULL we had recursive locking
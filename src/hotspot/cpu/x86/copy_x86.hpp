@@ -58,6 +58,25 @@ static void pd_zero_to_words(HeapWord* tohw, size_t count) {
   pd_fill_to_words(tohw, count, 0);
 }
 
+// Zero word-aligned words bypassing the caches. Used for clearing large
+// auxiliary data structures concurrently with the application, where the
+// cleared memory is not going to be accessed again soon.
+static void pd_zero_to_words_nontemporal(HeapWord* tohw, size_t count) {
+#if defined(AMD64) && defined(__GNUC__)
+  julong* to = (julong*) tohw;
+  julong* const end = to + count;
+  while (to < end) {
+    __asm__ volatile ("movnti %1, %0" : "=m" (*to) : "r" ((julong)0));
+    to++;
+  }
+  // Non-temporal stores are weakly ordered; make them visible before
+  // any subsequent store.
+  __asm__ volatile ("sfence" : : : "memory");
+#else
+  pd_zero_to_words(tohw, count);
+#endif
+}
+
 static void pd_zero_to_bytes(void* to, size_t count) {
   (void)memset(to, 0, count);
 }
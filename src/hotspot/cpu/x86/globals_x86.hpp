@@ -155,6 +155,11 @@ define_pd_global(bool, ThreadLocalHandshakes, false);
   product(bool, UseFastStosb, false,                                        \
           "Use fast-string operation for zeroing: rep stosb")               \
                                                                             \
+  diagnostic(int, FastStosbThreshold, 2048,                                 \
+          "Minimum array size in bytes to zero with rep stosb when AVX2 "   \
+          "is available; smaller arrays are zeroed with vector stores")     \
+          range(0, max_jint)                                                \
+                                                                            \
   /* Use Restricted Transactional Memory for lock eliding */                \
   product(bool, UseRTMLocking, false,                                       \
           "Enable RTM lock eliding for inflated locks in compiled code")    \
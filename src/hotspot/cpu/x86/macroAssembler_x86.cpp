@@ -1312,6 +1312,59 @@ void MacroAssembler::biased_locking_exit(Register obj_reg, Register temp_reg, La
   jcc(Assembler::equal, done);
 }
 
+#ifdef _LP64
+void MacroAssembler::lightweight_lock(Register obj, Register hdr, Register thread, Register tmp, Label& slow) {
+  assert(UseLightweightLocking, "why call this otherwise?");
+  assert(!UseBiasedLocking, "an anonymously biased mark would look unlocked");
+  assert(hdr == rax, "header must be in rax for cmpxchg");
+  assert_different_registers(obj, hdr, thread, tmp);
+
+  // Check that the lock stack has room for one more entry
+  cmpl(Address(thread, JavaThread::lock_stack_top_offset()), LockStack::end_offset() - 1);
+  jcc(Assembler::above, slow);
+
+  // Expect the unlocked mark in hdr and install it with the lock bits cleared
+  orptr(hdr, markOopDesc::unlocked_value);
+  movptr(tmp, hdr);
+  andptr(tmp, ~(int32_t)markOopDesc::lock_mask_in_place);
+  if (os::is_MP()) {
+    lock();
+  }
+  cmpxchgptr(tmp, Address(obj, oopDesc::mark_offset_in_bytes()));
+  jcc(Assembler::notEqual, slow);
+
+  // Push obj on the lock stack
+  movl(tmp, Address(thread, JavaThread::lock_stack_top_offset()));
+  movptr(Address(thread, tmp, Address::times_1), obj);
+  addl(tmp, oopSize);
+  movl(Address(thread, JavaThread::lock_stack_top_offset()), tmp);
+}
+
+void MacroAssembler::lightweight_unlock(Register obj, Register hdr, Register tmp, Label& slow) {
+  assert(UseLightweightLocking, "why call this otherwise?");
+  assert(hdr == rax, "header must be in rax for cmpxchg");
+  assert_different_registers(obj, hdr, tmp);
+
+  // Only the top of the lock stack is popped here; objects that are
+  // unlocked out of order are removed by the runtime
+  movl(tmp, Address(r15_thread, JavaThread::lock_stack_top_offset()));
+  cmpptr(obj, Address(r15_thread, tmp, Address::times_1, -oopSize));
+  jcc(Assembler::notEqual, slow);
+
+  // Expect the fast-locked mark in hdr and restore the unlocked mark
+  movptr(tmp, hdr);
+  orptr(tmp, markOopDesc::unlocked_value);
+  if (os::is_MP()) {
+    lock();
+  }
+  cmpxchgptr(tmp, Address(obj, oopDesc::mark_offset_in_bytes()));
+  jcc(Assembler::notEqual, slow);
+
+  // Pop the lock stack
+  subl(Address(r15_thread, JavaThread::lock_stack_top_offset()), oopSize);
+}
+#endif // _LP64
+
 #ifdef COMPILER2
 
 #if INCLUDE_RTM_OPT
@@ -1771,31 +1824,42 @@ void MacroAssembler::fast_lock(Register objReg, Register boxReg, Register tmpReg
     testptr(tmpReg, markOopDesc::monitor_value); // inflated vs stack-locked|neutral|biased
     jccb(Assembler::notZero, IsInflated);
 
-    // Attempt stack-locking ...
-    orptr (tmpReg, markOopDesc::unlocked_value);
-    movptr(Address(boxReg, 0), tmpReg);          // Anticipate successful CAS
-    if (os::is_MP()) {
-      lock();
-    }
-    cmpxchgptr(boxReg, Address(objReg, oopDesc::mark_offset_in_bytes()));      // Updates tmpReg
-    if (counters != NULL) {
-      cond_inc32(Assembler::equal,
-                 ExternalAddress((address)counters->fast_path_entry_count_addr()));
-    }
-    jcc(Assembler::equal, DONE_LABEL);           // Success
-
-    // Recursive locking.
-    // The object is stack-locked: markword contains stack pointer to BasicLock.
-    // Locked by current thread if difference with current SP is less than one page.
-    subptr(tmpReg, rsp);
-    // Next instruction set ZFlag == 1 (Success) if difference is less then one page.
-    andptr(tmpReg, (int32_t) (NOT_LP64(0xFFFFF003) LP64_ONLY(7 - os::vm_page_size())) );
-    movptr(Address(boxReg, 0), tmpReg);
-    if (counters != NULL) {
-      cond_inc32(Assembler::equal,
-                 ExternalAddress((address)counters->fast_path_entry_count_addr()));
+#ifdef _LP64
+    if (UseLightweightLocking) {
+      assert(!use_rtm, "RTM locking is not supported with lightweight locking");
+      // Attempt fast-locking; the box is not used.
+      lightweight_lock(objReg, tmpReg, r15_thread, scrReg, DONE_LABEL);
+      xorl(tmpReg, tmpReg);                      // set ZF=1 to indicate success
+      jmp(DONE_LABEL);
+    } else
+#endif // _LP64
+    {
+      // Attempt stack-locking ...
+      orptr (tmpReg, markOopDesc::unlocked_value);
+      movptr(Address(boxReg, 0), tmpReg);          // Anticipate successful CAS
+      if (os::is_MP()) {
+        lock();
+      }
+      cmpxchgptr(boxReg, Address(objReg, oopDesc::mark_offset_in_bytes()));      // Updates tmpReg
+      if (counters != NULL) {
+        cond_inc32(Assembler::equal,
+                   ExternalAddress((address)counters->fast_path_entry_count_addr()));
+      }
+      jcc(Assembler::equal, DONE_LABEL);           // Success
+
+      // Recursive locking.
+      // The object is stack-locked: markword contains stack pointer to BasicLock.
+      // Locked by current thread if difference with current SP is less than one page.
+      subptr(tmpReg, rsp);
+      // Next instruction set ZFlag == 1 (Success) if difference is less then one page.
+      andptr(tmpReg, (int32_t) (NOT_LP64(0xFFFFF003) LP64_ONLY(7 - os::vm_page_size())) );
+      movptr(Address(boxReg, 0), tmpReg);
+      if (counters != NULL) {
+        cond_inc32(Assembler::equal,
+                   ExternalAddress((address)counters->fast_path_entry_count_addr()));
+      }
+      jmp(DONE_LABEL);
     }
-    jmp(DONE_LABEL);
 
     bind(IsInflated);
     // The object is inflated. tmpReg contains pointer to ObjectMonitor* + markOopDesc::monitor_value
@@ -2008,11 +2072,27 @@ void MacroAssembler::fast_unlock(Register objReg, Register boxReg, Register tmpR
     }
 #endif
 
-    cmpptr(Address(boxReg, 0), (int32_t)NULL_WORD); // Examine the displaced header
-    jcc   (Assembler::zero, DONE_LABEL);            // 0 indicates recursive stack-lock
+    if (!UseLightweightLocking) {
+      cmpptr(Address(boxReg, 0), (int32_t)NULL_WORD); // Examine the displaced header
+      jcc   (Assembler::zero, DONE_LABEL);            // 0 indicates recursive stack-lock
+    }
     movptr(tmpReg, Address(objReg, oopDesc::mark_offset_in_bytes()));             // Examine the object's markword
     testptr(tmpReg, markOopDesc::monitor_value);    // Inflated?
-    jccb  (Assembler::zero, Stacked);
+#ifdef _LP64
+    if (UseLightweightLocking) {
+      // It's fast-locked: pop it off the lock stack.  The box is not used.
+      Label Inflated;
+      jccb  (Assembler::notZero, Inflated);
+      movptr(boxReg, tmpReg);
+      lightweight_unlock(objReg, boxReg, tmpReg, DONE_LABEL);
+      xorl  (tmpReg, tmpReg);                       // set ZF=1 to indicate success
+      jmp   (DONE_LABEL);
+      bind  (Inflated);
+    } else
+#endif // _LP64
+    {
+      jccb  (Assembler::zero, Stacked);
+    }
 
     // It's inflated.
 #if INCLUDE_RTM_OPT
@@ -2177,12 +2257,15 @@ void MacroAssembler::fast_unlock(Register objReg, Register boxReg, Register tmpR
     }
 #else // _LP64
     // It's inflated
-    if (EmitSync & 1024) {
+    if ((EmitSync & 1024) || UseLightweightLocking) {
       // Emit code to check that _owner == Self
       // We could fold the _owner test into subsequent code more efficiently
       // than using a stand-alone check, but since _owner checking is off by
       // default we don't bother. We also might consider predicating the
       // _owner==Self check on Xcheck:jni or running on a debug build.
+      // Lightweight locking always checks, so that a monitor that is still
+      // anonymously owned is claimed, and its lock stack entry removed, by
+      // the slow path.
       movptr(boxReg, Address(tmpReg, OM_OFFSET_NO_MONITOR_VALUE_TAG(owner)));
       xorptr(boxReg, r15_thread);
     } else {
@@ -5945,12 +6028,17 @@ void MacroAssembler::verified_entry(int framesize, int stack_bang_size, bool fp_
   }
 }
 
-// clear memory of size 'cnt' qwords, starting at 'base' using XMM/YMM registers
+// clear memory of size 'cnt' qwords, starting at 'base' using XMM/YMM/ZMM registers
 void MacroAssembler::xmm_clear_mem(Register base, Register cnt, XMMRegister xtmp) {
   // cnt - number of qwords (8-byte words).
   // base - start address, qword aligned.
   Label L_zero_64_bytes, L_loop, L_sloop, L_tail, L_end;
-  if (UseAVX >= 2) {
+  // Like the fill stubs, only use 64-byte stores when AVX3Threshold allows
+  // AVX512 code for arrays of any size.
+  bool use64byteVector = (UseAVX > 2) && (MaxVectorSize == 64) && (AVX3Threshold == 0);
+  if (use64byteVector) {
+    vpxor(xtmp, xtmp, xtmp, AVX_512bit);
+  } else if (UseAVX >= 2) {
     vpxor(xtmp, xtmp, xtmp, AVX_256bit);
   } else {
     pxor(xtmp, xtmp);
@@ -5958,7 +6046,9 @@ void MacroAssembler::xmm_clear_mem(Register base, Register cnt, XMMRegister xtmp
   jmp(L_zero_64_bytes);
 
   BIND(L_loop);
-  if (UseAVX >= 2) {
+  if (use64byteVector) {
+    evmovdqul(Address(base, 0), xtmp, Assembler::AVX_512bit);
+  } else if (UseAVX >= 2) {
     vmovdqu(Address(base,  0), xtmp);
     vmovdqu(Address(base, 32), xtmp);
   } else {
@@ -6021,20 +6111,30 @@ void MacroAssembler::clear_mem(Register base, Register cnt, Register tmp, XMMReg
     NOT_LP64(shlptr(cnt, 1);) // convert to number of 32-bit words for 32-bit VM
 
     decrement(cnt);
-    jccb(Assembler::negative, DONE); // Zero length
+    jcc(Assembler::negative, DONE); // Zero length
 
     // Use individual pointer-sized stores for small counts:
     BIND(LOOP);
     movptr(Address(base, cnt, Address::times_ptr), tmp);
     decrement(cnt);
     jccb(Assembler::greaterEqual, LOOP);
-    jmpb(DONE);
+    jmp(DONE);
 
     BIND(LONG);
   }
 
   // Use longer rep-prefixed ops for non-small counts:
   if (UseFastStosb) {
+    if (UseAVX >= 2 && FastStosbThreshold > 0) {
+      // rep stosb has a high startup cost; below the threshold vector
+      // stores are faster.
+      Label L_stosb;
+      cmpptr(cnt, FastStosbThreshold / BytesPerLong);
+      jcc(Assembler::greaterEqual, L_stosb);
+      xmm_clear_mem(base, cnt, xtmp);
+      jmp(DONE);
+      BIND(L_stosb);
+    }
     shlptr(cnt, 3); // convert to number of bytes
     rep_stosb();
   } else if (UseXMMForObjInit) {
@@ -6643,6 +6743,97 @@ void MacroAssembler::string_indexof_char(Register str1, Register cnt1, Register
   bind(DONE_LABEL);
 } // string_indexof_char
 
+// Search a byte[] range for a byte value; cnt1 must not be negative.
+void MacroAssembler::stringL_indexof_char(Register str1, Register cnt1, Register ch, Register result,
+                                          XMMRegister vec1, XMMRegister vec2, XMMRegister vec3, Register tmp) {
+  ShortBranchVerifier sbv(this);
+  assert(UseSSE42Intrinsics, "SSE4.2 intrinsics are required");
+
+  int stride = 16;
+
+  Label FOUND_CHAR, SCAN_TO_CHAR, SCAN_TO_CHAR_LOOP,
+        SCAN_TO_16_CHAR, SCAN_TO_16_CHAR_LOOP, SCAN_TO_32_CHAR_LOOP,
+        RET_NOT_FOUND, SCAN_TO_16_CHAR_INIT,
+        FOUND_SEQ_CHAR, DONE_LABEL;
+
+  movptr(result, str1);
+  if (UseAVX >= 2) {
+    cmpl(cnt1, stride);
+    jcc(Assembler::less, SCAN_TO_CHAR);
+    cmpl(cnt1, 2*stride);
+    jcc(Assembler::less, SCAN_TO_16_CHAR_INIT);
+    movdl(vec1, ch);
+    vpbroadcastb(vec1, vec1, Assembler::AVX_256bit);
+    vpxor(vec2, vec2);
+    movl(tmp, cnt1);
+    andl(tmp, 0xFFFFFFE0);  //vector count (in bytes)
+    andl(cnt1,0x0000001F);  //tail count (in bytes)
+
+    bind(SCAN_TO_32_CHAR_LOOP);
+    vmovdqu(vec3, Address(result, 0));
+    vpcmpeqb(vec3, vec3, vec1, Assembler::AVX_256bit);
+    vptest(vec2, vec3);
+    jcc(Assembler::carryClear, FOUND_CHAR);
+    addptr(result, 32);
+    subl(tmp, 2*stride);
+    jccb(Assembler::notZero, SCAN_TO_32_CHAR_LOOP);
+    jmp(SCAN_TO_16_CHAR);
+    bind(SCAN_TO_16_CHAR_INIT);
+    movdl(vec1, ch);
+    pxor(vec2, vec2);
+    pshufb(vec1, vec2);
+  }
+  bind(SCAN_TO_16_CHAR);
+  cmpl(cnt1, stride);
+  jcc(Assembler::less, SCAN_TO_CHAR);
+  if (UseAVX < 2) {
+    movdl(vec1, ch);
+    pxor(vec2, vec2);
+    pshufb(vec1, vec2);
+  }
+  movl(tmp, cnt1);
+  andl(tmp, 0xFFFFFFF0);  //vector count (in bytes)
+  andl(cnt1,0x0000000F);  //tail count (in bytes)
+
+  bind(SCAN_TO_16_CHAR_LOOP);
+  movdqu(vec3, Address(result, 0));
+  pcmpeqb(vec3, vec1);
+  ptest(vec2, vec3);
+  jcc(Assembler::carryClear, FOUND_CHAR);
+  addptr(result, 16);
+  subl(tmp, stride);
+  jccb(Assembler::notZero, SCAN_TO_16_CHAR_LOOP);
+  bind(SCAN_TO_CHAR);
+  testl(cnt1, cnt1);
+  jcc(Assembler::zero, RET_NOT_FOUND);
+  bind(SCAN_TO_CHAR_LOOP);
+  load_unsigned_byte(tmp, Address(result, 0));
+  cmpl(ch, tmp);
+  jccb(Assembler::equal, FOUND_SEQ_CHAR);
+  addptr(result, 1);
+  subl(cnt1, 1);
+  jccb(Assembler::zero, RET_NOT_FOUND);
+  jmp(SCAN_TO_CHAR_LOOP);
+
+  bind(RET_NOT_FOUND);
+  movl(result, -1);
+  jmpb(DONE_LABEL);
+
+  bind(FOUND_CHAR);
+  if (UseAVX >= 2) {
+    vpmovmskb(tmp, vec3);
+  } else {
+    pmovmskb(tmp, vec3);
+  }
+  bsfl(ch, tmp);
+  addptr(result, ch);
+
+  bind(FOUND_SEQ_CHAR);
+  subptr(result, str1);
+
+  bind(DONE_LABEL);
+} // stringL_indexof_char
+
 // helper function for string_compare
 void MacroAssembler::load_next_elements(Register elem1, Register elem2, Register str1, Register str2,
                                         Address::ScaleFactor scale, Address::ScaleFactor scale1,
@@ -8516,6 +8707,99 @@ void MacroAssembler::vectorized_mismatch(Register obja, Register objb, Register
   bind(DONE);
 }
 
+// Compute the polynomial hash of String.hashCode() and Arrays.hashCode():
+//   result = result * 31^cnt + sum(ary[i] * 31^(cnt - 1 - i)),  0 <= i < cnt
+// over cnt zero extended bytes or ints.  The main loop keeps four vector
+// accumulators of per lane partial sums and scales them by 31^block for
+// each block of elements.  Lane j of accumulator k is then weighted by
+// 31^(block - 1 - k * lanes - j), taken from the tail of the powers table,
+// and the lanes are reduced into result.  Leftover elements are hashed
+// one at a time.
+void MacroAssembler::vectorized_hashcode(Register ary, Register cnt, Register result, Register tmp,
+                                         XMMRegister vacc0, XMMRegister vacc1, XMMRegister vacc2, XMMRegister vacc3,
+                                         XMMRegister vpow, XMMRegister vtmp, BasicType eltype) {
+  assert(UseAVX >= 2, "AVX2 must be enabled");
+  assert(eltype == T_BYTE || eltype == T_INT, "unsupported element type");
+  Label VECTOR_LOOP, SCALAR_LOOP, SCALAR_NEXT, DONE;
+
+  const bool use_evex = (AVX3Threshold == 0) && (UseAVX > 2);
+  const int vector_len = use_evex ? AVX_512bit : AVX_256bit;
+  const int lanes = use_evex ? 16 : 8;
+  const int block = 4 * lanes;
+  const int elem_size = type2aelembytes(eltype);
+  const XMMRegister vacc[] = { vacc0, vacc1, vacc2, vacc3 };
+
+  juint pow_block = 1;
+  for (int i = 0; i < block; i++) {
+    pow_block *= 31;
+  }
+
+  cmpl(cnt, block);
+  jcc(Assembler::less, SCALAR_LOOP);
+
+  for (int k = 0; k < 4; k++) {
+    vpxor(vacc[k], vacc[k], vacc[k], vector_len);
+  }
+  movl(tmp, (int)pow_block);
+  movdl(vpow, tmp);
+  vpbroadcastd(vpow, vpow, vector_len);
+
+  bind(VECTOR_LOOP);
+  imull(result, result, (int)pow_block);
+  for (int k = 0; k < 4; k++) {
+    vpmulld(vacc[k], vacc[k], vpow, vector_len);
+    if (eltype == T_BYTE) {
+      vpmovzxbd(vtmp, Address(ary, k * lanes), vector_len);
+      vpaddd(vacc[k], vacc[k], vtmp, vector_len);
+    } else {
+      vpaddd(vacc[k], vacc[k], Address(ary, k * lanes * elem_size), vector_len);
+    }
+  }
+  addptr(ary, block * elem_size);
+  subl(cnt, block);
+  cmpl(cnt, block);
+  jcc(Assembler::greaterEqual, VECTOR_LOOP);
+
+  // The powers table holds 31^63 down to 31^0.
+  lea(tmp, ExternalAddress(StubRoutines::x86::hashcode_powers_of_31_addr()));
+  for (int k = 0; k < 4; k++) {
+    vpmulld(vacc[k], vacc[k], Address(tmp, (64 - block + k * lanes) * 4), vector_len);
+  }
+  vpaddd(vacc0, vacc0, vacc1, vector_len);
+  vpaddd(vacc2, vacc2, vacc3, vector_len);
+  vpaddd(vacc0, vacc0, vacc2, vector_len);
+  if (use_evex) {
+    vextracti64x4_high(vtmp, vacc0);
+    vpaddd(vacc0, vacc0, vtmp, AVX_256bit);
+  }
+  vextracti128_high(vtmp, vacc0);
+  vpaddd(vacc0, vacc0, vtmp, AVX_128bit);
+  pshufd(vtmp, vacc0, 0x0E);
+  vpaddd(vacc0, vacc0, vtmp, AVX_128bit);
+  pshufd(vtmp, vacc0, 0x01);
+  vpaddd(vacc0, vacc0, vtmp, AVX_128bit);
+  movdl(tmp, vacc0);
+  addl(result, tmp);
+
+  bind(SCALAR_LOOP);
+  testl(cnt, cnt);
+  jcc(Assembler::zero, DONE);
+
+  bind(SCALAR_NEXT);
+  imull(result, result, 31);
+  if (eltype == T_BYTE) {
+    movzbl(tmp, Address(ary, 0));
+  } else {
+    movl(tmp, Address(ary, 0));
+  }
+  addl(result, tmp);
+  addptr(ary, elem_size);
+  decrementl(cnt);
+  jcc(Assembler::notZero, SCALAR_NEXT);
+
+  bind(DONE);
+}
+
 //Helper functions for square_to_len()
 
 /**
@@ -675,6 +675,14 @@ class MacroAssembler: public Assembler {
                            Label& done, Label* slow_case = NULL,
                            BiasedLockingCounters* counters = NULL);
   void biased_locking_exit (Register obj_reg, Register temp_reg, Label& done);
+#ifdef _LP64
+  // Lightweight locking support (UseLightweightLocking).
+  // hdr must be rax and hold the mark word of obj; hdr and tmp are killed.
+  // The object is pushed on, or popped from, the lock stack of the thread.
+  // Branches to slow, with ICC.ZF == 0, if that cannot be done inline.
+  void lightweight_lock(Register obj, Register hdr, Register thread, Register tmp, Label& slow);
+  void lightweight_unlock(Register obj, Register hdr, Register tmp, Label& slow);
+#endif
 #ifdef COMPILER2
   // Code used by cmpFastLock and cmpFastUnlock mach instructions in .ad file.
   // See full desription in macroAssembler_x86.cpp.
@@ -1660,6 +1668,9 @@ public:
   void string_indexof_char(Register str1, Register cnt1, Register ch, Register result,
                            XMMRegister vec1, XMMRegister vec2, XMMRegister vec3, Register tmp);
 
+  void stringL_indexof_char(Register str1, Register cnt1, Register ch, Register result,
+                            XMMRegister vec1, XMMRegister vec2, XMMRegister vec3, Register tmp);
+
   // IndexOf strings.
   // Small strings are loaded through stack if they cross page boundary.
   void string_indexof(Register str1, Register str2,
@@ -1751,6 +1762,9 @@ public:
   void vectorized_mismatch(Register obja, Register objb, Register length, Register log2_array_indxscale,
                            Register result, Register tmp1, Register tmp2,
                            XMMRegister vec1, XMMRegister vec2, XMMRegister vec3);
+  void vectorized_hashcode(Register ary, Register cnt, Register result, Register tmp,
+                           XMMRegister vacc0, XMMRegister vacc1, XMMRegister vacc2, XMMRegister vacc3,
+                           XMMRegister vpow, XMMRegister vtmp, BasicType eltype);
 #endif
 
   // CRC32 code for java.util.zip.CRC32::updateBytes() intrinsic.
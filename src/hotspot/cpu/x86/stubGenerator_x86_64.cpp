@@ -2295,7 +2295,7 @@ class StubGenerator: public StubCodeGenerator {
   address generate_checkcast_copy(const char *name, address *entry,
                                   bool dest_uninitialized = false) {
 
-    Label L_load_element, L_store_element, L_do_card_marks, L_done;
+    Label L_load_element, L_store_element, L_store_new_klass, L_do_card_marks, L_done;
 
     // Input registers (after setup_arg_regs)
     const Register from        = rdi;   // source array address
@@ -2304,7 +2304,7 @@ class StubGenerator: public StubCodeGenerator {
     const Register ckoff       = rcx;   // super_check_offset
     const Register ckval       = r8;    // super_klass
 
-    // Registers used as temps (r13, r14 are save-on-entry)
+    // Registers used as temps (r13, r14, rbx are save-on-entry)
     const Register end_from    = from;  // source array end address
     const Register end_to      = r13;   // destination array end address
     const Register count       = rdx;   // -(count_remaining)
@@ -2314,6 +2314,7 @@ class StubGenerator: public StubCodeGenerator {
 
     const Register rax_oop    = rax;    // actual oop copied
     const Register r11_klass  = r11;    // oop._klass
+    const Register rbx_last_klass = rbx; // klass of the last checked element (save-on-entry)
 
     //---------------------------------------------------------------
     // Assembler stub will be used for this call to arraycopy
@@ -2352,15 +2353,17 @@ class StubGenerator: public StubCodeGenerator {
       BLOCK_COMMENT("Entry:");
     }
 
-    // allocate spill slots for r13, r14
+    // allocate spill slots for r13, r14, rbx
     enum {
       saved_r13_offset,
       saved_r14_offset,
+      saved_rbx_offset,
       saved_rbp_offset
     };
     __ subptr(rsp, saved_rbp_offset * wordSize);
     __ movptr(Address(rsp, saved_r13_offset * wordSize), r13);
     __ movptr(Address(rsp, saved_r14_offset * wordSize), r14);
+    __ movptr(Address(rsp, saved_rbx_offset * wordSize), rbx);
 
     // check that int operands are properly extended to size_t
     assert_clean_int(length, rax);
@@ -2399,6 +2402,7 @@ class StubGenerator: public StubCodeGenerator {
     __ lea(end_from, end_from_addr);
     __ lea(end_to,   end_to_addr);
     __ movptr(r14_length, length);        // save a copy of the length
+    __ movptr(rbx_last_klass, ckval);     // the super klass trivially passes
     assert(length == count, "");          // else fix next line:
     __ negptr(count);                     // negate and test the length
     __ jcc(Assembler::notZero, L_load_element);
@@ -2426,7 +2430,10 @@ class StubGenerator: public StubCodeGenerator {
     __ jcc(Assembler::zero, L_store_element);
 
     __ load_klass(r11_klass, rax_oop);// query the object klass
-    generate_type_check(r11_klass, ckoff, ckval, L_store_element);
+    // Runs of elements of the same klass only need the first one checked.
+    __ cmpptr(r11_klass, rbx_last_klass);
+    __ jcc(Assembler::equal, L_store_element);
+    generate_type_check(r11_klass, ckoff, ckval, L_store_new_klass);
     // ======== end loop ========
 
     // It was a real error; we must depend on the caller to finish the job.
@@ -2441,6 +2448,12 @@ class StubGenerator: public StubCodeGenerator {
     __ jccb(Assembler::notZero, L_post_barrier);
     __ jmp(L_done); // K == 0, nothing was copied, skip post barrier
 
+    // The element's klass passed the type check; remember it and go
+    // back to the loop.
+    __ BIND(L_store_new_klass);
+    __ movptr(rbx_last_klass, r11_klass);
+    __ jmp(L_store_element);
+
     // Come here on success only.
     __ BIND(L_do_card_marks);
     __ xorptr(rax, rax);              // return 0 on success
@@ -2452,6 +2465,7 @@ class StubGenerator: public StubCodeGenerator {
     __ BIND(L_done);
     __ movptr(r13, Address(rsp, saved_r13_offset * wordSize));
     __ movptr(r14, Address(rsp, saved_r14_offset * wordSize));
+    __ movptr(rbx, Address(rsp, saved_rbx_offset * wordSize));
     restore_arg_regs();
     inc_counter_np(SharedRuntime::_checkcast_array_copy_ctr); // Update counter after rscratch1 is free
     __ leave(); // required for proper stackwalking of RuntimeStub frame
@@ -5269,6 +5283,180 @@ address generate_avx_ghash_processBlocks() {
       return start;
   }
 
+  // Adler32 byte weights 32..1 followed by sixteen 16-bit ones
+  address adler32_ascale_tables_addr() {
+    __ align(CodeEntryAlignment);
+    StubCodeMark mark(this, "StubRoutines", "adler32_ascale_tables");
+    address start = __ pc();
+    __ emit_data64(0x191A1B1C1D1E1F20, relocInfo::none);
+    __ emit_data64(0x1112131415161718, relocInfo::none);
+    __ emit_data64(0x090A0B0C0D0E0F10, relocInfo::none);
+    __ emit_data64(0x0102030405060708, relocInfo::none);
+    __ emit_data64(0x0001000100010001, relocInfo::none);
+    __ emit_data64(0x0001000100010001, relocInfo::none);
+    __ emit_data64(0x0001000100010001, relocInfo::none);
+    __ emit_data64(0x0001000100010001, relocInfo::none);
+    return start;
+  }
+
+  // x mod 65521 for any 32-bit x, using 2^16 == 15 (mod 65521).
+  void adler32_reduce(Register x, Register tmp) {
+    Label L_done;
+    for (int i = 0; i < 2; i++) {
+      __ movl(tmp, x);
+      __ shrl(tmp, 16);
+      __ andl(x, 0xffff);
+      __ imull(tmp, tmp, 15);
+      __ addl(x, tmp);
+    }
+    // x <= 65535 + 15 * 15 here
+    __ cmpl(x, 65521);
+    __ jccb(Assembler::below, L_done);
+    __ subl(x, 65521);
+    __ bind(L_done);
+  }
+
+  // Add up the eight dwords of a ymm register into dst.
+  void adler32_sum_lanes(Register dst, XMMRegister src, XMMRegister xtmp) {
+    __ vextracti128(xtmp, src, 1);
+    __ vpaddd(src, src, xtmp, Assembler::AVX_128bit);
+    __ vpshufd(xtmp, src, 0x4E, Assembler::AVX_128bit);
+    __ vpaddd(src, src, xtmp, Assembler::AVX_128bit);
+    __ vpshufd(xtmp, src, 0xB1, Assembler::AVX_128bit);
+    __ vpaddd(src, src, xtmp, Assembler::AVX_128bit);
+    __ movdl(dst, src);
+  }
+
+  /**
+   *  Arguments:
+   *
+   * Inputs:
+   *   c_rarg0   - int adler
+   *   c_rarg1   - byte* buff
+   *   c_rarg2   - int len
+   *
+   * Output:
+   *   rax       - int adler result
+   *
+   * Processes 32 bytes per iteration. For a block x[0..31] and running
+   * sums (a, b):
+   *   a' = a + sum(x[i])
+   *   b' = b + 32 * a + sum((32 - i) * x[i])
+   * The byte sums come from vpsadbw, the weighted sums from vpmaddubsw and
+   * vpmaddwd. The 32 * a terms are collected in a separate accumulator and
+   * added once per run of blocks. A run is at most NMAX bytes, which keeps
+   * every sum below 2^32 until it is reduced mod 65521. The remaining
+   * bytes are added one at a time.
+   */
+  address generate_updateBytesAdler32() {
+    assert(UseAdler32Intrinsics, "need AVX2");
+
+    __ align(CodeEntryAlignment);
+    StubCodeMark mark(this, "StubRoutines", "updateBytesAdler32");
+    address start = __ pc();
+
+    const int BLOCK_SIZE = 32;
+    const int NMAX_BLOCKS = 5552 / BLOCK_SIZE;
+
+    const Register adler = c_rarg0;
+    const Register buff  = c_rarg1;
+    const Register len   = c_rarg2;
+    const Register table = c_rarg3;
+    const Register s1    = rax;
+    const Register s2    = r11;
+    const Register count = r10;
+    const Register tmp   = adler;    // free once s1 and s2 are set up
+    assert_different_registers(adler, buff, len, table, s1, s2, count);
+
+    // Only xmm0-xmm5 are used, they are volatile on all platforms.
+    const XMMRegister xzero  = xmm0;
+    const XMMRegister xps    = xmm1;
+    const XMMRegister xs1    = xmm2;
+    const XMMRegister xs2    = xmm3;
+    const XMMRegister xbytes = xmm4;
+    const XMMRegister xtmp   = xmm5;
+
+    Label L_runs, L_run_size_ok, L_blocks, L_tail, L_tail_loop, L_done;
+
+    __ enter(); // required for proper stackwalking of RuntimeStub frame
+
+    __ movl(s2, adler);
+    __ shrl(s2, 16);
+    __ movl(s1, adler);
+    __ andl(s1, 0xffff);
+
+    __ lea(table, ExternalAddress(StubRoutines::x86::adler32_ascale_tables_addr()));
+    __ vpxor(xzero, xzero, xzero, Assembler::AVX_256bit);
+
+    __ bind(L_runs);
+    __ cmpl(len, BLOCK_SIZE);
+    __ jcc(Assembler::below, L_tail);
+
+    // count = min(len / BLOCK_SIZE, NMAX_BLOCKS)
+    __ movl(count, len);
+    __ shrl(count, exact_log2(BLOCK_SIZE));
+    __ cmpl(count, NMAX_BLOCKS);
+    __ jccb(Assembler::belowEqual, L_run_size_ok);
+    __ movl(count, NMAX_BLOCKS);
+    __ bind(L_run_size_ok);
+    __ movl(tmp, count);
+    __ shll(tmp, exact_log2(BLOCK_SIZE));
+    __ subl(len, tmp);
+
+    // xps = s1 * count, xs2 = s2, xs1 = 0
+    __ movl(tmp, s1);
+    __ imull(tmp, count);
+    __ movdl(xps, tmp);
+    __ movdl(xs2, s2);
+    __ vpxor(xs1, xs1, xs1, Assembler::AVX_256bit);
+
+    __ align(OptoLoopAlignment);
+    __ bind(L_blocks);
+    __ vmovdqu(xbytes, Address(buff, 0));
+    __ vpaddd(xps, xps, xs1, Assembler::AVX_256bit);
+    __ vpsadbw(xtmp, xbytes, xzero, Assembler::AVX_256bit);
+    __ vpaddd(xs1, xs1, xtmp, Assembler::AVX_256bit);
+    __ vpmaddubsw(xtmp, xbytes, Address(table, 0), Assembler::AVX_256bit);
+    __ vpmaddwd(xtmp, xtmp, Address(table, BLOCK_SIZE), Assembler::AVX_256bit);
+    __ vpaddd(xs2, xs2, xtmp, Assembler::AVX_256bit);
+    __ addptr(buff, BLOCK_SIZE);
+    __ decrementl(count);
+    __ jcc(Assembler::notZero, L_blocks);
+
+    __ vpslld(xps, xps, exact_log2(BLOCK_SIZE), Assembler::AVX_256bit);
+    __ vpaddd(xs2, xs2, xps, Assembler::AVX_256bit);
+
+    adler32_sum_lanes(tmp, xs1, xtmp);
+    __ addl(s1, tmp);
+    adler32_sum_lanes(s2, xs2, xtmp);
+    adler32_reduce(s1, tmp);
+    adler32_reduce(s2, tmp);
+    __ jmp(L_runs);
+
+    // Fewer than BLOCK_SIZE bytes left, s1 and s2 stay well below 2^32.
+    __ bind(L_tail);
+    __ testl(len, len);
+    __ jccb(Assembler::zero, L_done);
+    __ bind(L_tail_loop);
+    __ movzbl(tmp, Address(buff, 0));
+    __ addl(s1, tmp);
+    __ addl(s2, s1);
+    __ incrementq(buff);
+    __ decrementl(len);
+    __ jccb(Assembler::notZero, L_tail_loop);
+    adler32_reduce(s1, tmp);
+    adler32_reduce(s2, tmp);
+
+    __ bind(L_done);
+    __ shll(s2, 16);
+    __ orl(s1, s2);     // s1 is rax
+    __ vzeroupper();
+    __ leave(); // required for proper stackwalking of RuntimeStub frame
+    __ ret(0);
+
+    return start;
+  }
+
   /**
    *  Arguments:
    *
@@ -5384,6 +5572,60 @@ address generate_avx_ghash_processBlocks() {
     return start;
   }
 
+  // Powers of 31 from 31^63 down to 31^0, used to weight the lanes of the
+  // vectorized hashCode accumulators.
+  address generate_hashcode_powers_of_31() {
+    __ align(64);
+    StubCodeMark mark(this, "StubRoutines", "hashcode_powers_of_31");
+    address start = __ pc();
+
+    juint powers[64];
+    juint p = 1;
+    for (int i = 63; i >= 0; i--) {
+      powers[i] = p;
+      p *= 31;
+    }
+    for (int i = 0; i < 64; i++) {
+      __ emit_int32(powers[i]);
+    }
+
+    return start;
+  }
+
+  /**
+  *  Arguments:
+  *
+  *  Input:
+  *    c_rarg0   - ary      address of the first element
+  *    c_rarg1   - cnt      number of elements
+  *    c_rarg2   - initial  initial hash value
+  *
+  *  Output:
+  *        rax   - int hash
+  */
+  address generate_vectorizedHashCode(BasicType eltype, const char* name) {
+    __ align(CodeEntryAlignment);
+    StubCodeMark mark(this, "StubRoutines", name);
+    address start = __ pc();
+
+    BLOCK_COMMENT("Entry:");
+    __ enter();
+
+    const Register ary = c_rarg0;
+    const Register cnt = c_rarg1;
+    const Register result = rax; //return value
+    const Register tmp = r10;
+
+    __ movl(result, c_rarg2);
+    __ vectorized_hashcode(ary, cnt, result, tmp, xmm0, xmm1, xmm2, xmm3, xmm4, xmm5, eltype);
+
+    __ vzeroupper();
+    __ leave();
+    __ ret(0);
+
+    return start;
+  }
+
 /**
    *  Arguments:
    *
@@ -5992,6 +6234,11 @@ address generate_avx_ghash_processBlocks() {
       StubRoutines::_crc32c_table_addr = (address)StubRoutines::x86::_crc32c_table;
       StubRoutines::_updateBytesCRC32C = generate_updateBytesCRC32C(supports_clmul);
     }
+    if (UseAdler32Intrinsics) {
+      StubRoutines::x86::_adler32_ascale_tables = adler32_ascale_tables_addr();
+      StubRoutines::_updateBytesAdler32 = generate_updateBytesAdler32();
+    }
+
     if (VM_Version::supports_sse2() && UseLibmIntrinsic && InlineIntrinsics) {
       if (vmIntrinsics::is_intrinsic_available(vmIntrinsics::_dsin) ||
           vmIntrinsics::is_intrinsic_available(vmIntrinsics::_dcos) ||
@@ -6192,6 +6439,11 @@ address generate_avx_ghash_processBlocks() {
     if (UseVectorizedMismatchIntrinsic) {
       StubRoutines::_vectorizedMismatch = generate_vectorizedMismatch();
     }
+    if (UseVectorizedHashCodeIntrinsic) {
+      StubRoutines::x86::_hashcode_powers_of_31_addr = generate_hashcode_powers_of_31();
+      StubRoutines::_vectorizedHashCodeB = generate_vectorizedHashCode(T_BYTE, "vectorizedHashCodeB");
+      StubRoutines::_vectorizedHashCodeI = generate_vectorizedHashCode(T_INT, "vectorizedHashCodeI");
+    }
   }
 
  public:
@@ -168,6 +168,10 @@ class x86 {
   static address _left_shift_mask;
   static address _and_mask;
   static address _url_charset;
+  // powers of 31 for the vectorized hashCode
+  static address _hashcode_powers_of_31_addr;
+  // byte weights and word ones for Adler32
+  static address _adler32_ascale_tables;
 #endif
   // byte flip mask for sha256
   static address _pshuffle_byte_flip_mask_addr;
@@ -270,6 +274,8 @@ class x86 {
   static address base64_left_shift_mask_addr() { return _left_shift_mask; }
   static address base64_and_mask_addr() { return _and_mask; }
   static address counter_mask_addr() { return _counter_mask_addr; }
+  static address hashcode_powers_of_31_addr() { return _hashcode_powers_of_31_addr; }
+  static address adler32_ascale_tables_addr() { return _adler32_ascale_tables; }
 #endif
   static address pshuffle_byte_flip_mask_addr() { return _pshuffle_byte_flip_mask_addr; }
   static void generate_CRC32C_table(bool is_pclmulqdq_supported);
@@ -916,13 +916,14 @@ void TemplateTable::aload_0_internal(RewriteControl rc) {
   // _aload_0, _fast_igetfield
   // _aload_0, _fast_agetfield
   // _aload_0, _fast_fgetfield
+  // _aload_0, _fast_bgetfield
+  // _aload_0, _fast_lgetfield
   //
   // occur frequently. If RewriteFrequentPairs is set, the (slow)
-  // _aload_0 bytecode checks if the next bytecode is either
-  // _fast_igetfield, _fast_agetfield or _fast_fgetfield and then
-  // rewrites the current bytecode into a pair bytecode; otherwise it
-  // rewrites the current bytecode into _fast_aload_0 that doesn't do
-  // the pair check anymore.
+  // _aload_0 bytecode checks if the next bytecode is one of these
+  // _fast_<x>getfield bytecodes and then rewrites the current bytecode
+  // into a pair bytecode; otherwise it rewrites the current bytecode
+  // into _fast_aload_0 that doesn't do the pair check anymore.
   //
   // Note: If the next bytecode is _getfield, the rewrite must be
   //       delayed, otherwise we may miss an opportunity for a pair.
@@ -963,6 +964,20 @@ void TemplateTable::aload_0_internal(RewriteControl rc) {
     __ movl(bc, Bytecodes::_fast_faccess_0);
     __ jccb(Assembler::equal, rewrite);
 
+    // if _bgetfield then rewrite to _fast_baccess_0
+    assert(Bytecodes::java_code(Bytecodes::_fast_baccess_0) == Bytecodes::_aload_0, "fix bytecode definition");
+    __ cmpl(rbx, Bytecodes::_fast_bgetfield);
+    __ movl(bc, Bytecodes::_fast_baccess_0);
+    __ jccb(Assembler::equal, rewrite);
+
+#ifdef _LP64
+    // if _lgetfield then rewrite to _fast_laccess_0
+    assert(Bytecodes::java_code(Bytecodes::_fast_laccess_0) == Bytecodes::_aload_0, "fix bytecode definition");
+    __ cmpl(rbx, Bytecodes::_fast_lgetfield);
+    __ movl(bc, Bytecodes::_fast_laccess_0);
+    __ jccb(Assembler::equal, rewrite);
+#endif
+
     // else rewrite to _fast_aload0
     assert(Bytecodes::java_code(Bytecodes::_fast_aload_0) == Bytecodes::_aload_0, "fix bytecode definition");
     __ movl(bc, Bytecodes::_fast_aload_0);
@@ -3570,17 +3585,27 @@ void TemplateTable::fast_xaccess(TosState state) {
   __ increment(rbcp);
   __ null_check(rax);
   const Address field = Address(rax, rbx, Address::times_1, 0*wordSize);
-  switch (state) {
-  case itos:
+  switch (bytecode()) {
+  case Bytecodes::_fast_iaccess_0:
     __ access_load_at(T_INT, IN_HEAP, rax, field, noreg, noreg);
     break;
-  case atos:
+  case Bytecodes::_fast_aaccess_0:
     do_oop_load(_masm, field, rax);
     __ verify_oop(rax);
     break;
-  case ftos:
+  case Bytecodes::_fast_faccess_0:
     __ access_load_at(T_FLOAT, IN_HEAP, noreg /* ftos */, field, noreg, noreg);
     break;
+  case Bytecodes::_fast_baccess_0:
+    __ access_load_at(T_BYTE, IN_HEAP, rax, field, noreg, noreg);
+    break;
+  case Bytecodes::_fast_laccess_0:
+#ifdef _LP64
+    __ access_load_at(T_LONG, IN_HEAP, noreg /* ltos */, field, noreg, noreg);
+#else
+    __ stop("should not be rewritten");
+#endif
+    break;
   default:
     ShouldNotReachHere();
   }
@@ -3852,6 +3877,14 @@ void TemplateTable::invokeinterface(int byte_no) {
 
   // Preserve method for throw_AbstractMethodErrorVerbose.
   __ mov(rcx, rbx);
+  // If REFC is the declaring interface of the method, the itable lookup
+  // of the method below also does the receiver subtype check, so skip
+  // the separate itable scan for REFC.
+  Label refc_checked;
+  __ movptr(rlocals, Address(rbx, Method::const_offset()));
+  __ movptr(rlocals, Address(rlocals, ConstMethod::constants_offset()));
+  __ cmpptr(rax, Address(rlocals, ConstantPool::pool_holder_offset_in_bytes()));
+  __ jcc(Assembler::equal, refc_checked);
   // Receiver subtype check against REFC.
   // Superklass in rax. Subklass in rdx. Blows rcx, rdi.
   __ lookup_interface_method(// inputs: rec. class, interface, itable index
@@ -3860,6 +3893,7 @@ void TemplateTable::invokeinterface(int byte_no) {
                              rbcp, rlocals,
                              no_such_interface,
                              /*return_method=*/false);
+  __ bind(refc_checked);
 
   // profile this call
   __ restore_bcp(); // rbcp was destroyed by receiver type check
@@ -359,7 +359,10 @@ protected:
     CPU_MODEL_HASWELL_E3     = 0x3c,
     CPU_MODEL_HASWELL_E7     = 0x3f,
     CPU_MODEL_BROADWELL      = 0x3d,
-    CPU_MODEL_SKYLAKE        = 0x55
+    CPU_MODEL_SKYLAKE        = 0x55,
+    CPU_MODEL_ICELAKE_SERVER = 0x6a,
+    CPU_MODEL_ICELAKE_D      = 0x6c,
+    CPU_MODEL_SAPPHIRERAPIDS = 0x8f
   };
 
   // cpuid information block.  All info derived from executing cpuid with
@@ -846,6 +849,19 @@ public:
   static bool is_intel_skylake() { return is_intel_family_core() &&
                                           extended_cpu_model() == CPU_MODEL_SKYLAKE; }
 
+  // Server parts from Ice Lake on lose much less frequency than Skylake and
+  // Cascade Lake when running 512-bit instructions, so AVX512 stubs beat
+  // their AVX2 counterparts even for short arrays.
+  static bool is_intel_avx512_fast() {
+    if (is_intel_family_core()) {
+      uint32_t ext_model = extended_cpu_model();
+      return ext_model == CPU_MODEL_ICELAKE_SERVER ||
+             ext_model == CPU_MODEL_ICELAKE_D      ||
+             ext_model == CPU_MODEL_SAPPHIRERAPIDS;
+    }
+    return false;
+  }
+
   static bool is_intel_tsc_synched_at_init()  {
     if (is_intel_family_core()) {
       uint32_t ext_model = extended_cpu_model();
@@ -75,6 +75,12 @@
           " of quotas (if set), when true. Otherwise, use the CPU"    \
           " shares value, provided it is less than quota.")             \
                                                                         \
+  product(uintx, ContainerMetricsRefreshMillis, 20,                    \
+          "Time in milliseconds for which container metrics read from " \
+          "the cgroup file system are cached. 0 re-reads them on every "\
+          "query")                                                      \
+          range(0, max_jint)                                            \
+                                                                        \
   diagnostic(bool, DumpPrivateMappingsInCore, true,                     \
           "If true, sets bit 2 of /proc/PID/coredump_filter, thus "     \
           "resulting in file-backed private mappings of the process to "\
@@ -86,7 +92,11 @@
           "be dumped into the corefile.")                               \
                                                                         \
   diagnostic(bool, UseCpuAllocPath, false,                              \
-             "Use CPU_ALLOC code path in os::active_processor_count ")
+             "Use CPU_ALLOC code path in os::active_processor_count ")  \
+                                                                        \
+  diagnostic(bool, UseFutexPark, true,                                  \
+          "Park and unpark threads with futexes instead of pthread "    \
+          "mutexes and condition variables")
 
 //
 // Defines Linux-specific default values. The flags are available on all
@@ -36,6 +36,7 @@
 
 bool  OSContainer::_is_initialized   = false;
 bool  OSContainer::_is_containerized = false;
+bool  OSContainer::_is_cgroup_v2     = false;
 int   OSContainer::_active_processor_count = 1;
 julong _unlimited_memory;
 
@@ -127,12 +128,15 @@ class CgroupMemorySubsystem: CgroupSubsystem {
      * file if everything else seems unlimited */
     bool _uses_mem_hierarchy;
     volatile jlong _memory_limit_in_bytes;
+    volatile jlong _memory_usage_in_bytes;
+    volatile jlong _next_usage_check_counter;
 
  public:
     CgroupMemorySubsystem(char *root, char *mountpoint) : CgroupSubsystem::CgroupSubsystem(root, mountpoint) {
       _uses_mem_hierarchy = false;
       _memory_limit_in_bytes = -1;
-
+      _memory_usage_in_bytes = -1;
+      _next_usage_check_counter = min_jlong;
     }
 
     bool is_hierarchical() { return _uses_mem_hierarchy; }
@@ -149,6 +153,17 @@ class CgroupMemorySubsystem: CgroupSubsystem {
       set_cache_expiry_time(OSCONTAINER_CACHE_TIMEOUT);
     }
 
+    // The usage is queried by os::available_memory, which is called often
+    // enough to have its own cache.
+    bool usage_cache_has_expired() {
+      return os::elapsed_counter() > _next_usage_check_counter;
+    }
+
+    jlong memory_usage_in_bytes() { return _memory_usage_in_bytes; }
+    void set_memory_usage_in_bytes(jlong value) {
+      _memory_usage_in_bytes = value;
+      _next_usage_check_counter = os::elapsed_counter() + OSCONTAINER_CACHE_TIMEOUT;
+    }
 };
 
 CgroupMemorySubsystem* memory = NULL;
@@ -277,6 +292,54 @@ PRAGMA_DIAG_POP
   log_trace(os, container)(logstring, variable);                          \
 }
 
+/*
+ * cgroup v2 (unified hierarchy) support.
+ *
+ * All controllers share one directory, and limits are either a number or
+ * the string "max" for unlimited.
+ */
+static jlong limit_from_str(const char* limit_str) {
+  if (strcmp(limit_str, "max") == 0) {
+    return (jlong)-1;
+  }
+  julong limit;
+  if (sscanf(limit_str, JULONG_FORMAT, &limit) != 1) {
+    return OSCONTAINER_ERROR;
+  }
+  if (limit >= _unlimited_memory) {
+    return (jlong)-1;
+  }
+  return (jlong)limit;
+}
+
+static jlong read_limit_v2(CgroupSubsystem* c, const char* filename) {
+  char limit_str[1024];
+  int err = subsystem_file_line_contents(c, filename, NULL, "%1023s", limit_str);
+  if (err != 0) {
+    return OSCONTAINER_ERROR;
+  }
+  log_trace(os, container)("%s is: %s", filename + 1, limit_str);
+  return limit_from_str(limit_str);
+}
+
+/* Map cpu.weight (1 to 10000, default 100) back to the cpu.shares
+ * range (2 to 262144, default 1024) the way the container runtimes
+ * convert shares to weight, rounding to the closest multiple of
+ * PER_CPU_SHARES above one cpu.
+ */
+static int weight_to_shares(int weight) {
+  if (weight == 100) {
+    return -1;
+  }
+  int x = (int)((262142.0 * weight - 1) / 9999.0) + 2;
+  if (x <= PER_CPU_SHARES) {
+    return x;
+  }
+  int lower_multiple = (x / PER_CPU_SHARES) * PER_CPU_SHARES;
+  int upper_multiple = lower_multiple + PER_CPU_SHARES;
+  return (x - lower_multiple <= upper_multiple - x) ? lower_multiple : upper_multiple;
+}
+
 /* init
  *
  * Initialize the container support and determine if
@@ -288,6 +351,9 @@ void OSContainer::init() {
   char buf[MAXPATHLEN+1];
   char tmproot[MAXPATHLEN+1];
   char tmpmount[MAXPATHLEN+1];
+  char v2root[MAXPATHLEN+1];
+  char v2mount[MAXPATHLEN+1];
+  bool v2_found = false;
   char *p;
   jlong mem_limit;
 
@@ -328,6 +394,9 @@ void OSContainer::init() {
    *
    * Example for host:
    * 34 28 0:29 / /sys/fs/cgroup/memory rw,nosuid,nodev,noexec,relatime shared:16 - cgroup cgroup rw,memory
+   *
+   * Example for the cgroup v2 unified hierarchy:
+   * 30 23 0:26 / /sys/fs/cgroup rw,nosuid,nodev,noexec,relatime shared:4 - cgroup2 cgroup2 rw,nsdelegate
    */
   mntinfo = fopen("/proc/self/mountinfo", "r");
   if (mntinfo == NULL) {
@@ -342,6 +411,16 @@ void OSContainer::init() {
     char *token;
 
     // mountinfo format is documented at https://www.kernel.org/doc/Documentation/filesystems/proc.txt
+    if (sscanf(p, "%*d %*d %*d:%*d %s %s %*[^-]- cgroup2 %s", tmproot, tmpmount, tmpcgroups) == 3) {
+      if (!v2_found) {
+        strncpy(v2root, tmproot, MAXPATHLEN);
+        v2root[MAXPATHLEN] = '\0';
+        strncpy(v2mount, tmpmount, MAXPATHLEN);
+        v2mount[MAXPATHLEN] = '\0';
+        v2_found = true;
+      }
+      continue;
+    }
     if (sscanf(p, "%*d %*d %*d:%*d %s %s %*[^-]- cgroup %*s %s", tmproot, tmpmount, tmpcgroups) != 3) {
       continue;
     }
@@ -360,6 +439,17 @@ void OSContainer::init() {
 
   fclose(mntinfo);
 
+  // Only use the unified hierarchy if no v1 controllers are mounted. In
+  // hybrid setups the v2 mount carries no controllers.
+  if (v2_found && memory == NULL && cpuset == NULL && cpu == NULL && cpuacct == NULL) {
+    log_debug(os, container)("Using cgroup v2 unified hierarchy at %s", v2mount);
+    _is_cgroup_v2 = true;
+    memory = new CgroupMemorySubsystem(v2root, v2mount);
+    cpu = new CgroupSubsystem(v2root, v2mount);
+    cpuset = cpu;
+    cpuacct = cpu;
+  }
+
   if (memory == NULL) {
     log_debug(os, container)("Required cgroup memory subsystem not found");
     return;
@@ -399,6 +489,9 @@ void OSContainer::init() {
    *
    * /sys/fs/cgroup/memory/user.slice
    *
+   * With cgroup v2 there is a single line with hierarchy id 0 and
+   * an empty controller list:
+   * 0::/kubepods/burstable/pod8d5a2e5c/0b1b4f4b
    */
   cgroup = fopen("/proc/self/cgroup", "r");
   if (cgroup == NULL) {
@@ -408,13 +501,13 @@ void OSContainer::init() {
   }
 
   while ((p = fgets(buf, MAXPATHLEN, cgroup)) != NULL) {
+    char *hierarchy_id;
     char *controllers;
     char *token;
     char *base;
 
-    /* Skip cgroup number */
-    strsep(&p, ":");
-    /* Get controllers and base */
+    /* Get cgroup number, controllers and base */
+    hierarchy_id = strsep(&p, ":");
     controllers = strsep(&p, ":");
     base = strsep(&p, "\n");
 
@@ -422,6 +515,14 @@ void OSContainer::init() {
       continue;
     }
 
+    if (_is_cgroup_v2) {
+      if (strcmp(hierarchy_id, "0") == 0 && base != NULL) {
+        memory->set_subsystem_path(base);
+        cpu->set_subsystem_path(base);
+      }
+      continue;
+    }
+
     while ((token = strsep(&controllers, ",")) != NULL) {
       if (strcmp(token, "memory") == 0) {
         memory->set_subsystem_path(base);
@@ -454,7 +555,7 @@ void OSContainer::init() {
 
 const char * OSContainer::container_type() {
   if (is_containerized()) {
-    return "cgroupv1";
+    return _is_cgroup_v2 ? "cgroupv2" : "cgroupv1";
   } else {
     return NULL;
   }
@@ -470,6 +571,10 @@ const char * OSContainer::container_type() {
  *    OSCONTAINER_ERROR for not supported
  */
 jlong OSContainer::uses_mem_hierarchy() {
+  if (_is_cgroup_v2) {
+    // Accounting is always hierarchical with cgroup v2.
+    return (jlong)OSCONTAINER_ERROR;
+  }
   GET_CONTAINER_INFO(jlong, memory, "/memory.use_hierarchy",
                     "Use Hierarchy is: " JLONG_FORMAT, JLONG_FORMAT, use_hierarchy);
   return use_hierarchy;
@@ -496,6 +601,9 @@ jlong OSContainer::memory_limit_in_bytes() {
 }
 
 jlong OSContainer::read_memory_limit_in_bytes() {
+  if (_is_cgroup_v2) {
+    return read_limit_v2(memory, "/memory.max");
+  }
   GET_CONTAINER_INFO(julong, memory, "/memory.limit_in_bytes",
                      "Memory Limit is: " JULONG_FORMAT, JULONG_FORMAT, memlimit);
 
@@ -520,6 +628,19 @@ jlong OSContainer::read_memory_limit_in_bytes() {
 }
 
 jlong OSContainer::memory_and_swap_limit_in_bytes() {
+  if (_is_cgroup_v2) {
+    // cgroup v2 limits swap separately from memory.
+    jlong memory_limit = memory_limit_in_bytes();
+    if (memory_limit < 0) {
+      return memory_limit;
+    }
+    jlong swap_limit = read_limit_v2(memory, "/memory.swap.max");
+    if (swap_limit == OSCONTAINER_ERROR) {
+      // No swap accounting, so no swap.
+      return memory_limit;
+    }
+    return swap_limit < 0 ? swap_limit : memory_limit + swap_limit;
+  }
   GET_CONTAINER_INFO(julong, memory, "/memory.memsw.limit_in_bytes",
                      "Memory and Swap Limit is: " JULONG_FORMAT, JULONG_FORMAT, memswlimit);
   if (memswlimit >= _unlimited_memory) {
@@ -542,6 +663,9 @@ jlong OSContainer::memory_and_swap_limit_in_bytes() {
 }
 
 jlong OSContainer::memory_soft_limit_in_bytes() {
+  if (_is_cgroup_v2) {
+    return read_limit_v2(memory, "/memory.low");
+  }
   GET_CONTAINER_INFO(julong, memory, "/memory.soft_limit_in_bytes",
                      "Memory Soft Limit is: " JULONG_FORMAT, JULONG_FORMAT, memsoftlimit);
   if (memsoftlimit >= _unlimited_memory) {
@@ -562,7 +686,17 @@ jlong OSContainer::memory_soft_limit_in_bytes() {
  *    OSCONTAINER_ERROR for not supported
  */
 jlong OSContainer::memory_usage_in_bytes() {
-  GET_CONTAINER_INFO(jlong, memory, "/memory.usage_in_bytes",
+  if (!memory->usage_cache_has_expired()) {
+    return memory->memory_usage_in_bytes();
+  }
+  jlong memory_usage = read_memory_usage_in_bytes();
+  memory->set_memory_usage_in_bytes(memory_usage);
+  return memory_usage;
+}
+
+jlong OSContainer::read_memory_usage_in_bytes() {
+  const char* filename = _is_cgroup_v2 ? "/memory.current" : "/memory.usage_in_bytes";
+  GET_CONTAINER_INFO(jlong, memory, filename,
                      "Memory Usage is: " JLONG_FORMAT, JLONG_FORMAT, memusage);
   return memusage;
 }
@@ -576,7 +710,9 @@ jlong OSContainer::memory_usage_in_bytes() {
  *    OSCONTAINER_ERROR for not supported
  */
 jlong OSContainer::memory_max_usage_in_bytes() {
-  GET_CONTAINER_INFO(jlong, memory, "/memory.max_usage_in_bytes",
+  // memory.peak is only present with Linux 5.19 and later.
+  const char* filename = _is_cgroup_v2 ? "/memory.peak" : "/memory.max_usage_in_bytes";
+  GET_CONTAINER_INFO(jlong, memory, filename,
                      "Maximum Memory Usage is: " JLONG_FORMAT, JLONG_FORMAT, memmaxusage);
   return memmaxusage;
 }
@@ -678,13 +814,15 @@ int OSContainer::active_processor_count() {
 }
 
 char * OSContainer::cpu_cpuset_cpus() {
-  GET_CONTAINER_INFO_CPTR(cptr, cpuset, "/cpuset.cpus",
+  const char* filename = _is_cgroup_v2 ? "/cpuset.cpus.effective" : "/cpuset.cpus";
+  GET_CONTAINER_INFO_CPTR(cptr, cpuset, filename,
                      "cpuset.cpus is: %s", "%1023s", cpus, 1024);
   return os::strdup(cpus);
 }
 
 char * OSContainer::cpu_cpuset_memory_nodes() {
-  GET_CONTAINER_INFO_CPTR(cptr, cpuset, "/cpuset.mems",
+  const char* filename = _is_cgroup_v2 ? "/cpuset.mems.effective" : "/cpuset.mems";
+  GET_CONTAINER_INFO_CPTR(cptr, cpuset, filename,
                      "cpuset.mems is: %s", "%1023s", mems, 1024);
   return os::strdup(mems);
 }
@@ -700,14 +838,20 @@ char * OSContainer::cpu_cpuset_memory_nodes() {
  *    OSCONTAINER_ERROR for not supported
  */
 int OSContainer::cpu_quota() {
+  if (_is_cgroup_v2) {
+    // cpu.max holds "<quota> <period>", where quota may be "max".
+    return (int)read_limit_v2(cpu, "/cpu.max");
+  }
   GET_CONTAINER_INFO(int, cpu, "/cpu.cfs_quota_us",
                      "CPU Quota is: %d", "%d", quota);
   return quota;
 }
 
 int OSContainer::cpu_period() {
-  GET_CONTAINER_INFO(int, cpu, "/cpu.cfs_period_us",
-                     "CPU Period is: %d", "%d", period);
+  const char* filename = _is_cgroup_v2 ? "/cpu.max" : "/cpu.cfs_period_us";
+  const char* format = _is_cgroup_v2 ? "%*s %d" : "%d";
+  GET_CONTAINER_INFO(int, cpu, filename,
+                     "CPU Period is: %d", format, period);
   return period;
 }
 
@@ -722,6 +866,11 @@ int OSContainer::cpu_period() {
  *    OSCONTAINER_ERROR for not supported
  */
 int OSContainer::cpu_shares() {
+  if (_is_cgroup_v2) {
+    GET_CONTAINER_INFO(int, cpu, "/cpu.weight",
+                       "CPU Weight is: %d", "%d", weight);
+    return weight_to_shares(weight);
+  }
   GET_CONTAINER_INFO(int, cpu, "/cpu.shares",
                      "CPU Shares is: %d", "%d", shares);
   // Convert 1024 to no shares setup
@@ -730,3 +879,56 @@ int OSContainer::cpu_shares() {
   return shares;
 }
 
+/* pressure_stall_info
+ *
+ * Parse a pressure file, for example cpu.pressure:
+ *
+ * some avg10=0.52 avg60=0.31 avg300=0.08 total=1452316
+ * full avg10=0.00 avg60=0.00 avg300=0.00 total=0
+ */
+bool OSContainer::pressure_stall_info(const char* resource, PressureStallInfo* info) {
+  char file[MAXPATHLEN+1];
+  if (_is_containerized && _is_cgroup_v2) {
+    const char* path = memory->subsystem_path();
+    if (path == NULL) {
+      return false;
+    }
+    os::snprintf(file, sizeof(file), "%s/%s.pressure", path, resource);
+  } else {
+    os::snprintf(file, sizeof(file), "/proc/pressure/%s", resource);
+  }
+
+  FILE* fp = fopen(file, "r");
+  if (fp == NULL) {
+    log_trace(os, container)("Open of file %s failed, %s", file, os::strerror(errno));
+    return false;
+  }
+
+  info->full_avg10 = info->full_avg60 = info->full_avg300 = -1;
+  info->full_total = -1;
+  bool found_some = false;
+  char buf[256];
+  while (fgets(buf, sizeof(buf), fp) != NULL) {
+    double avg10, avg60, avg300;
+    jlong total;
+    char kind[8];
+    if (sscanf(buf, "%7s avg10=%lf avg60=%lf avg300=%lf total=" JLONG_FORMAT,
+               kind, &avg10, &avg60, &avg300, &total) != 5) {
+      continue;
+    }
+    if (strcmp(kind, "some") == 0) {
+      info->some_avg10 = avg10;
+      info->some_avg60 = avg60;
+      info->some_avg300 = avg300;
+      info->some_total = total;
+      found_some = true;
+    } else if (strcmp(kind, "full") == 0) {
+      info->full_avg10 = avg10;
+      info->full_avg60 = avg60;
+      info->full_avg300 = avg300;
+      info->full_total = total;
+    }
+  }
+  fclose(fp);
+  return found_some;
+}
@@ -31,17 +31,36 @@
 
 #define OSCONTAINER_ERROR (-2)
 
-// 20ms timeout between re-reads of memory limit and _active_processor_count.
-#define OSCONTAINER_CACHE_TIMEOUT (NANOSECS_PER_SEC/50)
+// Timeout between re-reads of the cached container metrics: the memory
+// limit, the memory usage and _active_processor_count.
+#define OSCONTAINER_CACHE_TIMEOUT ((jlong)ContainerMetricsRefreshMillis * NANOSECS_PER_MILLISEC)
+
+// Pressure stall information for one resource (cpu, memory or io). The
+// averages are the percentage of wall time that some or all non-idle tasks
+// were stalled on the resource over the last 10, 60 and 300 seconds. The
+// totals are the accumulated stall time in microseconds. The full_* values
+// are -1 when the kernel does not report them, as for cpu before Linux 5.13.
+struct PressureStallInfo {
+  double some_avg10;
+  double some_avg60;
+  double some_avg300;
+  jlong  some_total;
+  double full_avg10;
+  double full_avg60;
+  double full_avg300;
+  jlong  full_total;
+};
 
 class OSContainer: AllStatic {
 
  private:
   static bool   _is_initialized;
   static bool   _is_containerized;
+  static bool   _is_cgroup_v2;
   static int    _active_processor_count;
 
   static jlong read_memory_limit_in_bytes();
+  static jlong read_memory_usage_in_bytes();
 
  public:
   static void init();
@@ -65,6 +84,10 @@ class OSContainer: AllStatic {
 
   static int cpu_shares();
 
+  // Read pressure stall information for the given resource from the
+  // process's cgroup when running under cgroup v2, otherwise from
+  // /proc/pressure. Returns false if it is not available.
+  static bool pressure_stall_info(const char* resource, PressureStallInfo* info);
 };
 
 inline bool OSContainer::is_containerized() {
@@ -36,6 +36,7 @@
 #include "logging/logStream.hpp"
 #include "memory/allocation.inline.hpp"
 #include "memory/filemap.hpp"
+#include "memory/resourceArea.hpp"
 #include "oops/oop.inline.hpp"
 #include "os_linux.inline.hpp"
 #include "os_share_linux.hpp"
@@ -66,6 +67,7 @@
 #include "semaphore_posix.hpp"
 #include "services/attachListener.hpp"
 #include "services/memTracker.hpp"
+#include "services/virtualMemoryTracker.hpp"
 #include "services/runtimeService.hpp"
 #include "utilities/align.hpp"
 #include "utilities/decoder.hpp"
@@ -2440,6 +2442,20 @@ void os::Linux::print_container_info(outputStream* st) {
 
   j = OSContainer::OSContainer::memory_max_usage_in_bytes();
   st->print("memory_max_usage_in_bytes: " JLONG_FORMAT "\n", j);
+
+  static const char* const pressure_resources[] = { "cpu", "memory", "io" };
+  for (size_t k = 0; k < ARRAY_SIZE(pressure_resources); k++) {
+    PressureStallInfo psi;
+    if (OSContainer::pressure_stall_info(pressure_resources[k], &psi)) {
+      st->print("%s_pressure: some avg10=%.2f avg60=%.2f avg300=%.2f total=" JLONG_FORMAT,
+                pressure_resources[k], psi.some_avg10, psi.some_avg60, psi.some_avg300, psi.some_total);
+      if (psi.full_total >= 0) {
+        st->print(" full avg10=%.2f avg60=%.2f avg300=%.2f total=" JLONG_FORMAT,
+                  psi.full_avg10, psi.full_avg60, psi.full_avg300, psi.full_total);
+      }
+      st->cr();
+    }
+  }
   st->cr();
 }
 
@@ -2479,6 +2495,116 @@ void os::print_memory_info(outputStream* st) {
   st->print("(" UINT64_FORMAT "k free)",
             ((jlong)si.freeswap * si.mem_unit) >> 10);
   st->cr();
+
+  // Reading smaps allocates, so skip this while reporting a crash
+  if (!VMError::is_error_reported()) {
+    os::Linux::print_huge_page_usage_by_type(st);
+  }
+}
+
+// A mapping from /proc/self/smaps and how much of it is backed by
+// transparent huge pages.
+struct SmapsHugeMapping {
+  u8 start;
+  u8 end;
+  u8 huge_bytes;
+};
+
+// Reads the mappings of /proc/self/smaps, in address order, with their
+// AnonHugePages. Returns false if smaps cannot be read.
+static bool read_smaps_huge_mappings(GrowableArray<SmapsHugeMapping>* mappings) {
+  FILE* f = fopen("/proc/self/smaps", "r");
+  if (f == NULL) {
+    return false;
+  }
+  char line[PATH_MAX + 100];
+  while (fgets(line, sizeof(line), f) != NULL) {
+    u8 start, end;
+    size_t kb;
+    if (sscanf(line, UINT64_FORMAT_X "-" UINT64_FORMAT_X " ", &start, &end) == 2) {
+      SmapsHugeMapping m = { start, end, 0 };
+      mappings->append(m);
+    } else if (mappings->length() > 0 && sscanf(line, "AnonHugePages: " SIZE_FORMAT " kB", &kb) == 1) {
+      mappings->at(mappings->length() - 1).huge_bytes = (u8)kb * K;
+    }
+  }
+  fclose(f);
+  return true;
+}
+
+// The huge page backed bytes of m that fall into [low, high). A mapping
+// that only partly overlaps the range is counted pro rata.
+static u8 huge_bytes_in_range(const SmapsHugeMapping& m, u8 low, u8 high) {
+  const u8 lo = MAX2(m.start, low);
+  const u8 hi = MIN2(m.end, high);
+  if (hi <= lo || m.huge_bytes == 0) {
+    return 0;
+  }
+  return (u8)((double)m.huge_bytes * (hi - lo) / (m.end - m.start));
+}
+
+// Sums, per NMT memory type, the transparent huge page backed bytes of the
+// smaps mappings overlapping each reserved region.
+class HugePageUsageWalker : public VirtualMemoryWalker {
+  GrowableArray<SmapsHugeMapping>* _mappings;
+  u8 _huge_bytes[mt_number_of_types];
+
+ public:
+  HugePageUsageWalker(GrowableArray<SmapsHugeMapping>* mappings) : _mappings(mappings) {
+    for (int i = 0; i < mt_number_of_types; i++) {
+      _huge_bytes[i] = 0;
+    }
+  }
+
+  bool do_allocation_site(const ReservedMemoryRegion* rgn) {
+    const u8 low = (u8)(uintptr_t)rgn->base();
+    const u8 high = low + rgn->size();
+    // smaps lists mappings in address order; find the first that may overlap
+    int lo = 0;
+    int hi = _mappings->length();
+    while (lo < hi) {
+      int mid = (lo + hi) / 2;
+      if (_mappings->at(mid).end <= low) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+    for (int i = lo; i < _mappings->length() && _mappings->at(i).start < high; i++) {
+      _huge_bytes[NMTUtil::flag_to_index(rgn->flag())] += huge_bytes_in_range(_mappings->at(i), low, high);
+    }
+    return true;
+  }
+
+  u8 huge_bytes(int index) const { return _huge_bytes[index]; }
+};
+
+void os::Linux::print_huge_page_usage_by_type(outputStream* st) {
+  if (MemTracker::tracking_level() < NMT_summary) {
+    return;
+  }
+  ResourceMark rm;
+  GrowableArray<SmapsHugeMapping>* mappings = new GrowableArray<SmapsHugeMapping>(256);
+  if (!read_smaps_huge_mappings(mappings)) {
+    return;
+  }
+
+  HugePageUsageWalker walker(mappings);
+  VirtualMemoryTracker::walk_virtual_memory(&walker);
+
+  st->print("Transparent huge pages by memory type:");
+  bool any = false;
+  for (int i = 0; i < mt_number_of_types; i++) {
+    if (walker.huge_bytes(i) > 0) {
+      st->print(" %s " UINT64_FORMAT "k", NMTUtil::flag_to_name(NMTUtil::index_to_flag(i)),
+                walker.huge_bytes(i) >> 10);
+      any = true;
+    }
+  }
+  if (!any) {
+    st->print(" none");
+  }
+  st->cr();
 }
 
 // Print the first "model name" line and the first "flags" line
@@ -3080,6 +3206,61 @@ void os::pd_realign_memory(char *addr, size_t bytes, size_t alignment_hint) {
   }
 }
 
+// Advise transparent huge pages for a newly committed part of a CodeHeap
+// (see CodeCacheUseHugePages). Committing maps the range anew, which drops
+// earlier advice, so this is done for every commit.
+void linux_advise_huge_code(char* base, size_t size) {
+  if (!CodeCacheUseHugePages) {
+    return;
+  }
+  // The return value is ignored like in pd_realign_memory(): THP may be
+  // disabled, in which case the code stays on small pages.
+  ::madvise(base, size, MADV_HUGEPAGE);
+}
+
+// Advise transparent huge pages for [base, base + size), widened to page
+// boundaries. Used for the regions selected with MetaspaceUseHugePages and
+// GCDataUseHugePages; the caller checks the flag.
+void linux_advise_huge_pages(char* base, size_t size) {
+  char* const start = align_down(base, os::vm_page_size());
+  char* const end = align_up(base + size, os::vm_page_size());
+  ::madvise(start, end - start, MADV_HUGEPAGE);
+}
+
+// The size of a transparent huge page as reported by the kernel, or 2M if
+// it cannot be determined.
+size_t linux_transparent_huge_page_size() {
+  static size_t thp_size = 0;
+  if (thp_size == 0) {
+    size_t size = 2 * M;
+    FILE* f = fopen("/sys/kernel/mm/transparent_hugepage/hpage_pmd_size", "r");
+    if (f != NULL) {
+      size_t value;
+      if (fscanf(f, SIZE_FORMAT, &value) == 1 && is_power_of_2(value)) {
+        size = value;
+      }
+      fclose(f);
+    }
+    thp_size = size;
+  }
+  return thp_size;
+}
+
+jlong os::Linux::huge_page_backed_bytes(char* base, size_t size) {
+  ResourceMark rm;
+  GrowableArray<SmapsHugeMapping>* mappings = new GrowableArray<SmapsHugeMapping>(256);
+  if (!read_smaps_huge_mappings(mappings)) {
+    return -1;
+  }
+  const u8 low = (u8)(uintptr_t)base;
+  const u8 high = low + size;
+  u8 result = 0;
+  for (int i = 0; i < mappings->length(); i++) {
+    result += huge_bytes_in_range(mappings->at(i), low, high);
+  }
+  return (jlong)result;
+}
+
 void os::pd_free_memory(char *addr, size_t bytes, size_t alignment_hint) {
   // This method works by doing an mmap over an existing mmaping and effectively discarding
   // the existing pages. However it won't work for SHM-based large pages that cannot be
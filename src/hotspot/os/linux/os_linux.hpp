@@ -116,6 +116,7 @@ class Linux {
   static void print_proc_sys_info(outputStream* st);
   static void print_ld_preload_file(outputStream* st);
   static void print_uptime_info(outputStream* st);
+  static void print_huge_page_usage_by_type(outputStream* st);
 
  public:
   struct CPUPerfTicks {
@@ -132,6 +133,10 @@ class Linux {
   static void *dlopen_helper(const char *name, char *ebuf, int ebuflen);
   static void *dll_load_in_vmthread(const char *name, char *ebuf, int ebuflen);
 
+  // Number of bytes of [base, base + size) currently backed by transparent
+  // huge pages, or -1 if /proc/self/smaps cannot be read.
+  static jlong huge_page_backed_bytes(char* base, size_t size);
+
   static void init_thread_fpu_state();
   static int  get_fpu_control_word();
   static void set_fpu_control_word(int fpu_control);
@@ -44,10 +44,16 @@
 #include <sys/mman.h>
 #include <sys/resource.h>
 #include <sys/utsname.h>
+#include <sys/wait.h>
 #include <time.h>
 #include <unistd.h>
 #include <utmpx.h>
 
+#ifdef LINUX
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif
+
 // Todo: provide a os::get_max_process_id() or similar. Number of processes
 // may have been configured, can be read more accurately from proc fs etc.
 #ifndef MAX_PID
@@ -1022,6 +1028,36 @@ int os::get_signal_number(const char* signal_name) {
   return os::Posix::get_signal_number(signal_name);
 }
 
+int os::fork_snapshot_process(bool (*can_snapshot)()) {
+  // Fork twice, so that the snapshot process is reparented to init
+  // and never left as a zombie of the VM.
+  pid_t pid = ::fork();
+  if (pid < 0) {
+    return -1;
+  } else if (pid == 0) {
+    if (!can_snapshot()) {
+      ::_exit(1);
+    }
+    pid_t snapshot_pid = ::fork();
+    if (snapshot_pid == 0) {
+      return 0;
+    }
+    ::_exit(snapshot_pid < 0 ? 1 : 0);
+  }
+
+  int status;
+  while (::waitpid(pid, &status, 0) < 0) {
+    if (errno != EINTR) {
+      return -1;
+    }
+  }
+  return (WIFEXITED(status) && WEXITSTATUS(status) == 0) ? 1 : -1;
+}
+
+void os::exit_snapshot_process(int status) {
+  ::_exit(status);
+}
+
 // Returns true if signal number is valid.
 bool os::Posix::is_valid_signal(int sig) {
   // MacOS not really POSIX compliant: sigaddset does not return
@@ -1978,6 +2014,56 @@ static void to_abstime(timespec* abstime, jlong timeout, bool isAbsolute) {
   assert(abstime->tv_nsec < NANOUNITS, "tv_nsec >= NANOUNITS");
 }
 
+#ifdef LINUX
+
+// Futex support for PlatformEvent and Parker (-XX:+UseFutexPark).
+// futex_wait() only blocks while the futex word still holds the expected
+// value, so a wakeup from an unpark() that changed the word cannot be lost
+// and no mutex is needed around the state transitions. An unpark() only
+// enters the kernel if the target thread is actually blocked.
+
+// Blocks while *addr == val. The timeout is either NULL (wait forever), a
+// relative time, or an absolute time-of-day as produced by to_abstime().
+// Returns 0 when woken, or the errno: EAGAIN, EINTR or ETIMEDOUT.
+static int futex_wait(volatile int* addr, int val, const struct timespec* timeout, bool isAbsolute) {
+  int ret;
+  if (isAbsolute) {
+    ret = syscall(SYS_futex, addr, FUTEX_WAIT_BITSET | FUTEX_PRIVATE_FLAG | FUTEX_CLOCK_REALTIME,
+                  val, timeout, NULL, FUTEX_BITSET_MATCH_ANY);
+  } else {
+    ret = syscall(SYS_futex, addr, FUTEX_WAIT | FUTEX_PRIVATE_FLAG, val, timeout, NULL, 0);
+  }
+  if (ret == 0) {
+    return 0;
+  }
+  int err = errno;
+  assert_status(err == EAGAIN || err == EINTR || err == ETIMEDOUT, err, "futex_wait");
+  return err;
+}
+
+static void futex_wake(volatile int* addr) {
+  int ret = syscall(SYS_futex, addr, FUTEX_WAKE | FUTEX_PRIVATE_FLAG, 1, NULL, NULL, 0);
+  assert_status(ret >= 0, errno, "futex_wake");
+}
+
+// Convert the given relative timeout in nanoseconds to a timespec,
+// limited to MAX_SECS like the absolute times used with the condvars.
+static void to_reltime(timespec* reltime, jlong timeout) {
+  if (timeout < 0) {
+    timeout = 0;
+  }
+  jlong seconds = timeout / NANOUNITS;
+  if (seconds >= MAX_SECS) {
+    reltime->tv_sec = MAX_SECS;
+    reltime->tv_nsec = 0;
+  } else {
+    reltime->tv_sec = seconds;
+    reltime->tv_nsec = timeout % NANOUNITS;
+  }
+}
+
+#endif // LINUX
+
 // PlatformEvent
 //
 // Assumption:
@@ -2013,6 +2099,20 @@ void os::PlatformEvent::park() {       // AKA "down()"
   guarantee(v >= 0, "invariant");
 
   if (v == 0) { // Do this the hard way by blocking ...
+#ifdef LINUX
+    if (UseFutexPark) {
+      ++_nParked;
+      while (_event < 0) {
+        // Spurious wakeups are ignored
+        futex_wait(&_event, -1, NULL, false);
+      }
+      --_nParked;
+
+      _event = 0;
+      OrderAccess::fence();
+      return;
+    }
+#endif // LINUX
     int status = pthread_mutex_lock(_mutex);
     assert_status(status == 0, status, "mutex_lock");
     guarantee(_nParked == 0, "invariant");
@@ -2061,6 +2161,32 @@ int os::PlatformEvent::park(jlong millis) {
     if (millis / MILLIUNITS > MAX_SECS) {
       millis = jlong(MAX_SECS) * MILLIUNITS;
     }
+#ifdef LINUX
+    if (UseFutexPark) {
+      // The futex timeout is relative, so recompute it from the deadline
+      // after each wakeup
+      const jlong deadline = os::javaTimeNanos() + millis * (NANOUNITS / MILLIUNITS);
+      int ret = OS_TIMEOUT;
+      ++_nParked;
+      while (_event < 0) {
+        jlong remaining = deadline - os::javaTimeNanos();
+        if (remaining <= 0) break;
+        to_reltime(&abst, remaining);
+        int status = futex_wait(&_event, -1, &abst, false);
+        // See FilterSpuriousWakeups below
+        if (!FilterSpuriousWakeups) break;
+        if (status == ETIMEDOUT) break;
+      }
+      --_nParked;
+
+      if (_event >= 0) {
+        ret = OS_OK;
+      }
+      _event = 0;
+      OrderAccess::fence();
+      return ret;
+    }
+#endif // LINUX
     to_abstime(&abst, millis * (NANOUNITS / MILLIUNITS), false);
 
     int ret = OS_TIMEOUT;
@@ -2115,6 +2241,14 @@ void os::PlatformEvent::unpark() {
 
   if (Atomic::xchg(1, &_event) >= 0) return;
 
+#ifdef LINUX
+  if (UseFutexPark) {
+    // The owner is blocked, or about to block, on the futex
+    futex_wake(&_event);
+    return;
+  }
+#endif // LINUX
+
   int status = pthread_mutex_lock(_mutex);
   assert_status(status == 0, status, "mutex_lock");
   int anyWaiters = _nParked;
@@ -2179,6 +2313,12 @@ void Parker::park(bool isAbsolute, jlong time) {
     return;
   }
   if (time > 0) {
+#ifdef LINUX
+    if (UseFutexPark && !isAbsolute) {
+      // A relative futex timeout is measured against CLOCK_MONOTONIC
+      to_reltime(&absTime, time);
+    } else
+#endif // LINUX
     to_abstime(&absTime, time, isAbsolute);
   }
 
@@ -2190,6 +2330,38 @@ void Parker::park(bool isAbsolute, jlong time) {
   // the ThreadBlockInVM() CTOR and DTOR may grab Threads_lock.
   ThreadBlockInVM tbivm(jt);
 
+#ifdef LINUX
+  if (UseFutexPark) {
+    // _counter is -1 while the thread is parked, which tells unpark()
+    // that it has to wake the thread. Re-check interrupt before waiting.
+    if (Thread::is_interrupted(thread, false)) {
+      return;
+    }
+    if (Atomic::cmpxchg(-1, &_counter, 0) != 0) {
+      // A permit arrived, consume it
+      _counter = 0;
+      OrderAccess::fence();
+      return;
+    }
+
+    OSThreadWaitState osts(thread->osthread(), false /* not Object.wait() */);
+    jt->set_suspend_equivalent();
+    // cleared by handle_special_suspend_equivalent_condition() or java_suspend_self()
+
+    // Spurious returns are fine, see above
+    futex_wait(&_counter, -1, time == 0 ? NULL : &absTime, isAbsolute);
+
+    _counter = 0;
+    OrderAccess::fence();
+
+    // If externally suspended while waiting, re-suspend
+    if (jt->handle_special_suspend_equivalent_condition()) {
+      jt->java_suspend_self();
+    }
+    return;
+  }
+#endif // LINUX
+
   // Don't wait if cannot get lock since interference arises from
   // unparking. Also re-check interrupt before trying wait.
   if (Thread::is_interrupted(thread, false) ||
@@ -2241,6 +2413,16 @@ void Parker::park(bool isAbsolute, jlong time) {
 }
 
 void Parker::unpark() {
+#ifdef LINUX
+  if (UseFutexPark) {
+    if (Atomic::xchg(1, &_counter) < 0) {
+      // thread is definitely parked
+      futex_wake(&_counter);
+    }
+    return;
+  }
+#endif // LINUX
+
   int status = pthread_mutex_lock(_mutex);
   assert_status(status == 0, status, "invariant");
   const int s = _counter;
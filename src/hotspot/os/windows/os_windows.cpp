@@ -5459,6 +5459,15 @@ void Parker::unpark() {
   SetEvent(_ParkEvent);
 }
 
+// Not supported on Windows.
+int os::fork_snapshot_process(bool (*can_snapshot)()) {
+  return -1;
+}
+
+void os::exit_snapshot_process(int status) {
+  ShouldNotReachHere();
+}
+
 // Run the specified command in a separate process. Return its exit value,
 // or -1 on failure (e.g. can't create a new process).
 int os::fork_and_exec(char* cmd, bool use_vfork_if_available) {
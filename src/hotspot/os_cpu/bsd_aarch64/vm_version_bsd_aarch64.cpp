@@ -53,6 +53,8 @@ void VM_Version::get_os_cpu_info() {
   // https://opensource.apple.com/source/xnu/xnu-6153.141.1/bsd/kern/kern_mib.c.auto.html
   if (cpu_has("hw.optional.armv8_crc32"))     _features |= CPU_CRC32;
   if (cpu_has("hw.optional.armv8_1_atomics")) _features |= CPU_LSE;
+  if (cpu_has("hw.optional.armv8_2_sha3"))    _features |= CPU_SHA3;
+  if (cpu_has("hw.optional.armv8_2_sha512"))  _features |= CPU_SHA512;
 
   int cache_line_size;
   int hw_conf_cache_line[] = { CTL_HW, HW_CACHELINE };
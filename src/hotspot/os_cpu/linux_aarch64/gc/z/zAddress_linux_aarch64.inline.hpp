@@ -25,7 +25,13 @@
 #define OS_CPU_LINUX_AARCH64_ZADDRESS_LINUX_AARCH64_INLINE_HPP
 
 inline uintptr_t ZAddress::address(uintptr_t value) {
+#ifdef ZGC_TOP_BYTE_IGNORE
+  // The metadata bits live in the top byte, which is ignored by the
+  // hardware, so all views resolve to the single heap mapping.
+  return value | ZAddressSpaceStart;
+#else
   return value;
+#endif
 }
 
 #endif // OS_CPU_LINUX_AARCH64_ZADDRESS_LINUX_AARCH64_INLINE_HPP
@@ -23,12 +23,44 @@
 
 #include "precompiled.hpp"
 #include "gc/z/zArguments.hpp"
+#include "gc/z/zErrno.hpp"
+#include "logging/log.hpp"
 #include "runtime/globals.hpp"
 #include "runtime/globals_extension.hpp"
+#include "runtime/java.hpp"
 #include "utilities/debug.hpp"
 
+#ifdef ZGC_TOP_BYTE_IGNORE
+#include <sys/prctl.h>
+
+// Support for building on older Linux systems
+#ifndef PR_SET_TAGGED_ADDR_CTRL
+#define PR_SET_TAGGED_ADDR_CTRL              55
+#endif
+#ifndef PR_TAGGED_ADDR_ENABLE
+#define PR_TAGGED_ADDR_ENABLE                (1UL << 0)
+#endif
+#endif
+
 void ZArguments::initialize_platform() {
   // Disable class unloading - we don't support concurrent class unloading yet.
   FLAG_SET_DEFAULT(ClassUnloading, false);
   FLAG_SET_DEFAULT(ClassUnloadingWithConcurrentMark, false);
+
+#ifdef ZGC_TOP_BYTE_IGNORE
+  // Heap pointers carry metadata bits in the top byte, and must be accepted
+  // by the kernel when passed to system calls, e.g. from native code.
+  if (prctl(PR_SET_TAGGED_ADDR_CTRL, PR_TAGGED_ADDR_ENABLE, 0, 0, 0) == -1) {
+    ZErrno err;
+    log_error(gc)("Failed to enable tagged address ABI (%s)", err.to_string());
+    vm_exit_during_initialization("The Z Garbage Collector requires kernel support for the "
+                                  "tagged address ABI on this platform (Linux 5.4 or later)");
+  }
+
+  // There is only one heap view, so views can't be verified
+  if (ZVerifyViews) {
+    log_warning(gc)("ZVerifyViews is not supported with a single heap view, disabling");
+    FLAG_SET_DEFAULT(ZVerifyViews, false);
+  }
+#endif
 }
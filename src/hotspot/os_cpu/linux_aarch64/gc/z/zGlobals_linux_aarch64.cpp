@@ -25,9 +25,17 @@
 #include "gc/z/zGlobals.hpp"
 
 uintptr_t ZAddressReservedStart() {
+#ifdef ZGC_TOP_BYTE_IGNORE
+  return ZAddressMetadataMarked0 | ZAddressSpaceStart;
+#else
   return ZAddressMetadataMarked0;
+#endif
 }
 
 uintptr_t ZAddressReservedEnd() {
+#ifdef ZGC_TOP_BYTE_IGNORE
+  return ZAddressMetadataRemapped | ZAddressSpaceEnd;
+#else
   return ZAddressMetadataRemapped + ZAddressOffsetMax;
+#endif
 }
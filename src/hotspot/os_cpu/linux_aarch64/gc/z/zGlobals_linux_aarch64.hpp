@@ -35,6 +35,9 @@
 //  Large         X*M           > 4M                  2M
 //  ------------------------------------------------------------------
 //
+
+#ifndef ZGC_TOP_BYTE_IGNORE
+
 //
 // Address Space & Pointer Layout
 // ------------------------------
@@ -76,6 +79,8 @@
 
 const size_t    ZPlatformGranuleSizeShift      = 21; // 2M
 
+const size_t    ZPlatformAddressViews          = 3;
+
 const size_t    ZPlatformAddressOffsetBits     = 42; // 4TB
 
 const uintptr_t ZPlatformAddressMetadataShift  = ZPlatformAddressOffsetBits;
@@ -83,6 +88,61 @@ const uintptr_t ZPlatformAddressMetadataShift  = ZPlatformAddressOffsetBits;
 const uintptr_t ZPlatformAddressSpaceStart     = (uintptr_t)1 << ZPlatformAddressOffsetBits;
 const uintptr_t ZPlatformAddressSpaceSize      = ((uintptr_t)1 << ZPlatformAddressOffsetBits) * 4;
 
+#else // ZGC_TOP_BYTE_IGNORE
+
+//
+// Address Space & Pointer Layout (Top Byte Ignore)
+// ------------------------------------------------
+//
+// When built with ZGC_TOP_BYTE_IGNORE, the metadata bits are placed in the
+// top byte of the address, which is ignored by the hardware on memory access
+// (aarch64 TBI, enabled for user space by Linux). All heap views then alias
+// the same virtual address, so the heap is only mapped once, instead of once
+// per view. This requires the kernel to support the tagged address ABI
+// (Linux 5.4 or later), so that tagged pointers can be passed to system calls.
+//
+//  +--------------------------------+ 0x00007FFFFFFFFFFF (127TB)
+//  .                                .
+//  +--------------------------------+ 0x0000080000000000 (8TB)
+//  |           Heap View            |
+//  +--------------------------------+ 0x0000040000000000 (4TB)
+//  .                                .
+//  +--------------------------------+ 0x0000000000000000
+//
+//
+//   6  6    5 5                    4 4 4                                     0
+//   3  2    9 8                    3 2 1                                     0
+//  +-+----+----------------------+-+-----------------------------------------+
+//  |0|1111|000 00000000 00000000 |1|11 11111111 11111111 11111111 11111111 11|
+//  +-+----+----------------------+-+-----------------------------------------+
+//  | |    |                      | |
+//  | |    |                      | * 41-0 Object Offset (42-bits, 4TB address space)
+//  | |    |                      |
+//  | |    |                      * 42-42 Heap Base (1-bit, always one)
+//  | |    |
+//  | |    * 58-43 Unused (16-bits, always zero)
+//  | |
+//  | * 62-59 Metadata Bits (4-bits)  0001 = Marked0
+//  |                                 0010 = Marked1
+//  |                                 0100 = Remapped
+//  |                                 1000 = Finalizable
+//  |
+//  * 63-63 Fixed (1-bit, always zero)
+//
+
+const size_t    ZPlatformGranuleSizeShift      = 21; // 2M
+
+const size_t    ZPlatformAddressViews          = 1;
+
+const size_t    ZPlatformAddressOffsetBits     = 42; // 4TB
+
+const uintptr_t ZPlatformAddressMetadataShift  = 59;
+
+const uintptr_t ZPlatformAddressSpaceStart     = (uintptr_t)1 << ZPlatformAddressOffsetBits;
+const uintptr_t ZPlatformAddressSpaceSize      = (uintptr_t)1 << ZPlatformAddressOffsetBits;
+
+#endif // ZGC_TOP_BYTE_IGNORE
+
 const size_t    ZPlatformNMethodDisarmedOffset = 4;
 
 const size_t    ZPlatformCacheLineSize         = 64;
@@ -84,9 +84,9 @@ void ZPhysicalMemoryBacking::check_max_map_count(size_t max_capacity) const {
   // The required max map count is impossible to calculate exactly since subsystems
   // other than ZGC are also creating memory mappings, and we have no control over that.
   // However, ZGC tends to create the most mappings and dominate the total count.
-  // In the worst cases, ZGC will map each granule three times, i.e. once per heap view.
+  // In the worst cases, ZGC will map each granule once per heap view.
   // We speculate that we need another 20% to allow for non-ZGC subsystems to map memory.
-  const size_t required_max_map_count = (max_capacity / ZGranuleSize) * 3 * 1.2;
+  const size_t required_max_map_count = (max_capacity / ZGranuleSize) * ZPlatformAddressViews * 1.2;
   if (actual_max_map_count < required_max_map_count) {
     log_warning(gc, init)("***** WARNING! INCORRECT SYSTEM CONFIGURATION DETECTED! *****");
     log_warning(gc, init)("The system limit on number of memory mappings per process might be too low "
@@ -232,11 +232,20 @@ void ZPhysicalMemoryBacking::unmap_view(ZPhysicalMemory pmem, uintptr_t addr) co
 }
 
 uintptr_t ZPhysicalMemoryBacking::nmt_address(uintptr_t offset) const {
+#ifdef ZGC_TOP_BYTE_IGNORE
+  // From an NMT point of view we treat the single, untagged, heap mapping as committed
+  return ZAddressSpaceStart + offset;
+#else
   // From an NMT point of view we treat the first heap mapping (marked0) as committed
   return ZAddress::marked0(offset);
+#endif
 }
 
 void ZPhysicalMemoryBacking::map(ZPhysicalMemory pmem, uintptr_t offset) const {
+#ifdef ZGC_TOP_BYTE_IGNORE
+  // Map the single view shared by all colors
+  map_view(pmem, ZAddressSpaceStart + offset, AlwaysPreTouch);
+#else
   if (ZVerifyViews) {
     // Map good view
     map_view(pmem, ZAddress::good(offset), AlwaysPreTouch);
@@ -246,9 +255,14 @@ void ZPhysicalMemoryBacking::map(ZPhysicalMemory pmem, uintptr_t offset) const {
     map_view(pmem, ZAddress::marked1(offset), AlwaysPreTouch);
     map_view(pmem, ZAddress::remapped(offset), AlwaysPreTouch);
   }
+#endif
 }
 
 void ZPhysicalMemoryBacking::unmap(ZPhysicalMemory pmem, uintptr_t offset) const {
+#ifdef ZGC_TOP_BYTE_IGNORE
+  // Unmap the single view shared by all colors
+  unmap_view(pmem, ZAddressSpaceStart + offset);
+#else
   if (ZVerifyViews) {
     // Unmap good view
     unmap_view(pmem, ZAddress::good(offset));
@@ -258,6 +272,7 @@ void ZPhysicalMemoryBacking::unmap(ZPhysicalMemory pmem, uintptr_t offset) const
     unmap_view(pmem, ZAddress::marked1(offset));
     unmap_view(pmem, ZAddress::remapped(offset));
   }
+#endif
 }
 
 void ZPhysicalMemoryBacking::debug_map(ZPhysicalMemory pmem, uintptr_t offset) const {
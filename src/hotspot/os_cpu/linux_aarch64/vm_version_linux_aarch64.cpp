@@ -55,6 +55,14 @@
 #define HWCAP_ATOMICS (1<<8)
 #endif
 
+#ifndef HWCAP_SHA3
+#define HWCAP_SHA3    (1<<17)
+#endif
+
+#ifndef HWCAP_SHA512
+#define HWCAP_SHA512  (1<<21)
+#endif
+
 void VM_Version::get_os_cpu_info() {
 
   uint64_t auxv = getauxval(AT_HWCAP);
@@ -68,6 +76,8 @@ void VM_Version::get_os_cpu_info() {
   STATIC_ASSERT(CPU_SHA2    == HWCAP_SHA2);
   STATIC_ASSERT(CPU_CRC32   == HWCAP_CRC32);
   STATIC_ASSERT(CPU_LSE     == HWCAP_ATOMICS);
+  STATIC_ASSERT(CPU_SHA3    == HWCAP_SHA3);
+  STATIC_ASSERT(CPU_SHA512  == HWCAP_SHA512);
   _features = auxv & (
       HWCAP_FP      |
       HWCAP_ASIMD   |
@@ -77,7 +87,9 @@ void VM_Version::get_os_cpu_info() {
       HWCAP_SHA1    |
       HWCAP_SHA2    |
       HWCAP_CRC32   |
-      HWCAP_ATOMICS);
+      HWCAP_ATOMICS |
+      HWCAP_SHA3    |
+      HWCAP_SHA512);
 
   uint64_t ctr_el0;
   uint64_t dczid_el0;
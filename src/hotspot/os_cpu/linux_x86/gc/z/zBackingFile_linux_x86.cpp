@@ -53,6 +53,12 @@
 #ifndef __NR_memfd_create
 #define __NR_memfd_create                319
 #endif
+#ifndef FALLOC_FL_KEEP_SIZE
+#define FALLOC_FL_KEEP_SIZE              0x01
+#endif
+#ifndef FALLOC_FL_PUNCH_HOLE
+#define FALLOC_FL_PUNCH_HOLE             0x02
+#endif
 #ifndef MFD_CLOEXEC
 #define MFD_CLOEXEC                      0x0001U
 #endif
@@ -98,7 +104,8 @@ ZBackingFile::ZBackingFile() :
     _fd(-1),
     _filesystem(0),
     _available(0),
-    _initialized(false) {
+    _initialized(false),
+    _uncommit_supported(true) {
 
   // Create backing file
   _fd = create_fd(ZFILENAME_HEAP);
@@ -332,8 +339,9 @@ bool ZBackingFile::try_expand_hugetlbfs(size_t offset, size_t length) const {
   // Instead of posix_fallocate() we can use a well-known workaround,
   // which involves truncating the file to requested size and then try
   // to map it to verify that there are enough huge pages available to
-  // back it.
-  while (ftruncate(_fd, offset + length) == -1) {
+  // back it. When recommitting a previously uncommitted part of the
+  // file, the file must not be truncated, only mapped.
+  while (offset + length > size() && ftruncate(_fd, offset + length) == -1) {
     ZErrno err;
     if (err != EINTR) {
       log_error(gc)("Failed to truncate backing file (%s)", err.to_string());
@@ -397,6 +405,47 @@ bool ZBackingFile::try_expand_tmpfs_or_hugetlbfs(size_t offset, size_t length, s
   return is_hugetlbfs() ? try_expand_hugetlbfs(offset, length) : try_expand_tmpfs(offset, length);
 }
 
+size_t ZBackingFile::size() const {
+  struct stat st;
+  if (fstat(_fd, &st) == -1) {
+    ZErrno err;
+    log_error(gc)("Failed to get size of backing file (%s)", err.to_string());
+    return 0;
+  }
+
+  return st.st_size;
+}
+
+bool ZBackingFile::uncommit(size_t offset, size_t length) {
+  if (!_uncommit_supported) {
+    return false;
+  }
+
+  log_trace(gc, heap)("Uncommitting memory: " SIZE_FORMAT "M-" SIZE_FORMAT "M (" SIZE_FORMAT "M)",
+                      offset / M, (offset + length) / M, length / M);
+
+  // Punching a hole in the file releases the backing memory while keeping
+  // the file size intact. The range is recommitted before it is reused.
+  while (fallocate(_fd, FALLOC_FL_PUNCH_HOLE|FALLOC_FL_KEEP_SIZE, offset, length) == -1) {
+    ZErrno err;
+    if (err == EINTR) {
+      // Retry
+      continue;
+    }
+
+    if (err == EOPNOTSUPP) {
+      // Not supported by the filesystem, e.g. hugetlbfs prior to kernel 4.3
+      log_info(gc, heap)("Uncommit not supported by the backing filesystem, disabling uncommit");
+      _uncommit_supported = false;
+    } else {
+      log_error(gc)("Failed to uncommit memory (%s)", err.to_string());
+    }
+    return false;
+  }
+
+  return true;
+}
+
 size_t ZBackingFile::try_expand(size_t offset, size_t length, size_t alignment) const {
   size_t start = offset;
   size_t end = offset + length;
@@ -34,6 +34,7 @@ private:
   uint64_t _filesystem;
   size_t   _available;
   bool     _initialized;
+  bool     _uncommit_supported;
 
   int create_mem_fd(const char* name) const;
   int create_file_fd(const char* name) const;
@@ -49,6 +50,8 @@ private:
   bool try_expand_hugetlbfs(size_t offset, size_t length) const;
   bool try_expand_tmpfs_or_hugetlbfs(size_t offset, size_t length, size_t alignment) const;
 
+  size_t size() const;
+
 public:
   ZBackingFile();
 
@@ -58,6 +61,7 @@ public:
   size_t available() const;
 
   size_t try_expand(size_t offset, size_t length, size_t alignment) const;
+  bool uncommit(size_t offset, size_t length);
 };
 
 #endif // OS_CPU_LINUX_X86_ZBACKINGFILE_LINUX_X86_HPP
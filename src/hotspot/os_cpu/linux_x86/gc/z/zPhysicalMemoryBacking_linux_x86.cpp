@@ -50,7 +50,9 @@
 
 ZPhysicalMemoryBacking::ZPhysicalMemoryBacking(size_t max_capacity) :
     _manager(),
-    _file() {
+    _uncommitted(),
+    _file(),
+    _size(0) {
 
   if (!_file.is_initialized()) {
     return;
@@ -135,15 +137,68 @@ bool ZPhysicalMemoryBacking::is_initialized() const {
 size_t ZPhysicalMemoryBacking::try_expand(size_t old_capacity, size_t new_capacity) {
   assert(old_capacity < new_capacity, "Invalid old/new capacity");
 
-  const size_t capacity = _file.try_expand(old_capacity, new_capacity - old_capacity, ZGranuleSize);
-  if (capacity > old_capacity) {
-    // Add expanded capacity to free list
-    _manager.free(old_capacity, capacity - old_capacity);
+  size_t capacity = old_capacity;
+
+  // Recommit previously uncommitted parts of the backing file first
+  while (capacity < new_capacity) {
+    const uintptr_t start = _uncommitted.alloc_from_front(ZGranuleSize);
+    if (start == UINTPTR_MAX) {
+      // Nothing left to recommit
+      break;
+    }
+
+    if (_file.try_expand(start, ZGranuleSize, ZGranuleSize) != start + ZGranuleSize) {
+      // Failed to recommit
+      _uncommitted.free(start, ZGranuleSize);
+      return capacity;
+    }
+
+    // Add recommitted capacity to free list
+    _manager.free(start, ZGranuleSize);
+    capacity += ZGranuleSize;
+  }
+
+  if (capacity < new_capacity) {
+    // Expand the backing file
+    const size_t size = _file.try_expand(_size, new_capacity - capacity, ZGranuleSize);
+    if (size > _size) {
+      // Add expanded capacity to free list
+      _manager.free(_size, size - _size);
+      capacity += size - _size;
+      _size = size;
+    }
   }
 
   return capacity;
 }
 
+size_t ZPhysicalMemoryBacking::uncommit(size_t size) {
+  assert(is_aligned(size, ZGranuleSize), "Invalid size");
+
+  size_t uncommitted = 0;
+
+  // Uncommit from the back of the backing file, since subsequent
+  // allocations are satisfied from the front of the free list.
+  while (uncommitted < size) {
+    const uintptr_t start = _manager.alloc_from_back(ZGranuleSize);
+    if (start == UINTPTR_MAX) {
+      // No more unused memory
+      break;
+    }
+
+    if (!_file.uncommit(start, ZGranuleSize)) {
+      // Failed to uncommit, return memory to free list
+      _manager.free(start, ZGranuleSize);
+      break;
+    }
+
+    _uncommitted.free(start, ZGranuleSize);
+    uncommitted += ZGranuleSize;
+  }
+
+  return uncommitted;
+}
+
 ZPhysicalMemory ZPhysicalMemoryBacking::alloc(size_t size) {
   assert(is_aligned(size, ZGranuleSize), "Invalid size");
 
@@ -33,7 +33,9 @@ class ZPhysicalMemory;
 class ZPhysicalMemoryBacking {
 private:
   ZMemoryManager _manager;
+  ZMemoryManager _uncommitted;
   ZBackingFile   _file;
+  size_t         _size;
 
   void check_max_map_count(size_t max_capacity) const;
   void check_available_space_on_filesystem(size_t max_capacity) const;
@@ -50,6 +52,7 @@ public:
   bool is_initialized() const;
 
   size_t try_expand(size_t old_capacity, size_t new_capacity);
+  size_t uncommit(size_t size);
 
   ZPhysicalMemory alloc(size_t size);
   void free(ZPhysicalMemory pmem);
@@ -4163,7 +4163,8 @@ bool MatchRule::is_vector() const {
     "AddVB","AddVS","AddVI","AddVL","AddVF","AddVD",
     "SubVB","SubVS","SubVI","SubVL","SubVF","SubVD",
     "MulVB","MulVS","MulVI","MulVL","MulVF","MulVD",
-    "CMoveVD", "CMoveVF",
+    "CMoveVD", "CMoveVF", "CMoveVI",
+    "BlendV", "ShuffleVB", "CmpEqMaskV",
     "DivVF","DivVD",
     "AbsVB","AbsVS","AbsVI","AbsVL","AbsVF","AbsVD",
     "NegVF","NegVD",
@@ -696,6 +696,7 @@ void AOTCodeHeap::sweep_dependent_methods(int* indexes, int methods_cnt) {
         AOTCompiledMethod* aot = _code_to_aot[code_id]._aot;
         assert(aot != NULL, "aot should be set");
         if (!aot->is_runtime_stub()) { // Something is wrong - should not invalidate stubs.
+          aot->set_invalidated_by_dependency();
           aot->mark_for_deoptimization(false);
           marked++;
         }
@@ -831,6 +832,62 @@ bool AOTCodeHeap::load_klass_data(InstanceKlass* ik, Thread* thread) {
   return true;
 }
 
+void AOTCodeHeap::print_usage(outputStream* st, bool verbose) {
+  int not_loaded = 0;
+  int invalid = 0;
+  int active = 0;
+  int replaced = 0;
+  int replacements = 0;
+  int dependency = 0;
+  int deopt = 0;
+  int never_invoked = 0;
+  for (int index = 0; index < _method_count; index++) {
+    CodeState state = _code_to_aot[index]._state;
+    if (state == not_set) {
+      not_loaded++;
+      continue;
+    }
+    AOTCompiledMethod* aot = _code_to_aot[index]._aot;
+    if (aot == NULL) {
+      // Invalidated before it was published
+      invalid++;
+      continue;
+    }
+    if (aot->is_runtime_stub()) {
+      continue;
+    }
+    Method* m = aot->method();
+    int invocations = m->invocation_count();
+    if (invocations == 0) {
+      never_invoked++;
+    }
+    replacements += aot->replaced_count();
+    if (aot->replaced_count() > 0) {
+      replaced++;
+    }
+    if (aot->invalidation_reason() == AOTCompiledMethod::invalidated_by_dependency) {
+      dependency++;
+    } else if (aot->invalidation_reason() == AOTCompiledMethod::invalidated_by_deopt) {
+      deopt++;
+    } else if (aot->is_in_use()) {
+      active++;
+    }
+    if (verbose) {
+      const char* state_name = aot->is_in_use() ? "in_use" :
+                               (aot->state() == CompiledMethod::not_used ? "not_used" : "not_entrant");
+      st->print_cr("  %5d %-11s invocations=%-10d replaced=%-3d invalidated=%-10s %s",
+                   aot->compile_id(), state_name, invocations, aot->replaced_count(),
+                   AOTCompiledMethod::invalidation_reason_name(aot->invalidation_reason()),
+                   m->name_and_sig_as_C_string());
+    }
+  }
+  st->print_cr("%4d %s: %d methods, %d not loaded, %d invalid before use", dso_id(), _lib->name(),
+               _method_count, not_loaded, invalid);
+  st->print_cr("     active: %d, never invoked: %d, replaced by JIT: %d (%d times), "
+               "invalidated by dependency: %d, deoptimized: %d",
+               active, never_invoked, replaced, replacements, dependency, deopt);
+}
+
 AOTCompiledMethod* AOTCodeHeap::next_in_use_at(int start) const {
   for (int index = start; index < _method_count; index++) {
     if (_code_to_aot[index]._state != in_use) {
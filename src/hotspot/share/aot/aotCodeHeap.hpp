@@ -285,6 +285,9 @@ public:
 
   void alive_methods_do(void f(CompiledMethod* nm));
 
+  // Per method state, invalidation and invocation statistics
+  void print_usage(outputStream* st, bool verbose);
+
 #ifndef PRODUCT
   static int klasses_seen;
   static int aot_klasses_found;
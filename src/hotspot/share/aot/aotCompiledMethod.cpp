@@ -155,6 +155,15 @@ Metadata* AOTCompiledMethod::metadata_at(int index) const {
   ShouldNotReachHere(); return NULL;
 }
 
+const char* AOTCompiledMethod::invalidation_reason_name(int reason) {
+  switch (reason) {
+    case not_invalidated:           return "none";
+    case invalidated_by_dependency: return "dependency";
+    case invalidated_by_deopt:      return "deopt";
+    default:                        return "unknown";
+  }
+}
+
 bool AOTCompiledMethod::make_not_entrant_helper(int new_state) {
   // Make sure the method is not flushed in case of a safepoint in code below.
   methodHandle the_method(method());
@@ -174,6 +183,12 @@ bool AOTCompiledMethod::make_not_entrant_helper(int new_state) {
     OrderAccess::storestore();
     *_state_adr = new_state;
 
+    if (new_state == not_used) {
+      _replaced_count++;
+    } else if (new_state == not_entrant && _invalidation_reason == not_invalidated) {
+      _invalidation_reason = invalidated_by_deopt;
+    }
+
     // Log the transition once
     log_state_change();
 
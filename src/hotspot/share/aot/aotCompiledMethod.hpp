@@ -104,6 +104,14 @@ public:
 };
 
 class AOTCompiledMethod : public CompiledMethod, public CHeapObj<mtCode> {
+public:
+  // Why the AOT code was made not entrant for good (see Compiler.aot_methods)
+  enum InvalidationReason {
+    not_invalidated = 0,
+    invalidated_by_dependency,  // class hierarchy change or redefinition
+    invalidated_by_deopt        // deoptimization of the AOT code itself
+  };
+
 private:
   address       _code;
   aot_metadata* _meta;
@@ -116,6 +124,8 @@ private:
   const int _aot_id;
   const int _method_index;
   oop _oop;  // method()->method_holder()->klass_holder()
+  int _replaced_count;       // transitions to not_used, i.e. replaced by JIT code
+  int _invalidation_reason;
 
   address* orig_pc_addr(const frame* fr);
   bool make_not_entrant_helper(int new_state);
@@ -127,6 +137,11 @@ private:
   int method_index() const { return _method_index; }
   void set_oop(oop o) { _oop = o; }
 
+  int replaced_count() const { return _replaced_count; }
+  int invalidation_reason() const { return _invalidation_reason; }
+  void set_invalidated_by_dependency() { _invalidation_reason = invalidated_by_dependency; }
+  static const char* invalidation_reason_name(int reason);
+
   AOTCompiledMethod(address code, Method* method, aot_metadata* meta, address metadata_got, int metadata_size, jlong* state_adr, AOTCodeHeap* heap, const char* name, int method_index, int aot_id) :
     CompiledMethod(method, name, compiler_jvmci, // AOT code is generated by JVMCI compiler
         AOTCompiledMethodLayout(code, code + meta->code_size(), (address) meta->relocation_begin(), (address) meta->relocation_end()),
@@ -139,7 +154,9 @@ private:
     _name(name),
     _metadata_size(metadata_size),
     _method_index(method_index),
-    _aot_id(aot_id) {
+    _aot_id(aot_id),
+    _replaced_count(0),
+    _invalidation_reason(not_invalidated) {
 
     _is_far_code = CodeCache::is_far_target(code) ||
                    CodeCache::is_far_target(code + meta->code_size());
@@ -30,6 +30,7 @@
 #include "memory/allocation.inline.hpp"
 #include "oops/method.hpp"
 #include "runtime/handles.inline.hpp"
+#include "runtime/mutexLocker.hpp"
 #include "runtime/os.hpp"
 #include "runtime/timerTrace.hpp"
 
@@ -86,6 +87,18 @@ void AOTLoader::metadata_do(void f(Metadata*)) {
   }
 }
 
+void AOTLoader::print_usage(outputStream* st, bool verbose) {
+  if (!UseAOT) {
+    st->print_cr("AOT is not enabled");
+    return;
+  }
+  MutexLockerEx mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
+  st->print_cr("AOT libraries loaded: %d", heaps_count());
+  FOR_ALL_AOT_HEAPS(heap) {
+    (*heap)->print_usage(st, verbose);
+  }
+}
+
 /**
  * List of core modules for which we search for shared libraries.
  */
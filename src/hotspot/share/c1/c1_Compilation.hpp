@@ -221,6 +221,11 @@ class Compilation: public StackObj {
   void exclude_this_method();
 #endif // PRODUCT
 
+  // Huge compilations get a cheaper register allocation
+  bool use_fast_linear_scan() const {
+    return method()->code_size() + env()->num_inlined_bytecodes() > C1FastLinearScanLimit;
+  }
+
   bool is_profiling() {
     return env()->comp_level() == CompLevel_full_profile ||
            env()->comp_level() == CompLevel_limited_profile;
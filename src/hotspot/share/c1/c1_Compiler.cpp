@@ -133,6 +133,13 @@ bool Compiler::is_intrinsic_supported(const methodHandle& method) {
   case vmIntrinsics::_onSpinWait:
     if (!VM_Version::supports_on_spin_wait()) return false;
     break;
+#ifdef X86
+  case vmIntrinsics::_equalsL:
+  case vmIntrinsics::_equalsU:
+    // Lowered to a call of the vectorizedMismatch stub.
+    if (!UseVectorizedMismatchIntrinsic) return false;
+    break;
+#endif
   case vmIntrinsics::_arraycopy:
   case vmIntrinsics::_currentTimeMillis:
   case vmIntrinsics::_nanoTime:
@@ -2025,6 +2025,36 @@ void GraphBuilder::invoke(Bytecodes::Code code) {
     code = Bytecodes::_invokespecial;
   }
 
+  // Profiling code can inline a call whose profile saw a single receiver
+  // class. The exact class check deoptimizes on a miss and records a
+  // class_check trap at the call, which stays virtual when we recompile.
+  if (C1InlineProfiledReceiver && DeoptC1 && compilation()->is_profiling() &&
+      (code == Bytecodes::_invokevirtual || code == Bytecodes::_invokeinterface) &&
+      cha_monomorphic_target == NULL && exact_target == NULL && better_receiver == NULL &&
+      will_link && !patch_for_appendix && method()->method_data_or_null() != NULL &&
+      method()->method_data_or_null()->has_trap_at(bci(), method(), Deoptimization::Reason_class_check) == 0) {
+    ciCallProfile profile = method()->call_profile_at_bci(bci());
+    if (profile.morphism() == 1 && profile.receiver(0)->is_instance_klass()) {
+      ciInstanceKlass* receiver_klass = profile.receiver(0)->as_instance_klass();
+      ciMethod* profiled_target = NULL;
+      if (receiver_klass->is_initialized() && !receiver_klass->is_interface() &&
+          receiver_klass->is_subtype_of(callee_holder)) {
+        profiled_target = target->resolve_invoke(calling_klass, receiver_klass);
+      }
+      if (profiled_target != NULL && profiled_target->is_loaded() && !profiled_target->is_abstract() &&
+          profiled_target->code_size_for_inlining() <= max_inline_size()) {
+        int index = state()->stack_size() - (target->arg_size_no_receiver() + 1);
+        CheckCast* c = new CheckCast(receiver_klass, state()->stack_at(index), copy_state_before());
+        c->set_profiled_receiver_check();
+        c->set_direct_compare(true);
+        better_receiver = append_split(c);
+        target = exact_target = profiled_target;
+        klass = profiled_target->holder();
+        code = Bytecodes::_invokespecial;
+      }
+    }
+  }
+
   // check if we could do inlining
   if (!PatchALot && Inline && target->is_loaded() &&
       (klass->is_initialized() || (klass->is_interface() && target->holder()->is_initialized()))
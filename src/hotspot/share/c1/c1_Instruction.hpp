@@ -371,6 +371,7 @@ class Instruction: public CompilationResourceObj {
     NeedsPatchingFlag,
     ThrowIncompatibleClassChangeErrorFlag,
     InvokeSpecialReceiverCheckFlag,
+    ProfiledReceiverCheckFlag,
     ProfileMDOFlag,
     IsLinkedInBlockFlag,
     NeedsRangeCheckFlag,
@@ -1460,6 +1461,18 @@ LEAF(CheckCast, TypeCheck)
   bool is_invokespecial_receiver_check() const {
     return check_flag(InvokeSpecialReceiverCheckFlag);
   }
+  // Guard of a call inlined for the receiver class seen by the profile: a
+  // miss deoptimizes and invalidates the code so that it is recompiled.
+  void set_profiled_receiver_check() {
+    set_flag(InvokeSpecialReceiverCheckFlag, true);
+    set_flag(ProfiledReceiverCheckFlag, true);
+  }
+  bool is_profiled_receiver_check() const {
+    return check_flag(ProfiledReceiverCheckFlag);
+  }
+  Deoptimization::DeoptAction receiver_check_deopt_action() const {
+    return is_profiled_receiver_check() ? Deoptimization::Action_make_not_entrant : Deoptimization::Action_none;
+  }
 
   virtual bool needs_exception_state() const {
     return !is_invokespecial_receiver_check();
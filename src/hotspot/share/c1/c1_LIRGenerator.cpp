@@ -3109,6 +3109,11 @@ void LIRGenerator::do_Intrinsic(Intrinsic* x) {
     do_vectorizedMismatch(x);
     break;
 
+  case vmIntrinsics::_equalsL:
+  case vmIntrinsics::_equalsU:
+    do_string_equals(x);
+    break;
+
   default: ShouldNotReachHere(); break;
   }
 }
@@ -83,6 +83,7 @@ LinearScan::LinearScan(IR* ir, LIRGenerator* gen, FrameMap* frame_map)
  , _new_intervals_from_allocation(NULL)
  , _sorted_intervals(NULL)
  , _needs_full_resort(false)
+ , _fast_mode(ir->compilation()->use_fast_linear_scan())
  , _lir_ops(0)     // initialized later with correct length
  , _block_of_op(0) // initialized later with correct length
  , _has_info(0)
@@ -346,6 +347,12 @@ void LinearScan::change_spill_definition_pos(Interval* interval, int def_pos) {
 void LinearScan::change_spill_state(Interval* interval, int spill_pos) {
   switch (interval->spill_state()) {
     case oneDefinitionFound: {
+      if (_fast_mode) {
+        // store once at the definition, so that moves to the stack slot
+        // inserted for later splits are eliminated
+        interval->set_spill_state(storeAtDefinition);
+        break;
+      }
       int def_loop_depth = block_of_op_with_id(interval->spill_definition_pos())->loop_depth();
       int spill_loop_depth = block_of_op_with_id(spill_pos)->loop_depth();
 
@@ -5085,6 +5092,12 @@ int LinearScanWalker::find_optimal_split_pos(Interval* it, int min_split_pos, in
     TRACE_LINEAR_SCAN(4, tty->print_cr("      min-pos and max-pos are equal, no optimization possible"));
     optimal_split_pos = min_split_pos;
 
+  } else if (allocator()->_fast_mode) {
+    // huge method: searching the blocks between min- and max-position for
+    // the best boundary is too expensive, so split as late as possible
+    TRACE_LINEAR_SCAN(4, tty->print_cr("      fast mode, no optimization of split position"));
+    optimal_split_pos = max_split_pos;
+
   } else {
     assert(min_split_pos < max_split_pos, "must be true then");
     assert(min_split_pos > 0, "cannot access min_split_pos - 1 otherwise");
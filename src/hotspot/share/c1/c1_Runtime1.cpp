@@ -43,6 +43,7 @@
 #include "gc/shared/collectedHeap.hpp"
 #include "interpreter/bytecode.hpp"
 #include "interpreter/interpreter.hpp"
+#include "jfr/jfrEvents.hpp"
 #include "jfr/support/jfrIntrinsics.hpp"
 #include "logging/log.hpp"
 #include "memory/allocation.inline.hpp"
@@ -558,10 +559,13 @@ JRT_ENTRY_NO_ASYNC(static address, exception_handler_for_pc_helper(JavaThread* t
     return SharedRuntime::deopt_blob()->unpack_with_exception_in_tls();
   }
 
+  EventCompiledExceptionDispatch event;
+
   // ExceptionCache is used only for exceptions at call sites and not for implicit exceptions
   if (guard_pages_enabled) {
     address fast_continuation = nm->handler_for_exception_and_pc(exception, pc);
     if (fast_continuation != NULL) {
+      SharedRuntime::post_exception_dispatch_event(event, nm, pc, exception, true);
       // Set flag if return address is a method handle call site.
       thread->set_is_method_handle_return(nm->is_method_handle_return(pc));
       return fast_continuation;
@@ -597,6 +601,7 @@ JRT_ENTRY_NO_ASYNC(static address, exception_handler_for_pc_helper(JavaThread* t
     if (continuation != NULL && !recursive_exception) {
       nm->add_handler_for_exception_and_pc(exception, pc, continuation);
     }
+    SharedRuntime::post_exception_dispatch_event(event, nm, pc, exception, false);
   }
 
   thread->set_vm_result(exception());
@@ -732,6 +737,16 @@ JRT_ENTRY(void, Runtime1::deoptimize(JavaThread* thread, jint trap_request))
         if (trap_mdo != NULL) {
           trap_mdo->inc_tenure_traps();
         }
+      } else if (reason == Deoptimization::Reason_class_check) {
+        // A profiled receiver guard failed. Record the trap at the call so
+        // that the recompiled code leaves it virtual.
+        ResourceMark rm(thread);
+        ScopeDesc* sd = nm->scope_desc_at(caller_frame.pc());
+        methodHandle trap_method(thread, sd->method());
+        MethodData* trap_mdo = Deoptimization::get_method_data(thread, trap_method, true /*create_if_missing*/);
+        if (trap_mdo != NULL) {
+          Deoptimization::update_method_data_from_interpreter(trap_mdo, sd->bci(), reason);
+        }
       }
     }
   }
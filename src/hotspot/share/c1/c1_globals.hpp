@@ -218,6 +218,12 @@
   develop(bool, CountLinearScan, false,                                     \
           "collect statistic counters during LinearScan")                   \
                                                                             \
+  product(intx, C1FastLinearScanLimit, 6000,                                \
+          "Bytecode size of a compilation, inlined methods included, "      \
+          "above which LinearScan uses cheaper split and spill "            \
+          "heuristics to reduce compile time")                              \
+          range(0, max_jint)                                                \
+                                                                            \
   /* C1 variable */                                                         \
                                                                             \
   develop(bool, C1Breakpoint, false,                                        \
@@ -309,6 +315,11 @@
   product(bool, C1ProfileInlinedCalls, true,                                \
           "Profile inlined calls when generating code for updating MDOs")   \
                                                                             \
+  product(bool, C1InlineProfiledReceiver, false,                            \
+          "Inline virtual and interface calls of profiling code whose "     \
+          "profile saw a single receiver class, guarded by an exact "       \
+          "class check that deoptimizes on a miss")                         \
+                                                                            \
   product(bool, C1ProfileBranches, true,                                    \
           "Profile branches when generating code for updating MDOs")        \
                                                                             \
@@ -1059,9 +1059,12 @@ void ciEnv::register_method(ciMethod* target,
       }
 
       if (entry_bci == InvocationEntryBci) {
-        if (TieredCompilation) {
-          // If there is an old version we're done with it
-          CompiledMethod* old = method->code();
+        // If there is an old version we're done with it. Code compiled
+        // with reduced optimization is replaced by the full compilation
+        // without tiered compilation too.
+        CompiledMethod* old = method->code();
+        if (TieredCompilation ||
+            (old != NULL && old->is_nmethod() && old->as_nmethod()->is_reduced_optimization())) {
           if (TraceMethodReplacement && old != NULL) {
             ResourceMark rm;
             char *method_name = method->name_and_sig_as_C_string();
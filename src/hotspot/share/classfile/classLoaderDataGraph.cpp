@@ -607,6 +607,16 @@ void ClassLoaderDataGraph::purge() {
   DependencyContext::purge_dependency_contexts();
 }
 
+bool ClassLoaderDataGraph::has_safepoint_cleanup_work() {
+  bool needed = _should_purge ||
+                _safepoint_cleanup_needed ||
+                Dictionary::does_any_dictionary_needs_resizing();
+#if INCLUDE_JVMTI
+  needed = needed || InstanceKlass::has_previous_versions();
+#endif
+  return needed;
+}
+
 int ClassLoaderDataGraph::resize_if_needed() {
   assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint!");
   int resized = 0;
@@ -132,6 +132,9 @@ class ClassLoaderDataGraph : public AllStatic {
 
   static int resize_if_needed();
 
+  // Is there anything to purge, clean or resize in the next safepoint cleanup?
+  static bool has_safepoint_cleanup_work();
+
   static bool has_metaspace_oom()           { return _metaspace_oom; }
   static void set_metaspace_oom(bool value) { _metaspace_oom = value; }
 
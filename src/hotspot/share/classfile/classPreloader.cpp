@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "classfile/classPreloader.hpp"
+#include "classfile/javaClasses.hpp"
+#include "classfile/symbolTable.hpp"
+#include "classfile/systemDictionary.hpp"
+#include "classfile/vmSymbols.hpp"
+#include "logging/log.hpp"
+#include "memory/universe.hpp"
+#include "oops/instanceKlass.hpp"
+#include "oops/symbol.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/handles.inline.hpp"
+#include "runtime/javaCalls.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "runtime/os.hpp"
+#include "runtime/thread.hpp"
+
+GrowableArray<Symbol*>* ClassPreloader::_classes = NULL;
+volatile int ClassPreloader::_claimed = 0;
+volatile int ClassPreloader::_loaded = 0;
+volatile int ClassPreloader::_running = 0;
+
+bool ClassPreloader::read_class_list(const char* path, TRAPS) {
+  FILE* stream = fopen(path, "rt");
+  if (stream == NULL) {
+    warning("Cannot open class list %s", path);
+    return false;
+  }
+
+  _classes = new (ResourceObj::C_HEAP, mtClass) GrowableArray<Symbol*>(1024, true, mtClass);
+  char line[1024];
+  char name[1024];
+  while (fgets(line, sizeof(line), stream) != NULL) {
+    if (line[0] == '#' || line[0] == '@' || sscanf(line, "%1023s", name) != 1) {
+      continue;
+    }
+    Symbol* sym = SymbolTable::new_permanent_symbol(name, THREAD);
+    if (HAS_PENDING_EXCEPTION) {
+      CLEAR_PENDING_EXCEPTION;
+      break;
+    }
+    _classes->append(sym);
+  }
+  fclose(stream);
+  return _classes->length() > 0;
+}
+
+void ClassPreloader::preload_thread_entry(JavaThread* thread, TRAPS) {
+  Handle loader(THREAD, SystemDictionary::java_system_loader());
+  int loaded = 0;
+  for (;;) {
+    int index = Atomic::add(1, &_claimed) - 1;
+    if (index >= _classes->length()) {
+      break;
+    }
+    HandleMark hm(THREAD);
+    Klass* k = SystemDictionary::resolve_or_null(_classes->at(index), loader, Handle(), THREAD);
+    if (!HAS_PENDING_EXCEPTION && k != NULL && k->is_instance_klass()) {
+      InstanceKlass::cast(k)->link_class(THREAD);
+    }
+    if (HAS_PENDING_EXCEPTION) {
+      // The thread that needs the class gets the error
+      CLEAR_PENDING_EXCEPTION;
+    } else if (k != NULL) {
+      loaded++;
+    }
+  }
+
+  thread_done(loaded);
+}
+
+void ClassPreloader::thread_done(int loaded) {
+  Atomic::add(loaded, &_loaded);
+  if (Atomic::sub(1, &_running) == 0) {
+    log_info(class, load)("Preloaded %d of %d classes from %s",
+                          _loaded, _classes->length(), PreloadClassList);
+  }
+}
+
+bool ClassPreloader::start_thread(int id, TRAPS) {
+  char name[64];
+  jio_snprintf(name, sizeof(name), "Class Preloader #%d", id);
+  Handle string = java_lang_String::create_from_str(name, CHECK_false);
+
+  // Initialize thread_oop to put it into the system threadGroup
+  Handle thread_group(THREAD, Universe::system_thread_group());
+  Handle thread_oop = JavaCalls::construct_new_instance(SystemDictionary::Thread_klass(),
+                       vmSymbols::threadgroup_string_void_signature(),
+                       thread_group,
+                       string,
+                       CHECK_false);
+
+  Klass* group = SystemDictionary::ThreadGroup_klass();
+  JavaValue result(T_VOID);
+  JavaCalls::call_special(&result,
+                          thread_group,
+                          group,
+                          vmSymbols::add_method_name(),
+                          vmSymbols::thread_void_signature(),
+                          thread_oop,
+                          CHECK_false);
+
+  MutexLocker mu(Threads_lock);
+  JavaThread* preload_thread = new JavaThread(&preload_thread_entry);
+  if (preload_thread->osthread() == NULL) {
+    // Preloading is only an optimization, the classes load on demand
+    delete preload_thread;
+    return false;
+  }
+
+  java_lang_Thread::set_thread(thread_oop(), preload_thread);
+  java_lang_Thread::set_daemon(thread_oop());
+
+  preload_thread->set_threadObj(thread_oop());
+  Atomic::inc(&_running);
+  Threads::add(preload_thread);
+  Thread::start(preload_thread);
+  return true;
+}
+
+void ClassPreloader::initialize() {
+  assert(PreloadClassList != NULL, "must be enabled");
+  EXCEPTION_MARK;
+
+  if (!read_class_list(PreloadClassList, THREAD)) {
+    return;
+  }
+  // Keep the count up while starting the threads, so the summary is not
+  // logged before all of them have finished
+  _running = 1;
+  uint started = 0;
+  while (started < PreloadClassListThreads && start_thread(started, THREAD)) {
+    started++;
+  }
+  if (HAS_PENDING_EXCEPTION) {
+    CLEAR_PENDING_EXCEPTION;
+  }
+  log_debug(class, load)("Preloading %d classes from %s with %u threads",
+                         _classes->length(), PreloadClassList, started);
+  thread_done(0);
+}
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_VM_CLASSFILE_CLASSPRELOADER_HPP
+#define SHARE_VM_CLASSFILE_CLASSPRELOADER_HPP
+
+#include "memory/allocation.hpp"
+#include "utilities/exceptions.hpp"
+#include "utilities/growableArray.hpp"
+
+class JavaThread;
+class Symbol;
+
+// ClassPreloader loads and links the classes named in the class list given
+// by -XX:PreloadClassList on background threads at startup, so that the
+// application finds them ready instead of parsing, verifying and
+// rewriting them on its own threads. The list has the format written by
+// -XX:DumpLoadedClassList: one class name per line in internal form.
+// Empty lines and lines starting with '#' or '@' are ignored.
+//
+// The classes are loaded with the system class loader and linked, but not
+// initialized, so no application code runs on the preloading threads.
+// Failures are ignored; the class is loaded again on demand, and the error
+// reported, by the thread that needs it.
+class ClassPreloader : AllStatic {
+ private:
+  static GrowableArray<Symbol*>* _classes;
+  static volatile int _claimed;
+  static volatile int _loaded;
+  static volatile int _running;
+
+  static bool read_class_list(const char* path, TRAPS);
+  static bool start_thread(int id, TRAPS);
+  static void preload_thread_entry(JavaThread* thread, TRAPS);
+  static void thread_done(int loaded);
+
+ public:
+  // Read the class list and start PreloadClassListThreads threads.
+  static void initialize();
+};
+
+#endif // SHARE_VM_CLASSFILE_CLASSPRELOADER_HPP
@@ -30,6 +30,7 @@
 #include "classfile/classLoaderData.inline.hpp"
 #include "classfile/klassFactory.hpp"
 #include "memory/filemap.hpp"
+#include "memory/metaspace.hpp"
 #include "memory/metaspaceShared.hpp"
 #include "memory/resourceArea.hpp"
 #include "prims/jvmtiEnvBase.hpp"
@@ -210,6 +211,10 @@ InstanceKlass* KlassFactory::create_from_stream(ClassFileStream* stream,
                                         CHECK_NULL);
   }
 
+  // Batch the metadata allocations of this class. The loader is kept
+  // alive by the caller for the duration of the parse.
+  MetaspaceAllocationCache metaspace_cache(loader_data, THREAD);
+
   ClassFileParser parser(stream,
                          name,
                          loader_data,
@@ -683,6 +683,13 @@ Klass* SystemDictionary::resolve_instance_class_or_null(Symbol* name,
   check_loader_lock_contention(lockObject, THREAD);
   ObjectLocker ol(lockObject, THREAD, DoObjectLock);
 
+  // The thread that held the loader lock has most likely just loaded the
+  // class, so check without taking the SystemDictionary_lock first
+  if (DoObjectLock) {
+    Klass* probe = dictionary->find(d_hash, name, protection_domain);
+    if (probe != NULL) return probe;
+  }
+
   // Check again (after locking) if class already exist in SystemDictionary
   bool class_has_been_loaded   = false;
   bool super_load_in_progress  = false;
@@ -1659,6 +1666,15 @@ InstanceKlass* SystemDictionary::find_or_define_instance_class(Symbol* class_nam
   int p_index = placeholders()->hash_to_index(p_hash);
   PlaceholderEntry* probe;
 
+  // Parallel definers mostly race to define classes that are already
+  // defined; find those without taking the SystemDictionary_lock
+  if (is_parallelDefine(class_loader)) {
+    InstanceKlass* check = dictionary->find(d_hash, name_h, Handle());
+    if (check != NULL) {
+      return check;
+    }
+  }
+
   {
     MutexLocker mu(SystemDictionary_lock, THREAD);
     // First check if class already defined
@@ -772,6 +772,10 @@ bool vmIntrinsics::is_disabled_by_flags(vmIntrinsics::ID id) {
   case vmIntrinsics::_vectorizedMismatch:
     if (!UseVectorizedMismatchIntrinsic) return true;
     break;
+  case vmIntrinsics::_hashCodeL:
+  case vmIntrinsics::_hashCodeI:
+    if (!UseVectorizedHashCodeIntrinsic) return true;
+    break;
   case vmIntrinsics::_updateBytesAdler32:
   case vmIntrinsics::_updateByteBufferAdler32:
     if (!UseAdler32Intrinsics) return true;
@@ -868,6 +872,13 @@ bool vmIntrinsics::is_disabled_by_flags(vmIntrinsics::ID id) {
   case vmIntrinsics::_fsignum:
     if (!InlineMathNatives || !UseSignumIntrinsic) return true;
     break;
+  case vmIntrinsics::_VectorSupport_laneCount:
+  case vmIntrinsics::_VectorSupport_binaryOp:
+  case vmIntrinsics::_VectorSupport_compareEq:
+  case vmIntrinsics::_VectorSupport_blend:
+  case vmIntrinsics::_VectorSupport_rearrange:
+    if (!UseVectorSupportIntrinsics) return true;
+    break;
 #endif // COMPILER2
   default:
     return false;
@@ -954,6 +954,10 @@
    do_signature(indexOfChar_signature,                           "([BIII)I")                                            \
   do_intrinsic(_equalsL,                  java_lang_StringLatin1,equals_name, equalsB_signature,                 F_S)   \
   do_intrinsic(_equalsU,                  java_lang_StringUTF16, equals_name, equalsB_signature,                 F_S)   \
+  do_intrinsic(_hashCodeL,                java_lang_StringLatin1,hashCode_name, hashCodeB_signature,             F_S)   \
+   do_signature(hashCodeB_signature,                             "([B)I")                                               \
+  do_intrinsic(_hashCodeI,                java_util_Arrays,       hashCode_name, hashCodeI_signature,            F_S)   \
+   do_signature(hashCodeI_signature,                             "([I)I")                                               \
                                                                                                                         \
   do_intrinsic(_isDigit,                  java_lang_CharacterDataLatin1, isDigit_name,      int_bool_signature,  F_R)   \
    do_name(     isDigit_name,                                           "isDigit")                                      \
@@ -1009,6 +1013,23 @@
    do_name(vectorizedMismatch_name, "vectorizedMismatch")                                                               \
    do_signature(vectorizedMismatch_signature, "(Ljava/lang/Object;JLjava/lang/Object;JII)I")                            \
                                                                                                                         \
+  /* explicit SIMD kernels for JDK internal code */                                                                     \
+  do_class(jdk_internal_misc_VectorSupport, "jdk/internal/misc/VectorSupport")                                          \
+  do_intrinsic(_VectorSupport_laneCount, jdk_internal_misc_VectorSupport, laneCount_name, int_int_signature, F_S)       \
+   do_name(laneCount_name, "laneCount")                                                                                 \
+  do_intrinsic(_VectorSupport_binaryOp, jdk_internal_misc_VectorSupport, vectorBinaryOp_name, vectorBinaryOp_signature, F_S)\
+   do_name(vectorBinaryOp_name, "binaryOp")                                                                             \
+   do_signature(vectorBinaryOp_signature, "(IIILjava/lang/Object;JLjava/lang/Object;JLjava/lang/Object;J)V")            \
+  do_intrinsic(_VectorSupport_compareEq, jdk_internal_misc_VectorSupport, vectorCompareEq_name, vectorCompareEq_signature, F_S)\
+   do_name(vectorCompareEq_name, "compareEq")                                                                           \
+   do_signature(vectorCompareEq_signature, "(IILjava/lang/Object;JLjava/lang/Object;J)I")                               \
+  do_intrinsic(_VectorSupport_blend, jdk_internal_misc_VectorSupport, vectorBlend_name, vectorBlend_signature, F_S)     \
+   do_name(vectorBlend_name, "blend")                                                                                   \
+   do_signature(vectorBlend_signature, "(IILjava/lang/Object;JLjava/lang/Object;JLjava/lang/Object;JLjava/lang/Object;J)V")\
+  do_intrinsic(_VectorSupport_rearrange, jdk_internal_misc_VectorSupport, vectorRearrange_name, vectorRearrange_signature, F_S)\
+   do_name(vectorRearrange_name, "rearrange")                                                                           \
+   do_signature(vectorRearrange_signature, "(ILjava/lang/Object;JLjava/lang/Object;JLjava/lang/Object;J)V")             \
+                                                                                                                        \
   /* java/lang/ref/Reference */                                                                                         \
   do_intrinsic(_Reference_get,            java_lang_ref_Reference, get_name,    void_object_signature, F_R)             \
                                                                                                                         \
@@ -51,6 +51,7 @@
 #include "runtime/icache.hpp"
 #include "runtime/java.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "runtime/os.hpp"
 #include "runtime/safepointVerifiers.hpp"
 #include "runtime/sweeper.hpp"
 #include "runtime/vmThread.hpp"
@@ -153,6 +154,7 @@ GrowableArray<CodeHeap*>* CodeCache::_heaps = new(ResourceObj::C_HEAP, mtCode) G
 GrowableArray<CodeHeap*>* CodeCache::_compiled_heaps = new(ResourceObj::C_HEAP, mtCode) GrowableArray<CodeHeap*> (CodeBlobType::All, true);
 GrowableArray<CodeHeap*>* CodeCache::_nmethod_heaps = new(ResourceObj::C_HEAP, mtCode) GrowableArray<CodeHeap*> (CodeBlobType::All, true);
 GrowableArray<CodeHeap*>* CodeCache::_allocable_heaps = new(ResourceObj::C_HEAP, mtCode) GrowableArray<CodeHeap*> (CodeBlobType::All, true);
+CodeHeap* CodeCache::_hot_heap = NULL;
 
 void CodeCache::check_heap_sizes(size_t non_nmethod_size, size_t profiled_size, size_t non_profiled_size, size_t cache_size, bool all_set) {
   size_t total_size = non_nmethod_size + profiled_size + non_profiled_size;
@@ -289,13 +291,23 @@ void CodeCache::initialize_heaps() {
 
   // If large page support is enabled, align code heaps according to large
   // page size to make sure that code cache is covered by large pages.
-  const size_t alignment = MAX2(page_size(false, 8), (size_t) os::vm_allocation_granularity());
+  size_t alignment = MAX2(page_size(false, 8), (size_t) os::vm_allocation_granularity());
+  // With CodeCacheUseHugePages every heap starts on a huge page boundary.
+  alignment = MAX2(alignment, huge_page_alignment());
   non_nmethod_size = align_up(non_nmethod_size, alignment);
   profiled_size    = align_down(profiled_size, alignment);
 
+  // The hot code heap takes the top of the non-profiled space, at most half
+  // of it, and starts on a large page boundary.
+  size_t hot_size = 0;
+  if (HotCodeHeapSize > 0 && heap_available(CodeBlobType::MethodNonProfiled)) {
+    hot_size = align_down(MIN2((size_t)HotCodeHeapSize, non_profiled_size / 2), alignment);
+  }
+
   // Reserve one continuous chunk of memory for CodeHeaps and split it into
   // parts for the individual heaps. The memory layout looks like this:
   // ---------- high -----------
+  //        Hot nmethods (optional)
   //    Non-profiled nmethods
   //      Profiled nmethods
   //         Non-nmethods
@@ -305,6 +317,12 @@ void CodeCache::initialize_heaps() {
   ReservedSpace rest                = rs.last_part(non_nmethod_size);
   ReservedSpace profiled_space      = rest.first_part(profiled_size);
   ReservedSpace non_profiled_space  = rest.last_part(profiled_size);
+  ReservedSpace hot_space;
+  if (hot_size > 0) {
+    size_t cold_size = non_profiled_space.size() - hot_size;
+    hot_space          = non_profiled_space.last_part(cold_size);
+    non_profiled_space = non_profiled_space.first_part(cold_size);
+  }
 
   // Non-nmethods (stubs, adapters, ...)
   add_heap(non_method_space, "CodeHeap 'non-nmethods'", CodeBlobType::NonNMethod);
@@ -312,6 +330,13 @@ void CodeCache::initialize_heaps() {
   add_heap(profiled_space, "CodeHeap 'profiled nmethods'", CodeBlobType::MethodProfiled);
   // Tier 1 and tier 4 (non-profiled) methods and native methods
   add_heap(non_profiled_space, "CodeHeap 'non-profiled nmethods'", CodeBlobType::MethodNonProfiled);
+  if (hot_size > 0) {
+    // Tier 4 methods recompiled by the sweeper because they are hot. The heap
+    // shares the MethodNonProfiled blob type for iteration and counters, but
+    // get_code_heap(int) skips it, so only allocate_hot() allocates here.
+    add_heap(hot_space, "CodeHeap 'hot nmethods'", CodeBlobType::MethodNonProfiled);
+    _hot_heap = get_code_heap_containing(hot_space.base());
+  }
 }
 
 size_t CodeCache::page_size(bool aligned, size_t min_pages) {
@@ -327,10 +352,21 @@ size_t CodeCache::page_size(bool aligned, size_t min_pages) {
   }
 }
 
+size_t CodeCache::huge_page_alignment() {
+  if (!CodeCacheUseHugePages) {
+    return os::vm_page_size();
+  }
+  if (UseLargePages && os::large_page_size() > (size_t)os::vm_page_size()) {
+    return os::large_page_size();
+  }
+  return is_power_of_2(CodeCacheHugePageSize) ? CodeCacheHugePageSize : 2*M;
+}
+
 ReservedCodeSpace CodeCache::reserve_heap_memory(size_t size) {
   // Align and reserve space for code cache
   const size_t rs_ps = page_size();
-  const size_t rs_align = MAX2(rs_ps, (size_t) os::vm_allocation_granularity());
+  const size_t rs_align = MAX2(MAX2(rs_ps, (size_t) os::vm_allocation_granularity()),
+                               huge_page_alignment());
   const size_t rs_size = align_up(size, rs_align);
   ReservedCodeSpace rs(rs_size, rs_align, rs_ps > (size_t) os::vm_page_size());
   if (!rs.is_reserved()) {
@@ -447,7 +483,7 @@ CodeHeap* CodeCache::get_code_heap(const CodeBlob* cb) {
 
 CodeHeap* CodeCache::get_code_heap(int code_blob_type) {
   FOR_ALL_HEAPS(heap) {
-    if ((*heap)->accepts(code_blob_type)) {
+    if (*heap != _hot_heap && (*heap)->accepts(code_blob_type)) {
       return *heap;
     }
   }
@@ -552,6 +588,24 @@ CodeBlob* CodeCache::allocate(int size, int code_blob_type, int orig_code_blob_t
   return cb;
 }
 
+CodeBlob* CodeCache::allocate_hot(int size) {
+  assert_locked_or_safepoint(CodeCache_lock);
+  if (_hot_heap == NULL) {
+    return NULL;
+  }
+  CodeBlob* cb = NULL;
+  while (true) {
+    cb = (CodeBlob*)_hot_heap->allocate(size);
+    if (cb != NULL) break;
+    if (!_hot_heap->expand_by(CodeCacheExpansionSize)) {
+      // Full: the caller falls back to the non-profiled heap
+      return NULL;
+    }
+  }
+  print_trace("allocation", cb, size);
+  return cb;
+}
+
 void CodeCache::free(CodeBlob* cb) {
   assert_locked_or_safepoint(CodeCache_lock);
   CodeHeap* heap = get_code_heap(cb);
@@ -1289,6 +1343,18 @@ void CodeCache::flush_dependents_on(InstanceKlass* dependee) {
 
   KlassDepChange changes(dependee);
 
+  if (Deoptimization::use_handshake_deoptimization()) {
+    // The dependency contexts of the changed hierarchy yield the marked
+    // nmethods directly, and threads are handshaked one at a time.
+    GrowableArray<nmethod*>* marked = new (ResourceObj::C_HEAP, mtCode) GrowableArray<nmethod*>(16, true, mtCode);
+    changes.collect_marked(marked);
+    if (mark_for_deoptimization(changes) > 0) {
+      Deoptimization::deoptimize_marked_with_handshake(marked);
+    }
+    delete marked;
+    return;
+  }
+
   // Compute the dependent nmethods
   if (mark_for_deoptimization(changes) > 0) {
     // At least one nmethod has been marked for deoptimization
@@ -1298,8 +1364,10 @@ void CodeCache::flush_dependents_on(InstanceKlass* dependee) {
 }
 
 #ifdef HOTSWAP
-// Flushes compiled methods dependent on dependee in the evolutionary sense
-void CodeCache::flush_evol_dependents_on(InstanceKlass* ev_k) {
+// Flushes compiled methods dependent on any of the dependees in the
+// evolutionary sense. The dependent nmethods of all classes are marked
+// first so that the thread stacks are walked only once.
+void CodeCache::flush_evol_dependents_on(InstanceKlass** ev_ks, int length) {
   // --- Compile_lock is not held. However we are at a safepoint.
   assert_locked_or_safepoint(Compile_lock);
   if (number_of_nmethods_with_dependencies() == 0 && !UseAOT) return;
@@ -1309,7 +1377,11 @@ void CodeCache::flush_evol_dependents_on(InstanceKlass* ev_k) {
   // holding the CodeCache_lock.
 
   // Compute the dependent nmethods
-  if (mark_for_evol_deoptimization(ev_k) > 0) {
+  int number_of_marked_CodeBlobs = 0;
+  for (int i = 0; i < length; i++) {
+    number_of_marked_CodeBlobs += mark_for_evol_deoptimization(ev_ks[i]);
+  }
+  if (number_of_marked_CodeBlobs > 0) {
     // At least one nmethod has been marked for deoptimization
 
     // All this already happens inside a VM_Operation, so we'll do all the work here.
@@ -1674,6 +1746,19 @@ void CodeCache::print_summary(outputStream* st, bool detailed) {
   }
 }
 
+// Print the page size the heaps were reserved with and, on Linux, how much
+// of the committed part of each is currently backed by transparent huge
+// pages. The numbers are collected before the caller takes the
+// CodeCache_lock, since reading /proc/self/smaps is slow.
+void CodeCache::print_backing(outputStream* st, CodeHeap* heap, size_t committed, jlong huge) {
+  st->print("%s: backing: page_size=" SIZE_FORMAT "Kb", heap->name(), page_size() / K);
+  if (huge >= 0) {
+    st->print(" huge_page_backed=" JLONG_FORMAT "Kb of " SIZE_FORMAT "Kb committed (%.0f%%)",
+              huge / K, committed / K, committed > 0 ? 100.0 * huge / committed : 0.0);
+  }
+  st->cr();
+}
+
 void CodeCache::print_codelist(outputStream* st) {
   MutexLockerEx mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
 
@@ -1690,9 +1775,27 @@ void CodeCache::print_codelist(outputStream* st) {
 }
 
 void CodeCache::print_layout(outputStream* st) {
-  MutexLockerEx mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
   ResourceMark rm;
+  size_t* committed = NEW_RESOURCE_ARRAY(size_t, _heaps->length());
+  jlong* huge = NEW_RESOURCE_ARRAY(jlong, _heaps->length());
+  int i = 0;
+  FOR_ALL_HEAPS(heap) {
+    committed[i] = (*heap)->high() - (*heap)->low_boundary();
+    huge[i] = -1;
+#ifdef LINUX
+    huge[i] = os::Linux::huge_page_backed_bytes((*heap)->low_boundary(), committed[i]);
+#endif
+    i++;
+  }
+
+  MutexLockerEx mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
   print_summary(st, true);
+  // Not part of print_summary(), which also runs during error reporting
+  i = 0;
+  FOR_ALL_HEAPS(heap) {
+    print_backing(st, *heap, committed[i], huge[i]);
+    i++;
+  }
 }
 
 void CodeCache::log_state(outputStream* st) {
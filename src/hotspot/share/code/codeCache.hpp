@@ -92,6 +92,7 @@ class CodeCache : AllStatic {
   static GrowableArray<CodeHeap*>* _compiled_heaps;
   static GrowableArray<CodeHeap*>* _nmethod_heaps;
   static GrowableArray<CodeHeap*>* _allocable_heaps;
+  static CodeHeap* _hot_heap;                           // Hot tier 4 nmethods, see HotCodeHeapSize
 
   static address _low_bound;                            // Lower bound of CodeHeap addresses
   static address _high_bound;                           // Upper bound of CodeHeap addresses
@@ -116,6 +117,8 @@ class CodeCache : AllStatic {
   // Returns the name of the VM option to set the size of the corresponding CodeHeap
   static const char* get_code_heap_flag_name(int code_blob_type);
   static ReservedCodeSpace reserve_heap_memory(size_t size);  // Reserves one continuous chunk of memory for the CodeHeaps
+  static size_t huge_page_alignment();                        // Alignment of the CodeHeaps with CodeCacheUseHugePages
+  static void print_backing(outputStream* st, CodeHeap* heap, size_t committed, jlong huge);
 
   // Iteration
   static CodeBlob* first_blob(CodeHeap* heap);                // Returns the first CodeBlob on the given CodeHeap
@@ -147,6 +150,10 @@ class CodeCache : AllStatic {
 
   // Allocation/administration
   static CodeBlob* allocate(int size, int code_blob_type, int orig_code_blob_type = CodeBlobType::All); // allocates a new CodeBlob
+  static CodeBlob* allocate_hot(int size);                 // allocates in the hot code heap, NULL if there is none or it is full
+  static bool has_hot_heap()                               { return _hot_heap != NULL; }
+  static bool is_in_hot_heap(CodeBlob* cb)                 { return _hot_heap != NULL && _hot_heap->contains_blob(cb); }
+  static size_t hot_heap_unallocated_capacity()            { return _hot_heap != NULL ? _hot_heap->unallocated_capacity() : 0; }
   static void commit(CodeBlob* cb);                        // called when the allocated CodeBlob has been filled
   static int  alignment_unit();                            // guaranteed alignment of all CodeBlobs
   static int  alignment_offset();                          // guaranteed offset of first CodeBlob byte within alignment unit (i.e., allocation header)
@@ -303,7 +310,7 @@ class CodeCache : AllStatic {
   static void flush_dependents_on(InstanceKlass* dependee);
 #ifdef HOTSWAP
   // Flushing and deoptimization in case of evolution
-  static void flush_evol_dependents_on(InstanceKlass* dependee);
+  static void flush_evol_dependents_on(InstanceKlass** dependees, int length);
 #endif // HOTSWAP
   // Support for fullspeed debugging
   static void flush_dependents_on_method(const methodHandle& dependee);
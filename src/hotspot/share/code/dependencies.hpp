@@ -685,7 +685,17 @@ class DependencySignature : public ResourceObj {
 
 // Every particular DepChange is a sub-class of this class.
 class DepChange : public StackObj {
+ private:
+  // If set, nmethods newly marked for this change are locked and collected
+  // here, so the caller can deoptimize them without a code cache walk.
+  GrowableArray<nmethod*>* _marked;
+
  public:
+  DepChange() : _marked(NULL) {}
+
+  void collect_marked(GrowableArray<nmethod*>* marked) { _marked = marked; }
+  GrowableArray<nmethod*>* marked() const              { return _marked; }
+
   // What kind of DepChange is this?
   virtual bool is_klass_change()     const { return false; }
   virtual bool is_call_site_change() const { return false; }
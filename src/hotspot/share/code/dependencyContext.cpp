@@ -77,6 +77,11 @@ int DependencyContext::mark_dependent_nmethods(DepChange& changes) {
         nm->print_dependencies();
       }
       changes.mark_for_deoptimization(nm);
+      if (changes.marked() != NULL) {
+        // Keep the nmethod from being flushed until the caller is done with it
+        nmethodLocker::lock_nmethod(nm);
+        changes.marked()->append(nm);
+      }
       found++;
     }
   }
@@ -417,6 +417,7 @@ void nmethod::init_defaults() {
   _stack_traversal_mark       = 0;
   _load_reported              = false; // jvmti state
   _unload_reported            = false;
+  _is_reduced_optimization    = false;
   _is_far_code                = false; // nmethods are located in CodeCache
 
 #ifdef ASSERT
@@ -505,7 +506,9 @@ nmethod* nmethod::new_nmethod(const methodHandle& method,
       + align_up(nul_chk_table->size_in_bytes()    , oopSize)
       + align_up(debug_info->data_size()           , oopSize);
 
-    nm = new (nmethod_size, comp_level)
+    bool hot = comp_level == CompLevel_full_optimization &&
+               entry_bci == InvocationEntryBci && method->is_hot_code();
+    nm = new (nmethod_size, comp_level, hot)
     nmethod(method(), compiler->type(), nmethod_size, compile_id, entry_bci, offsets,
             orig_pc_offset, debug_info, dependencies, code_buffer, frame_size,
             oop_maps,
@@ -519,6 +522,11 @@ nmethod* nmethod::new_nmethod(const methodHandle& method,
 #endif
             );
 
+    if (hot && nm != NULL && CodeCache::is_in_hot_heap(nm)) {
+      log_debug(codecache)("Nmethod %d/" PTR_FORMAT " allocated in the hot code heap",
+                           nm->compile_id(), p2i(nm));
+    }
+
     if (nm != NULL) {
       // To make dependency checking during class loading fast, record
       // the nmethod dependencies in the classes it is dependent on.
@@ -604,6 +612,7 @@ nmethod::nmethod(
     _exception_cache         = NULL;
     _pc_desc_container.reset_to(NULL);
     _hotness_counter         = NMethodSweeper::hotness_counter_reset_val();
+    _hot_sweeps              = 0;
 
     _scopes_data_begin = (address) this + scopes_data_offset;
     _deopt_handler_begin = (address) this + deoptimize_offset;
@@ -649,7 +658,13 @@ nmethod::nmethod(
   }
 }
 
-void* nmethod::operator new(size_t size, int nmethod_size, int comp_level) throw () {
+void* nmethod::operator new(size_t size, int nmethod_size, int comp_level, bool hot) throw () {
+  if (hot) {
+    void* result = CodeCache::allocate_hot(nmethod_size);
+    if (result != NULL) {
+      return result;
+    }
+  }
   return CodeCache::allocate(nmethod_size, CodeCache::get_code_blob_type(comp_level));
 }
 
@@ -694,6 +709,7 @@ nmethod::nmethod(
     _comp_level              = comp_level;
     _orig_pc_offset          = orig_pc_offset;
     _hotness_counter         = NMethodSweeper::hotness_counter_reset_val();
+    _hot_sweeps              = 0;
 
     // Section offsets
     _consts_offset           = content_offset()      + code_buffer->total_offset_of(code_buffer->consts());
@@ -124,6 +124,9 @@ class nmethod : public CompiledMethod {
   bool _unload_reported;
   bool _load_reported;
 
+  // compiled with reduced optimization, to be replaced by a full compilation
+  bool _is_reduced_optimization;
+
   // Protected by Patching_lock
   volatile signed char _state;               // {not_installed, in_use, not_entrant, zombie, unloaded}
 
@@ -159,6 +162,10 @@ class nmethod : public CompiledMethod {
   // counter is decreased (by 1) while sweeping.
   int _hotness_counter;
 
+  // Number of consecutive sweeps that found this nmethod active on a stack.
+  // Used to pick nmethods for the hot code heap (see HotCodeHeapSize).
+  int _hot_sweeps;
+
   // Local state used to keep track of whether unloading is happening or not
   volatile uint8_t _is_unloading_state;
 
@@ -215,7 +222,7 @@ class nmethod : public CompiledMethod {
           );
 
   // helper methods
-  void* operator new(size_t size, int nmethod_size, int comp_level) throw();
+  void* operator new(size_t size, int nmethod_size, int comp_level, bool hot = false) throw();
 
   const char* reloc_string_for(u_char* begin, u_char* end);
 
@@ -319,6 +326,8 @@ class nmethod : public CompiledMethod {
   void dec_hotness_counter()        { _hotness_counter--; }
   void set_hotness_counter(int val) { _hotness_counter = val; }
   int  hotness_counter() const      { return _hotness_counter; }
+  int  inc_hot_sweeps()             { return ++_hot_sweeps; }
+  void reset_hot_sweeps()           { _hot_sweeps = 0; }
 
   // Containment
   bool oops_contains         (oop*    addr) const { return oops_begin         () <= addr && addr < oops_end         (); }
@@ -376,6 +385,9 @@ class nmethod : public CompiledMethod {
 
   int   comp_level() const                        { return _comp_level; }
 
+  bool  is_reduced_optimization() const           { return _is_reduced_optimization; }
+  void  set_reduced_optimization(bool z)          { _is_reduced_optimization = z; }
+
   void unlink_from_method(bool acquire_lock);
 
   // Support for oops in scopes and relocs:
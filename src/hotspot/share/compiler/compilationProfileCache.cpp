@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "classfile/symbolTable.hpp"
+#include "code/codeCache.hpp"
+#include "code/nmethod.hpp"
+#include "compiler/compilationProfileCache.hpp"
+#include "logging/log.hpp"
+#include "memory/resourceArea.hpp"
+#include "oops/method.hpp"
+#include "oops/symbol.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "runtime/thread.hpp"
+#include "utilities/resourceHash.hpp"
+
+class CompilationProfileKey {
+ public:
+  Symbol* _klass;
+  Symbol* _name;
+  Symbol* _signature;
+
+  CompilationProfileKey() : _klass(NULL), _name(NULL), _signature(NULL) {}
+  CompilationProfileKey(Symbol* klass, Symbol* name, Symbol* signature) :
+    _klass(klass), _name(name), _signature(signature) {}
+
+  // The symbols are canonical, so identity is enough.
+  static unsigned hash(CompilationProfileKey const& k) {
+    return primitive_hash<Symbol*>(k._klass) ^
+           primitive_hash<Symbol*>(k._name) * 31 ^
+           primitive_hash<Symbol*>(k._signature) * 7;
+  }
+
+  static bool equals(CompilationProfileKey const& k0, CompilationProfileKey const& k1) {
+    return k0._klass == k1._klass && k0._name == k1._name && k0._signature == k1._signature;
+  }
+};
+
+typedef ResourceHashtable<CompilationProfileKey, bool,
+                          CompilationProfileKey::hash,
+                          CompilationProfileKey::equals,
+                          1031, ResourceObj::C_HEAP, mtCompiler> CompilationProfileTable;
+
+// Filled once at startup and only read afterwards.
+static CompilationProfileTable* _table = NULL;
+
+bool CompilationProfileCache::_is_loaded = false;
+
+bool CompilationProfileCache::load(const char* path) {
+  assert(!_is_loaded, "load only once");
+  FILE* stream = fopen(path, "rt");
+  if (stream == NULL) {
+    warning("Cannot open compilation profile %s", path);
+    return false;
+  }
+
+  Thread* THREAD = Thread::current();
+  _table = new (ResourceObj::C_HEAP, mtCompiler) CompilationProfileTable();
+
+  char line[3 * 1024];
+  char klass[1024];
+  char name[1024];
+  char signature[1024];
+  int count = 0;
+  int lineno = 0;
+  while (fgets(line, sizeof(line), stream) != NULL) {
+    lineno++;
+    if (line[0] == '#' || line[0] == '\n') {
+      continue;
+    }
+    int invocations = 0;
+    int backedges = 0;
+    if (sscanf(line, "%1023s %1023s %1023s %d %d", klass, name, signature, &invocations, &backedges) != 5) {
+      warning("Malformed line %d in compilation profile %s", lineno, path);
+      continue;
+    }
+    CompilationProfileKey key(SymbolTable::new_permanent_symbol(klass, THREAD),
+                              SymbolTable::new_permanent_symbol(name, THREAD),
+                              SymbolTable::new_permanent_symbol(signature, THREAD));
+    if (HAS_PENDING_EXCEPTION) {
+      CLEAR_PENDING_EXCEPTION;
+      break;
+    }
+    if (_table->put(key, true)) {
+      count++;
+    }
+  }
+  fclose(stream);
+
+  log_info(jit, compilation)("Loaded %d methods from compilation profile %s", count, path);
+  _is_loaded = count > 0;
+  return true;
+}
+
+bool CompilationProfileCache::contains(Method* method) {
+  if (!_is_loaded) {
+    return false;
+  }
+  CompilationProfileKey key(method->klass_name(), method->name(), method->signature());
+  return _table->get(key) != NULL;
+}
+
+void CompilationProfileCache::dump(outputStream* out) {
+  out->print_cr("# <klass> <name> <signature> <invocation count> <backedge count>");
+  MutexLockerEx mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
+  NMethodIterator iter(NMethodIterator::only_alive_and_not_unloading);
+  while (iter.next()) {
+    nmethod* nm = iter.method();
+    if (nm->comp_level() != CompLevel_full_optimization || !nm->is_in_use()) {
+      continue;
+    }
+    // OSR and standard versions of the same method may both be listed,
+    // the loader drops the duplicates.
+    ResourceMark rm;
+    Method* m = nm->method();
+    out->print_cr("%s %s %s %d %d",
+                  m->klass_name()->as_C_string(), m->name()->as_C_string(),
+                  m->signature()->as_C_string(),
+                  m->invocation_count(), m->backedge_count());
+  }
+}
+
+bool CompilationProfileCache::dump_to_file(const char* path, outputStream* err) {
+  fileStream fs(path);
+  if (!fs.is_open()) {
+    err->print_cr("Cannot open compilation profile %s for writing", path);
+    return false;
+  }
+  dump(&fs);
+  return true;
+}
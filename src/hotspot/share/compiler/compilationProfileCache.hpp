@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_VM_COMPILER_COMPILATIONPROFILECACHE_HPP
+#define SHARE_VM_COMPILER_COMPILATIONPROFILECACHE_HPP
+
+#include "memory/allocation.hpp"
+#include "utilities/ostream.hpp"
+
+class Method;
+
+// CompilationProfileCache remembers which methods were compiled at tier 4
+// in an earlier run of the application. The set is written to the file
+// named by CompilationProfileDumpFile at VM exit or with the
+// Compiler.dump_profile diagnostic command, and is read back from
+// CompilationProfileLoadFile at startup. TieredThresholdPolicy uses it to
+// promote the listed methods through the tiers without waiting for the
+// usual thresholds.
+//
+// The file holds one method per line:
+//
+//   <klass> <name> <signature> <invocation count> <backedge count>
+//
+// with the names in internal form. Empty lines and lines starting with
+// '#' are ignored.
+class CompilationProfileCache : AllStatic {
+ private:
+  static bool _is_loaded;
+
+ public:
+  // Read the profile file, returns false if it could not be read.
+  static bool load(const char* path);
+
+  // Write the methods currently compiled at tier 4.
+  static void dump(outputStream* out);
+  static bool dump_to_file(const char* path, outputStream* err);
+
+  static bool is_loaded() { return _is_loaded; }
+
+  // Was the method compiled at tier 4 in the run that wrote the profile?
+  static bool contains(Method* method);
+};
+
+#endif // SHARE_VM_COMPILER_COMPILATIONPROFILECACHE_HPP
@@ -56,6 +56,7 @@
 #include "runtime/safepointVerifiers.hpp"
 #include "runtime/sharedRuntime.hpp"
 #include "runtime/sweeper.hpp"
+#include "runtime/timer.hpp"
 #include "runtime/timerTrace.hpp"
 #include "runtime/vframe.inline.hpp"
 #include "utilities/debug.hpp"
@@ -133,6 +134,7 @@ CompileLog** CompileBroker::_compiler2_logs = NULL;
 // These counters are used to assign an unique ID to each compilation.
 volatile jint CompileBroker::_compilation_id     = 0;
 volatile jint CompileBroker::_osr_compilation_id = 0;
+volatile jint CompileBroker::_pending_reoptimizations = 0;
 
 // Debugging information
 int  CompileBroker::_last_compile_type     = no_compile;
@@ -231,6 +233,7 @@ class CompilationLog : public StringEventLog {
 static CompilationLog* _compilation_log = NULL;
 
 bool compileBroker_init() {
+  TraceTime timer("CompileBroker initialization", TRACETIME_LOG(Info, startuptime));
   if (LogEvents) {
     _compilation_log = new CompilationLog();
   }
@@ -372,6 +375,12 @@ void CompileQueue::add(CompileTask* task) {
     _last = task;
   }
   ++_size;
+  _peak_size = MAX2(_peak_size, _size);
+  _total_added++;
+  if (UsePerfData && _perf_size != NULL) {
+    _perf_size->set_value(_size);
+    _perf_total_added->inc();
+  }
 
   // Mark the method as being in the compile queue.
   task->method()->set_queued_for_compilation();
@@ -474,6 +483,7 @@ CompileTask* CompileQueue::get() {
     save_method = methodHandle(task->method());
     save_hot_method = methodHandle(task->hot_method());
 
+    record_dequeue(task);
     remove(task);
   }
   purge_stale_tasks(); // may temporarily release MCQ lock
@@ -521,6 +531,62 @@ void CompileQueue::remove(CompileTask* task) {
     _last = task->prev();
   }
   --_size;
+  if (UsePerfData && _perf_size != NULL) {
+    _perf_size->set_value(_size);
+  }
+}
+
+// Account the time the task spent in the queue before a compiler
+// thread picked it up.
+void CompileQueue::record_dequeue(CompileTask* task) {
+  assert(MethodCompileQueue_lock->owned_by_self(), "must own lock");
+  jlong wait = os::elapsed_counter() - task->time_queued();
+  _total_removed++;
+  _total_wait_ticks += wait;
+  if (UsePerfData && _perf_size != NULL) {
+    _perf_total_removed->inc();
+    _perf_wait_time->inc(wait);
+    jlong millis = (jlong)TimeHelper::counter_to_millis(wait);
+    int bucket = 0;
+    for (jlong limit = 1; bucket < wait_histogram_length - 1 && millis >= limit; limit *= 10) {
+      bucket++;
+    }
+    _perf_wait_histogram[bucket]->inc();
+  }
+}
+
+double CompileQueue::sample_average_wait_millis() {
+  assert_locked_or_safepoint(CompileThread_lock);
+  jlong removed = _total_removed - _sampled_removed;
+  if (removed <= 0) {
+    return -1.0;
+  }
+  jlong wait = _total_wait_ticks - _sampled_wait_ticks;
+  _sampled_removed = _total_removed;
+  _sampled_wait_ticks = _total_wait_ticks;
+  return TimeHelper::counter_to_millis(wait) / removed;
+}
+
+void CompileQueue::init_perf_counters(const char* prefix, TRAPS) {
+  if (!UsePerfData) {
+    return;
+  }
+  static const char* const histogram_names[wait_histogram_length] = {
+    "wait1ms", "wait10ms", "wait100ms", "wait1s", "waitOver1s"
+  };
+  char name[64];
+  jio_snprintf(name, sizeof(name), "%sQueue.size", prefix);
+  _perf_size = PerfDataManager::create_variable(SUN_CI, name, PerfData::U_None, CHECK);
+  jio_snprintf(name, sizeof(name), "%sQueue.added", prefix);
+  _perf_total_added = PerfDataManager::create_counter(SUN_CI, name, PerfData::U_Events, CHECK);
+  jio_snprintf(name, sizeof(name), "%sQueue.removed", prefix);
+  _perf_total_removed = PerfDataManager::create_counter(SUN_CI, name, PerfData::U_Events, CHECK);
+  jio_snprintf(name, sizeof(name), "%sQueue.waitTime", prefix);
+  _perf_wait_time = PerfDataManager::create_counter(SUN_CI, name, PerfData::U_Ticks, CHECK);
+  for (int i = 0; i < wait_histogram_length; i++) {
+    jio_snprintf(name, sizeof(name), "%sQueue.%s", prefix, histogram_names[i]);
+    _perf_wait_histogram[i] = PerfDataManager::create_counter(SUN_CI, name, PerfData::U_Events, CHECK);
+  }
 }
 
 void CompileQueue::remove_and_mark_stale(CompileTask* task) {
@@ -857,11 +923,13 @@ void CompileBroker::init_compiler_sweeper_threads() {
   if (_c2_count > 0) {
     const char* name = JVMCI_ONLY(UseJVMCICompiler ? "JVMCI compile queue" :) "C2 compile queue";
     _c2_compile_queue  = new CompileQueue(name);
+    _c2_compile_queue->init_perf_counters(JVMCI_ONLY(UseJVMCICompiler ? "jvmci" :) "c2", CHECK);
     _compiler2_objects = NEW_C_HEAP_ARRAY(jobject, _c2_count, mtCompiler);
     _compiler2_logs = NEW_C_HEAP_ARRAY(CompileLog*, _c2_count, mtCompiler);
   }
   if (_c1_count > 0) {
     _c1_compile_queue  = new CompileQueue("C1 compile queue");
+    _c1_compile_queue->init_perf_counters("c1", CHECK);
     _compiler1_objects = NEW_C_HEAP_ARRAY(jobject, _c1_count, mtCompiler);
     _compiler1_logs = NEW_C_HEAP_ARRAY(CompileLog*, _c1_count, mtCompiler);
   }
@@ -925,6 +993,37 @@ void CompileBroker::init_compiler_sweeper_threads() {
   }
 }
 
+// With UseCPUAwareCompilerThreads, limit the new_count threads requested
+// for the compiler serving the queue, which has old_count threads now.
+// os::active_processor_count() takes container quotas and cpu sets into
+// account. A thread is added only while tasks wait longer than
+// CompilerThreadQueueWaitTarget on average and a processor is left idle by
+// the application, and never beyond half of the processors. Only called
+// when new_count > old_count, so that the queue wait is averaged over the
+// time since the last request for a thread.
+int CompileBroker::cpu_aware_thread_limit(CompileQueue* queue, int old_count, int new_count) {
+  assert(new_count > old_count, "only called to add threads");
+  if (!UseCPUAwareCompilerThreads) {
+    return new_count;
+  }
+  int processors = os::active_processor_count();
+  int max_threads = MAX2(processors / 2, 1);
+  double wait = queue->sample_average_wait_millis();
+  double load;
+  if (os::loadavg(&load, 1) != 1) {
+    load = -1.0;
+  }
+  bool waiting = wait >= (double)CompilerThreadQueueWaitTarget;
+  bool idle = load < 0.0 || (double)processors - load >= 1.0;
+  int limit = MIN3(new_count, waiting && idle ? old_count + 1 : old_count, max_threads);
+  if (TraceCompilerThreads && limit < new_count) {
+    tty->print_cr("%s thread limit: %d of %d requested (processors: %d, system load: %.2f, average queue wait: %.3fms)%s",
+                  queue->name(), limit, new_count, processors, load, wait,
+                  waiting && !idle ? ", suppressed by system load" : "");
+  }
+  return limit;
+}
+
 void CompileBroker::possibly_add_compiler_threads() {
   EXCEPTION_MARK;
 
@@ -942,6 +1041,9 @@ void CompileBroker::possibly_add_compiler_threads() {
         _c2_compile_queue->size() / 2,
         (int)(available_memory / (200*M)),
         (int)(available_cc_np / (128*K)));
+    if (new_c2_count > old_c2_count) {
+      new_c2_count = cpu_aware_thread_limit(_c2_compile_queue, old_c2_count, new_c2_count);
+    }
 
     for (int i = old_c2_count; i < new_c2_count; i++) {
 #if INCLUDE_JVMCI
@@ -995,6 +1097,9 @@ void CompileBroker::possibly_add_compiler_threads() {
         _c1_compile_queue->size() / 4,
         (int)(available_memory / (100*M)),
         (int)(available_cc_p / (128*K)));
+    if (new_c1_count > old_c1_count) {
+      new_c1_count = cpu_aware_thread_limit(_c1_compile_queue, old_c1_count, new_c1_count);
+    }
 
     for (int i = old_c1_count; i < new_c1_count; i++) {
       JavaThread *ct = make_thread(compiler1_object(i), _c1_compile_queue, _compilers[0], CHECK);
@@ -1411,6 +1516,10 @@ bool CompileBroker::compilation_is_complete(const methodHandle& method,
     } else {
       CompiledMethod* result = method->code();
       if (result == NULL) return false;
+      if (result->is_nmethod() && result->as_nmethod()->is_reduced_optimization()) {
+        // Still to be replaced by a fully optimized compilation
+        return false;
+      }
       return comp_level == result->comp_level();
     }
   }
@@ -1784,6 +1893,68 @@ CompileLog* CompileBroker::get_log(CompilerThread* ct) {
   return log;
 }
 
+// ------------------------------------------------------------------
+// CompileBroker::defer_reoptimization
+void CompileBroker::defer_reoptimization(nmethod* nm) {
+  nm->set_reduced_optimization(true);
+  Atomic::inc(&_pending_reoptimizations);
+}
+
+// ------------------------------------------------------------------
+// CompileBroker::reoptimize_pending_methods
+//
+// Called by a compiler thread that found its queue empty: submit full
+// compilations for the methods whose code was compiled with reduced
+// optimization. The old code stays in use until it gets replaced.
+// A compiler thread must never wait for its own queue, so methods that
+// would be compiled in blocking mode keep their reduced code.
+void CompileBroker::reoptimize_pending_methods(JavaThread* thread) {
+  jint pending = _pending_reoptimizations;
+  if (pending <= 0 || Atomic::cmpxchg(0, &_pending_reoptimizations, pending) != pending) {
+    // Another compiler thread took care of them.
+    return;
+  }
+
+  for (jint i = 0; i < pending; i++) {
+    methodHandle mh;
+    {
+      MutexLockerEx mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
+      NMethodIterator iter(NMethodIterator::only_alive_and_not_unloading);
+      while (iter.next()) {
+        nmethod* nm = iter.method();
+        Method* m = nm->method();
+        if (nm->is_reduced_optimization() && nm->is_in_use() && m != NULL &&
+            m->code() == nm && !m->queued_for_compilation()) {
+          mh = methodHandle(thread, m);
+          break;
+        }
+      }
+    }
+    if (mh.is_null()) {
+      break;
+    }
+    AbstractCompiler* comp = compiler(CompLevel_full_optimization);
+    DirectiveSet* directive = DirectivesStack::getMatchingDirective(mh, comp);
+    bool is_blocking = !directive->BackgroundCompilationOption || CompileTheWorld || ReplayCompiles;
+    if (!is_blocking) {
+      compile_method(mh, InvocationEntryBci, CompLevel_full_optimization,
+                     mh, 0, CompileTask::Reason_Reoptimize, directive, thread);
+      if (thread->has_pending_exception()) {
+        thread->clear_pending_exception();
+      }
+    }
+    DirectivesStack::release(directive);
+    if (!mh->queued_for_compilation()) {
+      // The compilation was refused: keep the code we have.
+      MutexLockerEx mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
+      CompiledMethod* code = mh->code();
+      if (code != NULL && code->is_nmethod()) {
+        code->as_nmethod()->set_reduced_optimization(false);
+      }
+    }
+  }
+}
+
 // ------------------------------------------------------------------
 // CompileBroker::compiler_thread_loop
 //
@@ -1832,6 +2003,10 @@ void CompileBroker::compiler_thread_loop() {
     // We need this HandleMark to avoid leaking VM handles.
     HandleMark hm(thread);
 
+    if (_pending_reoptimizations > 0 && queue->is_empty()) {
+      reoptimize_pending_methods(thread);
+    }
+
     CompileTask* task = queue->get();
     if (task == NULL) {
       if (UseDynamicNumberOfCompilerThreads) {
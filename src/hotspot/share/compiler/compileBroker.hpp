@@ -78,6 +78,13 @@ class CompilerCounters : public CHeapObj<mtCompiler> {
 //
 // A list of CompileTasks.
 class CompileQueue : public CHeapObj<mtCompiler> {
+ public:
+  // Buckets of the queue wait time histogram, in milliseconds:
+  // [0, 1), [1, 10), [10, 100), [100, 1000) and [1000, inf).
+  enum {
+    wait_histogram_length = 5
+  };
+
  private:
   const char* _name;
 
@@ -87,17 +94,51 @@ class CompileQueue : public CHeapObj<mtCompiler> {
   CompileTask* _first_stale;
 
   int _size;
+  int _peak_size;
+
+  // Statistics, updated under MethodCompileQueue_lock
+  jlong _total_added;
+  jlong _total_removed;
+  jlong _total_wait_ticks;
+
+  // Totals at the last sample_average_wait_millis() call
+  jlong _sampled_removed;
+  jlong _sampled_wait_ticks;
+
+  // performance counters
+  PerfVariable* _perf_size;
+  PerfCounter*  _perf_total_added;
+  PerfCounter*  _perf_total_removed;
+  PerfCounter*  _perf_wait_time;
+  PerfCounter*  _perf_wait_histogram[wait_histogram_length];
 
   void purge_stale_tasks();
+  void record_dequeue(CompileTask* task);
  public:
   CompileQueue(const char* name) {
     _name = name;
     _first = NULL;
     _last = NULL;
     _size = 0;
+    _peak_size = 0;
     _first_stale = NULL;
+    _total_added = 0;
+    _total_removed = 0;
+    _total_wait_ticks = 0;
+    _sampled_removed = 0;
+    _sampled_wait_ticks = 0;
+    _perf_size = NULL;
+    _perf_total_added = NULL;
+    _perf_total_removed = NULL;
+    _perf_wait_time = NULL;
+    for (int i = 0; i < wait_histogram_length; i++) {
+      _perf_wait_histogram[i] = NULL;
+    }
   }
 
+  // Create the sun.ci.<prefix>Queue.* performance counters
+  void init_perf_counters(const char* prefix, TRAPS);
+
   const char*  name() const                      { return _name; }
 
   void         add(CompileTask* task);
@@ -110,6 +151,14 @@ class CompileQueue : public CHeapObj<mtCompiler> {
 
   bool         is_empty() const                  { return _first == NULL; }
   int          size()     const                  { return _size;          }
+  int          peak_size() const                 { return _peak_size;     }
+  jlong        total_added() const               { return _total_added;   }
+  jlong        total_removed() const             { return _total_removed; }
+  jlong        total_wait_ticks() const          { return _total_wait_ticks; }
+
+  // Average queue wait of the tasks removed since the previous call,
+  // or -1 if none was removed. Called with CompileThread_lock held.
+  double       sample_average_wait_millis();
 
 
   // Redefine Classes support
@@ -173,6 +222,10 @@ class CompileBroker: AllStatic {
   static volatile jint _compilation_id;
   static volatile jint _osr_compilation_id;
 
+  // Number of nmethods compiled with reduced optimization since the
+  // compile queue last drained
+  static volatile jint _pending_reoptimizations;
+
   static int  _last_compile_type;
   static int  _last_compile_level;
   static char _last_method_compiled[name_buffer_length];
@@ -233,6 +286,8 @@ class CompileBroker: AllStatic {
   static JavaThread* make_thread(jobject thread_oop, CompileQueue* queue, AbstractCompiler* comp, TRAPS);
   static void init_compiler_sweeper_threads();
   static void possibly_add_compiler_threads();
+  static int  cpu_aware_thread_limit(CompileQueue* queue, int old_count, int new_count);
+  static void reoptimize_pending_methods(JavaThread* thread);
   static bool compilation_is_prohibited(const methodHandle& method, int osr_bci, int comp_level, bool excluded);
   static void preload_classes          (const methodHandle& method, TRAPS);
 
@@ -267,7 +322,6 @@ class CompileBroker: AllStatic {
                                   bool blocking,
                                   Thread* thread);
 
-  static CompileQueue* compile_queue(int comp_level);
   static bool init_compiler_runtime();
   static void shutdown_compiler_runtime(AbstractCompiler* comp, CompilerThread* thread);
 
@@ -283,6 +337,8 @@ public:
     return NULL;
   }
 
+  static CompileQueue* compile_queue(int comp_level);
+
   static bool compilation_is_complete(const methodHandle& method, int osr_bci, int comp_level);
   static bool compilation_is_in_queue(const methodHandle& method);
   static void print_compile_queues(outputStream* st);
@@ -316,6 +372,11 @@ public:
   static void compiler_thread_loop();
   static uint get_compilation_id() { return _compilation_id; }
 
+  // Record an nmethod compiled with reduced optimization because the
+  // compile queue was backed up. Its method is compiled again once the
+  // queue has drained.
+  static void defer_reoptimization(nmethod* nm);
+
   // Set _should_block.
   // Call this from the VM, with Threads_lock held and a safepoint requested.
   static void set_should_block();
@@ -50,6 +50,7 @@ class CompileTask : public CHeapObj<mtCompiler> {
       Reason_InvocationCount,  // Simple/StackWalk-policy
       Reason_BackedgeCount,    // Simple/StackWalk-policy
       Reason_Tiered,           // Tiered-policy
+      Reason_Reoptimize,       // Code compiled with reduced optimization
       Reason_CTW,              // Compile the world
       Reason_Replay,           // ciReplay
       Reason_Whitebox,         // Whitebox API
@@ -64,6 +65,7 @@ class CompileTask : public CHeapObj<mtCompiler> {
       "count",
       "backedge_count",
       "tiered",
+      "reoptimize",
       "CTW",
       "replay",
       "whitebox",
@@ -118,9 +120,11 @@ class CompileTask : public CHeapObj<mtCompiler> {
   Method*      method() const                    { return _method; }
   Method*      hot_method() const                { return _hot_method; }
   int          osr_bci() const                   { return _osr_bci; }
+  CompileReason compile_reason() const           { return _compile_reason; }
   bool         is_complete() const               { return _is_complete; }
   bool         is_blocking() const               { return _is_blocking; }
   bool         is_success() const                { return _is_success; }
+  jlong        time_queued() const               { return _time_queued; }
   bool         can_become_stale() const          {
     switch (_compile_reason) {
       case Reason_BackedgeCount:
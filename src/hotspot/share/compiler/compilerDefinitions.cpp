@@ -440,6 +440,10 @@ void CompilerConfig::ergo_initialize() {
     // nothing to use the profiling, turn if off
     FLAG_SET_DEFAULT(TypeProfileLevel, 0);
   }
+  if (UsePolymorphicInlining && FLAG_IS_DEFAULT(TypeProfileWidth)) {
+    // record enough receivers per call site for the polymorphic inline cache
+    FLAG_SET_DEFAULT(TypeProfileWidth, 4);
+  }
   if (!FLAG_IS_DEFAULT(OptoLoopAlignment) && FLAG_IS_DEFAULT(MaxLoopPad)) {
     FLAG_SET_DEFAULT(MaxLoopPad, OptoLoopAlignment-1);
   }
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2018, Red Hat, Inc. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/epsilon/epsilonArenaDCmd.hpp"
+#include "gc/epsilon/epsilonHeap.hpp"
+#include "memory/resourceArea.hpp"
+#include "runtime/vmOperations.hpp"
+#include "runtime/vmThread.hpp"
+#include "utilities/ostream.hpp"
+
+class VM_EpsilonArena : public VM_Operation {
+public:
+  enum Action {
+    _watermark,
+    _reset,
+    _status
+  };
+
+private:
+  const Action _action;
+  const bool _verify;
+  outputStream* const _st;
+
+public:
+  VM_EpsilonArena(Action action, bool verify, outputStream* st) :
+          _action(action), _verify(verify), _st(st) {}
+
+  virtual VMOp_Type type() const { return VMOp_EpsilonArena; }
+
+  virtual void doit() {
+    EpsilonHeap* heap = EpsilonHeap::heap();
+    switch (_action) {
+      case _watermark:
+        heap->set_watermark(_st);
+        break;
+      case _reset:
+        heap->reset_to_watermark(_verify, _st);
+        break;
+      default:
+        heap->print_arena_on(_st);
+    }
+  }
+};
+
+EpsilonArenaDCmd::EpsilonArenaDCmd(outputStream* output, bool heap) :
+  DCmdWithParser(output, heap),
+  _action("action", "One of: watermark, reset, status", "STRING", false, "status"),
+  _verify("-verify", "Before reset, also check objects below the watermark for references into the arena",
+          "BOOLEAN", false, "false") {
+  _dcmdparser.add_dcmd_option(&_verify);
+  _dcmdparser.add_dcmd_argument(&_action);
+}
+
+int EpsilonArenaDCmd::num_arguments() {
+  ResourceMark rm;
+  EpsilonArenaDCmd* dcmd = new EpsilonArenaDCmd(NULL, false);
+  if (dcmd != NULL) {
+    DCmdMark mark(dcmd);
+    return dcmd->_dcmdparser.num_arguments();
+  } else {
+    return 0;
+  }
+}
+
+void EpsilonArenaDCmd::execute(DCmdSource source, TRAPS) {
+  if (!UseEpsilonGC || !EpsilonArenaMode) {
+    output()->print_cr("Arena mode is only available with -XX:+UseEpsilonGC -XX:+EpsilonArenaMode.");
+    return;
+  }
+
+  const char* action = _action.value();
+  VM_EpsilonArena::Action a;
+  if (strcmp(action, "watermark") == 0) {
+    a = VM_EpsilonArena::_watermark;
+  } else if (strcmp(action, "reset") == 0) {
+    a = VM_EpsilonArena::_reset;
+  } else if (strcmp(action, "status") == 0) {
+    a = VM_EpsilonArena::_status;
+  } else {
+    output()->print_cr("Unknown action \"%s\", expected one of: watermark, reset, status.", action);
+    return;
+  }
+
+  VM_EpsilonArena op(a, _verify.value(), output());
+  VMThread::execute(&op);
+}
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2018, Red Hat, Inc. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_VM_GC_EPSILON_EPSILONARENADCMD_HPP
+#define SHARE_VM_GC_EPSILON_EPSILONARENADCMD_HPP
+
+#include "services/diagnosticCommand.hpp"
+
+class outputStream;
+
+// Controls the Epsilon arena mode (see EpsilonArenaMode): "watermark"
+// starts a new epoch at the current heap top, "reset" discards everything
+// allocated since, and "status" prints the current epoch. Both watermark
+// and reset run in a VM operation.
+class EpsilonArenaDCmd : public DCmdWithParser {
+  DCmdArgument<char*> _action;
+  DCmdArgument<bool>  _verify;
+public:
+  EpsilonArenaDCmd(outputStream* output, bool heap);
+  static const char* name() {
+    return "GC.epsilon_arena";
+  }
+  static const char* description() {
+    return "Set the Epsilon arena watermark, or reset the heap to it.";
+  }
+  static const char* impact() {
+    return "Medium: Depends on the number of roots, and the Java heap size with -verify.";
+  }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+                        "control", NULL};
+    return p;
+  }
+  static int num_arguments();
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
+#endif // SHARE_VM_GC_EPSILON_EPSILONARENADCMD_HPP
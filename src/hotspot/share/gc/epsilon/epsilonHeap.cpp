@@ -23,12 +23,26 @@
  */
 
 #include "precompiled.hpp"
+#include "aot/aotLoader.hpp"
+#include "classfile/classLoaderDataGraph.hpp"
+#include "classfile/stringTable.hpp"
+#include "classfile/systemDictionary.hpp"
+#include "code/codeCache.hpp"
 #include "gc/epsilon/epsilonHeap.hpp"
 #include "gc/epsilon/epsilonMemoryPool.hpp"
 #include "gc/epsilon/epsilonThreadLocalData.hpp"
+#include "gc/shared/weakProcessor.hpp"
 #include "memory/allocation.hpp"
 #include "memory/allocation.inline.hpp"
+#include "memory/iterator.inline.hpp"
 #include "memory/resourceArea.hpp"
+#include "oops/oop.inline.hpp"
+#include "prims/jvmtiExport.hpp"
+#include "prims/resolvedMethodTable.hpp"
+#include "runtime/jniHandles.hpp"
+#include "runtime/synchronizer.hpp"
+#include "runtime/thread.hpp"
+#include "services/management.hpp"
 
 jint EpsilonHeap::initialize() {
   size_t align = _policy->heap_alignment();
@@ -355,3 +369,143 @@ void EpsilonHeap::print_metaspace_info() const {
     log_info(gc, metaspace)("Metaspace: no reliable data");
   }
 }
+
+// Counts references into [watermark, top), i.e. into the current arena epoch.
+class EpsilonArenaRefClosure : public BasicOopIterateClosure {
+private:
+  HeapWord* const _watermark;
+  HeapWord* const _top;
+  size_t _refs;
+
+  template <class T>
+  void do_oop_work(T* p) {
+    T o = RawAccess<>::oop_load(p);
+    if (!CompressedOops::is_null(o)) {
+      HeapWord* addr = (HeapWord*) CompressedOops::decode_not_null(o);
+      if (addr >= _watermark && addr < _top) {
+        _refs++;
+      }
+    }
+  }
+
+public:
+  EpsilonArenaRefClosure(HeapWord* watermark, HeapWord* top) :
+          _watermark(watermark), _top(top), _refs(0) {}
+  virtual void do_oop(oop* p)       { do_oop_work(p); }
+  virtual void do_oop(narrowOop* p) { do_oop_work(p); }
+  size_t refs() const { return _refs; }
+};
+
+// Everything below the watermark survives the reset.
+class EpsilonArenaIsAliveClosure : public BoolObjectClosure {
+private:
+  HeapWord* const _watermark;
+public:
+  EpsilonArenaIsAliveClosure(HeapWord* watermark) : _watermark(watermark) {}
+  virtual bool do_object_b(oop obj) {
+    return (HeapWord*) obj < _watermark;
+  }
+};
+
+void EpsilonHeap::set_watermark(outputStream* st) {
+  assert(SafepointSynchronize::is_at_safepoint(), "Must be at safepoint");
+
+  // Retire TLABs, so that the watermark also covers their unused tails.
+  ensure_parsability(true);
+
+  _watermark = _space->top();
+  _arena_epoch++;
+
+  log_info(gc)("Arena epoch %u started at " PTR_FORMAT ", " SIZE_FORMAT "%s used",
+               _arena_epoch, p2i(_watermark),
+               byte_size_in_proper_unit(used()), proper_unit_for_byte_size(used()));
+  print_arena_on(st);
+}
+
+bool EpsilonHeap::reset_to_watermark(bool verify, outputStream* st) {
+  assert(SafepointSynchronize::is_at_safepoint(), "Must be at safepoint");
+
+  if (_watermark == NULL) {
+    st->print_cr("No watermark set");
+    return false;
+  }
+
+  ensure_parsability(true);
+
+  HeapWord* top = _space->top();
+  EpsilonArenaRefClosure cl(_watermark, top);
+
+  // Strong roots must not refer to anything allocated since the watermark.
+  {
+    CLDToOopClosure clds(&cl, ClassLoaderData::_claim_none);
+    CodeBlobToOopClosure blobs(&cl, false);
+    Universe::oops_do(&cl);
+    JNIHandles::oops_do(&cl);
+    Threads::oops_do(&cl, &blobs);
+    ObjectSynchronizer::oops_do(&cl);
+    Management::oops_do(&cl);
+    JvmtiExport::oops_do(&cl);
+    SystemDictionary::oops_do(&cl);
+    ClassLoaderDataGraph::cld_do(&clds);
+    CodeCache::blobs_do(&blobs);
+    AOTLoader::oops_do(&cl);
+  }
+  size_t root_refs = cl.refs();
+
+  // Neither should the objects that survive the reset.
+  if (verify) {
+    HeapWord* p = _space->bottom();
+    while (p < _watermark) {
+      oop obj = oop(p);
+      obj->oop_iterate(&cl);
+      p += obj->size();
+    }
+  }
+  size_t heap_refs = cl.refs() - root_refs;
+
+  if (root_refs > 0 || heap_refs > 0) {
+    log_info(gc)("Arena epoch %u reset refused: " SIZE_FORMAT " root, " SIZE_FORMAT " heap references into the arena",
+                 _arena_epoch, root_refs, heap_refs);
+    st->print_cr("Reset refused: " SIZE_FORMAT " root and " SIZE_FORMAT " heap references into the arena",
+                 root_refs, heap_refs);
+    return false;
+  }
+
+  // Weak roots into the arena are cleared.
+  {
+    EpsilonArenaIsAliveClosure is_alive(_watermark);
+    DoNothingClosure do_nothing;
+    WeakProcessor::weak_oops_do(&is_alive, &do_nothing);
+    StringTable::unlink(&is_alive);
+    ResolvedMethodTable::unlink();
+  }
+
+  size_t released = pointer_delta(top, _watermark, 1);
+  _space->set_top(_watermark);
+  if (ZapUnusedHeapArea) {
+    _space->mangle_unused_area();
+  }
+
+  _last_counter_update = used();
+  _last_heap_print = used();
+  _monitoring_support->update_counters();
+
+  log_info(gc)("Arena epoch %u reset, " SIZE_FORMAT "%s released",
+               _arena_epoch,
+               byte_size_in_proper_unit(released), proper_unit_for_byte_size(released));
+  _arena_epoch++;
+  print_arena_on(st);
+  return true;
+}
+
+void EpsilonHeap::print_arena_on(outputStream* st) const {
+  if (_watermark == NULL) {
+    st->print_cr("Arena: no watermark, " SIZE_FORMAT "%s used",
+                 byte_size_in_proper_unit(used()), proper_unit_for_byte_size(used()));
+    return;
+  }
+  size_t arena_used = pointer_delta(_space->top(), _watermark, 1);
+  st->print_cr("Arena: epoch %u, watermark " PTR_FORMAT ", " SIZE_FORMAT "%s used since watermark",
+               _arena_epoch, p2i(_watermark),
+               byte_size_in_proper_unit(arena_used), proper_unit_for_byte_size(arena_used));
+}
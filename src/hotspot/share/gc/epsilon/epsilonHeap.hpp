@@ -50,13 +50,17 @@ private:
   int64_t _decay_time_ns;
   volatile size_t _last_counter_update;
   volatile size_t _last_heap_print;
+  HeapWord* _watermark;
+  uint _arena_epoch;
 
 public:
   static EpsilonHeap* heap();
 
   EpsilonHeap(EpsilonCollectorPolicy* p) :
           _policy(p),
-          _memory_manager("Epsilon Heap", "") {};
+          _memory_manager("Epsilon Heap", ""),
+          _watermark(NULL),
+          _arena_epoch(0) {};
 
   virtual Name kind() const {
     return CollectedHeap::Epsilon;
@@ -148,6 +152,14 @@ public:
   virtual void print_on(outputStream* st) const;
   virtual void print_tracing_info() const;
 
+  // Arena mode, see EpsilonArenaMode. The watermark is the heap top at the
+  // start of an epoch; resetting to it discards everything allocated since.
+  // The reset is refused if strong roots (or, with verify, objects below
+  // the watermark) still refer to those objects. Both run at a safepoint.
+  void set_watermark(outputStream* st);
+  bool reset_to_watermark(bool verify, outputStream* st);
+  void print_arena_on(outputStream* st) const;
+
 private:
   void print_heap_info(size_t used) const;
   void print_metaspace_info() const;
@@ -91,6 +91,12 @@
   experimental(size_t, EpsilonMinHeapExpand, 128 * M,                       \
           "Min expansion step for heap. Larger value improves performance " \
           "at the potential expense of memory waste.")                      \
-          range(1, max_intx)
+          range(1, max_intx)                                                \
+                                                                            \
+  experimental(bool, EpsilonArenaMode, false,                               \
+          "Allow resetting the heap to a watermark set earlier with the "   \
+          "GC.epsilon_arena diagnostic command, discarding all objects "    \
+          "allocated since. The application must guarantee that none of "   \
+          "them is reachable anymore.")
 
 #endif // SHARE_VM_GC_EPSILON_GLOBALS_HPP
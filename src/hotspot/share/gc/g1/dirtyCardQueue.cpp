@@ -32,25 +32,126 @@
 #include "gc/shared/workgroup.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "runtime/orderAccess.hpp"
+#include "runtime/prefetch.inline.hpp"
 #include "runtime/safepoint.hpp"
 #include "runtime/thread.inline.hpp"
 #include "runtime/threadSMR.hpp"
+#include "utilities/quickSort.hpp"
+
+// Refines the cards of a buffer concurrently with the mutator. Cards are
+// first filtered and cleaned in a single pass, sharing a single fence for
+// all of them instead of one per card. The remaining cards are then sorted
+// by address, so that cards of the same region, and cards sharing block
+// offset table and heap cache lines, are refined back to back.
+// Yields via SuspendibleThreadSet after every card.
+class G1RefineBufferedCards : public StackObj {
+  BufferNode* const _node;
+  jbyte** const _node_buffer;
+  const size_t _node_buffer_size;
+  const uint _worker_id;
+  G1RemSet* const _g1rs;
+  G1CardTable* const _ct;
+
+  // Cards are sorted in decreasing address order, which, in contrast to
+  // increasing order, lets the hardware prefetcher follow the scanning of
+  // the objects backwards from the card towards the block start.
+  static inline int compare_card(jbyte* p1, jbyte* p2) {
+    if (p1 > p2) {
+      return -1;
+    } else if (p1 < p2) {
+      return 1;
+    } else {
+      return 0;
+    }
+  }
 
-// Closure used for updating remembered sets and recording references that
-// point into the collection set while the mutator is running.
-// Assumed to be only executed concurrently with the mutator. Yields via
-// SuspendibleThreadSet after every card.
-class G1RefineCardConcurrentlyClosure: public CardTableEntryClosure {
-public:
-  bool do_card_ptr(jbyte* card_ptr, uint worker_i) {
-    G1CollectedHeap::heap()->g1_rem_set()->refine_card_concurrently(card_ptr, worker_i);
+  void sort_cards(size_t start_index) {
+    QuickSort::sort(&_node_buffer[start_index],
+                    _node_buffer_size - start_index,
+                    compare_card,
+                    false);
+  }
 
-    if (SuspendibleThreadSet::should_yield()) {
-      // Caller will actually yield.
-      return false;
+  // Returns the index of the first cleaned card, i.e. a card to refine,
+  // in the buffer. The cards to refine are moved to the end of the buffer.
+  size_t clean_cards() {
+    const size_t start = _node->index();
+    assert(start <= _node_buffer_size, "invariant");
+
+    // Two-fingered compaction: search low to high for a card to keep, and
+    // high to low for a card to discard to replace it with.
+    jbyte** src = &_node_buffer[start];
+    jbyte** dst = &_node_buffer[_node_buffer_size];
+    for ( ; src < dst; ++src) {
+      if (_g1rs->clean_card_before_refine(src)) {
+        while (src < --dst) {
+          if (!_g1rs->clean_card_before_refine(dst)) {
+            *dst = *src;
+            break;
+          }
+        }
+        // If the search for a discard failed, src == dst and the outer loop ends.
+      }
     }
-    // Otherwise, we finished successfully; return true.
-    return true;
+
+    const size_t first_clean = dst - _node_buffer;
+    assert(first_clean >= start && first_clean <= _node_buffer_size, "invariant");
+    return first_clean;
+  }
+
+  void redirty_unrefined_cards(size_t start) {
+    for ( ; start < _node_buffer_size; ++start) {
+      *_node_buffer[start] = G1CardTable::dirty_card_val();
+    }
+  }
+
+  bool refine_cleaned_cards(size_t start_index) {
+    bool result = true;
+    size_t i = start_index;
+    for ( ; i < _node_buffer_size; ++i) {
+      if (SuspendibleThreadSet::should_yield()) {
+        // The remaining cards have been cleaned already; make sure they are
+        // refined later.
+        redirty_unrefined_cards(i);
+        result = false;
+        break;
+      }
+      if (i + 1 < _node_buffer_size) {
+        // Start fetching the heap words covered by the next card.
+        Prefetch::read(_ct->addr_for(_node_buffer[i + 1]), 0);
+      }
+      _g1rs->refine_card_concurrently(_node_buffer[i], _worker_id);
+    }
+    _node->set_index(i);
+    return result;
+  }
+
+public:
+  G1RefineBufferedCards(BufferNode* node, size_t node_buffer_size, uint worker_id) :
+    _node(node),
+    _node_buffer(reinterpret_cast<jbyte**>(BufferNode::make_buffer_from_node(node))),
+    _node_buffer_size(node_buffer_size),
+    _worker_id(worker_id),
+    _g1rs(G1CollectedHeap::heap()->g1_rem_set()),
+    _ct(G1CollectedHeap::heap()->card_table()) { }
+
+  bool refine() {
+    size_t first_clean_index = clean_cards();
+    if (first_clean_index == _node_buffer_size) {
+      _node->set_index(first_clean_index);
+      return true;
+    }
+    // This fence serves two purposes. First, the cards must be cleaned
+    // before processing the contents. Second, we can't proceed with
+    // processing a region until after the read of the region's top in
+    // clean_card_before_refine(), for synchronization with possibly
+    // concurrent humongous object allocation. It's okay that reading
+    // the region's top and type were racy wrto each other. We need both
+    // set, in any order, to proceed.
+    OrderAccess::fence();
+    sort_cards(first_clean_index);
+    return refine_cleaned_cards(first_clean_index);
   }
 };
 
@@ -207,12 +308,16 @@ bool DirtyCardQueueSet::apply_closure_to_buffer(CardTableEntryClosure* cl,
   } while (0)
 #endif // ASSERT
 
+bool DirtyCardQueueSet::refine_buffer(BufferNode* node, uint worker_i) {
+  G1RefineBufferedCards buffered_cards(node, buffer_size(), worker_i);
+  return buffered_cards.refine();
+}
+
 bool DirtyCardQueueSet::mut_process_buffer(BufferNode* node) {
   guarantee(_free_ids != NULL, "must be");
 
   uint worker_i = _free_ids->claim_par_id(); // temporarily claim an id
-  G1RefineCardConcurrentlyClosure cl;
-  bool result = apply_closure_to_buffer(&cl, node, true, worker_i);
+  bool result = refine_buffer(node, worker_i);
   _free_ids->release_par_id(worker_i); // release the id
 
   if (result) {
@@ -247,8 +352,21 @@ BufferNode* DirtyCardQueueSet::get_completed_buffer(size_t stop_at) {
 }
 
 bool DirtyCardQueueSet::refine_completed_buffer_concurrently(uint worker_i, size_t stop_at) {
-  G1RefineCardConcurrentlyClosure cl;
-  return apply_closure_to_completed_buffer(&cl, worker_i, stop_at, false);
+  BufferNode* nd = get_completed_buffer(stop_at);
+  if (nd == NULL) {
+    return false;
+  } else {
+    if (refine_buffer(nd, worker_i)) {
+      assert_fully_consumed(nd, buffer_size());
+      // Done with fully processed buffer.
+      deallocate_buffer(nd);
+      Atomic::inc(&_processed_buffers_rs_thread);
+    } else {
+      // Return partially processed buffer to the queue.
+      enqueue_complete_buffer(nd);
+    }
+    return true;
+  }
 }
 
 bool DirtyCardQueueSet::apply_closure_during_gc(CardTableEntryClosure* cl, uint worker_i) {
@@ -99,6 +99,12 @@ class DirtyCardQueueSet: public PtrQueueSet {
                                          size_t stop_at,
                                          bool during_pause);
 
+  // Refine the cards of "node" from its index to buffer_size concurrently
+  // with the mutator. Returns true if all cards were refined. Otherwise
+  // refinement was stopped for a yield request, and the node's index is
+  // updated to exclude the processed cards.
+  bool refine_buffer(BufferNode* node, uint worker_i);
+
   bool mut_process_buffer(BufferNode* node);
 
   // Protected by the _cbl_mon.
@@ -131,8 +137,7 @@ public:
 
   static void handle_zero_index_for_thread(JavaThread* t);
 
-  // Apply G1RefineCardConcurrentlyClosure to completed buffers until there are stop_at
-  // completed buffers remaining.
+  // Refine completed buffers until there are stop_at completed buffers remaining.
   bool refine_completed_buffer_concurrently(uint worker_i, size_t stop_at);
 
   // Apply the given closure to all completed buffers. The given closure's do_card_ptr
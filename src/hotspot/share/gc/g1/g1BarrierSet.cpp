@@ -117,6 +117,11 @@ void G1BarrierSet::invalidate(MemRegion mr) {
   if (mr.is_empty()) {
     return;
   }
+  // Only humongous objects span regions, and those are never young. So a
+  // range starting in a young region has only young cards; skip the scan.
+  if (G1CollectedHeap::heap()->heap_region_containing(mr.start())->is_young()) {
+    return;
+  }
   volatile jbyte* byte = _card_table->byte_for(mr.start());
   jbyte* last_byte = _card_table->byte_for(mr.last());
   Thread* thr = Thread::current();
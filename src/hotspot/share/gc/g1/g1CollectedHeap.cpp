@@ -65,6 +65,7 @@
 #include "gc/shared/gcHeapSummary.hpp"
 #include "gc/shared/gcId.hpp"
 #include "gc/shared/gcLocker.hpp"
+#include "gc/shared/gcLocker.inline.hpp"
 #include "gc/shared/gcTimer.hpp"
 #include "gc/shared/gcTrace.hpp"
 #include "gc/shared/gcTraceTime.inline.hpp"
@@ -76,7 +77,7 @@
 #include "gc/shared/suspendibleThreadSet.hpp"
 #include "gc/shared/referenceProcessor.inline.hpp"
 #include "gc/shared/taskqueue.inline.hpp"
-#include "gc/shared/weakProcessor.hpp"
+#include "gc/shared/weakProcessor.inline.hpp"
 #include "logging/log.hpp"
 #include "memory/allocation.hpp"
 #include "memory/iterator.hpp"
@@ -88,6 +89,7 @@
 #include "oops/oop.inline.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/flags/flagSetting.hpp"
+#include "runtime/globals_extension.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/init.hpp"
 #include "runtime/orderAccess.hpp"
@@ -161,12 +163,15 @@ HeapRegion* G1CollectedHeap::new_heap_region(uint hrs_index,
 
 // Private methods.
 
-HeapRegion* G1CollectedHeap::new_region(size_t word_size, bool is_old, bool do_expand) {
+HeapRegion* G1CollectedHeap::new_region(size_t word_size,
+                                        bool is_old,
+                                        bool do_expand,
+                                        uint node_index) {
   assert(!is_humongous(word_size) || word_size <= HeapRegion::GrainWords,
          "the only time we use this to allocate a humongous region is "
          "when we are allocating a single humongous region");
 
-  HeapRegion* res = _hrm.allocate_free_region(is_old);
+  HeapRegion* res = _hrm.allocate_free_region(is_old, node_index);
 
   if (res == NULL && do_expand && _expand_heap_after_alloc_failure) {
     // Currently, only attempts to allocate GC alloc regions set
@@ -183,7 +188,7 @@ HeapRegion* G1CollectedHeap::new_region(size_t word_size, bool is_old, bool do_e
       // always expand the heap by an amount aligned to the heap
       // region size, the free list should in theory not be empty.
       // In either case allocate_free_region() will check for NULL.
-      res = _hrm.allocate_free_region(is_old);
+      res = _hrm.allocate_free_region(is_old, node_index);
     } else {
       _expand_heap_after_alloc_failure = false;
     }
@@ -1172,7 +1177,8 @@ void G1CollectedHeap::resize_heap_if_necessary() {
   const double minimum_used_percentage = 1.0 - maximum_free_percentage;
 
   const size_t min_heap_size = collector_policy()->min_heap_byte_size();
-  const size_t max_heap_size = collector_policy()->max_heap_byte_size();
+  // Shrink towards and do not grow beyond the soft maximum heap size.
+  const size_t max_heap_size = soft_max_capacity();
 
   // We have to be careful here as these two calculations can overflow
   // 32-bit size_t's.
@@ -1465,6 +1471,9 @@ G1CollectedHeap::G1CollectedHeap(G1CollectorPolicy* collector_policy) :
   _workers->initialize_workers();
   _verifier = new G1HeapVerifier(this);
 
+  // The NUMA topology must be known before creating the per-node allocation regions.
+  G1NUMA::create();
+
   _allocator = new G1Allocator(this);
 
   _heap_sizing_policy = G1HeapSizingPolicy::create(this, _g1_policy->analytics());
@@ -1589,6 +1598,7 @@ jint G1CollectedHeap::initialize() {
   // Carve out the G1 part of the heap.
   ReservedSpace g1_rs = heap_rs.first_part(max_byte_size);
   size_t page_size = UseLargePages ? os::large_page_size() : os::vm_page_size();
+  G1NUMA::numa()->set_region_info(HeapRegion::GrainBytes, page_size);
   G1RegionToSpaceMapper* heap_storage =
     G1RegionToSpaceMapper::create_mapper(g1_rs,
                                          g1_rs.size(),
@@ -2132,6 +2142,27 @@ void G1CollectedHeap::object_iterate(ObjectClosure* cl) {
   heap_region_iterate(&blk);
 }
 
+class SampledObjectClosureRegionClosure: public HeapRegionClosure {
+  ObjectClosure* _cl;
+  uint _sample_rate;
+public:
+  SampledObjectClosureRegionClosure(ObjectClosure* cl, uint sample_rate) :
+    _cl(cl), _sample_rate(sample_rate) {}
+  bool do_heap_region(HeapRegion* r) {
+    if (r->hrm_index() % _sample_rate == 0 && !r->is_continues_humongous()) {
+      r->object_iterate(_cl);
+    }
+    return false;
+  }
+};
+
+bool G1CollectedHeap::sampled_object_iterate(ObjectClosure* cl, uint sample_rate) {
+  assert(sample_rate > 0, "invariant");
+  SampledObjectClosureRegionClosure blk(cl, sample_rate);
+  heap_region_iterate(&blk);
+  return true;
+}
+
 class G1ParallelObjectIterator : public ParallelObjectIterator {
 private:
   G1CollectedHeap*  _heap;
@@ -2224,6 +2255,26 @@ size_t G1CollectedHeap::max_capacity() const {
   return _hrm.reserved().byte_size();
 }
 
+size_t G1CollectedHeap::soft_max_capacity() const {
+  // G1SoftMaxHeapSize is manageable and can change at any time.
+  size_t soft_max = G1SoftMaxHeapSize;
+  if (soft_max == 0) {
+    return max_capacity();
+  }
+  soft_max = align_up(soft_max, HeapRegion::GrainBytes);
+  soft_max = MAX2(soft_max, collector_policy()->min_heap_byte_size());
+  return MIN2(soft_max, max_capacity());
+}
+
+bool G1CollectedHeap::update_soft_max_heap_size(size_t soft_max_heap_size) {
+  if (!FLAG_IS_DEFAULT(G1SoftMaxHeapSize) && !FLAG_IS_ERGO(G1SoftMaxHeapSize)) {
+    // Set by the user, which takes precedence.
+    return false;
+  }
+  FLAG_SET_ERGO(size_t, G1SoftMaxHeapSize, soft_max_heap_size);
+  return true;
+}
+
 jlong G1CollectedHeap::millis_since_last_gc() {
   // See the notes in GenCollectedHeap::millis_since_last_gc()
   // for more information about the implementation.
@@ -2265,6 +2316,22 @@ bool G1CollectedHeap::request_concurrent_phase(const char* phase) {
   return _cm_thread->request_concurrent_phase(phase);
 }
 
+oop G1CollectedHeap::pin_object(JavaThread* thread, oop obj) {
+  if (heap_region_containing(obj)->is_humongous()) {
+    return obj;
+  }
+  // Locking may block for a GC that moves the object.
+  Handle h(thread, obj);
+  GCLocker::lock_critical(thread);
+  return h();
+}
+
+void G1CollectedHeap::unpin_object(JavaThread* thread, oop obj) {
+  if (!heap_region_containing(obj)->is_humongous()) {
+    GCLocker::unlock_critical(thread);
+  }
+}
+
 class PrintRegionClosure: public HeapRegionClosure {
   outputStream* _st;
 public:
@@ -2607,10 +2674,14 @@ class RegisterHumongousWithInCSetFastTestClosure : public HeapRegionClosure {
     // structures don't support efficiently performing the needed
     // additional tests or scrubbing of the mark stack.
     //
-    // However, we presently only nominate is_typeArray() objects.
-    // A humongous object containing references induces remembered
-    // set entries on other regions.  In order to reclaim such an
-    // object, those remembered sets would need to be cleaned up.
+    // Humongous objects containing references are only nominated
+    // while no concurrent mark or remembered set rebuild is in progress,
+    // and only if G1EagerReclaimHumongousObjArrays is set. Such objects
+    // induce remembered set entries on other regions. We leave them in
+    // place: after the region is freed they are stale, and stale
+    // entries are handled like the ones left behind by any other freed
+    // region: cards in free or young regions are skipped, and cards in
+    // regions allocated later are only scanned up to scan_top.
     //
     // We also treat is_typeArray() objects specially, allowing them
     // to be reclaimed even if allocated before the start of
@@ -2622,7 +2693,11 @@ class RegisterHumongousWithInCSetFastTestClosure : public HeapRegionClosure {
     // important use case for eager reclaim, and this special handling
     // may reduce needed headroom.
 
-    return obj->is_typeArray() &&
+    bool allowed_type = obj->is_typeArray() ||
+                        (G1EagerReclaimHumongousObjArrays &&
+                         obj->is_objArray() &&
+                         !g1h->collector_state()->mark_or_rebuild_in_progress());
+    return allowed_type &&
            g1h->is_potential_eager_reclaim_candidate(region);
   }
 
@@ -2883,8 +2958,7 @@ G1CollectedHeap::do_collection_pause_at_safepoint(double target_pause_time_ms) {
     }
     GCTraceTime(Info, gc) tm(gc_string, NULL, gc_cause(), true);
 
-    uint active_workers = AdaptiveSizePolicy::calc_active_workers(workers()->total_workers(),
-                                                                  workers()->active_workers(),
+    uint active_workers = AdaptiveSizePolicy::calc_active_workers(workers(),
                                                                   Threads::number_of_non_daemon_threads());
     active_workers = workers()->update_active_workers(active_workers);
     log_info(gc,task)("Using %u workers of %u for evacuation", active_workers, workers()->total_workers());
@@ -3037,6 +3111,10 @@ G1CollectedHeap::do_collection_pause_at_safepoint(double target_pause_time_ms) {
 
         {
           size_t expand_bytes = _heap_sizing_policy->expansion_amount();
+          // Expansion to satisfy allocations may still go beyond the
+          // soft maximum heap size, but GC time driven expansion does not.
+          const size_t soft_max = soft_max_capacity();
+          expand_bytes = capacity() < soft_max ? MIN2(expand_bytes, soft_max - capacity()) : 0;
           if (expand_bytes > 0) {
             size_t bytes_before = capacity();
             // No need for an ergo logging here,
@@ -3212,6 +3290,7 @@ public:
 
       G1ParScanThreadState*           pss = _pss->state_for_worker(worker_id);
       pss->set_ref_discoverer(rp);
+      pss->set_terminator(_terminator.terminator());
 
       double start_strong_roots_sec = os::elapsedTime();
 
@@ -3243,6 +3322,7 @@ public:
       }
 
       assert(pss->queue_is_empty(), "should be empty");
+      pss->set_terminator(NULL);
 
       if (log_is_enabled(Debug, gc, task, stats)) {
         MutexLockerEx x(ParGCRareEvent_lock, Mutex::_no_safepoint_check_flag);
@@ -3824,7 +3904,7 @@ void G1CollectedHeap::evacuate_optional_collection_set(G1ParScanThreadStateSet*
     double time_used_ms = os::elapsedTime() * 1000.0 - gc_start_time_ms;
     double time_left_ms = MaxGCPauseMillis - time_used_ms;
 
-    if (time_left_ms < 0) {
+    if (time_left_ms <= 0) {
       log_trace(gc, ergo, cset)("Skipping %u optional regions, pause time exceeded %.3fms", optional_cset.size(), time_used_ms);
       break;
     }
@@ -3835,7 +3915,11 @@ void G1CollectedHeap::evacuate_optional_collection_set(G1ParScanThreadStateSet*
       break;
     }
 
+    double increment_start_sec = os::elapsedTime();
     evacuate_optional_regions(per_thread_states, &optional_cset);
+    log_debug(gc, ergo, cset)("Evacuated %u optional regions in %.3fms, time left before increment %.3fms",
+                              optional_cset.current_limit() - optional_cset.current_index(),
+                              (os::elapsedTime() - increment_start_sec) * 1000.0, time_left_ms);
 
     optional_cset.complete_evacuation();
     if (optional_cset.evacuation_failed()) {
@@ -3866,14 +3950,8 @@ void G1CollectedHeap::post_evacuate_collection_set(EvacuationInfo& evacuation_in
   G1STWIsAliveClosure is_alive(this);
   G1KeepAliveClosure keep_alive(this);
 
-  {
-    double start = os::elapsedTime();
-
-    WeakProcessor::weak_oops_do(&is_alive, &keep_alive);
-
-    double time_ms = (os::elapsedTime() - start) * 1000.0;
-    g1_policy()->phase_times()->record_weak_ref_proc_time(time_ms);
-  }
+  WeakProcessor::weak_oops_do(workers(), &is_alive, &keep_alive,
+                              g1_policy()->phase_times()->weak_phase_times());
 
   if (G1StringDedup::is_enabled()) {
     double fixup_start = os::elapsedTime();
@@ -4305,10 +4383,9 @@ class G1FreeHumongousRegionClosure : public HeapRegionClosure {
     // are completely up-to-date wrt to references to the humongous object.
     //
     // Other implementation considerations:
-    // - never consider object arrays at this time because they would pose
-    // considerable effort for cleaning up the the remembered sets. This is
-    // required because stale remembered sets might reference locations that
-    // are currently allocated into.
+    // - object arrays are only considered if they were nominated outside of
+    // concurrent mark and remembered set rebuild; see
+    // humongous_region_is_candidate() for why this is sufficient.
     uint region_idx = r->hrm_index();
     if (!g1h->is_humongous_reclaim_candidate(region_idx) ||
         !r->rem_set()->is_empty()) {
@@ -4325,8 +4402,8 @@ class G1FreeHumongousRegionClosure : public HeapRegionClosure {
       return false;
     }
 
-    guarantee(obj->is_typeArray(),
-              "Only eagerly reclaiming type arrays is supported, but the object "
+    guarantee(obj->is_typeArray() || (G1EagerReclaimHumongousObjArrays && obj->is_objArray()),
+              "Only eagerly reclaiming type arrays and object arrays is supported, but the object "
               PTR_FORMAT " is not.", p2i(r->bottom()));
 
     log_debug(gc, humongous)("Dead humongous region %u object size " SIZE_FORMAT " start " PTR_FORMAT " with remset " SIZE_FORMAT " code roots " SIZE_FORMAT " is marked %d reclaim candidate %d type array %d",
@@ -4597,13 +4674,15 @@ bool G1CollectedHeap::is_in_closed_subset(const void* p) const {
 // Methods for the mutator alloc region
 
 HeapRegion* G1CollectedHeap::new_mutator_alloc_region(size_t word_size,
-                                                      bool force) {
+                                                      bool force,
+                                                      uint node_index) {
   assert_heap_locked_or_at_safepoint(true /* should_be_vm_thread */);
   bool should_allocate = g1_policy()->should_allocate_mutator_region();
   if (force || should_allocate) {
     HeapRegion* new_alloc_region = new_region(word_size,
                                               false /* is_old */,
-                                              false /* do_expand */);
+                                              false /* do_expand */,
+                                              node_index);
     if (new_alloc_region != NULL) {
       set_region_short_lived_locked(new_alloc_region);
       _hr_printer.alloc(new_alloc_region, !should_allocate);
@@ -4639,7 +4718,7 @@ bool G1CollectedHeap::has_more_regions(InCSetState dest) {
   }
 }
 
-HeapRegion* G1CollectedHeap::new_gc_alloc_region(size_t word_size, InCSetState dest) {
+HeapRegion* G1CollectedHeap::new_gc_alloc_region(size_t word_size, InCSetState dest, uint node_index) {
   assert(FreeList_lock->owned_by_self(), "pre-condition");
 
   if (!has_more_regions(dest)) {
@@ -4650,7 +4729,8 @@ HeapRegion* G1CollectedHeap::new_gc_alloc_region(size_t word_size, InCSetState d
 
   HeapRegion* new_alloc_region = new_region(word_size,
                                             !is_survivor,
-                                            true /* do_expand */);
+                                            true /* do_expand */,
+                                            node_index);
   if (new_alloc_region != NULL) {
     if (is_survivor) {
       new_alloc_region->set_survivor();
@@ -4816,18 +4896,23 @@ GrowableArray<MemoryPool*> G1CollectedHeap::memory_pools() {
   return memory_pools;
 }
 
-void G1CollectedHeap::free_heap_physical_memory_after_fullgc() {
+void G1CollectedHeap::free_heap_physical_memory() {
   assert(SafepointSynchronize::is_at_safepoint(), "must be at a safepoint");
   double start_sec = os::elapsedTime();
   size_t num_free_regions = _hrm.num_free_regions();
   size_t max_young_region_num = _g1_policy->young_list_target_length();
   size_t current_young_region_num = heap()->eden_regions_count() + heap()->survivor_regions_count();
-  size_t diff = max_young_region_num - current_young_region_num;
-  size_t old_heap_region_num = num_free_regions - diff;
-  if (old_heap_region_num <= 0) {
+  // Keep enough free regions to satisfy the young gen target.
+  size_t young_reserve_region_num = max_young_region_num > current_young_region_num ?
+                                    max_young_region_num - current_young_region_num : 0;
+  if (num_free_regions <= young_reserve_region_num) {
     return;
   }
+  size_t old_heap_region_num = num_free_regions - young_reserve_region_num;
   size_t reclaim_region_num = old_heap_region_num * G1FreeOldMemoryThresholdPercentAfterFullGC / 100;
+  if (reclaim_region_num == 0) {
+    return;
+  }
   size_t shrink_bytes = reclaim_region_num * HeapRegion::GrainBytes;
   shrink(shrink_bytes);
   log_debug(gc, heap)("Attempt heap shrinking, shrink_bytes: " SIZE_FORMAT " time: %6.3fs", shrink_bytes, os::elapsedTime() - start_sec);
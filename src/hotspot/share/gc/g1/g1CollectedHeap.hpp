@@ -41,6 +41,7 @@
 #include "gc/g1/g1HRPrinter.hpp"
 #include "gc/g1/g1InCSetState.hpp"
 #include "gc/g1/g1MonitoringSupport.hpp"
+#include "gc/g1/g1NUMA.hpp"
 #include "gc/g1/g1SurvivorRegions.hpp"
 #include "gc/g1/g1YCTypes.hpp"
 #include "gc/g1/heapRegionManager.hpp"
@@ -384,8 +385,12 @@ private:
   // an allocation of the given word_size. If do_expand is true,
   // attempt to expand the heap if necessary to satisfy the allocation
   // request. If the region is to be used as an old region or for a
-  // humongous object, set is_old to true. If not, to false.
-  HeapRegion* new_region(size_t word_size, bool is_old, bool do_expand);
+  // humongous object, set is_old to true. If not, to false. A region
+  // on the NUMA node given by node_index is preferred, if available.
+  HeapRegion* new_region(size_t word_size,
+                         bool is_old,
+                         bool do_expand,
+                         uint node_index = G1NUMA::AnyNodeIndex);
 
   // Initialize a contiguous set of free regions of length num_regions
   // and starting at index first so that they appear as a single
@@ -460,13 +465,13 @@ private:
   // These methods are the "callbacks" from the G1AllocRegion class.
 
   // For mutator alloc regions.
-  HeapRegion* new_mutator_alloc_region(size_t word_size, bool force);
+  HeapRegion* new_mutator_alloc_region(size_t word_size, bool force, uint node_index);
   void retire_mutator_alloc_region(HeapRegion* alloc_region,
                                    size_t allocated_bytes);
 
   // For GC alloc regions.
   bool has_more_regions(InCSetState dest);
-  HeapRegion* new_gc_alloc_region(size_t word_size, InCSetState dest);
+  HeapRegion* new_gc_alloc_region(size_t word_size, InCSetState dest, uint node_index);
   void retire_gc_alloc_region(HeapRegion* alloc_region,
                               size_t allocated_bytes, InCSetState dest);
 
@@ -541,6 +546,10 @@ public:
 
   void resize_heap_if_necessary();
 
+  // Uncommit the heap memory of free regions not needed for the young gen
+  // after a full gc or a periodic concurrent cycle.
+  void free_heap_physical_memory();
+
   // Expand the garbage-first heap by at least the given size (in bytes!).
   // Returns true if the heap was expanded by the requested amount;
   // false otherwise.
@@ -778,9 +787,6 @@ private:
   // statistics or updating free lists.
   void abandon_collection_set(G1CollectionSet* collection_set);
 
-  // Uncommit the heap memory after full gc
-  void free_heap_physical_memory_after_fullgc();
-
   // The concurrent marker (and the thread it runs in.)
   G1ConcurrentMark* _cm;
   G1ConcurrentMarkThread* _cm_thread;
@@ -1138,6 +1144,9 @@ public:
     object_iterate(cl);
   }
 
+  // Iterates over the objects starting in every sample_rate'th region.
+  virtual bool sampled_object_iterate(ObjectClosure* cl, uint sample_rate);
+
   virtual ParallelObjectIterator* parallel_object_iterator(uint thread_num);
 
   // Keep alive an object that was loaded with AS_NO_KEEPALIVE.
@@ -1249,6 +1258,11 @@ public:
   // Print the maximum heap capacity.
   virtual size_t max_capacity() const;
 
+  // The committed heap size G1 tries to stay below, see G1SoftMaxHeapSize.
+  size_t soft_max_capacity() const;
+
+  virtual bool update_soft_max_heap_size(size_t soft_max_heap_size);
+
   virtual jlong millis_since_last_gc();
 
 
@@ -1394,6 +1408,13 @@ public:
 
   virtual WorkGang* get_safepoint_workers() { return _workers; }
 
+  // JNI critical sections on humongous objects pin them in place, since
+  // humongous objects are never moved. Any other object may be evacuated
+  // by the next pause, so pinning it falls back to the GCLocker.
+  virtual bool supports_object_pinning() const { return true; }
+  virtual oop pin_object(JavaThread* thread, oop obj);
+  virtual void unpin_object(JavaThread* thread, oop obj);
+
   // The methods below are here for convenience and dispatch the
   // appropriate method depending on value of the given VerifyOption
   // parameter. The values for that parameter, and their meanings,
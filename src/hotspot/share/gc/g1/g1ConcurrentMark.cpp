@@ -375,6 +375,7 @@ G1ConcurrentMark::G1ConcurrentMark(G1CollectedHeap* g1h,
   _concurrent(false),
   _has_aborted(false),
   _restart_for_overflow(false),
+  _started_by_periodic_gc(false),
   _gc_timer_cm(new (ResourceObj::C_HEAP, mtGC) ConcurrentGCTimer()),
   _gc_tracer_cm(new (ResourceObj::C_HEAP, mtGC) G1OldTracer()),
 
@@ -634,9 +635,17 @@ private:
       HeapWord* cur = r->bottom();
       HeapWord* const end = r->end();
 
+      // Nothing has been marked in this region since the bitmap has last been
+      // cleared, e.g. the region has been free or young all the time.
+      if (_bitmap->is_region_clear(r->hrm_index())) {
+        assert(_bitmap->get_next_marked_addr(cur, end) == end,
+               "Region %u is supposed to have a clear bitmap", r->hrm_index());
+        return false;
+      }
+
       while (cur < end) {
-        MemRegion mr(cur, MIN2(cur + chunk_size_in_words, end));
-        _bitmap->clear_range(mr);
+        HeapWord* const chunk_end = MIN2(cur + chunk_size_in_words, end);
+        _bitmap->clear_region_chunk(r, MemRegion(cur, chunk_end), chunk_end == end);
 
         cur += chunk_size_in_words;
 
@@ -772,6 +781,8 @@ void G1ConcurrentMark::post_initial_mark() {
 
   _root_regions.prepare_for_scan();
 
+  _started_by_periodic_gc = (_g1h->gc_cause() == GCCause::_g1_periodic_collection);
+
   // update_g1_committed() will be called at the end of an evac pause
   // when marking is on. So, it's also called at the end of the
   // initial-mark pause to update the heap end, if the heap expands
@@ -1203,6 +1214,12 @@ void G1ConcurrentMark::remark() {
 
     _g1h->resize_heap_if_necessary();
 
+    // A periodic cycle is only started when the application is mostly idle,
+    // so give back the memory of free old regions without waiting for a Full GC.
+    if (_started_by_periodic_gc && FreeHeapPhysicalMemory) {
+      _g1h->free_heap_physical_memory();
+    }
+
     compute_new_sizes();
 
     verify_during_pause(G1HeapVerifier::G1VerifyRemark, VerifyOption_G1UsePrevMarking, "Remark after");
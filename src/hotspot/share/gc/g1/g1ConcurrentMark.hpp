@@ -350,6 +350,10 @@ class G1ConcurrentMark : public CHeapObj<mtGC> {
   // another concurrent marking phase should start
   volatile bool           _restart_for_overflow;
 
+  // True if the current marking cycle was started by a periodic collection,
+  // in which case free regions are uncommitted more aggressively at remark.
+  bool                    _started_by_periodic_gc;
+
   ConcurrentGCTimer*      _gc_timer_cm;
 
   G1OldTracer*            _gc_tracer_cm;
@@ -45,16 +45,30 @@ void G1CMBitMap::initialize(MemRegion heap, G1RegionToSpaceMapper* storage) {
 
   _bm = BitMapView((BitMap::bm_word_t*) storage->reserved().start(), _covered.word_size() >> _shifter);
 
+  // Uncommitted regions are not known to be clear; committing them will do so.
+  size_t const max_regions = _covered.word_size() >> HeapRegion::LogOfHRGrainWords;
+  _log_region_size_in_words = (uint)HeapRegion::LogOfHRGrainWords;
+  _region_clear = NEW_C_HEAP_ARRAY(bool, max_regions, mtGC);
+  for (size_t i = 0; i < max_regions; i++) {
+    _region_clear[i] = false;
+  }
+
   storage->set_mapping_changed_listener(&_listener);
 }
 
+void G1CMBitMap::set_regions_clear(uint start_region, size_t num_regions) {
+  for (size_t i = start_region; i < start_region + num_regions; i++) {
+    _region_clear[i] = true;
+  }
+}
+
 void G1CMBitMapMappingChangedListener::on_commit(uint start_region, size_t num_regions, bool zero_filled) {
-  if (zero_filled) {
-    return;
+  if (!zero_filled) {
+    // We need to clear the bitmap on commit, removing any existing information.
+    MemRegion mr(G1CollectedHeap::heap()->bottom_addr_for_region(start_region), num_regions * HeapRegion::GrainWords);
+    _bm->clear_range(mr);
   }
-  // We need to clear the bitmap on commit, removing any existing information.
-  MemRegion mr(G1CollectedHeap::heap()->bottom_addr_for_region(start_region), num_regions * HeapRegion::GrainWords);
-  _bm->clear_range(mr);
+  _bm->set_regions_clear(start_region, num_regions);
 }
 
 void G1CMBitMap::clear_range(MemRegion mr) {
@@ -67,6 +81,16 @@ void G1CMBitMap::clear_range(MemRegion mr) {
                    addr_to_offset(intersection.end()), false);
 }
 
+void G1CMBitMap::clear_region_chunk(HeapRegion* hr, MemRegion chunk, bool last_chunk) {
+  assert(hr->bottom() <= chunk.start() && chunk.end() <= hr->end(),
+         "Chunk [" PTR_FORMAT ", " PTR_FORMAT ") must be within region %u",
+         p2i(chunk.start()), p2i(chunk.end()), hr->hrm_index());
+  _bm.clear_large_range_nontemporal(addr_to_offset(chunk.start()), addr_to_offset(chunk.end()));
+  if (last_chunk) {
+    _region_clear[hr->hrm_index()] = true;
+  }
+}
+
 void G1CMBitMap::clear_region(HeapRegion* region) {
  if (!region->is_empty()) {
    MemRegion mr(region->bottom(), region->top());
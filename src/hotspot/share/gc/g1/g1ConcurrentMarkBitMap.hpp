@@ -66,10 +66,20 @@ class G1CMBitMap {
 
   BitMapView _bm;        // The actual bitmap.
 
+  // Per region flag that is true if the part of the bitmap covering that region
+  // is known to contain no marks. Only ever set when the complete range for the
+  // region has been cleared, and reset by any mark into the region, so clearing
+  // can skip regions that have not been marked through since the last clear.
+  bool* _region_clear;
+  uint _log_region_size_in_words; // Shift amount from heap word index to region index.
+
   G1CMBitMapMappingChangedListener _listener;
 
   inline void check_mark(HeapWord* addr) NOT_DEBUG_RETURN;
 
+  // Record that there may be marks in the region containing addr.
+  inline void note_marked(HeapWord* addr);
+
   // Convert from bit offset to address.
   HeapWord* offset_to_addr(size_t offset) const {
     return _covered.start() + (offset << _shifter);
@@ -88,7 +98,7 @@ public:
     return mark_distance();
   }
 
-  G1CMBitMap() : _covered(), _bm(), _shifter(LogMinObjAlignment), _listener() { _listener.set_bitmap(this); }
+  G1CMBitMap() : _covered(), _bm(), _shifter(LogMinObjAlignment), _region_clear(NULL), _log_region_size_in_words(0), _listener() { _listener.set_bitmap(this); }
 
   // Initializes the underlying BitMap to cover the given area.
   void initialize(MemRegion heap, G1RegionToSpaceMapper* storage);
@@ -122,6 +132,16 @@ public:
 
   void clear_range(MemRegion mr);
   void clear_region(HeapRegion* hr);
+
+  // Returns whether the bitmap is known to have no marks for the given region.
+  bool is_region_clear(uint region) const { return _region_clear[region]; }
+  // Records that the bitmap for the given regions has just been cleared.
+  void set_regions_clear(uint start_region, size_t num_regions);
+  // Clears the part of the bitmap covering the given chunk of the region using
+  // non-temporal stores where available, to avoid polluting the caches of the
+  // running application. If "last_chunk" is set, the whole region is clear
+  // afterwards.
+  void clear_region_chunk(HeapRegion* hr, MemRegion chunk, bool last_chunk);
 };
 
 #endif // SHARE_VM_GC_G1_G1CONCURRENTMARKBITMAP_HPP
@@ -68,9 +68,18 @@ inline void G1CMBitMap::check_mark(HeapWord* addr) {
 }
 #endif
 
+inline void G1CMBitMap::note_marked(HeapWord* addr) {
+  size_t const region = pointer_delta(addr, _covered.start()) >> _log_region_size_in_words;
+  // Avoid writing to the shared flag array if not necessary.
+  if (_region_clear[region]) {
+    _region_clear[region] = false;
+  }
+}
+
 inline void G1CMBitMap::mark(HeapWord* addr) {
   check_mark(addr);
   _bm.set_bit(addr_to_offset(addr));
+  note_marked(addr);
 }
 
 inline void G1CMBitMap::clear(HeapWord* addr) {
@@ -80,7 +89,11 @@ inline void G1CMBitMap::clear(HeapWord* addr) {
 
 inline bool G1CMBitMap::par_mark(HeapWord* addr) {
   check_mark(addr);
-  return _bm.par_set_bit(addr_to_offset(addr));
+  bool const result = _bm.par_set_bit(addr_to_offset(addr));
+  if (result) {
+    note_marked(addr);
+  }
+  return result;
 }
 
 inline bool G1CMBitMap::par_mark(oop obj) {
@@ -30,6 +30,7 @@
 #include "memory/allocation.inline.hpp"
 #include "memory/iterator.hpp"
 #include "runtime/java.hpp"
+#include "runtime/os.hpp"
 #include "runtime/thread.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/globalDefinitions.hpp"
@@ -223,7 +224,10 @@ G1ConcurrentRefine::G1ConcurrentRefine(size_t green_zone,
   _green_zone(green_zone),
   _yellow_zone(yellow_zone),
   _red_zone(red_zone),
-  _min_yellow_zone_size(min_yellow_zone_size)
+  _min_yellow_zone_size(min_yellow_zone_size),
+  _active_threads_limit(max_num_threads()),
+  _available_processors(0),
+  _system_load(-1.0)
 {
   assert_zone_constraints_gyr(green_zone, yellow_zone, red_zone);
 }
@@ -376,6 +380,53 @@ void G1ConcurrentRefine::update_zones(double update_rs_time,
             _green_zone, _yellow_zone, _red_zone);
 }
 
+// Number of refinement threads that could run without competing with the
+// mutator for processors. os::active_processor_count() takes container
+// quotas and cpu sets into account.
+static uint calc_idle_processors(uint available_processors, double system_load) {
+  if (system_load < 0.0) {
+    // Unknown load, do not restrict refinement.
+    return G1ConcurrentRefine::max_num_threads();
+  }
+  double idle = (double)available_processors - system_load;
+  return idle < 1.0 ? 0 : (uint)idle;
+}
+
+void G1ConcurrentRefine::update_active_threads_limit(double update_rs_time, double goal_ms) {
+  uint max_threads = max_num_threads();
+  if (max_threads == 0) {
+    return;
+  }
+
+  _available_processors = (uint)os::active_processor_count();
+  if (os::loadavg(&_system_load, 1) != 1) {
+    _system_load = -1.0;
+  }
+  uint idle = calc_idle_processors(_available_processors, _system_load);
+  // At least one thread must be able to run so that the refinement zones
+  // keep being processed before the mutator hits the red zone.
+  uint target = MAX2(MIN2(idle, max_threads), 1u);
+
+  uint limit = _active_threads_limit;
+  if (update_rs_time > goal_ms) {
+    // Refinement falls behind and the pause pays for it; allow one more thread
+    // even without idle processors.
+    limit = MIN2(MAX2(limit + 1, target), max_threads);
+  } else if (limit > target) {
+    limit--;
+  } else if (limit < target) {
+    limit++;
+  }
+
+  log_debug( CTRL_TAGS )("Updated Active Refinement Threads Limit: %u (was %u), max: %u, "
+                         "processors: %u, system load: %.2f, idle processors: %u, "
+                         "update_rs time: %.3fms, update_rs goal time: %.3fms",
+                         limit, _active_threads_limit, max_threads,
+                         _available_processors, _system_load, idle,
+                         update_rs_time, goal_ms);
+  _active_threads_limit = limit;
+}
+
 void G1ConcurrentRefine::adjust(double update_rs_time,
                                 size_t update_rs_processed_buffers,
                                 double goal_ms) {
@@ -383,6 +434,9 @@ void G1ConcurrentRefine::adjust(double update_rs_time,
 
   if (G1UseAdaptiveConcRefinement) {
     update_zones(update_rs_time, update_rs_processed_buffers, goal_ms);
+    if (G1UseCPUAwareConcRefinement) {
+      update_active_threads_limit(update_rs_time, goal_ms);
+    }
 
     // Change the barrier params
     if (max_num_threads() == 0) {
@@ -421,6 +475,9 @@ uint G1ConcurrentRefine::worker_id_offset() {
 }
 
 void G1ConcurrentRefine::maybe_activate_more_threads(uint worker_id, size_t num_cur_buffers) {
+  if (worker_id + 1 >= _active_threads_limit) {
+    return;
+  }
   if (num_cur_buffers > activation_threshold(worker_id + 1)) {
     _thread_control.maybe_activate_next(worker_id);
   }
@@ -438,6 +495,12 @@ bool G1ConcurrentRefine::do_refinement_step(uint worker_id) {
     dcqs.set_completed_queue_padding(0);
   }
 
+  // Threads beyond the current limit stop refining; the limit may have been
+  // lowered while they were active.
+  if (worker_id >= _active_threads_limit) {
+    return false;
+  }
+
   maybe_activate_more_threads(worker_id, curr_buffer_num);
 
   // Process the next buffer, if there are enough left.
@@ -92,6 +92,16 @@ class G1ConcurrentRefine : public CHeapObj<mtGC> {
   size_t _red_zone;
   size_t _min_yellow_zone_size;
 
+  // Number of refinement threads that may currently be active. Worker n
+  // only activates worker n+1 if n+1 is below this limit. Always equal to
+  // max_num_threads() unless G1UseCPUAwareConcRefinement is enabled.
+  uint _active_threads_limit;
+  // Processors available to the VM and the recent system load at the time
+  // _active_threads_limit was last updated. The load is negative if it could
+  // not be determined.
+  uint _available_processors;
+  double _system_load;
+
   G1ConcurrentRefine(size_t green_zone,
                      size_t yellow_zone,
                      size_t red_zone,
@@ -102,6 +112,11 @@ class G1ConcurrentRefine : public CHeapObj<mtGC> {
                     size_t update_rs_processed_buffers,
                     double goal_ms);
 
+  // Update the number of refinement threads that may be active based on the
+  // processors currently left idle by the rest of the system and whether
+  // Update RS met its time goal during the last pause.
+  void update_active_threads_limit(double update_rs_time, double goal_ms);
+
   static uint worker_id_offset();
   void maybe_activate_more_threads(uint worker_id, size_t num_cur_buffers);
 
@@ -134,6 +149,10 @@ public:
   size_t green_zone() const      { return _green_zone;  }
   size_t yellow_zone() const     { return _yellow_zone; }
   size_t red_zone() const        { return _red_zone;    }
+
+  uint active_threads_limit() const { return _active_threads_limit; }
+  uint available_processors() const { return _available_processors; }
+  double system_load() const        { return _system_load; }
 };
 
 #endif // SHARE_VM_GC_G1_G1CONCURRENTREFINE_HPP
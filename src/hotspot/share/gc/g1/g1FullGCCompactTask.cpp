@@ -31,7 +31,10 @@
 #include "gc/g1/heapRegion.inline.hpp"
 #include "gc/shared/gcTraceTime.inline.hpp"
 #include "logging/log.hpp"
+#include "memory/allocation.inline.hpp"
 #include "oops/oop.inline.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/orderAccess.hpp"
 #include "utilities/ticks.hpp"
 
 class G1ResetHumongousClosure : public HeapRegionClosure {
@@ -87,13 +90,81 @@ void G1FullGCCompactTask::compact_region(HeapRegion* hr) {
   hr->complete_compaction();
 }
 
+G1FullGCCompactTask::G1FullGCCompactTask(G1FullCollector* collector) :
+    G1FullGCTask("G1 Compact Task", collector),
+    _claimer(collector->workers()),
+    _next_claim(NULL),
+    _compacted(NULL) {
+  uint num_queues = collector->workers();
+  _next_claim = NEW_C_HEAP_ARRAY(uint, num_queues, mtGC);
+  for (uint i = 0; i < num_queues; i++) {
+    _next_claim[i] = 0;
+  }
+  uint max_regions = G1CollectedHeap::heap()->max_regions();
+  _compacted = NEW_C_HEAP_ARRAY(bool, max_regions, mtGC);
+  for (uint i = 0; i < max_regions; i++) {
+    _compacted[i] = false;
+  }
+}
+
+G1FullGCCompactTask::~G1FullGCCompactTask() {
+  FREE_C_HEAP_ARRAY(bool, _compacted);
+  FREE_C_HEAP_ARRAY(uint, _next_claim);
+}
+
+void G1FullGCCompactTask::wait_for_destinations(GrowableArray<HeapRegion*>* queue, int index) {
+  HeapRegion* hr = queue->at(index);
+  G1CMBitMap* bitmap = collector()->mark_bitmap();
+  // Objects are forwarded in address order, so the first live object
+  // is moved to the lowest destination.
+  HeapWord* first = bitmap->get_next_marked_addr(hr->bottom(), hr->top());
+  if (first >= hr->top()) {
+    return;
+  }
+  HeapWord* destination = (HeapWord*)oop(first)->forwardee();
+  if (destination == NULL || hr->is_in_reserved(destination)) {
+    // Objects only slide within the region itself.
+    return;
+  }
+
+  for (int i = index - 1; i >= 0; i--) {
+    HeapRegion* dest_hr = queue->at(i);
+    // The region has already been claimed by one of the workers, and all
+    // regions it depends on precede it in the queue, so this terminates.
+    while (!OrderAccess::load_acquire(&_compacted[dest_hr->hrm_index()])) {
+      SpinPause();
+    }
+    if (dest_hr->is_in_reserved(destination)) {
+      return;
+    }
+  }
+  ShouldNotReachHere();
+}
+
+void G1FullGCCompactTask::compact_queue(uint queue_id) {
+  GrowableArray<HeapRegion*>* compaction_queue = collector()->compaction_point(queue_id)->regions();
+  uint length = (uint)compaction_queue->length();
+  while (true) {
+    uint index = Atomic::add(1u, &_next_claim[queue_id]) - 1;
+    if (index >= length) {
+      return;
+    }
+    HeapRegion* hr = compaction_queue->at(index);
+    wait_for_destinations(compaction_queue, (int)index);
+    compact_region(hr);
+    OrderAccess::release_store(&_compacted[hr->hrm_index()], true);
+  }
+}
+
 void G1FullGCCompactTask::work(uint worker_id) {
   Ticks start = Ticks::now();
-  GrowableArray<HeapRegion*>* compaction_queue = collector()->compaction_point(worker_id)->regions();
-  for (GrowableArrayIterator<HeapRegion*> it = compaction_queue->begin();
-       it != compaction_queue->end();
-       ++it) {
-    compact_region(*it);
+  compact_queue(worker_id);
+  if (G1FullGCCompactionWorkStealing) {
+    // Help compacting the queues of the other workers.
+    uint num_queues = collector()->workers();
+    for (uint i = 1; i < num_queues; i++) {
+      compact_queue((worker_id + i) % num_queues);
+    }
   }
 
   G1ResetHumongousClosure hc(collector()->mark_bitmap());
@@ -35,17 +35,32 @@
 class G1CollectedHeap;
 class G1CMBitMap;
 
+// Compacts the regions of the per-worker compaction queues built in phase 2.
+// Regions are claimed one at a time and in queue order, so workers that are
+// done with their own queue can help with the queues of other workers. Since
+// objects only move to regions earlier in the same queue, a region is only
+// compacted once all regions its live objects are copied into have been
+// compacted themselves.
 class G1FullGCCompactTask : public G1FullGCTask {
 protected:
   HeapRegionClaimer _claimer;
 
 private:
+  // Index of the next region to claim in each compaction queue.
+  volatile uint* _next_claim;
+  // Per region flag, indexed by hrm_index, set once all live objects of
+  // the region have been moved.
+  volatile bool* _compacted;
+
   void compact_region(HeapRegion* hr);
+  // Wait until all regions the live objects of the region at the given
+  // index are moved into have been compacted.
+  void wait_for_destinations(GrowableArray<HeapRegion*>* queue, int index);
+  void compact_queue(uint queue_id);
 
 public:
-  G1FullGCCompactTask(G1FullCollector* collector) :
-    G1FullGCTask("G1 Compact Task", collector),
-    _claimer(collector->workers()) { }
+  G1FullGCCompactTask(G1FullCollector* collector);
+  ~G1FullGCCompactTask();
   void work(uint worker_id);
   void serial_compaction();
 
@@ -28,6 +28,8 @@
 #include "gc/g1/g1HotCardCache.hpp"
 #include "gc/g1/g1ParScanThreadState.inline.hpp"
 #include "gc/g1/g1StringDedup.hpp"
+#include "gc/shared/gcId.hpp"
+#include "gc/shared/gcPhaseTimingRecorder.hpp"
 #include "gc/shared/workerDataArray.inline.hpp"
 #include "memory/resourceArea.hpp"
 #include "logging/log.hpp"
@@ -42,7 +44,8 @@ G1GCPhaseTimes::G1GCPhaseTimes(STWGCTimer* gc_timer, uint max_gc_threads) :
   _max_gc_threads(max_gc_threads),
   _gc_start_counter(0),
   _gc_pause_time_ms(0.0),
-  _ref_phase_times((GCTimer*)gc_timer, max_gc_threads)
+  _ref_phase_times((GCTimer*)gc_timer, max_gc_threads),
+  _weak_phase_times(max_gc_threads)
 {
   assert(max_gc_threads > 0, "Must have some GC threads");
 
@@ -130,6 +133,7 @@ _gc_par_phases[Termination] = new WorkerDataArray<double>(max_gc_threads, "Termi
 void G1GCPhaseTimes::reset() {
   _cur_collection_par_time_ms = 0.0;
   _cur_optional_evac_ms = 0.0;
+  _cur_refine_active_threads_limit = 0;
   _cur_collection_code_root_fixup_time_ms = 0.0;
   _cur_strong_code_root_purge_time_ms = 0.0;
   _cur_evac_fail_recalc_used = 0.0;
@@ -141,7 +145,6 @@ void G1GCPhaseTimes::reset() {
   _cur_clear_ct_time_ms = 0.0;
   _cur_expand_heap_time_ms = 0.0;
   _cur_ref_proc_time_ms = 0.0;
-  _cur_weak_ref_proc_time_ms = 0.0;
   _cur_collection_start_sec = 0.0;
   _root_region_scan_wait_time_ms = 0.0;
   _external_accounted_time_ms = 0.0;
@@ -169,6 +172,7 @@ void G1GCPhaseTimes::reset() {
   }
 
   _ref_phase_times.reset();
+  _weak_phase_times.reset();
 }
 
 void G1GCPhaseTimes::note_gc_start() {
@@ -332,6 +336,10 @@ void G1GCPhaseTimes::trace_time(const char* name, double value) const {
   log_trace(gc, phases)("%s%s: " TIME_FORMAT, Indents[3], name, value);
 }
 
+void G1GCPhaseTimes::debug_count(const char* name, size_t value) const {
+  log_debug(gc, phases)("%s%s: " SIZE_FORMAT, Indents[2], name, value);
+}
+
 void G1GCPhaseTimes::trace_count(const char* name, size_t value) const {
   log_trace(gc, phases)("%s%s: " SIZE_FORMAT, Indents[3], name, value);
 }
@@ -407,7 +415,7 @@ double G1GCPhaseTimes::print_post_evacuate_collection_set() const {
                         _cur_collection_code_root_fixup_time_ms +
                         _recorded_preserve_cm_referents_time_ms +
                         _cur_ref_proc_time_ms +
-                        _cur_weak_ref_proc_time_ms +
+                        _weak_phase_times.total_time_sec() * MILLIUNITS +
                         _cur_clear_ct_time_ms +
                         _recorded_merge_pss_time_ms +
                         _cur_strong_code_root_purge_time_ms +
@@ -426,7 +434,8 @@ double G1GCPhaseTimes::print_post_evacuate_collection_set() const {
   debug_time_for_reference("Reference Processing", _cur_ref_proc_time_ms);
   _ref_phase_times.print_all_references(2, false);
 
-  debug_time("Weak Processing", _cur_weak_ref_proc_time_ms);
+  debug_time("Weak Processing", _weak_phase_times.total_time_sec() * MILLIUNITS);
+  _weak_phase_times.log_print_phases(3);
 
   if (G1StringDedup::is_enabled()) {
     debug_time("String Dedup Fixup", _cur_string_dedup_fixup_time_ms);
@@ -463,6 +472,9 @@ double G1GCPhaseTimes::print_post_evacuate_collection_set() const {
     debug_time("Resize TLABs", _cur_resize_tlab_time_ms);
   }
   debug_time("Expand Heap After Collection", _cur_expand_heap_time_ms);
+  if (G1UseCPUAwareConcRefinement) {
+    debug_count("Active Refinement Threads Limit", _cur_refine_active_threads_limit);
+  }
 
 
   return sum_ms;
@@ -475,6 +487,16 @@ void G1GCPhaseTimes::print_other(double accounted_ms) const {
 void G1GCPhaseTimes::print() {
   note_gc_end();
 
+  if (GCPhaseTimingRecorder::is_enabled()) {
+    uint gc_id = GCId::current();
+    for (int i = 0; i < GCParPhasesSentinel; i++) {
+      // Worker start and end are time stamps, not durations.
+      if (i != GCWorkerStart && i != GCWorkerEnd) {
+        GCPhaseTimingRecorder::record_worker_phase(gc_id, _gc_par_phases[i]);
+      }
+    }
+  }
+
   if (_cur_verify_before_time_ms > 0.0) {
     debug_time("Verify Before", _cur_verify_before_time_ms);
   }
@@ -26,6 +26,7 @@
 #define SHARE_VM_GC_G1_G1GCPHASETIMES_HPP
 
 #include "gc/shared/referenceProcessorPhaseTimes.hpp"
+#include "gc/shared/weakProcessorPhaseTimes.hpp"
 #include "logging/logLevel.hpp"
 #include "memory/allocation.hpp"
 #include "utilities/macros.hpp"
@@ -144,7 +145,6 @@ class G1GCPhaseTimes : public CHeapObj<mtGC> {
   double _cur_ref_proc_time_ms;
   double _cur_ref_enq_time_ms;
 
-  double _cur_weak_ref_proc_time_ms;
 
   double _cur_collection_start_sec;
   double _root_region_scan_wait_time_ms;
@@ -174,10 +174,13 @@ class G1GCPhaseTimes : public CHeapObj<mtGC> {
   size_t _cur_fast_reclaim_humongous_candidates;
   size_t _cur_fast_reclaim_humongous_reclaimed;
 
+  uint _cur_refine_active_threads_limit;
+
   double _cur_verify_before_time_ms;
   double _cur_verify_after_time_ms;
 
   ReferenceProcessorPhaseTimes _ref_phase_times;
+  WeakProcessorPhaseTimes _weak_phase_times;
 
   double worker_time(GCParPhases phase, uint worker);
   void note_gc_end();
@@ -195,6 +198,7 @@ class G1GCPhaseTimes : public CHeapObj<mtGC> {
   // This will print logs for both 'gc+phases' and 'gc+phases+ref'.
   void debug_time_for_reference(const char* name, double value) const;
   void trace_time(const char* name, double value) const;
+  void debug_count(const char* name, size_t value) const;
   void trace_count(const char* name, size_t value) const;
 
   double print_pre_evacuate_collection_set() const;
@@ -281,10 +285,6 @@ class G1GCPhaseTimes : public CHeapObj<mtGC> {
     _cur_ref_proc_time_ms = ms;
   }
 
-  void record_weak_ref_proc_time(double ms) {
-    _cur_weak_ref_proc_time_ms = ms;
-  }
-
   void record_root_region_scan_wait_time(double time_ms) {
     _root_region_scan_wait_time_ms = time_ms;
   }
@@ -297,6 +297,10 @@ class G1GCPhaseTimes : public CHeapObj<mtGC> {
     _recorded_serial_free_cset_time_ms = time_ms;
   }
 
+  void record_refine_active_threads_limit(uint limit) {
+    _cur_refine_active_threads_limit = limit;
+  }
+
   void record_fast_reclaim_humongous_stats(double time_ms, size_t total, size_t candidates) {
     _cur_fast_reclaim_humongous_register_time_ms = time_ms;
     _cur_fast_reclaim_humongous_total = total;
@@ -389,6 +393,8 @@ class G1GCPhaseTimes : public CHeapObj<mtGC> {
   }
 
   ReferenceProcessorPhaseTimes* ref_phase_times() { return &_ref_phase_times; }
+
+  WeakProcessorPhaseTimes* weak_phase_times() { return &_weak_phase_times; }
 };
 
 class G1EvacPhaseWithTrimTimeTracker : public StackObj {
@@ -33,6 +33,7 @@
 #include "gc/g1/g1RemSet.hpp"
 #include "gc/g1/heapRegionRemSet.hpp"
 #include "gc/shared/ageTable.hpp"
+#include "gc/shared/partialArrayChunker.hpp"
 #include "memory/allocation.hpp"
 #include "oops/oop.hpp"
 #include "utilities/ticks.hpp"
@@ -58,6 +59,9 @@ class G1ParScanThreadState : public CHeapObj<mtGC> {
   uint              _tenuring_threshold;
   G1ScanEvacuatedObjClosure  _scanner;
 
+  // Sizes the chunks of large object arrays.
+  PartialArrayChunker _array_chunker;
+
   uint _worker_id;
 
   // Upper and lower threshold to start and end work queue draining.
@@ -100,6 +104,10 @@ public:
 
   void set_ref_discoverer(ReferenceDiscoverer* rd) { _scanner.set_ref_discoverer(rd); }
 
+  // The terminator of the current phase provides the number of idle
+  // workers for sizing array chunks, may be NULL.
+  void set_terminator(const ParallelTaskTerminator* t) { _array_chunker.set_terminator(t); }
+
 #ifdef ASSERT
   bool queue_is_empty() const { return _refs->is_empty(); }
 
@@ -91,9 +91,10 @@ inline void G1ParScanThreadState::do_oop_partial_array(oop* p) {
   int start                  = next_index;
   int end                    = length;
   int remainder              = end - start;
-  // We'll try not to push a range that's smaller than ParGCArrayScanChunk.
-  if (remainder > 2 * ParGCArrayScanChunk) {
-    end = start + ParGCArrayScanChunk;
+  int chunk                  = _array_chunker.chunk_size(_refs->size());
+  // We'll try not to push a range that's smaller than the chunk size.
+  if (remainder > 2 * chunk) {
+    end = start + chunk;
     to_obj_array->set_length(end);
     // Push the remainder before we process the range in case another
     // worker has run out of things to do and can steal it.
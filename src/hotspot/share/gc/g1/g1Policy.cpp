@@ -38,6 +38,7 @@
 #include "gc/g1/heapRegion.inline.hpp"
 #include "gc/g1/heapRegionRemSet.hpp"
 #include "gc/shared/gcPolicyCounters.hpp"
+#include "gc/shared/gcTrace.hpp"
 #include "logging/logStream.hpp"
 #include "runtime/arguments.hpp"
 #include "runtime/java.hpp"
@@ -235,6 +236,11 @@ G1Policy::YoungTargetLengths G1Policy::young_list_target_lengths(size_t rs_lengt
                                                            base_min_length,
                                                            desired_min_length,
                                                            desired_max_length);
+      if (G1YoungGCIntervalMillis > 0) {
+        young_list_target_length =
+          calculate_young_list_target_length_for_interval(base_min_length,
+                                                          young_list_target_length);
+      }
     } else {
       // Don't calculate anything and let the code below bound it to
       // the desired_min_length, i.e., do the next GC as soon as
@@ -377,6 +383,28 @@ G1Policy::calculate_young_list_target_length(size_t rs_lengths,
   return base_min_length + min_young_length;
 }
 
+uint G1Policy::calculate_young_list_target_length_for_interval(uint base_min_length,
+                                                               uint pause_target_length) const {
+  assert(G1YoungGCIntervalMillis > 0, "pre-condition");
+
+  if (_analytics->num_alloc_rate_ms() <= 3) {
+    // Not enough information about the allocation rate yet, only use the
+    // pause time goal.
+    return pause_target_length;
+  }
+
+  double const alloc_rate_ms = _analytics->predict_alloc_rate_ms();
+  double const eden_length_d = ceil(alloc_rate_ms * G1YoungGCIntervalMillis);
+  // Any value larger than the pause target gets cut off below anyway.
+  uint const eden_length = (uint)MIN2(eden_length_d, (double)pause_target_length);
+  uint const target_length = MIN2(base_min_length + MAX2(eden_length, 1u), pause_target_length);
+
+  log_debug(gc, ergo, heap)("Young target length for GC interval: %u regions (pause target: %u regions, "
+                            "allocation rate: %1.2f regions/ms, interval: " UINTX_FORMAT "ms)",
+                            target_length, pause_target_length, alloc_rate_ms, G1YoungGCIntervalMillis);
+  return target_length;
+}
+
 double G1Policy::predict_survivor_regions_evac_time() const {
   double survivor_regions_evac_time = 0.0;
   const GrowableArray<HeapRegion*>* survivor_regions = _g1h->survivor()->regions();
@@ -743,9 +771,19 @@ void G1Policy::record_collection_pause_end(double pause_time_ms, size_t cards_sc
   } else {
     update_rs_time_goal_ms -= scan_hcc_time_ms;
   }
-  _g1h->concurrent_refine()->adjust(average_time_ms(G1GCPhaseTimes::UpdateRS),
-                                    phase_times()->sum_thread_work_items(G1GCPhaseTimes::UpdateRS),
-                                    update_rs_time_goal_ms);
+  G1ConcurrentRefine* cr = _g1h->concurrent_refine();
+  cr->adjust(average_time_ms(G1GCPhaseTimes::UpdateRS),
+             phase_times()->sum_thread_work_items(G1GCPhaseTimes::UpdateRS),
+             update_rs_time_goal_ms);
+  if (G1UseAdaptiveConcRefinement && G1UseCPUAwareConcRefinement) {
+    phase_times()->record_refine_active_threads_limit(cr->active_threads_limit());
+    _g1h->gc_tracer_stw()->report_refinement_control(cr->active_threads_limit(),
+                                                     G1ConcurrentRefine::max_num_threads(),
+                                                     cr->available_processors(),
+                                                     cr->system_load(),
+                                                     average_time_ms(G1GCPhaseTimes::UpdateRS),
+                                                     update_rs_time_goal_ms);
+  }
 
   cset_chooser()->verify();
 }
@@ -224,6 +224,13 @@ private:
                                           uint desired_min_length,
                                           uint desired_max_length) const;
 
+  // Calculate and return the young list target length that makes young-only
+  // collections occur about every G1YoungGCIntervalMillis, given the predicted
+  // allocation rate. The result is limited by pause_target_length, the young
+  // list target length calculated to fit into the pause time goal.
+  uint calculate_young_list_target_length_for_interval(uint base_min_length,
+                                                       uint pause_target_length) const;
+
   // Result of the bounded_young_list_target_length() method, containing both the
   // bounded as well as the unbounded young list target lengths in this order.
   typedef Pair<uint, uint, StackObj> YoungTargetLengths;
@@ -404,10 +411,10 @@ public:
   // Fraction used when predicting how many optional regions to include in
   // the CSet. This fraction of the available time is used for optional regions,
   // the rest is used to add old regions to the normal CSet.
-  double optional_prediction_fraction() { return 0.2; }
+  double optional_prediction_fraction() { return G1OptionalCSetPredictionPercent / 100.0; }
   // Fraction used when evacuating the optional regions. This fraction of the
   // remaining time is used to choose what regions to include in the evacuation.
-  double optional_evacuation_fraction() { return 0.75; }
+  double optional_evacuation_fraction() { return G1OptionalCSetEvacuationPercent / 100.0; }
 
   uint tenuring_threshold() const { return _tenuring_threshold; }
 
@@ -0,0 +1,256 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/g1/g1CollectedHeap.hpp"
+#include "gc/g1/g1RegionStatsDCmd.hpp"
+#include "gc/g1/heapRegion.hpp"
+#include "gc/g1/heapRegionRemSet.hpp"
+#include "memory/resourceArea.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "utilities/globalDefinitions.hpp"
+#include "utilities/ostream.hpp"
+
+class G1RegionTypeStats {
+public:
+  enum {
+    NumLivenessBuckets = 10
+  };
+
+private:
+  const char* _name;
+
+  size_t _regions;
+  size_t _used;
+  size_t _live;
+
+  size_t _rs_mem_size;
+  size_t _sparse_cards;
+  size_t _fine_cards;
+  size_t _coarse_cards;
+  size_t _fine_entries;
+  size_t _coarse_entries;
+  size_t _coarsened_regions;
+
+  size_t _untracked;
+  size_t _updating;
+  size_t _complete;
+
+  size_t _code_roots;
+
+  size_t _liveness[NumLivenessBuckets];
+
+public:
+  G1RegionTypeStats(const char* name) :
+    _name(name),
+    _regions(0), _used(0), _live(0),
+    _rs_mem_size(0), _sparse_cards(0), _fine_cards(0), _coarse_cards(0),
+    _fine_entries(0), _coarse_entries(0), _coarsened_regions(0),
+    _untracked(0), _updating(0), _complete(0),
+    _code_roots(0) {
+    for (uint i = 0; i < NumLivenessBuckets; i++) {
+      _liveness[i] = 0;
+    }
+  }
+
+  static uint liveness_bucket(size_t live_bytes) {
+    size_t bucket = live_bytes * NumLivenessBuckets / HeapRegion::GrainBytes;
+    return (uint)MIN2(bucket, (size_t)NumLivenessBuckets - 1);
+  }
+
+  void add(HeapRegion* r, size_t live_bytes,
+           size_t sparse_cards, size_t fine_cards, size_t coarse_cards,
+           size_t fine_entries, size_t coarse_entries) {
+    HeapRegionRemSet* hrrs = r->rem_set();
+
+    _regions++;
+    _used += r->used();
+    _live += live_bytes;
+    _liveness[liveness_bucket(live_bytes)]++;
+
+    _rs_mem_size += hrrs->mem_size();
+    _sparse_cards += sparse_cards;
+    _fine_cards += fine_cards;
+    _coarse_cards += coarse_cards;
+    _fine_entries += fine_entries;
+    _coarse_entries += coarse_entries;
+    if (coarse_entries > 0) {
+      _coarsened_regions++;
+    }
+
+    if (hrrs->is_complete()) {
+      _complete++;
+    } else if (hrrs->is_updating()) {
+      _updating++;
+    } else {
+      _untracked++;
+    }
+
+    _code_roots += hrrs->strong_code_roots_list_length();
+  }
+
+  void print_summary_on(outputStream* st) const {
+    st->print_cr("%-10s " SIZE_FORMAT_W(7) " " SIZE_FORMAT_W(7) "%s " SIZE_FORMAT_W(7) "%s "
+                 SIZE_FORMAT_W(7) "%s " SIZE_FORMAT_W(10) " " SIZE_FORMAT_W(10) " " SIZE_FORMAT_W(10) " "
+                 SIZE_FORMAT_W(7) " " SIZE_FORMAT_W(7) " " SIZE_FORMAT_W(9) " "
+                 SIZE_FORMAT_W(9) " " SIZE_FORMAT_W(8) " " SIZE_FORMAT_W(8) " " SIZE_FORMAT_W(10),
+                 _name, _regions,
+                 byte_size_in_proper_unit(_used), proper_unit_for_byte_size(_used),
+                 byte_size_in_proper_unit(_live), proper_unit_for_byte_size(_live),
+                 byte_size_in_proper_unit(_rs_mem_size), proper_unit_for_byte_size(_rs_mem_size),
+                 _sparse_cards, _fine_cards, _coarse_cards,
+                 _fine_entries, _coarse_entries, _coarsened_regions,
+                 _untracked, _updating, _complete, _code_roots);
+  }
+
+  void print_liveness_on(outputStream* st) const {
+    st->print("%-10s", _name);
+    for (uint i = 0; i < NumLivenessBuckets; i++) {
+      st->print(" " SIZE_FORMAT_W(7), _liveness[i]);
+    }
+    st->cr();
+  }
+};
+
+class G1RegionStatsClosure : public HeapRegionClosure {
+  G1RegionTypeStats _free;
+  G1RegionTypeStats _young;
+  G1RegionTypeStats _humongous;
+  G1RegionTypeStats _old;
+  G1RegionTypeStats _archive;
+  G1RegionTypeStats _all;
+
+  outputStream* _st;
+  bool _print_regions;
+
+  G1RegionTypeStats* stats_for(HeapRegion* r) {
+    if (r->is_free()) {
+      return &_free;
+    } else if (r->is_young()) {
+      return &_young;
+    } else if (r->is_humongous()) {
+      return &_humongous;
+    } else if (r->is_archive()) {
+      return &_archive;
+    } else {
+      assert(r->is_old(), "Unexpected region type %s", r->get_type_str());
+      return &_old;
+    }
+  }
+
+public:
+  G1RegionStatsClosure(outputStream* st, bool print_regions) :
+    _free("Free"), _young("Young"), _humongous("Humongous"), _old("Old"),
+    _archive("Archive"), _all("All"), _st(st), _print_regions(print_regions) { }
+
+  bool do_heap_region(HeapRegion* r) {
+    size_t sparse_cards, fine_cards, coarse_cards, fine_entries, coarse_entries;
+    r->rem_set()->occupancy_details(&sparse_cards, &fine_cards, &coarse_cards,
+                                    &fine_entries, &coarse_entries);
+    // Liveness information of the last completed marking; regions allocated
+    // since then are considered completely live.
+    size_t live_bytes = r->is_free() ? 0 : MIN2(r->live_bytes(), r->used());
+
+    stats_for(r)->add(r, live_bytes, sparse_cards, fine_cards, coarse_cards, fine_entries, coarse_entries);
+    _all.add(r, live_bytes, sparse_cards, fine_cards, coarse_cards, fine_entries, coarse_entries);
+
+    if (_print_regions && !r->is_free()) {
+      _st->print_cr(" %6u %-4s " PTR_FORMAT " used " SIZE_FORMAT_W(8) " live " SIZE_FORMAT_W(8)
+                    " rset %-9s mem " SIZE_FORMAT_W(8) " sparse " SIZE_FORMAT " fine " SIZE_FORMAT
+                    " (" SIZE_FORMAT ") coarse " SIZE_FORMAT " (" SIZE_FORMAT ") code roots " SIZE_FORMAT,
+                    r->hrm_index(), r->get_short_type_str(), p2i(r->bottom()),
+                    r->used(), live_bytes,
+                    r->rem_set()->get_state_str(), r->rem_set()->mem_size(),
+                    sparse_cards, fine_cards, fine_entries, coarse_cards, coarse_entries,
+                    r->rem_set()->strong_code_roots_list_length());
+    }
+    return false;
+  }
+
+  void print_summary() {
+    const G1RegionTypeStats* stats[] = { &_young, &_humongous, &_old, &_archive, &_free, &_all, NULL };
+
+    _st->print_cr("Region liveness (regions per live bytes range of the region size):");
+    _st->print("%-10s", "Type");
+    for (uint i = 0; i < G1RegionTypeStats::NumLivenessBuckets; i++) {
+      uint from = i * 100 / G1RegionTypeStats::NumLivenessBuckets;
+      uint to = (i + 1) * 100 / G1RegionTypeStats::NumLivenessBuckets;
+      _st->print(" %3u-%3u", from, to);
+    }
+    _st->cr();
+    for (const G1RegionTypeStats** cur = &stats[0]; *cur != NULL; cur++) {
+      (*cur)->print_liveness_on(_st);
+    }
+    _st->cr();
+
+    _st->print_cr("Remembered sets and code roots:");
+    _st->print_cr("%-10s %7s %8s %8s %8s %10s %10s %10s %7s %7s %9s %9s %8s %8s %10s",
+                  "Type", "Regions", "Used", "Live", "RSetMem",
+                  "SparseCrd", "FineCrd", "CoarseCrd", "FinePRT", "Coarse", "Coarsened",
+                  "Untracked", "Updating", "Complete", "CodeRoots");
+    for (const G1RegionTypeStats** cur = &stats[0]; *cur != NULL; cur++) {
+      (*cur)->print_summary_on(_st);
+    }
+  }
+};
+
+G1RegionStatsDCmd::G1RegionStatsDCmd(outputStream* output, bool heap) :
+  DCmdWithParser(output, heap),
+  _print_regions("-regions", "Print one line per non-free region", "BOOLEAN", false, "false") {
+  _dcmdparser.add_dcmd_option(&_print_regions);
+}
+
+int G1RegionStatsDCmd::num_arguments() {
+  ResourceMark rm;
+  G1RegionStatsDCmd* dcmd = new G1RegionStatsDCmd(NULL, false);
+  if (dcmd != NULL) {
+    DCmdMark mark(dcmd);
+    return dcmd->_dcmdparser.num_arguments();
+  } else {
+    return 0;
+  }
+}
+
+void G1RegionStatsDCmd::execute(DCmdSource source, TRAPS) {
+  if (!UseG1GC) {
+    output()->print_cr("G1 region statistics are only available with -XX:+UseG1GC.");
+    return;
+  }
+
+  // No GC can happen and no regions can be allocated or freed while
+  // holding the Heap_lock.
+  MutexLocker hl(Heap_lock);
+  G1CollectedHeap* g1h = G1CollectedHeap::heap();
+  output()->print_cr("G1 region statistics: %u regions of " SIZE_FORMAT "%s",
+                     g1h->num_regions(),
+                     byte_size_in_proper_unit(HeapRegion::GrainBytes),
+                     proper_unit_for_byte_size(HeapRegion::GrainBytes));
+
+  G1RegionStatsClosure cl(output(), _print_regions.value());
+  g1h->heap_region_iterate(&cl);
+  if (_print_regions.value()) {
+    output()->cr();
+  }
+  cl.print_summary();
+}
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_VM_GC_G1_G1REGIONSTATSDCMD_HPP
+#define SHARE_VM_GC_G1_G1REGIONSTATSDCMD_HPP
+
+#include "services/diagnosticCommand.hpp"
+
+class outputStream;
+
+// Prints per region type statistics about the G1 heap: a histogram of the
+// live bytes per region as of the last completed marking, the remembered
+// set footprint broken down by container (sparse, fine, coarse), remembered
+// set tracking states and code root counts. Optionally prints one line per
+// region. Runs without a safepoint; it only holds the Heap_lock, which
+// keeps the set of regions and their types stable.
+class G1RegionStatsDCmd : public DCmdWithParser {
+  DCmdArgument<bool> _print_regions;
+public:
+  G1RegionStatsDCmd(outputStream* output, bool heap);
+  static const char* name() {
+    return "GC.g1_region_stats";
+  }
+  static const char* description() {
+    return "Provide statistics about liveness, remembered sets and code roots of G1 heap regions.";
+  }
+  static const char* impact() {
+    return "Medium: Depends on Java heap size and remembered set sizes.";
+  }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+                        "monitor", NULL};
+    return p;
+  }
+  static int num_arguments();
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
+#endif // SHARE_VM_GC_G1_G1REGIONSTATSDCMD_HPP
@@ -53,9 +53,14 @@ class G1RegionToSpaceMapper : public CHeapObj<mtGC> {
   // Mapping management
   CHeapBitMap _commit_map;
 
+  MemoryType _memory_type;
+
   G1RegionToSpaceMapper(ReservedSpace rs, size_t used_size, size_t page_size, size_t region_granularity, size_t commit_factor, MemoryType type);
 
   void fire_on_commit(uint start_idx, size_t num_regions, bool zero_filled);
+  // Advise transparent huge pages for newly committed pages of auxiliary
+  // data structures if GCDataUseHugePages is set.
+  void advise_huge_pages(size_t start_page, size_t num_pages);
  public:
   MemRegion reserved() { return _storage.reserved(); }
 
@@ -112,8 +112,15 @@ public:
 
   G1RemSetScanState* scan_state() const { return _scan_state; }
 
-  // Refine the card corresponding to "card_ptr". Safe to be called concurrently
-  // to the mutator.
+  // Cleans the card at "*card_ptr_addr" before refinement, returns true iff the
+  // card needs later refinement. Note that "*card_ptr_addr" could be updated to
+  // a different card due to use of hot card cache. Safe to be called
+  // concurrently to the mutator.
+  bool clean_card_before_refine(jbyte** const card_ptr_addr);
+
+  // Refine the card corresponding to "card_ptr", which must have been cleaned
+  // by clean_card_before_refine(), followed by a fence. Safe to be called
+  // concurrently to the mutator.
   void refine_card_concurrently(jbyte* card_ptr,
                                 uint worker_i);
 
@@ -92,8 +92,12 @@ bool G1RemSetTrackingPolicy::update_humongous_before_rebuild(HeapRegion* r, bool
   bool selected_for_rebuild = false;
   // For humongous regions, to be of interest for rebuilding the remembered set the following must apply:
   // - We always try to update the remembered sets of humongous regions containing
-  // type arrays as they might have been reset after full gc.
-  if (is_live && oop(r->humongous_start_region()->bottom())->is_typeArray() && !r->rem_set()->is_tracked()) {
+  // type arrays, and object arrays if they may be eagerly reclaimed, as they might
+  // have been reset after full gc.
+  oop obj = oop(r->humongous_start_region()->bottom());
+  if (is_live &&
+      (obj->is_typeArray() || (G1EagerReclaimHumongousObjArrays && obj->is_objArray())) &&
+      !r->rem_set()->is_tracked()) {
     r->rem_set()->set_state_updating();
     selected_for_rebuild = true;
   }
@@ -40,7 +40,8 @@ G1YoungRemSetSamplingThread::G1YoungRemSetSamplingThread() :
              "G1YoungRemSetSamplingThread monitor",
              true,
              Monitor::_safepoint_check_never),
-    _last_periodic_gc_attempt_s(os::elapsedTime()) {
+    _last_periodic_gc_attempt_s(os::elapsedTime()),
+    _last_soft_max_shrink_request(0) {
   set_name("G1 Young RemSet Sampling");
   create_and_start();
 }
@@ -49,6 +50,10 @@ void G1YoungRemSetSamplingThread::sleep_before_next_cycle() {
   MutexLockerEx x(&_monitor, Mutex::_no_safepoint_check_flag);
   if (!should_terminate()) {
     uintx waitms = G1ConcRefinementServiceIntervalMillis;
+    // Wake up often enough to honor short periodic GC intervals.
+    if (G1PeriodicGCInterval != 0) {
+      waitms = MIN2(waitms, G1PeriodicGCInterval);
+    }
     _monitor.wait(Mutex::_no_safepoint_check_flag, waitms);
   }
 }
@@ -82,6 +87,10 @@ bool G1YoungRemSetSamplingThread::should_start_periodic_gc() {
 }
 
 void G1YoungRemSetSamplingThread::check_for_periodic_gc(){
+  // If disabled, just return.
+  if (G1PeriodicGCInterval == 0) {
+    return;
+  }
   if ((os::elapsedTime() - _last_periodic_gc_attempt_s) > (G1PeriodicGCInterval / 1000.0)) {
     log_debug(gc, periodic)("Checking for periodic GC.");
     if (should_start_periodic_gc()) {
@@ -94,6 +103,25 @@ void G1YoungRemSetSamplingThread::check_for_periodic_gc(){
   }
 }
 
+void G1YoungRemSetSamplingThread::check_for_soft_max_shrink() {
+  G1CollectedHeap* g1h = G1CollectedHeap::heap();
+  size_t soft_max = g1h->soft_max_capacity();
+  if (soft_max == _last_soft_max_shrink_request || g1h->capacity() <= soft_max) {
+    return;
+  }
+  // Shrinking can only reach the soft maximum heap size if enough of the
+  // committed heap is unused, and a concurrent cycle in progress will
+  // shrink the heap at Remark anyway.
+  if (g1h->used() >= soft_max || g1h->concurrent_mark()->cm_thread()->during_cycle()) {
+    return;
+  }
+  log_debug(gc, ergo, heap)("Heap capacity " SIZE_FORMAT "B above soft max heap size " SIZE_FORMAT "B, "
+                            "requesting collection to shrink.", g1h->capacity(), soft_max);
+  if (g1h->try_collect(GCCause::_g1_periodic_collection, false /* retry_on_vmop_failure */)) {
+    _last_soft_max_shrink_request = soft_max;
+  }
+}
+
 void G1YoungRemSetSamplingThread::run_service() {
   double vtime_start = os::elapsedVTime();
 
@@ -107,6 +135,7 @@ void G1YoungRemSetSamplingThread::run_service() {
     }
 
     check_for_periodic_gc();
+    check_for_soft_max_shrink();
 
     sleep_before_next_cycle();
   }
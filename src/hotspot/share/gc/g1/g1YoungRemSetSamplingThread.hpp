@@ -45,12 +45,16 @@ private:
 
   double _last_periodic_gc_attempt_s;
 
+  // The soft maximum heap size a shrinking collection was last requested for.
+  size_t _last_soft_max_shrink_request;
+
   double _vtime_accum;  // Accumulated virtual time.
 
   void sample_young_list_rs_lengths();
 
   void run_service();
   void check_for_periodic_gc();
+  void check_for_soft_max_shrink();
 
   void stop_service();
 
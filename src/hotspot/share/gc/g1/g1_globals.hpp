@@ -151,6 +151,12 @@
           "Select green, yellow and red zones adaptively to meet the "      \
           "the pause requirements.")                                        \
                                                                             \
+  experimental(bool, G1UseCPUAwareConcRefinement, false,                   \
+          "Limit the number of active concurrent refinement threads to "    \
+          "the processors left idle by the mutator unless Update RS "       \
+          "repeatedly exceeds its pause time goal. Requires "               \
+          "G1UseAdaptiveConcRefinement.")                                   \
+                                                                            \
   product(size_t, G1ConcRSLogCacheSize, 10,                                 \
           "Log base 2 of the length of conc RS hot-card cache.")            \
           range(0, 27)                                                      \
@@ -247,6 +253,25 @@
           "The target number of mixed GCs after a marking cycle.")          \
           range(0, max_uintx)                                               \
                                                                             \
+  experimental(uintx, G1YoungGCIntervalMillis, 0,                           \
+          "If non-zero, size the young generation so that young-only "      \
+          "collections happen about every this many milliseconds given "    \
+          "the predicted allocation rate. The pause time goal still "       \
+          "limits the maximum young generation size.")                      \
+          range(0, max_jint)                                                \
+                                                                            \
+  experimental(uintx, G1OptionalCSetPredictionPercent, 20,                  \
+          "Percentage of the remaining pause time budget used for old "     \
+          "regions that are only evacuated incrementally if time permits "  \
+          "after the mandatory part of a mixed collection.")                \
+          range(0, 100)                                                     \
+                                                                            \
+  experimental(uintx, G1OptionalCSetEvacuationPercent, 75,                  \
+          "Percentage of the pause time left after each increment that "    \
+          "the next increment of optional regions may be predicted to "     \
+          "take.")                                                          \
+          range(1, 100)                                                     \
+                                                                            \
   experimental(bool, G1PretouchAuxiliaryMemory, false,                      \
           "Pre-touch large auxiliary data structures used by the GC.")      \
                                                                             \
@@ -257,6 +282,10 @@
           "Try to reclaim dead large objects that have a few stale "        \
           "references at every young GC.")                                  \
                                                                             \
+  experimental(bool, G1EagerReclaimHumongousObjArrays, true,                \
+          "Also try to reclaim dead large object arrays at young GCs "      \
+          "that are not part of a concurrent cycle.")                       \
+                                                                            \
   experimental(size_t, G1RebuildRemSetChunkSize, 256 * K,                   \
           "Chunk size used for rebuilding the remembered set.")             \
           range(4 * K, 32 * M)                                              \
@@ -304,6 +333,10 @@
   develop(bool, G1VerifyBitmaps, false,                                     \
           "Verifies the consistency of the marking bitmaps")                \
                                                                             \
+  diagnostic(bool, G1FullGCCompactionWorkStealing, true,                   \
+          "Let workers that finished compacting their own regions during "  \
+          "a full GC compact regions of other workers.")                    \
+                                                                            \
   manageable(uintx, G1PeriodicGCInterval, 0,                                \
           "Number of milliseconds after a previous GC to wait before "      \
           "triggering a periodic gc. A value of zero disables periodically "\
@@ -320,6 +353,12 @@
           "load above this value cancels a given periodic GC. A value of "  \
           "zero disables this check.")                                      \
                                                                             \
+  manageable(size_t, G1SoftMaxHeapSize, 0,                                  \
+          "Soft limit for the committed Java heap. G1 does not expand "     \
+          "the heap beyond it after young collections and shrinks the "     \
+          "heap towards it at Remark and after full collections. 0 "        \
+          "means MaxHeapSize")                                              \
+                                                                            \
   manageable(uintx, G1FreeOldMemoryThresholdPercentAfterFullGC, 90,         \
           "Target percent to free physical memory after FGC.")              \
                                                                             \
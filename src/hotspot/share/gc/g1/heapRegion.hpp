@@ -227,6 +227,9 @@ class HeapRegion: public G1ContiguousSpace {
   // The index of this region in the heap region sequence.
   uint  _hrm_index;
 
+  // The index of the NUMA node the memory of this region is bound to.
+  uint  _node_index;
+
   HeapRegionType _type;
 
   // For a humongous region, region in which it starts.
@@ -369,6 +372,10 @@ class HeapRegion: public G1ContiguousSpace {
   // sequence, otherwise -1.
   uint hrm_index() const { return _hrm_index; }
 
+  // The NUMA node index of this region, see G1NUMA.
+  uint node_index() const { return _node_index; }
+  void set_node_index(uint node_index) { _node_index = node_index; }
+
   // The number of bytes marked live in the region in the last marking phase.
   size_t marked_bytes()    { return _prev_marked_bytes; }
   size_t live_bytes() {
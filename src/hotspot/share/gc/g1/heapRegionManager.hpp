@@ -171,15 +171,9 @@ public:
     _free_list.add_ordered(list);
   }
 
-  HeapRegion* allocate_free_region(bool is_old) {
-    HeapRegion* hr = _free_list.remove_region(is_old);
-
-    if (hr != NULL) {
-      assert(hr->next() == NULL, "Single region should not have next");
-      assert(is_available(hr->hrm_index()), "Must be committed");
-    }
-    return hr;
-  }
+  // Allocate a free region, preferring one located on the requested NUMA node.
+  // Falls back to any free region if there is none on that node.
+  HeapRegion* allocate_free_region(bool is_old, uint requested_node_index);
 
   inline void allocate_free_regions_starting_at(uint first, uint num_regions);
 
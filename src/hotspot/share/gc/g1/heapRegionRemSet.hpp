@@ -152,6 +152,10 @@ public:
   size_t occ_coarse() const;
   size_t occ_sparse() const;
 
+  // Returns the number of fine grain tables and coarsened regions.
+  size_t num_fine_entries() const   { return _n_fine_entries; }
+  size_t num_coarse_entries() const { return _n_coarse_entries; }
+
   static jint n_coarsenings() { return _n_coarsenings; }
 
   // Returns size of the actual remembered set containers in bytes.
@@ -216,6 +220,19 @@ public:
     return _other_regions.occ_sparse();
   }
 
+  // Returns the card occupancy of the sparse, fine and coarse parts and the
+  // number of fine and coarse entries, read consistently under the remembered
+  // set lock so that this may be called outside of a safepoint.
+  void occupancy_details(size_t* sparse_cards, size_t* fine_cards, size_t* coarse_cards,
+                         size_t* fine_entries, size_t* coarse_entries) {
+    MutexLockerEx x(&_m, Mutex::_no_safepoint_check_flag);
+    *sparse_cards = _other_regions.occ_sparse();
+    *fine_cards = _other_regions.occ_fine();
+    *coarse_cards = _other_regions.occ_coarse();
+    *fine_entries = _other_regions.num_fine_entries();
+    *coarse_entries = _other_regions.num_coarse_entries();
+  }
+
   static jint n_coarsenings() { return OtherRegionsTable::n_coarsenings(); }
 
 private:
@@ -196,6 +196,12 @@ public:
   // Removes from head or tail based on the given argument.
   HeapRegion* remove_region(bool from_head);
 
+  // Removes the first region found on the requested NUMA node, searching from
+  // head or tail based on the given argument, at most G1NUMA::max_search_depth()
+  // regions deep. Returns NULL if no such region could be found.
+  inline HeapRegion* remove_region_with_node_index(bool from_head,
+                                                   uint requested_node_index);
+
   // Merge two ordered lists. The result is also ordered. The order is
   // determined by hrm_index.
   void add_ordered(FreeRegionList* from_list);
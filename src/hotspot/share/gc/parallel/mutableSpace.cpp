@@ -24,6 +24,8 @@
 
 #include "precompiled.hpp"
 #include "gc/parallel/mutableSpace.hpp"
+#include "gc/parallel/parallelScavengeHeap.hpp"
+#include "gc/shared/pretouchTask.hpp"
 #include "gc/shared/spaceDecorator.hpp"
 #include "memory/iterator.inline.hpp"
 #include "oops/oop.inline.hpp"
@@ -34,7 +36,8 @@
 #include "utilities/align.hpp"
 #include "utilities/macros.hpp"
 
-MutableSpace::MutableSpace(size_t alignment): ImmutableSpace(), _top(NULL), _alignment(alignment) {
+MutableSpace::MutableSpace(size_t alignment): ImmutableSpace(), _top(NULL), _alignment(alignment),
+  _numa_interleave(true) {
   assert(MutableSpace::alignment() % os::vm_page_size() == 0,
          "Space should be aligned");
   _mangler = new MutableSpaceMangler(this);
@@ -55,13 +58,32 @@ void MutableSpace::numa_setup_pages(MemRegion mr, bool clear_space) {
         // Prefer page reallocation to migration.
         os::free_memory((char*)start, size, page_size);
       }
-      os::numa_make_global((char*)start, size);
+      if (numa_interleave()) {
+        os::numa_make_global((char*)start, size);
+      }
     }
   }
 }
 
+void MutableSpace::numa_release_pages(MemRegion mr) {
+  assert(UseNUMA && !numa_interleave(), "Pages are placed by first touch only");
+  numa_setup_pages(mr, true /* clear_space */);
+}
+
 void MutableSpace::pretouch_pages(MemRegion mr) {
-  os::pretouch_memory(mr.start(), mr.end());
+  // The generation alignment is only raised to the large page size when the
+  // heap is backed by large pages.
+  size_t page_size = os::vm_page_size();
+  if (UseLargePages && alignment() >= os::large_page_size()) {
+    page_size = os::large_page_size();
+  }
+  // GC task threads expanding the old generation during promotion must not
+  // hand the work to the gang.
+  WorkGang* workers = NULL;
+  if (!Thread::current()->is_GC_task_thread()) {
+    workers = ParallelScavengeHeap::heap()->workers();
+  }
+  PretouchTask::pretouch("ParallelGC PreTouch", (char*)mr.start(), (char*)mr.end(), page_size, workers);
 }
 
 void MutableSpace::initialize(MemRegion mr,
@@ -35,7 +35,8 @@
 // an assumption. MutableSpace is also responsible for minimizing the
 // page allocation time by having the memory pretouched (with
 // AlwaysPretouch) and for optimizing page placement on NUMA systems
-// by make the underlying region interleaved (with UseNUMA).
+// by make the underlying region interleaved (with UseNUMA), or by leaving
+// the placement to the first touch of each page.
 //
 // Invariant: (ImmutableSpace +) bottom() <= top() <= end()
 // top() is inclusive and end() is exclusive.
@@ -50,6 +51,8 @@ class MutableSpace: public ImmutableSpace {
   // The last region which page had been setup to be interleaved.
   MemRegion _last_setup_region;
   size_t _alignment;
+  // Whether the pages are interleaved across the NUMA nodes (with UseNUMA).
+  bool _numa_interleave;
  protected:
   HeapWord* volatile _top;
 
@@ -77,6 +80,13 @@ class MutableSpace: public ImmutableSpace {
 
   size_t alignment()                       { return _alignment; }
 
+  bool numa_interleave() const             { return _numa_interleave; }
+  void set_numa_interleave(bool value)     { _numa_interleave = value; }
+
+  // Free the pages of the region so that they get placed on the node of
+  // the thread that touches them next. Only used without interleaving.
+  void numa_release_pages(MemRegion mr);
+
   // Returns a subregion containing all objects in this space.
   MemRegion used_region() { return MemRegion(bottom(), top()); }
 
@@ -23,6 +23,7 @@
  */
 
 #include "precompiled.hpp"
+#include "classfile/javaClasses.inline.hpp"
 #include "code/codeCache.hpp"
 #include "gc/parallel/adjoiningGenerations.hpp"
 #include "gc/parallel/adjoiningVirtualSpaces.hpp"
@@ -36,10 +37,13 @@
 #include "gc/parallel/psParallelCompact.inline.hpp"
 #include "gc/parallel/psPromotionManager.hpp"
 #include "gc/parallel/psScavenge.hpp"
+#include "gc/parallel/psStringDedup.hpp"
 #include "gc/parallel/vmPSOperations.hpp"
 #include "gc/shared/gcHeapSummary.hpp"
 #include "gc/shared/gcLocker.hpp"
 #include "gc/shared/gcWhen.hpp"
+#include "gc/shared/suspendibleThreadSet.hpp"
+#include "gc/shared/workgroup.hpp"
 #include "logging/log.hpp"
 #include "memory/iterator.hpp"
 #include "memory/metaspaceCounters.hpp"
@@ -78,6 +82,13 @@ jint ParallelScavengeHeap::initialize() {
   barrier_set->initialize();
   BarrierSet::set_barrier_set(barrier_set);
 
+  // Set up the work gang for the full collections. It is also used to
+  // pre-touch the generations below. Its threads are only started by the
+  // first user, see workers().
+  _workers = new WorkGang("PS Full GC Thread", ParallelGCThreads,
+                          /* are_GC_task_threads */true,
+                          /* are_ConcurrentGC_threads */false);
+
   // Make up the generations
   // Calculate the maximum size that a generation can grow.  This
   // includes growth into the other generation.  Note that the
@@ -120,9 +131,39 @@ jint ParallelScavengeHeap::initialize() {
     return JNI_ENOMEM;
   }
 
+  PSStringDedup::initialize();
+
   return JNI_OK;
 }
 
+void ParallelScavengeHeap::stop() {
+  if (PSStringDedup::is_enabled()) {
+    PSStringDedup::stop();
+  }
+}
+
+void ParallelScavengeHeap::safepoint_synchronize_begin() {
+  // The deduplication thread is not a Java thread, so it has to be
+  // stopped explicitly for collections to access the table and queue.
+  if (PSStringDedup::is_enabled()) {
+    SuspendibleThreadSet::synchronize();
+  }
+}
+
+void ParallelScavengeHeap::safepoint_synchronize_end() {
+  if (PSStringDedup::is_enabled()) {
+    SuspendibleThreadSet::desynchronize();
+  }
+}
+
+void ParallelScavengeHeap::deduplicate_string(oop str) {
+  assert(java_lang_String::is_instance(str), "invariant");
+
+  if (PSStringDedup::is_enabled()) {
+    PSStringDedup::deduplicate(str);
+  }
+}
+
 void ParallelScavengeHeap::initialize_serviceability() {
 
   _eden_pool = new EdenMutableSpacePool(_young_gen,
@@ -592,12 +633,30 @@ void ParallelScavengeHeap::print_on_error(outputStream* st) const {
   }
 }
 
+WorkGang* ParallelScavengeHeap::workers() {
+  assert(_workers != NULL, "not initialized");
+  if (_workers->created_workers() == 0) {
+    // Users either run during initialization, in a safepoint or with the
+    // ExpandHeap_lock held, so they never race to start the threads.
+    _workers->initialize_workers();
+  }
+  return _workers;
+}
+
 void ParallelScavengeHeap::gc_threads_do(ThreadClosure* tc) const {
   PSScavenge::gc_task_manager()->threads_do(tc);
+  _workers->threads_do(tc);
+  if (PSStringDedup::is_enabled()) {
+    PSStringDedup::threads_do(tc);
+  }
 }
 
 void ParallelScavengeHeap::print_gc_threads_on(outputStream* st) const {
   PSScavenge::gc_task_manager()->print_threads_on(st);
+  _workers->print_worker_threads_on(st);
+  if (PSStringDedup::is_enabled()) {
+    PSStringDedup::print_worker_threads_on(st);
+  }
 }
 
 void ParallelScavengeHeap::print_tracing_info() const {
@@ -616,6 +675,11 @@ void ParallelScavengeHeap::verify(VerifyOption option /* ignored */) {
 
     log_debug(gc, verify)("Eden");
     young_gen()->verify();
+
+    if (PSStringDedup::is_enabled()) {
+      log_debug(gc, verify)("StrDedup");
+      PSStringDedup::verify();
+    }
   }
 }
 
@@ -73,6 +73,9 @@ class ParallelScavengeHeap : public CollectedHeap {
   // The task manager
   static GCTaskManager* _gc_task_manager;
 
+  // The work gang used by the full collections
+  WorkGang* _workers;
+
   GCMemoryManager* _young_manager;
   GCMemoryManager* _old_manager;
 
@@ -94,7 +97,8 @@ class ParallelScavengeHeap : public CollectedHeap {
 
  public:
   ParallelScavengeHeap(GenerationSizer* policy) :
-    CollectedHeap(), _collector_policy(policy), _death_march_count(0) { }
+    CollectedHeap(), _collector_policy(policy), _death_march_count(0),
+    _workers(NULL) { }
 
   // For use by VM operations
   enum CollectionType {
@@ -128,6 +132,11 @@ class ParallelScavengeHeap : public CollectedHeap {
 
   static GCTaskManager* const gc_task_manager() { return _gc_task_manager; }
 
+  // The work gang of the full collections. Its threads are started on the
+  // first call, so that young collections, which run on the GCTaskManager,
+  // do not bring up a second set of GC threads.
+  WorkGang* workers();
+
   CardTableBarrierSet* barrier_set();
   PSCardTable* card_table();
 
@@ -139,6 +148,12 @@ class ParallelScavengeHeap : public CollectedHeap {
   void post_initialize();
   void update_counters();
 
+  virtual void stop();
+  virtual void safepoint_synchronize_begin();
+  virtual void safepoint_synchronize_end();
+
+  virtual void deduplicate_string(oop str);
+
   // The alignment used for the various areas
   size_t space_alignment()      { return _collector_policy->space_alignment(); }
   size_t generation_alignment() { return _collector_policy->gen_alignment(); }
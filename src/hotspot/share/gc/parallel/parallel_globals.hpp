@@ -77,6 +77,12 @@
   develop(uintx, GCWorkerDelayMillis, 0,                                    \
           "Delay in scheduling GC workers (in milliseconds)")               \
                                                                             \
+  experimental(bool, PSNUMAInterleaveOldGen, true,                          \
+          "With UseNUMA, interleave the pages of the old generation "       \
+          "across the nodes. Otherwise each page is placed on the node "    \
+          "of the thread that first touches it, which for promoted "        \
+          "objects is the GC worker copying them into its PLAB")            \
+                                                                            \
   product(bool, PSChunkLargeArrays, true,                                   \
           "Process large arrays in chunks")
 
@@ -40,6 +40,7 @@
 #include "oops/objArrayKlass.inline.hpp"
 #include "oops/oop.inline.hpp"
 #include "prims/jvmtiExport.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/jniHandles.hpp"
 #include "runtime/thread.hpp"
 #include "runtime/vmThread.hpp"
@@ -47,35 +48,119 @@
 #include "utilities/stack.inline.hpp"
 
 //
-// ThreadRootsMarkingTask
+// Work stealing
 //
 
-void ThreadRootsMarkingTask::do_it(GCTaskManager* manager, uint which) {
+static void steal_marking_work(ParallelTaskTerminator& terminator, uint worker_id) {
   assert(ParallelScavengeHeap::heap()->is_gc_active(), "called outside gc");
 
-  ResourceMark rm;
+  ParCompactionManager* cm =
+    ParCompactionManager::gc_thread_compaction_manager(worker_id);
+
+  oop obj = NULL;
+  ObjArrayTask task;
+  do {
+    while (ParCompactionManager::steal_objarray(worker_id,  task)) {
+      cm->follow_contents((objArrayOop)task.obj(), task.index());
+      cm->follow_marking_stacks();
+    }
+    while (ParCompactionManager::steal(worker_id, obj)) {
+      cm->follow_contents(obj);
+      cm->follow_marking_stacks();
+    }
+  } while (!terminator.offer_termination());
+}
+
+static void compaction_with_stealing_work(ParallelTaskTerminator& terminator, uint worker_id) {
+  assert(ParallelScavengeHeap::heap()->is_gc_active(), "called outside gc");
 
   ParCompactionManager* cm =
-    ParCompactionManager::gc_thread_compaction_manager(which);
+    ParCompactionManager::gc_thread_compaction_manager(worker_id);
 
-  ParCompactionManager::MarkAndPushClosure mark_and_push_closure(cm);
-  MarkingCodeBlobClosure mark_and_push_in_blobs(&mark_and_push_closure, !CodeBlobToOopClosure::FixRelocations);
+  // Drain the stacks that have been preloaded with regions
+  // that are ready to fill.
 
-  _thread->oops_do(&mark_and_push_closure, &mark_and_push_in_blobs);
+  cm->drain_region_stacks();
 
-  // Do the real work
-  cm->follow_marking_stacks();
+  guarantee(cm->region_stack()->is_empty(), "Not empty");
+
+  size_t region_index = 0;
+
+  while(true) {
+    if (ParCompactionManager::steal(worker_id, region_index)) {
+      PSParallelCompact::fill_and_update_region(cm, region_index);
+      cm->drain_region_stacks();
+    } else {
+      if (terminator.offer_termination()) {
+        break;
+      }
+      // Go around again.
+    }
+  }
+}
+
+//
+// MarkFromRootsTask
+//
+
+class PCThreadRootsMarkingClosure : public ThreadClosure {
+ private:
+  uint _worker_id;
+
+ public:
+  PCThreadRootsMarkingClosure(uint worker_id) : _worker_id(worker_id) { }
+
+  void do_thread(Thread* thread) {
+    assert(ParallelScavengeHeap::heap()->is_gc_active(), "called outside gc");
+
+    ResourceMark rm;
+
+    ParCompactionManager* cm =
+      ParCompactionManager::gc_thread_compaction_manager(_worker_id);
+
+    ParCompactionManager::MarkAndPushClosure mark_and_push_closure(cm);
+    MarkingCodeBlobClosure mark_and_push_in_blobs(&mark_and_push_closure, !CodeBlobToOopClosure::FixRelocations);
+
+    thread->oops_do(&mark_and_push_closure, &mark_and_push_in_blobs);
+
+    // Do the real work
+    cm->follow_marking_stacks();
+  }
+};
+
+MarkFromRootsTask::MarkFromRootsTask(uint active_workers) :
+  AbstractGangTask("MarkFromRootsTask"),
+  _strong_roots_scope(active_workers),
+  _subtasks(),
+  _terminator(active_workers, ParCompactionManager::stack_array()),
+  _active_workers(active_workers) {
+  _subtasks.set_n_threads(active_workers);
+  _subtasks.set_n_tasks(sentinel);
 }
 
+void MarkFromRootsTask::work(uint worker_id) {
+  for (uint task = 0; !_subtasks.is_task_claimed(task); /* empty */ ) {
+    mark_from_roots(RootType(task), worker_id);
+  }
+  _subtasks.all_tasks_completed();
+
+  // We scan the thread roots in parallel
+  PCThreadRootsMarkingClosure closure(worker_id);
+  Threads::possibly_parallel_threads_do(true /* is_par */, &closure);
+
+  if (_active_workers > 1) {
+    steal_marking_work(*_terminator.terminator(), worker_id);
+  }
+}
 
-void MarkFromRootsTask::do_it(GCTaskManager* manager, uint which) {
+void MarkFromRootsTask::mark_from_roots(RootType root_type, uint worker_id) {
   assert(ParallelScavengeHeap::heap()->is_gc_active(), "called outside gc");
 
   ParCompactionManager* cm =
-    ParCompactionManager::gc_thread_compaction_manager(which);
+    ParCompactionManager::gc_thread_compaction_manager(worker_id);
   ParCompactionManager::MarkAndPushClosure mark_and_push_closure(cm);
 
-  switch (_root_type) {
+  switch (root_type) {
     case universe:
       Universe::oops_do(&mark_and_push_closure);
       break;
@@ -84,14 +169,6 @@ void MarkFromRootsTask::do_it(GCTaskManager* manager, uint which) {
       JNIHandles::oops_do(&mark_and_push_closure);
       break;
 
-    case threads:
-    {
-      ResourceMark rm;
-      MarkingCodeBlobClosure each_active_code_blob(&mark_and_push_closure, !CodeBlobToOopClosure::FixRelocations);
-      Threads::oops_do(&mark_and_push_closure, &each_active_code_blob);
-    }
-    break;
-
     case object_synchronizer:
       ObjectSynchronizer::oops_do(&mark_and_push_closure);
       break;
@@ -130,19 +207,29 @@ void MarkFromRootsTask::do_it(GCTaskManager* manager, uint which) {
 
 
 //
-// RefProcTaskProxy
+// PCRefProcTask
 //
 
-void RefProcTaskProxy::do_it(GCTaskManager* manager, uint which)
-{
+PCRefProcTask::PCRefProcTask(ProcessTask& task, uint active_workers) :
+  AbstractGangTask("PCRefProcTask"),
+  _task(task),
+  _active_workers(active_workers),
+  _terminator(active_workers, ParCompactionManager::stack_array()) {
+}
+
+void PCRefProcTask::work(uint worker_id) {
   assert(ParallelScavengeHeap::heap()->is_gc_active(), "called outside gc");
 
   ParCompactionManager* cm =
-    ParCompactionManager::gc_thread_compaction_manager(which);
+    ParCompactionManager::gc_thread_compaction_manager(worker_id);
   ParCompactionManager::MarkAndPushClosure mark_and_push_closure(cm);
   ParCompactionManager::FollowStackClosure follow_stack_closure(cm);
-  _rp_task.work(_work_id, *PSParallelCompact::is_alive_closure(),
-                mark_and_push_closure, follow_stack_closure);
+  _task.work(worker_id, *PSParallelCompact::is_alive_closure(),
+             mark_and_push_closure, follow_stack_closure);
+
+  if (_task.marks_oops_alive() && _active_workers > 1) {
+    steal_marking_work(*_terminator.terminator(), worker_id);
+  }
 }
 
 //
@@ -151,104 +238,70 @@ void RefProcTaskProxy::do_it(GCTaskManager* manager, uint which)
 
 void RefProcTaskExecutor::execute(ProcessTask& task, uint ergo_workers)
 {
-  ParallelScavengeHeap* heap = ParallelScavengeHeap::heap();
-  uint active_gc_threads = heap->gc_task_manager()->active_workers();
+  WorkGang* workers = ParallelScavengeHeap::heap()->workers();
+  uint active_gc_threads = workers->active_workers();
   assert(active_gc_threads == ergo_workers,
          "Ergonomically chosen workers (%u) must be equal to active workers (%u)",
          ergo_workers, active_gc_threads);
-  OopTaskQueueSet* qset = ParCompactionManager::stack_array();
-  TaskTerminator terminator(active_gc_threads, qset);
-
-  GCTaskQueue* q = GCTaskQueue::create();
-  for(uint i=0; i<active_gc_threads; i++) {
-    q->enqueue(new RefProcTaskProxy(task, i));
-  }
-  if (task.marks_oops_alive() && (active_gc_threads>1)) {
-    for (uint j=0; j<active_gc_threads; j++) {
-      q->enqueue(new StealMarkingTask(terminator.terminator()));
-    }
-  }
-  PSParallelCompact::gc_task_manager()->execute_and_wait(q);
+  PCRefProcTask proc_task(task, active_gc_threads);
+  workers->run_task(&proc_task);
 }
 
 //
-// StealMarkingTask
+// UpdateDensePrefixTaskQueue
 //
 
-StealMarkingTask::StealMarkingTask(ParallelTaskTerminator* t) :
-  _terminator(t) {}
+UpdateDensePrefixTaskQueue::UpdateDensePrefixTaskQueue(uint size) :
+  _counter(0),
+  _size(size),
+  _insert_index(0),
+  _backing_array(NEW_C_HEAP_ARRAY(UpdateDensePrefixTask, size, mtGC)) {
+}
 
-void StealMarkingTask::do_it(GCTaskManager* manager, uint which) {
-  assert(ParallelScavengeHeap::heap()->is_gc_active(), "called outside gc");
+UpdateDensePrefixTaskQueue::~UpdateDensePrefixTaskQueue() {
+  assert(_counter >= _insert_index, "not all queue elements were claimed");
+  FREE_C_HEAP_ARRAY(UpdateDensePrefixTask, _backing_array);
+}
 
-  ParCompactionManager* cm =
-    ParCompactionManager::gc_thread_compaction_manager(which);
-  ParCompactionManager::MarkAndPushClosure mark_and_push_closure(cm);
+void UpdateDensePrefixTaskQueue::push(const UpdateDensePrefixTask& value) {
+  assert(_insert_index < _size, "too small backing array");
+  _backing_array[_insert_index++] = value;
+}
 
-  oop obj = NULL;
-  ObjArrayTask task;
-  do {
-    while (ParCompactionManager::steal_objarray(which,  task)) {
-      cm->follow_contents((objArrayOop)task.obj(), task.index());
-      cm->follow_marking_stacks();
-    }
-    while (ParCompactionManager::steal(which, obj)) {
-      cm->follow_contents(obj);
-      cm->follow_marking_stacks();
-    }
-  } while (!terminator()->offer_termination());
+bool UpdateDensePrefixTaskQueue::try_claim(UpdateDensePrefixTask& reference) {
+  // Subtract one so that the first claimed index is zero
+  uint claimed = Atomic::add(1u, &_counter) - 1;
+  if (claimed < _insert_index) {
+    reference = _backing_array[claimed];
+    return true;
+  }
+  return false;
 }
 
 //
-// CompactionWithStealingTask
+// UpdateDensePrefixAndCompactionTask
 //
 
-CompactionWithStealingTask::CompactionWithStealingTask(ParallelTaskTerminator* t):
-  _terminator(t) {}
-
-void CompactionWithStealingTask::do_it(GCTaskManager* manager, uint which) {
-  assert(ParallelScavengeHeap::heap()->is_gc_active(), "called outside gc");
+UpdateDensePrefixAndCompactionTask::UpdateDensePrefixAndCompactionTask(
+                                   UpdateDensePrefixTaskQueue& tq,
+                                   uint active_workers) :
+  AbstractGangTask("UpdateDensePrefixAndCompactionTask"),
+  _tq(tq),
+  _terminator(active_workers, ParCompactionManager::region_array()) {
+}
 
+void UpdateDensePrefixAndCompactionTask::work(uint worker_id) {
   ParCompactionManager* cm =
-    ParCompactionManager::gc_thread_compaction_manager(which);
+    ParCompactionManager::gc_thread_compaction_manager(worker_id);
 
-  // Drain the stacks that have been preloaded with regions
-  // that are ready to fill.
-
-  cm->drain_region_stacks();
-
-  guarantee(cm->region_stack()->is_empty(), "Not empty");
-
-  size_t region_index = 0;
-
-  while(true) {
-    if (ParCompactionManager::steal(which, region_index)) {
-      PSParallelCompact::fill_and_update_region(cm, region_index);
-      cm->drain_region_stacks();
-    } else {
-      if (terminator()->offer_termination()) {
-        break;
-      }
-      // Go around again.
-    }
+  for (UpdateDensePrefixTask task; _tq.try_claim(task); /* empty */ ) {
+    PSParallelCompact::update_and_deadwood_in_dense_prefix(cm,
+                                                           task._space_id,
+                                                           task._region_index_start,
+                                                           task._region_index_end);
   }
-  return;
-}
-
-UpdateDensePrefixTask::UpdateDensePrefixTask(
-                                   PSParallelCompact::SpaceId space_id,
-                                   size_t region_index_start,
-                                   size_t region_index_end) :
-  _space_id(space_id), _region_index_start(region_index_start),
-  _region_index_end(region_index_end) {}
-
-void UpdateDensePrefixTask::do_it(GCTaskManager* manager, uint which) {
-
-  ParCompactionManager* cm =
-    ParCompactionManager::gc_thread_compaction_manager(which);
 
-  PSParallelCompact::update_and_deadwood_in_dense_prefix(cm,
-                                                         _space_id,
-                                                         _region_index_start,
-                                                         _region_index_end);
+  // Once a thread has drained it's stack, it should try to steal regions from
+  // other threads.
+  compaction_with_stealing_work(*_terminator.terminator(), worker_id);
 }
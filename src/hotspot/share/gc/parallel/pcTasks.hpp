@@ -25,184 +25,166 @@
 #ifndef SHARE_VM_GC_PARALLEL_PCTASKS_HPP
 #define SHARE_VM_GC_PARALLEL_PCTASKS_HPP
 
-#include "gc/parallel/gcTaskManager.hpp"
 #include "gc/parallel/psParallelCompact.hpp"
-#include "gc/parallel/psTasks.hpp"
+#include "gc/shared/referenceProcessor.hpp"
+#include "gc/shared/strongRootsScope.hpp"
+#include "gc/shared/taskqueue.hpp"
+#include "gc/shared/workgroup.hpp"
 
 
 // Tasks for parallel compaction of the old generation
 //
-// Tasks are created and enqueued on a task queue. The
-// tasks for parallel old collector for marking objects
-// are MarkFromRootsTask and ThreadRootsMarkingTask.
+// The tasks are run by the work gang of the ParallelScavengeHeap, one
+// instance of each task being shared by all the active workers. A worker
+// uses the ParCompactionManager that matches its worker id.
 //
-// MarkFromRootsTask's are created
-// with a root group (e.g., jni_handles) and when the do_it()
-// method of a MarkFromRootsTask is executed, it starts marking
-// form it's root group.
+// MarkFromRootsTask marks from the roots to all live objects. The root
+// groups (e.g., jni_handles) are claimed by the workers one at a time,
+// and the Java threads and the VM thread are claimed individually so
+// that thread roots are marked in parallel. Once a worker runs out of
+// roots it steals references from the marking stacks of the other
+// workers until all of them agree to terminate.
 //
-// ThreadRootsMarkingTask's are created for each Java thread.  When
-// the do_it() method of a ThreadRootsMarkingTask is executed, it
-// starts marking from the thread's roots.
+// PCRefProcTask runs the reference processor's tasks in parallel, and
+// steals marking work in the same way when the phase keeps referents
+// alive.
 //
-// The enqueueing of the MarkFromRootsTask and ThreadRootsMarkingTask
-// do little more than create the task and put it on a queue.  The
-// queue is a GCTaskQueue and threads steal tasks from this GCTaskQueue.
-//
-// In addition to the MarkFromRootsTask and ThreadRootsMarkingTask
-// tasks there are StealMarkingTask tasks.  The StealMarkingTask's
-// steal a reference from the marking stack of another
-// thread and transitively marks the object of the reference
-// and internal references.  After successfully stealing a reference
-// and marking it, the StealMarkingTask drains its marking stack
-// stack before attempting another steal.
-//
-// ThreadRootsMarkingTask
-//
-// This task marks from the roots of a single thread. This task
-// enables marking of thread roots in parallel.
+// UpdateDensePrefixAndCompactionTask first claims slices of the dense
+// prefixes to update, then fills the regions preloaded on its region
+// stack and steals regions from the other workers' stacks. Each worker
+// thus takes dense prefix work only while there is some left, and moves
+// on to compaction as soon as the queue is empty.
 //
 
 class ParallelTaskTerminator;
 
-class ThreadRootsMarkingTask : public GCTask {
- private:
-  Thread* _thread;
-
- public:
-  ThreadRootsMarkingTask(Thread* root) : _thread(root) {}
-
-  char* name() { return (char *)"thread-roots-marking-task"; }
-
-  virtual void do_it(GCTaskManager* manager, uint which);
-};
-
-
 //
 // MarkFromRootsTask
 //
 // This task marks from all the roots to all live
 // objects.
 //
-//
 
-class MarkFromRootsTask : public GCTask {
+class MarkFromRootsTask : public AbstractGangTask {
  public:
   enum RootType {
-    universe              = 1,
-    jni_handles           = 2,
-    threads               = 3,
-    object_synchronizer   = 4,
-    management            = 5,
-    jvmti                 = 6,
-    system_dictionary     = 7,
-    class_loader_data     = 8,
-    code_cache            = 9
+    universe,
+    jni_handles,
+    object_synchronizer,
+    management,
+    jvmti,
+    system_dictionary,
+    class_loader_data,
+    code_cache,
+    sentinel
   };
  private:
-  RootType _root_type;
- public:
-  MarkFromRootsTask(RootType value) : _root_type(value) {}
+  StrongRootsScope       _strong_roots_scope; // Claims the threads
+  SequentialSubTasksDone _subtasks;
+  TaskTerminator         _terminator;
+  uint                   _active_workers;
 
-  char* name() { return (char *)"mark-from-roots-task"; }
+  static void mark_from_roots(RootType root_type, uint worker_id);
+
+ public:
+  MarkFromRootsTask(uint active_workers);
 
-  virtual void do_it(GCTaskManager* manager, uint which);
+  virtual void work(uint worker_id);
 };
 
 //
-// RefProcTaskProxy
+// PCRefProcTask
 //
 // This task is used as a proxy to parallel reference processing tasks .
 //
 
-class RefProcTaskProxy : public GCTask {
+class PCRefProcTask : public AbstractGangTask {
   typedef AbstractRefProcTaskExecutor::ProcessTask ProcessTask;
-  ProcessTask & _rp_task;
-  uint          _work_id;
-public:
-  RefProcTaskProxy(ProcessTask & rp_task, uint work_id)
-    : _rp_task(rp_task),
-      _work_id(work_id)
-  { }
-
-private:
-  virtual char* name() { return (char *)"Process referents by policy in parallel"; }
-
-  virtual void do_it(GCTaskManager* manager, uint which);
-};
+  ProcessTask&   _task;
+  uint           _active_workers;
+  TaskTerminator _terminator;
 
+ public:
+  PCRefProcTask(ProcessTask& task, uint active_workers);
+
+  virtual void work(uint worker_id);
+};
 
 //
 // RefProcTaskExecutor
 //
 // Task executor is an interface for the reference processor to run
-// tasks using GCTaskManager.
+// tasks using the work gang.
 //
 
 class RefProcTaskExecutor: public AbstractRefProcTaskExecutor {
   virtual void execute(ProcessTask& task, uint ergo_workers);
 };
 
-
 //
-// StealMarkingTask
+// UpdateDensePrefixTask
 //
-// This task is used to distribute work to idle threads.
+// A slice of the dense prefix of a space to be updated.
 //
 
-class StealMarkingTask : public GCTask {
- private:
-   ParallelTaskTerminator* const _terminator;
- private:
-
+class UpdateDensePrefixTask {
  public:
-  char* name() { return (char *)"steal-marking-task"; }
-
-  StealMarkingTask(ParallelTaskTerminator* t);
+  PSParallelCompact::SpaceId _space_id;
+  size_t _region_index_start;
+  size_t _region_index_end;
 
-  ParallelTaskTerminator* terminator() { return _terminator; }
+  UpdateDensePrefixTask() :
+    _space_id(PSParallelCompact::SpaceId(0)),
+    _region_index_start(0),
+    _region_index_end(0) {}
 
-  virtual void do_it(GCTaskManager* manager, uint which);
+  UpdateDensePrefixTask(PSParallelCompact::SpaceId space_id,
+                        size_t region_index_start,
+                        size_t region_index_end) :
+    _space_id(space_id),
+    _region_index_start(region_index_start),
+    _region_index_end(region_index_end) {}
 };
 
 //
-// CompactionWithStealingTask
+// UpdateDensePrefixTaskQueue
 //
-// This task is used to distribute work to idle threads.
+// A fixed size array of dense prefix slices, filled before the
+// compaction starts and claimed by the workers in order.
 //
 
-class CompactionWithStealingTask : public GCTask {
+class UpdateDensePrefixTaskQueue : public StackObj {
  private:
-   ParallelTaskTerminator* const _terminator;
- public:
-  CompactionWithStealingTask(ParallelTaskTerminator* t);
+  volatile uint          _counter;
+  uint                   _size;
+  uint                   _insert_index;
+  UpdateDensePrefixTask* _backing_array;
 
-  char* name() { return (char *)"steal-region-task"; }
-  ParallelTaskTerminator* terminator() { return _terminator; }
+ public:
+  UpdateDensePrefixTaskQueue(uint size);
+  ~UpdateDensePrefixTaskQueue();
 
-  virtual void do_it(GCTaskManager* manager, uint which);
+  void push(const UpdateDensePrefixTask& value);
+  bool try_claim(UpdateDensePrefixTask& reference);
 };
 
 //
-// UpdateDensePrefixTask
+// UpdateDensePrefixAndCompactionTask
 //
-// This task is used to update the dense prefix
-// of a space.
+// This task updates the dense prefixes, and then fills the regions
+// that are ready, stealing regions from other workers when its own
+// region stack is empty.
 //
 
-class UpdateDensePrefixTask : public GCTask {
+class UpdateDensePrefixAndCompactionTask : public AbstractGangTask {
  private:
-  PSParallelCompact::SpaceId _space_id;
-  size_t _region_index_start;
-  size_t _region_index_end;
+  UpdateDensePrefixTaskQueue& _tq;
+  TaskTerminator              _terminator;
 
  public:
-  char* name() { return (char *)"update-dense_prefix-task"; }
-
-  UpdateDensePrefixTask(PSParallelCompact::SpaceId space_id,
-                        size_t region_index_start,
-                        size_t region_index_end);
+  UpdateDensePrefixAndCompactionTask(UpdateDensePrefixTaskQueue& tq,
+                                     uint active_workers);
 
-  virtual void do_it(GCTaskManager* manager, uint which);
+  virtual void work(uint worker_id);
 };
 #endif // SHARE_VM_GC_PARALLEL_PCTASKS_HPP
@@ -40,10 +40,10 @@ class ParCompactionManager : public CHeapObj<mtGC> {
   friend class ParallelTaskTerminator;
   friend class ParMarkBitMap;
   friend class PSParallelCompact;
-  friend class CompactionWithStealingTask;
   friend class UpdateAndFillClosure;
-  friend class RefProcTaskExecutor;
-  friend class IdleGCTask;
+  friend class MarkFromRootsTask;
+  friend class PCRefProcTask;
+  friend class UpdateDensePrefixAndCompactionTask;
 
  public:
 
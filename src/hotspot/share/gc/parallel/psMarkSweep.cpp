@@ -35,6 +35,7 @@
 #include "gc/parallel/psMarkSweepDecorator.hpp"
 #include "gc/parallel/psOldGen.hpp"
 #include "gc/parallel/psScavenge.hpp"
+#include "gc/parallel/psStringDedup.hpp"
 #include "gc/parallel/psYoungGen.hpp"
 #include "gc/serial/markSweep.hpp"
 #include "gc/shared/gcCause.hpp"
@@ -49,13 +50,16 @@
 #include "gc/shared/referenceProcessor.hpp"
 #include "gc/shared/referenceProcessorPhaseTimes.hpp"
 #include "gc/shared/spaceDecorator.hpp"
+#include "gc/shared/strongRootsScope.hpp"
 #include "gc/shared/weakProcessor.hpp"
+#include "gc/shared/workgroup.hpp"
 #include "logging/log.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/biasedLocking.hpp"
 #include "runtime/flags/flagSetting.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/safepoint.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/vmThread.hpp"
 #include "services/management.hpp"
 #include "services/memoryService.hpp"
@@ -196,6 +200,13 @@ bool PSMarkSweep::invoke_no_policy(bool clear_all_softrefs) {
     size_t old_gen_prev_used = old_gen->used_in_bytes();
     size_t young_gen_prev_used = young_gen->used_in_bytes();
 
+    // Set the number of GC threads used for adjusting pointers and
+    // restoring marks
+    WorkGang* workers = heap->workers();
+    workers->update_active_workers(
+      AdaptiveSizePolicy::calc_active_workers(workers,
+                                              Threads::number_of_non_daemon_threads()));
+
     allocate_stacks();
 
 #if COMPILER2_OR_JVMCI
@@ -219,7 +230,7 @@ bool PSMarkSweep::invoke_no_policy(bool clear_all_softrefs) {
 
     mark_sweep_phase4();
 
-    restore_marks();
+    restore_marks_in_parallel();
 
     deallocate_stacks();
 
@@ -572,6 +583,13 @@ void PSMarkSweep::mark_sweep_phase1(bool clear_all_softrefs) {
     StringTable::unlink(is_alive_closure());
   }
 
+  if (PSStringDedup::is_enabled()) {
+    GCTraceTime(Debug, gc, phases) t("String Deduplication", _gc_timer);
+    // Remove entries for dead strings and arrays; the rest are adjusted in phase 3.
+    PSStringDedup::parallel_unlink_or_oops_do(is_alive_closure(), NULL,
+                                              false /* allow_resize_and_rehash */);
+  }
+
   {
     GCTraceTime(Debug, gc, phases) t("Scrub Symbol Table", _gc_timer);
     // Clean up unreferenced symbols in symbol table.
@@ -601,43 +619,215 @@ void PSMarkSweep::mark_sweep_phase2() {
   old_gen->precompact();
 }
 
+// Adjusts the roots, the preserved marks and the spaces in parallel. The
+// root groups are claimed one at a time, the Java threads individually, and
+// the spaces in chunks found during phase 2.
+class PSAdjustPointersTask : public AbstractGangTask {
+ public:
+  enum RootType {
+    universe,
+    jni_handles,
+    object_synchronizer,
+    management,
+    jvmti,
+    system_dictionary,
+    class_loader_data,
+    weak_roots,
+    code_cache,
+    string_table,
+    reference_processors,
+    preserved_marks,
+    sentinel
+  };
+
+ private:
+  static const int NumSpaces = 4;
+
+  StrongRootsScope       _strong_roots_scope; // Claims the threads
+  SequentialSubTasksDone _subtasks;
+  PSMarkSweepDecorator*  _spaces[NumSpaces];
+  volatile int           _claimed_chunk;
+
+  void adjust_roots(RootType root_type) {
+    OopClosure* adjust_pointer_closure = &MarkSweep::adjust_pointer_closure;
+    switch (root_type) {
+      case universe:
+        Universe::oops_do(adjust_pointer_closure);
+        break;
+
+      case jni_handles:
+        JNIHandles::oops_do(adjust_pointer_closure);   // Global (strong) JNI handles
+        break;
+
+      case object_synchronizer:
+        ObjectSynchronizer::oops_do(adjust_pointer_closure);
+        break;
+
+      case management:
+        Management::oops_do(adjust_pointer_closure);
+        break;
+
+      case jvmti:
+        JvmtiExport::oops_do(adjust_pointer_closure);
+        break;
+
+      case system_dictionary:
+        SystemDictionary::oops_do(adjust_pointer_closure);
+        break;
+
+      case class_loader_data:
+        ClassLoaderDataGraph::cld_do(&MarkSweep::adjust_cld_closure);
+        break;
+
+      case weak_roots:
+        // Now adjust pointers in remaining weak roots.  (All of which should
+        // have been cleared if they pointed to non-surviving objects.)
+        // Global (weak) JNI handles
+        WeakProcessor::oops_do(adjust_pointer_closure);
+        break;
+
+      case code_cache: {
+          CodeBlobToOopClosure adjust_from_blobs(adjust_pointer_closure, CodeBlobToOopClosure::FixRelocations);
+          CodeCache::blobs_do(&adjust_from_blobs);
+          AOTLoader::oops_do(adjust_pointer_closure);
+        }
+        break;
+
+      case string_table:
+        StringTable::oops_do(adjust_pointer_closure);
+        break;
+
+      case reference_processors:
+        MarkSweep::ref_processor()->weak_oops_do(adjust_pointer_closure);
+        PSScavenge::reference_processor()->weak_oops_do(adjust_pointer_closure);
+        break;
+
+      case preserved_marks:
+        MarkSweep::adjust_marks();
+        break;
+
+      default:
+        fatal("Unknown root type");
+    }
+  }
+
+  bool claim_chunk(PSMarkSweepDecorator*& space, int& index) {
+    int claimed = Atomic::add(1, &_claimed_chunk) - 1;
+    for (int i = 0; i < NumSpaces; i++) {
+      if (claimed < _spaces[i]->adjust_chunks()) {
+        space = _spaces[i];
+        index = claimed;
+        return true;
+      }
+      claimed -= _spaces[i]->adjust_chunks();
+    }
+    return false;
+  }
+
+ public:
+  PSAdjustPointersTask(uint active_workers) :
+      AbstractGangTask("PSAdjustPointersTask"),
+      _strong_roots_scope(active_workers),
+      _subtasks(),
+      _claimed_chunk(0) {
+    ParallelScavengeHeap* heap = ParallelScavengeHeap::heap();
+    _spaces[0] = heap->old_gen()->object_mark_sweep();
+    _spaces[1] = heap->young_gen()->eden_mark_sweep();
+    _spaces[2] = heap->young_gen()->from_mark_sweep();
+    _spaces[3] = heap->young_gen()->to_mark_sweep();
+    _subtasks.set_n_threads(active_workers);
+    _subtasks.set_n_tasks(sentinel);
+  }
+
+  void work(uint worker_id) {
+    for (uint task = 0; !_subtasks.is_task_claimed(task); /* empty */ ) {
+      adjust_roots(RootType(task));
+    }
+    _subtasks.all_tasks_completed();
+
+    Threads::possibly_parallel_oops_do(true /* is_par */, &MarkSweep::adjust_pointer_closure, NULL);
+
+    PSMarkSweepDecorator* space = NULL;
+    int index = 0;
+    while (claim_chunk(space, index)) {
+      space->adjust_pointers_in_chunk(index);
+    }
+  }
+};
+
 void PSMarkSweep::mark_sweep_phase3() {
   // Adjust the pointers to reflect the new locations
   GCTraceTime(Info, gc, phases) tm("Phase 3: Adjust pointers", _gc_timer);
 
-  ParallelScavengeHeap* heap = ParallelScavengeHeap::heap();
-  PSYoungGen* young_gen = heap->young_gen();
-  PSOldGen* old_gen = heap->old_gen();
-
   // Need to clear claim bits before the tracing starts.
   ClassLoaderDataGraph::clear_claimed_marks();
 
-  // General strong roots.
-  Universe::oops_do(adjust_pointer_closure());
-  JNIHandles::oops_do(adjust_pointer_closure());   // Global (strong) JNI handles
-  Threads::oops_do(adjust_pointer_closure(), NULL);
-  ObjectSynchronizer::oops_do(adjust_pointer_closure());
-  Management::oops_do(adjust_pointer_closure());
-  JvmtiExport::oops_do(adjust_pointer_closure());
-  SystemDictionary::oops_do(adjust_pointer_closure());
-  ClassLoaderDataGraph::cld_do(adjust_cld_closure());
-
-  // Now adjust pointers in remaining weak roots.  (All of which should
-  // have been cleared if they pointed to non-surviving objects.)
-  // Global (weak) JNI handles
-  WeakProcessor::oops_do(adjust_pointer_closure());
-
-  CodeBlobToOopClosure adjust_from_blobs(adjust_pointer_closure(), CodeBlobToOopClosure::FixRelocations);
-  CodeCache::blobs_do(&adjust_from_blobs);
-  AOTLoader::oops_do(adjust_pointer_closure());
-  StringTable::oops_do(adjust_pointer_closure());
-  ref_processor()->weak_oops_do(adjust_pointer_closure());
-  PSScavenge::reference_processor()->weak_oops_do(adjust_pointer_closure());
-
-  adjust_marks();
-
-  young_gen->adjust_pointers();
-  old_gen->adjust_pointers();
+  WorkGang* workers = ParallelScavengeHeap::heap()->workers();
+  PSAdjustPointersTask task(workers->active_workers());
+  workers->run_task(&task);
+
+  if (PSStringDedup::is_enabled()) {
+    // The objects have not been moved yet, so the table must not be
+    // rehashed from the adjusted references.
+    PSStringDedup::parallel_unlink_or_oops_do(NULL, &MarkSweep::adjust_pointer_closure,
+                                              false /* allow_resize_and_rehash */);
+  }
+}
+
+// Restores the preserved marks stored in the to-space in chunks, and the
+// overflow stacks as a single piece of work.
+class PSRestoreMarksTask : public AbstractGangTask {
+ private:
+  static const size_t ChunkSize = 4 * K;
+
+  PreservedMark* const  _marks;
+  const size_t          _count;
+  volatile size_t       _claimed;
+  volatile bool         _overflow_claimed;
+  Stack<markOop, mtGC>& _mark_stack;
+  Stack<oop, mtGC>&     _oop_stack;
+
+ public:
+  PSRestoreMarksTask(PreservedMark* marks, size_t count,
+                     Stack<markOop, mtGC>& mark_stack, Stack<oop, mtGC>& oop_stack) :
+      AbstractGangTask("PSRestoreMarksTask"),
+      _marks(marks),
+      _count(count),
+      _claimed(0),
+      _overflow_claimed(false),
+      _mark_stack(mark_stack),
+      _oop_stack(oop_stack) { }
+
+  void work(uint worker_id) {
+    if (!_overflow_claimed && !Atomic::cmpxchg(true, &_overflow_claimed, false)) {
+      // deal with the overflow
+      while (!_oop_stack.is_empty()) {
+        oop obj       = _oop_stack.pop();
+        markOop mark  = _mark_stack.pop();
+        obj->set_mark_raw(mark);
+      }
+    }
+
+    // restore the marks we saved earlier
+    for (size_t start = Atomic::add(ChunkSize, &_claimed) - ChunkSize;
+         start < _count;
+         start = Atomic::add(ChunkSize, &_claimed) - ChunkSize) {
+      size_t end = MIN2(start + ChunkSize, _count);
+      for (size_t i = start; i < end; i++) {
+        _marks[i].restore();
+      }
+    }
+  }
+};
+
+void PSMarkSweep::restore_marks_in_parallel() {
+  assert(_preserved_oop_stack.size() == _preserved_mark_stack.size(),
+         "inconsistent preserved oop stacks");
+  log_trace(gc)("Restoring " SIZE_FORMAT " marks", _preserved_count + _preserved_oop_stack.size());
+
+  PSRestoreMarksTask task(_preserved_marks, _preserved_count,
+                          _preserved_mark_stack, _preserved_oop_stack);
+  ParallelScavengeHeap::heap()->workers()->run_task(&task);
 }
 
 void PSMarkSweep::mark_sweep_phase4() {
@@ -59,6 +59,9 @@ class PSMarkSweep : public MarkSweep {
   // Move objects to new positions
   static void mark_sweep_phase4();
 
+  // Restore the preserved marks with the work gang
+  static void restore_marks_in_parallel();
+
   // Temporary data structures for traversal and storing/restoring marks
   static void allocate_stacks();
   static void deallocate_stacks();
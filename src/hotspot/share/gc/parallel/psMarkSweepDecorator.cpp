@@ -110,6 +110,9 @@ void PSMarkSweepDecorator::precompact() {
                                    live object. */
   HeapWord*  first_dead = space()->end(); /* The first dead object. */
 
+  _adjust_chunks->clear();
+  HeapWord* next_adjust_chunk = q;
+
   const intx interval = PrefetchScanIntervalInBytes;
 
   while (q < t) {
@@ -121,6 +124,11 @@ void PSMarkSweepDecorator::precompact() {
       Prefetch::write(q, interval);
       size_t size = oop(q)->size();
 
+      if (q >= next_adjust_chunk) {
+        _adjust_chunks->append(q);
+        next_adjust_chunk = q + AdjustChunkWords;
+      }
+
       size_t compaction_max_size = pointer_delta(compact_end, compact_top);
 
       // This should only happen if a space in the young gen overflows the
@@ -183,6 +191,11 @@ void PSMarkSweepDecorator::precompact() {
         if (insert_deadspace(allowed_deadspace, q, sz)) {
           size_t compaction_max_size = pointer_delta(compact_end, compact_top);
 
+          if (q >= next_adjust_chunk) {
+            _adjust_chunks->append(q);
+            next_adjust_chunk = q + AdjustChunkWords;
+          }
+
           // This should only happen if a space in the young gen overflows the
           // old gen. If that should happen, we null out the start_array, because
           // the young spaces are not covered by one.
@@ -272,18 +285,24 @@ bool PSMarkSweepDecorator::insert_deadspace(size_t& allowed_deadspace_words,
 void PSMarkSweepDecorator::adjust_pointers() {
   // adjust all the interior pointers to point at the new locations of objects
   // Used by MarkSweep::mark_sweep_phase3()
+  for (int i = 0; i < adjust_chunks(); i++) {
+    adjust_pointers_in_chunk(i);
+  }
+}
 
-  HeapWord* q = space()->bottom();
-  HeapWord* t = _end_of_live;  // Established by "prepare_for_compaction".
+void PSMarkSweepDecorator::adjust_pointers_in_chunk(int index) {
+  // A chunk starts at a live object and ends at the start of the next
+  // chunk, which is also a live object, or at the end of live data.
+  HeapWord* q = _adjust_chunks->at(index);
+  HeapWord* t = (index + 1 < adjust_chunks()) ? _adjust_chunks->at(index + 1) : _end_of_live;
 
   assert(_first_dead <= _end_of_live, "Stands to reason, no?");
 
-  if (q < t && _first_dead > q &&
-      !oop(q)->is_gc_marked()) {
+  if (q < _first_dead && !oop(space()->bottom())->is_gc_marked()) {
     // we have a chunk of the space which hasn't moved and we've
     // reinitialized the mark word during the previous pass, so we can't
     // use is_gc_marked for the traversal.
-    HeapWord* end = _first_dead;
+    HeapWord* end = MIN2(_first_dead, t);
 
     while (q < end) {
       // point all the oops to the new location
@@ -291,9 +310,8 @@ void PSMarkSweepDecorator::adjust_pointers() {
       q += size;
     }
 
-    if (_first_dead == t) {
-      q = t;
-    } else {
+    if (q < t) {
+      assert(q == _first_dead && _first_dead < _end_of_live, "must be at a dead object");
       // The first dead object should contain a pointer to the first live object
       q = *(HeapWord**)_first_dead;
     }
@@ -26,6 +26,7 @@
 #define SHARE_VM_GC_PARALLEL_PSMARKSWEEPDECORATOR_HPP
 
 #include "gc/parallel/mutableSpace.hpp"
+#include "utilities/growableArray.hpp"
 
 //
 // A PSMarkSweepDecorator is used to add "ParallelScavenge" style mark sweep operations
@@ -45,6 +46,9 @@ class PSMarkSweepDecorator: public CHeapObj<mtGC> {
   HeapWord* _end_of_live;
   HeapWord* _compaction_top;
   size_t _allowed_dead_ratio;
+  // Live objects recorded by precompact() at which the pointer
+  // adjustment can be split, at least AdjustChunkWords apart.
+  GrowableArray<HeapWord*>* _adjust_chunks;
 
   bool insert_deadspace(size_t& allowed_deadspace_words, HeapWord* q,
                         size_t word_len);
@@ -53,7 +57,10 @@ class PSMarkSweepDecorator: public CHeapObj<mtGC> {
   PSMarkSweepDecorator(MutableSpace* space, ObjectStartArray* start_array,
                        size_t allowed_dead_ratio) :
     _space(space), _start_array(start_array),
-    _allowed_dead_ratio(allowed_dead_ratio) { }
+    _allowed_dead_ratio(allowed_dead_ratio),
+    _adjust_chunks(new (ResourceObj::C_HEAP, mtGC) GrowableArray<HeapWord*>(0, true, mtGC)) { }
+
+  static const size_t AdjustChunkWords = 256 * K;
 
   // During a compacting collection, we need to collapse objects into
   // spaces in a given order. We want to fill space A, space B, and so
@@ -74,6 +81,9 @@ class PSMarkSweepDecorator: public CHeapObj<mtGC> {
 
   // Work methods
   void adjust_pointers();
+  // The pointers of the chunks can be adjusted in parallel
+  int adjust_chunks() const                 { return _adjust_chunks->length(); }
+  void adjust_pointers_in_chunk(int index);
   void precompact();
   void compact(bool mangle_free_space);
 };
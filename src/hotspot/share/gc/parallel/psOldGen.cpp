@@ -135,6 +135,8 @@ void PSOldGen::initialize_work(const char* perf_data_name, int level) {
   if (_object_space == NULL)
     vm_exit_during_initialization("Could not allocate an old gen space");
 
+  object_space()->set_numa_interleave(PSNUMAInterleaveOldGen);
+
   object_space()->initialize(cmr,
                              SpaceDecorator::Clear,
                              SpaceDecorator::Mangle);
@@ -238,7 +240,7 @@ void PSOldGen::expand(size_t bytes) {
   size_t aligned_bytes  = align_up(bytes, alignment);
   size_t aligned_expand_bytes = align_up(MinHeapDeltaBytes, alignment);
 
-  if (UseNUMA) {
+  if (UseNUMA && PSNUMAInterleaveOldGen) {
     // With NUMA we use round-robin page allocation for the old gen. Expand by at least
     // providing a page per lgroup. Alignment is larger or equal to the page size.
     aligned_expand_bytes = MAX2(aligned_expand_bytes, alignment * os::numa_get_groups_num());
@@ -86,6 +86,7 @@ void PSPromotionManager::initialize() {
   _preserved_marks_set->init(promotion_manager_num);
   for (uint i = 0; i < promotion_manager_num; i += 1) {
     _manager_array[i].register_preserved_marks(_preserved_marks_set->get(i));
+    _manager_array[i].set_string_dedup_queue(i);
   }
 }
 
@@ -120,6 +121,12 @@ void PSPromotionManager::pre_scavenge() {
   }
 }
 
+void PSPromotionManager::set_terminator(const ParallelTaskTerminator* terminator) {
+  for (uint i = 0; i < ParallelGCThreads + 1; i++) {
+    manager_array(i)->_array_chunker.set_terminator(terminator);
+  }
+}
+
 bool PSPromotionManager::post_scavenge(YoungGCTracer& gc_tracer) {
   bool promotion_failure_occurred = false;
 
@@ -212,12 +219,13 @@ PSPromotionManager::PSPromotionManager() {
                                      (uint) (queue_size / 4));
   }
 
-  _array_chunk_size = ParGCArrayScanChunk;
   // let's choose 1.5x the chunk size
-  _min_array_size_for_chunking = 3 * _array_chunk_size / 2;
+  _min_array_size_for_chunking = 3 * ParGCArrayScanChunk / 2;
 
   _preserved_marks = NULL;
 
+  _string_dedup_queue = 0;
+
   reset();
 }
 
@@ -376,9 +384,10 @@ void PSPromotionManager::process_array_chunk(oop old) {
 
   int start;
   int const end = arrayOop(old)->length();
-  if (end > (int) _min_array_size_for_chunking) {
+  int const chunk = _array_chunker.chunk_size(claimed_stack_depth()->size());
+  if (end > 3 * chunk / 2) {
     // we'll chunk more
-    start = end - _array_chunk_size;
+    start = end - chunk;
     assert(start > 0, "invariant");
     arrayOop(old)->set_length(start);
     push_depth(mask_chunked_array_oop(old));
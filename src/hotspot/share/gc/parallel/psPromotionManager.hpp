@@ -28,6 +28,7 @@
 #include "gc/parallel/psPromotionLAB.hpp"
 #include "gc/shared/copyFailedInfo.hpp"
 #include "gc/shared/gcTrace.hpp"
+#include "gc/shared/partialArrayChunker.hpp"
 #include "gc/shared/preservedMarks.hpp"
 #include "gc/shared/taskqueue.hpp"
 #include "memory/padded.hpp"
@@ -82,12 +83,15 @@ class PSPromotionManager {
   bool                                _totally_drain;
   uint                                _target_stack_size;
 
-  uint                                _array_chunk_size;
+  PartialArrayChunker                 _array_chunker;
   uint                                _min_array_size_for_chunking;
 
   PreservedMarks*                     _preserved_marks;
   PromotionFailedInfo                 _promotion_failed_info;
 
+  // Queue for the string deduplication candidates found by this manager.
+  uint                                _string_dedup_queue;
+
   // Accessors
   static PSOldGen* old_gen()         { return _old_gen; }
   static MutableSpace* young_space() { return _young_space; }
@@ -156,6 +160,10 @@ class PSPromotionManager {
   static void pre_scavenge();
   static bool post_scavenge(YoungGCTracer& gc_tracer);
 
+  // Set the terminator of the current phase for all promotion managers;
+  // it provides the number of idle workers for sizing array chunks.
+  static void set_terminator(const ParallelTaskTerminator* terminator);
+
   static PSPromotionManager* gc_thread_promotion_manager(uint index);
   static PSPromotionManager* vm_thread_promotion_manager();
 
@@ -179,6 +187,7 @@ class PSPromotionManager {
 
   void reset();
   void register_preserved_marks(PreservedMarks* preserved_marks);
+  void set_string_dedup_queue(uint queue) { _string_dedup_queue = queue; }
   static void restore_preserved_marks();
 
   void flush_labs();
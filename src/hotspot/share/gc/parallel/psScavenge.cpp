@@ -31,6 +31,7 @@
 #include "gc/parallel/psMarkSweepProxy.hpp"
 #include "gc/parallel/psParallelCompact.inline.hpp"
 #include "gc/parallel/psScavenge.inline.hpp"
+#include "gc/parallel/psStringDedup.hpp"
 #include "gc/parallel/psTasks.hpp"
 #include "gc/shared/collectorPolicy.hpp"
 #include "gc/shared/gcCause.hpp"
@@ -110,6 +111,39 @@ public:
   virtual void do_oop(narrowOop* p) { PSKeepAliveClosure::do_oop_work(p); }
 };
 
+// Updates the string deduplication queue and table entries for copied
+// objects. Entries for objects that were not copied have been removed by
+// the is-alive check, so unlike PSKeepAliveClosure this never copies and
+// can be used by several threads.
+// Deduplication candidates are enqueued with the copies made by this
+// scavenge. Those in to-space are live, although not forwarded.
+class PSStringDedupIsAliveClosure: public BoolObjectClosure {
+  MutableSpace* const _to_space;
+public:
+  PSStringDedupIsAliveClosure() :
+    _to_space(ParallelScavengeHeap::young_gen()->to_space()) {}
+
+  bool do_object_b(oop p) {
+    return !PSScavenge::is_obj_in_young(p) || p->is_forwarded() || _to_space->contains(p);
+  }
+};
+
+class PSStringDedupKeepAliveClosure: public OopClosure {
+  MutableSpace* const _to_space;
+public:
+  PSStringDedupKeepAliveClosure() :
+    _to_space(ParallelScavengeHeap::young_gen()->to_space()) {}
+
+  virtual void do_oop(oop* p) {
+    oop obj = RawAccess<IS_NOT_NULL>::oop_load(p);
+    if (PSScavenge::is_obj_in_young(obj) && !_to_space->contains(obj)) {
+      assert(obj->is_forwarded(), "dead objects must have been unlinked");
+      RawAccess<IS_NOT_NULL>::oop_store(p, obj->forwardee());
+    }
+  }
+  virtual void do_oop(narrowOop* p) { ShouldNotReachHere(); }
+};
+
 class PSEvacuateFollowersClosure: public VoidClosure {
  private:
   PSPromotionManager* _promotion_manager;
@@ -391,7 +425,9 @@ bool PSScavenge::invoke_no_policy() {
           }
         }
 
+      PSPromotionManager::set_terminator(terminator.terminator());
       gc_task_manager()->execute_and_wait(q);
+      PSPromotionManager::set_terminator(NULL);
     }
 
     scavenge_midpoint.update();
@@ -435,6 +471,14 @@ bool PSScavenge::invoke_no_policy() {
       StringTable::unlink_or_oops_do(&_is_alive_closure, &root_closure);
     }
 
+    if (PSStringDedup::is_enabled()) {
+      GCTraceTime(Debug, gc, phases) tm("String Deduplication", &_gc_timer);
+      PSStringDedupIsAliveClosure dedup_is_alive;
+      PSStringDedupKeepAliveClosure dedup_keep_alive;
+      PSStringDedup::parallel_unlink_or_oops_do(&dedup_is_alive, &dedup_keep_alive,
+                                                true /* allow_resize_and_rehash */);
+    }
+
     // Verify that usage of root_closure didn't copy any objects.
     assert(promotion_manager->stacks_empty(),"stacks should be empty at this point");
 
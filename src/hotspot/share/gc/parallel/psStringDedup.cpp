@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "classfile/javaClasses.inline.hpp"
+#include "gc/parallel/parallelScavengeHeap.hpp"
+#include "gc/parallel/psStringDedup.hpp"
+#include "gc/parallel/psStringDedupQueue.hpp"
+#include "gc/shared/stringdedup/stringDedup.inline.hpp"
+#include "gc/shared/stringdedup/stringDedupQueue.hpp"
+#include "gc/shared/stringdedup/stringDedupTable.hpp"
+#include "gc/shared/stringdedup/stringDedupThread.inline.hpp"
+#include "gc/shared/workgroup.hpp"
+#include "oops/oop.inline.hpp"
+
+void PSStringDedup::initialize() {
+  assert(UseParallelGC, "String deduplication available with Parallel GC");
+  StringDedup::initialize_impl<PSStringDedupQueue, StringDedupStat>();
+}
+
+bool PSStringDedup::is_candidate_from_evacuation(bool to_young, uint age, oop obj) {
+  if (java_lang_String::is_instance_inlined(obj)) {
+    if (to_young && age + 1 == StringDeduplicationAgeThreshold) {
+      // Candidate found. String is being copied from young to young and just
+      // reached the deduplication age threshold.
+      return true;
+    }
+    if (!to_young && age < StringDeduplicationAgeThreshold) {
+      // Candidate found. String is being promoted to old but has not
+      // reached the deduplication age threshold, i.e. has not previously
+      // been a candidate during its life in the young generation.
+      return true;
+    }
+  }
+
+  // Not a candidate
+  return false;
+}
+
+void PSStringDedup::enqueue_from_evacuation(bool to_young, uint age, uint queue, oop java_string) {
+  assert(is_enabled(), "String deduplication not enabled");
+  if (is_candidate_from_evacuation(to_young, age, java_string)) {
+    StringDedupQueue::push(queue, java_string);
+  }
+}
+
+//
+// Task for parallel unlink_or_oops_do() operation on the deduplication queue
+// and table.
+//
+class PSStringDedupUnlinkOrOopsDoTask : public AbstractGangTask {
+private:
+  StringDedupUnlinkOrOopsDoClosure _cl;
+
+public:
+  PSStringDedupUnlinkOrOopsDoTask(BoolObjectClosure* is_alive, OopClosure* keep_alive) :
+    AbstractGangTask("PSStringDedupUnlinkOrOopsDoTask"),
+    _cl(is_alive, keep_alive) { }
+
+  virtual void work(uint worker_id) {
+    StringDedup::parallel_unlink(&_cl, worker_id);
+  }
+};
+
+void PSStringDedup::parallel_unlink_or_oops_do(BoolObjectClosure* is_alive,
+                                               OopClosure* keep_alive,
+                                               bool allow_resize_and_rehash) {
+  assert(is_enabled(), "String deduplication not enabled");
+  gc_prologue(allow_resize_and_rehash);
+  {
+    PSStringDedupUnlinkOrOopsDoTask task(is_alive, keep_alive);
+    ParallelScavengeHeap::heap()->workers()->run_task(&task);
+  }
+  gc_epilogue();
+}
+
+void PSStringDedup::unlink_or_oops_do(BoolObjectClosure* is_alive,
+                                      OopClosure* keep_alive,
+                                      bool allow_resize_and_rehash) {
+  assert(is_enabled(), "String deduplication not enabled");
+  gc_prologue(allow_resize_and_rehash);
+  {
+    StringDedupUnlinkOrOopsDoClosure cl(is_alive, keep_alive);
+    parallel_unlink(&cl, 0 /* worker_id */);
+  }
+  gc_epilogue();
+}
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_VM_GC_PARALLEL_PSSTRINGDEDUP_HPP
+#define SHARE_VM_GC_PARALLEL_PSSTRINGDEDUP_HPP
+
+//
+// Parallel GC string deduplication candidate selection
+//
+// An object is considered a deduplication candidate if all of the following
+// statements are true:
+//
+// - The object is an instance of java.lang.String
+//
+// - The object is being copied by a young collection and
+//   - it is copied within the young generation and just reached the
+//     deduplication age threshold, or
+//   - it is promoted to the old generation but has not reached the
+//     deduplication age threshold, i.e. has not previously been a
+//     candidate during its life in the young generation.
+//
+// This is the same policy G1 applies at evacuation. Strings allocated
+// directly in, or only ever promoted by a full collection into, the old
+// generation are not considered.
+//
+
+#include "gc/shared/stringdedup/stringDedup.hpp"
+#include "memory/allocation.hpp"
+#include "oops/oop.hpp"
+
+class BoolObjectClosure;
+class OopClosure;
+
+//
+// Parallel GC interface for interacting with string deduplication.
+//
+class PSStringDedup : public StringDedup {
+private:
+  // Candidate selection policy, returns true if the given object is
+  // candidate for string deduplication.
+  static bool is_candidate_from_evacuation(bool to_young, uint age, oop obj);
+
+public:
+  // Initialize string deduplication.
+  static void initialize();
+
+  // Enqueues a deduplication candidate for later processing by the
+  // deduplication thread. The age is the age of the object before it was
+  // copied, and queue the index of the copying promotion manager.
+  static void enqueue_from_evacuation(bool to_young, uint age, uint queue, oop java_string);
+
+  // Unlinks dead entries from the deduplication queue and table and applies
+  // keep_alive to the live ones, using the heap's workers. Both closures
+  // must be MT-safe.
+  static void parallel_unlink_or_oops_do(BoolObjectClosure* is_alive,
+                                         OopClosure* keep_alive,
+                                         bool allow_resize_and_rehash);
+
+  // Same as above, but done by the calling thread only.
+  static void unlink_or_oops_do(BoolObjectClosure* is_alive,
+                                OopClosure* keep_alive,
+                                bool allow_resize_and_rehash);
+};
+
+#endif // SHARE_VM_GC_PARALLEL_PSSTRINGDEDUP_HPP
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "classfile/javaClasses.inline.hpp"
+#include "gc/parallel/parallelScavengeHeap.hpp"
+#include "gc/parallel/psStringDedupQueue.hpp"
+#include "gc/shared/stringdedup/stringDedup.hpp"
+#include "logging/log.hpp"
+#include "oops/oop.inline.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "runtime/safepointVerifiers.hpp"
+#include "utilities/stack.inline.hpp"
+
+const size_t        PSStringDedupQueue::_max_size = 1000000; // Max number of elements per queue
+const size_t        PSStringDedupQueue::_max_cache_size = 0; // Max cache size per queue
+
+PSStringDedupQueue::PSStringDedupQueue() :
+  _cursor(0),
+  _cancel(false),
+  _empty(true),
+  _dropped(0) {
+  // One queue for each promotion manager, see PSPromotionManager::initialize().
+  _nqueues = ParallelGCThreads + 1;
+  _queues = NEW_C_HEAP_ARRAY(PSStringDedupWorkerQueue, _nqueues, mtGC);
+  for (size_t i = 0; i < _nqueues; i++) {
+    new (_queues + i) PSStringDedupWorkerQueue(PSStringDedupWorkerQueue::default_segment_size(), _max_cache_size, _max_size);
+  }
+}
+
+PSStringDedupQueue::~PSStringDedupQueue() {
+  ShouldNotReachHere();
+}
+
+void PSStringDedupQueue::wait_impl() {
+  MonitorLockerEx ml(StringDedupQueue_lock, Mutex::_no_safepoint_check_flag);
+  while (_empty && !_cancel) {
+    ml.wait(Mutex::_no_safepoint_check_flag);
+  }
+}
+
+void PSStringDedupQueue::cancel_wait_impl() {
+  MonitorLockerEx ml(StringDedupQueue_lock, Mutex::_no_safepoint_check_flag);
+  _cancel = true;
+  ml.notify();
+}
+
+void PSStringDedupQueue::push_impl(uint worker_id, oop java_string) {
+  assert(SafepointSynchronize::is_at_safepoint(), "Must be at safepoint");
+  assert(worker_id < _nqueues, "Invalid queue");
+
+  // Push and notify waiter
+  PSStringDedupWorkerQueue& worker_queue = _queues[worker_id];
+  if (!worker_queue.is_full()) {
+    worker_queue.push(java_string);
+    if (_empty) {
+      MonitorLockerEx ml(StringDedupQueue_lock, Mutex::_no_safepoint_check_flag);
+      if (_empty) {
+        // Mark non-empty and notify waiter
+        _empty = false;
+        ml.notify();
+      }
+    }
+  } else {
+    // Queue is full, drop the string and update the statistics
+    Atomic::inc(&_dropped);
+  }
+}
+
+oop PSStringDedupQueue::pop_impl() {
+  assert(!SafepointSynchronize::is_at_safepoint(), "Must not be at safepoint");
+  NoSafepointVerifier nsv;
+
+  // Try all queues before giving up
+  for (size_t tries = 0; tries < _nqueues; tries++) {
+    // The cursor indicates where we left of last time
+    PSStringDedupWorkerQueue* queue = &_queues[_cursor];
+    while (!queue->is_empty()) {
+      oop obj = queue->pop();
+      // The oop we pop can be NULL if it was marked
+      // dead. Just ignore those and pop the next oop.
+      if (obj != NULL) {
+        return obj;
+      }
+    }
+
+    // Try next queue
+    _cursor = (_cursor + 1) % _nqueues;
+  }
+
+  // Mark empty
+  _empty = true;
+
+  return NULL;
+}
+
+void PSStringDedupQueue::unlink_or_oops_do_impl(StringDedupUnlinkOrOopsDoClosure* cl, size_t queue) {
+  assert(queue < _nqueues, "Invalid queue");
+  StackIterator<oop, mtGC> iter(_queues[queue]);
+  while (!iter.is_empty()) {
+    oop* p = iter.next_addr();
+    if (*p != NULL) {
+      if (cl->is_alive(*p)) {
+        cl->keep_alive(p);
+      } else {
+        // Clear dead reference
+        *p = NULL;
+      }
+    }
+  }
+}
+
+void PSStringDedupQueue::print_statistics_impl() {
+  log_debug(gc, stringdedup)("  Queue");
+  log_debug(gc, stringdedup)("    Dropped: " UINTX_FORMAT, _dropped);
+}
+
+void PSStringDedupQueue::verify_impl() {
+  for (size_t i = 0; i < _nqueues; i++) {
+    StackIterator<oop, mtGC> iter(_queues[i]);
+    while (!iter.is_empty()) {
+      oop obj = iter.next();
+      if (obj != NULL) {
+        guarantee(ParallelScavengeHeap::heap()->is_in_reserved(obj), "Object must be on the heap");
+        guarantee(!obj->is_forwarded(), "Object must not be forwarded");
+        guarantee(java_lang_String::is_instance(obj), "Object must be a String");
+      }
+    }
+  }
+}
@@ -30,6 +30,7 @@
 #include "gc/shared/softRefPolicy.hpp"
 #include "gc/shared/workgroup.hpp"
 #include "logging/log.hpp"
+#include "runtime/os.hpp"
 #include "runtime/timer.hpp"
 #include "utilities/ostream.hpp"
 
@@ -142,6 +143,13 @@ uint AdaptiveSizePolicy::calc_default_active_workers(uintx total_workers,
       MAX2(min_workers, (prev_active_workers + new_active_workers) / 2);
   }
 
+  // Do not use more workers than there are processors available right
+  // now; the quota of a container may change at any time.
+  if (AdaptGCWorkersToCPUQuota) {
+    uintx cpus = (uintx)MAX2(1, os::active_processor_count());
+    new_active_workers = MAX2(min_workers, MIN2(new_active_workers, cpus));
+  }
+
   // Check once more that the number of workers is within the limits.
   assert(min_workers <= total_workers, "Minimum workers not consistent with total workers");
   assert(new_active_workers >= min_workers, "Minimum workers not observed");
@@ -202,6 +210,30 @@ uint AdaptiveSizePolicy::calc_active_workers(uintx total_workers,
   return new_active_workers;
 }
 
+uint AdaptiveSizePolicy::calc_active_workers(AbstractWorkGang* gang,
+                                             uintx application_workers) {
+  uint total_workers = gang->total_workers();
+  uint new_active_workers = calc_active_workers(total_workers,
+                                                gang->active_workers(),
+                                                application_workers);
+  if (AdaptGCWorkersToParallelism && UseDynamicNumberOfGCThreads &&
+      (FLAG_IS_DEFAULT(ParallelGCThreads) || ForceDynamicNumberOfGCThreads)) {
+    // The measured parallelism can not exceed the number of workers that
+    // were used, so leave 25% headroom to be able to grow again.
+    double parallelism = gang->max_phase_parallelism();
+    if (parallelism > 0.0) {
+      uint min_workers = (total_workers == 1) ? 1 : 2;
+      uint useful_workers = MAX2(min_workers, (uint)ceil(parallelism * 1.25) + 1);
+      if (useful_workers < new_active_workers) {
+        log_trace(gc, task)("%s: parallelism %.2f limits workers from %u to %u",
+                            gang->name(), parallelism, new_active_workers, useful_workers);
+        new_active_workers = useful_workers;
+      }
+    }
+  }
+  return new_active_workers;
+}
+
 uint AdaptiveSizePolicy::calc_active_conc_workers(uintx total_workers,
                                                   uintx active_workers,
                                                   uintx application_workers) {
@@ -36,6 +36,7 @@
 // size of the heap.
 
 // Forward decls
+class AbstractWorkGang;
 class elapsedTimer;
 class SoftRefPolicy;
 
@@ -364,6 +365,12 @@ class AdaptiveSizePolicy : public CHeapObj<mtGC> {
                                   uintx active_workers,
                                   uintx application_workers);
 
+  // As above, for the workers of the given gang. With
+  // AdaptGCWorkersToParallelism the result is further limited by the
+  // parallelism measured for the tasks previously run on the gang.
+  static uint calc_active_workers(AbstractWorkGang* gang,
+                                  uintx application_workers);
+
   // Return number of GC threads to use in the next concurrent GC phase.
   static uint calc_active_conc_workers(uintx total_workers,
                                        uintx active_workers,
@@ -260,6 +260,12 @@ void CardTable::resize_covered_region(MemRegion new_region) {
       os::commit_memory_or_exit((char*)new_committed.start(),
                                 new_committed.byte_size(), _page_size,
                                 !ExecMem, "card table expansion");
+#ifdef LINUX
+      if (GCDataUseHugePages) {
+        extern void linux_advise_huge_pages(char* base, size_t size);
+        linux_advise_huge_pages((char*)new_committed.start(), new_committed.byte_size());
+      }
+#endif
     // Use new_end_aligned (as opposed to new_end_for_commit) because
     // the cur_committed region may include the guard region.
     } else if (new_end_aligned < cur_committed.end()) {
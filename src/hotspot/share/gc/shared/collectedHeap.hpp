@@ -237,6 +237,12 @@ class CollectedHeap : public CHeapObj<mtInternal> {
   // spaces).
   virtual size_t max_capacity() const = 0;
 
+  // Called when the memory available to the VM changed, e.g. because the
+  // container memory limit was resized, with the heap size derived from it.
+  // Collectors that support a soft maximum heap size adopt it unless the
+  // user configured one explicitly. Returns whether the value was adopted.
+  virtual bool update_soft_max_heap_size(size_t soft_max_heap_size) { return false; }
+
   // Returns "TRUE" if "p" points into the reserved area of the heap.
   bool is_in_reserved(const void* p) const {
     return _reserved.contains(p);
@@ -443,6 +449,13 @@ class CollectedHeap : public CHeapObj<mtInternal> {
   // over live objects.
   virtual void safe_object_iterate(ObjectClosure* cl) = 0;
 
+  // Iterate over the objects in about one in sample_rate parts of the
+  // heap, for approximate heap statistics. Returns false if the collector
+  // does not support sampled iteration.
+  virtual bool sampled_object_iterate(ObjectClosure* cl, uint sample_rate) {
+    return false;
+  }
+
   // NOTE! There is no requirement that a collector implement these
   // functions.
   //
@@ -28,6 +28,7 @@
 #include "runtime/arguments.hpp"
 #include "runtime/globals.hpp"
 #include "runtime/globals_extension.hpp"
+#include "runtime/os.hpp"
 #include "utilities/macros.hpp"
 
 void GCArguments::initialize() {
@@ -53,4 +54,15 @@ void GCArguments::initialize() {
     // If class unloading is disabled, also disable concurrent class unloading.
     FLAG_SET_CMDLINE(bool, ClassUnloadingWithConcurrentMark, false);
   }
+
+  // With many processors storing into the same card table cache lines,
+  // checking the card before dirtying it avoids most of the invalidation
+  // traffic at the price of a load per reference store. Not for CMS, whose
+  // concurrently scanned cards would also need a StoreLoad fence per store.
+  if ((UseSerialGC || UseParallelGC) &&
+      FLAG_IS_DEFAULT(UseCondCardMark) &&
+      CondCardMarkProcessorThreshold > 0 &&
+      (uint)os::active_processor_count() >= CondCardMarkProcessorThreshold) {
+    FLAG_SET_ERGO(bool, UseCondCardMark, true);
+  }
 }
@@ -39,6 +39,9 @@ public:
   virtual void initialize();
   virtual size_t conservative_max_heap_alignment() = 0;
   virtual CollectedHeap* create_heap() = 0;
+
+  // Can the heap be used with compressed oops? Queried before initialize().
+  virtual bool supports_compressed_oops() const { return true; }
 };
 
 #endif // SHARE_GC_SHARED_GCARGUMENTS_HPP
@@ -0,0 +1,352 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/shared/gcCause.hpp"
+#include "gc/shared/gcId.hpp"
+#include "gc/shared/gcName.hpp"
+#include "gc/shared/gcPhaseTimingRecorder.hpp"
+#include "gc/shared/gcTrace.hpp"
+#include "gc/shared/workerDataArray.inline.hpp"
+#include "memory/allocation.inline.hpp"
+#include "memory/resourceArea.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/orderAccess.hpp"
+#include "runtime/os.hpp"
+#include "runtime/perfData.hpp"
+#include "runtime/timer.hpp"
+#include "utilities/ostream.hpp"
+
+uint GCPhaseTimingRecorder::_capacity = 0;
+uint GCPhaseTimingRecorder::_max_workers = 0;
+GCPhaseTimingRecorder::Record** GCPhaseTimingRecorder::_records = NULL;
+volatile uint GCPhaseTimingRecorder::_next = 0;
+GCPhaseTimingRecorder::Record* GCPhaseTimingRecorder::_pending = NULL;
+
+PerfCounter*  GCPhaseTimingRecorder::_recorded = NULL;
+PerfVariable* GCPhaseTimingRecorder::_last_gc_id = NULL;
+PerfVariable* GCPhaseTimingRecorder::_last_duration = NULL;
+PerfVariable* GCPhaseTimingRecorder::_last_sum_of_pauses = NULL;
+PerfVariable* GCPhaseTimingRecorder::_last_longest_pause = NULL;
+
+static void copy_name(char* dest, const char* src) {
+  if (src == NULL) {
+    dest[0] = '\0';
+    return;
+  }
+  strncpy(dest, src, GCPhaseTimingRecorder::MaxNameLength - 1);
+  dest[GCPhaseTimingRecorder::MaxNameLength - 1] = '\0';
+}
+
+static void print_json_string(outputStream* out, const char* s) {
+  out->print("\"");
+  for (const char* p = s; *p != '\0'; p++) {
+    if (*p == '"' || *p == '\\') {
+      out->print("\\%c", *p);
+    } else if ((unsigned char)*p < ' ') {
+      out->print("\\u%04x", (unsigned int)(unsigned char)*p);
+    } else {
+      out->print("%c", *p);
+    }
+  }
+  out->print("\"");
+}
+
+static double ticks_to_ms(jlong ticks) {
+  return TimeHelper::counter_to_millis(ticks);
+}
+
+GCPhaseTimingRecorder::Record::Record() :
+  _seq(0), _index(0), _gc_id(0), _name(""), _cause(""),
+  _start(0), _end(0), _sum_of_pauses(0), _longest_pause(0),
+  _num_phases(0), _num_worker_phases(0) {
+  for (uint i = 0; i < MaxWorkerPhases; i++) {
+    _worker_phases[i]._name[0] = '\0';
+    _worker_phases[i]._num_workers = 0;
+    _worker_phases[i]._values = NEW_C_HEAP_ARRAY(double, _max_workers, mtGC);
+  }
+}
+
+GCPhaseTimingRecorder::Record::~Record() {
+  for (uint i = 0; i < MaxWorkerPhases; i++) {
+    FREE_C_HEAP_ARRAY(double, _worker_phases[i]._values);
+  }
+}
+
+void GCPhaseTimingRecorder::Record::copy_from(const Record* other) {
+  _index = other->_index;
+  _gc_id = other->_gc_id;
+  _name = other->_name;
+  _cause = other->_cause;
+  _start = other->_start;
+  _end = other->_end;
+  _sum_of_pauses = other->_sum_of_pauses;
+  _longest_pause = other->_longest_pause;
+
+  _num_phases = MIN2(other->_num_phases, MaxPhases);
+  memcpy(_phases, other->_phases, _num_phases * sizeof(Phase));
+
+  copy_worker_phases_from(other);
+}
+
+void GCPhaseTimingRecorder::Record::copy_worker_phases_from(const Record* other) {
+  _num_worker_phases = MIN2(other->_num_worker_phases, MaxWorkerPhases);
+  for (uint i = 0; i < _num_worker_phases; i++) {
+    WorkerPhase* to = &_worker_phases[i];
+    const WorkerPhase* from = &other->_worker_phases[i];
+    memcpy(to->_name, from->_name, MaxNameLength);
+    to->_num_workers = MIN2(from->_num_workers, _max_workers);
+    memcpy(to->_values, from->_values, to->_num_workers * sizeof(double));
+  }
+}
+
+void GCPhaseTimingRecorder::Record::print_json_on(outputStream* out) const {
+  out->print("{\"gc_id\":%u,\"name\":", _gc_id);
+  print_json_string(out, _name);
+  out->print(",\"cause\":");
+  print_json_string(out, _cause);
+  out->print(",\"start_ms\":%.3f,\"duration_ms\":%.3f,\"sum_of_pauses_ms\":%.3f,\"longest_pause_ms\":%.3f",
+             ticks_to_ms(_start), ticks_to_ms(_end - _start),
+             ticks_to_ms(_sum_of_pauses), ticks_to_ms(_longest_pause));
+
+  out->print(",\"phases\":[");
+  for (uint i = 0; i < _num_phases; i++) {
+    const Phase* p = &_phases[i];
+    out->print("%s{\"name\":", i == 0 ? "" : ",");
+    print_json_string(out, p->_name);
+    out->print(",\"type\":\"%s\",\"level\":%d,\"start_ms\":%.3f,\"duration_ms\":%.3f}",
+               p->_type == GCPhase::PausePhaseType ? "pause" : "concurrent",
+               p->_level, ticks_to_ms(p->_start), ticks_to_ms(p->_end - p->_start));
+  }
+  out->print("]");
+
+  out->print(",\"worker_phases\":[");
+  for (uint i = 0; i < _num_worker_phases; i++) {
+    const WorkerPhase* wp = &_worker_phases[i];
+    double min = 0.0, max = 0.0, sum = 0.0;
+    uint active = 0;
+    for (uint w = 0; w < wp->_num_workers; w++) {
+      double v = wp->_values[w];
+      if (v < 0.0) {
+        continue;
+      }
+      min = (active == 0) ? v : MIN2(min, v);
+      max = (active == 0) ? v : MAX2(max, v);
+      sum += v;
+      active++;
+    }
+    out->print("%s{\"name\":", i == 0 ? "" : ",");
+    print_json_string(out, wp->_name);
+    out->print(",\"workers\":%u,\"min_ms\":%.3f,\"avg_ms\":%.3f,\"max_ms\":%.3f,\"sum_ms\":%.3f,\"values_ms\":[",
+               active, min, active > 0 ? sum / active : 0.0, max, sum);
+    for (uint w = 0; w < wp->_num_workers; w++) {
+      double v = wp->_values[w];
+      if (v < 0.0) {
+        out->print("%snull", w == 0 ? "" : ",");
+      } else {
+        out->print("%s%.3f", w == 0 ? "" : ",", v);
+      }
+    }
+    out->print("]}");
+  }
+  out->print("]}");
+}
+
+void GCPhaseTimingRecorder::initialize() {
+  if (GCPhaseTimingHistory == 0) {
+    return;
+  }
+
+  _max_workers = MAX3((uint)ParallelGCThreads, (uint)ConcGCThreads, 1u);
+  _records = NEW_C_HEAP_ARRAY(Record*, GCPhaseTimingHistory, mtGC);
+  for (uint i = 0; i < GCPhaseTimingHistory; i++) {
+    _records[i] = new Record();
+  }
+  _pending = new Record();
+  _pending->_gc_id = GCId::undefined();
+
+  if (UsePerfData) {
+    EXCEPTION_MARK;
+    ResourceMark rm;
+
+    _recorded = PerfDataManager::create_counter(SUN_GC,
+        PerfDataManager::counter_name("phaseTimings", "recorded"), PerfData::U_Events, CHECK);
+    _last_gc_id = PerfDataManager::create_variable(SUN_GC,
+        PerfDataManager::counter_name("phaseTimings", "lastGcId"), PerfData::U_None, CHECK);
+    _last_duration = PerfDataManager::create_variable(SUN_GC,
+        PerfDataManager::counter_name("phaseTimings", "lastDuration"), PerfData::U_Ticks, CHECK);
+    _last_sum_of_pauses = PerfDataManager::create_variable(SUN_GC,
+        PerfDataManager::counter_name("phaseTimings", "lastSumOfPauses"), PerfData::U_Ticks, CHECK);
+    _last_longest_pause = PerfDataManager::create_variable(SUN_GC,
+        PerfDataManager::counter_name("phaseTimings", "lastLongestPause"), PerfData::U_Ticks, CHECK);
+  }
+
+  // Publish the capacity last; it enables recording.
+  OrderAccess::release_store(&_capacity, (uint)GCPhaseTimingHistory);
+}
+
+void GCPhaseTimingRecorder::record_worker_phase(uint gc_id, WorkerDataArray<double>* phase) {
+  if (!is_enabled() || phase == NULL) {
+    return;
+  }
+
+  if (_pending->_gc_id != gc_id) {
+    _pending->_gc_id = gc_id;
+    _pending->_num_worker_phases = 0;
+  }
+  if (_pending->_num_worker_phases == MaxWorkerPhases) {
+    return;
+  }
+
+  WorkerPhase* wp = &_pending->_worker_phases[_pending->_num_worker_phases++];
+  copy_name(wp->_name, phase->title());
+  // Drop the unit suffix of the log titles, e.g. "Object Copy (ms):".
+  char* suffix = strstr(wp->_name, " (ms)");
+  if (suffix != NULL) {
+    *suffix = '\0';
+  }
+
+  wp->_num_workers = MIN2(phase->length(), _max_workers);
+  double uninitialized = WorkerDataArray<double>::uninitialized();
+  bool any_worker = false;
+  for (uint i = 0; i < wp->_num_workers; i++) {
+    double secs = phase->get(i);
+    if (secs == uninitialized) {
+      wp->_values[i] = -1.0;
+    } else {
+      wp->_values[i] = secs * MILLIUNITS;
+      any_worker = true;
+    }
+  }
+  if (!any_worker) {
+    // Phase did not run in this collection.
+    _pending->_num_worker_phases--;
+  }
+}
+
+void GCPhaseTimingRecorder::record(uint gc_id, const SharedGCInfo& info, TimePartitions* time_partitions) {
+  if (!is_enabled()) {
+    return;
+  }
+
+  uint index = Atomic::add(1u, &_next) - 1;
+  Record* r = _records[index % _capacity];
+
+  // An odd sequence number marks the slot as being written.
+  Atomic::inc(&r->_seq);
+
+  r->_index = index;
+  r->_gc_id = gc_id;
+  r->_name = GCNameHelper::to_string(info.name());
+  r->_cause = GCCause::to_string(info.cause());
+  r->_start = info.start_timestamp().value();
+  r->_end = info.end_timestamp().value();
+  r->_sum_of_pauses = info.sum_of_pauses().value();
+  r->_longest_pause = info.longest_pause().value();
+
+  uint num_phases = MIN2((uint)time_partitions->num_phases(), MaxPhases);
+  for (uint i = 0; i < num_phases; i++) {
+    GCPhase* phase = time_partitions->phase_at(i);
+    Phase* p = &r->_phases[i];
+    copy_name(p->_name, phase->name());
+    p->_level = phase->level();
+    p->_type = phase->type();
+    p->_start = phase->start().value();
+    p->_end = phase->end().value();
+  }
+  r->_num_phases = num_phases;
+
+  if (_pending->_gc_id == gc_id) {
+    r->copy_worker_phases_from(_pending);
+    _pending->_gc_id = GCId::undefined();
+    _pending->_num_worker_phases = 0;
+  } else {
+    r->_num_worker_phases = 0;
+  }
+
+  OrderAccess::release_store(&r->_seq, r->_seq + 1);
+
+  update_counters(r);
+}
+
+void GCPhaseTimingRecorder::update_counters(const Record* r) {
+  if (_recorded == NULL) {
+    return;
+  }
+  _recorded->inc();
+  _last_gc_id->set_value(r->_gc_id);
+  _last_duration->set_value(r->_end - r->_start);
+  _last_sum_of_pauses->set_value(r->_sum_of_pauses);
+  _last_longest_pause->set_value(r->_longest_pause);
+}
+
+bool GCPhaseTimingRecorder::read(uint index, Record* dest) {
+  Record* src = _records[index % _capacity];
+  for (uint attempt = 0; attempt < 4; attempt++) {
+    uint seq = OrderAccess::load_acquire(&src->_seq);
+    if (seq == 0) {
+      // Never written.
+      return false;
+    }
+    if ((seq & 1) != 0) {
+      SpinPause();
+      continue;
+    }
+    dest->copy_from(src);
+    OrderAccess::loadload();
+    if (OrderAccess::load_acquire(&src->_seq) == seq) {
+      // The slot may have been reused for a newer collection.
+      return dest->_index == index;
+    }
+  }
+  return false;
+}
+
+void GCPhaseTimingRecorder::print_json_on(outputStream* out, uint count) {
+  if (!is_enabled()) {
+    out->print_cr("{\"gcs\":[]}");
+    return;
+  }
+
+  uint next = OrderAccess::load_acquire(&_next);
+  uint available = MIN2(next, _capacity);
+  uint n = MIN2(count, available);
+
+  Record* copy = new Record();
+  out->print("{\"gcs\":[");
+  bool first = true;
+  for (uint index = next - n; index != next; index++) {
+    if (!read(index, copy)) {
+      continue;
+    }
+    if (!first) {
+      out->print(",");
+    }
+    copy->print_json_on(out);
+    first = false;
+  }
+  out->print_cr("]}");
+  delete copy;
+}
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_VM_GC_SHARED_GCPHASETIMINGRECORDER_HPP
+#define SHARE_VM_GC_SHARED_GCPHASETIMINGRECORDER_HPP
+
+#include "gc/shared/gcTimer.hpp"
+#include "memory/allocation.hpp"
+#include "runtime/perfData.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+class outputStream;
+class SharedGCInfo;
+template <class T> class WorkerDataArray;
+
+// Keeps the phase timings of the last GCPhaseTimingHistory collections in a
+// ring buffer so that they can be exported in a machine readable form,
+// without parsing the text each collector prints to unified logging.
+//
+// Every collector feeds the recorder through GCTracer::report_gc_end(),
+// which hands over the phases registered with its GCTimer. Collectors that
+// keep per-worker timings in WorkerDataArrays additionally report them
+// with record_worker_phase() before the end of the collection; they are
+// attached to the next record with the same GC id.
+//
+// Writers claim a slot with an atomic increment and publish it under a
+// per-slot sequence number, so recording never blocks. Readers copy a slot
+// and retry if the sequence number changed during the copy.
+class GCPhaseTimingRecorder : AllStatic {
+public:
+  static const uint MaxPhases       = 32;
+  static const uint MaxWorkerPhases = 32;
+  static const uint MaxNameLength   = 48;
+
+  struct Phase {
+    char _name[MaxNameLength];
+    int  _level;
+    GCPhase::PhaseType _type;
+    jlong _start;
+    jlong _end;
+  };
+
+  struct WorkerPhase {
+    char   _name[MaxNameLength];
+    uint   _num_workers;
+    // Worker times in ms, negative for workers that did not take part.
+    double* _values;
+  };
+
+  class Record : public CHeapObj<mtGC> {
+    friend class GCPhaseTimingRecorder;
+
+    volatile uint _seq;
+    // Position in the sequence of all records, detects reused slots.
+    uint _index;
+
+    uint _gc_id;
+    const char* _name;
+    const char* _cause;
+    jlong _start;
+    jlong _end;
+    jlong _sum_of_pauses;
+    jlong _longest_pause;
+
+    uint _num_phases;
+    Phase _phases[MaxPhases];
+
+    uint _num_worker_phases;
+    WorkerPhase _worker_phases[MaxWorkerPhases];
+
+    void copy_from(const Record* other);
+    void copy_worker_phases_from(const Record* other);
+
+  public:
+    Record();
+    ~Record();
+
+    void print_json_on(outputStream* out) const;
+  };
+
+private:
+  static uint _capacity;
+  static uint _max_workers;
+  static Record** _records;
+  static volatile uint _next;
+
+  // Worker phases reported during the current collection.
+  static Record* _pending;
+
+  static PerfCounter*  _recorded;
+  static PerfVariable* _last_gc_id;
+  static PerfVariable* _last_duration;
+  static PerfVariable* _last_sum_of_pauses;
+  static PerfVariable* _last_longest_pause;
+
+  // Copies the record in slot index into dest. Returns false if the slot is
+  // empty or was overwritten concurrently.
+  static bool read(uint index, Record* dest);
+
+  static void update_counters(const Record* r);
+
+public:
+  static void initialize();
+
+  static bool is_enabled() { return _capacity > 0; }
+
+  static void record(uint gc_id, const SharedGCInfo& info, TimePartitions* time_partitions);
+  static void record_worker_phase(uint gc_id, WorkerDataArray<double>* phase);
+
+  // Prints up to count of the most recent records, oldest first.
+  static void print_json_on(outputStream* out, uint count);
+};
+
+#endif // SHARE_VM_GC_SHARED_GCPHASETIMINGRECORDER_HPP
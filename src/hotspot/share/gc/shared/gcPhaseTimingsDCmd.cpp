@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/shared/gcPhaseTimingRecorder.hpp"
+#include "gc/shared/gcPhaseTimingsDCmd.hpp"
+#include "memory/resourceArea.hpp"
+#include "utilities/ostream.hpp"
+
+GCPhaseTimingsDCmd::GCPhaseTimingsDCmd(outputStream* output, bool heap) :
+  DCmdWithParser(output, heap),
+  _count("-count", "Number of most recent collections to print, 0 for all", "INT", false, "0") {
+  _dcmdparser.add_dcmd_option(&_count);
+}
+
+int GCPhaseTimingsDCmd::num_arguments() {
+  ResourceMark rm;
+  GCPhaseTimingsDCmd* dcmd = new GCPhaseTimingsDCmd(NULL, false);
+  if (dcmd != NULL) {
+    DCmdMark mark(dcmd);
+    return dcmd->_dcmdparser.num_arguments();
+  } else {
+    return 0;
+  }
+}
+
+void GCPhaseTimingsDCmd::execute(DCmdSource source, TRAPS) {
+  jlong count = _count.value();
+  if (count < 0) {
+    output()->print_cr("Invalid count: " JLONG_FORMAT, count);
+    return;
+  }
+  uint n = (count == 0 || count > (jlong)max_juint) ? max_juint : (uint)count;
+  GCPhaseTimingRecorder::print_json_on(output(), n);
+}
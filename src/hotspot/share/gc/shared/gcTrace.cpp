@@ -26,6 +26,7 @@
 #include "gc/shared/copyFailedInfo.hpp"
 #include "gc/shared/gcHeapSummary.hpp"
 #include "gc/shared/gcId.hpp"
+#include "gc/shared/gcPhaseTimingRecorder.hpp"
 #include "gc/shared/gcTimer.hpp"
 #include "gc/shared/gcTrace.hpp"
 #include "gc/shared/objectCountEventSender.hpp"
@@ -58,6 +59,8 @@ void GCTracer::report_gc_end_impl(const Ticks& timestamp, TimePartitions* time_p
   _shared_gc_info.set_longest_pause(time_partitions->longest_pause());
   _shared_gc_info.set_end_timestamp(timestamp);
 
+  GCPhaseTimingRecorder::record(GCId::current_or_undefined(), _shared_gc_info, time_partitions);
+
   send_phase_events(time_partitions);
   send_garbage_collection_event();
 }
@@ -287,6 +290,20 @@ void G1NewTracer::report_adaptive_ihop_statistics(size_t threshold,
                                 prediction_active);
 }
 
+void G1NewTracer::report_refinement_control(uint active_threads_limit,
+                                            uint max_threads,
+                                            uint available_processors,
+                                            double system_load,
+                                            double update_rs_time_ms,
+                                            double update_rs_goal_ms) {
+  send_refinement_control(active_threads_limit,
+                          max_threads,
+                          available_processors,
+                          system_load,
+                          update_rs_time_ms,
+                          update_rs_goal_ms);
+}
+
 void G1OldTracer::report_gc_start_impl(GCCause::Cause cause, const Ticks& timestamp) {
   _shared_gc_info.set_start_timestamp(timestamp);
 }
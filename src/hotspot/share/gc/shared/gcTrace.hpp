@@ -267,6 +267,13 @@ class G1NewTracer : public YoungGCTracer {
                                        double predicted_allocation_rate,
                                        double predicted_marking_length,
                                        bool prediction_active);
+
+  void report_refinement_control(uint active_threads_limit,
+                                 uint max_threads,
+                                 uint available_processors,
+                                 double system_load,
+                                 double update_rs_time_ms,
+                                 double update_rs_goal_ms);
  private:
   void send_g1_young_gc_event();
   void send_evacuation_info_event(EvacuationInfo* info);
@@ -288,6 +295,12 @@ class G1NewTracer : public YoungGCTracer {
                                      double predicted_allocation_rate,
                                      double predicted_marking_length,
                                      bool prediction_active);
+  void send_refinement_control(uint active_threads_limit,
+                               uint max_threads,
+                               uint available_processors,
+                               double system_load,
+                               double update_rs_time_ms,
+                               double update_rs_goal_ms);
 };
 
 class G1FullGCTracer : public OldGCTracer {
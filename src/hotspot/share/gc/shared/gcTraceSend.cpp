@@ -309,6 +309,25 @@ void G1NewTracer::send_adaptive_ihop_statistics(size_t threshold,
   }
 }
 
+void G1NewTracer::send_refinement_control(uint active_threads_limit,
+                                          uint max_threads,
+                                          uint available_processors,
+                                          double system_load,
+                                          double update_rs_time_ms,
+                                          double update_rs_goal_ms) {
+  EventG1RefinementControl evt;
+  if (evt.should_commit()) {
+    evt.set_gcId(GCId::current());
+    evt.set_activeThreadsLimit(active_threads_limit);
+    evt.set_maxThreads(max_threads);
+    evt.set_availableProcessors(available_processors);
+    evt.set_systemLoad(system_load);
+    evt.set_updateRSTime(update_rs_time_ms);
+    evt.set_updateRSGoalTime(update_rs_goal_ms);
+    evt.commit();
+  }
+}
+
 #endif // INCLUDE_G1GC
 
 static JfrStructVirtualSpace to_struct(const VirtualSpaceSummary& summary) {
@@ -228,6 +228,17 @@
           "Force dynamic selection of the number of "                       \
           "parallel threads parallel gc will use to aid debugging")         \
                                                                             \
+  experimental(bool, AdaptGCWorkersToCPUQuota, false,                       \
+          "With UseDynamicNumberOfGCThreads, do not use more GC workers "   \
+          "than there are processors currently available to the process, "  \
+          "e.g. under a container CPU quota. Re-evaluated for every "       \
+          "collection")                                                     \
+                                                                            \
+  experimental(bool, AdaptGCWorkersToParallelism, false,                    \
+          "With UseDynamicNumberOfGCThreads, limit the number of GC "       \
+          "workers of a collection to the parallelism measured for the "    \
+          "phases of the previous collections, plus some headroom")         \
+                                                                            \
   product(size_t, HeapSizePerGCThread, ScaleForWordSize(32*M),              \
           "Size of heap (bytes) per GC thread used in calculating the "     \
           "number of GC threads")                                           \
@@ -291,6 +302,11 @@
           "bigger than this")                                               \
           range(1, max_jint/3)                                              \
                                                                             \
+  experimental(bool, AdaptiveParGCArrayScanChunk, false,                    \
+          "Scale the ParGCArrayScanChunk sized chunks of large object "     \
+          "arrays by the depth of the local task queue and the number of "  \
+          "idle workers")                                                   \
+                                                                            \
   product(uintx, OldPLABWeight, 50,                                         \
           "Percentage (0-100) used to weight the current sample when "      \
           "computing exponentially decaying average for resizing "          \
@@ -341,6 +357,18 @@
                "ParallelRefProcEnabled is true. Specify 0 to disable and "  \
                "use all threads.")                                          \
                                                                             \
+  experimental(bool, AdaptiveRefProcPhases, false,                          \
+          "Select the number of reference processing threads for every "    \
+          "phase from the discovered reference counts, weighting the "      \
+          "keep-alive phases by RefProcKeepAliveWeight, and skip the "      \
+          "soft reference reconsideration phase when all soft "             \
+          "references are cleared anyway")                                  \
+                                                                            \
+  experimental(uintx, RefProcKeepAliveWeight, 10,                           \
+          "Number of references each Reference counts as when selecting "   \
+          "threads for the keep-alive phases with AdaptiveRefProcPhases")   \
+          range(1, max_uintx)                                               \
+                                                                            \
   product(uintx, InitiatingHeapOccupancyPercent, 45,                        \
           "The percent occupancy (IHOP) of the current old generation "     \
           "capacity above which a concurrent mark cycle will be initiated " \
@@ -472,6 +500,14 @@
           "Percentage of real memory used for initial heap size")           \
           range(0.0, 100.0)                                                 \
                                                                             \
+  product(uintx, HeapLimitPollInterval, 0,                                  \
+          "Interval in milliseconds at which the memory available to the "  \
+          "VM, e.g. the container memory limit, is polled. When it "        \
+          "changes, the soft maximum heap size of collectors that "         \
+          "support one is set to MaxRAMPercentage of it. 0 disables "       \
+          "polling")                                                        \
+          range(0, 10000)                                                   \
+                                                                            \
   product(int, ActiveProcessorCount, -1,                                    \
           "Specify the CPU count the VM should use and report as active")   \
                                                                             \
@@ -628,6 +664,12 @@
           "OutOfMemoryError is thrown (used with GCTimeLimit)")             \
           range(0, 100)                                                     \
                                                                             \
+  diagnostic(uintx, GCPhaseTimingHistory, 0,                                \
+          "Number of recent collections whose phase timings are kept "      \
+          "for GC.phase_timings and the sun.gc.phaseTimings counters. "     \
+          "0 disables recording")                                           \
+          range(0, 1024)                                                    \
+                                                                            \
   develop(uintx, AdaptiveSizePolicyGCTimeLimitThreshold, 5,                 \
           "Number of consecutive collections before gc time limit fires")   \
           range(1, max_uintx)                                               \
@@ -682,6 +724,13 @@
   product(bool, UseCondCardMark, false,                                     \
           "Check for already marked card before updating card table")       \
                                                                             \
+  experimental(uint, CondCardMarkProcessorThreshold, 64,                    \
+          "Enable UseCondCardMark ergonomically for Serial and Parallel "   \
+          "GC when at least this many processors are active, "              \
+          "since unconditional card stores then cause coherence traffic "   \
+          "on shared cache lines. 0 disables the heuristic")                \
+          range(0, max_juint)                                               \
+                                                                            \
   diagnostic(bool, VerifyRememberedSets, false,                             \
           "Verify GC remembered sets")                                      \
                                                                             \
@@ -791,6 +840,11 @@
           range(0, max_jint)                                                \
           constraint(TLABWasteIncrementConstraintFunc,AfterMemoryInit)      \
                                                                             \
+  experimental(bool, TLABAdaptiveRefills, false,                            \
+          "Adapt the number of TLAB refills between GCs per thread, "       \
+          "based on the waste observed for that thread, instead of "        \
+          "deriving it from TLABWasteTargetPercent for all threads")        \
+                                                                            \
   product(uintx, SurvivorRatio, 8,                                          \
           "Ratio of eden/survivor space size")                              \
           range(1, max_uintx-2)                                             \
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/heapLimitPoller.hpp"
+#include "logging/log.hpp"
+#include "memory/allocation.inline.hpp"
+#include "memory/universe.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/globals_extension.hpp"
+#include "runtime/os.hpp"
+#include "runtime/task.hpp"
+#include "utilities/align.hpp"
+
+class HeapLimitPollerTask : public PeriodicTask {
+public:
+  HeapLimitPollerTask(size_t interval_time) : PeriodicTask(interval_time) {}
+  void task() { HeapLimitPoller::poll(); }
+};
+
+HeapLimitPollerTask* HeapLimitPoller::_task = NULL;
+julong HeapLimitPoller::_last_available_memory = 0;
+
+void HeapLimitPoller::engage() {
+  // An explicit MaxRAM replaces the available memory in the heap sizing
+  // ergonomics, so changes of the actual limit do not matter.
+  if (HeapLimitPollInterval == 0 || !FLAG_IS_DEFAULT(MaxRAM) || is_active()) {
+    return;
+  }
+  _last_available_memory = os::physical_memory();
+
+  size_t interval = align_down((size_t)HeapLimitPollInterval, (size_t)PeriodicTask::interval_gran);
+  interval = MAX2(interval, (size_t)PeriodicTask::min_interval);
+  _task = new HeapLimitPollerTask(interval);
+  _task->enroll();
+  log_info(gc, ergo)("Polling the available memory every " SIZE_FORMAT " ms", interval);
+}
+
+void HeapLimitPoller::disengage() {
+  if (is_active()) {
+    _task->disenroll();
+    delete _task;
+    _task = NULL;
+  }
+}
+
+size_t HeapLimitPoller::soft_max_heap_size_for(julong available_memory) {
+  julong soft_max = (julong)((available_memory * MaxRAMPercentage) / 100);
+  return (size_t)MIN2(soft_max, (julong)MaxHeapSize);
+}
+
+void HeapLimitPoller::poll() {
+  julong available_memory = os::physical_memory();
+  if (available_memory == _last_available_memory) {
+    return;
+  }
+  _last_available_memory = available_memory;
+
+  size_t soft_max = soft_max_heap_size_for(available_memory);
+  bool adopted = Universe::heap()->update_soft_max_heap_size(soft_max);
+  log_info(gc, ergo)("Available memory changed to " JULONG_FORMAT "M, soft max heap size " SIZE_FORMAT "M%s",
+                     available_memory / M, soft_max / M,
+                     adopted ? "" : " (ignored, not supported or set explicitly)");
+}
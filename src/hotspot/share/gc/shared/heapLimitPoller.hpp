@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_VM_GC_SHARED_HEAPLIMITPOLLER_HPP
+#define SHARE_VM_GC_SHARED_HEAPLIMITPOLLER_HPP
+
+#include "memory/allocation.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+class HeapLimitPollerTask;
+
+// Periodically polls the memory available to the VM, which follows the
+// container memory limit on Linux, and hands a soft maximum heap size
+// derived from it to the collector whenever it changes. This lets the heap
+// follow a container that is resized while the VM is running; MaxHeapSize
+// itself stays fixed, so the heap can never grow beyond what was reserved
+// at startup.
+class HeapLimitPoller : AllStatic {
+  static HeapLimitPollerTask* _task;
+  static julong _last_available_memory;
+
+public:
+  // Called at initialization time via Thread::create_vm() and from
+  // before_exit() after the WatcherThread has been stopped.
+  static void engage();
+  static void disengage();
+  static bool is_active() { return _task != NULL; }
+
+  // Executed by the WatcherThread.
+  static void poll();
+
+  static size_t soft_max_heap_size_for(julong available_memory);
+};
+
+#endif // SHARE_VM_GC_SHARED_HEAPLIMITPOLLER_HPP
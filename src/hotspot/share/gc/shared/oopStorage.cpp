@@ -407,8 +407,10 @@ OopStorage::Block::block_for_ptr(const OopStorage* owner, const oop* ptr) {
 // full.  The block is moved to the end of the _allocation_list if the bitmask
 // is empty, for ease of empty block deletion processing.
 
-oop* OopStorage::allocate() {
-  MutexLockerEx ml(_allocation_mutex, Mutex::_no_safepoint_check_flag);
+// Return a block with free entries from the _allocation_list, making a
+// new block if needed, or NULL if that fails.
+OopStorage::Block* OopStorage::block_for_allocation() {
+  assert_lock_strong(_allocation_mutex);
   // Do some deferred update processing every time we allocate.
   // Continue processing deferred updates if _allocation_list is empty,
   // in the hope that we'll get a block from that, rather than
@@ -455,8 +457,16 @@ oop* OopStorage::allocate() {
     }
     block = _allocation_list.head();
   }
+  return block;
+}
+
+oop* OopStorage::allocate() {
+  MutexLockerEx ml(_allocation_mutex, Mutex::_no_safepoint_check_flag);
+  Block* block = block_for_allocation();
+  if (block == NULL) {
+    return NULL;
+  }
   // Allocate from first block.
-  assert(block != NULL, "invariant");
   assert(!block->is_full(), "invariant");
   if (block->is_empty()) {
     // Transitioning from empty to not empty.
@@ -476,6 +486,35 @@ oop* OopStorage::allocate() {
   return result;
 }
 
+size_t OopStorage::allocate(oop** ptrs, size_t size) {
+  assert(size > 0, "precondition");
+  MutexLockerEx ml(_allocation_mutex, Mutex::_no_safepoint_check_flag);
+  Block* block = block_for_allocation();
+  if (block == NULL) {
+    return 0;
+  }
+  // Take as many entries as requested from the first block, but no more
+  // than it has; that keeps the lock hold time bounded.
+  assert(!block->is_full(), "invariant");
+  if (block->is_empty()) {
+    // Transitioning from empty to not empty.
+    log_debug(oopstorage, blocks)("%s: block not empty " PTR_FORMAT, name(), p2i(block));
+  }
+  size_t count = 0;
+  while (count < size && !block->is_full()) {
+    ptrs[count] = block->allocate();
+    log_info(oopstorage, ref)("%s: allocated " PTR_FORMAT, name(), p2i(ptrs[count]));
+    count++;
+  }
+  Atomic::add(count, &_allocation_count); // release updates outside lock.
+  if (block->is_full()) {
+    // Transitioning from not full to full.
+    log_debug(oopstorage, blocks)("%s: block full " PTR_FORMAT, name(), p2i(block));
+    _allocation_list.unlink(*block);
+  }
+  return count;
+}
+
 // Create a new, larger, active array with the same content as the
 // current array, and then replace, relinquishing the old array.
 // Return true if the array was successfully expanded, false to
@@ -871,6 +910,7 @@ OopStorage::BasicParState::BasicParState(const OopStorage* storage,
   _active_array(_storage->obtain_active_array()),
   _block_count(0),              // initialized properly below
   _next_block(0),
+  _max_step(0),                 // initialized properly below
   _estimated_thread_count(estimated_thread_count),
   _concurrent(concurrent)
 {
@@ -881,6 +921,21 @@ OopStorage::BasicParState::BasicParState(const OopStorage* storage,
   // ensure the count we use was written after the block with that count
   // was fully initialized; see ActiveArray::push.
   _block_count = _active_array->block_count_acquire();
+  _max_step = compute_max_step();
+}
+
+// The work per block is roughly proportional to the number of entries in
+// use, so sparsely populated blocks are claimed in larger steps to keep
+// the per-claim overhead on _next_block small relative to the work.
+size_t OopStorage::BasicParState::compute_max_step() const {
+  const size_t min_step = 10;
+  const size_t max_step = 100;
+  size_t capacity = _block_count * BitsPerWord;
+  size_t entries = MAX2(_storage->allocation_count(), (size_t)1);
+  if (entries >= capacity) {
+    return min_step;
+  }
+  return MIN2(max_step, MAX2(min_step, min_step * capacity / entries));
 }
 
 OopStorage::BasicParState::~BasicParState() {
@@ -908,9 +963,8 @@ bool OopStorage::BasicParState::claim_next_segment(IterationData* data) {
   // the remaining largish amount of work, leaving nothing for other
   // threads to do.  But too small a step can lead to contention
   // over _next_block, esp. when the work per block is small.
-  size_t max_step = 10;
   size_t remaining = _block_count - start;
-  size_t step = MIN2(max_step, 1 + (remaining / _estimated_thread_count));
+  size_t step = MIN2(_max_step, 1 + (remaining / _estimated_thread_count));
   // Atomic::add with possible overshoot.  This can perform better
   // than a CAS loop on some platforms when there is contention.
   // We can cope with the uncertainty by recomputing start/end from
@@ -104,6 +104,13 @@ public:
   // postcondition: *result == NULL.
   oop* allocate();
 
+  // Allocates up to size new entries into ptrs, all from the same block,
+  // and returns the number allocated, which is zero if memory allocation
+  // failed.  Amortizes locking _allocation_mutex over several entries.
+  // precondition: size > 0.
+  // postcondition: *ptrs[i] == NULL, for i in [0,result).
+  size_t allocate(oop** ptrs, size_t size);
+
   // Deallocates ptr.  No locking.
   // precondition: ptr is a valid allocated entry.
   // precondition: *ptr == NULL.
@@ -225,6 +232,7 @@ private:
   Block* find_block_or_null(const oop* ptr) const;
   void delete_empty_block(const Block& block);
   bool reduce_deferred_updates();
+  Block* block_for_allocation();
 
   // Managing _active_array.
   bool expand_active_array();
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/shared/oopStorage.hpp"
+#include "gc/shared/oopStorageCache.hpp"
+#include "utilities/debug.hpp"
+
+oop* OopStorageCache::allocate(OopStorage* storage) {
+  assert(_storage == NULL || _storage == storage, "cache used with another storage");
+  _storage = storage;
+  if (_count == 0) {
+    // Only fill half the cache, leaving room to absorb releases.
+    _count = storage->allocate(_entries, Capacity / 2);
+    if (_count == 0) {
+      return NULL;
+    }
+  }
+  oop* result = _entries[--_count];
+  assert(*result == NULL, "postcondition");
+  return result;
+}
+
+void OopStorageCache::release(OopStorage* storage, oop* ptr) {
+  assert(*ptr == NULL, "precondition");
+  if (_storage == NULL) {
+    _storage = storage;
+  }
+  if (_storage == storage && _count < Capacity) {
+    _entries[_count++] = ptr;
+  } else {
+    storage->release(ptr);
+  }
+}
+
+void OopStorageCache::flush() {
+  if (_count > 0) {
+    _storage->release(_entries, _count);
+    _count = 0;
+  }
+}
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_SHARED_OOPSTORAGECACHE_HPP
+#define SHARE_GC_SHARED_OOPSTORAGECACHE_HPP
+
+#include "memory/allocation.hpp"
+#include "oops/oop.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+class OopStorage;
+
+// A small cache of free entries of one OopStorage, owned by a single
+// thread.  Allocations are refilled from the storage in batches, so
+// _allocation_mutex is taken once per batch rather than once per entry,
+// and released entries are kept for reuse by the owner.  Cached entries
+// remain allocated in the storage, and are always NULL, so iteration
+// sees them as cleared entries.
+//
+// Not MT-safe; only the owning thread may allocate or release, and
+// flush must be called before the owner goes away.
+class OopStorageCache {
+public:
+  static const size_t Capacity = 8;
+
+private:
+  OopStorage* _storage;
+  size_t _count;
+  oop* _entries[Capacity];
+
+  NONCOPYABLE(OopStorageCache);
+
+public:
+  OopStorageCache() : _storage(NULL), _count(0) {}
+
+  size_t count() const { return _count; }
+
+  // Returns an entry for storage, refilling the cache if it is empty.
+  // Returns NULL if memory allocation failed.
+  // postcondition: *result == NULL.
+  oop* allocate(OopStorage* storage);
+
+  // Keeps ptr for later reuse if there is room, else releases it.
+  // precondition: ptr is a valid allocated entry of storage.
+  // precondition: *ptr == NULL.
+  void release(OopStorage* storage, oop* ptr);
+
+  // Releases all cached entries back to the storage.
+  void flush();
+};
+
+#endif // SHARE_GC_SHARED_OOPSTORAGECACHE_HPP
@@ -136,6 +136,7 @@ class OopStorage::BasicParState {
   ActiveArray* _active_array;
   size_t _block_count;
   volatile size_t _next_block;
+  size_t _max_step;
   uint _estimated_thread_count;
   bool _concurrent;
 
@@ -146,6 +147,7 @@ class OopStorage::BasicParState {
   void update_concurrent_iteration_count(int value);
   bool claim_next_segment(IterationData* data);
   bool finish_iteration(const IterationData* data) const;
+  size_t compute_max_step() const;
 
   // Wrapper for iteration handler; ignore handler result and return true.
   template<typename F> class AlwaysTrueFn;
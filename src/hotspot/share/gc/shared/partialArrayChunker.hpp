@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_VM_GC_SHARED_PARTIALARRAYCHUNKER_HPP
+#define SHARE_VM_GC_SHARED_PARTIALARRAYCHUNKER_HPP
+
+#include "gc/shared/taskqueue.hpp"
+#include "memory/allocation.hpp"
+#include "runtime/globals.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+// Large object arrays are scanned in chunks: a worker scans one chunk and
+// pushes the remainder of the array back onto its queue, where idle
+// workers can steal it. PartialArrayChunker decides the size of the next
+// chunk. Without AdaptiveParGCArrayScanChunk this is ParGCArrayScanChunk.
+// With it, the size follows the load of the workers:
+//  - no worker is idle and the local queue has other work: nobody is
+//    waiting for the array, so use larger chunks and push less often.
+//  - workers are idle and the local queue holds less work than there are
+//    idle workers: the array is what they could steal, so use smaller
+//    chunks to hand out its remainder more often.
+// The number of idle workers is taken from the terminator of the current
+// phase, if one has been set.
+class PartialArrayChunker {
+  const ParallelTaskTerminator* _terminator;
+
+public:
+  enum {
+    MaxScale = 8,          // largest chunk relative to ParGCArrayScanChunk
+    MinFraction = 4        // smallest chunk relative to ParGCArrayScanChunk
+  };
+
+  PartialArrayChunker() : _terminator(NULL) { }
+
+  void set_terminator(const ParallelTaskTerminator* terminator) { _terminator = terminator; }
+
+  uint idle_workers() const {
+    return _terminator != NULL ? _terminator->offered_termination() : 0;
+  }
+
+  // The number of elements to scan next, given the current number of
+  // entries in the local queue.
+  int chunk_size(uint queue_size) const {
+    int base = ParGCArrayScanChunk;
+    if (!AdaptiveParGCArrayScanChunk) {
+      return base;
+    }
+    uint idle = idle_workers();
+    if (idle == 0) {
+      if (queue_size == 0) {
+        return base;
+      }
+      // Larger chunks, up to base * MaxScale, for deeper queues.
+      uint scale = MIN2(queue_size + 1, (uint)MaxScale);
+      return (int)MIN2((jlong)base * scale, (jlong)max_jint / 3);
+    }
+    if (queue_size < idle) {
+      return MAX2(base / MinFraction, 1);
+    }
+    return base;
+  }
+};
+
+#endif // SHARE_VM_GC_SHARED_PARTIALARRAYCHUNKER_HPP
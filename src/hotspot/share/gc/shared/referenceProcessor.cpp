@@ -792,6 +792,13 @@ void ReferenceProcessor::process_soft_ref_reconsider(BoolObjectClosure* is_alive
     return;
   }
 
+  if (AdaptiveRefProcPhases && _current_soft_ref_policy == _always_clear_soft_ref_policy) {
+    // No soft reference is kept alive by policy, so this phase would only
+    // walk the lists.  Leave all of them to phase 2.
+    log_debug(gc, ref)("Skipped phase1 of Reference Processing due to always clear policy");
+    return;
+  }
+
   RefProcMTDegreeAdjuster a(this, RefPhase1, num_soft_refs);
 
   if (_processing_is_mt) {
@@ -1357,6 +1364,13 @@ uint RefProcMTDegreeAdjuster::ergo_proc_thread_count(size_t ref_count,
     return max_threads;
   }
 
+  if (AdaptiveRefProcPhases &&
+      (phase == ReferenceProcessor::RefPhase1 || phase == ReferenceProcessor::RefPhase3)) {
+    // Each reference in the keep-alive phases may lead to tracing a
+    // subgraph, so weight it more than a simple list entry.
+    ref_count = MIN2(ref_count, max_uintx / RefProcKeepAliveWeight) * RefProcKeepAliveWeight;
+  }
+
   size_t thread_count = 1 + (ref_count / ReferencesPerThread);
   return (uint)MIN3(thread_count,
                     static_cast<size_t>(max_threads),
@@ -1365,7 +1379,9 @@ uint RefProcMTDegreeAdjuster::ergo_proc_thread_count(size_t ref_count,
 
 bool RefProcMTDegreeAdjuster::use_max_threads(RefProcPhases phase) const {
   // Even a small number of references in either of those cases could produce large amounts of work.
-  return (phase == ReferenceProcessor::RefPhase1 || phase == ReferenceProcessor::RefPhase3);
+  // AdaptiveRefProcPhases weights those references instead; see ergo_proc_thread_count.
+  return !AdaptiveRefProcPhases &&
+         (phase == ReferenceProcessor::RefPhase1 || phase == ReferenceProcessor::RefPhase3);
 }
 
 RefProcMTDegreeAdjuster::RefProcMTDegreeAdjuster(ReferenceProcessor* rp,
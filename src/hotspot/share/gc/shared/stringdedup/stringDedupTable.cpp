@@ -34,6 +34,7 @@
 #include "oops/arrayOop.inline.hpp"
 #include "oops/oop.inline.hpp"
 #include "oops/typeArrayOop.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/safepointVerifiers.hpp"
 
@@ -269,6 +270,22 @@ void StringDedupTable::transfer(StringDedupEntry** pentry, StringDedupTable* des
   *list = entry;
 }
 
+void StringDedupTable::transfer_par(StringDedupEntry** pentry, StringDedupTable* dest) {
+  StringDedupEntry* entry = *pentry;
+  *pentry = entry->next();
+  unsigned int hash = entry->hash();
+  size_t index = dest->hash_to_index(hash);
+  StringDedupEntry* volatile* list = (StringDedupEntry* volatile*)dest->bucket(index);
+  // The destination bucket may be shared with other workers, so push the
+  // entry with a CAS. Nobody reads the destination table until it has been
+  // installed after the safepoint work is done.
+  StringDedupEntry* head;
+  do {
+    head = *list;
+    entry->set_next(head);
+  } while (Atomic::cmpxchg(entry, list, head) != head);
+}
+
 bool StringDedupTable::equals(typeArrayOop value1, typeArrayOop value2) {
   return (value1 == value2 ||
           (value1->length() == value2->length() &&
@@ -510,19 +527,16 @@ uintx StringDedupTable::unlink_or_oops_do(StringDedupUnlinkOrOopsDoClosure* cl,
         if (is_resizing()) {
           // We are resizing the table, transfer entry to the new table
           _table->transfer(entry, _resized_table);
+        } else if (is_rehashing()) {
+          // We are rehashing the table, rehash the entry and transfer it
+          // to the new table. Entries with the new hash seed can go to
+          // any destination partition, so the transfer has to be atomic.
+          typeArrayOop value = (typeArrayOop)*p;
+          bool latin1 = (*entry)->latin1();
+          unsigned int hash = hash_code(value, latin1);
+          (*entry)->set_hash(hash);
+          _table->transfer_par(entry, _rehashed_table);
         } else {
-          if (is_rehashing()) {
-            // We are rehashing the table, rehash the entry but keep it
-            // in the table. We can't transfer entries into the new table
-            // at this point since we don't have exclusive access to all
-            // destination partitions. finish_rehash() will do a single
-            // threaded transfer of all entries.
-            typeArrayOop value = (typeArrayOop)*p;
-            bool latin1 = (*entry)->latin1();
-            unsigned int hash = hash_code(value, latin1);
-            (*entry)->set_hash(hash);
-          }
-
           // Move to next entry
           entry = (*entry)->next_addr();
         }
@@ -583,7 +597,9 @@ StringDedupTable* StringDedupTable::prepare_rehash() {
 void StringDedupTable::finish_rehash(StringDedupTable* rehashed_table) {
   assert(rehashed_table != NULL, "Invalid table");
 
-  // Move all newly rehashed entries into the correct buckets in the new table
+  // The workers have normally transferred all entries already while
+  // processing the table. Move any that are left over into the correct
+  // buckets in the new table.
   for (size_t bucket = 0; bucket < _table->_size; bucket++) {
     StringDedupEntry** entry = _table->bucket(bucket);
     while (*entry != NULL) {
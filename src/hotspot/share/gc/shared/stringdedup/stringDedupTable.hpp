@@ -175,6 +175,10 @@ private:
   // Transfers a table entry from the current table to the destination table.
   void transfer(StringDedupEntry** pentry, StringDedupTable* dest);
 
+  // Same as transfer(), but safe against other threads transferring into
+  // the same destination bucket.
+  void transfer_par(StringDedupEntry** pentry, StringDedupTable* dest);
+
   // Returns an existing character array in the given hash bucket, or NULL
   // if no matching character array exists.
   typeArrayOop lookup(typeArrayOop value, bool latin1, unsigned int hash,
@@ -227,9 +231,9 @@ private:
   // hashtable and updates the hash seed.
   static StringDedupTable* prepare_rehash();
 
-  // Transfers rehashed entries from the currently active table into
-  // the new table. Installs the new table as the currently active table
-  // and deletes the previously active table.
+  // Transfers any remaining rehashed entries from the currently active
+  // table into the new table. Installs the new table as the currently
+  // active table and deletes the previously active table.
   static void finish_rehash(StringDedupTable* rehashed_table);
 
 public:
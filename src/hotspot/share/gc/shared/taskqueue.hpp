@@ -505,6 +505,10 @@ public:
   // NULL, then it is ignored.
   virtual bool offer_termination(TerminatorTerminator* terminator);
 
+  // The number of threads that currently offer termination, i.e. are
+  // idle. This is only a snapshot.
+  uint offered_termination() const { return _offered_termination; }
+
   // Reset the terminator, so that it may be reused again.
   // The caller is responsible for ensuring that this is done
   // in an MT-safe manner, once the previous round of use of
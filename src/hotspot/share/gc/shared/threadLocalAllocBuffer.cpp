@@ -73,6 +73,18 @@ void ThreadLocalAllocBuffer::accumulate_and_reset_statistics(ThreadLocalAllocSta
       _allocation_fraction.sample(alloc_frac);
     }
 
+    size_t waste = _gc_waste + _slow_refill_waste + _fast_refill_waste;
+    float waste_frac = MIN2(1.0f, waste / (float) _allocated_size);
+    _waste_fraction.sample(waste_frac);
+    _waste_histogram[MIN2((uint)(waste_frac * WasteHistogramBuckets), (uint)WasteHistogramBuckets - 1)]++;
+    _total_refills        += _number_of_refills;
+    _total_allocated_size += _allocated_size;
+    _total_waste          += waste;
+
+    if (TLABAdaptiveRefills) {
+      update_thread_target_refills();
+    }
+
     stats->update_fast_allocations(_number_of_refills,
                                    _allocated_size,
                                    _gc_waste,
@@ -125,12 +137,31 @@ void ThreadLocalAllocBuffer::retire_before_allocation() {
   retire();
 }
 
+// Scale the number of refills of this thread by the ratio of its observed
+// waste to TLABWasteTargetPercent: threads that waste a lot, typically ones
+// that allocate slowly and carry a half full TLAB into every GC, get more
+// and smaller TLABs, threads that waste little get fewer and larger ones.
+// The step is damped, and the result is kept within a factor of 8 of the
+// global target.
+void ThreadLocalAllocBuffer::update_thread_target_refills() {
+  double ratio = _waste_fraction.average() * 100.0 / TLABWasteTargetPercent;
+  ratio = MIN2(MAX2(ratio, 0.5), 2.0);
+  unsigned new_target = (unsigned)(_thread_target_refills * ratio + 0.5);
+  new_target = MIN2(MAX2(new_target, MAX2(_target_refills / 8, 2U)), _target_refills * 8);
+
+  log_trace(gc, tlab)("TLAB target refills: thread: " INTPTR_FORMAT " [id: %2d]"
+                      " waste: %8.6f refills: %u -> %u",
+                      p2i(thread()), thread()->osthread()->thread_id(),
+                      _waste_fraction.average(), _thread_target_refills, new_target);
+  _thread_target_refills = new_target;
+}
+
 void ThreadLocalAllocBuffer::resize() {
   // Compute the next tlab size using expected allocation amount
   assert(ResizeTLAB, "Should not call this otherwise");
   size_t alloc = (size_t)(_allocation_fraction.average() *
                           (Universe::heap()->tlab_capacity(thread()) / HeapWordSize));
-  size_t new_size = alloc / _target_refills;
+  size_t new_size = alloc / _thread_target_refills;
 
   new_size = MIN2(MAX2(new_size, min_size()), max_size());
 
@@ -139,7 +170,7 @@ void ThreadLocalAllocBuffer::resize() {
   log_trace(gc, tlab)("TLAB new size: thread: " INTPTR_FORMAT " [id: %2d]"
                       " refills %d  alloc: %8.6f desired_size: " SIZE_FORMAT " -> " SIZE_FORMAT,
                       p2i(thread()), thread()->osthread()->thread_id(),
-                      _target_refills, _allocation_fraction.average(), desired_size(), aligned_new_size);
+                      _thread_target_refills, _allocation_fraction.average(), desired_size(), aligned_new_size);
 
   set_desired_size(aligned_new_size);
   set_refill_waste_limit(initial_refill_waste_limit());
@@ -159,6 +190,9 @@ void ThreadLocalAllocBuffer::fill(HeapWord* start,
                                   size_t    new_size) {
   _number_of_refills++;
   _allocated_size += new_size;
+  size_t size_kb = new_size * HeapWordSize / K;
+  uint bucket = size_kb < 2 ? 0 : (uint)log2_intptr((uintptr_t)size_kb);
+  _refill_histogram[MIN2(bucket, (uint)RefillHistogramBuckets - 1)]++;
   print_stats("fill");
   assert(top <= start + new_size - alignment_reserve(), "size too small");
 
@@ -184,6 +218,7 @@ void ThreadLocalAllocBuffer::initialize() {
              NULL,                    // top
              NULL);                   // end
 
+  _thread_target_refills = target_refills();
   set_desired_size(initial_desired_size());
 
   size_t capacity = Universe::heap()->tlab_capacity(thread()) / HeapWordSize;
@@ -281,6 +316,30 @@ void ThreadLocalAllocBuffer::print_stats(const char* tag) {
             _fast_refill_waste * HeapWordSize);
 }
 
+void ThreadLocalAllocBuffer::print_history_on(outputStream* st) {
+  size_t allocated = total_allocated_size();
+  st->print_cr("  desired size: " SIZE_FORMAT "K target refills: %u refills: " SIZE_FORMAT
+               " allocated: " SIZE_FORMAT "K waste: " SIZE_FORMAT "K (%4.1f%%, avg %4.1f%% per gc)",
+               _desired_size * HeapWordSize / K, _thread_target_refills, total_refills(),
+               allocated * HeapWordSize / K, total_waste() * HeapWordSize / K,
+               percent_of(total_waste(), allocated), _waste_fraction.average() * 100.0);
+  st->print("  refills by size:");
+  for (uint i = 0; i < RefillHistogramBuckets; i++) {
+    if (_refill_histogram[i] > 0) {
+      st->print(" " SIZE_FORMAT "K%s: " SIZE_FORMAT, i == 0 ? 0 : ((size_t)1 << i),
+                i == RefillHistogramBuckets - 1 ? "+" : "", _refill_histogram[i]);
+    }
+  }
+  st->cr();
+  st->print("  gcs by waste:");
+  for (uint i = 0; i < WasteHistogramBuckets; i++) {
+    if (_waste_histogram[i] > 0) {
+      st->print(" %u%%: " SIZE_FORMAT, i * 100 / WasteHistogramBuckets, _waste_histogram[i]);
+    }
+  }
+  st->cr();
+}
+
 void ThreadLocalAllocBuffer::verify() {
   HeapWord* p = start();
   HeapWord* t = top();
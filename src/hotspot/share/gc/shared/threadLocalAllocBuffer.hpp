@@ -46,6 +46,12 @@ class ThreadLocalAllocStats;
 class ThreadLocalAllocBuffer: public CHeapObj<mtThread> {
   friend class VMStructs;
   friend class JVMCIVMStructs;
+public:
+  enum {
+    RefillHistogramBuckets = 16,   // refills by TLAB size, [2^i, 2^(i+1)) KB
+    WasteHistogramBuckets  = 10    // GC intervals by waste, 10% steps
+  };
+
 private:
   HeapWord* _start;                              // address of TLAB
   HeapWord* _top;                                // address after last allocation
@@ -71,7 +77,18 @@ private:
 
   AdaptiveWeightedAverage _allocation_fraction;  // fraction of eden allocated in tlabs
 
+  // Per thread refill history, see TLABAdaptiveRefills. The totals and
+  // histograms cover all GC intervals since the thread started.
+  unsigned  _thread_target_refills;              // expected number of refills between GCs for this thread
+  AdaptiveWeightedAverage _waste_fraction;       // fraction of tlab allocation wasted per GC interval
+  size_t    _total_refills;
+  size_t    _total_allocated_size;
+  size_t    _total_waste;
+  size_t    _refill_histogram[RefillHistogramBuckets];
+  size_t    _waste_histogram[WasteHistogramBuckets];
+
   void reset_statistics();
+  void update_thread_target_refills();
 
   void set_start(HeapWord* start)                { _start = start; }
   void set_end(HeapWord* end)                    { _end = end; }
@@ -113,8 +130,15 @@ private:
 
 public:
   ThreadLocalAllocBuffer() : _allocation_fraction(TLABAllocationWeight), _allocated_before_last_gc(0),
-      _bytes_since_last_sample_point(0) {
-    // do nothing.  tlabs must be inited by initialize() calls
+      _bytes_since_last_sample_point(0), _thread_target_refills(0), _waste_fraction(TLABAllocationWeight),
+      _total_refills(0), _total_allocated_size(0), _total_waste(0) {
+    // tlabs must be inited by initialize() calls, only the history is cleared here
+    for (uint i = 0; i < RefillHistogramBuckets; i++) {
+      _refill_histogram[i] = 0;
+    }
+    for (uint i = 0; i < WasteHistogramBuckets; i++) {
+      _waste_histogram[i] = 0;
+    }
   }
 
   static size_t min_size()                       { return align_object_size(MinTLABSize / HeapWordSize) + alignment_reserve(); }
@@ -135,6 +159,18 @@ public:
   size_t refill_waste_limit() const              { return _refill_waste_limit; }
   size_t bytes_since_last_sample_point() const   { return _bytes_since_last_sample_point; }
 
+  // Refill history, including the current GC interval. Sizes are in words.
+  unsigned thread_target_refills() const         { return _thread_target_refills; }
+  double waste_fraction() const                  { return _waste_fraction.average(); }
+  size_t total_refills() const                   { return _total_refills + _number_of_refills; }
+  size_t total_allocated_size() const            { return _total_allocated_size + _allocated_size; }
+  size_t total_waste() const                     { return _total_waste + _gc_waste + _slow_refill_waste + _fast_refill_waste; }
+  size_t refill_histogram(uint i) const          { assert(i < RefillHistogramBuckets, "oob"); return _refill_histogram[i]; }
+  size_t waste_histogram(uint i) const           { assert(i < WasteHistogramBuckets, "oob"); return _waste_histogram[i]; }
+
+  // Print the refill history on one or more lines.
+  void print_history_on(outputStream* st);
+
   // Allocate size HeapWords. The memory is NOT initialized to zero.
   inline HeapWord* allocate(size_t size);
 
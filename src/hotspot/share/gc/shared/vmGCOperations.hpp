@@ -126,6 +126,7 @@ class VM_GC_HeapInspection: public VM_GC_Operation {
   outputStream* _out;
   bool _full_gc;
   uint _parallel_thread_num;
+  uint _sample_rate;
   bool _csv_format; // "comma separated values" format for spreadsheet.
   bool _print_help;
   bool _print_class_stats;
@@ -140,6 +141,7 @@ class VM_GC_HeapInspection: public VM_GC_Operation {
     _out = out;
     _full_gc = request_full_gc;
     _parallel_thread_num = parallel_thread_num;
+    _sample_rate = 0;
     _csv_format = false;
     _print_help = false;
     _print_class_stats = false;
@@ -154,6 +156,7 @@ class VM_GC_HeapInspection: public VM_GC_Operation {
   void set_print_help(bool value) {_print_help = value;}
   void set_print_class_stats(bool value) {_print_class_stats = value;}
   void set_columns(const char* value) {_columns = value;}
+  void set_sample_rate(uint value) {_sample_rate = value;}
  protected:
   bool collect();
 };
@@ -25,9 +25,13 @@
 #ifndef SHARE_VM_GC_SHARED_WEAKPROCESSOR_HPP
 #define SHARE_VM_GC_SHARED_WEAKPROCESSOR_HPP
 
+#include "gc/shared/oopStorageParState.hpp"
+#include "gc/shared/workgroup.hpp"
 #include "memory/allocation.hpp"
 #include "memory/iterator.hpp"
 
+class WeakProcessorPhaseTimes;
+
 // Helper class to aid in root scanning and cleaning of weak oops in the VM.
 //
 // New containers of weak oops added to this class will automatically
@@ -41,6 +45,53 @@ public:
 
   // Visit all oop*s and apply the given closure.
   static void oops_do(OopClosure* closure);
+
+  // Parallel version.  Uses ergo_workers(), active workers, and
+  // phase_time's max_threads to determine the number of threads to use.
+  // IsAlive must be derived from BoolObjectClosure.
+  // KeepAlive must be derived from OopClosure.
+  template<typename IsAlive, typename KeepAlive>
+  static void weak_oops_do(WorkGang* workers,
+                           IsAlive* is_alive,
+                           KeepAlive* keep_alive,
+                           WeakProcessorPhaseTimes* phase_times);
+
+  // Convenience parallel version.  Uses ergo_workers() and active workers
+  // to determine the number of threads to run.  Implicitly logs phase times.
+  // IsAlive must be derived from BoolObjectClosure.
+  // KeepAlive must be derived from OopClosure.
+  template<typename IsAlive, typename KeepAlive>
+  static void weak_oops_do(WorkGang* workers,
+                           IsAlive* is_alive,
+                           KeepAlive* keep_alive,
+                           uint indent_log);
+
+  // Number of workers worth using for the current contents of the weak
+  // OopStorages, at most max_workers.
+  static uint ergo_workers(uint max_workers);
+  class Task;
+
+private:
+  class GangTask;
+};
+
+class WeakProcessor::Task {
+  typedef OopStorage::ParState<false, false> StorageState;
+
+  WeakProcessorPhaseTimes* _phase_times;
+  uint _nworkers;
+  SubTasksDone _serial_phases_done;
+  StorageState* _storage_states;
+
+  void initialize();
+
+public:
+  Task(uint nworkers);          // No time tracking.
+  Task(WeakProcessorPhaseTimes* phase_times, uint nworkers);
+  ~Task();
+
+  template<typename IsAlive, typename KeepAlive>
+  void work(uint worker_id, IsAlive* is_alive, KeepAlive* keep_alive);
 };
 
 #endif // SHARE_VM_GC_SHARED_WEAKPROCESSOR_HPP
@@ -71,6 +71,10 @@ private:
     return _title;
   }
 
+  uint length() const {
+    return _length;
+  }
+
   void reset();
   void set_all(T value);
 
@@ -24,6 +24,7 @@
 
 #include "precompiled.hpp"
 #include "gc/shared/gcId.hpp"
+#include "gc/shared/gcUtil.hpp"
 #include "gc/shared/workgroup.hpp"
 #include "gc/shared/workerManager.hpp"
 #include "memory/allocation.hpp"
@@ -296,10 +297,48 @@ void WorkGang::run_task(AbstractGangTask* task, uint num_workers, bool add_foreg
   guarantee(num_workers > 0, "Trying to execute task %s with zero workers", task->name());
   uint old_num_workers = _active_workers;
   update_active_workers(num_workers);
+  _busy_ticks = 0;
+  jlong start = os::elapsed_counter();
   _dispatcher->coordinator_execute_on_workers(task, num_workers, add_foreground_work);
+  jlong wall_ticks = os::elapsed_counter() - start;
+  // The time of the coordinator is not measured, so skip foreground tasks.
+  if (num_workers > 1 && !add_foreground_work && wall_ticks > 0) {
+    record_phase_parallelism(task->name(), (double)_busy_ticks / wall_ticks);
+  }
   update_active_workers(old_num_workers);
 }
 
+void AbstractWorkGang::add_busy_ticks(jlong ticks) {
+  Atomic::add(ticks, &_busy_ticks);
+}
+
+// Called by the coordinator only, so the table needs no synchronization.
+void AbstractWorkGang::record_phase_parallelism(const char* name, double parallelism) {
+  const unsigned weight = 50;
+  for (uint i = 0; i < _num_phases; i++) {
+    if (_phases[i]._name == name || strcmp(_phases[i]._name, name) == 0) {
+      _phases[i]._avg = AdaptiveWeightedAverage::exp_avg(_phases[i]._avg, (float)parallelism, weight);
+      log_trace(gc, task)("%s: %s parallelism %.2f, average %.2f",
+                          this->name(), name, parallelism, _phases[i]._avg);
+      return;
+    }
+  }
+  if (_num_phases < MaxPhases) {
+    _phases[_num_phases]._name = name;
+    _phases[_num_phases]._avg = (float)parallelism;
+    _num_phases++;
+    log_trace(gc, task)("%s: %s parallelism %.2f", this->name(), name, parallelism);
+  }
+}
+
+double AbstractWorkGang::max_phase_parallelism() const {
+  double result = 0.0;
+  for (uint i = 0; i < _num_phases; i++) {
+    result = MAX2(result, (double)_phases[i]._avg);
+  }
+  return result;
+}
+
 AbstractGangWorker::AbstractGangWorker(AbstractWorkGang* gang, uint id) {
   _gang = gang;
   set_id(id);
@@ -348,7 +387,9 @@ void GangWorker::run_task(WorkData data) {
   GCIdMark gc_id_mark(data._task->gc_id());
   log_develop_trace(gc, workgang)("Running work gang: %s task: %s worker: %u", name(), data._task->name(), data._worker_id);
 
+  jlong start = os::elapsed_counter();
   data._task->work(data._worker_id);
+  gang()->add_busy_ticks(os::elapsed_counter() - start);
 
   log_develop_trace(gc, workgang)("Finished work gang: %s task: %s worker: %u thread: " PTR_FORMAT,
                                   name(), data._task->name(), data._worker_id, p2i(Thread::current()));
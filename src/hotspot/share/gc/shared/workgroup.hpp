@@ -107,6 +107,26 @@ class GangTaskDispatcher : public CHeapObj<mtGC> {
 // The number of workers run for a task is "_active_workers"
 // while "_total_workers" is the number of available of workers.
 class AbstractWorkGang : public CHeapObj<mtInternal> {
+ public:
+  enum {
+    MaxPhases = 32
+  };
+
+ private:
+  // Measured parallelism of a gang task, i.e. the average number of
+  // workers busy while it ran. Tasks are identified by name.
+  struct PhaseParallelism {
+    const char* _name;
+    float       _avg;
+  };
+
+  PhaseParallelism _phases[MaxPhases];
+  uint             _num_phases;
+
+ protected:
+  // Sum of the time the workers spent in the current task.
+  volatile jlong _busy_ticks;
+
  protected:
   // The array of worker threads for this gang.
   AbstractGangWorker** _workers;
@@ -137,7 +157,9 @@ class AbstractWorkGang : public CHeapObj<mtInternal> {
       _active_workers(UseDynamicNumberOfGCThreads ? 1U : workers),
       _created_workers(0),
       _are_GC_task_threads(are_GC_task_threads),
-      _are_ConcurrentGC_threads(are_ConcurrentGC_threads)
+      _are_ConcurrentGC_threads(are_ConcurrentGC_threads),
+      _num_phases(0),
+      _busy_ticks(0)
   { }
 
   // Initialize workers in the gang.  Return true if initialization succeeded.
@@ -177,6 +199,13 @@ class AbstractWorkGang : public CHeapObj<mtInternal> {
   // Return the Ith worker.
   AbstractGangWorker* worker(uint i) const;
 
+  // Parallelism measured for the tasks run on this gang, see
+  // AdaptGCWorkersToParallelism.
+  void add_busy_ticks(jlong ticks);
+  void record_phase_parallelism(const char* name, double parallelism);
+  // The highest average parallelism of all tasks, or 0 if none was measured.
+  double max_phase_parallelism() const;
+
   // Base name (without worker id #) of threads.
   const char* group_name() { return name(); }
 
@@ -30,12 +30,17 @@
 #include "gc/shenandoah/shenandoahHeapRegion.inline.hpp"
 #include "logging/log.hpp"
 #include "logging/logTag.hpp"
+#include "runtime/os.hpp"
 #include "utilities/quickSort.hpp"
 
 ShenandoahAdaptiveHeuristics::ShenandoahAdaptiveHeuristics() :
-  ShenandoahHeuristics() {}
+  ShenandoahHeuristics(),
+  _cycle_start_cpus(os::active_processor_count()),
+  _cpu_history(new TruncatedSeq(5)) {}
 
-ShenandoahAdaptiveHeuristics::~ShenandoahAdaptiveHeuristics() {}
+ShenandoahAdaptiveHeuristics::~ShenandoahAdaptiveHeuristics() {
+  delete _cpu_history;
+}
 
 void ShenandoahAdaptiveHeuristics::choose_collection_set_from_regiondata(ShenandoahCollectionSet* cset,
                                                                          RegionData* data, size_t size,
@@ -97,6 +102,23 @@ void ShenandoahAdaptiveHeuristics::choose_collection_set_from_regiondata(Shenand
 
 void ShenandoahAdaptiveHeuristics::record_cycle_start() {
   ShenandoahHeuristics::record_cycle_start();
+  _cycle_start_cpus = os::active_processor_count();
+}
+
+void ShenandoahAdaptiveHeuristics::record_success_concurrent() {
+  ShenandoahHeuristics::record_success_concurrent();
+  _cpu_history->add(_cycle_start_cpus);
+}
+
+// The average GC time was measured with the processors available back then. When the
+// CPU quota shrinks, the next cycle gets proportionally fewer processors and takes longer.
+double ShenandoahAdaptiveHeuristics::available_cpus_factor() const {
+  if (!ShenandoahAdaptToCPUQuota || _cpu_history->num() == 0) {
+    return 1.0;
+  }
+  double learned_cpus = _cpu_history->avg();
+  double current_cpus = MAX2(1, os::active_processor_count());
+  return MAX2(1.0, learned_cpus / current_cpus);
 }
 
 bool ShenandoahAdaptiveHeuristics::should_start_gc() const {
@@ -147,6 +169,8 @@ bool ShenandoahAdaptiveHeuristics::should_start_gc() const {
   // TODO: Allocation rate is way too averaged to be useful during state changes
 
   double average_gc = _gc_time_history->avg();
+  double cpus_factor = available_cpus_factor();
+  average_gc *= cpus_factor;
   double time_since_last = time_since_last_gc();
   double allocation_rate = heap->bytes_allocated_since_gc_start() / time_since_last;
 
@@ -160,6 +184,10 @@ bool ShenandoahAdaptiveHeuristics::should_start_gc() const {
                  byte_size_in_proper_unit(spike_headroom),      proper_unit_for_byte_size(spike_headroom),
                  byte_size_in_proper_unit(penalties),           proper_unit_for_byte_size(penalties),
                  byte_size_in_proper_unit(allocation_headroom), proper_unit_for_byte_size(allocation_headroom));
+    if (cpus_factor > 1.0) {
+      log_info(gc, ergo)("Average GC time scaled by %.2f for fewer processors available than in learned cycles",
+                         cpus_factor);
+    }
     return true;
   }
 
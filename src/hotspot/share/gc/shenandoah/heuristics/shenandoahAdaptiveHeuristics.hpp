@@ -29,6 +29,14 @@
 #include "utilities/numberSeq.hpp"
 
 class ShenandoahAdaptiveHeuristics : public ShenandoahHeuristics {
+private:
+  // Processors available at the start of the current cycle, and over the
+  // cycles recorded in _gc_time_history.
+  int           _cycle_start_cpus;
+  TruncatedSeq* _cpu_history;
+
+  double available_cpus_factor() const;
+
 public:
   ShenandoahAdaptiveHeuristics();
 
@@ -40,6 +48,8 @@ public:
 
   void record_cycle_start();
 
+  virtual void record_success_concurrent();
+
   virtual bool should_start_gc() const;
 
   virtual const char* name()     { return "Adaptive"; }
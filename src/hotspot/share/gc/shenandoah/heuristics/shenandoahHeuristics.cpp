@@ -28,6 +28,7 @@
 #include "gc/shenandoah/shenandoahCollectorPolicy.hpp"
 #include "gc/shenandoah/shenandoahHeap.inline.hpp"
 #include "gc/shenandoah/shenandoahHeapRegion.inline.hpp"
+#include "gc/shenandoah/mode/shenandoahMode.hpp"
 #include "gc/shenandoah/shenandoahMarkingContext.inline.hpp"
 #include "gc/shenandoah/heuristics/shenandoahHeuristics.hpp"
 #include "logging/log.hpp"
@@ -67,6 +68,31 @@ ShenandoahHeuristics::~ShenandoahHeuristics() {
   FREE_C_HEAP_ARRAY(RegionGarbage, _region_data);
 }
 
+void ShenandoahHeuristics::age_regions(size_t old_skipped_regions) {
+  ShenandoahHeap* heap = ShenandoahHeap::heap();
+
+  size_t young_regions = 0;
+  size_t old_regions = 0;
+
+  // Regions that survived this cycle without being collected get older
+  for (size_t i = 0; i < heap->num_regions(); i++) {
+    ShenandoahHeapRegion* region = heap->get_region(i);
+    if (region->is_active() && !region->is_cset()) {
+      region->increment_age();
+    }
+
+    if (region->is_young()) {
+      young_regions++;
+    } else if (region->is_old()) {
+      old_regions++;
+    }
+  }
+
+  log_info(gc, ergo)("Generations: " SIZE_FORMAT " young regions, " SIZE_FORMAT " old regions, "
+                     SIZE_FORMAT " old regions skipped",
+                     young_regions, old_regions, old_skipped_regions);
+}
+
 void ShenandoahHeuristics::choose_collection_set(ShenandoahCollectionSet* collection_set) {
   assert(collection_set->count() == 0, "Must be empty");
 
@@ -93,6 +119,10 @@ void ShenandoahHeuristics::choose_collection_set(ShenandoahCollectionSet* collec
 
   ShenandoahMarkingContext* const ctx = heap->complete_marking_context();
 
+  const bool generational = heap->mode()->is_generational();
+  const size_t old_garbage_threshold = ShenandoahHeapRegion::region_size_bytes() * ShenandoahOldGarbageThreshold / 100;
+  size_t old_skipped_regions = 0;
+
   for (size_t i = 0; i < num_regions; i++) {
     ShenandoahHeapRegion* region = heap->get_region(i);
 
@@ -108,6 +138,10 @@ void ShenandoahHeuristics::choose_collection_set(ShenandoahCollectionSet* collec
         immediate_regions++;
         immediate_garbage += garbage;
         region->make_trash_immediate();
+      } else if (generational && region->is_old() && garbage < old_garbage_threshold) {
+        // Old regions are expected to be mostly live, leave them alone
+        // unless they have accumulated a lot of garbage.
+        old_skipped_regions++;
       } else {
         // This is our candidate for later consideration.
         candidates[cand_idx]._region = region;
@@ -151,6 +185,10 @@ void ShenandoahHeuristics::choose_collection_set(ShenandoahCollectionSet* collec
     choose_collection_set_from_regiondata(collection_set, candidates, cand_idx, immediate_garbage + free);
   }
 
+  if (generational) {
+    age_regions(old_skipped_regions);
+  }
+
   size_t cset_percent = (total_garbage == 0) ? 0 : (collection_set->garbage() * 100 / total_garbage);
 
   size_t collectable_garbage = collection_set->garbage() + immediate_garbage;
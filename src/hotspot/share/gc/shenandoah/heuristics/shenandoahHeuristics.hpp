@@ -91,6 +91,9 @@ protected:
 
   void adjust_penalty(intx step);
 
+  // Generational mode support
+  void age_regions(size_t old_skipped_regions);
+
 public:
   ShenandoahHeuristics();
   virtual ~ShenandoahHeuristics();
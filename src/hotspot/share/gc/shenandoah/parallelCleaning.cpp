@@ -284,7 +284,7 @@ void KlassCleaningTask::work() {
 }
 
 bool ResolvedMethodCleaningTask::claim_resolved_method_task() {
-  if (_resolved_method_task_claimed) {
+  if (!_process_resolved_methods || _resolved_method_task_claimed) {
     return false;
   }
   return Atomic::cmpxchg(1, &_resolved_method_task_claimed, 0) == 0;
@@ -301,13 +301,14 @@ ParallelCleaningTask::ParallelCleaningTask(ShenandoahPhaseTimings::Phase phase,
                                            BoolObjectClosure* is_alive,
                                            bool process_strings,
                                            bool process_symbols,
+                                           bool process_resolved_methods,
                                            uint num_workers,
                                            bool unloading_occurred) :
   AbstractGangTask("Parallel Cleaning"),
   _string_symbol_task(is_alive, process_strings, process_symbols),
   _code_cache_task(num_workers, is_alive, unloading_occurred),
   _klass_cleaning_task(is_alive),
-  _resolved_method_cleaning_task(is_alive),
+  _resolved_method_cleaning_task(is_alive, process_resolved_methods),
   _phase(phase)
 {
 }
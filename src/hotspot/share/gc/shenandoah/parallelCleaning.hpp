@@ -127,10 +127,12 @@ public:
 
 class ResolvedMethodCleaningTask : public StackObj {
   BoolObjectClosure* _is_alive;
+  const bool         _process_resolved_methods;
   volatile int       _resolved_method_task_claimed;
 public:
-  ResolvedMethodCleaningTask(BoolObjectClosure* is_alive) :
-          _is_alive(is_alive), _resolved_method_task_claimed(0) {}
+  ResolvedMethodCleaningTask(BoolObjectClosure* is_alive, bool process_resolved_methods) :
+          _is_alive(is_alive), _process_resolved_methods(process_resolved_methods),
+          _resolved_method_task_claimed(0) {}
 
   bool claim_resolved_method_task();
   void work();
@@ -148,7 +150,8 @@ private:
 public:
   // The constructor is run in the VMThread.
   ParallelCleaningTask(ShenandoahPhaseTimings::Phase phase, BoolObjectClosure* is_alive, bool process_strings,
-                       bool process_symbols, uint num_workers, bool unloading_occurred);
+                       bool process_symbols, bool process_resolved_methods,
+                       uint num_workers, bool unloading_occurred);
 
   // The parallel work done by all worker threads.
   void work(uint worker_id);
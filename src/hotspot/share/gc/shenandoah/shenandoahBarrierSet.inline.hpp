@@ -143,6 +143,15 @@ inline oop ShenandoahBarrierSet::AccessBarrier<decorators, BarrierSetT>::oop_loa
   oop value = Raw::oop_load_not_in_heap(addr);
   if (value != NULL) {
     ShenandoahBarrierSet *const bs = ShenandoahBarrierSet::barrier_set();
+    if (!HasDecorator<decorators, ON_STRONG_OOP_REF>::value) {
+      // Weak roots are being cleaned concurrently: marking is complete, and
+      // unmarked referents are dead. Do not let them escape.
+      ShenandoahHeap* const heap = ShenandoahHeap::heap();
+      if (heap->is_concurrent_weak_root_in_progress() &&
+          !heap->complete_marking_context()->is_marked(value)) {
+        return NULL;
+      }
+    }
     value = bs->load_reference_barrier_not_null(value);
     if (value != NULL) {
       bs->keep_alive_if_weak<decorators>(value);
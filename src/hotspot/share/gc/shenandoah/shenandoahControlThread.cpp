@@ -404,6 +404,10 @@ void ShenandoahControlThread::service_concurrent_normal_cycle(GCCause::Cause cau
   // Complete marking under STW, and start evacuation
   heap->vmop_entry_final_mark();
 
+  // Process the weak roots final mark left behind, if any. This has to complete before
+  // cleanup reclaims the immediate garbage that dead weak referents may point into.
+  heap->entry_weak_roots();
+
   // Final mark might have reclaimed some immediate garbage, kick cleanup to reclaim
   // the space. This would be the last action if there is nothing to evacuate.
   heap->entry_cleanup_early();
@@ -28,14 +28,51 @@
 #include "gc/shenandoah/shenandoahHeapRegionSet.hpp"
 #include "gc/shenandoah/shenandoahMarkingContext.inline.hpp"
 #include "logging/logStream.hpp"
+#include "runtime/os.hpp"
 
 ShenandoahFreeSet::ShenandoahFreeSet(ShenandoahHeap* heap, size_t max_regions) :
   _heap(heap),
   _mutator_free_bitmap(max_regions, mtGC),
   _collector_free_bitmap(max_regions, mtGC),
-  _max(max_regions)
+  _max(max_regions),
+  _numa_nodes(1),
+  _numa_ids(NULL)
 {
   clear_internal();
+
+  if (UseNUMA) {
+    size_t groups = os::numa_get_groups_num();
+    if (groups > 1 && groups <= max_regions) {
+      _numa_ids = NEW_C_HEAP_ARRAY(int, groups, mtGC);
+      _numa_nodes = MAX2<size_t>(1, os::numa_get_leaf_groups(_numa_ids, groups));
+      log_info(gc, init)("NUMA Nodes: " SIZE_FORMAT, _numa_nodes);
+    }
+  }
+}
+
+ShenandoahFreeSet::~ShenandoahFreeSet() {
+  if (_numa_ids != NULL) {
+    FREE_C_HEAP_ARRAY(int, _numa_ids);
+  }
+}
+
+size_t ShenandoahFreeSet::current_numa_node() const {
+  if (_numa_nodes > 1) {
+    int lgrp_id = os::numa_get_group_id();
+    for (size_t node = 0; node < _numa_nodes; node++) {
+      if (_numa_ids[node] == lgrp_id) {
+        return node;
+      }
+    }
+  }
+  return 0;
+}
+
+void ShenandoahFreeSet::numa_make_local(ShenandoahHeapRegion* r) const {
+  if (_numa_nodes > 1) {
+    os::numa_make_local((char*) r->bottom(), ShenandoahHeapRegion::region_size_bytes(),
+                        _numa_ids[numa_node_of(r->index())]);
+  }
 }
 
 void ShenandoahFreeSet::increase_used(size_t num_bytes) {
@@ -71,37 +108,41 @@ HeapWord* ShenandoahFreeSet::allocate_single(ShenandoahAllocRequest& req, bool&
   // Free set maintains mutator and collector views, and normally they allocate in their views only,
   // unless we special cases for stealing and mixed allocations.
 
+  // With NUMA, each view is scanned in the stripe local to the allocating thread first:
+  // mutators get memory close to where they run, and GC workers evacuate into it.
+
   switch (req.type()) {
     case ShenandoahAllocRequest::_alloc_tlab:
     case ShenandoahAllocRequest::_alloc_shared: {
 
       // Try to allocate in the mutator view
-      for (size_t idx = _mutator_leftmost; idx <= _mutator_rightmost; idx++) {
-        if (is_mutator_free(idx)) {
-          HeapWord* result = try_allocate_in(_heap->get_region(idx), req, in_new_region);
-          if (result != NULL) {
-            return result;
-          }
+      if (_numa_nodes > 1) {
+        size_t node = current_numa_node();
+        HeapWord* result = allocate_mutator(numa_node_begin(node), numa_node_end(node), req, in_new_region);
+        if (result != NULL) {
+          return result;
         }
       }
 
-      // There is no recovery. Mutator does not touch collector view at all.
-      break;
+      // Fall back to the entire mutator view. There is no recovery beyond that,
+      // mutator does not touch collector view at all.
+      return allocate_mutator(0, _max, req, in_new_region);
     }
     case ShenandoahAllocRequest::_alloc_gclab:
     case ShenandoahAllocRequest::_alloc_shared_gc: {
-      // size_t is unsigned, need to dodge underflow when _leftmost = 0
+      size_t node = current_numa_node();
 
       // Fast-path: try to allocate in the collector view first
-      for (size_t c = _collector_rightmost + 1; c > _collector_leftmost; c--) {
-        size_t idx = c - 1;
-        if (is_collector_free(idx)) {
-          HeapWord* result = try_allocate_in(_heap->get_region(idx), req, in_new_region);
-          if (result != NULL) {
-            return result;
-          }
+      if (_numa_nodes > 1) {
+        HeapWord* result = allocate_collector(numa_node_begin(node), numa_node_end(node), req, in_new_region);
+        if (result != NULL) {
+          return result;
         }
       }
+      HeapWord* result = allocate_collector(0, _max, req, in_new_region);
+      if (result != NULL) {
+        return result;
+      }
 
       // No dice. Can we borrow space from mutator view?
       if (!ShenandoahEvacReserveOverflow) {
@@ -109,25 +150,17 @@ HeapWord* ShenandoahFreeSet::allocate_single(ShenandoahAllocRequest& req, bool&
       }
 
       // Try to steal the empty region from the mutator view
-      for (size_t c = _mutator_rightmost + 1; c > _mutator_leftmost; c--) {
-        size_t idx = c - 1;
-        if (is_mutator_free(idx)) {
-          ShenandoahHeapRegion* r = _heap->get_region(idx);
-          if (is_empty_or_trash(r)) {
-            flip_to_gc(r);
-            HeapWord *result = try_allocate_in(r, req, in_new_region);
-            if (result != NULL) {
-              return result;
-            }
-          }
+      if (_numa_nodes > 1) {
+        result = steal_from_mutator(numa_node_begin(node), numa_node_end(node), req, in_new_region);
+        if (result != NULL) {
+          return result;
         }
       }
 
       // No dice. Do not try to mix mutator and GC allocations, because
       // URWM moves due to GC allocations would expose unparsable mutator
       // allocations.
-
-      break;
+      return steal_from_mutator(0, _max, req, in_new_region);
     }
     default:
       ShouldNotReachHere();
@@ -136,6 +169,52 @@ HeapWord* ShenandoahFreeSet::allocate_single(ShenandoahAllocRequest& req, bool&
   return NULL;
 }
 
+HeapWord* ShenandoahFreeSet::allocate_mutator(size_t from, size_t to, ShenandoahAllocRequest& req, bool& in_new_region) {
+  // Scan [from; to) within the mutator bounds, left to right
+  for (size_t idx = MAX2(from, _mutator_leftmost); idx < to && idx <= _mutator_rightmost; idx++) {
+    if (is_mutator_free(idx)) {
+      HeapWord* result = try_allocate_in(_heap->get_region(idx), req, in_new_region);
+      if (result != NULL) {
+        return result;
+      }
+    }
+  }
+  return NULL;
+}
+
+HeapWord* ShenandoahFreeSet::allocate_collector(size_t from, size_t to, ShenandoahAllocRequest& req, bool& in_new_region) {
+  // Scan [from; to) within the collector bounds, right to left.
+  // size_t is unsigned, need to dodge underflow when _leftmost = 0
+  for (size_t c = MIN2(to, _collector_rightmost + 1); c > MAX2(from, _collector_leftmost); c--) {
+    size_t idx = c - 1;
+    if (is_collector_free(idx)) {
+      HeapWord* result = try_allocate_in(_heap->get_region(idx), req, in_new_region);
+      if (result != NULL) {
+        return result;
+      }
+    }
+  }
+  return NULL;
+}
+
+HeapWord* ShenandoahFreeSet::steal_from_mutator(size_t from, size_t to, ShenandoahAllocRequest& req, bool& in_new_region) {
+  // Scan [from; to) within the mutator bounds, right to left
+  for (size_t c = MIN2(to, _mutator_rightmost + 1); c > MAX2(from, _mutator_leftmost); c--) {
+    size_t idx = c - 1;
+    if (is_mutator_free(idx)) {
+      ShenandoahHeapRegion* r = _heap->get_region(idx);
+      if (is_empty_or_trash(r)) {
+        flip_to_gc(r);
+        HeapWord *result = try_allocate_in(r, req, in_new_region);
+        if (result != NULL) {
+          return result;
+        }
+      }
+    }
+  }
+  return NULL;
+}
+
 HeapWord* ShenandoahFreeSet::try_allocate_in(ShenandoahHeapRegion* r, ShenandoahAllocRequest& req, bool& in_new_region) {
   assert (!has_no_alloc_capacity(r), "Performance: should avoid full regions on this path: " SIZE_FORMAT, r->index());
 
@@ -418,23 +497,41 @@ void ShenandoahFreeSet::rebuild() {
   size_t to_reserve = _heap->max_capacity() / 100 * ShenandoahEvacReserve;
   size_t reserved = 0;
 
+  // With NUMA, spread the reserve over the tails of all node stripes, so that
+  // evacuating threads find collector regions on their local node.
+  if (_numa_nodes > 1) {
+    size_t node_to_reserve = to_reserve / _numa_nodes;
+    for (size_t node = 0; node < _numa_nodes; node++) {
+      size_t node_reserved = 0;
+      for (size_t idx = numa_node_end(node) - 1; idx > numa_node_begin(node); idx--) {
+        if (node_reserved >= node_to_reserve) break;
+        node_reserved += reserve_for_collector(idx);
+      }
+      reserved += node_reserved;
+    }
+  }
+
   for (size_t idx = _heap->num_regions() - 1; idx > 0; idx--) {
     if (reserved >= to_reserve) break;
-
-    ShenandoahHeapRegion* region = _heap->get_region(idx);
-    if (_mutator_free_bitmap.at(idx) && is_empty_or_trash(region)) {
-      _mutator_free_bitmap.clear_bit(idx);
-      _collector_free_bitmap.set_bit(idx);
-      size_t ac = alloc_capacity(region);
-      _capacity -= ac;
-      reserved += ac;
-    }
+    reserved += reserve_for_collector(idx);
   }
 
   recompute_bounds();
   assert_bounds();
 }
 
+size_t ShenandoahFreeSet::reserve_for_collector(size_t idx) {
+  ShenandoahHeapRegion* region = _heap->get_region(idx);
+  if (_mutator_free_bitmap.at(idx) && is_empty_or_trash(region)) {
+    _mutator_free_bitmap.clear_bit(idx);
+    _collector_free_bitmap.set_bit(idx);
+    size_t ac = alloc_capacity(region);
+    _capacity -= ac;
+    return ac;
+  }
+  return 0;
+}
+
 void ShenandoahFreeSet::log_status() {
   shenandoah_assert_heaplocked();
 
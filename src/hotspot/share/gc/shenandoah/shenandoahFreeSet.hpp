@@ -43,16 +43,29 @@ private:
   size_t _capacity;
   size_t _used;
 
+  // With UseNUMA, the heap is split into _numa_nodes contiguous stripes of
+  // regions, one per NUMA node. _numa_ids maps the stripe to the lgrp id.
+  size_t _numa_nodes;
+  int*   _numa_ids;
+
   void assert_bounds() const NOT_DEBUG_RETURN;
 
   bool is_mutator_free(size_t idx) const;
   bool is_collector_free(size_t idx) const;
 
+  size_t numa_node_begin(size_t node) const { return (node * _max + _numa_nodes - 1) / _numa_nodes; }
+  size_t numa_node_end(size_t node)   const { return numa_node_begin(node + 1); }
+  size_t current_numa_node() const;
+
   HeapWord* try_allocate_in(ShenandoahHeapRegion* region, ShenandoahAllocRequest& req, bool& in_new_region);
+  HeapWord* allocate_mutator(size_t from, size_t to, ShenandoahAllocRequest& req, bool& in_new_region);
+  HeapWord* allocate_collector(size_t from, size_t to, ShenandoahAllocRequest& req, bool& in_new_region);
+  HeapWord* steal_from_mutator(size_t from, size_t to, ShenandoahAllocRequest& req, bool& in_new_region);
   HeapWord* allocate_single(ShenandoahAllocRequest& req, bool& in_new_region);
   HeapWord* allocate_contiguous(ShenandoahAllocRequest& req);
 
   void flip_to_gc(ShenandoahHeapRegion* r);
+  size_t reserve_for_collector(size_t idx);
 
   void recompute_bounds();
   void adjust_bounds();
@@ -72,6 +85,7 @@ private:
 
 public:
   ShenandoahFreeSet(ShenandoahHeap* heap, size_t max_regions);
+  ~ShenandoahFreeSet();
 
   void clear();
   void rebuild();
@@ -90,6 +104,12 @@ public:
   HeapWord* allocate(ShenandoahAllocRequest& req, bool& in_new_region);
   size_t unsafe_peek_free() const;
 
+  size_t numa_nodes() const { return _numa_nodes; }
+  size_t numa_node_of(size_t idx) const { return idx * _numa_nodes / _max; }
+
+  // Bind the region memory to the NUMA node its stripe belongs to
+  void numa_make_local(ShenandoahHeapRegion* r) const;
+
   double internal_fragmentation();
   double external_fragmentation();
 
@@ -24,9 +24,13 @@
 #include "precompiled.hpp"
 #include "memory/allocation.hpp"
 
+#include "classfile/classLoaderDataGraph.hpp"
+#include "classfile/stringTable.hpp"
+#include "classfile/systemDictionary.hpp"
 #include "gc/shared/gcTimer.hpp"
 #include "gc/shared/gcTraceTime.inline.hpp"
 #include "gc/shared/memAllocator.hpp"
+#include "gc/shared/oopStorageParState.inline.hpp"
 #include "gc/shared/plab.hpp"
 
 #include "gc/shenandoah/parallelCleaning.hpp"
@@ -59,6 +63,7 @@
 #include "gc/shenandoah/shenandoahVMOperations.hpp"
 #include "gc/shenandoah/shenandoahWorkGroup.hpp"
 #include "gc/shenandoah/shenandoahWorkerPolicy.hpp"
+#include "gc/shenandoah/mode/shenandoahGenerationalMode.hpp"
 #include "gc/shenandoah/mode/shenandoahIUMode.hpp"
 #include "gc/shenandoah/mode/shenandoahPassiveMode.hpp"
 #include "gc/shenandoah/mode/shenandoahSATBMode.hpp"
@@ -67,6 +72,8 @@
 #endif
 
 #include "memory/metaspace.hpp"
+#include "prims/resolvedMethodTable.hpp"
+#include "runtime/globals_extension.hpp"
 #include "runtime/vmThread.hpp"
 #include "services/mallocTracker.hpp"
 
@@ -312,6 +319,10 @@ jint ShenandoahHeap::initialize() {
       ShenandoahHeapRegion* r = new (loc) ShenandoahHeapRegion(start, i, is_committed);
       assert(is_aligned(r, SHENANDOAH_CACHE_LINE_SIZE), "Sanity");
 
+      if (is_committed) {
+        _free_set->numa_make_local(r);
+      }
+
       _marking_context->initialize_top_at_mark_start(r);
       _regions[i] = r;
       assert(!collection_set()->is_in(i), "New region should not be in collection set");
@@ -406,6 +417,8 @@ void ShenandoahHeap::initialize_heuristics() {
       _gc_mode = new ShenandoahIUMode();
     } else if (strcmp(ShenandoahGCMode, "passive") == 0) {
       _gc_mode = new ShenandoahPassiveMode();
+    } else if (strcmp(ShenandoahGCMode, "generational") == 0) {
+      _gc_mode = new ShenandoahGenerationalMode();
     } else {
       vm_exit_during_initialization("Unknown -XX:ShenandoahGCMode option");
     }
@@ -561,6 +574,7 @@ void ShenandoahHeap::print_on(outputStream* st) const {
   if (is_degenerated_gc_in_progress())       st->print("degenerated gc, ");
   if (is_full_gc_in_progress())              st->print("full gc, ");
   if (is_full_gc_move_in_progress())         st->print("full gc move, ");
+  if (is_concurrent_weak_root_in_progress()) st->print("concurrent weak roots, ");
 
   if (cancelled_gc()) {
     st->print("cancelled");
@@ -694,6 +708,15 @@ void ShenandoahHeap::set_soft_max_capacity(size_t v) {
   OrderAccess::release_store_fence(&_soft_max_size, v);
 }
 
+bool ShenandoahHeap::update_soft_max_heap_size(size_t soft_max_heap_size) {
+  if (!FLAG_IS_DEFAULT(ShenandoahSoftMaxHeapSize) && !FLAG_IS_ERGO(ShenandoahSoftMaxHeapSize)) {
+    return false;
+  }
+  // The control thread picks up the new value, and uncommits down to it.
+  FLAG_SET_ERGO(size_t, ShenandoahSoftMaxHeapSize, MIN2(soft_max_heap_size, max_capacity()));
+  return true;
+}
+
 size_t ShenandoahHeap::min_capacity() const {
   return _minimum_size;
 }
@@ -1107,6 +1130,85 @@ void ShenandoahHeap::evacuate_and_update_roots() {
 #endif
 }
 
+// Cleans up the weak roots left by final mark: clears dead referents, and evacuates and
+// updates the alive referents that are in the collection set. Mutators can race with us
+// through the native barrier, which filters out dead referents and evacuates alive ones,
+// so both sides install the new value with CAS.
+class ShenandoahEvacUpdateCleanupOopStorageRootsClosure : public OopClosure {
+private:
+  ShenandoahHeap* const           _heap;
+  ShenandoahMarkingContext* const _mark_context;
+  const bool                      _evac_in_progress;
+  Thread* const                   _thread;
+  size_t                          _dead_counter;
+
+public:
+  ShenandoahEvacUpdateCleanupOopStorageRootsClosure() :
+    _heap(ShenandoahHeap::heap()),
+    _mark_context(ShenandoahHeap::heap()->complete_marking_context()),
+    _evac_in_progress(ShenandoahHeap::heap()->is_evacuation_in_progress()),
+    _thread(Thread::current()),
+    _dead_counter(0) {}
+
+  void do_oop(oop* p) {
+    const oop obj = RawAccess<>::oop_load(p);
+    if (!CompressedOops::is_null(obj)) {
+      if (!_mark_context->is_marked(obj)) {
+        shenandoah_assert_correct(p, obj);
+        ShenandoahHeap::cas_oop(oop(NULL), p, obj);
+        _dead_counter++;
+      } else if (_evac_in_progress && _heap->in_collection_set(obj)) {
+        oop resolved = ShenandoahBarrierSet::resolve_forwarded_not_null(obj);
+        if (resolved == obj) {
+          resolved = _heap->evacuate_object(obj, _thread);
+        }
+        ShenandoahHeap::cas_oop(resolved, p, obj);
+      }
+    }
+  }
+
+  void do_oop(narrowOop* p) {
+    ShouldNotReachHere();
+  }
+
+  size_t dead_counter() const {
+    return _dead_counter;
+  }
+};
+
+class ShenandoahConcurrentWeakRootsTask : public AbstractGangTask {
+private:
+  OopStorage::ParState<true /* concurrent */, false /* is_const */> _vm_weak_roots;
+  OopStorage::ParState<true /* concurrent */, false /* is_const */> _string_table_roots;
+
+public:
+  ShenandoahConcurrentWeakRootsTask() :
+    AbstractGangTask("Shenandoah Concurrent Weak Roots"),
+    _vm_weak_roots(SystemDictionary::vm_weak_oop_storage()),
+    _string_table_roots(StringTable::weak_storage()) {
+    StringTable::reset_dead_counter();
+  }
+
+  ~ShenandoahConcurrentWeakRootsTask() {
+    StringTable::finish_dead_counter();
+  }
+
+  void work(uint worker_id) {
+    ShenandoahConcurrentWorkerSession worker_session(worker_id);
+    ShenandoahSuspendibleThreadSetJoiner stsj(ShenandoahSuspendibleWorkers);
+    ShenandoahEvacOOMScope oom_evac_scope;
+    {
+      ShenandoahEvacUpdateCleanupOopStorageRootsClosure cl;
+      _vm_weak_roots.oops_do(&cl);
+    }
+    {
+      ShenandoahEvacUpdateCleanupOopStorageRootsClosure cl;
+      _string_table_roots.oops_do(&cl);
+      StringTable::inc_dead_counter(cl.dead_counter());
+    }
+  }
+};
+
 // Returns size in bytes
 size_t ShenandoahHeap::unsafe_max_tlab_alloc(Thread *thread) const {
   if (ShenandoahElasticTLAB) {
@@ -1524,6 +1626,12 @@ void ShenandoahHeap::op_final_mark() {
     set_concurrent_mark_in_progress(false);
     mark_complete_marking_context();
 
+    // Defer the weak roots that only the runtime can observe to the concurrent phase
+    // after this pause. Degenerated GC has no such phase, and does everything here.
+    if (ShenandoahConcurrentWeakRoots && !is_degenerated_gc_in_progress()) {
+      set_concurrent_weak_root_in_progress(true);
+    }
+
     parallel_cleaning(false /* full gc*/);
 
     if (ShenandoahVerify) {
@@ -1626,6 +1734,24 @@ void ShenandoahHeap::op_updaterefs() {
   update_heap_references(true);
 }
 
+void ShenandoahHeap::op_weak_roots() {
+  {
+    ShenandoahConcurrentWeakRootsTask task;
+    workers()->run_task(&task);
+  }
+
+  // Drop the entries whose referents have just been cleared
+  ResolvedMethodTable::unlink();
+
+  // Classes were unlinked in final mark pause, which also acts as the rendezvous
+  // that makes sure no thread can observe their metadata anymore.
+  if (unload_classes()) {
+    ClassLoaderDataGraph::purge();
+  }
+
+  set_concurrent_weak_root_in_progress(false);
+}
+
 void ShenandoahHeap::op_cleanup_early() {
   free_set()->recycle_trash();
 }
@@ -1940,6 +2066,9 @@ void ShenandoahHeap::stop() {
 void ShenandoahHeap::stw_unload_classes(bool full_gc) {
   if (!unload_classes()) return;
 
+  // StringTable, ResolvedMethodTable and CLDG purge are then left to op_weak_roots()
+  bool concurrent = is_concurrent_weak_root_in_progress();
+
   // Unload classes and purge SystemDictionary.
   bool purged_class;
   {
@@ -1955,11 +2084,15 @@ void ShenandoahHeap::stw_unload_classes(bool full_gc) {
     ShenandoahGCSubPhase phase(p);
     ShenandoahIsAliveSelector is_alive;
     uint num_workers = _workers->active_workers();
-    ParallelCleaningTask unlink_task(p, is_alive.is_alive_closure(), true, true, num_workers, purged_class);
+    ParallelCleaningTask unlink_task(p, is_alive.is_alive_closure(),
+                                     !concurrent /* process_strings */,
+                                     true        /* process_symbols */,
+                                     !concurrent /* process_resolved_methods */,
+                                     num_workers, purged_class);
     _workers->run_task(&unlink_task);
   }
 
-  {
+  if (!concurrent) {
     ShenandoahGCSubPhase phase(full_gc ?
                                ShenandoahPhaseTimings::full_gc_purge_cldg :
                                ShenandoahPhaseTimings::purge_cldg);
@@ -2066,6 +2199,10 @@ void ShenandoahHeap::set_full_gc_move_in_progress(bool in_progress) {
   _full_gc_move_in_progress.set_cond(in_progress);
 }
 
+void ShenandoahHeap::set_concurrent_weak_root_in_progress(bool in_progress) {
+  _concurrent_weak_root_in_progress.set_cond(in_progress);
+}
+
 void ShenandoahHeap::set_update_refs_in_progress(bool in_progress) {
   set_gc_state_mask(UPDATEREFS, in_progress);
 }
@@ -2127,7 +2264,7 @@ void ShenandoahHeap::assert_gc_workers(uint nworkers) {
   assert(nworkers > 0 && nworkers <= max_workers(), "Sanity");
 
   if (ShenandoahSafepoint::is_at_shenandoah_safepoint()) {
-    if (UseDynamicNumberOfGCThreads ||
+    if (UseDynamicNumberOfGCThreads || ShenandoahAdaptToCPUQuota ||
         (FLAG_IS_DEFAULT(ParallelGCThreads) && ForceDynamicNumberOfGCThreads)) {
       assert(nworkers <= ParallelGCThreads, "Cannot use more than it has");
     } else {
@@ -2135,7 +2272,7 @@ void ShenandoahHeap::assert_gc_workers(uint nworkers) {
       assert(nworkers == ParallelGCThreads, "Use ParalleGCThreads within safepoints");
     }
   } else {
-    if (UseDynamicNumberOfGCThreads ||
+    if (UseDynamicNumberOfGCThreads || ShenandoahAdaptToCPUQuota ||
         (FLAG_IS_DEFAULT(ConcGCThreads) && ForceDynamicNumberOfGCThreads)) {
       assert(nworkers <= ConcGCThreads, "Cannot use more than it has");
     } else {
@@ -2599,6 +2736,24 @@ void ShenandoahHeap::entry_updaterefs() {
   op_updaterefs();
 }
 
+void ShenandoahHeap::entry_weak_roots() {
+  if (!is_concurrent_weak_root_in_progress()) {
+    return;
+  }
+
+  static const char* msg = "Concurrent weak roots";
+  ShenandoahConcurrentPhase gc_phase(msg);
+  EventMark em("%s", msg);
+
+  ShenandoahGCPhase phase(ShenandoahPhaseTimings::conc_weak_roots);
+
+  ShenandoahWorkerScope scope(workers(),
+                              ShenandoahWorkerPolicy::calc_workers_for_conc_weak_roots(),
+                              "concurrent weak roots");
+
+  op_weak_roots();
+}
+
 void ShenandoahHeap::entry_cleanup_early() {
   static const char* msg = "Concurrent cleanup";
   ShenandoahConcurrentPhase gc_phase(msg,  true /* log_heap_usage */);
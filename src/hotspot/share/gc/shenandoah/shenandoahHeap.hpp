@@ -190,6 +190,8 @@ public:
 
   void set_soft_max_capacity(size_t v);
 
+  virtual bool update_soft_max_heap_size(size_t soft_max_heap_size);
+
 // ---------- Workers handling
 //
 private:
@@ -264,6 +266,7 @@ private:
   ShenandoahSharedFlag   _degenerated_gc_in_progress;
   ShenandoahSharedFlag   _full_gc_in_progress;
   ShenandoahSharedFlag   _full_gc_move_in_progress;
+  ShenandoahSharedFlag   _concurrent_weak_root_in_progress;
   ShenandoahSharedFlag   _progress_last_gc;
 
   void set_gc_state_all_threads(char state);
@@ -279,6 +282,7 @@ public:
   void set_degenerated_gc_in_progress(bool in_progress);
   void set_full_gc_in_progress(bool in_progress);
   void set_full_gc_move_in_progress(bool in_progress);
+  void set_concurrent_weak_root_in_progress(bool in_progress);
   void set_has_forwarded_objects(bool cond);
 
   inline bool is_stable() const;
@@ -289,6 +293,7 @@ public:
   inline bool is_degenerated_gc_in_progress() const;
   inline bool is_full_gc_in_progress() const;
   inline bool is_full_gc_move_in_progress() const;
+  inline bool is_concurrent_weak_root_in_progress() const;
   inline bool has_forwarded_objects() const;
   inline bool is_gc_in_progress_mask(uint mask) const;
 
@@ -379,6 +384,7 @@ public:
   void entry_reset();
   void entry_mark();
   void entry_preclean();
+  void entry_weak_roots();
   void entry_cleanup_early();
   void entry_evac();
   void entry_updaterefs();
@@ -399,6 +405,7 @@ private:
   void op_reset();
   void op_mark();
   void op_preclean();
+  void op_weak_roots();
   void op_cleanup_early();
   void op_conc_evac();
   void op_stw_evac();
@@ -433,6 +440,7 @@ private:
 
 public:
   ShenandoahCollectorPolicy* shenandoah_policy() const { return _shenandoah_policy; }
+  ShenandoahMode*            mode()              const { return _gc_mode;           }
   ShenandoahHeuristics*      heuristics()        const { return _heuristics;        }
   ShenandoahFreeSet*         free_set()          const { return _free_set;          }
   ShenandoahConcurrentMark*  concurrent_mark()         { return _scm;               }
@@ -23,6 +23,7 @@
 
 #include "precompiled.hpp"
 #include "memory/allocation.hpp"
+#include "gc/shenandoah/shenandoahFreeSet.hpp"
 #include "gc/shenandoah/shenandoahHeapRegionSet.inline.hpp"
 #include "gc/shenandoah/shenandoahHeap.inline.hpp"
 #include "gc/shenandoah/shenandoahHeapRegion.hpp"
@@ -57,6 +58,8 @@ ShenandoahHeapRegion::ShenandoahHeapRegion(HeapWord* start, size_t index, bool c
   _new_top(NULL),
   _empty_time(os::elapsedTime()),
   _state(committed ? _empty_committed : _empty_uncommitted),
+  _affiliation(_affiliation_free),
+  _age(0),
   _top(start),
   _tlab_allocs(0),
   _gclab_allocs(0),
@@ -637,6 +640,7 @@ void ShenandoahHeapRegion::do_commit() {
   if (!heap->is_heap_region_special() && !os::commit_memory((char *) bottom(), RegionSizeBytes, false)) {
     report_java_out_of_memory("Unable to commit region");
   }
+  heap->free_set()->numa_make_local(this);
   if (!heap->commit_bitmap_slice(this)) {
     report_java_out_of_memory("Unable to commit bitmaps for region");
   }
@@ -667,7 +671,24 @@ void ShenandoahHeapRegion::set_state(RegionState to) {
     evt.set_to(to);
     evt.commit();
   }
+
+  // First allocation makes the region young, reclamation frees it
+  const bool was_empty = is_empty();
   _state = to;
+  if (was_empty && !is_empty()) {
+    _affiliation = _affiliation_young;
+    _age = 0;
+  } else if (!was_empty && is_empty()) {
+    _affiliation = _affiliation_free;
+    _age = 0;
+  }
+}
+
+void ShenandoahHeapRegion::increment_age() {
+  assert(is_active(), "Only active regions age");
+  if (is_young() && ++_age >= ShenandoahTenuringThreshold) {
+    _affiliation = _affiliation_old;
+  }
 }
 
 void ShenandoahHeapRegion::record_pin() {
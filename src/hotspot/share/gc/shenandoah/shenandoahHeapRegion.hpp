@@ -162,6 +162,26 @@ private:
   void report_illegal_transition(const char* method);
 
 public:
+  // Generation the region belongs to, only maintained in generational mode.
+  // Regions become young on first allocation, and old after surviving
+  // ShenandoahTenuringThreshold cycles without being collected.
+  enum RegionAffiliation {
+    _affiliation_free,        // region is empty
+    _affiliation_young,       // region holds recently allocated objects
+    _affiliation_old          // region has survived enough cycles to be tenured
+  };
+
+  static const char* affiliation_to_string(RegionAffiliation a) {
+    switch (a) {
+      case _affiliation_free:        return "Free";
+      case _affiliation_young:       return "Young";
+      case _affiliation_old:         return "Old";
+      default:
+        ShouldNotReachHere();
+        return "";
+    }
+  }
+
   static const int region_states_num() {
     return _REGION_STATES_NUM;
   }
@@ -205,6 +225,13 @@ public:
   RegionState state()              const { return _state; }
   int  state_ordinal()             const { return region_state_to_ordinal(_state); }
 
+  // Generations:
+  RegionAffiliation affiliation()  const { return _affiliation; }
+  bool is_young()                  const { return _affiliation == _affiliation_young; }
+  bool is_old()                    const { return _affiliation == _affiliation_old; }
+  uint age()                       const { return _age; }
+  void increment_age();
+
   void record_pin();
   void record_unpin();
   size_t pin_count() const;
@@ -233,6 +260,8 @@ private:
 
   // Seldom updated fields
   RegionState _state;
+  RegionAffiliation _affiliation;
+  uint _age;
 
   // Frequently updated fields
   HeapWord* _top;
@@ -92,6 +92,7 @@ class outputStream;
   f(init_evac,                                      "  Initial Evacuation")            \
   SHENANDOAH_PAR_PHASE_DO(evac_,                    "    E: ", f)                      \
                                                                                        \
+  f(conc_weak_roots,                                "Concurrent Weak Roots")           \
   f(conc_cleanup_early,                             "Concurrent Cleanup")              \
   f(conc_evac,                                      "Concurrent Evacuation")           \
                                                                                        \
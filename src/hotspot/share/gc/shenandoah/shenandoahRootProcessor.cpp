@@ -38,8 +38,13 @@
 #include "memory/allocation.inline.hpp"
 #include "memory/iterator.hpp"
 #include "memory/resourceArea.hpp"
+#include "prims/jvmtiExport.hpp"
+#include "runtime/jniHandles.hpp"
 #include "runtime/thread.hpp"
 #include "services/management.hpp"
+#if INCLUDE_JFR
+#include "jfr/jfr.hpp"
+#endif
 
 ShenandoahSerialRoot::ShenandoahSerialRoot(ShenandoahSerialRoot::OopsDo oops_do,
   ShenandoahPhaseTimings::Phase phase, ShenandoahPhaseTimings::ParPhase par_phase) :
@@ -97,12 +102,19 @@ ShenandoahThreadRoots::~ShenandoahThreadRoots() {
 ShenandoahWeakRoots::ShenandoahWeakRoots(ShenandoahPhaseTimings::Phase phase, uint n_workers) :
   _phase(phase),
   _par_state_string(StringTable::weak_storage()),
-  _claimed(false) {
+  _claimed(false),
+  _concurrent(ShenandoahHeap::heap()->is_concurrent_weak_root_in_progress()) {
 }
 
 ShenandoahWeakRoots::~ShenandoahWeakRoots() {
 }
 
+void ShenandoahWeakRoots::pause_weak_oops_do(BoolObjectClosure* is_alive, OopClosure* keep_alive) {
+  JNIHandles::weak_oops_do(is_alive, keep_alive);
+  JvmtiExport::weak_oops_do(is_alive, keep_alive);
+  JFR_ONLY(Jfr::weak_oops_do(is_alive, keep_alive);)
+}
+
 ShenandoahStringDedupRoots::ShenandoahStringDedupRoots(ShenandoahPhaseTimings::Phase phase) : _phase(phase) {
   if (ShenandoahStringDedup::is_enabled()) {
     StringDedup::gc_prologue(false);
@@ -88,11 +88,17 @@ class ShenandoahWeakRoots {
   ShenandoahPhaseTimings::Phase      _phase;
   OopStorage::ParState<false, false> _par_state_string;
   volatile bool                      _claimed;
+  // VM weak handles and StringTable are left to the concurrent weak roots phase
+  const bool                         _concurrent;
 
 public:
   ShenandoahWeakRoots(ShenandoahPhaseTimings::Phase phase, uint n_workers);
   ~ShenandoahWeakRoots();
 
+  // Weak roots that are always processed at a pause. Generated code resolves
+  // JNI weak handles without the barrier that filters out dead referents.
+  static void pause_weak_oops_do(BoolObjectClosure* is_alive, OopClosure* keep_alive);
+
   template <typename IsAlive, typename KeepAlive>
   void oops_do(IsAlive* is_alive, KeepAlive* keep_alive, uint worker_id);
 };
@@ -36,10 +36,16 @@
 template <typename IsAlive, typename KeepAlive>
 void ShenandoahWeakRoots::oops_do(IsAlive* is_alive, KeepAlive* keep_alive, uint worker_id) {
   if (!_claimed && Atomic::cmpxchg(true, &_claimed, false) == false) {
-    WeakProcessor::weak_oops_do(is_alive, keep_alive);
+    if (_concurrent) {
+      pause_weak_oops_do(is_alive, keep_alive);
+    } else {
+      WeakProcessor::weak_oops_do(is_alive, keep_alive);
+    }
   }
 
-  _par_state_string.weak_oops_do<IsAlive, KeepAlive>(is_alive, keep_alive);
+  if (!_concurrent) {
+    _par_state_string.weak_oops_do<IsAlive, KeepAlive>(is_alive, keep_alive);
+  }
 }
 
 template <bool SINGLE_THREADED>
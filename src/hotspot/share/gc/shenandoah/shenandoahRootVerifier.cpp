@@ -29,8 +29,9 @@
 #include "classfile/systemDictionary.hpp"
 #include "code/codeCache.hpp"
 #include "gc/shenandoah/shenandoahAsserts.hpp"
-#include "gc/shenandoah/shenandoahHeap.hpp"
+#include "gc/shenandoah/shenandoahHeap.inline.hpp"
 #include "gc/shenandoah/shenandoahPhaseTimings.hpp"
+#include "gc/shenandoah/shenandoahRootProcessor.hpp"
 #include "gc/shenandoah/shenandoahRootVerifier.hpp"
 #include "gc/shenandoah/shenandoahStringDedup.hpp"
 #include "gc/shenandoah/shenandoahUtils.hpp"
@@ -54,6 +55,16 @@ bool ShenandoahRootVerifier::verify(RootTypes type) const {
   return (_types & type) != 0;
 }
 
+void ShenandoahRootVerifier::weak_roots_do(BoolObjectClosure* is_alive, OopClosure* oops) {
+  // Until the concurrent weak roots phase completes, VM weak handles may still
+  // point to dead objects. Only verify the weak roots that were cleaned at the pause.
+  if (ShenandoahHeap::heap()->is_concurrent_weak_root_in_progress()) {
+    ShenandoahWeakRoots::pause_weak_oops_do(is_alive, oops);
+  } else {
+    WeakProcessor::weak_oops_do(is_alive, oops);
+  }
+}
+
 void ShenandoahRootVerifier::oops_do(OopClosure* oops) {
   CodeBlobToOopClosure blobs(oops, !CodeBlobToOopClosure::FixRelocations);
   if (verify(CodeRoots)) {
@@ -84,7 +95,7 @@ void ShenandoahRootVerifier::oops_do(OopClosure* oops) {
   if (verify(WeakRoots)) {
     shenandoah_assert_safepoint();
     AlwaysTrueClosure always_true;
-    WeakProcessor::weak_oops_do(&always_true, oops);
+    weak_roots_do(&always_true, oops);
   }
 
   if (ShenandoahStringDedup::is_enabled() && verify(StringDedupRoots)) {
@@ -118,7 +129,7 @@ void ShenandoahRootVerifier::roots_do(OopClosure* oops) {
   SystemDictionary::oops_do(oops);
 
   AlwaysTrueClosure always_true;
-  WeakProcessor::weak_oops_do(&always_true, oops);
+  weak_roots_do(&always_true, oops);
 
   if (ShenandoahStringDedup::is_enabled()) {
     ShenandoahStringDedup::oops_do_slow(oops);
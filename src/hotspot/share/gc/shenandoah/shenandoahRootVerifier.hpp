@@ -54,6 +54,7 @@ public:
   void strong_roots_do(OopClosure* cl);
 private:
   bool verify(RootTypes type) const;
+  static void weak_roots_do(BoolObjectClosure* is_alive, OopClosure* oops);
 };
 
 #endif // SHARE_GC_SHENANDOAH_SHENANDOAHROOTVERIFIER_HPP
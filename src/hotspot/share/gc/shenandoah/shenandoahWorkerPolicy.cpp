@@ -25,6 +25,8 @@
 
 #include "gc/shared/adaptiveSizePolicy.hpp"
 #include "gc/shenandoah/shenandoahWorkerPolicy.hpp"
+#include "gc/shenandoah/shenandoah_globals.hpp"
+#include "runtime/os.hpp"
 #include "runtime/thread.hpp"
 
 uint ShenandoahWorkerPolicy::_prev_par_marking     = 0;
@@ -35,24 +37,36 @@ uint ShenandoahWorkerPolicy::_prev_degengc         = 0;
 uint ShenandoahWorkerPolicy::_prev_conc_update_ref = 0;
 uint ShenandoahWorkerPolicy::_prev_par_update_ref  = 0;
 uint ShenandoahWorkerPolicy::_prev_conc_cleanup    = 0;
+uint ShenandoahWorkerPolicy::_prev_conc_weak_roots = 0;
 uint ShenandoahWorkerPolicy::_prev_conc_reset      = 0;
 
+// Running more workers than there are processors available, e.g. under a container
+// CPU quota, only gets the workers throttled. os::active_processor_count() tracks
+// the quota, so re-read it for every cycle.
+uint ShenandoahWorkerPolicy::cap_to_available_cpus(uint workers) {
+  if (ShenandoahAdaptToCPUQuota) {
+    uint cpus = (uint)MAX2(1, os::active_processor_count());
+    return MIN2(workers, cpus);
+  }
+  return workers;
+}
+
 uint ShenandoahWorkerPolicy::calc_workers_for_init_marking() {
   uint active_workers = (_prev_par_marking == 0) ? ParallelGCThreads : _prev_par_marking;
 
   _prev_par_marking =
-    AdaptiveSizePolicy::calc_active_workers(ParallelGCThreads,
-                                            active_workers,
-                                            Threads::number_of_non_daemon_threads());
+    cap_to_available_cpus(AdaptiveSizePolicy::calc_active_workers(ParallelGCThreads,
+                                                                  active_workers,
+                                                                  Threads::number_of_non_daemon_threads()));
   return _prev_par_marking;
 }
 
 uint ShenandoahWorkerPolicy::calc_workers_for_conc_marking() {
   uint active_workers = (_prev_conc_marking == 0) ?  ConcGCThreads : _prev_conc_marking;
   _prev_conc_marking =
-    AdaptiveSizePolicy::calc_active_conc_workers(ConcGCThreads,
-                                                 active_workers,
-                                                 Threads::number_of_non_daemon_threads());
+    cap_to_available_cpus(AdaptiveSizePolicy::calc_active_conc_workers(ConcGCThreads,
+                                                                       active_workers,
+                                                                       Threads::number_of_non_daemon_threads()));
   return _prev_conc_marking;
 }
 
@@ -65,9 +79,9 @@ uint ShenandoahWorkerPolicy::calc_workers_for_final_marking() {
 uint ShenandoahWorkerPolicy::calc_workers_for_conc_evac() {
   uint active_workers = (_prev_conc_evac == 0) ? ConcGCThreads : _prev_conc_evac;
   _prev_conc_evac =
-    AdaptiveSizePolicy::calc_active_conc_workers(ConcGCThreads,
-                                                 active_workers,
-                                                 Threads::number_of_non_daemon_threads());
+    cap_to_available_cpus(AdaptiveSizePolicy::calc_active_conc_workers(ConcGCThreads,
+                                                                       active_workers,
+                                                                       Threads::number_of_non_daemon_threads()));
   return _prev_conc_evac;
 }
 
@@ -75,9 +89,9 @@ uint ShenandoahWorkerPolicy::calc_workers_for_conc_evac() {
 uint ShenandoahWorkerPolicy::calc_workers_for_fullgc() {
   uint active_workers = (_prev_fullgc == 0) ?  ParallelGCThreads : _prev_fullgc;
   _prev_fullgc =
-    AdaptiveSizePolicy::calc_active_workers(ParallelGCThreads,
-                                            active_workers,
-                                            Threads::number_of_non_daemon_threads());
+    cap_to_available_cpus(AdaptiveSizePolicy::calc_active_workers(ParallelGCThreads,
+                                                                  active_workers,
+                                                                  Threads::number_of_non_daemon_threads()));
   return _prev_fullgc;
 }
 
@@ -85,9 +99,9 @@ uint ShenandoahWorkerPolicy::calc_workers_for_fullgc() {
 uint ShenandoahWorkerPolicy::calc_workers_for_stw_degenerated() {
   uint active_workers = (_prev_degengc == 0) ?  ParallelGCThreads : _prev_degengc;
   _prev_degengc =
-    AdaptiveSizePolicy::calc_active_workers(ParallelGCThreads,
-                                            active_workers,
-                                            Threads::number_of_non_daemon_threads());
+    cap_to_available_cpus(AdaptiveSizePolicy::calc_active_workers(ParallelGCThreads,
+                                                                  active_workers,
+                                                                  Threads::number_of_non_daemon_threads()));
   return _prev_degengc;
 }
 
@@ -95,9 +109,9 @@ uint ShenandoahWorkerPolicy::calc_workers_for_stw_degenerated() {
 uint ShenandoahWorkerPolicy::calc_workers_for_conc_update_ref() {
   uint active_workers = (_prev_conc_update_ref == 0) ? ConcGCThreads : _prev_conc_update_ref;
   _prev_conc_update_ref =
-    AdaptiveSizePolicy::calc_active_conc_workers(ConcGCThreads,
-                                                 active_workers,
-                                                 Threads::number_of_non_daemon_threads());
+    cap_to_available_cpus(AdaptiveSizePolicy::calc_active_conc_workers(ConcGCThreads,
+                                                                       active_workers,
+                                                                       Threads::number_of_non_daemon_threads()));
   return _prev_conc_update_ref;
 }
 
@@ -105,9 +119,9 @@ uint ShenandoahWorkerPolicy::calc_workers_for_conc_update_ref() {
 uint ShenandoahWorkerPolicy::calc_workers_for_final_update_ref() {
   uint active_workers = (_prev_par_update_ref == 0) ? ParallelGCThreads : _prev_par_update_ref;
   _prev_par_update_ref =
-    AdaptiveSizePolicy::calc_active_workers(ParallelGCThreads,
-                                            active_workers,
-                                            Threads::number_of_non_daemon_threads());
+    cap_to_available_cpus(AdaptiveSizePolicy::calc_active_workers(ParallelGCThreads,
+                                                                  active_workers,
+                                                                  Threads::number_of_non_daemon_threads()));
   return _prev_par_update_ref;
 }
 
@@ -119,17 +133,26 @@ uint ShenandoahWorkerPolicy::calc_workers_for_conc_preclean() {
 uint ShenandoahWorkerPolicy::calc_workers_for_conc_cleanup() {
   uint active_workers = (_prev_conc_cleanup == 0) ? ConcGCThreads : _prev_conc_cleanup;
   _prev_conc_cleanup =
-          AdaptiveSizePolicy::calc_active_conc_workers(ConcGCThreads,
-                                                       active_workers,
-                                                       Threads::number_of_non_daemon_threads());
+          cap_to_available_cpus(AdaptiveSizePolicy::calc_active_conc_workers(ConcGCThreads,
+                                                                             active_workers,
+                                                                             Threads::number_of_non_daemon_threads()));
   return _prev_conc_cleanup;
 }
 
+uint ShenandoahWorkerPolicy::calc_workers_for_conc_weak_roots() {
+  uint active_workers = (_prev_conc_weak_roots == 0) ? ConcGCThreads : _prev_conc_weak_roots;
+  _prev_conc_weak_roots =
+          cap_to_available_cpus(AdaptiveSizePolicy::calc_active_conc_workers(ConcGCThreads,
+                                                                             active_workers,
+                                                                             Threads::number_of_non_daemon_threads()));
+  return _prev_conc_weak_roots;
+}
+
 uint ShenandoahWorkerPolicy::calc_workers_for_conc_reset() {
   uint active_workers = (_prev_conc_reset == 0) ? ConcGCThreads : _prev_conc_reset;
   _prev_conc_reset =
-          AdaptiveSizePolicy::calc_active_conc_workers(ConcGCThreads,
-                                                       active_workers,
-                                                       Threads::number_of_non_daemon_threads());
+          cap_to_available_cpus(AdaptiveSizePolicy::calc_active_conc_workers(ConcGCThreads,
+                                                                             active_workers,
+                                                                             Threads::number_of_non_daemon_threads()));
   return _prev_conc_reset;
 }
@@ -36,8 +36,12 @@ private:
   static uint _prev_conc_update_ref;
   static uint _prev_par_update_ref;
   static uint _prev_conc_cleanup;
+  static uint _prev_conc_weak_roots;
   static uint _prev_conc_reset;
 
+  // Cap the number of workers to the processors currently available
+  static uint cap_to_available_cpus(uint workers);
+
 public:
   // Calculate the number of workers for initial marking
   static uint calc_workers_for_init_marking();
@@ -69,6 +73,9 @@ public:
   // Calculate workers for concurrent cleanup
   static uint calc_workers_for_conc_cleanup();
 
+  // Calculate workers for concurrent weak roots
+  static uint calc_workers_for_conc_weak_roots();
+
   // Calculate workers for concurrent reset
   static uint calc_workers_for_conc_reset();
 };
@@ -67,7 +67,9 @@
           "barriers are in in use. Possible values are:"                    \
           " satb - snapshot-at-the-beginning concurrent GC (three pass mark-evac-update);"  \
           " iu - incremental-update concurrent GC (three pass mark-evac-update);"  \
-          " passive - stop the world GC only (either degenerated or full)") \
+          " passive - stop the world GC only (either degenerated or full);" \
+          " generational - satb with young/old region affiliation "         \
+          "(experimental)")                                                 \
                                                                             \
   product(ccstr, ShenandoahGCHeuristics, "adaptive",                        \
           "GC heuristics to use. This fine-tunes the GC mode selected, "    \
@@ -93,6 +95,12 @@
           "GC cycles, as degenerated and full GCs would try to unload "     \
           "classes regardless. Set to zero to disable class unloading.")    \
                                                                             \
+  experimental(bool, ShenandoahConcurrentWeakRoots, false,                  \
+          "Clean VM weak handles, StringTable and ResolvedMethodTable, "    \
+          "and purge unloaded class loader data in a concurrent phase "     \
+          "after final mark, instead of in the final mark pause. JNI "      \
+          "weak handles and nmethods are still processed in the pause.")    \
+                                                                            \
   experimental(uintx, ShenandoahGarbageThreshold, 25,                       \
           "How much garbage a region has to contain before it would be "    \
           "taken for collection. This a guideline only, as GC heuristics "  \
@@ -101,6 +109,18 @@
           "collector accepts. In percents of heap region size.")            \
           range(0,100)                                                      \
                                                                             \
+  experimental(uintx, ShenandoahOldGarbageThreshold, 50,                    \
+          "In generational mode, how much garbage an old region has to "    \
+          "contain before it would be taken for collection. Old regions "   \
+          "are expected to stay mostly live, so this is higher than "       \
+          "ShenandoahGarbageThreshold. In percents of heap region size.")   \
+          range(0,100)                                                      \
+                                                                            \
+  experimental(uintx, ShenandoahTenuringThreshold, 3,                       \
+          "In generational mode, how many GC cycles a region has to "       \
+          "survive without being collected before it becomes old.")         \
+          range(1,16)                                                       \
+                                                                            \
   experimental(uintx, ShenandoahInitFreeThreshold, 70,                      \
           "How much heap should be free before some heuristics trigger the "\
           "initial (learning) cycles. Affects cycle frequency on startup "  \
@@ -132,6 +152,13 @@
           "to learn application and GC performance.")                       \
           range(0,100)                                                      \
                                                                             \
+  experimental(bool, ShenandoahAdaptToCPUQuota, false,                      \
+          "Track the processors currently available to the JVM, e.g. the "  \
+          "container CPU quota. Cap the number of GC workers used in each " \
+          "cycle to it, and let adaptive heuristics start cycles earlier "  \
+          "when fewer processors are available than in the cycles "         \
+          "they learned from.")                                             \
+                                                                            \
   experimental(uintx, ShenandoahImmediateThreshold, 90,                     \
           "The cycle may shortcut when enough garbage can be reclaimed "    \
           "from the immediate garbage (completely garbage regions). "       \
@@ -36,6 +36,7 @@ public:
   virtual void initialize();
   virtual size_t conservative_max_heap_alignment();
   virtual CollectedHeap* create_heap();
+  virtual bool supports_compressed_oops() const { return false; }
 };
 
 #endif // SHARE_GC_Z_ZARGUMENTS_HPP
@@ -32,6 +32,7 @@
 #include "gc/z/zStat.hpp"
 #include "gc/z/zUtils.inline.hpp"
 #include "memory/iterator.hpp"
+#include "runtime/globals_extension.hpp"
 #include "runtime/mutexLocker.hpp"
 
 ZCollectedHeap* ZCollectedHeap::heap() {
@@ -49,6 +50,7 @@ ZCollectedHeap::ZCollectedHeap(ZCollectorPolicy* policy) :
     _heap(),
     _director(new ZDirector()),
     _driver(new ZDriver()),
+    _uncommitter(new ZUncommitter()),
     _stat(new ZStat()),
     _runtime_workers() {}
 
@@ -78,6 +80,7 @@ void ZCollectedHeap::initialize_serviceability() {
 void ZCollectedHeap::stop() {
   _director->stop();
   _driver->stop();
+  _uncommitter->stop();
   _stat->stop();
 }
 
@@ -93,6 +96,14 @@ size_t ZCollectedHeap::max_capacity() const {
   return _heap.max_capacity();
 }
 
+bool ZCollectedHeap::update_soft_max_heap_size(size_t soft_max_heap_size) {
+  if (!FLAG_IS_DEFAULT(ZSoftMaxHeapSize) && !FLAG_IS_ERGO(ZSoftMaxHeapSize)) {
+    return false;
+  }
+  FLAG_SET_ERGO(size_t, ZSoftMaxHeapSize, soft_max_heap_size);
+  return true;
+}
+
 size_t ZCollectedHeap::capacity() const {
   return _heap.capacity();
 }
@@ -246,6 +257,10 @@ void ZCollectedHeap::safe_object_iterate(ObjectClosure* cl) {
   _heap.object_iterate(cl, true /* visit_weaks */);
 }
 
+ParallelObjectIterator* ZCollectedHeap::parallel_object_iterator(uint nworkers) {
+  return _heap.parallel_object_iterator(nworkers, true /* visit_weaks */);
+}
+
 HeapWord* ZCollectedHeap::block_start(const void* addr) const {
   return (HeapWord*)_heap.block_start((uintptr_t)addr);
 }
@@ -286,6 +301,7 @@ jlong ZCollectedHeap::millis_since_last_gc() {
 void ZCollectedHeap::gc_threads_do(ThreadClosure* tc) const {
   tc->do_thread(_director);
   tc->do_thread(_driver);
+  tc->do_thread(_uncommitter);
   tc->do_thread(_stat);
   _heap.worker_threads_do(tc);
   _runtime_workers.threads_do(tc);
@@ -345,6 +361,8 @@ void ZCollectedHeap::print_gc_threads_on(outputStream* st) const {
   st->cr();
   _driver->print_on(st);
   st->cr();
+  _uncommitter->print_on(st);
+  st->cr();
   _stat->print_on(st);
   st->cr();
   _heap.print_worker_threads_on(st);
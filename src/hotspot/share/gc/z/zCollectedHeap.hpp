@@ -34,6 +34,7 @@
 #include "gc/z/zHeap.hpp"
 #include "gc/z/zRuntimeWorkers.hpp"
 #include "gc/z/zStat.hpp"
+#include "gc/z/zUncommitter.hpp"
 
 class ZCollectedHeap : public CollectedHeap {
   friend class VMStructs;
@@ -46,6 +47,7 @@ private:
   ZHeap             _heap;
   ZDirector*        _director;
   ZDriver*          _driver;
+  ZUncommitter*     _uncommitter;
   ZStat*            _stat;
   ZRuntimeWorkers   _runtime_workers;
 
@@ -67,6 +69,7 @@ public:
   virtual SoftRefPolicy* soft_ref_policy();
 
   virtual size_t max_capacity() const;
+  virtual bool update_soft_max_heap_size(size_t soft_max_heap_size);
   virtual size_t capacity() const;
   virtual size_t used() const;
 
@@ -100,6 +103,7 @@ public:
 
   virtual void object_iterate(ObjectClosure* cl);
   virtual void safe_object_iterate(ObjectClosure* cl);
+  virtual ParallelObjectIterator* parallel_object_iterator(uint nworkers);
 
   virtual HeapWord* block_start(const void* addr) const;
   virtual size_t block_size(const HeapWord* addr) const;
@@ -31,6 +31,7 @@
 #include "gc/z/zList.inline.hpp"
 #include "gc/z/zLock.inline.hpp"
 #include "gc/z/zMark.inline.hpp"
+#include "gc/z/zNUMA.hpp"
 #include "gc/z/zOopClosures.inline.hpp"
 #include "gc/z/zPage.inline.hpp"
 #include "gc/z/zPageTable.inline.hpp"
@@ -92,9 +93,10 @@ size_t ZHeap::heap_max_size() const {
 }
 
 size_t ZHeap::heap_max_reserve_size() const {
-  // Reserve one small page per worker plus one shared medium page. This is still just
-  // an estimate and doesn't guarantee that we can't run out of memory during relocation.
-  const size_t max_reserve_size = (_workers.nworkers() * ZPageSizeSmall) + ZPageSizeMedium;
+  // Reserve one small page per worker and NUMA node plus one shared medium page. This is
+  // still just an estimate and doesn't guarantee that we can't run out of memory during
+  // relocation.
+  const size_t max_reserve_size = (_workers.nworkers() * ZNUMA::count() * ZPageSizeSmall) + ZPageSizeMedium;
   return MIN2(max_reserve_size, heap_max_size());
 }
 
@@ -110,6 +112,10 @@ size_t ZHeap::max_capacity() const {
   return _page_allocator.max_capacity();
 }
 
+size_t ZHeap::soft_max_capacity() const {
+  return _page_allocator.soft_max_capacity();
+}
+
 size_t ZHeap::current_max_capacity() const {
   return _page_allocator.current_max_capacity();
 }
@@ -224,8 +230,8 @@ void ZHeap::out_of_memory() {
   log_info(gc)("Out Of Memory (%s)", Thread::current()->name());
 }
 
-ZPage* ZHeap::alloc_page(uint8_t type, size_t size, ZAllocationFlags flags) {
-  ZPage* const page = _page_allocator.alloc_page(type, size, flags);
+ZPage* ZHeap::alloc_page(uint8_t type, size_t size, uint32_t numa_id, ZAllocationFlags flags) {
+  ZPage* const page = _page_allocator.alloc_page(type, size, numa_id, flags);
   if (page != NULL) {
     // Update pagetable
     _pagetable.insert(page);
@@ -259,6 +265,10 @@ void ZHeap::free_pages(const ZArray<ZPage*>* pages, bool reclaimed) {
   _page_allocator.free_pages(pages, reclaimed);
 }
 
+uint64_t ZHeap::uncommit(uint64_t delay) {
+  return _page_allocator.uncommit(delay);
+}
+
 void ZHeap::before_flip() {
   if (ZVerifyViews) {
     // Unmap all pages
@@ -416,6 +426,11 @@ void ZHeap::destroy_detached_pages() {
 }
 
 void ZHeap::select_relocation_set() {
+  const bool numa_enabled = ZNUMA::is_enabled();
+  if (numa_enabled) {
+    ZStatNUMA::reset_at_select_relocation_set();
+  }
+
   // Register relocatable pages with selector
   ZRelocationSetSelector selector;
   ZPageTableIterator iter(&_pagetable);
@@ -425,6 +440,11 @@ void ZHeap::select_relocation_set() {
       continue;
     }
 
+    if (numa_enabled && page->type() == ZPageTypeSmall) {
+      // Update per-node statistics
+      ZStatNUMA::register_small_page(page->numa_id());
+    }
+
     if (page->is_marked()) {
       // Register live page
       selector.register_live_page(page);
@@ -524,8 +544,14 @@ void ZHeap::relocate() {
 void ZHeap::object_iterate(ObjectClosure* cl, bool visit_weaks) {
   assert(SafepointSynchronize::is_at_safepoint(), "Should be at safepoint");
 
-  ZHeapIterator iter(visit_weaks);
-  iter.objects_do(cl, visit_weaks);
+  ZHeapIterator iter(1 /* nworkers */, visit_weaks);
+  iter.object_iterate(cl, 0 /* worker_id */);
+}
+
+ParallelObjectIterator* ZHeap::parallel_object_iterator(uint nworkers, bool visit_weaks) {
+  assert(SafepointSynchronize::is_at_safepoint(), "Should be at safepoint");
+
+  return new ZHeapIterator(nworkers, visit_weaks);
 }
 
 void ZHeap::serviceability_initialize() {
@@ -45,6 +45,7 @@
 #include "gc/z/zWorkers.hpp"
 #include "memory/allocation.hpp"
 
+class ParallelObjectIterator;
 class ThreadClosure;
 class ZPage;
 class ZRelocationSetSelector;
@@ -90,6 +91,7 @@ public:
   // Heap metrics
   size_t min_capacity() const;
   size_t max_capacity() const;
+  size_t soft_max_capacity() const;
   size_t current_max_capacity() const;
   size_t capacity() const;
   size_t max_reserve() const;
@@ -126,16 +128,19 @@ public:
   void process_non_strong_references();
 
   // Page allocation
-  ZPage* alloc_page(uint8_t type, size_t size, ZAllocationFlags flags);
+  ZPage* alloc_page(uint8_t type, size_t size, uint32_t numa_id, ZAllocationFlags flags);
   void undo_alloc_page(ZPage* page);
   bool retain_page(ZPage* page);
   void release_page(ZPage* page, bool reclaimed);
   void free_pages(const ZArray<ZPage*>* pages, bool reclaimed);
 
+  // Uncommit memory
+  uint64_t uncommit(uint64_t delay);
+
   // Object allocation
   uintptr_t alloc_tlab(size_t size);
   uintptr_t alloc_object(size_t size);
-  uintptr_t alloc_object_for_relocation(size_t size);
+  uintptr_t alloc_object_for_relocation(size_t size, uint32_t numa_id);
   void undo_alloc_object_for_relocation(uintptr_t addr, size_t size);
   bool is_alloc_stalled() const;
   void check_out_of_memory();
@@ -168,6 +173,7 @@ public:
 
   // Iteration
   void object_iterate(ObjectClosure* cl, bool visit_weaks);
+  ParallelObjectIterator* parallel_object_iterator(uint nworkers, bool visit_weaks);
 
   // Serviceability
   void serviceability_initialize();
@@ -78,8 +78,8 @@ inline uintptr_t ZHeap::alloc_object(size_t size) {
   return addr;
 }
 
-inline uintptr_t ZHeap::alloc_object_for_relocation(size_t size) {
-  uintptr_t addr = _object_allocator.alloc_object_for_relocation(size);
+inline uintptr_t ZHeap::alloc_object_for_relocation(size_t size, uint32_t numa_id) {
+  uintptr_t addr = _object_allocator.alloc_object_for_relocation(size, numa_id);
   assert(ZAddress::is_good_or_null(addr), "Bad address");
   return addr;
 }
@@ -24,15 +24,18 @@
 #include "precompiled.hpp"
 #include "classfile/classLoaderData.hpp"
 #include "classfile/classLoaderDataGraph.hpp"
+#include "gc/shared/taskqueue.inline.hpp"
 #include "gc/z/zAddressRangeMap.inline.hpp"
 #include "gc/z/zBarrier.inline.hpp"
 #include "gc/z/zGlobals.hpp"
 #include "gc/z/zHeapIterator.hpp"
+#include "gc/z/zLock.inline.hpp"
 #include "gc/z/zOop.inline.hpp"
 #include "gc/z/zRootsIterator.hpp"
 #include "memory/iterator.inline.hpp"
+#include "runtime/orderAccess.hpp"
+#include "runtime/safepoint.hpp"
 #include "utilities/bitMap.inline.hpp"
-#include "utilities/stack.inline.hpp"
 
 class ZHeapIteratorBitMap : public CHeapObj<mtGC> {
 private:
@@ -47,24 +50,25 @@ public:
       return false;
     }
 
-    _map.set_bit(index);
-    return true;
+    return _map.par_set_bit(index);
   }
 };
 
 class ZHeapIteratorRootOopClosure : public ZRootsIteratorClosure {
 private:
-  ZHeapIterator* const _iter;
+  ZHeapIterator* const      _iter;
+  ZHeapIteratorQueue* const _queue;
 
 public:
-  ZHeapIteratorRootOopClosure(ZHeapIterator* iter) :
-      _iter(iter) {}
+  ZHeapIteratorRootOopClosure(ZHeapIterator* iter, ZHeapIteratorQueue* queue) :
+      _iter(iter),
+      _queue(queue) {}
 
   virtual void do_oop(oop* p) {
     // Load barrier needed here, even on non-concurrent strong roots,
     // for the same reason we need fixup_partial_loads() in ZHeap::mark_end().
     const oop obj = NativeAccess<AS_NO_KEEPALIVE>::oop_load(p);
-    _iter->push(obj);
+    _iter->push(_queue, obj);
   }
 
   virtual void do_oop(narrowOop* p) {
@@ -74,9 +78,10 @@ public:
 
 class ZHeapIteratorOopClosure : public ClaimMetadataVisitingOopIterateClosure {
 private:
-  ZHeapIterator* const _iter;
-  const oop            _base;
-  const bool           _visit_referents;
+  ZHeapIterator* const      _iter;
+  ZHeapIteratorQueue* const _queue;
+  const oop                 _base;
+  const bool                _visit_referents;
 
   oop load_oop(oop* p) const {
     if (_visit_referents) {
@@ -87,9 +92,10 @@ private:
   }
 
 public:
-  ZHeapIteratorOopClosure(ZHeapIterator* iter, oop base, bool visit_referents) :
+  ZHeapIteratorOopClosure(ZHeapIterator* iter, ZHeapIteratorQueue* queue, oop base, bool visit_referents) :
       ClaimMetadataVisitingOopIterateClosure(ClassLoaderData::_claim_other),
       _iter(iter),
+      _queue(queue),
       _base(base),
       _visit_referents(visit_referents) {}
 
@@ -99,7 +105,7 @@ public:
 
   virtual void do_oop(oop* p) {
     const oop obj = load_oop(p);
-    _iter->push(obj);
+    _iter->push(_queue, obj);
   }
 
   virtual void do_oop(narrowOop* p) {
@@ -113,16 +119,38 @@ public:
 #endif
 };
 
-ZHeapIterator::ZHeapIterator(bool visit_referents) :
-    _visit_stack(),
+ZHeapIterator::ZHeapIterator(uint nworkers, bool visit_weaks) :
+    _visit_weaks(visit_weaks),
     _visit_map(),
-    _visit_referents(visit_referents) {}
+    _visit_map_lock(),
+    _queues(nworkers),
+    _terminator(nworkers, &_queues),
+    _roots(),
+    _concurrent_roots(),
+    _weak_roots(),
+    _concurrent_weak_roots() {
+  assert(SafepointSynchronize::is_at_safepoint(), "Should be at safepoint");
+
+  // Create queues
+  for (uint i = 0; i < nworkers; i++) {
+    ZHeapIteratorQueue* const queue = new ZHeapIteratorQueue();
+    queue->initialize();
+    _queues.register_queue(i, queue);
+  }
+}
 
 ZHeapIterator::~ZHeapIterator() {
+  // Destroy bitmaps
   ZVisitMapIterator iter(&_visit_map);
   for (ZHeapIteratorBitMap* map; iter.next(&map);) {
     delete map;
   }
+
+  // Destroy queues
+  for (uint i = 0; i < _queues.size(); i++) {
+    delete _queues.queue(i);
+  }
+
   ClassLoaderDataGraph::clear_claimed_marks(ClassLoaderData::_claim_other);
 }
 
@@ -140,15 +168,29 @@ static size_t object_index(oop obj) {
 ZHeapIteratorBitMap* ZHeapIterator::object_map(oop obj) {
   const uintptr_t addr = ZOop::to_address(obj);
   ZHeapIteratorBitMap* map = _visit_map.get(addr);
+  if (map != NULL) {
+    // Pairs with the release below
+    OrderAccess::acquire();
+    return map;
+  }
+
+  ZLocker<ZLock> locker(&_visit_map_lock);
+
+  // Re-check under lock, another worker might have created it
+  map = _visit_map.get(addr);
   if (map == NULL) {
     map = new ZHeapIteratorBitMap(object_index_max());
+
+    // Make the bitmap visible to other workers only after it
+    // has been fully initialized.
+    OrderAccess::release();
     _visit_map.put(addr, map);
   }
 
   return map;
 }
 
-void ZHeapIterator::push(oop obj) {
+void ZHeapIterator::push(ZHeapIteratorQueue* queue, oop obj) {
   if (obj == NULL) {
     // Ignore
     return;
@@ -162,17 +204,36 @@ void ZHeapIterator::push(oop obj) {
   }
 
   // Push
-  _visit_stack.push(obj);
+  queue->push(obj);
 }
 
-class ZHeapIterateConcurrentRootsIterator : public ZConcurrentRootsIterator {
-public:
-  ZHeapIterateConcurrentRootsIterator() :
-      ZConcurrentRootsIterator(ClassLoaderData::_claim_other) {}
-};
+template <bool VisitWeaks>
+void ZHeapIterator::visit(ObjectClosure* cl, ZHeapIteratorQueue* queue, oop obj) {
+  // Visit
+  cl->do_object(obj);
+
+  // Push members to visit
+  ZHeapIteratorOopClosure push_cl(this, queue, obj, VisitWeaks);
+  obj->oop_iterate(&push_cl);
+}
+
+template <bool VisitWeaks>
+void ZHeapIterator::drain(ObjectClosure* cl, ZHeapIteratorQueue* queue) {
+  oop obj;
+
+  do {
+    while (queue->pop_overflow(obj)) {
+      visit<VisitWeaks>(cl, queue, obj);
+    }
+
+    while (queue->pop_local(obj)) {
+      visit<VisitWeaks>(cl, queue, obj);
+    }
+  } while (!queue->is_empty());
+}
 
 template <bool VisitWeaks>
-void ZHeapIterator::objects_do(ObjectClosure* cl) {
+void ZHeapIterator::objects_do(ObjectClosure* cl, uint worker_id) {
   // Note that the heap iterator visits all reachable objects, including
   // objects that might be unreachable from the application, such as a
   // not yet cleared JNIWeakGloablRef. However, also note that visiting
@@ -181,49 +242,41 @@ void ZHeapIterator::objects_do(ObjectClosure* cl) {
   // If we didn't do this the application would have expected to see
   // ObjectFree events for phantom reachable objects in the tag map.
 
-  ZHeapIteratorRootOopClosure root_cl(this);
-
-  // Push strong roots onto stack
-  {
-    ZRootsIterator roots;
-    roots.oops_do(&root_cl);
-  }
+  ZHeapIteratorQueue* const queue = _queues.queue(worker_id);
+  ZHeapIteratorRootOopClosure root_cl(this, queue);
 
-  {
-    ZHeapIterateConcurrentRootsIterator roots;
-    roots.oops_do(&root_cl);
-  }
+  // Push strong roots onto queue. The root iterators are shared
+  // by all workers, which claim parts of the roots to visit.
+  _roots.oops_do(&root_cl);
+  _concurrent_roots.oops_do(&root_cl);
 
   if (VisitWeaks) {
-    // Push weak roots onto stack
-    {
-      ZWeakRootsIterator roots;
-      roots.oops_do(&root_cl);
-    }
-
-    {
-      ZConcurrentWeakRootsIterator roots;
-      roots.oops_do(&root_cl);
-    }
+    // Push weak roots onto queue
+    _weak_roots.oops_do(&root_cl);
+    _concurrent_weak_roots.oops_do(&root_cl);
   }
 
-  // Drain stack
-  while (!_visit_stack.is_empty()) {
-    const oop obj = _visit_stack.pop();
+  // Drain own queue, then steal from other workers until
+  // all queues are empty and all workers have terminated.
+  for (;;) {
+    drain<VisitWeaks>(cl, queue);
 
-    // Visit
-    cl->do_object(obj);
+    oop obj;
+    if (_queues.steal(worker_id, obj)) {
+      visit<VisitWeaks>(cl, queue, obj);
+      continue;
+    }
 
-    // Push members to visit
-    ZHeapIteratorOopClosure push_cl(this, obj, VisitWeaks);
-    obj->oop_iterate(&push_cl);
+    if (_terminator.offer_termination()) {
+      break;
+    }
   }
 }
 
-void ZHeapIterator::objects_do(ObjectClosure* cl, bool visit_weaks) {
-  if (visit_weaks) {
-    objects_do<true /* VisitWeaks */>(cl);
+void ZHeapIterator::object_iterate(ObjectClosure* cl, uint worker_id) {
+  if (_visit_weaks) {
+    objects_do<true /* VisitWeaks */>(cl, worker_id);
   } else {
-    objects_do<false /* VisitWeaks */>(cl);
-   }
- }
+    objects_do<false /* VisitWeaks */>(cl, worker_id);
+  }
+}
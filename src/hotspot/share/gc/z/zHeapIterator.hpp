@@ -24,36 +24,56 @@
 #ifndef SHARE_GC_Z_ZHEAPITERATOR_HPP
 #define SHARE_GC_Z_ZHEAPITERATOR_HPP
 
+#include "classfile/classLoaderData.hpp"
+#include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/taskqueue.hpp"
 #include "gc/z/zAddressRangeMap.hpp"
 #include "gc/z/zGlobals.hpp"
+#include "gc/z/zLock.hpp"
+#include "gc/z/zRootsIterator.hpp"
 #include "memory/allocation.hpp"
-#include "utilities/stack.hpp"
 
 class ZHeapIteratorBitMap;
 
-class ZHeapIterator : public StackObj {
+typedef OverflowTaskQueue<oop, mtGC>                  ZHeapIteratorQueue;
+typedef GenericTaskQueueSet<ZHeapIteratorQueue, mtGC> ZHeapIteratorQueues;
+
+class ZHeapIteratorConcurrentRootsIterator : public ZConcurrentRootsIterator {
+public:
+  ZHeapIteratorConcurrentRootsIterator() :
+      ZConcurrentRootsIterator(ClassLoaderData::_claim_other) {}
+};
+
+class ZHeapIterator : public ParallelObjectIterator {
   friend class ZHeapIteratorRootOopClosure;
   friend class ZHeapIteratorOopClosure;
 
 private:
   typedef ZAddressRangeMap<ZHeapIteratorBitMap*, ZGranuleSizeShift>         ZVisitMap;
   typedef ZAddressRangeMapIterator<ZHeapIteratorBitMap*, ZGranuleSizeShift> ZVisitMapIterator;
-  typedef Stack<oop, mtGC>                                                  ZVisitStack;
 
-  ZVisitStack _visit_stack;
-  ZVisitMap   _visit_map;
-  const bool  _visit_referents;
+  const bool                           _visit_weaks;
+  ZVisitMap                            _visit_map;
+  ZLock                                _visit_map_lock;
+  ZHeapIteratorQueues                  _queues;
+  ParallelTaskTerminator               _terminator;
+  ZRootsIterator                       _roots;
+  ZHeapIteratorConcurrentRootsIterator _concurrent_roots;
+  ZWeakRootsIterator                   _weak_roots;
+  ZConcurrentWeakRootsIterator         _concurrent_weak_roots;
 
   ZHeapIteratorBitMap* object_map(oop obj);
-  void push(oop obj);
+  void push(ZHeapIteratorQueue* queue, oop obj);
 
-  template <bool VisitWeaks> void objects_do(ObjectClosure* cl);
+  template <bool VisitWeaks> void visit(ObjectClosure* cl, ZHeapIteratorQueue* queue, oop obj);
+  template <bool VisitWeaks> void drain(ObjectClosure* cl, ZHeapIteratorQueue* queue);
+  template <bool VisitWeaks> void objects_do(ObjectClosure* cl, uint worker_id);
 
 public:
-  ZHeapIterator(bool visit_referents);
-  ~ZHeapIterator();
+  ZHeapIterator(uint nworkers, bool visit_weaks);
+  virtual ~ZHeapIterator();
 
-  void objects_do(ObjectClosure* cl, bool visit_weaks);
+  virtual void object_iterate(ObjectClosure* cl, uint worker_id);
 };
 
 #endif // SHARE_GC_Z_ZHEAPITERATOR_HPP
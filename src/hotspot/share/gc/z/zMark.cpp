@@ -23,11 +23,18 @@
 
 #include "precompiled.hpp"
 #include "classfile/classLoaderDataGraph.hpp"
+#include "code/nmethod.hpp"
+#include "compiler/oopMap.hpp"
+#include "gc/shared/barrierSet.hpp"
+#include "gc/shared/barrierSetNMethod.hpp"
+#include "gc/z/zArray.inline.hpp"
 #include "gc/z/zBarrier.inline.hpp"
+#include "gc/z/zLock.inline.hpp"
 #include "gc/z/zMark.inline.hpp"
 #include "gc/z/zMarkCache.inline.hpp"
 #include "gc/z/zMarkStack.inline.hpp"
 #include "gc/z/zMarkTerminate.inline.hpp"
+#include "gc/z/zNMethodTable.hpp"
 #include "gc/z/zOopClosures.inline.hpp"
 #include "gc/z/zPage.hpp"
 #include "gc/z/zPageTable.inline.hpp"
@@ -40,11 +47,13 @@
 #include "gc/z/zWorkers.inline.hpp"
 #include "logging/log.hpp"
 #include "memory/iterator.inline.hpp"
+#include "memory/resourceArea.hpp"
 #include "oops/objArrayOop.inline.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/handshake.hpp"
 #include "runtime/orderAccess.hpp"
+#include "runtime/frame.inline.hpp"
 #include "runtime/prefetch.inline.hpp"
 #include "runtime/thread.hpp"
 #include "utilities/align.hpp"
@@ -52,6 +61,7 @@
 #include "utilities/ticks.hpp"
 
 static const ZStatSubPhase ZSubPhaseConcurrentMark("Concurrent Mark");
+static const ZStatSubPhase ZSubPhaseConcurrentMarkThreadStacks("Concurrent Mark Thread Stacks");
 static const ZStatSubPhase ZSubPhaseConcurrentMarkTryFlush("Concurrent Mark Try Flush");
 static const ZStatSubPhase ZSubPhaseConcurrentMarkTryTerminate("Concurrent Mark Try Terminate");
 static const ZStatSubPhase ZSubPhaseMarkTryComplete("Pause Mark Try Complete");
@@ -118,9 +128,145 @@ void ZMark::prepare_mark() {
   }
 }
 
+bool ZMark::is_concurrent_thread_stacks() {
+  return ZConcurrentThreadStacks && ThreadLocalHandshakes;
+}
+
+class ZMarkThreadStackOopClosure : public OopClosure {
+public:
+  virtual void do_oop(oop* p) {
+    // Can be called by any thread, not only GC workers
+    ZBarrier::load_barrier_on_root_oop_field(p);
+  }
+
+  virtual void do_oop(narrowOop* p) {
+    ShouldNotReachHere();
+  }
+};
+
+// Outside of a safepoint, an nmethod found on a thread stack is healed
+// the same way as in the nmethod entry barrier, holding the per-nmethod
+// lock and disarming it when done.
+class ZMarkThreadStackCodeBlobClosure : public CodeBlobToOopClosure {
+private:
+  BarrierSetNMethod* const _bs;
+
+public:
+  ZMarkThreadStackCodeBlobClosure(OopClosure* cl) :
+      CodeBlobToOopClosure(cl, true /* fix_relocations */),
+      _bs(BarrierSet::barrier_set()->barrier_set_nmethod()) {}
+
+  virtual void do_code_blob(CodeBlob* cb) {
+    nmethod* const nm = cb->as_nmethod_or_null();
+    if (nm == NULL) {
+      return;
+    }
+
+    ZLocker<ZReentrantLock> locker(ZNMethodTable::lock_for_nmethod(nm));
+    if (!_bs->is_armed(nm)) {
+      // Already healed
+      return;
+    }
+
+    CodeBlobToOopClosure::do_code_blob(cb);
+
+    OrderAccess::release();
+
+    _bs->disarm(nm);
+  }
+};
+
+#if COMPILER2_OR_JVMCI
+// Derived pointers are normally recorded in the DerivedPointerTable and
+// updated when all roots have been visited, but the table is shared and
+// only usable in a safepoint. Thread stacks scanned outside of a safepoint
+// instead record the derived pointers of the thread being scanned before
+// its base pointers are healed, and update them afterwards.
+class ZMarkThreadStackDerivedPointers : public StackObj {
+private:
+  struct Entry {
+    oop*     _base;
+    oop*     _derived;
+    intptr_t _offset;
+  };
+
+  static __thread ZArray<Entry>* _entries;
+
+  ZArray<Entry> _array;
+
+  static void add(oop* base, oop* derived) {
+    Entry entry;
+    entry._base = base;
+    entry._derived = derived;
+    entry._offset = (intptr_t)*derived - (intptr_t)*base;
+    _entries->add(entry);
+  }
+
+public:
+  ZMarkThreadStackDerivedPointers(JavaThread* thread) :
+      _array() {
+    assert(!DerivedPointerTable::is_active(), "Should not be active");
+    if (!thread->has_last_Java_frame()) {
+      return;
+    }
+
+    DoNothingClosure do_nothing;
+    _entries = &_array;
+    for (StackFrameStream fst(thread); !fst.is_done(); fst.next()) {
+      const frame* const fr = fst.current();
+      if (fr->is_compiled_frame() && fr->cb()->oop_maps() != NULL) {
+        OopMapSet::all_do(fr, fst.register_map(), &do_nothing, add, &do_nothing);
+      }
+    }
+    _entries = NULL;
+  }
+
+  ~ZMarkThreadStackDerivedPointers() {
+    ZArrayIterator<Entry> iter(&_array);
+    for (Entry entry; iter.next(&entry);) {
+      *entry._derived = (oop)((address)*entry._base + entry._offset);
+    }
+  }
+};
+
+__thread ZArray<ZMarkThreadStackDerivedPointers::Entry>* ZMarkThreadStackDerivedPointers::_entries = NULL;
+#endif // COMPILER2_OR_JVMCI
+
+class ZMarkThreadStackClosure : public HandshakeClosure {
+public:
+  ZMarkThreadStackClosure() :
+      HandshakeClosure("ZMarkThreadStack") {}
+
+  virtual void do_thread(Thread* thread) {
+    ResourceMark rm;
+    ZMarkThreadStackOopClosure cl;
+    ZMarkThreadStackCodeBlobClosure code_cl(&cl);
+
+    {
+      COMPILER2_OR_JVMCI_PRESENT(ZMarkThreadStackDerivedPointers derived((JavaThread*)thread);)
+      thread->oops_do(&cl, ClassUnloading ? &code_cl : NULL);
+    }
+
+    // Threads processed by the VM thread are blocked, and their
+    // stacks are scanned on behalf of them. The VM thread is not
+    // part of the mark stack flushing done during concurrent mark,
+    // so flush what it pushed here.
+    Thread* const current = Thread::current();
+    if (!current->is_Java_thread()) {
+      ZHeap::heap()->mark_flush_and_free(current);
+    }
+  }
+};
+
+static ZMarkThreadStackClosure thread_stack_cl;
+
 class ZMarkRootsIteratorClosure : public ZRootsIteratorClosure {
+private:
+  const bool _concurrent_thread_stacks;
+
 public:
-  ZMarkRootsIteratorClosure() {
+  ZMarkRootsIteratorClosure() :
+      _concurrent_thread_stacks(ZMark::is_concurrent_thread_stacks()) {
     ZStatTLAB::reset();
   }
 
@@ -129,7 +275,15 @@ public:
   }
 
   virtual void do_thread(Thread* thread) {
-    ZRootsIteratorClosure::do_thread(thread);
+    if (_concurrent_thread_stacks && thread->is_Java_thread()) {
+      // Defer scanning of the thread's stack. The thread will scan
+      // it by itself before continuing after the pause, unless it is
+      // blocked, in which case the VM thread scans it when the mark
+      // phase starts.
+      Handshake::arm_deferred(&thread_stack_cl, (JavaThread*)thread);
+    } else {
+      ZRootsIteratorClosure::do_thread(thread);
+    }
 
     // Update thread local address bad mask
     ZThreadLocalData::set_address_bad_mask(thread, ZAddressBadMask);
@@ -697,8 +851,19 @@ public:
   }
 };
 
+void ZMark::mark_thread_stacks() {
+  ZStatTimer timer(ZSubPhaseConcurrentMarkThreadStacks);
+
+  // Complete scanning of thread stacks deferred in the mark start pause
+  Handshake::complete_deferred();
+}
+
 void ZMark::mark(bool initial) {
   if (initial) {
+    if (is_concurrent_thread_stacks()) {
+      mark_thread_stacks();
+    }
+
     ZMarkConcurrentRootsTask task(this);
     _workers->run_concurrent(&task);
   }
@@ -57,6 +57,7 @@ private:
 
   size_t calculate_nstripes(uint nworkers) const;
   void prepare_mark();
+  void mark_thread_stacks();
 
   bool is_array(uintptr_t addr) const;
   void push_partial_array(uintptr_t addr, size_t size, bool finalizable);
@@ -102,6 +103,10 @@ public:
 
   bool is_initialized() const;
 
+  // Returns true if Java thread stacks are scanned concurrently,
+  // instead of in the mark start pause
+  static bool is_concurrent_thread_stacks();
+
   template <bool gc_thread, bool finalizable, bool publish> void mark_object(uintptr_t addr);
 
   void start();
@@ -25,6 +25,7 @@
 #include "gc/z/zCollectedHeap.hpp"
 #include "gc/z/zGlobals.hpp"
 #include "gc/z/zHeap.inline.hpp"
+#include "gc/z/zNUMA.hpp"
 #include "gc/z/zObjectAllocator.hpp"
 #include "gc/z/zPage.inline.hpp"
 #include "gc/z/zStat.hpp"
@@ -46,10 +47,33 @@ ZObjectAllocator::ZObjectAllocator(uint nworkers) :
     _used(0),
     _shared_medium_page(NULL),
     _shared_small_page(NULL),
-    _worker_small_page(NULL) {}
+    _shared_old_medium_page(NULL),
+    _shared_old_small_page(NULL),
+    _worker_small_page() {
+  ZPerNUMAIterator<ZPerWorker<ZPage*> > iter(&_worker_small_page);
+  for (ZPerWorker<ZPage*>* pages; iter.next(&pages);) {
+    pages->set_all(NULL);
+  }
+}
 
-ZPage* ZObjectAllocator::alloc_page(uint8_t type, size_t size, ZAllocationFlags flags) {
-  ZPage* const page = ZHeap::heap()->alloc_page(type, size, flags);
+bool ZObjectAllocator::is_old_allocation(ZAllocationFlags flags) {
+  return ZGenerationalPages && flags.relocation();
+}
+
+bool ZObjectAllocator::is_worker_small_page(ZPage* page) const {
+  // The page is kept under the NUMA id it was requested for, which is not
+  // the page's own NUMA id when it had to be allocated on a remote node.
+  ZPerNUMAConstIterator<ZPerWorker<ZPage*> > iter(&_worker_small_page);
+  for (const ZPerWorker<ZPage*>* pages; iter.next(&pages);) {
+    if (pages->get() == page) {
+      return true;
+    }
+  }
+  return false;
+}
+
+ZPage* ZObjectAllocator::alloc_page(uint8_t type, size_t size, uint32_t numa_id, ZAllocationFlags flags) {
+  ZPage* const page = ZHeap::heap()->alloc_page(type, size, numa_id, flags);
   if (page != NULL) {
     // Increment used bytes
     Atomic::add(size, _used.addr());
@@ -72,7 +96,7 @@ uintptr_t ZObjectAllocator::alloc_object_in_shared_page(ZPage** shared_page,
 
   if (addr == 0) {
     // Allocate new page
-    ZPage* const new_page = alloc_page(page_type, page_size, flags);
+    ZPage* const new_page = alloc_page(page_type, page_size, ZNUMA::id(), flags);
     if (new_page != NULL) {
       // Allocate object before installing the new page
       addr = new_page->alloc_object(size);
@@ -114,7 +138,7 @@ uintptr_t ZObjectAllocator::alloc_large_object(size_t size, ZAllocationFlags fla
 
   // Allocate new large page
   const size_t page_size = align_up(size, ZGranuleSize);
-  ZPage* const page = alloc_page(ZPageTypeLarge, page_size, flags);
+  ZPage* const page = alloc_page(ZPageTypeLarge, page_size, ZNUMA::id(), flags);
   if (page != NULL) {
     // Allocate the object
     addr = page->alloc_object(size);
@@ -124,7 +148,8 @@ uintptr_t ZObjectAllocator::alloc_large_object(size_t size, ZAllocationFlags fla
 }
 
 uintptr_t ZObjectAllocator::alloc_medium_object(size_t size, ZAllocationFlags flags) {
-  return alloc_object_in_shared_page(_shared_medium_page.addr(), ZPageTypeMedium, ZPageSizeMedium, size, flags);
+  ZPage** const shared_page = is_old_allocation(flags) ? _shared_old_medium_page.addr() : _shared_medium_page.addr();
+  return alloc_object_in_shared_page(shared_page, ZPageTypeMedium, ZPageSizeMedium, size, flags);
 }
 
 uintptr_t ZObjectAllocator::alloc_small_object_from_nonworker(size_t size, ZAllocationFlags flags) {
@@ -134,13 +159,15 @@ uintptr_t ZObjectAllocator::alloc_small_object_from_nonworker(size_t size, ZAllo
   // Non-worker small page allocation can never use the reserve
   flags.set_no_reserve();
 
-  return alloc_object_in_shared_page(_shared_small_page.addr(), ZPageTypeSmall, ZPageSizeSmall, size, flags);
+  ZPage** const shared_page = is_old_allocation(flags) ? _shared_old_small_page.addr() : _shared_small_page.addr();
+  return alloc_object_in_shared_page(shared_page, ZPageTypeSmall, ZPageSizeSmall, size, flags);
 }
 
-uintptr_t ZObjectAllocator::alloc_small_object_from_worker(size_t size, ZAllocationFlags flags) {
+uintptr_t ZObjectAllocator::alloc_small_object_from_worker(size_t size, uint32_t numa_id, ZAllocationFlags flags) {
   assert(ZThread::is_worker(), "Should be a worker thread");
 
-  ZPage* page = _worker_small_page.get();
+  ZPage** const worker_page = _worker_small_page.get(numa_id).addr();
+  ZPage* page = *worker_page;
   uintptr_t addr = 0;
 
   if (page != NULL) {
@@ -149,28 +176,28 @@ uintptr_t ZObjectAllocator::alloc_small_object_from_worker(size_t size, ZAllocat
 
   if (addr == 0) {
     // Allocate new page
-    page = alloc_page(ZPageTypeSmall, ZPageSizeSmall, flags);
+    page = alloc_page(ZPageTypeSmall, ZPageSizeSmall, numa_id, flags);
     if (page != NULL) {
       addr = page->alloc_object(size);
     }
-    _worker_small_page.set(page);
+    *worker_page = page;
   }
 
   return addr;
 }
 
-uintptr_t ZObjectAllocator::alloc_small_object(size_t size, ZAllocationFlags flags) {
+uintptr_t ZObjectAllocator::alloc_small_object(size_t size, uint32_t numa_id, ZAllocationFlags flags) {
   if (flags.worker_thread()) {
-    return alloc_small_object_from_worker(size, flags);
+    return alloc_small_object_from_worker(size, numa_id, flags);
   } else {
     return alloc_small_object_from_nonworker(size, flags);
   }
 }
 
-uintptr_t ZObjectAllocator::alloc_object(size_t size, ZAllocationFlags flags) {
+uintptr_t ZObjectAllocator::alloc_object(size_t size, uint32_t numa_id, ZAllocationFlags flags) {
   if (size <= ZObjectSizeLimitSmall) {
     // Small
-    return alloc_small_object(size, flags);
+    return alloc_small_object(size, numa_id, flags);
   } else if (size <= ZObjectSizeLimitMedium) {
     // Medium
     return alloc_medium_object(size, flags);
@@ -190,10 +217,10 @@ uintptr_t ZObjectAllocator::alloc_object(size_t size) {
     flags.set_non_blocking();
   }
 
-  return alloc_object(size, flags);
+  return alloc_object(size, ZNUMA::id(), flags);
 }
 
-uintptr_t ZObjectAllocator::alloc_object_for_relocation(size_t size) {
+uintptr_t ZObjectAllocator::alloc_object_for_relocation(size_t size, uint32_t numa_id) {
   assert(ZThread::is_java() || ZThread::is_vm() || ZThread::is_worker() || ZThread::is_runtime_worker(),
          "Unknown thread");
 
@@ -205,7 +232,7 @@ uintptr_t ZObjectAllocator::alloc_object_for_relocation(size_t size) {
     flags.set_worker_thread();
   }
 
-  return alloc_object(size, flags);
+  return alloc_object(size, numa_id, flags);
 }
 
 bool ZObjectAllocator::undo_alloc_large_object(ZPage* page) {
@@ -232,7 +259,7 @@ bool ZObjectAllocator::undo_alloc_small_object_from_nonworker(ZPage* page, uintp
 
 bool ZObjectAllocator::undo_alloc_small_object_from_worker(ZPage* page, uintptr_t addr, size_t size) {
   assert(page->type() == ZPageTypeSmall, "Invalid page type");
-  assert(page == _worker_small_page.get(), "Invalid page");
+  assert(is_worker_small_page(page), "Invalid page");
 
   // Non-atomic undo on worker-local page
   const bool success = page->undo_alloc_object(addr, size);
@@ -301,5 +328,10 @@ void ZObjectAllocator::retire_pages() {
   // Reset allocation pages
   _shared_medium_page.set(NULL);
   _shared_small_page.set_all(NULL);
-  _worker_small_page.set_all(NULL);
+  _shared_old_medium_page.set(NULL);
+  _shared_old_small_page.set_all(NULL);
+  ZPerNUMAIterator<ZPerWorker<ZPage*> > iter(&_worker_small_page);
+  for (ZPerWorker<ZPage*>* pages; iter.next(&pages);) {
+    pages->set_all(NULL);
+  }
 }
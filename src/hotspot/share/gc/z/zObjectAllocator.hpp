@@ -31,13 +31,21 @@
 
 class ZObjectAllocator {
 private:
-  const uint         _nworkers;
-  ZPerCPU<size_t>    _used;
-  ZContended<ZPage*> _shared_medium_page;
-  ZPerCPU<ZPage*>    _shared_small_page;
-  ZPerWorker<ZPage*> _worker_small_page;
+  const uint                     _nworkers;
+  ZPerCPU<size_t>                _used;
+  ZContended<ZPage*>             _shared_medium_page;
+  ZPerCPU<ZPage*>                _shared_small_page;
+  ZContended<ZPage*>             _shared_old_medium_page;
+  ZPerCPU<ZPage*>                _shared_old_small_page;
+  ZPerNUMA<ZPerWorker<ZPage*> >  _worker_small_page;
 
-  ZPage* alloc_page(uint8_t type, size_t size, ZAllocationFlags flags);
+  // Returns true if the allocation should be satisfied from old pages
+  static bool is_old_allocation(ZAllocationFlags flags);
+
+  // Returns true if the page is one of the current worker's small pages
+  bool is_worker_small_page(ZPage* page) const;
+
+  ZPage* alloc_page(uint8_t type, size_t size, uint32_t numa_id, ZAllocationFlags flags);
 
   // Allocate an object in a shared page. Allocate and
   // atomically install a new page if necessary.
@@ -50,9 +58,9 @@ private:
   uintptr_t alloc_large_object(size_t size, ZAllocationFlags flags);
   uintptr_t alloc_medium_object(size_t size, ZAllocationFlags flags);
   uintptr_t alloc_small_object_from_nonworker(size_t size, ZAllocationFlags flags);
-  uintptr_t alloc_small_object_from_worker(size_t size, ZAllocationFlags flags);
-  uintptr_t alloc_small_object(size_t size, ZAllocationFlags flags);
-  uintptr_t alloc_object(size_t size, ZAllocationFlags flags);
+  uintptr_t alloc_small_object_from_worker(size_t size, uint32_t numa_id, ZAllocationFlags flags);
+  uintptr_t alloc_small_object(size_t size, uint32_t numa_id, ZAllocationFlags flags);
+  uintptr_t alloc_object(size_t size, uint32_t numa_id, ZAllocationFlags flags);
 
   bool undo_alloc_large_object(ZPage* page);
   bool undo_alloc_medium_object(ZPage* page, uintptr_t addr, size_t size);
@@ -66,7 +74,10 @@ public:
 
   uintptr_t alloc_object(size_t size);
 
-  uintptr_t alloc_object_for_relocation(size_t size);
+  // Allocate an object for relocation. Worker threads allocate from a
+  // page on the given NUMA node, which should be the node of the page
+  // the object is relocated from, to keep the object node-local.
+  uintptr_t alloc_object_for_relocation(size_t size, uint32_t numa_id);
   void undo_alloc_object_for_relocation(ZPage* page, uintptr_t addr, size_t size);
 
   size_t used() const;
@@ -45,13 +45,15 @@ ZPage::ZPage(uint8_t type, ZVirtualMemory vmem, ZPhysicalMemory pmem) :
     _type(type),
     _pinned(0),
     _numa_id((uint8_t)-1),
+    _old(false),
     _seqnum(0),
     _virtual(vmem),
     _top(start()),
     _livemap(object_max_count()),
     _refcount(0),
     _forwarding(),
-    _physical(pmem) {
+    _physical(pmem),
+    _last_used(0) {
   assert(!_physical.is_null(), "Should not be null");
   assert(!_virtual.is_null(), "Should not be null");
   assert((type == ZPageTypeSmall && size() == ZPageSizeSmall) ||
@@ -102,7 +104,7 @@ uintptr_t ZPage::relocate_object_inner(uintptr_t from_index, uintptr_t from_offs
   // Allocate object
   const uintptr_t from_good = ZAddress::good(from_offset);
   const size_t size = ZUtils::object_size(from_good);
-  const uintptr_t to_good = ZHeap::heap()->alloc_object_for_relocation(size);
+  const uintptr_t to_good = ZHeap::heap()->alloc_object_for_relocation(size, numa_id());
   if (to_good == 0) {
     // Failed, in-place forward
     return _forwarding.insert(from_index, from_offset, &cursor);
@@ -158,8 +160,9 @@ uintptr_t ZPage::forward_object(uintptr_t from) {
 }
 
 void ZPage::print_on(outputStream* out) const {
-  out->print_cr(" %-6s  " PTR_FORMAT " " PTR_FORMAT " " PTR_FORMAT " %s%s%s%s%s%s",
+  out->print_cr(" %-6s  " PTR_FORMAT " " PTR_FORMAT " " PTR_FORMAT " %s%s%s%s%s%s%s",
                 type_to_string(), start(), top(), end(),
+                is_old()         ? " Old"         : "",
                 is_allocating()  ? " Allocating"  : "",
                 is_relocatable() ? " Relocatable" : "",
                 is_forwarding()  ? " Forwarding"  : "",
@@ -40,6 +40,7 @@ private:
   const uint8_t        _type;             // Page type
   volatile uint8_t     _pinned;           // Pinned flag
   uint8_t              _numa_id;          // NUMA node affinity
+  bool                 _old;              // Holds objects that survived relocation
   uint32_t             _seqnum;           // Allocation sequence number
   const ZVirtualMemory _virtual;          // Virtual start/end address
   volatile uintptr_t   _top;              // Virtual top address
@@ -49,6 +50,7 @@ private:
   volatile uint32_t    _refcount;         // Page reference count
   ZForwardingTable     _forwarding;       // Forwarding table
   ZPhysicalMemory      _physical;         // Physical memory for page
+  uint64_t             _last_used;        // Last used time (in seconds), when cached
   ZListNode<ZPage>     _node;             // Page list node
 
   const char* type_to_string() const;
@@ -79,6 +81,12 @@ public:
 
   void reset();
 
+  bool is_old() const;
+  void set_old(bool old);
+
+  uint64_t last_used() const;
+  void set_last_used();
+
   bool inc_refcount();
   bool dec_refcount();
 
@@ -36,6 +36,7 @@
 #include "gc/z/zVirtualMemory.inline.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/atomic.hpp"
+#include "runtime/os.hpp"
 #include "utilities/align.hpp"
 #include "utilities/debug.hpp"
 
@@ -121,6 +122,22 @@ inline ZPhysicalMemory& ZPage::physical_memory() {
   return _physical;
 }
 
+inline bool ZPage::is_old() const {
+  return _old;
+}
+
+inline void ZPage::set_old(bool old) {
+  _old = old;
+}
+
+inline uint64_t ZPage::last_used() const {
+  return _last_used;
+}
+
+inline void ZPage::set_last_used() {
+  _last_used = (uint64_t)ceil(os::elapsedTime());
+}
+
 inline const ZVirtualMemory& ZPage::virtual_memory() const {
   return _virtual;
 }
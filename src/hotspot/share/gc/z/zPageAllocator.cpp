@@ -33,11 +33,17 @@
 #include "gc/z/zPageCache.inline.hpp"
 #include "gc/z/zPreMappedMemory.inline.hpp"
 #include "gc/z/zStat.hpp"
+#include "gc/z/zThread.hpp"
 #include "gc/z/zTracer.inline.hpp"
 #include "runtime/init.hpp"
+#include "runtime/interfaceSupport.inline.hpp"
+#include "runtime/os.hpp"
+#include "runtime/thread.hpp"
 
 static const ZStatCounter       ZCounterAllocationRate("Memory", "Allocation Rate", ZStatUnitBytesPerSecond);
+static const ZStatCounter       ZCounterUncommit("Memory", "Uncommit", ZStatUnitBytesPerSecond);
 static const ZStatCriticalPhase ZCriticalPhaseAllocationStall("Allocation Stall");
+static const ZStatCriticalPhase ZCriticalPhaseAllocationPacing("Allocation Pacing", false /* verbose */);
 
 class ZPageAllocRequest : public StackObj {
   friend class ZList<ZPageAllocRequest>;
@@ -45,15 +51,17 @@ class ZPageAllocRequest : public StackObj {
 private:
   const uint8_t                _type;
   const size_t                 _size;
+  const uint32_t               _numa_id;
   const ZAllocationFlags       _flags;
   const unsigned int           _total_collections;
   ZListNode<ZPageAllocRequest> _node;
   ZFuture<ZPage*>              _result;
 
 public:
-  ZPageAllocRequest(uint8_t type, size_t size, ZAllocationFlags flags, unsigned int total_collections) :
+  ZPageAllocRequest(uint8_t type, size_t size, uint32_t numa_id, ZAllocationFlags flags, unsigned int total_collections) :
       _type(type),
       _size(size),
+      _numa_id(numa_id),
       _flags(flags),
       _total_collections(total_collections) {}
 
@@ -65,6 +73,10 @@ public:
     return _size;
   }
 
+  uint32_t numa_id() const {
+    return _numa_id;
+  }
+
   ZAllocationFlags flags() const {
     return _flags;
   }
@@ -89,6 +101,7 @@ ZPageAllocator::ZPageAllocator(size_t min_capacity, size_t max_capacity, size_t
     _virtual(),
     _physical(max_capacity),
     _cache(),
+    _min_capacity(min_capacity),
     _max_reserve(max_reserve),
     _pre_mapped(_virtual, _physical, try_ensure_unused_for_pre_mapped(min_capacity)),
     _used_high(0),
@@ -105,10 +118,26 @@ bool ZPageAllocator::is_initialized() const {
          _pre_mapped.is_initialized();
 }
 
+size_t ZPageAllocator::min_capacity() const {
+  return _min_capacity;
+}
+
 size_t ZPageAllocator::max_capacity() const {
   return _physical.max_capacity();
 }
 
+size_t ZPageAllocator::soft_max_capacity() const {
+  // Note that ZSoftMaxHeapSize is manageable and can change at any time
+  const size_t soft_max_capacity = ZSoftMaxHeapSize;
+  const size_t current_max = current_max_capacity();
+  if (soft_max_capacity == 0) {
+    // Soft max capacity not set
+    return current_max;
+  }
+
+  return MIN2(MAX2(soft_max_capacity, _min_capacity), current_max);
+}
+
 size_t ZPageAllocator::current_max_capacity() const {
   return _physical.current_max_capacity();
 }
@@ -286,7 +315,7 @@ void ZPageAllocator::flush_detached_pages(ZList<ZPage>* list) {
 void ZPageAllocator::flush_cache(size_t size) {
   ZList<ZPage> list;
 
-  _cache.flush(&list, size);
+  _cache.flush_for_allocation(size, &list);
 
   for (ZPage* page = list.remove_first(); page != NULL; page = list.remove_first()) {
     detach_page(page);
@@ -299,7 +328,7 @@ void ZPageAllocator::check_out_of_memory_during_initialization() {
   }
 }
 
-ZPage* ZPageAllocator::alloc_page_common_inner(uint8_t type, size_t size, ZAllocationFlags flags) {
+ZPage* ZPageAllocator::alloc_page_common_inner(uint8_t type, size_t size, uint32_t numa_id, ZAllocationFlags flags) {
   const size_t max = max_available(flags.no_reserve());
   if (max < size) {
     // Not enough free memory
@@ -307,7 +336,7 @@ ZPage* ZPageAllocator::alloc_page_common_inner(uint8_t type, size_t size, ZAlloc
   }
 
   // Try allocating from the page cache
-  ZPage* const cached_page = _cache.alloc_page(type, size);
+  ZPage* const cached_page = _cache.alloc_page(type, size, numa_id);
   if (cached_page != NULL) {
     return cached_page;
   }
@@ -333,8 +362,8 @@ ZPage* ZPageAllocator::alloc_page_common_inner(uint8_t type, size_t size, ZAlloc
   return create_page(type, size);
 }
 
-ZPage* ZPageAllocator::alloc_page_common(uint8_t type, size_t size, ZAllocationFlags flags) {
-  ZPage* const page = alloc_page_common_inner(type, size, flags);
+ZPage* ZPageAllocator::alloc_page_common(uint8_t type, size_t size, uint32_t numa_id, ZAllocationFlags flags) {
+  ZPage* const page = alloc_page_common_inner(type, size, numa_id, flags);
   if (page == NULL) {
     // Out of memory
     return NULL;
@@ -349,14 +378,58 @@ ZPage* ZPageAllocator::alloc_page_common(uint8_t type, size_t size, ZAllocationF
   return page;
 }
 
-ZPage* ZPageAllocator::alloc_page_blocking(uint8_t type, size_t size, ZAllocationFlags flags) {
+uint64_t ZPageAllocator::pacing_delay(size_t size) const {
+  // Free memory is measured against the soft max capacity, since that
+  // is what the GC heuristics are trying to keep the heap within.
+  const size_t soft_max = soft_max_capacity();
+  const size_t threshold = soft_max * ZAllocationPacingThreshold / 100;
+  const size_t used_and_reserve = used() + max_reserve();
+  const size_t free = soft_max - MIN2(soft_max, used_and_reserve);
+  if (free >= threshold) {
+    // Not enough pressure to pace
+    return 0;
+  }
+
+  // The delay grows linearly from zero at the threshold to the max delay
+  // when all free memory is gone, and is scaled by the allocation size
+  // so that threads allocating more memory are delayed more.
+  const uint64_t max_delay = ZAllocationPacingMaxDelay * (MICROUNITS / MILLIUNITS);
+  const double pressure = (double)(threshold - free) / (double)threshold;
+  const double pages = (double)size / (double)ZPageSizeSmall;
+  return MIN2((uint64_t)(max_delay * pressure * pages), max_delay);
+}
+
+void ZPageAllocator::pace(size_t size) const {
+  if (!ZAllocationPacing || !ZThread::is_java() || !is_init_completed()) {
+    // Only Java threads are paced, and only after initialization
+    return;
+  }
+
+  const uint64_t delay = pacing_delay(size);
+  if (delay == 0) {
+    // No delay
+    return;
+  }
+
+  ZStatTimer timer(ZCriticalPhaseAllocationPacing);
+
+  // Allow safepoints while delayed
+  ThreadBlockInVM tbivm(JavaThread::current());
+  os::naked_short_nanosleep(delay * (NANOUNITS / MICROUNITS));
+}
+
+ZPage* ZPageAllocator::alloc_page_blocking(uint8_t type, size_t size, uint32_t numa_id, ZAllocationFlags flags) {
+  // Delay the allocating thread if we're running low on memory,
+  // to give the GC a chance to catch up before we have to stall.
+  pace(size);
+
   // Prepare to block
-  ZPageAllocRequest request(type, size, flags, ZCollectedHeap::heap()->total_collections());
+  ZPageAllocRequest request(type, size, numa_id, flags, ZCollectedHeap::heap()->total_collections());
 
   _lock.lock();
 
   // Try non-blocking allocation
-  ZPage* page = alloc_page_common(type, size, flags);
+  ZPage* page = alloc_page_common(type, size, numa_id, flags);
   if (page == NULL) {
     // Allocation failed, enqueue request
     _queue.insert_last(&request);
@@ -394,15 +467,15 @@ ZPage* ZPageAllocator::alloc_page_blocking(uint8_t type, size_t size, ZAllocatio
   return page;
 }
 
-ZPage* ZPageAllocator::alloc_page_nonblocking(uint8_t type, size_t size, ZAllocationFlags flags) {
+ZPage* ZPageAllocator::alloc_page_nonblocking(uint8_t type, size_t size, uint32_t numa_id, ZAllocationFlags flags) {
   ZLocker<ZLock> locker(&_lock);
-  return alloc_page_common(type, size, flags);
+  return alloc_page_common(type, size, numa_id, flags);
 }
 
-ZPage* ZPageAllocator::alloc_page(uint8_t type, size_t size, ZAllocationFlags flags) {
+ZPage* ZPageAllocator::alloc_page(uint8_t type, size_t size, uint32_t numa_id, ZAllocationFlags flags) {
   ZPage* const page = flags.non_blocking()
-                      ? alloc_page_nonblocking(type, size, flags)
-                      : alloc_page_blocking(type, size, flags);
+                      ? alloc_page_nonblocking(type, size, numa_id, flags)
+                      : alloc_page_blocking(type, size, numa_id, flags);
   if (page == NULL) {
     // Out of memory
     return NULL;
@@ -416,6 +489,11 @@ ZPage* ZPageAllocator::alloc_page(uint8_t type, size_t size, ZAllocationFlags fl
   // a safepoint where the global sequence number was updated.
   page->reset();
 
+  // Pages allocated for relocation hold objects that survived at
+  // least one GC cycle. With ZGenerationalPages these are kept apart
+  // from the pages used for new allocations.
+  page->set_old(ZGenerationalPages && flags.relocation());
+
   // Update allocation statistics. Exclude worker threads to avoid
   // artificial inflation of the allocation rate due to relocation.
   if (!flags.worker_thread()) {
@@ -437,7 +515,7 @@ void ZPageAllocator::satisfy_alloc_queue() {
       return;
     }
 
-    ZPage* const page = alloc_page_common(request->type(), request->size(), request->flags());
+    ZPage* const page = alloc_page_common(request->type(), request->size(), request->numa_id(), request->flags());
     if (page == NULL) {
       // Allocation could not be satisfied, give up
       return;
@@ -494,6 +572,73 @@ void ZPageAllocator::free_page(ZPage* page, bool reclaimed) {
   satisfy_alloc_queue();
 }
 
+uint64_t ZPageAllocator::uncommit(uint64_t delay) {
+  // Set the default timeout, when no pages are found in the
+  // cache or when uncommit is disabled, equal to the delay.
+  uint64_t timeout = delay;
+
+  if (!ZUncommit) {
+    // Disabled
+    return timeout;
+  }
+
+  size_t capacity_before;
+  size_t capacity_after;
+  size_t uncommitted;
+
+  {
+    ZLocker<ZLock> locker(&_lock);
+
+    // Don't uncommit memory while there are stalled allocations,
+    // since that memory would be needed again immediately.
+    if (!_queue.is_empty()) {
+      return timeout;
+    }
+
+    // Never uncommit below the min capacity, and never uncommit the
+    // reserve. The reserve must be committed, since it is needed for
+    // relocation when we are about to run out of memory.
+    const size_t retain = MAX2(_used + _max_reserve, _min_capacity);
+    const size_t release = capacity() - MIN2(retain, capacity());
+
+    // Uncommit at most 1/16 of the max capacity per round to
+    // avoid holding the page allocator lock for too long.
+    const size_t limit = align_up(current_max_capacity() >> 4, ZGranuleSize);
+    const size_t flush = MIN2(release, limit);
+
+    // Flush pages that have been unused for longer than the delay
+    ZList<ZPage> pages;
+    const size_t flushed = _cache.flush_for_uncommit(flush, &pages, delay, &timeout);
+    if (flushed == 0) {
+      // Nothing flushed
+      return timeout;
+    }
+
+    // Detach flushed pages, which returns their physical memory
+    for (ZPage* page = pages.remove_first(); page != NULL; page = pages.remove_first()) {
+      detach_page(page);
+    }
+
+    // Uncommit physical memory
+    capacity_before = capacity();
+    uncommitted = _physical.uncommit(flushed);
+    capacity_after = capacity();
+  }
+
+  if (uncommitted > 0) {
+    log_info(gc, heap)("Capacity: " SIZE_FORMAT "M(%.0lf%%)->" SIZE_FORMAT "M(%.0lf%%), "
+                       "Uncommitted: " SIZE_FORMAT "M",
+                       capacity_before / M, percent_of(capacity_before, max_capacity()),
+                       capacity_after / M, percent_of(capacity_after, max_capacity()),
+                       uncommitted / M);
+
+    // Update statistics
+    ZStatInc(ZCounterUncommit, uncommitted);
+  }
+
+  return timeout;
+}
+
 bool ZPageAllocator::is_alloc_stalled() const {
   assert(SafepointSynchronize::is_at_safepoint(), "Should be at safepoint");
   return !_queue.is_empty();
@@ -44,6 +44,7 @@ private:
   ZVirtualMemoryManager    _virtual;
   ZPhysicalMemoryManager   _physical;
   ZPageCache               _cache;
+  const size_t             _min_capacity;
   const size_t             _max_reserve;
   ZPreMappedMemory         _pre_mapped;
   size_t                   _used_high;
@@ -70,10 +71,13 @@ private:
 
   void check_out_of_memory_during_initialization();
 
-  ZPage* alloc_page_common_inner(uint8_t type, size_t size, ZAllocationFlags flags);
-  ZPage* alloc_page_common(uint8_t type, size_t size, ZAllocationFlags flags);
-  ZPage* alloc_page_blocking(uint8_t type, size_t size, ZAllocationFlags flags);
-  ZPage* alloc_page_nonblocking(uint8_t type, size_t size, ZAllocationFlags flags);
+  ZPage* alloc_page_common_inner(uint8_t type, size_t size, uint32_t numa_id, ZAllocationFlags flags);
+  ZPage* alloc_page_common(uint8_t type, size_t size, uint32_t numa_id, ZAllocationFlags flags);
+  uint64_t pacing_delay(size_t size) const;
+  void pace(size_t size) const;
+
+  ZPage* alloc_page_blocking(uint8_t type, size_t size, uint32_t numa_id, ZAllocationFlags flags);
+  ZPage* alloc_page_nonblocking(uint8_t type, size_t size, uint32_t numa_id, ZAllocationFlags flags);
 
   void satisfy_alloc_queue();
 
@@ -84,7 +88,9 @@ public:
 
   bool is_initialized() const;
 
+  size_t min_capacity() const;
   size_t max_capacity() const;
+  size_t soft_max_capacity() const;
   size_t current_max_capacity() const;
   size_t capacity() const;
   size_t max_reserve() const;
@@ -96,7 +102,7 @@ public:
 
   void reset_statistics();
 
-  ZPage* alloc_page(uint8_t type, size_t size, ZAllocationFlags flags);
+  ZPage* alloc_page(uint8_t type, size_t size, uint32_t numa_id, ZAllocationFlags flags);
   void free_page(ZPage* page, bool reclaimed);
   void free_page_inner(ZPage* page, bool reclaimed);
   void destroy_page(ZPage* page);
@@ -107,6 +113,8 @@ public:
 
   void flush_detached_pages(ZList<ZPage>* list);
 
+  uint64_t uncommit(uint64_t delay);
+
   bool is_alloc_stalled() const;
   void check_out_of_memory();
 };
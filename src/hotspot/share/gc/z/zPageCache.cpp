@@ -28,20 +28,28 @@
 #include "gc/z/zPageCache.hpp"
 #include "gc/z/zStat.hpp"
 #include "logging/log.hpp"
+#include "runtime/os.hpp"
 
 static const ZStatCounter ZCounterPageCacheHitL1("Memory", "Page Cache Hit L1", ZStatUnitOpsPerSecond);
 static const ZStatCounter ZCounterPageCacheHitL2("Memory", "Page Cache Hit L2", ZStatUnitOpsPerSecond);
 static const ZStatCounter ZCounterPageCacheMiss("Memory", "Page Cache Miss", ZStatUnitOpsPerSecond);
 static const ZStatCounter ZCounterPageCacheFlush("Memory", "Page Cache Flush", ZStatUnitBytesPerSecond);
 
+ZPageCacheFlushClosure::ZPageCacheFlushClosure(size_t requested) :
+    _requested(requested),
+    _flushed(0) {}
+
+size_t ZPageCacheFlushClosure::flushed() const {
+  return _flushed;
+}
+
 ZPageCache::ZPageCache() :
     _available(0),
     _small(),
     _medium(),
     _large() {}
 
-ZPage* ZPageCache::alloc_small_page() {
-  const uint32_t numa_id = ZNUMA::id();
+ZPage* ZPageCache::alloc_small_page(uint32_t numa_id) {
   const uint32_t numa_count = ZNUMA::count();
 
   // Try NUMA local page cache
@@ -99,11 +107,11 @@ ZPage* ZPageCache::alloc_large_page(size_t size) {
   return NULL;
 }
 
-ZPage* ZPageCache::alloc_page(uint8_t type, size_t size) {
+ZPage* ZPageCache::alloc_page(uint8_t type, size_t size, uint32_t numa_id) {
   ZPage* page;
 
   if (type == ZPageTypeSmall) {
-    page = alloc_small_page();
+    page = alloc_small_page(numa_id);
   } else if (type == ZPageTypeMedium) {
     page = alloc_medium_page();
   } else {
@@ -131,67 +139,138 @@ void ZPageCache::free_page(ZPage* page) {
     _large.insert_first(page);
   }
 
+  // Remember when the page was last used, for timed uncommit
+  page->set_last_used();
+
   _available += page->size();
 }
 
-void ZPageCache::flush_list(ZList<ZPage>* from, size_t requested, ZList<ZPage>* to, size_t* flushed) {
-  while (*flushed < requested) {
-    // Flush least recently used
-    ZPage* const page = from->remove_last();
-    if (page == NULL) {
-      break;
-    }
-
-    *flushed += page->size();
-    to->insert_last(page);
+bool ZPageCache::flush_list_inner(ZPageCacheFlushClosure* cl, ZList<ZPage>* from, ZList<ZPage>* to) {
+  // Flush least recently used
+  ZPage* const page = from->last();
+  if (page == NULL || !cl->do_page(page)) {
+    // Don't flush page
+    return false;
   }
+
+  // Flush page
+  _available -= page->size();
+  from->remove(page);
+  to->insert_last(page);
+  return true;
+}
+
+void ZPageCache::flush_list(ZPageCacheFlushClosure* cl, ZList<ZPage>* from, ZList<ZPage>* to) {
+  while (flush_list_inner(cl, from, to));
 }
 
-void ZPageCache::flush_per_numa_lists(ZPerNUMA<ZList<ZPage> >* from, size_t requested, ZList<ZPage>* to, size_t* flushed) {
+void ZPageCache::flush_per_numa_lists(ZPageCacheFlushClosure* cl, ZPerNUMA<ZList<ZPage> >* from, ZList<ZPage>* to) {
   const uint32_t numa_count = ZNUMA::count();
-  uint32_t numa_empty = 0;
+  uint32_t numa_done = 0;
   uint32_t numa_next = 0;
 
   // Flush lists round-robin
-  while (*flushed < requested) {
-    ZPage* const page = from->get(numa_next).remove_last();
-
+  while (numa_done < numa_count) {
+    ZList<ZPage>* numa_list = from->addr(numa_next);
     if (++numa_next == numa_count) {
       numa_next = 0;
     }
 
-    if (page == NULL) {
-      // List is empty
-      if (++numa_empty == numa_count) {
-        // All lists are empty
-        break;
-      }
+    if (flush_list_inner(cl, numa_list, to)) {
+      // Not done
+      numa_done = 0;
+    } else {
+      // Done
+      numa_done++;
+    }
+  }
+}
+
+void ZPageCache::flush(ZPageCacheFlushClosure* cl, ZList<ZPage>* to) {
+  // Prefer flushing large, then medium and last small pages
+  flush_list(cl, &_large, to);
+  flush_list(cl, &_medium, to);
+  flush_per_numa_lists(cl, &_small, to);
+}
+
+class ZPageCacheFlushForAllocationClosure : public ZPageCacheFlushClosure {
+public:
+  ZPageCacheFlushForAllocationClosure(size_t requested) :
+      ZPageCacheFlushClosure(requested) {}
 
-      // Try next list
-      continue;
+  virtual bool do_page(const ZPage* page) {
+    if (_flushed < _requested) {
+      // Flush page
+      _flushed += page->size();
+      return true;
     }
 
-    // Flush page
-    numa_empty = 0;
-    *flushed += page->size();
-    to->insert_last(page);
+    // Don't flush page
+    return false;
   }
-}
+};
 
-void ZPageCache::flush(ZList<ZPage>* to, size_t requested) {
-  size_t flushed = 0;
+void ZPageCache::flush_for_allocation(size_t requested, ZList<ZPage>* to) {
+  ZPageCacheFlushForAllocationClosure cl(requested);
+  flush(&cl, to);
 
-  // Prefer flushing large, then medium and last small pages
-  flush_list(&_large, requested, to, &flushed);
-  flush_list(&_medium, requested, to, &flushed);
-  flush_per_numa_lists(&_small, requested, to, &flushed);
+  const size_t flushed = cl.flushed();
 
   ZStatInc(ZCounterPageCacheFlush, flushed);
 
   log_info(gc, heap)("Page Cache Flushed: "
                      SIZE_FORMAT "M requested, "
                      SIZE_FORMAT "M(" SIZE_FORMAT "M->" SIZE_FORMAT "M) flushed",
-                     requested / M, flushed / M , _available / M, (_available - flushed) / M);
+                     requested / M, flushed / M , (_available + flushed) / M, _available / M);
+}
+
+class ZPageCacheFlushForUncommitClosure : public ZPageCacheFlushClosure {
+private:
+  const uint64_t _now;
+  const uint64_t _delay;
+  uint64_t*      _timeout;
+
+public:
+  ZPageCacheFlushForUncommitClosure(size_t requested, uint64_t delay, uint64_t* timeout) :
+      ZPageCacheFlushClosure(requested),
+      _now((uint64_t)os::elapsedTime()),
+      _delay(delay),
+      _timeout(timeout) {
+    // Set initial timeout
+    *_timeout = delay;
+  }
+
+  virtual bool do_page(const ZPage* page) {
+    const uint64_t expires = page->last_used() + _delay;
+    const uint64_t timeout = expires - MIN2(expires, _now);
+
+    if (_flushed + page->size() <= _requested && timeout == 0) {
+      // Flush page
+      _flushed += page->size();
+      return true;
+    }
+
+    // Record shortest non-expired timeout
+    *_timeout = MIN2(*_timeout, timeout);
+
+    // Don't flush page
+    return false;
+  }
+};
+
+size_t ZPageCache::flush_for_uncommit(size_t requested, ZList<ZPage>* to, uint64_t delay, uint64_t* timeout) {
+  if (requested == 0) {
+    // Nothing to flush, set timeout to delay
+    *timeout = delay;
+    return 0;
+  }
+
+  ZPageCacheFlushForUncommitClosure cl(requested, delay, timeout);
+  flush(&cl, to);
+
+  const size_t flushed = cl.flushed();
+
+  ZStatInc(ZCounterPageCacheFlush, flushed);
 
-  _available -= flushed;
+  return flushed;
 }
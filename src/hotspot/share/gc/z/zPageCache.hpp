@@ -29,6 +29,21 @@
 #include "gc/z/zValue.hpp"
 #include "memory/allocation.hpp"
 
+class ZPageCacheFlushClosure : public StackObj {
+protected:
+  const size_t _requested;
+  size_t       _flushed;
+
+public:
+  ZPageCacheFlushClosure(size_t requested);
+
+  size_t flushed() const;
+
+  // Returns true if the given page, which is the least recently
+  // used page in its list, should be flushed.
+  virtual bool do_page(const ZPage* page) = 0;
+};
+
 class ZPageCache {
 private:
   size_t                  _available;
@@ -37,22 +52,30 @@ private:
   ZList<ZPage>            _medium;
   ZList<ZPage>            _large;
 
-  ZPage* alloc_small_page();
+  ZPage* alloc_small_page(uint32_t numa_id);
   ZPage* alloc_medium_page();
   ZPage* alloc_large_page(size_t size);
 
-  void flush_list(ZList<ZPage>* from, size_t requested, ZList<ZPage>* to, size_t* flushed);
-  void flush_per_numa_lists(ZPerNUMA<ZList<ZPage> >* from, size_t requested, ZList<ZPage>* to, size_t* flushed);
+  bool flush_list_inner(ZPageCacheFlushClosure* cl, ZList<ZPage>* from, ZList<ZPage>* to);
+  void flush_list(ZPageCacheFlushClosure* cl, ZList<ZPage>* from, ZList<ZPage>* to);
+  void flush_per_numa_lists(ZPageCacheFlushClosure* cl, ZPerNUMA<ZList<ZPage> >* from, ZList<ZPage>* to);
+  void flush(ZPageCacheFlushClosure* cl, ZList<ZPage>* to);
 
 public:
   ZPageCache();
 
   size_t available() const;
 
-  ZPage* alloc_page(uint8_t type, size_t size);
+  ZPage* alloc_page(uint8_t type, size_t size, uint32_t numa_id);
   void free_page(ZPage* page);
 
-  void flush(ZList<ZPage>* to, size_t requested);
+  void flush_for_allocation(size_t requested, ZList<ZPage>* to);
+
+  // Flushes up to the requested number of bytes of pages that have been
+  // unused for at least the given delay (in seconds). Returns the number
+  // of bytes flushed, and sets timeout to the number of seconds until the
+  // next page in the cache will have been unused for that long.
+  size_t flush_for_uncommit(size_t requested, ZList<ZPage>* to, uint64_t delay, uint64_t* timeout);
 };
 
 #endif // SHARE_GC_Z_ZPAGECACHE_HPP
@@ -132,6 +132,13 @@ void ZPhysicalMemoryManager::try_ensure_unused_capacity(size_t size) {
   }
 }
 
+size_t ZPhysicalMemoryManager::uncommit(size_t size) {
+  // Only unused capacity can be uncommitted
+  const size_t uncommitted = _backing.uncommit(MIN2(size, unused_capacity()));
+  _capacity -= uncommitted;
+  return uncommitted;
+}
+
 void ZPhysicalMemoryManager::nmt_commit(ZPhysicalMemory pmem, uintptr_t offset) {
   const uintptr_t addr = _backing.nmt_address(offset);
   const size_t size = pmem.size();
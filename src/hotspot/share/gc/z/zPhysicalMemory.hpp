@@ -88,6 +88,7 @@ public:
   size_t unused_capacity() const;
 
   void try_ensure_unused_capacity(size_t size);
+  size_t uncommit(size_t size);
 
   ZPhysicalMemory alloc(size_t size);
   void free(ZPhysicalMemory pmem);
@@ -25,6 +25,7 @@
 #include "classfile/javaClasses.inline.hpp"
 #include "gc/shared/referencePolicy.hpp"
 #include "gc/shared/referenceProcessorStats.hpp"
+#include "gc/z/zArray.inline.hpp"
 #include "gc/z/zHeap.inline.hpp"
 #include "gc/z/zOopClosures.inline.hpp"
 #include "gc/z/zReferenceProcessor.hpp"
@@ -35,6 +36,8 @@
 #include "memory/universe.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/os.hpp"
+#include "runtime/timer.hpp"
+#include "utilities/ticks.hpp"
 
 static const ZStatSubPhase ZSubPhaseConcurrentReferencesProcess("Concurrent References Process");
 static const ZStatSubPhase ZSubPhaseConcurrentReferencesEnqueue("Concurrent References Enqueue");
@@ -45,9 +48,20 @@ ZReferenceProcessor::ZReferenceProcessor(ZWorkers* workers) :
     _encountered_count(),
     _discovered_count(),
     _enqueued_count(),
-    _discovered_list(NULL),
+    _processed_time(),
+    _discovered_list(),
+    _discovered_chunks(),
+    _chunks(),
     _pending_list(NULL),
-    _pending_list_tail(_pending_list.addr()) {}
+    _pending_list_tail(_pending_list.addr()) {
+  // Clear discovered lists
+  ZPerWorkerIterator<Lists> iter(&_discovered_list);
+  for (Lists* lists; iter.next(&lists);) {
+    for (int i = REF_SOFT; i <= REF_PHANTOM; i++) {
+      (*lists)[i] = NULL;
+    }
+  }
+}
 
 void ZReferenceProcessor::set_soft_reference_policy(bool clear) {
   static AlwaysClearPolicy always_clear_policy;
@@ -209,7 +223,7 @@ void ZReferenceProcessor::discover(oop obj, ReferenceType type) {
   log_trace(gc, ref)("Discovered Reference: " PTR_FORMAT " (%s)", p2i(obj), reference_type_name(type));
 
   // Update statistics
-  _discovered_count.get()[type]++;
+  const size_t discovered = ++_discovered_count.get()[type];
 
   // Mark referent finalizable
   if (should_mark_referent(type)) {
@@ -219,9 +233,21 @@ void ZReferenceProcessor::discover(oop obj, ReferenceType type) {
 
   // Add reference to discovered list
   assert(java_lang_ref_Reference::discovered(obj) == NULL, "Already discovered");
-  oop* const list = _discovered_list.addr();
+  oop* const list = &_discovered_list.get()[type];
   java_lang_ref_Reference::set_discovered(obj, *list);
   *list = obj;
+
+  // Seal the list into a chunk when it's full, so that
+  // processing can be spread evenly over all workers.
+  if (discovered % chunk_length == 0) {
+    seal_chunk(type);
+  }
+}
+
+void ZReferenceProcessor::seal_chunk(ReferenceType type) {
+  oop* const list = &_discovered_list.get()[type];
+  _discovered_chunks.get().add(ZReferenceChunk(*list, type));
+  *list = NULL;
 }
 
 oop ZReferenceProcessor::drop(oop obj, ReferenceType type) {
@@ -263,14 +289,17 @@ oop* ZReferenceProcessor::keep(oop obj, ReferenceType type) {
   return (oop*)java_lang_ref_Reference::discovered_addr_raw(obj);
 }
 
-void ZReferenceProcessor::work() {
+void ZReferenceProcessor::process_chunk(const ZReferenceChunk& chunk) {
+  const Ticks start = Ticks::now();
+  const ReferenceType type = chunk.type();
+
   // Process discovered references
-  oop* const list = _discovered_list.addr();
-  oop* p = list;
+  oop list = chunk.list();
+  oop* p = &list;
 
   while (*p != NULL) {
     const oop obj = *p;
-    const ReferenceType type = reference_type(obj);
+    assert(reference_type(obj) == type, "Invalid reference type");
 
     if (should_drop_reference(obj, type)) {
       *p = drop(obj, type);
@@ -280,26 +309,73 @@ void ZReferenceProcessor::work() {
   }
 
   // Prepend discovered references to internal pending list
-  if (*list != NULL) {
-    *p = Atomic::xchg(*list, _pending_list.addr());
+  if (list != NULL) {
+    *p = Atomic::xchg(list, _pending_list.addr());
     if (*p == NULL) {
       // First to prepend to list, record tail
       _pending_list_tail = p;
     }
+  }
+
+  // Update statistics
+  _processed_time.get()[type] += (Ticks::now() - start).value();
+}
+
+void ZReferenceProcessor::prepare_chunks() {
+  assert(_chunks.is_empty(), "Should be empty");
+
+  // Gather sealed chunks and the remaining partial lists from all
+  // workers, regardless of which worker discovered most references.
+  ZPerWorkerIterator<ZArray<ZReferenceChunk> > iter_chunks(&_discovered_chunks);
+  for (ZArray<ZReferenceChunk>* chunks; iter_chunks.next(&chunks);) {
+    ZArrayIterator<ZReferenceChunk> iter(chunks);
+    for (ZReferenceChunk chunk; iter.next(&chunk);) {
+      _chunks.add(chunk);
+    }
+    chunks->clear();
+  }
 
-    // Clear discovered list
-    *list = NULL;
+  ZPerWorkerIterator<Lists> iter_lists(&_discovered_list);
+  for (Lists* lists; iter_lists.next(&lists);) {
+    for (int i = REF_SOFT; i <= REF_PHANTOM; i++) {
+      if ((*lists)[i] != NULL) {
+        _chunks.add(ZReferenceChunk((*lists)[i], (ReferenceType)i));
+        (*lists)[i] = NULL;
+      }
+    }
+  }
+
+  log_debug(gc, ref)("Reference Chunks: " SIZE_FORMAT, _chunks.size());
+}
+
+void ZReferenceProcessor::work(ZArrayParallelIterator<ZReferenceChunk>* iter) {
+  // Claim and process chunks until all are done
+  for (ZReferenceChunk chunk; iter->next(&chunk);) {
+    process_chunk(chunk);
   }
 }
 
 bool ZReferenceProcessor::is_empty() const {
-  ZPerWorkerConstIterator<oop> iter(&_discovered_list);
-  for (const oop* list; iter.next(&list);) {
-    if (*list != NULL) {
+  ZPerWorkerConstIterator<Lists> iter_lists(&_discovered_list);
+  for (const Lists* lists; iter_lists.next(&lists);) {
+    for (int i = REF_SOFT; i <= REF_PHANTOM; i++) {
+      if ((*lists)[i] != NULL) {
+        return false;
+      }
+    }
+  }
+
+  ZPerWorkerConstIterator<ZArray<ZReferenceChunk> > iter_chunks(&_discovered_chunks);
+  for (const ZArray<ZReferenceChunk>* chunks; iter_chunks.next(&chunks);) {
+    if (!chunks->is_empty()) {
       return false;
     }
   }
 
+  if (!_chunks.is_empty()) {
+    return false;
+  }
+
   if (_pending_list.get() != NULL) {
     return false;
   }
@@ -333,12 +409,21 @@ void ZReferenceProcessor::reset_statistics() {
       (*counters)[i] = 0;
     }
   }
+
+  // Reset processed time
+  ZPerWorkerIterator<Counters> iter_processed(&_processed_time);
+  for (Counters* counters; iter_processed.next(&counters);) {
+    for (int i = REF_SOFT; i <= REF_PHANTOM; i++) {
+      (*counters)[i] = 0;
+    }
+  }
 }
 
 void ZReferenceProcessor::collect_statistics() {
   Counters encountered = {};
   Counters discovered = {};
   Counters enqueued = {};
+  Counters processed = {};
 
   // Sum encountered
   ZPerWorkerConstIterator<Counters> iter_encountered(&_encountered_count);
@@ -364,11 +449,20 @@ void ZReferenceProcessor::collect_statistics() {
     }
   }
 
+  // Sum processed time. Note that this is the total time spent by all
+  // workers, and not the wall clock time of the processing phase.
+  ZPerWorkerConstIterator<Counters> iter_processed(&_processed_time);
+  for (const Counters* counters; iter_processed.next(&counters);) {
+    for (int i = REF_SOFT; i <= REF_PHANTOM; i++) {
+      processed[i] += (*counters)[i];
+    }
+  }
+
   // Update statistics
-  ZStatReferences::set_soft(encountered[REF_SOFT], discovered[REF_SOFT], enqueued[REF_SOFT]);
-  ZStatReferences::set_weak(encountered[REF_WEAK], discovered[REF_WEAK], enqueued[REF_WEAK]);
-  ZStatReferences::set_final(encountered[REF_FINAL], discovered[REF_FINAL], enqueued[REF_FINAL]);
-  ZStatReferences::set_phantom(encountered[REF_PHANTOM], discovered[REF_PHANTOM], enqueued[REF_PHANTOM]);
+  ZStatReferences::set_soft(encountered[REF_SOFT], discovered[REF_SOFT], enqueued[REF_SOFT], processed[REF_SOFT]);
+  ZStatReferences::set_weak(encountered[REF_WEAK], discovered[REF_WEAK], enqueued[REF_WEAK], processed[REF_WEAK]);
+  ZStatReferences::set_final(encountered[REF_FINAL], discovered[REF_FINAL], enqueued[REF_FINAL], processed[REF_FINAL]);
+  ZStatReferences::set_phantom(encountered[REF_PHANTOM], discovered[REF_PHANTOM], enqueued[REF_PHANTOM], processed[REF_PHANTOM]);
 
   // Trace statistics
   const ReferenceProcessorStats stats(discovered[REF_SOFT],
@@ -380,24 +474,34 @@ void ZReferenceProcessor::collect_statistics() {
 
 class ZReferenceProcessorTask : public ZTask {
 private:
-  ZReferenceProcessor* const _reference_processor;
+  ZReferenceProcessor* const              _reference_processor;
+  ZArrayParallelIterator<ZReferenceChunk> _iter;
 
 public:
   ZReferenceProcessorTask(ZReferenceProcessor* reference_processor) :
       ZTask("ZReferenceProcessorTask"),
-      _reference_processor(reference_processor) {}
+      _reference_processor(reference_processor),
+      _iter(&reference_processor->_chunks) {}
 
   virtual void work() {
-    _reference_processor->work();
+    _reference_processor->work(&_iter);
   }
 };
 
 void ZReferenceProcessor::process_references() {
   ZStatTimer timer(ZSubPhaseConcurrentReferencesProcess);
 
-  // Process discovered lists
-  ZReferenceProcessorTask task(this);
-  _workers->run_concurrent(&task);
+  // Gather discovered lists
+  prepare_chunks();
+
+  {
+    // Process discovered lists
+    ZReferenceProcessorTask task(this);
+    _workers->run_concurrent(&task);
+  }
+
+  // Clear processed chunks
+  _chunks.clear();
 
   // Update soft reference clock
   update_soft_reference_clock();
@@ -25,26 +25,55 @@
 #define SHARE_GC_Z_ZREFERENCEPROCESSOR_HPP
 
 #include "gc/shared/referenceDiscoverer.hpp"
+#include "gc/z/zArray.hpp"
 #include "gc/z/zValue.hpp"
 
 class ReferencePolicy;
 class ZWorkers;
 
+class ZReferenceChunk {
+private:
+  oop           _list;
+  ReferenceType _type;
+
+public:
+  ZReferenceChunk() :
+      _list(NULL),
+      _type(REF_NONE) {}
+
+  ZReferenceChunk(oop list, ReferenceType type) :
+      _list(list),
+      _type(type) {}
+
+  oop list() const {
+    return _list;
+  }
+
+  ReferenceType type() const {
+    return _type;
+  }
+};
+
 class ZReferenceProcessor : public ReferenceDiscoverer {
   friend class ZReferenceProcessorTask;
 
 private:
   static const size_t reference_type_count = REF_PHANTOM + 1;
+  static const size_t chunk_length = 1024;
   typedef size_t Counters[reference_type_count];
+  typedef oop Lists[reference_type_count];
 
-  ZWorkers* const      _workers;
-  ReferencePolicy*     _soft_reference_policy;
-  ZPerWorker<Counters> _encountered_count;
-  ZPerWorker<Counters> _discovered_count;
-  ZPerWorker<Counters> _enqueued_count;
-  ZPerWorker<oop>      _discovered_list;
-  ZContended<oop>      _pending_list;
-  oop*                 _pending_list_tail;
+  ZWorkers* const                      _workers;
+  ReferencePolicy*                     _soft_reference_policy;
+  ZPerWorker<Counters>                 _encountered_count;
+  ZPerWorker<Counters>                 _discovered_count;
+  ZPerWorker<Counters>                 _enqueued_count;
+  ZPerWorker<Counters>                 _processed_time;
+  ZPerWorker<Lists>                    _discovered_list;
+  ZPerWorker<ZArray<ZReferenceChunk> > _discovered_chunks;
+  ZArray<ZReferenceChunk>              _chunks;
+  ZContended<oop>                      _pending_list;
+  oop*                                 _pending_list_tail;
 
   void update_soft_reference_clock() const;
 
@@ -66,7 +95,10 @@ private:
 
   bool is_empty() const;
 
-  void work();
+  void seal_chunk(ReferenceType type);
+  void prepare_chunks();
+  void process_chunk(const ZReferenceChunk& chunk);
+  void work(ZArrayParallelIterator<ZReferenceChunk>* iter);
   void collect_statistics();
 
 public:
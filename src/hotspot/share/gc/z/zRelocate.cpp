@@ -26,13 +26,16 @@
 #include "gc/z/zBarrier.inline.hpp"
 #include "gc/z/zHeap.hpp"
 #include "gc/z/zOopClosures.inline.hpp"
-#include "gc/z/zPage.hpp"
+#include "gc/z/zPage.inline.hpp"
 #include "gc/z/zRelocate.hpp"
 #include "gc/z/zRelocationSet.inline.hpp"
 #include "gc/z/zRootsIterator.hpp"
+#include "gc/z/zStat.hpp"
 #include "gc/z/zTask.hpp"
 #include "gc/z/zWorkers.hpp"
 
+static const ZStatCounter ZCounterPromotion("Memory", "Promotion", ZStatUnitBytesPerSecond);
+
 ZRelocate::ZRelocate(ZWorkers* workers) :
     _workers(workers) {}
 
@@ -116,6 +119,11 @@ bool ZRelocate::work(ZRelocationSetParallelIterator* iter) {
       // Relocation failed, page is now pinned
       success = false;
     } else {
+      if (ZGenerationalPages && !page->is_old()) {
+        // Live objects in young pages have now been promoted to old pages
+        ZStatInc(ZCounterPromotion, page->live_bytes());
+      }
+
       // Relocation succeeded, release page
       ZHeap::heap()->release_page(page, true /* reclaimed */);
     }
@@ -32,6 +32,7 @@
 #include "gc/z/zStat.hpp"
 #include "gc/z/zTracer.inline.hpp"
 #include "gc/z/zUtils.hpp"
+#include "logging/logStream.hpp"
 #include "memory/resourceArea.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/os.hpp"
@@ -639,6 +640,7 @@ void ZStatPhaseCycle::register_end(const Ticks& start, const Ticks& end) const {
   ZStatMMU::print();
   ZStatMark::print();
   ZStatRelocation::print();
+  ZStatNUMA::print();
   ZStatNMethods::print();
   ZStatMetaspace::print();
   ZStatReferences::print();
@@ -1131,6 +1133,44 @@ void ZStatRelocation::print() {
   }
 }
 
+//
+// Stat NUMA
+//
+size_t* ZStatNUMA::_small_pages = NULL;
+
+void ZStatNUMA::reset_at_select_relocation_set() {
+  const uint32_t numa_count = ZNUMA::count();
+
+  if (_small_pages == NULL) {
+    _small_pages = NEW_C_HEAP_ARRAY(size_t, numa_count, mtGC);
+  }
+
+  for (uint32_t i = 0; i < numa_count; i++) {
+    _small_pages[i] = 0;
+  }
+}
+
+void ZStatNUMA::register_small_page(uint32_t numa_id) {
+  assert(numa_id < ZNUMA::count(), "Invalid NUMA id");
+  _small_pages[numa_id]++;
+}
+
+void ZStatNUMA::print() {
+  if (!ZNUMA::is_enabled() || _small_pages == NULL) {
+    return;
+  }
+
+  LogTarget(Info, gc, numa) lt;
+  if (lt.is_enabled()) {
+    LogStream ls(lt);
+    ls.print("NUMA Small Pages:");
+    for (uint32_t i = 0; i < ZNUMA::count(); i++) {
+      ls.print(" " SIZE_FORMAT " (Node %u)", _small_pages[i], i);
+    }
+    ls.cr();
+  }
+}
+
 //
 // Stat nmethods
 //
@@ -1161,37 +1201,40 @@ ZStatReferences::ZCount ZStatReferences::_weak;
 ZStatReferences::ZCount ZStatReferences::_final;
 ZStatReferences::ZCount ZStatReferences::_phantom;
 
-void ZStatReferences::set(ZCount* count, size_t encountered, size_t discovered, size_t enqueued) {
+void ZStatReferences::set(ZCount* count, size_t encountered, size_t discovered, size_t enqueued, jlong processed) {
   count->encountered = encountered;
   count->discovered = discovered;
   count->enqueued = enqueued;
+  count->processed = processed;
 }
 
-void ZStatReferences::set_soft(size_t encountered, size_t discovered, size_t enqueued) {
-  set(&_soft, encountered, discovered, enqueued);
+void ZStatReferences::set_soft(size_t encountered, size_t discovered, size_t enqueued, jlong processed) {
+  set(&_soft, encountered, discovered, enqueued, processed);
 }
 
-void ZStatReferences::set_weak(size_t encountered, size_t discovered, size_t enqueued) {
-  set(&_weak, encountered, discovered, enqueued);
+void ZStatReferences::set_weak(size_t encountered, size_t discovered, size_t enqueued, jlong processed) {
+  set(&_weak, encountered, discovered, enqueued, processed);
 }
 
-void ZStatReferences::set_final(size_t encountered, size_t discovered, size_t enqueued) {
-  set(&_final, encountered, discovered, enqueued);
+void ZStatReferences::set_final(size_t encountered, size_t discovered, size_t enqueued, jlong processed) {
+  set(&_final, encountered, discovered, enqueued, processed);
 }
 
-void ZStatReferences::set_phantom(size_t encountered, size_t discovered, size_t enqueued) {
-  set(&_phantom, encountered, discovered, enqueued);
+void ZStatReferences::set_phantom(size_t encountered, size_t discovered, size_t enqueued, jlong processed) {
+  set(&_phantom, encountered, discovered, enqueued, processed);
 }
 
 void ZStatReferences::print(const char* name, const ZStatReferences::ZCount& ref) {
   log_info(gc, ref)("%s: "
                     SIZE_FORMAT " encountered, "
                     SIZE_FORMAT " discovered, "
-                    SIZE_FORMAT " enqueued",
+                    SIZE_FORMAT " enqueued, "
+                    "%.3fms processed",
                     name,
                     ref.encountered,
                     ref.discovered,
-                    ref.enqueued);
+                    ref.enqueued,
+                    TimeHelper::counter_to_millis(ref.processed));
 }
 
 void ZStatReferences::print() {
@@ -421,6 +421,20 @@ public:
   static void print();
 };
 
+//
+// Stat NUMA
+//
+class ZStatNUMA : public AllStatic {
+private:
+  static size_t* _small_pages;
+
+public:
+  static void reset_at_select_relocation_set();
+  static void register_small_page(uint32_t numa_id);
+
+  static void print();
+};
+
 //
 // Stat nmethods
 //
@@ -446,16 +460,17 @@ private:
     size_t encountered;
     size_t discovered;
     size_t enqueued;
+    jlong  processed;
   } _soft, _weak, _final, _phantom;
 
-  static void set(ZCount* count, size_t encountered, size_t discovered, size_t enqueued);
+  static void set(ZCount* count, size_t encountered, size_t discovered, size_t enqueued, jlong processed);
   static void print(const char* name, const ZCount& ref);
 
 public:
-  static void set_soft(size_t encountered, size_t discovered, size_t enqueued);
-  static void set_weak(size_t encountered, size_t discovered, size_t enqueued);
-  static void set_final(size_t encountered, size_t discovered, size_t enqueued);
-  static void set_phantom(size_t encountered, size_t discovered, size_t enqueued);
+  static void set_soft(size_t encountered, size_t discovered, size_t enqueued, jlong processed);
+  static void set_weak(size_t encountered, size_t discovered, size_t enqueued, jlong processed);
+  static void set_final(size_t encountered, size_t discovered, size_t enqueued, jlong processed);
+  static void set_phantom(size_t encountered, size_t discovered, size_t enqueued, jlong processed);
 
   static void print();
 };
@@ -57,6 +57,18 @@
           "Maximum number of bytes allocated for mark stacks")              \
           range(32*M, 1024*G)                                               \
                                                                             \
+  product(bool, ZUncommit, true,                                            \
+          "Uncommit unused memory")                                         \
+                                                                            \
+  product(uintx, ZUncommitDelay, 5 * 60,                                    \
+          "Uncommit memory if it has been unused for the specified "        \
+          "amount of time (in seconds)")                                    \
+                                                                            \
+  manageable(size_t, ZSoftMaxHeapSize, 0,                                   \
+          "Soft limit for the heap size used by the GC heuristics to "      \
+          "decide when to collect, allowing unused memory above it to be "  \
+          "uncommitted (0 means use the max heap size)")                    \
+                                                                            \
   product(uint, ZCollectionInterval, 0,                                     \
           "Force GC at a fixed time interval (in seconds)")                 \
                                                                             \
@@ -64,6 +76,28 @@
           "Time between statistics print outs (in seconds)")                \
           range(1, (uint)-1)                                                \
                                                                             \
+  experimental(bool, ZGenerationalPages, false,                             \
+          "Relocate objects that survive a GC cycle into separate old "     \
+          "pages, instead of mixing them with newly allocated objects")     \
+                                                                            \
+  experimental(bool, ZConcurrentThreadStacks, false,                        \
+          "Scan Java thread stacks concurrently after the mark start "      \
+          "pause, instead of in the pause (requires ThreadLocalHandshakes)")\
+                                                                            \
+  experimental(bool, ZAllocationPacing, false,                              \
+          "Progressively delay allocating Java threads when free memory "   \
+          "runs low, to reduce the risk of hard allocation stalls")         \
+                                                                            \
+  experimental(uintx, ZAllocationPacingThreshold, 10,                       \
+          "Percentage of free memory, relative to the soft max heap size, " \
+          "below which allocation pacing starts")                           \
+          range(1, 100)                                                     \
+                                                                            \
+  experimental(uintx, ZAllocationPacingMaxDelay, 10,                        \
+          "Maximum delay (in milliseconds) imposed on a single page "       \
+          "allocation by allocation pacing")                                \
+          range(1, 999)                                                     \
+                                                                            \
   diagnostic(bool, ZStatisticsForceTrace, false,                            \
           "Force tracing of ZStats")                                        \
                                                                             \
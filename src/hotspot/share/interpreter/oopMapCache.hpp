@@ -146,8 +146,12 @@ class InterpreterOopMap: ResourceObj {
 class OopMapCache : public CHeapObj<mtClass> {
  static OopMapCacheEntry* volatile _old_entries;
  private:
-  enum { _size        = 32,     // Use fixed size for now
-         _probe_depth = 3       // probe depth in case of collisions
+  // The cache is allocated lazily and only for classes with methods seen in
+  // interpreted frames during root scanning. A class with many such methods
+  // would otherwise keep evicting its own entries and recompute the oop maps
+  // inside every pause.
+  enum { _size        = 64,     // Use fixed size for now
+         _probe_depth = 4       // probe depth in case of collisions
   };
 
   OopMapCacheEntry* volatile * _array;
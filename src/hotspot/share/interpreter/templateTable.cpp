@@ -500,6 +500,14 @@ void TemplateTable::initialize() {
   def(Bytecodes::_fast_iaccess_0      , ubcp|____|____|____, vtos, itos, fast_xaccess        ,  itos        );
   def(Bytecodes::_fast_aaccess_0      , ubcp|____|____|____, vtos, atos, fast_xaccess        ,  atos        );
   def(Bytecodes::_fast_faccess_0      , ubcp|____|____|____, vtos, ftos, fast_xaccess        ,  ftos        );
+#if defined(X86) || defined(AARCH64)
+  def(Bytecodes::_fast_baccess_0      , ubcp|____|____|____, vtos, itos, fast_xaccess        ,  itos        );
+  def(Bytecodes::_fast_laccess_0      , ubcp|____|____|____, vtos, ltos, fast_xaccess        ,  ltos        );
+#else
+  // Other platforms do not rewrite to these pairs
+  def(Bytecodes::_fast_baccess_0      , ____|____|____|____, vtos, vtos, shouldnotreachhere  ,  _           );
+  def(Bytecodes::_fast_laccess_0      , ____|____|____|____, vtos, vtos, shouldnotreachhere  ,  _           );
+#endif
 
   def(Bytecodes::_fast_iload          , ubcp|____|____|____, vtos, itos, fast_iload          ,  _       );
   def(Bytecodes::_fast_iload2         , ubcp|____|____|____, vtos, itos, fast_iload2         ,  _       );
@@ -41,6 +41,7 @@
 #include "jfr/leakprofiler/sampling/objectSample.hpp"
 #include "jfr/leakprofiler/sampling/objectSampler.hpp"
 #include "jfr/leakprofiler/utilities/granularTimer.hpp"
+#include "jfr/utilities/jfrTimeConverter.hpp"
 #include "logging/log.hpp"
 #include "memory/universe.hpp"
 #include "oops/oop.inline.hpp"
@@ -53,11 +54,19 @@ PathToGcRootsOperation::PathToGcRootsOperation(ObjectSampler* sampler, EdgeStore
 /* The EdgeQueue is backed by directly managed virtual memory.
  * We will attempt to dimension an initial reservation
  * in proportion to the size of the heap (represented by heap_region).
- * Initial memory reservation: 5% of the heap OR at least 32 Mb
+ * Initial memory reservation: 5% of the heap OR at least 32 Mb,
+ * but no more than JfrPathToGcRootsMaxQueueSize if that is set.
  * Commit ratio: 1 : 10 (subject to allocation granularties)
+ *
+ * If the roots do not fit in a bounded queue, doit() falls
+ * back to a depth-first search which needs no queue memory.
  */
 static size_t edge_queue_memory_reservation(const MemRegion& heap_region) {
-  const size_t memory_reservation_bytes = MAX2(heap_region.byte_size() / 20, 32*M);
+  size_t memory_reservation_bytes = heap_region.byte_size() / 20;
+  if (JfrPathToGcRootsMaxQueueSize > 0) {
+    memory_reservation_bytes = MIN2(memory_reservation_bytes, JfrPathToGcRootsMaxQueueSize);
+  }
+  memory_reservation_bytes = MAX2(memory_reservation_bytes, 32*M);
   assert(memory_reservation_bytes >= (size_t)32*M, "invariant");
   return memory_reservation_bytes;
 }
@@ -112,7 +121,16 @@ void PathToGcRootsOperation::doit() {
   BFSClosure bfs(&edge_queue, _edge_store, &mark_bits);
   RootSetClosure<BFSClosure> roots(&bfs);
 
-  GranularTimer::start(_cutoff_ticks, 1000000);
+  // Bound the pause by JfrPathToGcRootsTimeLimit, if set. When the time runs
+  // out the closures stop and the chains found so far are emitted.
+  int64_t cutoff_ticks = _cutoff_ticks;
+  if (JfrPathToGcRootsTimeLimit > 0) {
+    const jlong limit_ticks =
+      JfrTimeConverter::nanos_to_countertime((jlong)JfrPathToGcRootsTimeLimit * NANOSECS_PER_MILLISEC);
+    cutoff_ticks = MIN2(cutoff_ticks, (int64_t)MAX2(limit_ticks, (jlong)1));
+  }
+
+  GranularTimer::start(cutoff_ticks, 1000000);
   roots.process();
   if (edge_queue.is_full()) {
     // Pathological case where roots don't fit in queue
@@ -111,7 +111,11 @@ void EventEmitter::write_event(const ObjectSample* sample, EdgeStore* edge_store
   traceid gc_root_id = 0;
   const Edge* edge = NULL;
   if (SafepointSynchronize::is_at_safepoint()) {
-    edge = (const Edge*)(*object_addr)->mark();
+    // a sample object not reached from the gc roots keeps its "marked" mark
+    const markOop mark = (*object_addr)->mark();
+    if (!mark->is_marked()) {
+      edge = (const Edge*)mark;
+    }
   }
   if (edge == NULL) {
     // In order to dump out a representation of the event
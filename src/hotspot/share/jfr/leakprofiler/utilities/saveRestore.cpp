@@ -31,14 +31,11 @@ MarkOopContext::MarkOopContext() : _obj(NULL), _mark_oop(NULL) {}
 
 MarkOopContext::MarkOopContext(const oop obj) : _obj(obj), _mark_oop(obj->mark()) {
   assert(_obj->mark() == _mark_oop, "invariant");
-  // now we will "poison" the mark word of the object
-  // to the intermediate monitor INFLATING state.
-  // This is an "impossible" state during a safepoint,
-  // hence we will use it to quickly identify objects
-  // during the reachability search from gc roots.
-  assert(NULL == markOopDesc::INFLATING(), "invariant");
-  _obj->set_mark(markOopDesc::INFLATING());
-  assert(NULL == obj->mark(), "invariant");
+  // now we will set the mark word to "marked" in order to quickly
+  // identify objects during the reachability search from gc roots.
+  assert(!_obj->mark()->is_marked(), "should only mark an object once");
+  _obj->set_mark(markOopDesc::prototype()->set_marked());
+  assert(_obj->mark()->is_marked(), "invariant");
 }
 
 MarkOopContext::~MarkOopContext() {
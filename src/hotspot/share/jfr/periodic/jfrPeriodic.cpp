@@ -55,9 +55,11 @@
 #include "runtime/thread.inline.hpp"
 #include "runtime/threadSMR.hpp"
 #include "runtime/sweeper.hpp"
+#include "runtime/timer.hpp"
 #include "runtime/vmThread.hpp"
 #include "services/classLoadingService.hpp"
 #include "services/management.hpp"
+#include "services/memTracker.hpp"
 #include "services/threadService.hpp"
 #include "utilities/exceptions.hpp"
 #include "utilities/globalDefinitions.hpp"
@@ -67,6 +69,9 @@
 #if INCLUDE_SHENANDOAHGC
 #include "gc/shenandoah/shenandoahJfrSupport.hpp"
 #endif
+#ifdef LINUX
+#include "osContainer_linux.hpp"
+#endif
 
 /**
  *  JfrPeriodic class
@@ -427,6 +432,59 @@ TRACE_REQUEST_FUNC(ThreadAllocationStatistics) {
   }
 }
 
+struct ThreadTLABSample {
+  traceid thread_id;
+  size_t desired_size;
+  unsigned target_refills;
+  size_t refills;
+  size_t allocated;
+  size_t waste;
+  float waste_rate;
+};
+
+TRACE_REQUEST_FUNC(ThreadTLABStatistics) {
+  if (!UseTLAB) {
+    return;
+  }
+  ResourceMark rm;
+  GrowableArray<ThreadTLABSample> samples(Threads::number_of_threads());
+  JfrTicks time_stamp = JfrTicks::now();
+  {
+    // Collect TLAB statistics while holding threads lock
+    MutexLockerEx ml(Threads_lock);
+    for (JavaThreadIteratorWithHandle jtiwh; JavaThread *jt = jtiwh.next(); ) {
+      ThreadLocalAllocBuffer& tlab = jt->tlab();
+      if (tlab.total_refills() == 0) {
+        continue;
+      }
+      ThreadTLABSample sample;
+      sample.thread_id = JFR_THREAD_ID(jt);
+      sample.desired_size = tlab.desired_size() * HeapWordSize;
+      sample.target_refills = tlab.thread_target_refills();
+      sample.refills = tlab.total_refills();
+      sample.allocated = tlab.total_allocated_size() * HeapWordSize;
+      sample.waste = tlab.total_waste() * HeapWordSize;
+      sample.waste_rate = (float)tlab.waste_fraction();
+      samples.append(sample);
+    }
+  }
+
+  // Write TLAB statistics to buffer.
+  for (int i = 0; i < samples.length(); i++) {
+    const ThreadTLABSample& sample = samples.at(i);
+    EventThreadTLABStatistics event(UNTIMED);
+    event.set_thread(sample.thread_id);
+    event.set_desiredSize(sample.desired_size);
+    event.set_targetRefills(sample.target_refills);
+    event.set_refills(sample.refills);
+    event.set_allocated(sample.allocated);
+    event.set_waste(sample.waste);
+    event.set_wasteRate(sample.waste_rate);
+    event.set_endtime(time_stamp);
+    event.commit();
+  }
+}
+
 /**
  *  PhysicalMemory event represents:
  *
@@ -447,6 +505,93 @@ TRACE_REQUEST_FUNC(PhysicalMemory) {
   event.commit();
 }
 
+TRACE_REQUEST_FUNC(PressureStall) {
+#ifdef LINUX
+  static const char* const resources[] = { "cpu", "memory", "io" };
+  for (size_t i = 0; i < ARRAY_SIZE(resources); i++) {
+    PressureStallInfo psi;
+    if (!OSContainer::pressure_stall_info(resources[i], &psi)) {
+      continue;
+    }
+    // The kernel reports percentages and microseconds.
+    const bool has_full = psi.full_total >= 0;
+    EventPressureStall event;
+    event.set_resource(resources[i]);
+    event.set_someAvg10((float)(psi.some_avg10 / 100));
+    event.set_someAvg60((float)(psi.some_avg60 / 100));
+    event.set_someAvg300((float)(psi.some_avg300 / 100));
+    event.set_someTotal(psi.some_total * (NANOUNITS / MICROUNITS));
+    event.set_fullAvg10(has_full ? (float)(psi.full_avg10 / 100) : -1.0f);
+    event.set_fullAvg60(has_full ? (float)(psi.full_avg60 / 100) : -1.0f);
+    event.set_fullAvg300(has_full ? (float)(psi.full_avg300 / 100) : -1.0f);
+    event.set_fullTotal(has_full ? psi.full_total * (NANOUNITS / MICROUNITS) : -1);
+    event.commit();
+  }
+#endif
+}
+
+#if INCLUDE_NMT
+// Combined malloc and virtual memory usage for one NMT memory type,
+// computed the same way as the NMT summary report.
+class NativeMemoryUsageSnapshot : public StackObj {
+ private:
+  MallocMemorySnapshot _malloc;
+  VirtualMemorySnapshot _virtual;
+ public:
+  NativeMemoryUsageSnapshot() {
+    MallocMemorySummary::snapshot(&_malloc);
+    VirtualMemorySummary::snapshot(&_virtual);
+  }
+  size_t reserved(int index) {
+    const MallocMemory* m = _malloc.by_index(index);
+    return m->malloc_size() + m->arena_size() + _virtual.by_index(index)->reserved();
+  }
+  size_t committed(int index) {
+    const MallocMemory* m = _malloc.by_index(index);
+    return m->malloc_size() + m->arena_size() + _virtual.by_index(index)->committed();
+  }
+};
+#endif // INCLUDE_NMT
+
+TRACE_REQUEST_FUNC(NativeMemoryUsage) {
+#if INCLUDE_NMT
+  if (MemTracker::tracking_level() < NMT_summary) {
+    return;
+  }
+  NativeMemoryUsageSnapshot snapshot;
+  for (int index = 0; index < mt_number_of_types; index++) {
+    const MEMFLAGS flag = NMTUtil::index_to_flag(index);
+    if (flag == mtNone) {
+      continue;
+    }
+    EventNativeMemoryUsage event;
+    event.set_type(NMTUtil::flag_to_name(flag));
+    event.set_reserved(snapshot.reserved(index));
+    event.set_committed(snapshot.committed(index));
+    event.commit();
+  }
+#endif // INCLUDE_NMT
+}
+
+TRACE_REQUEST_FUNC(NativeMemoryUsageTotal) {
+#if INCLUDE_NMT
+  if (MemTracker::tracking_level() < NMT_summary) {
+    return;
+  }
+  NativeMemoryUsageSnapshot snapshot;
+  size_t reserved = 0;
+  size_t committed = 0;
+  for (int index = 0; index < mt_number_of_types; index++) {
+    reserved += snapshot.reserved(index);
+    committed += snapshot.committed(index);
+  }
+  EventNativeMemoryUsageTotal event;
+  event.set_reserved(reserved);
+  event.set_committed(committed);
+  event.commit();
+#endif // INCLUDE_NMT
+}
+
 TRACE_REQUEST_FUNC(JavaThreadStatistics) {
   EventJavaThreadStatistics event;
   event.set_activeCount(ThreadService::get_live_thread_count());
@@ -523,6 +668,26 @@ TRACE_REQUEST_FUNC(CompilerStatistics) {
   event.commit();
 }
 
+TRACE_REQUEST_FUNC(CompilerQueueUtilization) {
+  const int levels[] = { CompLevel_simple, CompLevel_full_optimization };
+  for (size_t i = 0; i < ARRAY_SIZE(levels); i++) {
+    CompileQueue* queue = CompileBroker::compile_queue(levels[i]);
+    AbstractCompiler* compiler = CompileBroker::compiler(levels[i]);
+    if (queue == NULL || compiler == NULL) {
+      continue;
+    }
+    EventCompilerQueueUtilization event;
+    event.set_compiler(compiler->type());
+    event.set_queueSize(queue->size());
+    event.set_peakQueueSize(queue->peak_size());
+    event.set_totalAddedCount(queue->total_added());
+    event.set_totalRemovedCount(queue->total_removed());
+    event.set_totalWaitTime((jlong)TimeHelper::counter_to_millis(queue->total_wait_ticks()));
+    event.set_compilerThreadCount(compiler->num_compiler_threads());
+    event.commit();
+  }
+}
+
 TRACE_REQUEST_FUNC(CompilerConfiguration) {
   EventCompilerConfiguration event;
   event.set_threadCount(CICompilerCount);
@@ -282,8 +282,10 @@ bool JfrThreadSampleClosure::sample_thread_in_native(JavaThread* thread, JfrStac
   return true;
 }
 
-static const uint MAX_NR_OF_JAVA_SAMPLES = 5;
-static const uint MAX_NR_OF_NATIVE_SAMPLES = 1;
+// Upper bounds for JfrJavaSamplesPerPeriod and JfrNativeSamplesPerPeriod,
+// used to size the on-stack event arrays in task_stacktrace().
+static const uint MAX_NR_OF_JAVA_SAMPLES = 64;
+static const uint MAX_NR_OF_NATIVE_SAMPLES = 16;
 
 void JfrThreadSampleClosure::commit_events(JfrSampleType type) {
   if (JAVA_SAMPLE == type) {
@@ -506,7 +508,9 @@ void JfrThreadSampler::task_stacktrace(JfrSampleType type, JavaThread** last_thr
   EventNativeMethodSample samples_native[MAX_NR_OF_NATIVE_SAMPLES];
   JfrThreadSampleClosure sample_task(samples, samples_native);
 
-  const uint sample_limit = JAVA_SAMPLE == type ? MAX_NR_OF_JAVA_SAMPLES : MAX_NR_OF_NATIVE_SAMPLES;
+  const uint sample_limit = JAVA_SAMPLE == type ?
+    MIN2((uint)JfrJavaSamplesPerPeriod, MAX_NR_OF_JAVA_SAMPLES) :
+    MIN2((uint)JfrNativeSamplesPerPeriod, MAX_NR_OF_NATIVE_SAMPLES);
   uint num_samples = 0;
   JavaThread* start = NULL;
 
@@ -29,6 +29,8 @@
 #include "jfr/recorder/stacktrace/jfrStackTraceRepository.hpp"
 #include "jfr/support/jfrThreadLocal.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "runtime/orderAccess.hpp"
+#include "utilities/globalCounter.inline.hpp"
 
 /*
  * There are two separate repository instances.
@@ -97,52 +99,78 @@ bool JfrStackTraceRepository::is_modified() const {
   return _last_entries != _entries;
 }
 
+// Moves all chains to the given array and empties the table.
+// Must hold JfrStacktrace_lock.
+JfrStackTrace** JfrStackTraceRepository::detach_table() {
+  assert_lock_strong(JfrStacktrace_lock);
+  JfrStackTrace** const detached = NEW_C_HEAP_ARRAY(JfrStackTrace*, TABLE_SIZE, mtTracing);
+  memcpy(detached, _table, sizeof(_table));
+  memset(_table, 0, sizeof(_table));
+  return detached;
+}
+
+// Lock-free readers in add_trace() may still walk the detached chains,
+// wait for them before freeing. This must be called without holding
+// JfrStacktrace_lock: a reader can be a thread that the sampler has
+// suspended, and the sampler may need the lock before resuming it.
+void JfrStackTraceRepository::free_detached(JfrStackTrace** detached) {
+  GlobalCounter::write_synchronize();
+  for (u4 i = 0; i < TABLE_SIZE; ++i) {
+    JfrStackTrace* stacktrace = detached[i];
+    while (stacktrace != NULL) {
+      JfrStackTrace* next = const_cast<JfrStackTrace*>(stacktrace->next());
+      delete stacktrace;
+      stacktrace = next;
+    }
+  }
+  FREE_C_HEAP_ARRAY(JfrStackTrace*, detached);
+}
+
 size_t JfrStackTraceRepository::write(JfrChunkWriter& sw, bool clear) {
   if (_entries == 0) {
     return 0;
   }
-  MutexLockerEx lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
-  assert(_entries > 0, "invariant");
+  JfrStackTrace** detached = NULL;
   int count = 0;
-  for (u4 i = 0; i < TABLE_SIZE; ++i) {
-    JfrStackTrace* stacktrace = _table[i];
-    while (stacktrace != NULL) {
-      JfrStackTrace* next = const_cast<JfrStackTrace*>(stacktrace->next());
-      if (stacktrace->should_write()) {
-        stacktrace->write(sw);
-        ++count;
-      }
-      if (clear) {
-        delete stacktrace;
+  {
+    MutexLockerEx lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
+    assert(_entries > 0, "invariant");
+    for (u4 i = 0; i < TABLE_SIZE; ++i) {
+      const JfrStackTrace* stacktrace = _table[i];
+      while (stacktrace != NULL) {
+        if (stacktrace->should_write()) {
+          stacktrace->write(sw);
+          ++count;
+        }
+        stacktrace = stacktrace->next();
       }
-      stacktrace = next;
     }
+    if (clear) {
+      detached = detach_table();
+      _entries = 0;
+    }
+    _last_entries = _entries;
   }
-  if (clear) {
-    memset(_table, 0, sizeof(_table));
-    _entries = 0;
+  if (detached != NULL) {
+    free_detached(detached);
   }
-  _last_entries = _entries;
   return count;
 }
 
 size_t JfrStackTraceRepository::clear(JfrStackTraceRepository& repo) {
-  MutexLockerEx lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
-  if (repo._entries == 0) {
-    return 0;
-  }
-  for (u4 i = 0; i < TABLE_SIZE; ++i) {
-    JfrStackTrace* stacktrace = repo._table[i];
-    while (stacktrace != NULL) {
-      JfrStackTrace* next = const_cast<JfrStackTrace*>(stacktrace->next());
-      delete stacktrace;
-      stacktrace = next;
+  JfrStackTrace** detached = NULL;
+  size_t processed = 0;
+  {
+    MutexLockerEx lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
+    if (repo._entries == 0) {
+      return 0;
     }
+    detached = repo.detach_table();
+    processed = repo._entries;
+    repo._entries = 0;
+    repo._last_entries = 0;
   }
-  memset(repo._table, 0, sizeof(repo._table));
-  const size_t processed = repo._entries;
-  repo._entries = 0;
-  repo._last_entries = 0;
+  free_detached(detached);
   return processed;
 }
 
@@ -198,8 +226,22 @@ void JfrStackTraceRepository::record_for_leak_profiler(JavaThread* thread, int s
 }
 
 traceid JfrStackTraceRepository::add_trace(const JfrStackTrace& stacktrace) {
-  MutexLockerEx lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
   const size_t index = stacktrace._hash % TABLE_SIZE;
+  {
+    // Most traces recorded at a high rate are already in the table. Entries
+    // are immutable once published and only freed after a GlobalCounter
+    // synchronization, so a hit can be found without taking the lock.
+    GlobalCounter::CriticalSection cs(Thread::current());
+    const JfrStackTrace* table_entry = OrderAccess::load_acquire(&_table[index]);
+    while (table_entry != NULL) {
+      if (table_entry->equals(stacktrace)) {
+        return table_entry->id();
+      }
+      table_entry = table_entry->next();
+    }
+  }
+
+  MutexLockerEx lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
   const JfrStackTrace* table_entry = _table[index];
 
   while (table_entry != NULL) {
@@ -214,7 +256,7 @@ traceid JfrStackTraceRepository::add_trace(const JfrStackTrace& stacktrace) {
   }
 
   traceid id = ++_next_id;
-  _table[index] = new JfrStackTrace(id, stacktrace, _table[index]);
+  OrderAccess::release_store(&_table[index], new JfrStackTrace(id, stacktrace, _table[index]));
   ++_entries;
   return id;
 }
@@ -56,6 +56,8 @@ class JfrStackTraceRepository : public JfrCHeapObj {
   static void destroy();
 
   bool is_modified() const;
+  JfrStackTrace** detach_table();
+  static void free_detached(JfrStackTrace** detached);
   static size_t clear();
   static size_t clear(JfrStackTraceRepository& repo);
   size_t write(JfrChunkWriter& cw, bool clear);
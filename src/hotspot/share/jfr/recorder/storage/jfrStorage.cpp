@@ -38,8 +38,10 @@
 #include "jfr/writers/jfrNativeEventWriter.hpp"
 #include "logging/log.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/orderAccess.hpp"
 #include "runtime/os.inline.hpp"
+#include "runtime/perfData.hpp"
 #include "runtime/safepoint.hpp"
 #include "runtime/thread.hpp"
 
@@ -99,6 +101,26 @@ static const size_t thread_local_cache_count = 8;
 static const size_t thread_local_scavenge_threshold = thread_local_cache_count / 2;
 static const size_t transient_buffer_size_multiplier = 8; // against thread local buffer size
 
+// Bytes of event data that never reached a chunk, exported as PerfData
+static PerfCounter* _lost_bytes = NULL;      // thread-local data without a promotion buffer
+static PerfCounter* _discarded_bytes = NULL; // full global buffers discarded to free memory
+
+static void create_perf_counters() {
+  if (UsePerfData && _lost_bytes == NULL) {
+    EXCEPTION_MARK;
+    _lost_bytes = PerfDataManager::create_counter(SUN_RT, "jfrLostBytes",
+                                                  PerfData::U_Bytes, CHECK);
+    _discarded_bytes = PerfDataManager::create_counter(SUN_RT, "jfrDiscardedBytes",
+                                                       PerfData::U_Bytes, CHECK);
+  }
+}
+
+static void add_to_perf_counter(PerfCounter* counter, size_t bytes) {
+  if (counter != NULL) {
+    Atomic::add((jlong)bytes, (volatile jlong*)counter->get_address());
+  }
+}
+
 template <typename Mspace>
 static Mspace* create_mspace(size_t buffer_size, size_t limit, size_t cache_count, JfrStorage* storage_instance) {
   Mspace* mspace = new Mspace(buffer_size, limit, cache_count, storage_instance);
@@ -115,6 +137,8 @@ bool JfrStorage::initialize() {
   assert(_transient_mspace == NULL, "invariant");
   assert(_age_mspace == NULL, "invariant");
 
+  create_perf_counters();
+
   const size_t num_global_buffers = (size_t)JfrOptionSet::num_global_buffers();
   assert(num_global_buffers >= in_memory_discard_threshold_delta, "invariant");
   const size_t memory_size = (size_t)JfrOptionSet::memory_size();
@@ -238,6 +262,7 @@ static void write_data_loss(BufferPtr buffer, Thread* thread) {
   if (unflushed_size == 0) {
     return;
   }
+  add_to_perf_counter(_lost_bytes, unflushed_size);
   write_data_loss_event(buffer, unflushed_size, thread);
 }
 
@@ -406,6 +431,7 @@ void JfrStorage::discard_oldest(Thread* thread) {
   if (JfrBuffer_lock->try_lock()) {
     if (!control().should_discard()) {
       // another thread handled it
+      JfrBuffer_lock->unlock();
       return;
     }
     const size_t num_full_pre_discard = control().full_count();
@@ -434,6 +460,7 @@ void JfrStorage::discard_oldest(Thread* thread) {
     JfrBuffer_lock->unlock();
     const size_t number_of_discards = num_full_pre_discard - num_full_post_discard;
     if (number_of_discards > 0) {
+      add_to_perf_counter(_discarded_bytes, discarded_size);
       log_discard(number_of_discards, discarded_size, num_full_post_discard);
     }
   }
@@ -25,10 +25,12 @@
 #include "precompiled.hpp"
 #include "jfr/leakprofiler/leakProfiler.hpp"
 #include "jfr/support/jfrAllocationTracer.hpp"
+#include "jfr/support/jfrObjectAllocationSample.hpp"
 #include "jfr/support/jfrThreadLocal.hpp"
 #include "runtime/thread.hpp"
 
-JfrAllocationTracer::JfrAllocationTracer(HeapWord* obj, size_t alloc_size, Thread* thread) {
+JfrAllocationTracer::JfrAllocationTracer(const Klass* klass, HeapWord* obj, size_t alloc_size, Thread* thread) {
+  JfrObjectAllocationSample::send_event(klass, thread);
   if (LeakProfiler::is_running()) {
     assert(thread->is_Java_thread(), "invariant");
     LeakProfiler::sample(obj, alloc_size, (JavaThread*)thread);
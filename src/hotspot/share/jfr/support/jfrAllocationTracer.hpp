@@ -27,9 +27,11 @@
 
 #include "memory/allocation.hpp"
 
+class Klass;
+
 class JfrAllocationTracer : public StackObj {
  public:
-  JfrAllocationTracer(HeapWord* obj, size_t alloc_size, Thread* thread);
+  JfrAllocationTracer(const Klass* klass, HeapWord* obj, size_t alloc_size, Thread* thread);
 };
 
 #endif // SHARE_VM_JFR_SUPPORT_JFRALLOCATIONTRACER_HPP
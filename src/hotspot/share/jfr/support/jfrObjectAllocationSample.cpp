@@ -0,0 +1,73 @@
+/*
+* Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+* DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+*
+* This code is free software; you can redistribute it and/or modify it
+* under the terms of the GNU General Public License version 2 only, as
+* published by the Free Software Foundation.
+*
+* This code is distributed in the hope that it will be useful, but WITHOUT
+* ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+* FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+* version 2 for more details (a copy is included in the LICENSE file that
+* accompanied this code).
+*
+* You should have received a copy of the GNU General Public License version
+* 2 along with this work; if not, write to the Free Software Foundation,
+* Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+*
+* Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+* or visit www.oracle.com if you need additional information or have any
+* questions.
+*
+*/
+
+#include "precompiled.hpp"
+#include "jfr/jfrEvents.hpp"
+#include "jfr/support/jfrObjectAllocationSample.hpp"
+#include "jfr/support/jfrThreadLocal.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/os.hpp"
+#include "runtime/thread.inline.hpp"
+
+// The rate is enforced per window of this length, spreading the samples
+// of a second over its windows instead of spending them all at once.
+static const jlong window_nanos = NANOSECS_PER_SEC / 10;
+
+static volatile jlong _window_start = 0;
+static volatile jint _window_samples = 0;
+
+static bool throttle() {
+  if (JfrObjectAllocationSampleRate == 0) {
+    return false;
+  }
+  const jint samples_per_window = (jint)MAX2((uintx)1, JfrObjectAllocationSampleRate / 10);
+  const jlong now = os::javaTimeNanos();
+  const jlong start = Atomic::load(&_window_start);
+  if (now - start >= window_nanos && Atomic::cmpxchg(now, &_window_start, start) == start) {
+    // This thread opened a new window
+    Atomic::store((jint)0, &_window_samples);
+  }
+  return Atomic::add((jint)1, &_window_samples) > samples_per_window;
+}
+
+void JfrObjectAllocationSample::send_event(const Klass* klass, Thread* thread) {
+  if (!EventObjectAllocationSample::is_enabled() || !thread->is_Java_thread()) {
+    return;
+  }
+  JfrThreadLocal* const tl = thread->jfr_thread_local();
+  const jlong allocated_bytes = thread->cooked_allocated_bytes();
+  // An object allocated outside a TLAB is already included in the
+  // allocated bytes, an object starting a new TLAB is in the TLAB's used part.
+  const jlong weight = allocated_bytes - tl->last_allocated_bytes();
+  if (weight <= 0 || throttle()) {
+    return;
+  }
+  EventObjectAllocationSample event;
+  if (event.should_commit()) {
+    tl->set_last_allocated_bytes(allocated_bytes);
+    event.set_objectClass(klass);
+    event.set_weight(weight);
+    event.commit();
+  }
+}
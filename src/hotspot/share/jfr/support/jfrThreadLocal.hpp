@@ -47,6 +47,7 @@ class JfrThreadLocal {
   jlong _user_time;
   jlong _cpu_time;
   jlong _wallclock_time;
+  jlong _last_allocated_bytes;
   unsigned int _stack_trace_hash;
   mutable u4 _stackdepth;
   volatile jint _entering_suspend_flag;
@@ -196,6 +197,14 @@ class JfrThreadLocal {
     _wallclock_time = wallclock_time;
   }
 
+  jlong last_allocated_bytes() const {
+    return _last_allocated_bytes;
+  }
+
+  void set_last_allocated_bytes(jlong allocated_bytes) {
+    _last_allocated_bytes = allocated_bytes;
+  }
+
   traceid trace_id() const {
     return _trace_id;
   }
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+#include "precompiled.hpp"
+#include "logging/log.hpp"
+#include "logging/logAsyncWriter.hpp"
+#include "logging/logFileOutput.hpp"
+#include "memory/allocation.inline.hpp"
+#include "runtime/orderAccess.hpp"
+#include "runtime/os.hpp"
+
+AsyncLogWriter* volatile AsyncLogWriter::_instance = NULL;
+
+AsyncLogMessage* AsyncLogMessage::create(LogFileOutput* output, const LogDecorations& decorations, const char* msg) {
+  size_t len = strlen(msg);
+  size_t size = sizeof(AsyncLogMessage) + len + 1;
+  char* mem = NEW_C_HEAP_ARRAY_RETURN_NULL(char, size, mtLogging);
+  if (mem == NULL) {
+    return NULL;
+  }
+  AsyncLogMessage* m = ::new (mem) AsyncLogMessage(output, decorations, size);
+  memcpy(m->message(), msg, len + 1);
+  return m;
+}
+
+void AsyncLogMessage::destroy(AsyncLogMessage* m) {
+  m->~AsyncLogMessage();
+  FREE_C_HEAP_ARRAY(char, m);
+}
+
+AsyncLogWriter::AsyncLogWriter() :
+  _lock(1),
+  _io_lock(1),
+  _sem(0),
+  _head(NULL),
+  _tail(NULL),
+  _buffer_size(0),
+  _buffer_max_size(AsyncLogBufferSize),
+  _dropped_count(0),
+  _dropped(new (ResourceObj::C_HEAP, mtLogging) DroppedMessages()) {
+}
+
+AsyncLogWriter* AsyncLogWriter::instance() {
+  return OrderAccess::load_acquire(&_instance);
+}
+
+void AsyncLogWriter::initialize() {
+  if (!AsyncLogging) {
+    return;
+  }
+  assert(_instance == NULL, "initialize only once");
+  AsyncLogWriter* writer = new AsyncLogWriter();
+  if (os::create_thread(writer, os::os_thread)) {
+    os::start_thread(writer);
+    // From now on, messages to file outputs are handed to the writer
+    OrderAccess::release_store(&_instance, writer);
+    log_debug(logging, thread)("Async logging enabled, buffer size " SIZE_FORMAT "B", AsyncLogBufferSize);
+  } else {
+    log_warning(logging, thread)("Failed to create the asynchronous log writer thread, logging synchronously");
+  }
+}
+
+void AsyncLogWriter::enqueue_locked(LogFileOutput* output, const LogDecorations& decorations, const char* msg) {
+  size_t size = sizeof(AsyncLogMessage) + strlen(msg) + 1;
+  AsyncLogMessage* m = NULL;
+  if (_buffer_size + size <= _buffer_max_size) {
+    m = AsyncLogMessage::create(output, decorations, msg);
+  }
+  if (m == NULL) {
+    // The buffer is full (or out of memory): drop the message but remember
+    // that we did, so the loss is visible in the log itself.
+    uint32_t* counter = _dropped->get(output);
+    if (counter == NULL) {
+      _dropped->put(output, 1);
+    } else {
+      (*counter)++;
+    }
+    _dropped_count++;
+    return;
+  }
+  if (_tail == NULL) {
+    _head = m;
+  } else {
+    _tail->_next = m;
+  }
+  _tail = m;
+  _buffer_size += m->_size;
+}
+
+void AsyncLogWriter::enqueue(LogFileOutput* output, const LogDecorations& decorations, const char* msg) {
+  _lock.wait();
+  enqueue_locked(output, decorations, msg);
+  _lock.signal();
+  _sem.signal();
+}
+
+// The lines of a LogMessage are enqueued under one lock acquisition so
+// that they stay together in the output.
+void AsyncLogWriter::enqueue(LogFileOutput* output, LogMessageBuffer::Iterator msg_iterator) {
+  _lock.wait();
+  for (; !msg_iterator.is_at_end(); msg_iterator++) {
+    enqueue_locked(output, msg_iterator.decorations(), msg_iterator.message());
+  }
+  _lock.signal();
+  _sem.signal();
+}
+
+class AsyncLogDropReporter : public StackObj {
+ public:
+  bool do_entry(LogFileOutput* const& output, uint32_t const& count) {
+    LogDecorations decorations(LogLevel::Warning, LogTagSetMapping<LogTag::_logging>::tagset(),
+                               output->decorators());
+    char buf[64];
+    jio_snprintf(buf, sizeof(buf), UINT32_FORMAT " messages dropped due to async logging", count);
+    output->write_blocking(decorations, buf);
+    return true;
+  }
+};
+
+void AsyncLogWriter::write() {
+  // Holding _io_lock across detaching and writing makes flush() wait for
+  // messages that this thread has already taken off the queue.
+  _io_lock.wait();
+
+  _lock.wait();
+  AsyncLogMessage* m = _head;
+  _head = NULL;
+  _tail = NULL;
+  _buffer_size = 0;
+  DroppedMessages* dropped = NULL;
+  if (_dropped_count > 0) {
+    dropped = _dropped;
+    _dropped = new (ResourceObj::C_HEAP, mtLogging) DroppedMessages();
+    _dropped_count = 0;
+  }
+  _lock.signal();
+
+  while (m != NULL) {
+    AsyncLogMessage* next = m->_next;
+    m->_output->write_blocking(m->_decorations, m->message());
+    AsyncLogMessage::destroy(m);
+    m = next;
+  }
+
+  if (dropped != NULL) {
+    AsyncLogDropReporter reporter;
+    dropped->iterate(&reporter);
+    delete dropped;
+  }
+
+  _io_lock.signal();
+}
+
+void AsyncLogWriter::run() {
+  while (true) {
+    _sem.wait();
+    write();
+  }
+}
+
+void AsyncLogWriter::flush() {
+  AsyncLogWriter* writer = instance();
+  if (writer != NULL) {
+    writer->write();
+  }
+}
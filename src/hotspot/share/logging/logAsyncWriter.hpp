@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+#ifndef SHARE_VM_LOGGING_LOGASYNCWRITER_HPP
+#define SHARE_VM_LOGGING_LOGASYNCWRITER_HPP
+
+#include "logging/logDecorations.hpp"
+#include "logging/logMessageBuffer.hpp"
+#include "runtime/semaphore.hpp"
+#include "runtime/thread.hpp"
+#include "utilities/resourceHash.hpp"
+
+class LogFileOutput;
+
+// A log message waiting to be written by the AsyncLogWriter. The message
+// text is stored inline, directly after the node, so that enqueueing a
+// message costs a single C-heap allocation.
+class AsyncLogMessage {
+  friend class AsyncLogWriter;
+ private:
+  AsyncLogMessage* _next;
+  LogFileOutput*   _output;
+  LogDecorations   _decorations;
+  size_t           _size;       // total size of the allocation, including the text
+
+  AsyncLogMessage(LogFileOutput* output, const LogDecorations& decorations, size_t size)
+    : _next(NULL), _output(output), _decorations(decorations), _size(size) {}
+
+  char* message() { return (char*)(this + 1); }
+
+  static AsyncLogMessage* create(LogFileOutput* output, const LogDecorations& decorations, const char* msg);
+  static void destroy(AsyncLogMessage* m);
+};
+
+// Asynchronous writer for file log outputs (-XX:+AsyncLogging).
+//
+// Threads that log to a file copy the decorated message into a bounded
+// in-memory queue and return without doing any I/O. A dedicated thread
+// drains the queue and performs the actual writes, including file
+// rotation. The queue lock is only held to link or unlink messages, so
+// a stalled disk never blocks a logging thread, for example during a
+// GC pause or safepoint.
+//
+// When the queue holds AsyncLogBufferSize bytes, new messages are dropped
+// and counted per output. The number of dropped messages is written to
+// the affected output the next time the queue is drained.
+//
+// Outputs to stdout and stderr are always written synchronously.
+class AsyncLogWriter : public NonJavaThread {
+  typedef ResourceHashtable<LogFileOutput*, uint32_t,
+                            primitive_hash<LogFileOutput*>,
+                            primitive_equals<LogFileOutput*>,
+                            17, ResourceObj::C_HEAP, mtLogging> DroppedMessages;
+
+  static AsyncLogWriter* volatile _instance;
+
+  // Protects the message queue and the drop counters. A Semaphore is used
+  // rather than a Mutex since logging can happen from any thread and
+  // while holding locks of any rank.
+  Semaphore _lock;
+  // Serializes draining the queue, so that flush() returns only after
+  // every message enqueued before the call has been written.
+  Semaphore _io_lock;
+  // Signalled when messages are enqueued.
+  Semaphore _sem;
+
+  AsyncLogMessage* _head;
+  AsyncLogMessage* _tail;
+  size_t           _buffer_size;    // bytes currently queued
+  const size_t     _buffer_max_size;
+  uint32_t         _dropped_count;  // messages dropped since the last drain
+  DroppedMessages* _dropped;
+
+  AsyncLogWriter();
+
+  void enqueue_locked(LogFileOutput* output, const LogDecorations& decorations, const char* msg);
+  void write();
+
+ protected:
+  virtual void run();
+
+ public:
+  void enqueue(LogFileOutput* output, const LogDecorations& decorations, const char* msg);
+  void enqueue(LogFileOutput* output, LogMessageBuffer::Iterator msg_iterator);
+
+  // Returns the writer, or NULL if asynchronous logging is not in use.
+  static AsyncLogWriter* instance();
+
+  // Creates and starts the writer thread if AsyncLogging is enabled.
+  static void initialize();
+
+  // Writes out all messages enqueued so far and waits until they have
+  // been written. Must be called before a LogFileOutput is deleted.
+  static void flush();
+
+  char* name() const { return (char*)"AsyncLog Thread"; }
+};
+
+#endif // SHARE_VM_LOGGING_LOGASYNCWRITER_HPP
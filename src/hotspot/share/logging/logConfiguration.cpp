@@ -24,6 +24,7 @@
 #include "precompiled.hpp"
 #include "jvm.h"
 #include "logging/log.hpp"
+#include "logging/logAsyncWriter.hpp"
 #include "logging/logConfiguration.hpp"
 #include "logging/logDecorations.hpp"
 #include "logging/logDecorators.hpp"
@@ -207,19 +208,23 @@ void LogConfiguration::delete_output(size_t idx) {
          "idx must be in range 1 < idx < _n_outputs, but idx = " SIZE_FORMAT
          " and _n_outputs = " SIZE_FORMAT, idx, _n_outputs);
   LogOutput* output = _outputs[idx];
+  // Messages for the output may still be queued for asynchronous writing
+  AsyncLogWriter::flush();
   // Swap places with the last output and shrink the array
   _outputs[idx] = _outputs[--_n_outputs];
   _outputs = REALLOC_C_HEAP_ARRAY(LogOutput*, _outputs, _n_outputs, mtLogging);
   delete output;
 }
 
-void LogConfiguration::configure_output(size_t idx, const LogSelectionList& selections, const LogDecorators& decorators) {
+void LogConfiguration::configure_output(size_t idx, const LogSelectionList& selections, const LogDecorators& requested_decorators) {
   assert(ConfigurationLock::current_thread_has_lock(), "Must hold configuration lock to call this function.");
   assert(idx < _n_outputs, "Invalid index, idx = " SIZE_FORMAT " and _n_outputs = " SIZE_FORMAT, idx, _n_outputs);
   LogOutput* output = _outputs[idx];
 
   output->_reconfigured = true;
 
+  const LogDecorators& decorators = output->writes_decorations() ? requested_decorators : LogDecorators::None;
+
   size_t on_level[LogLevel::Count] = {0};
 
   bool enabled = false;
@@ -478,6 +483,8 @@ void LogConfiguration::describe_available(outputStream* out) {
   LogTagSet::describe_tagsets(out);
 }
 
+static const size_t TagSetLabelBufferSize = 128;
+
 void LogConfiguration::describe_current_configuration(outputStream* out) {
   out->print_cr("Log output configuration:");
   for (size_t i = 0; i < _n_outputs; i++) {
@@ -490,10 +497,70 @@ void LogConfiguration::describe_current_configuration(outputStream* out) {
   }
 }
 
+bool LogConfiguration::configure_throttling(const char* what,
+                                            size_t rate_limit,
+                                            size_t sample_rate,
+                                            outputStream* errstream) {
+  assert(errstream != NULL, "errstream can not be NULL");
+  if (what == NULL || strlen(what) == 0) {
+    errstream->print_cr("Rate limiting and sampling require a tag selection ('what').");
+    return false;
+  }
+
+  ConfigurationLock cl;
+  LogSelectionList selections;
+  if (!selections.parse(what, errstream)) {
+    return false;
+  }
+
+  size_t configured = 0;
+  for (LogTagSet* ts = LogTagSet::first(); ts != NULL; ts = ts->next()) {
+    if (selections.level_for(*ts) == LogLevel::NotMentioned) {
+      continue;
+    }
+    if (rate_limit != SIZE_MAX) {
+      ts->set_rate_limit(rate_limit);
+    }
+    if (sample_rate != SIZE_MAX) {
+      ts->set_sample_rate(sample_rate);
+    }
+    configured++;
+  }
+  if (configured == 0) {
+    errstream->print_cr("No tag set matches '%s'.", what);
+    return false;
+  }
+  return true;
+}
+
+void LogConfiguration::describe_throttling(outputStream* out) {
+  bool printed_header = false;
+  for (LogTagSet* ts = LogTagSet::first(); ts != NULL; ts = ts->next()) {
+    if (ts->rate_limit() == 0 && ts->sample_rate() <= 1 && ts->suppressed() == 0) {
+      continue;
+    }
+    if (!printed_header) {
+      out->print_cr("Log rate limits:");
+      printed_header = true;
+    }
+    char buf[TagSetLabelBufferSize];
+    ts->label(buf, sizeof(buf), "+");
+    out->print(" %s:", buf);
+    if (ts->rate_limit() != 0) {
+      out->print(" at most " SIZE_FORMAT "/s,", ts->rate_limit());
+    }
+    if (ts->sample_rate() > 1) {
+      out->print(" 1 in " SIZE_FORMAT " sampled,", ts->sample_rate());
+    }
+    out->print_cr(" " SIZE_FORMAT " suppressed", ts->suppressed());
+  }
+}
+
 void LogConfiguration::describe(outputStream* out) {
   describe_available(out);
   ConfigurationLock cl;
   describe_current_configuration(out);
+  describe_throttling(out);
 }
 
 void LogConfiguration::print_command_line_help(outputStream* out) {
@@ -536,6 +603,9 @@ void LogConfiguration::print_command_line_help(outputStream* out) {
   out->print_cr("   filecount=.. - Number of files to keep in rotation (not counting the active file)."
                                     " If set to 0, log rotation is disabled."
                                     " This will cause existing log files to be overwritten.");
+  out->print_cr("   format=..    - 'text' (default) or 'binary'. Binary files record uptime, level and tags"
+                                    " for every message without formatting decorations, and are read with the"
+                                    " LogDecoder tool in src/utils/LogDecoder.");
   out->cr();
 
   out->print_cr("Some examples:");
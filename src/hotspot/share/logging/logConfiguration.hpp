@@ -84,6 +84,7 @@ class LogConfiguration : public AllStatic {
   // Respectively describe the built-in and runtime dependent portions of the configuration.
   static void describe_available(outputStream* out);
   static void describe_current_configuration(outputStream* out);
+  static void describe_throttling(outputStream* out);
 
 
  public:
@@ -115,6 +116,15 @@ class LogConfiguration : public AllStatic {
                                   const char* output_options,
                                   outputStream* errstream);
 
+  // Limits logging on the tagsets selected by 'what' (same syntax as -Xlog selections,
+  // levels are ignored) to rate_limit messages per second and/or one in sample_rate
+  // messages. A value of 0 removes the respective limit; SIZE_MAX leaves it unchanged.
+  // Warning and error messages are never suppressed.
+  static bool configure_throttling(const char* what,
+                                   size_t rate_limit,
+                                   size_t sample_rate,
+                                   outputStream* errstream);
+
   // Prints log configuration to outputStream, used by JCmd/MBean.
   static void describe(outputStream* out);
 
@@ -33,10 +33,25 @@ jlong LogDecorations::_vm_start_time_millis = 0;
 const char* LogDecorations::_host_name = "";
 
 LogDecorations::LogDecorations(LogLevelType level, const LogTagSet &tagset, const LogDecorators &decorators)
-    : _level(level), _tagset(tagset), _millis(-1) {
+    : _level(level), _tagset(tagset), _millis(-1), _elapsed_counter(os::elapsed_counter()) {
   create_decorations(decorators);
 }
 
+// The decoration offsets point into the decorations buffer, so they must
+// be rebased onto the copied buffer.
+LogDecorations::LogDecorations(const LogDecorations& other)
+    : _level(other._level), _tagset(other._tagset), _millis(other._millis),
+      _elapsed_counter(other._elapsed_counter) {
+  memcpy(_decorations_buffer, other._decorations_buffer, sizeof(_decorations_buffer));
+  for (uint i = 0; i < LogDecorators::Count; i++) {
+    if (other._decoration_offset[i] == NULL) {
+      _decoration_offset[i] = NULL;
+    } else {
+      _decoration_offset[i] = _decorations_buffer + (other._decoration_offset[i] - other._decorations_buffer);
+    }
+  }
+}
+
 void LogDecorations::initialize(jlong vm_start_time) {
   char buffer[1024];
   if (os::get_host_name(buffer, sizeof(buffer))){
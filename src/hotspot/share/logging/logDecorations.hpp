@@ -37,6 +37,7 @@ class LogDecorations {
   LogLevelType _level;
   const LogTagSet& _tagset;
   jlong _millis;
+  jlong _elapsed_counter;
   static jlong _vm_start_time_millis;
   static const char* _host_name;
 
@@ -51,11 +52,25 @@ class LogDecorations {
   static void initialize(jlong vm_start_time);
 
   LogDecorations(LogLevelType level, const LogTagSet& tagset, const LogDecorators& decorators);
+  LogDecorations(const LogDecorations& other);
 
   void set_level(LogLevelType level) {
     _level = level;
   }
 
+  LogLevelType level() const {
+    return _level;
+  }
+
+  const LogTagSet& tagset() const {
+    return _tagset;
+  }
+
+  // The value of os::elapsed_counter() when the decorations were created
+  jlong elapsed_counter() const {
+    return _elapsed_counter;
+  }
+
   const char* decoration(LogDecorators::Decorator decorator) const {
     if (decorator == LogDecorators::level_decorator) {
       return LogLevel::name(_level);
@@ -35,7 +35,11 @@ LogDiagnosticCommand::LogDiagnosticCommand(outputStream* output, bool heap_alloc
     _decorators("decorators", "Configures which decorators to use. Use 'none' or an empty value to remove all.", "STRING", false),
     _disable("disable", "Turns off all logging and clears the log configuration.", "BOOLEAN", false),
     _list("list", "Lists current log configuration.", "BOOLEAN", false),
-    _rotate("rotate", "Rotates all logs.", "BOOLEAN", false) {
+    _rotate("rotate", "Rotates all logs.", "BOOLEAN", false),
+    _ratelimit("ratelimit", "Limits the tags selected with 'what' to this many messages per second "
+               "below warning level. 0 removes the limit.", "INT", false),
+    _sample("sample", "Logs only one in this many messages below warning level for the tags "
+            "selected with 'what'. 0 or 1 logs all messages.", "INT", false) {
   _dcmdparser.add_dcmd_option(&_output);
   _dcmdparser.add_dcmd_option(&_output_options);
   _dcmdparser.add_dcmd_option(&_what);
@@ -43,6 +47,8 @@ LogDiagnosticCommand::LogDiagnosticCommand(outputStream* output, bool heap_alloc
   _dcmdparser.add_dcmd_option(&_disable);
   _dcmdparser.add_dcmd_option(&_list);
   _dcmdparser.add_dcmd_option(&_rotate);
+  _dcmdparser.add_dcmd_option(&_ratelimit);
+  _dcmdparser.add_dcmd_option(&_sample);
 }
 
 int LogDiagnosticCommand::num_arguments() {
@@ -68,7 +74,23 @@ void LogDiagnosticCommand::execute(DCmdSource source, TRAPS) {
     any_command = true;
   }
 
-  if (_output.has_value() || _what.has_value() || _decorators.has_value()) {
+  const bool throttling = _ratelimit.has_value() || _sample.has_value();
+  if (throttling) {
+    if ((_ratelimit.has_value() && _ratelimit.value() < 0) ||
+        (_sample.has_value() && _sample.value() < 0)) {
+      output()->print_cr("The values of ratelimit and sample must not be negative.");
+      return;
+    }
+    if (!LogConfiguration::configure_throttling(_what.value(),
+                                                _ratelimit.has_value() ? (size_t)_ratelimit.value() : SIZE_MAX,
+                                                _sample.has_value() ? (size_t)_sample.value() : SIZE_MAX,
+                                                output())) {
+      return;
+    }
+    any_command = true;
+  }
+
+  if (_output.has_value() || (_what.has_value() && !throttling) || _decorators.has_value()) {
     if (!LogConfiguration::parse_log_arguments(_output.value(),
                                                _what.value(),
                                                _decorators.value(),
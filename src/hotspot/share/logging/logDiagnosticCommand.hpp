@@ -35,6 +35,9 @@
 // Specifying 'disable' will disable logging completely.
 // The remaining arguments are used to set a log output to log everything
 // with the specified tags and levels using the given decorators.
+// With 'ratelimit' and/or 'sample', 'what' instead selects the tag sets
+// whose messages are limited, and no output is configured unless 'output'
+// is also given.
 class LogDiagnosticCommand : public DCmdWithParser {
  protected:
   DCmdArgument<char *> _output;
@@ -44,6 +47,8 @@ class LogDiagnosticCommand : public DCmdWithParser {
   DCmdArgument<bool> _disable;
   DCmdArgument<bool> _list;
   DCmdArgument<bool> _rotate;
+  DCmdArgument<jlong> _ratelimit;
+  DCmdArgument<jlong> _sample;
 
  public:
   LogDiagnosticCommand(outputStream* output, bool heap_allocated);
@@ -24,8 +24,10 @@
 #include "precompiled.hpp"
 #include "jvm.h"
 #include "logging/log.hpp"
+#include "logging/logAsyncWriter.hpp"
 #include "logging/logConfiguration.hpp"
 #include "logging/logFileOutput.hpp"
+#include "logging/logTagSet.hpp"
 #include "memory/allocation.inline.hpp"
 #include "runtime/arguments.hpp"
 #include "runtime/os.inline.hpp"
@@ -34,19 +36,23 @@
 
 const char* const LogFileOutput::Prefix = "file=";
 const char* const LogFileOutput::FileOpenMode = "a";
+const char* const LogFileOutput::BinaryFileOpenMode = "ab";
 const char* const LogFileOutput::PidFilenamePlaceholder = "%p";
 const char* const LogFileOutput::TimestampFilenamePlaceholder = "%t";
 const char* const LogFileOutput::TimestampFormat = "%Y-%m-%d_%H-%M-%S";
 const char* const LogFileOutput::FileSizeOptionKey = "filesize";
 const char* const LogFileOutput::FileCountOptionKey = "filecount";
+const char* const LogFileOutput::FormatOptionKey = "format";
 char        LogFileOutput::_pid_str[PidBufferSize];
 char        LogFileOutput::_vm_start_time_str[StartTimeBufferSize];
+jlong       LogFileOutput::_vm_start_time = 0;
 
 LogFileOutput::LogFileOutput(const char* name)
     : LogFileStreamOutput(NULL), _name(os::strdup_check_oom(name, mtLogging)),
       _file_name(NULL), _archive_name(NULL), _archive_name_len(0),
       _rotate_size(DefaultFileSize), _file_count(DefaultFileCount), _is_default_file_count(true),
-      _current_size(0), _current_file(0), _rotation_semaphore(1) {
+      _current_size(0), _current_file(0), _rotation_semaphore(1),
+      _binary(false), _tagset_defined(NULL), _last_uptime_nanos(0) {
   assert(strstr(name, Prefix) == name, "invalid output name '%s': missing prefix: %s", name, Prefix);
   _file_name = make_file_name(name + strlen(Prefix), _pid_str, _vm_start_time_str);
 }
@@ -55,6 +61,8 @@ void LogFileOutput::set_file_name_parameters(jlong vm_start_time) {
   int res = jio_snprintf(_pid_str, sizeof(_pid_str), "%d", os::current_process_id());
   assert(res > 0, "PID buffer too small");
 
+  _vm_start_time = vm_start_time;
+
   struct tm local_time;
   time_t utc_time = vm_start_time / 1000;
   os::localtime_pd(&utc_time, &local_time);
@@ -69,6 +77,7 @@ LogFileOutput::~LogFileOutput() {
                   _file_name, os::strerror(errno));
     }
   }
+  FREE_C_HEAP_ARRAY(bool, _tagset_defined);
   os::free(_archive_name);
   os::free(_file_name);
   os::free(const_cast<char*>(_name));
@@ -207,6 +216,16 @@ bool LogFileOutput::parse_options(const char* options, outputStream* errstream)
         break;
       }
       _rotate_size = static_cast<size_t>(value);
+    } else if (strcmp(FormatOptionKey, key) == 0) {
+      if (strcmp(value_str, "binary") == 0) {
+        _binary = true;
+      } else if (strcmp(value_str, "text") == 0) {
+        _binary = false;
+      } else {
+        errstream->print_cr("Invalid option: %s must be 'text' or 'binary'", FormatOptionKey);
+        success = false;
+        break;
+      }
     } else {
       errstream->print_cr("Invalid option '%s' for log file output.", key);
       success = false;
@@ -260,7 +279,7 @@ bool LogFileOutput::initialize(const char* options, outputStream* errstream) {
     increment_file_count();
   }
 
-  _stream = os::fopen(_file_name, FileOpenMode);
+  _stream = os::fopen(_file_name, _binary ? BinaryFileOpenMode : FileOpenMode);
   if (_stream == NULL) {
     errstream->print_cr("Error opening log file '%s': %s",
                         _file_name, strerror(errno));
@@ -272,17 +291,22 @@ bool LogFileOutput::initialize(const char* options, outputStream* errstream) {
     os::ftruncate(os::get_fileno(_stream), 0);
   }
 
+  if (_binary) {
+    _tagset_defined = NEW_C_HEAP_ARRAY(bool, LogTagSet::ntagsets(), mtLogging);
+    begin_binary_file();
+  }
+
   return true;
 }
 
-int LogFileOutput::write(const LogDecorations& decorations, const char* msg) {
+int LogFileOutput::write_blocking(const LogDecorations& decorations, const char* msg) {
   if (_stream == NULL) {
     // An error has occurred with this output, avoid writing to it.
     return 0;
   }
 
   _rotation_semaphore.wait();
-  int written = LogFileStreamOutput::write(decorations, msg);
+  int written = _binary ? write_binary(decorations, msg) : LogFileStreamOutput::write(decorations, msg);
   _current_size += written;
 
   if (should_rotate()) {
@@ -293,14 +317,42 @@ int LogFileOutput::write(const LogDecorations& decorations, const char* msg) {
   return written;
 }
 
+int LogFileOutput::write(const LogDecorations& decorations, const char* msg) {
+  if (_stream == NULL) {
+    // An error has occurred with this output, avoid writing to it.
+    return 0;
+  }
+
+  AsyncLogWriter* aio_writer = AsyncLogWriter::instance();
+  if (aio_writer != NULL) {
+    aio_writer->enqueue(this, decorations, msg);
+    return 0;
+  }
+
+  return write_blocking(decorations, msg);
+}
+
 int LogFileOutput::write(LogMessageBuffer::Iterator msg_iterator) {
   if (_stream == NULL) {
     // An error has occurred with this output, avoid writing to it.
     return 0;
   }
 
+  AsyncLogWriter* aio_writer = AsyncLogWriter::instance();
+  if (aio_writer != NULL) {
+    aio_writer->enqueue(this, msg_iterator);
+    return 0;
+  }
+
   _rotation_semaphore.wait();
-  int written = LogFileStreamOutput::write(msg_iterator);
+  int written = 0;
+  if (_binary) {
+    for (; !msg_iterator.is_at_end(); msg_iterator++) {
+      written += write_binary(msg_iterator.decorations(), msg_iterator.message());
+    }
+  } else {
+    written = LogFileStreamOutput::write(msg_iterator);
+  }
   _current_size += written;
 
   if (should_rotate()) {
@@ -311,6 +363,101 @@ int LogFileOutput::write(LogMessageBuffer::Iterator msg_iterator) {
   return written;
 }
 
+// The binary format (format=binary) avoids formatting decorations for
+// every message. A file starts with the magic "HSLOGBIN", a format version
+// byte, and the VM pid and start time (ms since the epoch) as varints. The
+// records that follow are:
+//
+//   TagSetRecord:  0x01, varint id, varint length, label ("gc,phases")
+//   MessageRecord: 0x02, zigzag varint uptime delta in ns from the previous
+//                  message record in the file, level byte, varint tagset id,
+//                  varint length, message bytes
+//
+// Varints are unsigned LEB128. A tagset record precedes the first message
+// with that tagset in each file. The decoder in src/utils/LogDecoder turns
+// a file back into the default text format.
+static const char BinaryLogMagic[] = { 'H', 'S', 'L', 'O', 'G', 'B', 'I', 'N' };
+static const u1 BinaryLogVersion = 1;
+static const u1 BinaryLogTagSetRecord = 1;
+static const u1 BinaryLogMessageRecord = 2;
+static const size_t MaxVarintSize = 10;
+
+static u1* put_varint(u1* pos, julong value) {
+  while (value >= 0x80) {
+    *pos++ = (u1)(value | 0x80);
+    value >>= 7;
+  }
+  *pos++ = (u1)value;
+  return pos;
+}
+
+static julong zigzag(jlong value) {
+  return ((julong)value << 1) ^ (julong)(value >> 63);
+}
+
+static jlong elapsed_counter_to_nanos(jlong counter) {
+  return (jlong)((double)counter * (NANOSECS_PER_SEC / (double)os::elapsed_frequency()));
+}
+
+void LogFileOutput::begin_binary_file() {
+  u1 buf[sizeof(BinaryLogMagic) + 1 + 2 * MaxVarintSize];
+  memcpy(buf, BinaryLogMagic, sizeof(BinaryLogMagic));
+  u1* pos = buf + sizeof(BinaryLogMagic);
+  *pos++ = BinaryLogVersion;
+  pos = put_varint(pos, (julong)os::current_process_id());
+  pos = put_varint(pos, (julong)_vm_start_time);
+  size_t len = pos - buf;
+  if (fwrite(buf, 1, len, _stream) == len) {
+    _current_size += len;
+  }
+  fflush(_stream);
+
+  for (size_t i = 0; i < LogTagSet::ntagsets(); i++) {
+    _tagset_defined[i] = false;
+  }
+  _last_uptime_nanos = 0;
+}
+
+int LogFileOutput::write_binary(const LogDecorations& decorations, const char* msg) {
+  const LogTagSet& tagset = decorations.tagset();
+  const size_t id = tagset.id();
+  assert(id < LogTagSet::ntagsets(), "invalid tagset id " SIZE_FORMAT, id);
+  int written = 0;
+
+  os::flockfile(_stream);
+  if (!_tagset_defined[id]) {
+    char label[LogTag::MaxTags * 32];
+    int label_len = tagset.label(label, sizeof(label));
+    if (label_len > 0) {
+      u1 header[1 + 2 * MaxVarintSize];
+      u1* pos = header;
+      *pos++ = BinaryLogTagSetRecord;
+      pos = put_varint(pos, id);
+      pos = put_varint(pos, (julong)label_len);
+      written += (int)fwrite(header, 1, pos - header, _stream);
+      written += (int)fwrite(label, 1, label_len, _stream);
+      _tagset_defined[id] = true;
+    }
+  }
+
+  const jlong uptime_nanos = elapsed_counter_to_nanos(decorations.elapsed_counter());
+  const size_t msg_len = strlen(msg);
+  u1 header[2 + 3 * MaxVarintSize];
+  u1* pos = header;
+  *pos++ = BinaryLogMessageRecord;
+  pos = put_varint(pos, zigzag(uptime_nanos - _last_uptime_nanos));
+  *pos++ = (u1)decorations.level();
+  pos = put_varint(pos, id);
+  pos = put_varint(pos, msg_len);
+  written += (int)fwrite(header, 1, pos - header, _stream);
+  written += (int)fwrite(msg, 1, msg_len, _stream);
+  _last_uptime_nanos = uptime_nanos;
+  fflush(_stream);
+  os::funlockfile(_stream);
+
+  return written;
+}
+
 void LogFileOutput::archive() {
   assert(_archive_name != NULL && _archive_name_len > 0, "Rotation must be configured before using this function.");
   int ret = jio_snprintf(_archive_name, _archive_name_len, "%s.%0*u",
@@ -349,7 +496,7 @@ void LogFileOutput::rotate() {
   archive();
 
   // Open the active log file using the same stream as before
-  _stream = os::fopen(_file_name, FileOpenMode);
+  _stream = os::fopen(_file_name, _binary ? BinaryFileOpenMode : FileOpenMode);
   if (_stream == NULL) {
     jio_fprintf(defaultStream::error_stream(), "Could not reopen file '%s' during log rotation (%s).\n",
                 _file_name, os::strerror(errno));
@@ -359,6 +506,10 @@ void LogFileOutput::rotate() {
   // Reset accumulated size, increase current file counter, and check for file count wrap-around.
   _current_size = 0;
   increment_file_count();
+
+  if (_binary) {
+    begin_binary_file();
+  }
 }
 
 char* LogFileOutput::make_file_name(const char* file_name,
@@ -451,4 +602,7 @@ void LogFileOutput::describe(outputStream *out) {
   out->print("filecount=%u,filesize=" SIZE_FORMAT "%s", _file_count,
              byte_size_in_proper_unit(_rotate_size),
              proper_unit_for_byte_size(_rotate_size));
+  if (_binary) {
+    out->print(",format=binary");
+  }
 }
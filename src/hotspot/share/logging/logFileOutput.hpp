@@ -32,10 +32,14 @@ class LogDecorations;
 
 // The log file output, with support for file rotation based on a target size.
 class LogFileOutput : public LogFileStreamOutput {
+  friend class AsyncLogWriter;
+  friend class AsyncLogDropReporter;
  private:
   static const char* const FileOpenMode;
+  static const char* const BinaryFileOpenMode;
   static const char* const FileCountOptionKey;
   static const char* const FileSizeOptionKey;
+  static const char* const FormatOptionKey;
   static const char* const PidFilenamePlaceholder;
   static const char* const TimestampFilenamePlaceholder;
   static const char* const TimestampFormat;
@@ -46,6 +50,7 @@ class LogFileOutput : public LogFileStreamOutput {
   static const uint   MaxRotationFileCount = 1000;
   static char         _pid_str[PidBufferSize];
   static char         _vm_start_time_str[StartTimeBufferSize];
+  static jlong        _vm_start_time;
 
   const char* _name;
   char* _file_name;
@@ -63,11 +68,23 @@ class LogFileOutput : public LogFileStreamOutput {
   // Semaphore used for synchronizing file rotations and writes
   Semaphore _rotation_semaphore;
 
+  // State of the binary format (format=binary), protected by _rotation_semaphore.
+  // Each file starts with a header and defines a tagset the first time a
+  // message is logged on it, so every rotated file can be decoded on its own.
+  bool   _binary;
+  bool*  _tagset_defined;
+  jlong  _last_uptime_nanos;
+
+  void begin_binary_file();
+  int write_binary(const LogDecorations& decorations, const char* msg);
+
   void archive();
   void rotate();
   bool parse_options(const char* options, outputStream* errstream);
   char *make_file_name(const char* file_name, const char* pid_string, const char* timestamp_string);
 
+  int write_blocking(const LogDecorations& decorations, const char* msg);
+
   bool should_rotate() {
     return _file_count > 0 && _rotate_size > 0 && _current_size >= _rotate_size;
   }
@@ -88,6 +105,10 @@ class LogFileOutput : public LogFileStreamOutput {
   virtual void force_rotate();
   virtual void describe(outputStream* out);
 
+  virtual bool writes_decorations() const {
+    return !_binary;
+  }
+
   virtual const char* name() const {
     return _name;
   }
@@ -95,6 +95,13 @@ class LogOutput : public CHeapObj<mtLogging> {
 
   virtual void describe(outputStream *out);
 
+  // Outputs that do not print decorations (such as binary file outputs)
+  // should return false, so that tagsets logging only to them do not
+  // need to format any.
+  virtual bool writes_decorations() const {
+    return true;
+  }
+
   virtual const char* name() const = 0;
   virtual bool initialize(const char* options, outputStream* errstream) = 0;
   virtual int write(const LogDecorations& decorations, const char* msg) = 0;
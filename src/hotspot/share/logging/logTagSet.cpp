@@ -32,6 +32,8 @@
 #include "logging/logTagSet.hpp"
 #include "logging/logTagSetDescriptions.hpp"
 #include "memory/allocation.inline.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/os.hpp"
 #include "utilities/ostream.hpp"
 
 LogTagSet*  LogTagSet::_list      = NULL;
@@ -40,7 +42,9 @@ size_t      LogTagSet::_ntagsets  = 0;
 // This constructor is called only during static initialization.
 // See the declaration in logTagSet.hpp for more information.
 LogTagSet::LogTagSet(PrefixWriter prefix_writer, LogTagType t0, LogTagType t1, LogTagType t2, LogTagType t3, LogTagType t4)
-    : _next(_list), _write_prefix(prefix_writer) {
+    : _next(_list), _write_prefix(prefix_writer),
+      _rate_limit(0), _sample_rate(0), _sample_count(0),
+      _rate_window(0), _rate_window_count(0), _suppressed(0) {
   _tag[0] = t0;
   _tag[1] = t1;
   _tag[2] = t2;
@@ -49,7 +53,7 @@ LogTagSet::LogTagSet(PrefixWriter prefix_writer, LogTagType t0, LogTagType t1, L
   for (_ntags = 0; _ntags < LogTag::MaxTags && _tag[_ntags] != LogTag::__NO_TAG; _ntags++) {
   }
   _list = this;
-  _ntagsets++;
+  _id = _ntagsets++;
 
   // Set the default output to warning and error level for all new tagsets.
   _output_list.set_output_level(&StdoutLog, LogLevel::Default);
@@ -80,6 +84,9 @@ void LogTagSet::log(LogLevelType level, const char* msg) {
 }
 
 void LogTagSet::log(const LogMessageBuffer& msg) {
+  if (is_throttled() && should_suppress(msg.least_detailed_level())) {
+    return;
+  }
   LogDecorations decorations(LogLevel::Invalid, *this, _decorators);
   for (LogOutputList::Iterator it = _output_list.iterator(msg.least_detailed_level()); it != _output_list.end(); it++) {
     (*it)->write(msg.iterator(it.level(), decorations));
@@ -109,8 +116,41 @@ void LogTagSet::write(LogLevelType level, const char* fmt, ...) {
 
 const size_t vwrite_buffer_size = 512;
 
+// Called before a message is formatted, so that suppressed messages cost
+// no more than a few atomic updates.
+bool LogTagSet::should_suppress(LogLevelType level) {
+  if (level >= LogLevel::Warning) {
+    return false;
+  }
+
+  const size_t sample_rate = _sample_rate;
+  if (sample_rate > 1 && Atomic::add((size_t)1, &_sample_count) % sample_rate != 0) {
+    Atomic::inc(&_suppressed);
+    return true;
+  }
+
+  const size_t rate_limit = _rate_limit;
+  if (rate_limit != 0) {
+    const jlong now = os::javaTimeNanos() / NANOSECS_PER_SEC;
+    const jlong window = _rate_window;
+    if (window != now && Atomic::cmpxchg(now, &_rate_window, window) == window) {
+      // First message in a new second. Racing increments of the old
+      // window may be lost, which only makes the limit slightly lenient.
+      _rate_window_count = 0;
+    }
+    if (Atomic::add((size_t)1, &_rate_window_count) > rate_limit) {
+      Atomic::inc(&_suppressed);
+      return true;
+    }
+  }
+  return false;
+}
+
 void LogTagSet::vwrite(LogLevelType level, const char* fmt, va_list args) {
   assert(level >= LogLevel::First && level <= LogLevel::Last, "Log level:%d is incorrect", level);
+  if (is_throttled() && should_suppress(level)) {
+    return;
+  }
   char buf[vwrite_buffer_size];
   va_list saved_args;           // For re-format on buf overflow.
   va_copy(saved_args, args);
@@ -42,6 +42,7 @@ class LogTagSet {
   static size_t _ntagsets;
 
   LogTagSet* const _next;
+  size_t _id;
   size_t _ntags;
   LogTagType _tag[LogTag::MaxTags];
 
@@ -51,6 +52,20 @@ class LogTagSet {
   typedef size_t (*PrefixWriter)(char* buf, size_t size);
   PrefixWriter _write_prefix;
 
+  // Rate limiting and sampling, configured at runtime with VM.log.
+  // Only messages below warning level are subject to them.
+  volatile size_t _rate_limit;          // max messages per second, 0 if unlimited
+  volatile size_t _sample_rate;         // log one in this many messages, 0 or 1 for all
+  volatile size_t _sample_count;
+  volatile jlong  _rate_window;         // the second the current rate window belongs to
+  volatile size_t _rate_window_count;
+  volatile size_t _suppressed;          // messages dropped by the limits
+
+  bool is_throttled() const {
+    return _rate_limit != 0 || _sample_rate > 1;
+  }
+  bool should_suppress(LogLevelType level);
+
   // Keep constructor private to prevent incorrect instantiations of this class.
   // Only LogTagSetMappings can create/contain instances of this class.
   // The constructor links all tagsets together in a global list of tagsets.
@@ -77,6 +92,11 @@ class LogTagSet {
     return _next;
   }
 
+  // A small integer that uniquely identifies this tagset, in [0, ntagsets())
+  size_t id() const {
+    return _id;
+  }
+
   size_t ntags() const {
     return _ntags;
   }
@@ -106,6 +126,26 @@ class LogTagSet {
   // of its current outputs combined with the given decorators.
   void update_decorators(const LogDecorators& decorator = LogDecorators::None);
 
+  void set_rate_limit(size_t messages_per_second) {
+    _rate_limit = messages_per_second;
+  }
+
+  void set_sample_rate(size_t one_in_n) {
+    _sample_rate = one_in_n;
+  }
+
+  size_t rate_limit() const {
+    return _rate_limit;
+  }
+
+  size_t sample_rate() const {
+    return _sample_rate;
+  }
+
+  size_t suppressed() const {
+    return _suppressed;
+  }
+
   int label(char *buf, size_t len, const char* separator = ",") const;
   bool has_output(const LogOutput* output);
 
@@ -52,6 +52,9 @@ class ChunkPool: public CHeapObj<mtInternal> {
   static ChunkPool* _small_pool;
   static ChunkPool* _tiny_pool;
 
+  // Pools for the size classes of chunks bigger than Chunk::size
+  static ChunkPool* _big_pools[Chunk::num_big_sizes];
+
   // return first element or null
   void* get_first() {
     Chunk* c = _first;
@@ -131,19 +134,37 @@ class ChunkPool: public CHeapObj<mtInternal> {
   static ChunkPool* small_pool()  { assert(_small_pool  != NULL, "must be initialized"); return _small_pool;  }
   static ChunkPool* tiny_pool()   { assert(_tiny_pool   != NULL, "must be initialized"); return _tiny_pool;   }
 
+  // Returns the pool for a chunk bigger than Chunk::size, or NULL if the
+  // length is not one of the big size classes.
+  static ChunkPool* big_pool(size_t length) {
+    for (int i = 0; i < Chunk::num_big_sizes; i++) {
+      if (length == Chunk::big_size(i)) {
+        assert(_big_pools[i] != NULL, "must be initialized");
+        return _big_pools[i];
+      }
+    }
+    return NULL;
+  }
+
   static void initialize() {
     _large_pool  = new ChunkPool(Chunk::size        + Chunk::aligned_overhead_size());
     _medium_pool = new ChunkPool(Chunk::medium_size + Chunk::aligned_overhead_size());
     _small_pool  = new ChunkPool(Chunk::init_size   + Chunk::aligned_overhead_size());
     _tiny_pool   = new ChunkPool(Chunk::tiny_size   + Chunk::aligned_overhead_size());
+    for (int i = 0; i < Chunk::num_big_sizes; i++) {
+      _big_pools[i] = new ChunkPool(Chunk::big_size(i) + Chunk::aligned_overhead_size());
+    }
   }
 
   static void clean() {
-    enum { BlocksToKeep = 5 };
+    enum { BlocksToKeep = 5, BigBlocksToKeep = 1 };
      _tiny_pool->free_all_but(BlocksToKeep);
      _small_pool->free_all_but(BlocksToKeep);
      _medium_pool->free_all_but(BlocksToKeep);
      _large_pool->free_all_but(BlocksToKeep);
+     for (int i = 0; i < Chunk::num_big_sizes; i++) {
+       _big_pools[i]->free_all_but(BigBlocksToKeep);
+     }
   }
 };
 
@@ -151,6 +172,7 @@ ChunkPool* ChunkPool::_large_pool  = NULL;
 ChunkPool* ChunkPool::_medium_pool = NULL;
 ChunkPool* ChunkPool::_small_pool  = NULL;
 ChunkPool* ChunkPool::_tiny_pool   = NULL;
+ChunkPool* ChunkPool::_big_pools[Chunk::num_big_sizes] = { NULL };
 
 void chunkpool_init() {
   ChunkPool::initialize();
@@ -192,6 +214,10 @@ void* Chunk::operator new (size_t requested_size, AllocFailType alloc_failmode,
    case Chunk::init_size:   return ChunkPool::small_pool()->allocate(bytes, alloc_failmode);
    case Chunk::tiny_size:   return ChunkPool::tiny_pool()->allocate(bytes, alloc_failmode);
    default: {
+     ChunkPool* pool = ChunkPool::big_pool(length);
+     if (pool != NULL) {
+       return pool->allocate(bytes, alloc_failmode);
+     }
      void* p = os::malloc(bytes, mtChunk, CALLER_PC);
      if (p == NULL && alloc_failmode == AllocFailStrategy::EXIT_OOM) {
        vm_exit_out_of_memory(bytes, OOM_MALLOC_ERROR, "Chunk::new");
@@ -208,12 +234,23 @@ void Chunk::operator delete(void* p) {
    case Chunk::medium_size: ChunkPool::medium_pool()->free(c); break;
    case Chunk::init_size:   ChunkPool::small_pool()->free(c); break;
    case Chunk::tiny_size:   ChunkPool::tiny_pool()->free(c); break;
-   default:
+   default: {
+     ChunkPool* pool = ChunkPool::big_pool(c->length());
+     if (pool != NULL) {
+       pool->free(c);
+       break;
+     }
      ThreadCritical tc;  // Free chunks under TC lock so that NMT adjustment is stable.
      os::free(c);
+   }
   }
 }
 
+size_t Chunk::big_size(int i) {
+  assert(i >= 0 && i < num_big_sizes, "invalid size class");
+  return (((size_t)64*K) << i) - slack;
+}
+
 Chunk::Chunk(size_t length) : _len(length) {
   _next = NULL;         // Chain on the linked list
 }
@@ -353,6 +390,16 @@ void Arena::signal_out_of_memory(size_t sz, const char* whence) const {
 void* Arena::grow(size_t x, AllocFailType alloc_failmode) {
   // Get minimal required size.  Either real big, or even bigger for giant objs
   size_t len = MAX2(x, (size_t) Chunk::size);
+  if (len > Chunk::size) {
+    // Round up to a pooled size class, so that big chunks of large
+    // compilations are reused instead of malloc'ed and freed every time.
+    for (int i = 0; i < Chunk::num_big_sizes; i++) {
+      if (len <= Chunk::big_size(i)) {
+        len = Chunk::big_size(i);
+        break;
+      }
+    }
+  }
 
   Chunk *k = _chunk;            // Get filled-up chunk address
   _chunk = new (alloc_failmode, len) Chunk(len);
@@ -66,9 +66,13 @@ class Chunk: CHeapObj<mtChunk> {
     init_size  =  1*K  - slack, // Size of first chunk (normal aka small)
     medium_size= 10*K  - slack, // Size of medium-sized chunk
     size       = 32*K  - slack, // Default size of an Arena chunk (following the first)
-    non_pool_size = init_size + 32 // An initial size which is not one of above
+    non_pool_size = init_size + 32, // An initial size which is not one of above
+    num_big_sizes = 3           // Number of pooled size classes above size, see big_size()
   };
 
+  // Pooled size classes for chunks bigger than size: 64K, 128K and 256K less slack
+  static size_t big_size(int i);
+
   void chop();                  // Chop this chunk
   void next_chop();             // Chop next chunk
   static size_t aligned_overhead_size(void) { return ARENA_ALIGN(sizeof(Chunk)); }
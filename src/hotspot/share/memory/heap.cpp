@@ -196,6 +196,8 @@ void CodeHeap::on_code_mapping(char* base, size_t size) {
 #ifdef LINUX
   extern void linux_wrap_code(char* base, size_t size);
   linux_wrap_code(base, size);
+  extern void linux_advise_huge_code(char* base, size_t size);
+  linux_advise_huge_code(base, size);
 #endif
 }
 
@@ -816,7 +816,33 @@ uintx HeapInspection::populate_table(KlassInfoTable* cit, BoolObjectClosure *fil
   return ric.missed_count();
 }
 
-void HeapInspection::heap_inspection(outputStream* st, uint parallel_thread_num) {
+// Scales the counts of a sampled table up to the whole heap.
+class ScaleKlassInfoClosure : public KlassInfoClosure {
+ private:
+  uint _factor;
+ public:
+  ScaleKlassInfoClosure(uint factor) : _factor(factor) {}
+
+  void do_cinfo(KlassInfoEntry* cie) {
+    cie->set_count(cie->count() * _factor);
+    cie->set_words(cie->words() * _factor);
+  }
+};
+
+bool HeapInspection::populate_table_sampled(KlassInfoTable* cit, uint sample_rate, uintx* missed_count) {
+  assert(sample_rate > 1, "invariant");
+  ResourceMark rm;
+  RecordInstanceClosure ric(cit, NULL);
+  if (!Universe::heap()->sampled_object_iterate(&ric, sample_rate)) {
+    return false;
+  }
+  ScaleKlassInfoClosure scale(sample_rate);
+  cit->iterate(&scale);
+  *missed_count = ric.missed_count() * sample_rate;
+  return true;
+}
+
+void HeapInspection::heap_inspection(outputStream* st, uint parallel_thread_num, uint sample_rate) {
   ResourceMark rm;
 
   if (_print_help) {
@@ -840,7 +866,15 @@ void HeapInspection::heap_inspection(outputStream* st, uint parallel_thread_num)
   KlassInfoTable cit(_print_class_stats);
   if (!cit.allocation_failed()) {
     // populate table with object allocation info
-    uintx missed_count = populate_table(&cit, NULL, parallel_thread_num);
+    uintx missed_count = 0;
+    if (sample_rate > 1 && populate_table_sampled(&cit, sample_rate, &missed_count)) {
+      st->print_cr("Approximate histogram, extrapolated from one in %u parts of the heap:", sample_rate);
+    } else {
+      if (sample_rate > 1) {
+        st->print_cr("WARNING: Sampling is not supported by the current collector; inspecting the whole heap");
+      }
+      missed_count = populate_table(&cit, NULL, parallel_thread_num);
+    }
     if (missed_count != 0) {
       st->print_cr("WARNING: Ran out of C-heap; undercounted " UINTX_FORMAT
                    " total instances in data below",
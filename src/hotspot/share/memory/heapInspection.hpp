@@ -363,8 +363,11 @@ class HeapInspection : public StackObj {
                  bool print_class_stats, const char *columns) :
       _csv_format(csv_format), _print_help(print_help),
       _print_class_stats(print_class_stats), _columns(columns) {}
-  void heap_inspection(outputStream* st, uint parallel_thread_num = 1) NOT_SERVICES_RETURN;
+  // A sample_rate above 1 asks for an approximate histogram from about one in
+  // sample_rate parts of the heap, if the collector supports that.
+  void heap_inspection(outputStream* st, uint parallel_thread_num = 1, uint sample_rate = 0) NOT_SERVICES_RETURN;
   uintx populate_table(KlassInfoTable* cit, BoolObjectClosure* filter = NULL, uint parallel_thread_num = 1) NOT_SERVICES_RETURN_(0);
+  bool populate_table_sampled(KlassInfoTable* cit, uint sample_rate, uintx* missed_count) NOT_SERVICES_RETURN_(false);
   static void find_instances_at_safepoint(Klass* k, GrowableArray<oop>* result) NOT_SERVICES_RETURN;
  private:
   void iterate_over_heap(KlassInfoTable* cit, BoolObjectClosure* filter = NULL);
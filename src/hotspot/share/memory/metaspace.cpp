@@ -34,6 +34,7 @@
 #include "memory/metaspace/metachunk.hpp"
 #include "memory/metaspace/metaspaceCommon.hpp"
 #include "memory/metaspace/printCLDMetaspaceInfoClosure.hpp"
+#include "memory/metaspace/smallBlocks.hpp"
 #include "memory/metaspace/spaceManager.hpp"
 #include "memory/metaspace/virtualSpaceList.hpp"
 #include "memory/metaspaceShared.hpp"
@@ -1219,6 +1220,15 @@ void Metaspace::ergo_initialize() {
 
   _commit_alignment  = page_size;
   _reserve_alignment = MAX2(page_size, (size_t)os::vm_allocation_granularity());
+#ifdef LINUX
+  if (MetaspaceUseHugePages && !DumpSharedSpaces) {
+    // Let every virtual space node start on a huge page boundary, so that
+    // whole huge pages fit into it. The archive layout is kept independent
+    // of this setting.
+    extern size_t linux_transparent_huge_page_size();
+    _reserve_alignment = MAX2(_reserve_alignment, linux_transparent_huge_page_size());
+  }
+#endif
 
   // Do not use FLAG_SET_ERGO to update MaxMetaspaceSize, since this will
   // override if MaxMetaspaceSize was set on the command line or not.
@@ -1350,8 +1360,15 @@ MetaWord* Metaspace::allocate(ClassLoaderData* loader_data, size_t word_size,
 
   MetadataType mdtype = (type == MetaspaceObj::ClassType) ? ClassType : NonClassType;
 
-  // Try to allocate metadata.
-  MetaWord* result = loader_data->metaspace_non_null()->allocate(word_size, mdtype);
+  // Try to allocate metadata, from the thread's cache for this loader first.
+  MetaWord* result = NULL;
+  MetaspaceAllocationCache* cache = THREAD->metaspace_allocation_cache();
+  if (cache != NULL && mdtype == NonClassType && cache->loader_data() == loader_data) {
+    result = cache->allocate(word_size);
+  }
+  if (result == NULL) {
+    result = loader_data->metaspace_non_null()->allocate(word_size, mdtype);
+  }
 
   if (result == NULL) {
     tracer()->report_metaspace_allocation_failure(loader_data, word_size, type, mdtype);
@@ -1608,6 +1625,60 @@ void ClassLoaderMetaspace::deallocate(MetaWord* ptr, size_t word_size, bool is_c
   }
 }
 
+MetaspaceAllocationCache::MetaspaceAllocationCache(ClassLoaderData* loader_data, Thread* thread) :
+  _thread(thread), _loader_data(loader_data),
+  _previous(thread->metaspace_allocation_cache()), _top(NULL), _end(NULL) {
+  // The boot, anonymous and reflection metaspaces are sized for few or
+  // small classes, the cache blocks would only waste their chunks.
+  if (MetaspaceAllocationCacheSize >= BytesPerWord && !DumpSharedSpaces &&
+      loader_data->metaspace_non_null()->space_type() == Metaspace::StandardMetaspaceType) {
+    _thread->set_metaspace_allocation_cache(this);
+  }
+}
+
+MetaspaceAllocationCache::~MetaspaceAllocationCache() {
+  retire();
+  if (_thread->metaspace_allocation_cache() == this) {
+    _thread->set_metaspace_allocation_cache(_previous);
+  }
+}
+
+void MetaspaceAllocationCache::retire() {
+  if (_top == NULL) {
+    return;
+  }
+  size_t remaining = pointer_delta(_end, _top, sizeof(MetaWord));
+  // Anything smaller than a Metablock cannot be put on a freelist.
+  if (remaining >= SmallBlocks::small_block_min_size()) {
+    _loader_data->metaspace_non_null()->deallocate(_top, remaining, false);
+  }
+  _top = NULL;
+  _end = NULL;
+}
+
+MetaWord* MetaspaceAllocationCache::allocate(size_t word_size) {
+  ClassLoaderMetaspace* msp = _loader_data->metaspace_non_null();
+  // Use the same rounding as the SpaceManager, so blocks carved from the
+  // cache can be deallocated like any other metadata.
+  size_t raw_word_size = msp->vsm()->get_allocation_word_size(word_size);
+  size_t cache_word_size = msp->vsm()->get_allocation_word_size(MetaspaceAllocationCacheSize / BytesPerWord);
+  if (raw_word_size > cache_word_size / 4) {
+    return NULL;
+  }
+  if (_top == NULL || pointer_delta(_end, _top, sizeof(MetaWord)) < raw_word_size) {
+    retire();
+    MetaWord* block = msp->allocate(cache_word_size, Metaspace::NonClassType);
+    if (block == NULL) {
+      return NULL;
+    }
+    _top = block;
+    _end = block + cache_word_size;
+  }
+  MetaWord* result = _top;
+  _top += raw_word_size;
+  return result;
+}
+
 size_t ClassLoaderMetaspace::class_chunk_size(size_t word_size) {
   assert(Metaspace::using_class_space(), "Has to use class space");
   return class_vsm()->calc_chunk_size(word_size);
@@ -61,6 +61,7 @@ class MetaspaceTracer;
 class MetaWord;
 class Mutex;
 class outputStream;
+class Thread;
 
 class CollectedHeap;
 
@@ -240,6 +241,7 @@ class ClassLoaderMetaspace : public CHeapObj<mtClass> {
   friend class ShenandoahHeap; // For expand_and_allocate()
 #endif
   friend class Metaspace;
+  friend class MetaspaceAllocationCache;
   friend class MetaspaceUtils;
   friend class metaspace::PrintCLDMetaspaceInfoClosure;
   friend class VM_CollectForMetadataAllocation; // For expand_and_allocate()
@@ -301,6 +303,32 @@ class ClassLoaderMetaspace : public CHeapObj<mtClass> {
 
 }; // ClassLoaderMetaspace
 
+// Batches the non-class metadata allocations of one class loader on the
+// current thread, similar to a TLAB. While the cache is installed,
+// Metaspace::allocate bump-allocates from a block taken from the loader's
+// SpaceManager in a single locked allocation, instead of taking the
+// metaspace lock for every object. The unused remainder goes back to the
+// loader's block freelist when the cache goes out of scope, so the scope
+// must keep the loader alive.
+class MetaspaceAllocationCache : public StackObj {
+  Thread* const _thread;
+  ClassLoaderData* const _loader_data;
+  MetaspaceAllocationCache* const _previous;
+  MetaWord* _top;
+  MetaWord* _end;
+
+  void retire();
+
+ public:
+  MetaspaceAllocationCache(ClassLoaderData* loader_data, Thread* thread);
+  ~MetaspaceAllocationCache();
+
+  ClassLoaderData* loader_data() const { return _loader_data; }
+
+  // Returns NULL if the request has to go to the SpaceManager directly.
+  MetaWord* allocate(size_t word_size);
+};
+
 class MetaspaceUtils : AllStatic {
 
   // Spacemanager updates running counters.
@@ -34,6 +34,8 @@
 #include "memory/metaspace/occupancyMap.hpp"
 #include "memory/metaspace/virtualSpaceNode.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "runtime/os.hpp"
+#include "utilities/align.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/ostream.hpp"
@@ -140,6 +142,10 @@ bool ChunkManager::attempt_to_coalesce_around_chunk(Metachunk* chunk, ChunkIndex
   _free_chunks_count -= num_chunks_removed;
   _free_chunks_count ++;
 
+  if (target_chunk_type == MediumIndex) {
+    release_free_chunk_payload(p_new_chunk);
+  }
+
   // VirtualSpaceNode::container_count does not have to be modified:
   // it means "number of active (non-free) chunks", so merging free chunks
   // should not affect that count.
@@ -189,6 +195,23 @@ int ChunkManager::remove_chunks_in_area(MetaWord* p, size_t word_size) {
   return num_removed;
 }
 
+void ChunkManager::release_free_chunk_payload(Metachunk* chunk) {
+  assert_lock_strong(MetaspaceExpand_lock);
+  assert(chunk->is_tagged_free(), "Chunk expected to be free (%p)", chunk);
+  if (!MetaspaceReleaseFreeChunks || (UseLargePages && UseLargePagesInMetaspace)) {
+    return;
+  }
+  const size_t page_size = os::vm_page_size();
+  char* const start = align_up((char*)chunk + page_size, page_size);
+  char* const end = align_down((char*)((MetaWord*)chunk + chunk->word_size()), page_size);
+  if (start >= end) {
+    return;
+  }
+  log_trace(gc, metaspace, freelist)("%s: releasing payload [%p-%p) of free chunk %p.",
+    (is_class() ? "class space" : "metaspace"), start, end, chunk);
+  os::free_memory(start, end - start, page_size);
+}
+
 size_t ChunkManager::free_chunks_total_words() {
   return _free_chunks_total;
 }
@@ -616,6 +639,8 @@ void ChunkManager::return_single_chunk(Metachunk* chunk) {
         }
       }
     }
+  } else {
+    release_free_chunk_payload(chunk);
   }
 
 }
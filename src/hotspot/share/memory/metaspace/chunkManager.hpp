@@ -106,6 +106,11 @@ class ChunkManager : public CHeapObj<mtInternal> {
   // Returns number of chunks removed.
   int remove_chunks_in_area(MetaWord* p, size_t word_size);
 
+  // Returns the memory backing the payload of a free chunk to the OS. The
+  // first page, holding the chunk header and the free list links, is kept.
+  // The memory stays committed and reads as zero when it is touched again.
+  void release_free_chunk_payload(Metachunk* chunk);
+
   // Helper for chunk splitting: given a target chunk size and a larger free chunk,
   // split up the larger chunk into n smaller chunks, at least one of which should be
   // the target chunk of target chunk size. The smaller chunks, including the target
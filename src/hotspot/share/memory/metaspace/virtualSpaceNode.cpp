@@ -475,9 +475,16 @@ bool VirtualSpaceNode::expand_by(size_t min_words, size_t preferred_words) {
   }
 
   size_t commit = MIN2(preferred_bytes, uncommitted);
+  char* const old_high = virtual_space()->high();
   bool result = virtual_space()->expand_by(commit, false);
 
   if (result) {
+#ifdef LINUX
+    if (MetaspaceUseHugePages) {
+      extern void linux_advise_huge_pages(char* base, size_t size);
+      linux_advise_huge_pages(old_high, commit);
+    }
+#endif
     log_trace(gc, metaspace, freelist)("Expanded %s virtual space list node by " SIZE_FORMAT " words.",
         (is_class() ? "class" : "non-class"), commit);
     DEBUG_ONLY(Atomic::inc(&g_internal_statistics.num_committed_space_expanded));
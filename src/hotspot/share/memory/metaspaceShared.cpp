@@ -216,6 +216,7 @@ char* MetaspaceShared::read_only_space_top() {
 
 void MetaspaceShared::initialize_runtime_shared_and_meta_spaces() {
   assert(UseSharedSpaces, "Must be called when UseSharedSpaces is enabled");
+  TraceTime timer("Map shared spaces", TRACETIME_LOG(Info, startuptime));
 
   // If using shared space, open the file that contains the shared space
   // and map in the memory before initializing the rest of metaspace (so
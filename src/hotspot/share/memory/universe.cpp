@@ -36,6 +36,7 @@
 #include "gc/shared/collectedHeap.inline.hpp"
 #include "gc/shared/gcArguments.hpp"
 #include "gc/shared/gcConfig.hpp"
+#include "gc/shared/gcPhaseTimingRecorder.hpp"
 #include "gc/shared/gcTraceTime.inline.hpp"
 #include "interpreter/interpreter.hpp"
 #include "logging/log.hpp"
@@ -1011,6 +1012,7 @@ void universe_post_module_init() {
 
 bool universe_post_init() {
   assert(!is_init_completed(), "Error: initialization not yet completed!");
+  TraceTime timer("Universe post-initialization", TRACETIME_LOG(Info, startuptime));
   Universe::_fully_initialized = true;
   EXCEPTION_MARK;
   { ResourceMark rm;
@@ -1110,6 +1112,8 @@ bool universe_post_init() {
   // ("weak") refs processing infrastructure initialization
   Universe::heap()->post_initialize();
 
+  GCPhaseTimingRecorder::initialize();
+
   MemoryService::add_metaspace_memory_pools();
 
   MemoryService::set_universe_heap(Universe::heap());
@@ -23,6 +23,7 @@
  */
 
 #include "precompiled.hpp"
+#include "gc/shared/pretouchTask.hpp"
 #include "logging/log.hpp"
 #include "memory/resourceArea.hpp"
 #include "memory/virtualspace.hpp"
@@ -806,17 +807,18 @@ bool VirtualSpace::contains(const void* p) const {
   return low() <= (const char*) p && (const char*) p < high();
 }
 
-static void pretouch_expanded_memory(void* start, void* end) {
+static void pretouch_expanded_memory(char* start, char* end, size_t alignment) {
   assert(is_aligned(start, os::vm_page_size()), "Unexpected alignment");
   assert(is_aligned(end,   os::vm_page_size()), "Unexpected alignment");
 
-  os::pretouch_memory(start, end);
+  // The alignment of each part of the space is the page size it is committed with.
+  PretouchTask::pretouch("VirtualSpace PreTouch", start, end, alignment, NULL);
 }
 
 static bool commit_expanded(char* start, size_t size, size_t alignment, bool pre_touch, bool executable) {
   if (os::commit_memory(start, size, alignment, executable)) {
     if (pre_touch || AlwaysPreTouch) {
-      pretouch_expanded_memory(start, start + size);
+      pretouch_expanded_memory(start, start + size, alignment);
     }
     return true;
   }
@@ -334,6 +334,8 @@ void ConstantPool::restore_unshareable_info(TRAPS) {
   assert(is_shared(), "should always be set for shared constant pools");
   assert(_cache != NULL, "constant pool _cache should not be NULL");
 
+  _cache->restore_unshareable_info();
+
   // Only create the new resolved references array if it hasn't been attempted before
   if (resolved_references() != NULL) return;
 
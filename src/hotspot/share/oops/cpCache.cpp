@@ -74,6 +74,42 @@ void ConstantPoolCacheEntry::reinitialize(bool f2_used) {
   }
 }
 
+// An instance field reference between two boot classes resolves the same
+// way in every run that maps the archive: the field offset is fixed by the
+// archived layout, access checks and loader constraints cannot differ, and
+// unlike getstatic/putstatic no class initialization is tied to it. The
+// field holder must be the pool holder or one of its superclasses: those
+// are the archived classes whenever the pool holder itself is loaded from
+// the archive, while any other class may be replaced at runtime, e.g. by a
+// ClassFileLoadHook.
+bool ConstantPoolCacheEntry::can_archive_resolved_field(InstanceKlass* pool_holder) const {
+  if (!ArchiveResolvedFieldReferences || !is_field_entry() || _f1 == NULL) {
+    return false;
+  }
+  if (bytecode_1() != Bytecodes::_getfield && bytecode_2() != Bytecodes::_putfield) {
+    return false;
+  }
+  InstanceKlass* holder = InstanceKlass::cast(f1_as_klass());
+  return pool_holder->class_loader() == NULL &&
+         holder->class_loader() == NULL &&
+         !holder->is_anonymous() &&
+         holder->is_linked() &&
+         pool_holder->is_subclass_of(holder);
+}
+
+// Returns true if the entry kept by can_archive_resolved_field() still
+// refers to a class loaded for the pool holder.
+bool ConstantPoolCacheEntry::is_archived_field_valid(InstanceKlass* pool_holder) const {
+  return pool_holder->is_subclass_of(f1_as_klass());
+}
+
+void ConstantPoolCacheEntry::metaspace_pointers_do(MetaspaceClosure* it) {
+  // Only field entries kept by remove_unshareable_info() have an f1
+  if (is_field_entry() && _f1 != NULL) {
+    it->push((Klass**)&_f1);
+  }
+}
+
 int ConstantPoolCacheEntry::make_flags(TosState state,
                                        int option_bits,
                                        int field_index_or_method_params) {
@@ -723,6 +759,19 @@ void ConstantPoolCache::remove_unshareable_info() {
   walk_entries_for_initialization(/*check_only = */ false);
 }
 
+// Reset the archived field references that no longer resolve to the same
+// field holder, before any code of the pool holder runs.
+void ConstantPoolCache::restore_unshareable_info() {
+  InstanceKlass* ik = constant_pool()->pool_holder();
+  for (int i = 0; i < length(); i++) {
+    ConstantPoolCacheEntry* e = entry_at(i);
+    if (e->is_field_entry() && e->f1_ord() != NULL && !e->is_archived_field_valid(ik)) {
+      log_trace(cds)("Reset resolved field reference %d of %s", i, ik->external_name());
+      e->reinitialize(false);
+    }
+  }
+}
+
 void ConstantPoolCache::walk_entries_for_initialization(bool check_only) {
   assert(DumpSharedSpaces, "sanity");
   // When dumping the archive, we want to clean up the ConstantPoolCache
@@ -769,9 +818,17 @@ void ConstantPoolCache::walk_entries_for_initialization(bool check_only) {
         entry_at(i)->verify_just_initialized(f2_used[i]);
       })
   } else {
+    int kept = 0;
     for (int i=0; i<length(); i++) {
+      if (entry_at(i)->can_archive_resolved_field(ik)) {
+        kept++;
+        continue;
+      }
       entry_at(i)->reinitialize(f2_used[i]);
     }
+    if (kept > 0) {
+      log_trace(cds)("Kept %d resolved field references of %s", kept, ik->external_name());
+    }
   }
 }
 
@@ -846,6 +903,11 @@ void ConstantPoolCache::metaspace_pointers_do(MetaspaceClosure* it) {
   log_trace(cds)("Iter(ConstantPoolCache): %p", this);
   it->push(&_constant_pool);
   it->push(&_reference_map);
+  if (ArchiveResolvedFieldReferences) {
+    for (int i = 0; i < length(); i++) {
+      entry_at(i)->metaspace_pointers_do(it);
+    }
+  }
 }
 
 // Printing
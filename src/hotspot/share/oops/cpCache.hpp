@@ -128,6 +128,7 @@ class PSPromotionManager;
 // source code.  The _indices field with the bytecode must be written last.
 
 class CallInfo;
+class InstanceKlass;
 
 class ConstantPoolCacheEntry {
   friend class VMStructs;
@@ -399,6 +400,9 @@ class ConstantPoolCacheEntry {
 
   void verify_just_initialized(bool f2_used);
   void reinitialize(bool f2_used);
+  bool can_archive_resolved_field(InstanceKlass* pool_holder) const;
+  bool is_archived_field_valid(InstanceKlass* pool_holder) const;
+  void metaspace_pointers_do(MetaspaceClosure* it);
 };
 
 
@@ -463,6 +467,7 @@ class ConstantPoolCache: public MetaspaceObj {
 
   // CDS support
   void remove_unshareable_info();
+  void restore_unshareable_info();
   void verify_just_initialized();
  private:
   void walk_entries_for_initialization(bool check_only);
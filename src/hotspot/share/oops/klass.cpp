@@ -715,6 +715,10 @@ int Klass::atomic_incr_biased_lock_revocation_count() {
   return (int) Atomic::add(1, &_biased_lock_revocation_count);
 }
 
+void Klass::atomic_incr_total_biased_lock_revocation_count() {
+  Atomic::inc(&_total_biased_lock_revocation_count);
+}
+
 // Unless overridden, jvmti_class_status has no flags set.
 jint Klass::jvmti_class_status() const {
   return 0;
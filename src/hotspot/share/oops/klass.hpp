@@ -161,6 +161,7 @@ class Klass : public Metadata {
   jlong    _last_biased_lock_bulk_revocation_time;
   markOop  _prototype_header;   // Used when biased locking is both enabled and disabled for this type
   jint     _biased_lock_revocation_count;
+  jint     _total_biased_lock_revocation_count; // Never reset, for diagnostics
 
   // vtable length
   int _vtable_len;
@@ -656,6 +657,8 @@ protected:
   // Atomically increments biased_lock_revocation_count and returns updated value
   int atomic_incr_biased_lock_revocation_count();
   void set_biased_lock_revocation_count(int val) { _biased_lock_revocation_count = (jint) val; }
+  int  total_biased_lock_revocation_count() const { return (int) _total_biased_lock_revocation_count; }
+  void atomic_incr_total_biased_lock_revocation_count();
   jlong last_biased_lock_bulk_revocation_time() { return _last_biased_lock_bulk_revocation_time; }
   void  set_last_biased_lock_bulk_revocation_time(jlong cur_time) { _last_biased_lock_bulk_revocation_time = cur_time; }
 
@@ -42,6 +42,8 @@ void markOopDesc::print_on(outputStream* st) const {
                 mon->count(), mon->waiters(), mon->recursions(),
                 p2i(mon->owner()));
     }
+  } else if (UseLightweightLocking && is_fast_locked()) {
+    st->print(" fast-locked(" INTPTR_FORMAT ")", value());
   } else if (is_locked()) {
     st->print(" locked(" INTPTR_FORMAT ")->", value());
     if (is_neutral()) {
@@ -268,8 +268,17 @@ class markOopDesc: public oopDesc {
   }
   BasicLock* locker() const {
     assert(has_locker(), "check");
+    assert(!UseLightweightLocking, "fast-locked marks do not point to a BasicLock");
     return (BasicLock*) value();
   }
+  // With UseLightweightLocking a locked mark keeps the hash and age of
+  // the unlocked mark and only has its lock bits cleared.
+  bool is_fast_locked() const {
+    return ((value() & lock_mask_in_place) == locked_value);
+  }
+  markOop set_fast_locked() const {
+    return markOop(value() & ~lock_mask_in_place);
+  }
   bool has_monitor() const {
     return ((value() & monitor_value) != 0);
   }
@@ -279,6 +288,10 @@ class markOopDesc: public oopDesc {
     return (ObjectMonitor*) (value() ^ monitor_value);
   }
   bool has_displaced_mark_helper() const {
+    if (UseLightweightLocking) {
+      // Fast-locked marks are not displaced, only monitors are
+      return ((value() & lock_mask_in_place) == monitor_value);
+    }
     return ((value() & unlocked_value) == 0);
   }
   markOop displaced_mark_helper() const {
@@ -127,7 +127,9 @@ bool oopDesc::is_oop(oop obj, bool ignore_mark_word) {
   // at a safepoint, it must not be null.
   // Outside of a safepoint, the header could be changing (for example,
   // another thread could be inflating a lock on this object).
-  if (ignore_mark_word) {
+  // With UseLightweightLocking a fast-locked object without a hash
+  // and with age 0 has a NULL mark, at a safepoint too.
+  if (ignore_mark_word || UseLightweightLocking) {
     return true;
   }
   if (obj->mark_raw() != NULL) {
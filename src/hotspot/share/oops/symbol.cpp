@@ -33,6 +33,7 @@
 #include "memory/resourceArea.hpp"
 #include "oops/symbol.hpp"
 #include "runtime/atomic.hpp"
+#include "runtime/mutexLocker.hpp"
 #include "runtime/os.hpp"
 #include "runtime/signature.hpp"
 
@@ -56,9 +57,48 @@ Symbol::Symbol(const u1* name, int length, int refcount) {
   }
 }
 
+// Freed C-heap symbols are kept on free lists indexed by their size in
+// words and handed out again for new symbols of the same size. Class loader
+// churn creates and frees many short-lived symbols of similar sizes, and
+// reusing their blocks keeps that churn away from the C-heap allocator.
+static const int max_recycled_symbol_size = 32;
+static void* _symbol_free_list[max_recycled_symbol_size + 1];
+static volatile uintx _symbol_free_list_count = 0;
+
+static void* allocate_recycled_symbol(int word_size) {
+  if (word_size > max_recycled_symbol_size || _symbol_free_list_count == 0) {
+    return NULL;
+  }
+  MutexLockerEx ml(SymbolFreeList_lock, Mutex::_no_safepoint_check_flag);
+  void* res = _symbol_free_list[word_size];
+  if (res != NULL) {
+    _symbol_free_list[word_size] = *(void**)res;
+    _symbol_free_list_count--;
+  }
+  return res;
+}
+
+static bool recycle_symbol(void* p, int word_size) {
+  if (word_size > max_recycled_symbol_size ||
+      _symbol_free_list_count >= SymbolFreeListLimit) {
+    return false;
+  }
+  MutexLockerEx ml(SymbolFreeList_lock, Mutex::_no_safepoint_check_flag);
+  if (_symbol_free_list_count >= SymbolFreeListLimit) {
+    return false;
+  }
+  *(void**)p = _symbol_free_list[word_size];
+  _symbol_free_list[word_size] = p;
+  _symbol_free_list_count++;
+  return true;
+}
+
 void* Symbol::operator new(size_t sz, int len, TRAPS) throw() {
   int alloc_size = size(len)*wordSize;
-  address res = (address) AllocateHeap(alloc_size, mtSymbol);
+  address res = (address) allocate_recycled_symbol(size(len));
+  if (res == NULL) {
+    res = (address) AllocateHeap(alloc_size, mtSymbol);
+  }
   return res;
 }
 
@@ -70,7 +110,9 @@ void* Symbol::operator new(size_t sz, int len, Arena* arena, TRAPS) throw() {
 
 void Symbol::operator delete(void *p) {
   assert(((Symbol*)p)->refcount() == 0, "should not call this");
-  FreeHeap(p);
+  if (!recycle_symbol(p, ((Symbol*)p)->size())) {
+    FreeHeap(p);
+  }
 }
 
 // ------------------------------------------------------------------
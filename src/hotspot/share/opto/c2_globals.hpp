@@ -244,6 +244,11 @@
   develop(bool, OptoCoalesce, true,                                         \
           "Use Conservative Copy Coalescing in the Register Allocator")     \
                                                                             \
+  product(uintx, ConservativeCoalesceLiveRangeLimit, 0,                     \
+          "Skip conservative copy coalescing in the register allocator "    \
+          "for methods with more live ranges than this. 0 means no limit")  \
+          range(0, max_juint)                                               \
+                                                                            \
   develop(bool, UseUniqueSubclasses, true,                                  \
           "Narrow an abstract reference to the unique concrete subclass")   \
                                                                             \
@@ -308,6 +313,10 @@
   product(bool, PartialPeelLoop, true,                                      \
           "Partial peel (rotate) loops")                                    \
                                                                             \
+  product(bool, OptimizeSearchLoops, false,                                 \
+          "Start counted loops that search a byte[] for a constant "        \
+          "at the first match found by a vectorized search")                \
+                                                                            \
   product(intx, PartialPeelNewPhiDelta, 0,                                  \
           "Additional phis that can be created by partial peeling")         \
           range(0, max_jint)                                                \
@@ -396,6 +405,15 @@
   product(bool, UseOnlyInlinedBimorphic, true,                              \
           "Don't use BimorphicInlining if can't inline a second method")    \
                                                                             \
+  product(bool, UsePolymorphicInlining, false,                              \
+          "Profiling based inlining of up to four receivers at megamorphic "\
+          "call sites, with a virtual call for the other receivers")        \
+                                                                            \
+  product(intx, TypeProfilePolymorphicPercent, 90,                          \
+          "Percentage of the calls the receivers inlined by "               \
+          "UsePolymorphicInlining must cover")                              \
+          range(0, 100)                                                     \
+                                                                            \
   product(bool, InsertMemBarAfterArraycopy, true,                           \
           "Insert memory barrier after arraycopy call")                     \
                                                                             \
@@ -416,6 +434,17 @@
           "Set level of loop optimization for tier 1 compiles")             \
           range(5, 43)                                                      \
                                                                             \
+  product(intx, ReducedOptimizationQueueLength, 0,                          \
+          "Compile with fewer loop optimizations while the C2 compile "     \
+          "queue holds more than this many tasks, and compile again with "  \
+          "all optimizations once it drains. 0 disables")                   \
+          range(0, max_jint)                                                \
+                                                                            \
+  product(intx, ReducedOptimizationLoopOptsCount, 2,                        \
+          "Rounds of loop optimization in a reduced optimization "          \
+          "compilation")                                                    \
+          range(0, 43)                                                      \
+                                                                            \
   /* controls for heat-based inlining */                                    \
                                                                             \
   develop(intx, NodeCountInliningCutoff, 18000,                             \
@@ -494,6 +523,15 @@
   product(bool, EliminateNestedLocks, true,                                 \
           "Eliminate nested locks of the same object when possible")        \
                                                                             \
+  product(bool, LoopLockCoarsening, false,                                  \
+          "Unroll counted loops that lock a loop invariant object so "      \
+          "that the locks of adjacent iterations are coarsened")            \
+                                                                            \
+  product(intx, LoopLockCoarseningChunk, 4,                                 \
+          "Maximum number of loop iterations covered by a lock region "     \
+          "coarsened by LoopLockCoarsening, at most LoopMaxUnroll")         \
+          range(2, 64)                                                      \
+                                                                            \
   notproduct(bool, PrintLockStatistics, false,                              \
           "Print precise statistics on the dynamic lock usage")             \
                                                                             \
@@ -538,6 +576,14 @@
   product(bool, EliminateAllocations, true,                                 \
           "Use escape analysis to eliminate allocations")                   \
                                                                             \
+  experimental(bool, SpeculativeEscapeAnalysis, false,                      \
+          "Replace rarely executed calls through which an allocation "      \
+          "escapes with uncommon traps to allow its scalar replacement")    \
+                                                                            \
+  experimental(bool, ReduceAllocationMerges, false,                         \
+          "Split field loads through Phis merging allocations to allow "    \
+          "their scalar replacement")                                       \
+                                                                            \
   notproduct(bool, PrintEliminateAllocations, false,                        \
           "Print out when allocations are eliminated")                      \
                                                                             \
@@ -545,6 +591,10 @@
           "Array size (number of elements) limit for scalar replacement")   \
           range(0, max_jint)                                                \
                                                                             \
+  product(bool, CoalesceAllocations, false,                                 \
+          "Bump the TLAB once for an allocation and the instance "          \
+          "allocation that immediately follows it")                         \
+                                                                            \
   product(bool, OptimizePtrCompare, true,                                   \
           "Use escape analysis to optimize pointers compare")               \
                                                                             \
@@ -728,6 +778,10 @@
   diagnostic(bool, UseMontgomerySquareIntrinsic, false,                     \
           "Enables intrinsification of BigInteger.montgomerySquare()")      \
                                                                             \
+  diagnostic(bool, UseVectorSupportIntrinsics, true,                        \
+          "Enables intrinsification of the explicit SIMD operations of "    \
+          "jdk.internal.misc.VectorSupport")                                \
+                                                                            \
   product(bool, UseTypeSpeculation, true,                                   \
           "Speculatively propagate types from profiles")                    \
                                                                             \
@@ -758,6 +812,10 @@
           "Loop with fewer iterations are not strip mined")                 \
           range(0, max_juint)                                               \
                                                                             \
+  experimental(bool, UseLongLoopNest, false,                                \
+          "Transform loops with a long induction variable into a nest "     \
+          "of an outer long loop and an inner int counted loop")            \
+                                                                            \
   product(bool, UseProfiledLoopPredicate, true,                             \
           "move predicates out of loops based on profiling data")           \
 
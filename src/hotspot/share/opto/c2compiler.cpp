@@ -23,6 +23,7 @@
  */
 
 #include "precompiled.hpp"
+#include "compiler/compileBroker.hpp"
 #include "jfr/support/jfrIntrinsics.hpp"
 #include "opto/c2compiler.hpp"
 #include "opto/compile.hpp"
@@ -164,6 +165,13 @@ void C2Compiler::compile_method(ciEnv* env, ciMethod* target, int entry_bci, Dir
       }
     }
 
+    if (C.failure_reason() == NULL && C.is_reduced_optimization() &&
+        env->task() != NULL && env->task()->code() != NULL) {
+      // Have the method compiled again with all optimizations once the
+      // compile queue has drained.
+      CompileBroker::defer_reoptimization(env->task()->code());
+    }
+
     // print inlining for last compilation only
     C.dump_print_inlining();
 
@@ -646,6 +654,13 @@ bool C2Compiler::is_intrinsic_supported(const methodHandle& method, bool is_virt
   case vmIntrinsics::_montgomeryMultiply:
   case vmIntrinsics::_montgomerySquare:
   case vmIntrinsics::_vectorizedMismatch:
+  case vmIntrinsics::_hashCodeL:
+  case vmIntrinsics::_hashCodeI:
+  case vmIntrinsics::_VectorSupport_laneCount:
+  case vmIntrinsics::_VectorSupport_binaryOp:
+  case vmIntrinsics::_VectorSupport_compareEq:
+  case vmIntrinsics::_VectorSupport_blend:
+  case vmIntrinsics::_VectorSupport_rearrange:
   case vmIntrinsics::_ghash_processBlocks:
   case vmIntrinsics::_base64_encodeBlock:
   case vmIntrinsics::_updateCRC32:
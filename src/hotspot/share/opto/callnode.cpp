@@ -29,6 +29,7 @@
 #include "gc/shared/barrierSet.hpp"
 #include "gc/shared/c2/barrierSetC2.hpp"
 #include "interpreter/interpreter.hpp"
+#include "jfr/jfrEvents.hpp"
 #include "opto/callGenerator.hpp"
 #include "opto/callnode.hpp"
 #include "opto/castnode.hpp"
@@ -1815,6 +1816,99 @@ void AbstractLockNode::related(GrowableArray<Node*> *in_rel, GrowableArray<Node*
 }
 #endif
 
+// Union-find over node indices for post_coarsening_events(), -1 when
+// the node is not part of a coarsened region.
+static uint find_lock_region(int* parent, uint i) {
+  while ((uint)parent[i] != i) {
+    parent[i] = parent[parent[i]];
+    i = parent[i];
+  }
+  return i;
+}
+
+static void add_to_lock_region(int* parent, GrowableArray<AbstractLockNode*>& members,
+                               AbstractLockNode* n, AbstractLockNode* other) {
+  if (parent[n->_idx] == -1) {
+    parent[n->_idx] = n->_idx;
+    members.append(n);
+  }
+  if (other != NULL) {
+    uint a = find_lock_region(parent, n->_idx);
+    uint b = find_lock_region(parent, other->_idx);
+    if (a != b) {
+      parent[a] = b;
+    }
+  }
+}
+
+// LockNode::Ideal() coarsens one unlock/lock pair at a time. Join the
+// recorded groups with the locks matching their unlocks, so that each
+// event reports a whole merged region: lockCount is the number of lock
+// regions it now covers, e.g. the unrolled iterations of a loop.
+void AbstractLockNode::post_coarsening_events(Compile* C) {
+  if (!EventCompilerLockCoarsening::is_enabled() || C->coarsened_count() == 0) {
+    return;
+  }
+  ResourceMark rm;
+  uint max = C->unique();
+  int* parent = NEW_RESOURCE_ARRAY(int, max);
+  for (uint i = 0; i < max; i++) {
+    parent[i] = -1;
+  }
+  GrowableArray<AbstractLockNode*> members;
+  for (int i = 0; i < C->coarsened_count(); i++) {
+    Node_List* group = C->coarsened_locks_at(i);
+    AbstractLockNode* first = NULL;
+    for (uint j = 0; j < group->size(); j++) {
+      AbstractLockNode* n = group->at(j)->as_AbstractLock();
+      add_to_lock_region(parent, members, n, first);
+      first = n;
+      // An OSR compilation may unlock a monitor locked by the interpreter
+      if (n->is_Unlock() && !C->is_osr_compilation()) {
+        LockNode* lock = n->find_matching_lock(n->as_Unlock());
+        if (lock != NULL) {
+          add_to_lock_region(parent, members, lock, n);
+        }
+      }
+    }
+  }
+
+  int* locks = NEW_RESOURCE_ARRAY(int, max);
+  int* unlocks = NEW_RESOURCE_ARRAY(int, max);
+  GrowableArray<LockNode*> regions;
+  for (int i = 0; i < members.length(); i++) {
+    uint root = find_lock_region(parent, members.at(i)->_idx);
+    locks[root] = 0;
+    unlocks[root] = 0;
+  }
+  for (int i = 0; i < members.length(); i++) {
+    AbstractLockNode* n = members.at(i);
+    uint root = find_lock_region(parent, n->_idx);
+    if (n->is_Lock()) {
+      if (locks[root]++ == 0) {
+        regions.append(n->as_Lock());
+      }
+    } else {
+      unlocks[root]++;
+    }
+  }
+
+  for (int i = 0; i < regions.length(); i++) {
+    LockNode* lock = regions.at(i);
+    uint root = find_lock_region(parent, lock->_idx);
+    EventCompilerLockCoarsening event;
+    if (event.should_commit()) {
+      JVMState* jvms = lock->jvms();
+      event.set_compileId(C->compile_id());
+      event.set_method((jvms != NULL && jvms->method() != NULL) ? jvms->method()->get_Method() : (Method*)NULL);
+      event.set_bci(jvms != NULL ? jvms->bci() : -1);
+      event.set_lockCount(locks[root]);
+      event.set_unlockCount(unlocks[root]);
+      event.commit();
+    }
+  }
+}
+
 //=============================================================================
 Node *LockNode::Ideal(PhaseGVN *phase, bool can_reshape) {
 
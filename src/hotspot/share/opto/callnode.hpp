@@ -1038,6 +1038,9 @@ public:
   void set_coarsened()   { _kind = Coarsened; set_eliminated_lock_counter(); }
   void set_nested()      { _kind = Nested; set_eliminated_lock_counter(); }
 
+  // Post a CompilerLockCoarsening event for each merged coarsened region
+  static void post_coarsening_events(Compile* C);
+
   // locking does not modify its arguments
   virtual bool may_modify(const TypeOopPtr *t_oop, PhaseTransform *phase){ return false;}
 
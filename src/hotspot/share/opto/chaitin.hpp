@@ -674,6 +674,14 @@ private:
   // Init LRG caching of degree, numregs.  Init lo_degree list.
   void cache_lrg_info( );
 
+  // Conservative coalescing can be skipped for methods with very many
+  // live ranges, where it dominates the time of each spill round.
+  bool should_coalesce_conservatively() const {
+    return OptoCoalesce &&
+           (ConservativeCoalesceLiveRangeLimit == 0 ||
+            _lrg_map.max_lrg_id() <= ConservativeCoalesceLiveRangeLimit);
+  }
+
   // Simplify the IFG by removing LRGs of low degree with no copies
   void Pre_Simplify();
 
@@ -71,6 +71,10 @@ macro(CMoveVD)
 macro(CMoveF)
 macro(CMoveVF)
 macro(CMoveI)
+macro(CMoveVI)
+macro(BlendV)
+macro(ShuffleVB)
+macro(CmpEqMaskV)
 macro(CMoveL)
 macro(CMoveP)
 macro(CMoveN)
@@ -665,6 +665,7 @@ Compile::Compile( ciEnv* ci_env, C2Compiler* compiler, ciMethod* target, int osr
                   _subsume_loads(subsume_loads),
                   _do_escape_analysis(do_escape_analysis),
                   _eliminate_boxing(eliminate_boxing),
+                  _reduced_optimization(false),
                   _failure_reason(NULL),
                   _code_buffer("Compile::Fill_buffer"),
                   _orig_pc_slot(0),
@@ -750,6 +751,18 @@ Compile::Compile( ciEnv* ci_env, C2Compiler* compiler, ciMethod* target, int osr
     method()->ensure_method_data();
   }
 
+  // When the compile queue is backed up, skip the expensive loop
+  // optimizations and have the method compiled again once it drains.
+  CompileTask* task = ci_env->task();
+  if (ReducedOptimizationQueueLength > 0 && !is_osr_compilation() &&
+      task != NULL && task->compile_reason() != CompileTask::Reason_Reoptimize &&
+      CompileBroker::queue_size(CompLevel_full_optimization) > ReducedOptimizationQueueLength) {
+    _reduced_optimization = true;
+    if (log() != NULL) {
+      log()->elem("reduced_optimization queue_size='%d'", CompileBroker::queue_size(CompLevel_full_optimization));
+    }
+  }
+
   Init(::AliasLevel);
 
 
@@ -992,6 +1005,7 @@ Compile::Compile( ciEnv* ci_env,
     _subsume_loads(true),
     _do_escape_analysis(false),
     _eliminate_boxing(false),
+    _reduced_optimization(false),
     _failure_reason(NULL),
     _code_buffer("Compile::Fill_buffer"),
     _has_method_handle_invokes(false),
@@ -1129,6 +1143,9 @@ void Compile::Init(int aliaslevel) {
 
   set_do_freq_based_layout(_directive->BlockLayoutByFrequencyOption);
   set_num_loop_opts(LoopOptsCount);
+  if (is_reduced_optimization()) {
+    set_num_loop_opts(MIN2(LoopOptsCount, ReducedOptimizationLoopOptsCount));
+  }
   set_do_inlining(Inline);
   set_max_inline_size(MaxInlineSize);
   set_freq_inline_size(FreqInlineSize);
@@ -2080,6 +2097,29 @@ void Compile::inline_boxing_calls(PhaseIterGVN& igvn) {
   }
 }
 
+// Trap on rare paths through which allocations escape
+void Compile::speculate_rare_escapes(PhaseIterGVN& igvn) {
+  PhaseGVN* gvn = initial_gvn();
+
+  assert( igvn._worklist.size() == 0, "should be done with igvn" );
+  for_igvn()->clear();
+  gvn->replace_with(&igvn);
+
+  if (!ConnectionGraph::trap_rare_escapes(this)) {
+    igvn = PhaseIterGVN(gvn);
+    return;
+  }
+  print_method(PHASE_AFTER_RARE_ESCAPE_TRAPS, 3);
+
+  {
+    ResourceMark rm;
+    PhaseRemoveUseless pru(gvn, for_igvn());
+  }
+
+  igvn = PhaseIterGVN(gvn);
+  igvn.optimize();
+}
+
 void Compile::inline_incrementally_one(PhaseIterGVN& igvn) {
   assert(IncrementalInline, "incremental inlining should be on");
   PhaseGVN* gvn = initial_gvn();
@@ -2310,6 +2350,12 @@ void Compile::Optimize() {
     igvn.optimize();
   }
 
+  if (_do_escape_analysis && SpeculativeEscapeAnalysis && EliminateAllocations &&
+      ConnectionGraph::has_candidates(this)) {
+    speculate_rare_escapes(igvn);
+    if (failing())  return;
+  }
+
   // Now that all inlining is over and no PhaseRemoveUseless will run, cut edge from root to loop
   // safepoints
   remove_root_to_sfpts_edges(igvn);
@@ -2323,6 +2369,11 @@ void Compile::Optimize() {
       if (major_progress()) print_method(PHASE_PHASEIDEAL_BEFORE_EA, 2);
       if (failing())  return;
     }
+    if (ReduceAllocationMerges && EliminateAllocations &&
+        ConnectionGraph::reduce_allocation_merges(this, &igvn)) {
+      igvn.optimize();
+      if (failing())  return;
+    }
     ConnectionGraph::do_analysis(this, &igvn);
 
     if (failing())  return;
@@ -290,6 +290,12 @@ CallGenerator* Compile::call_generator(ciMethod* callee, int vtable_index, bool
           }
         }
       }
+      if (receiver_method == NULL && speculative_receiver_type == NULL &&
+          UsePolymorphicInlining && profile.has_receiver(2)) {
+        CallGenerator* cg = polymorphic_call_generator(callee, vtable_index, jvms,
+                                                       allow_inline, prof_factor, profile);
+        if (cg != NULL)  return cg;
+      }
     }
   }
 
@@ -316,6 +322,72 @@ CallGenerator* Compile::call_generator(ciMethod* callee, int vtable_index, bool
   }
 }
 
+// Inline a megamorphic call site as a chain of type checks against the
+// most frequent receivers, ordered by decreasing frequency.  Receivers
+// that are not profiled go through a virtual call.
+CallGenerator* Compile::polymorphic_call_generator(ciMethod* callee, int vtable_index, JVMState* jvms,
+                                                   bool allow_inline, float prof_factor, ciCallProfile& profile) {
+  ciMethod* caller = jvms->method();
+  int site_count = profile.count();
+
+  // Find the smallest set of receivers that covers enough of the calls.
+  int receivers = 0;
+  float covered = 0.0f;
+  while (receivers < ciCallProfile::MorphismLimit && profile.has_receiver(receivers) &&
+         covered * 100 < TypeProfilePolymorphicPercent) {
+    covered += profile.receiver_prob(receivers);
+    receivers++;
+  }
+  if (receivers < 2 || covered * 100 < TypeProfilePolymorphicPercent) {
+    return NULL;
+  }
+
+  ciMethod*      methods[ciCallProfile::MorphismLimit];
+  CallGenerator* hit_cgs[ciCallProfile::MorphismLimit];
+  int inlined = 0;
+  for (int i = 0; i < receivers; i++) {
+    hit_cgs[i] = NULL;
+    methods[i] = callee->resolve_invoke(caller->holder(), profile.receiver(i));
+    if (methods[i] != NULL) {
+      hit_cgs[i] = call_generator(methods[i], vtable_index, false, jvms, allow_inline, prof_factor);
+      if (hit_cgs[i] != NULL && !hit_cgs[i]->is_inline() && UseOnlyInlinedBimorphic) {
+        // Skip receivers whose method can't be inlined: a direct call
+        // behind a type check doesn't buy much over a virtual call.
+        hit_cgs[i] = NULL;
+      }
+    }
+    if (hit_cgs[i] != NULL) {
+      inlined++;
+    }
+  }
+  if (inlined < 2) {
+    return NULL;
+  }
+
+  // Build the chain from the least frequent receiver up so that the most
+  // frequent one is checked first.  Each check is only reached when the
+  // previous ones failed, so its probability is conditional on that.
+  CallGenerator* cg = CallGenerator::for_virtual_call(callee, vtable_index);
+  for (int i = receivers - 1; i >= 0; i--) {
+    if (hit_cgs[i] == NULL) {
+      continue;
+    }
+    float not_before = 1.0f;
+    for (int j = 0; j < i; j++) {
+      not_before -= profile.receiver_prob(j);
+    }
+    float hit_prob = not_before > 0.0f ? profile.receiver_prob(i) / not_before : PROB_MAX;
+    hit_prob = MIN2(MAX2(hit_prob, PROB_MIN), PROB_MAX);
+    trace_type_profile(this, caller, jvms->depth() - 1, jvms->bci(), methods[i], profile.receiver(i), site_count, profile.receiver_count(i));
+    // The dependency on the receiver is added by Parse::Parse() when inlining.
+    cg = CallGenerator::for_predicted_call(profile.receiver(i), cg, hit_cgs[i], hit_prob);
+    if (cg == NULL) {
+      return NULL;
+    }
+  }
+  return cg;
+}
+
 // Return true for methods that shouldn't be inlined early so that
 // they are easier to analyze and optimize as intrinsics.
 bool Compile::should_delay_string_inlining(ciMethod* call_method, JVMState* jvms) {
@@ -35,6 +35,7 @@
 #include "opto/cfgnode.hpp"
 #include "opto/compile.hpp"
 #include "opto/escape.hpp"
+#include "opto/graphKit.hpp"
 #include "opto/phaseX.hpp"
 #include "opto/movenode.hpp"
 #include "opto/rootnode.hpp"
@@ -96,6 +97,343 @@ bool ConnectionGraph::has_candidates(Compile *C) {
   return false;
 }
 
+// A call is considered rare by speculative escape analysis if it is
+// reached with at most this probability from the closest merge point.
+#define RARE_ESCAPE_PROB PROB_UNLIKELY_MAG(4)
+
+bool ConnectionGraph::is_rare_call(Compile* C, CallNode* call) {
+  if (!call->is_CallJava() || call->is_macro()) {
+    return false;
+  }
+  CallJavaNode* cj = call->as_CallJava();
+  JVMState* jvms = call->jvms();
+  if (cj->method() == NULL || cj->is_method_handle_invoke() ||
+      jvms == NULL || !jvms->has_method() || jvms->bci() < 0) {
+    return false;
+  }
+  // Only plain invokes can be re-executed by the interpreter
+  // after the trap with the arguments still on the stack.
+  switch (jvms->method()->java_code_at_bci(jvms->bci())) {
+    case Bytecodes::_invokevirtual:
+    case Bytecodes::_invokespecial:
+    case Bytecodes::_invokestatic:
+    case Bytecodes::_invokeinterface:
+      break;
+    default:
+      return false;
+  }
+  if (call->tf()->domain()->cnt() - TypeFunc::Parms != (uint)cj->method()->arg_size()) {
+    return false;
+  }
+  // Don't speculate again if the trap was already hit at this call site.
+  if (C->too_many_traps(jvms->method(), jvms->bci(), Deoptimization::Reason_rare_escape)) {
+    return false;
+  }
+
+  // Accumulate the profiled probabilities of the branches
+  // leading to the call up to the closest merge point.
+  float prob = 1.0f;
+  Node* ctrl = call->in(TypeFunc::Control);
+  for (int i = 0; i < 100 && ctrl != NULL; i++) {
+    if (ctrl->is_IfProj()) {
+      IfNode* iff = ctrl->in(0)->as_If();
+      if (iff->_fcnt == COUNT_UNKNOWN || iff->_prob == PROB_UNKNOWN) {
+        return false;
+      }
+      prob *= (ctrl->Opcode() == Op_IfTrue) ? iff->_prob : (1.0f - iff->_prob);
+      if (prob < RARE_ESCAPE_PROB) {
+        return true;
+      }
+      ctrl = iff->in(0);
+    } else if (ctrl->is_Region() || ctrl->is_Start() || ctrl->is_top()) {
+      return false;
+    } else {
+      ctrl = ctrl->in(0);
+    }
+  }
+  return false;
+}
+
+// Collect the calls through which the allocation result 'res' escapes.
+// Returns false if it escapes in any other way or if one of the calls
+// is not rare.
+bool ConnectionGraph::collect_rare_escapes(Compile* C, Node* res, Unique_Node_List& calls) {
+  Unique_Node_List ptrs;
+  ptrs.push(res);
+  for (uint next = 0; next < ptrs.size(); next++) {
+    Node* ptr = ptrs.at(next);
+    for (DUIterator_Fast imax, i = ptr->fast_outs(imax); i < imax; i++) {
+      Node* use = ptr->fast_out(i);
+      int opc = use->Opcode();
+      if (use->is_AddP() || use->is_ConstraintCast() ||
+          opc == Op_EncodeP || opc == Op_DecodeN) {
+        ptrs.push(use);
+      } else if (use->is_Load() || use->is_Cmp() || use->is_MemBar() ||
+                 opc == Op_CastP2X) {
+        // Doesn't make the object escape
+      } else if (use->is_Store()) {
+        // Only allowed as the address of the store
+        for (uint k = 0; k < use->req(); k++) {
+          if (k != MemNode::Address && use->in(k) == ptr) {
+            return false;
+          }
+        }
+      } else if (use->is_SafePoint()) {
+        // Uses in the debug info don't make the object escape
+        SafePointNode* sfpt = use->as_SafePoint();
+        uint limit = (sfpt->jvms() != NULL) ? sfpt->jvms()->debug_start() : sfpt->req();
+        limit = MIN2(limit, sfpt->req());
+        for (uint k = TypeFunc::Parms; k < limit; k++) {
+          if (sfpt->in(k) == ptr) {
+            if (!use->is_Call() || !is_rare_call(C, use->as_Call())) {
+              return false;
+            }
+            calls.push(use);
+            break;
+          }
+        }
+      } else {
+        return false;
+      }
+    }
+  }
+  return calls.size() > 0;
+}
+
+void ConnectionGraph::replace_call_with_trap(Compile* C, CallNode* call) {
+  CallProjections projs;
+  call->extract_projections(&projs, true /* separate_io_proj */, false /* do_asserts */);
+
+  // Make a clone of the JVMState of the call and a map holding
+  // its inputs to drive the emission of the trap.
+  JVMState* jvms = call->jvms()->clone_shallow(C);
+  uint size = call->req();
+  SafePointNode* map = new SafePointNode(size, jvms);
+  for (uint i = 0; i < size; i++) {
+    map->init_req(i, call->in(i));
+  }
+  // Make sure the memory state is a MergeMem for the kit.
+  if (!map->in(TypeFunc::Memory)->is_MergeMem()) {
+    Node* mem = MergeMemNode::make(map->in(TypeFunc::Memory));
+    C->initial_gvn()->set_type_bottom(mem);
+    map->set_req(TypeFunc::Memory, mem);
+  }
+  uint nargs = call->as_CallJava()->method()->arg_size();
+  Node* top = C->top();
+  for (uint i = 0; i < nargs; i++) {
+    map->set_req(TypeFunc::Parms + i, top);
+  }
+  jvms->set_map(map);
+  map->ensure_stack(jvms, jvms->method()->max_stack());
+
+  // Put the arguments back on the expression stack so that the
+  // interpreter re-executes the invoke after the deoptimization.
+  GraphKit kit(jvms);
+  for (uint i = 0; i < nargs; i++) {
+    kit.push(call->in(TypeFunc::Parms + i));
+  }
+  kit.uncommon_trap(Deoptimization::Reason_rare_escape,
+                    Deoptimization::Action_reinterpret,
+                    NULL, "rare escape");
+
+  // The original call is dead now.
+  Node* proj_list[] = { projs.fallthrough_catchproj, projs.catchall_catchproj,
+                        projs.fallthrough_proj, projs.fallthrough_memproj,
+                        projs.catchall_memproj, projs.fallthrough_ioproj,
+                        projs.catchall_ioproj, projs.resproj, projs.exobj };
+  for (uint i = 0; i < sizeof(proj_list) / sizeof(proj_list[0]); i++) {
+    Node* proj = proj_list[i];
+    if (proj != NULL) {
+      C->gvn_replace_by(proj, top);
+    }
+  }
+  call->disconnect_inputs(NULL, C);
+}
+
+bool ConnectionGraph::trap_rare_escapes(Compile *C) {
+  ResourceMark rm;
+  Unique_Node_List calls;
+  for (int i = 0; i < C->macro_count(); i++) {
+    Node* n = C->macro_node(i);
+    if (!n->is_Allocate()) {
+      continue;
+    }
+    Node* res = n->as_Allocate()->result_cast();
+    if (res == NULL) {
+      continue;
+    }
+    Unique_Node_List alloc_calls;
+    if (collect_rare_escapes(C, res, alloc_calls)) {
+      for (uint j = 0; j < alloc_calls.size(); j++) {
+        calls.push(alloc_calls.at(j));
+      }
+    }
+  }
+  for (uint j = 0; j < calls.size(); j++) {
+    CallNode* call = calls.at(j)->as_Call();
+#ifndef PRODUCT
+    if (PrintEscapeAnalysis) {
+      tty->print("=== Replaced rare escaping call with uncommon trap: ");
+      call->dump();
+    }
+#endif
+    if (C->log() != NULL) {
+      JVMState* jvms = call->jvms();
+      C->log()->elem("rare_escape_trap bci='%d' method='%d'", jvms->bci(),
+                     C->log()->identify(jvms->method()));
+    }
+    replace_call_with_trap(C, call);
+  }
+  return calls.size() > 0;
+}
+
+static bool is_null_con(PhaseIterGVN* igvn, Node* n) {
+  return igvn->type(n) == TypePtr::NULL_PTR;
+}
+
+// Check that 'phi' only merges fresh allocations and null and that all
+// its uses are field loads and comparisons with null.
+bool ConnectionGraph::can_reduce_phi(PhaseIterGVN* igvn, PhiNode* phi,
+                                     Unique_Node_List& loads, Unique_Node_List& cmps) {
+  Node* region = phi->in(0);
+  if (region == NULL || !region->is_Region() || region->is_Loop() ||
+      region->req() != phi->req() || igvn->type(phi)->isa_oopptr() == NULL) {
+    return false;
+  }
+  for (uint i = 1; i < phi->req(); i++) {
+    Node* in = phi->in(i);
+    if (in == NULL || in->is_top() || region->in(i) == NULL || region->in(i)->is_top()) {
+      return false;
+    }
+    if (is_null_con(igvn, in)) {
+      continue;
+    }
+    AllocateNode* alloc = AllocateNode::Ideal_allocation(in, igvn);
+    if (alloc == NULL || alloc->result_cast() != in) {
+      return false;
+    }
+  }
+
+  Unique_Node_List ptrs;
+  ptrs.push(phi);
+  for (uint next = 0; next < ptrs.size(); next++) {
+    Node* ptr = ptrs.at(next);
+    for (DUIterator_Fast imax, i = ptr->fast_outs(imax); i < imax; i++) {
+      Node* use = ptr->fast_out(i);
+      if (use->is_ConstraintCast() && use->in(1) == ptr) {
+        ptrs.push(use);
+      } else if (use->is_AddP()) {
+        if (use->in(AddPNode::Base) != ptr || use->in(AddPNode::Address) != ptr ||
+            !use->in(AddPNode::Offset)->is_Con()) {
+          return false;
+        }
+        for (DUIterator_Fast jmax, j = use->fast_outs(jmax); j < jmax; j++) {
+          Node* load = use->fast_out(j);
+          if (!load->is_Load() || load->in(MemNode::Address) != use ||
+              load->as_Load()->is_mismatched_access()) {
+            return false;
+          }
+          BasicType bt = load->bottom_type()->basic_type();
+          if (!is_java_primitive(bt) && bt != T_OBJECT && bt != T_NARROWOOP) {
+            return false;
+          }
+          // The memory state must be available on each path into the merge.
+          Node* mem = load->in(MemNode::Memory);
+          if (!(mem->is_Phi() && mem->in(0) == region) &&
+              (mem->is_MergeMem() || !MemNode::all_controls_dominate(mem, region))) {
+            return false;
+          }
+          loads.push(load);
+        }
+      } else if (use->Opcode() == Op_CmpP &&
+                 (is_null_con(igvn, use->in(1)) || is_null_con(igvn, use->in(2)))) {
+        cmps.push(use);
+      } else {
+        return false;
+      }
+    }
+  }
+  return loads.size() > 0 || cmps.size() > 0;
+}
+
+void ConnectionGraph::reduce_phi(PhaseIterGVN* igvn, PhiNode* phi,
+                                 Unique_Node_List& loads, Unique_Node_List& cmps) {
+  Node* region = phi->in(0);
+  for (uint k = 0; k < loads.size(); k++) {
+    Node* load = loads.at(k);
+    Node* mem  = load->in(MemNode::Memory);
+    Node* off  = load->in(MemNode::Address)->in(AddPNode::Offset);
+    PhiNode* value = new PhiNode(region, load->bottom_type());
+    for (uint i = 1; i < phi->req(); i++) {
+      Node* base = phi->in(i);
+      if (is_null_con(igvn, base)) {
+        // The load is guarded by a null check on this path,
+        // so its value is never observed here.
+        value->init_req(i, igvn->zerocon(load->bottom_type()->basic_type()));
+        continue;
+      }
+      // Fresh allocations are never null, so the clone
+      // doesn't need the control of the original load.
+      Node* x = load->clone();
+      x->set_req(0, NULL);
+      if (mem->is_Phi() && mem->in(0) == region) {
+        x->set_req(MemNode::Memory, mem->in(i));
+      }
+      x->set_req(MemNode::Address, igvn->transform(new AddPNode(base, base, off)));
+      value->init_req(i, igvn->transform(x));
+    }
+    igvn->replace_node(load, igvn->transform(value));
+  }
+  for (uint k = 0; k < cmps.size(); k++) {
+    Node* cmp = cmps.at(k);
+    // The merged pointer is null iff the selector is zero.
+    PhiNode* selector = new PhiNode(region, TypeInt::BOOL);
+    for (uint i = 1; i < phi->req(); i++) {
+      selector->init_req(i, igvn->intcon(is_null_con(igvn, phi->in(i)) ? 0 : 1));
+    }
+    Node* sel = igvn->transform(selector);
+    igvn->replace_node(cmp, igvn->transform(new CmpINode(sel, igvn->intcon(0))));
+  }
+}
+
+bool ConnectionGraph::reduce_allocation_merges(Compile *C, PhaseIterGVN *igvn) {
+  ResourceMark rm;
+  Unique_Node_List phis;
+  for (int i = 0; i < C->macro_count(); i++) {
+    Node* n = C->macro_node(i);
+    if (!n->is_Allocate()) {
+      continue;
+    }
+    Node* res = n->as_Allocate()->result_cast();
+    if (res == NULL) {
+      continue;
+    }
+    for (DUIterator_Fast imax, j = res->fast_outs(imax); j < imax; j++) {
+      Node* use = res->fast_out(j);
+      if (use->is_Phi()) {
+        phis.push(use);
+      }
+    }
+  }
+  bool progress = false;
+  for (uint i = 0; i < phis.size(); i++) {
+    PhiNode* phi = phis.at(i)->as_Phi();
+    Unique_Node_List loads;
+    Unique_Node_List cmps;
+    if (can_reduce_phi(igvn, phi, loads, cmps)) {
+#ifndef PRODUCT
+      if (PrintEscapeAnalysis) {
+        tty->print("=== Reduced allocation merge: ");
+        phi->dump();
+      }
+#endif
+      reduce_phi(igvn, phi, loads, cmps);
+      progress = true;
+    }
+  }
+  return progress;
+}
+
 void ConnectionGraph::do_analysis(Compile *C, PhaseIterGVN *igvn) {
   Compile::TracePhase tp("escapeAnalysis", &Phase::timers[Phase::_t_escapeAnalysis]);
   ResourceMark rm;
@@ -1059,7 +1397,9 @@ void ConnectionGraph::process_call_arguments(CallNode *call) {
                   strcmp(call->as_CallLeaf()->_name, "mulAdd") == 0 ||
                   strcmp(call->as_CallLeaf()->_name, "montgomery_multiply") == 0 ||
                   strcmp(call->as_CallLeaf()->_name, "montgomery_square") == 0 ||
-                  strcmp(call->as_CallLeaf()->_name, "vectorizedMismatch") == 0)
+                  strcmp(call->as_CallLeaf()->_name, "vectorizedMismatch") == 0 ||
+                  strcmp(call->as_CallLeaf()->_name, "vectorizedHashCodeB") == 0 ||
+                  strcmp(call->as_CallLeaf()->_name, "vectorizedHashCodeI") == 0)
                  ))) {
             call->dump();
             fatal("EA unexpected CallLeaf %s", call->as_CallLeaf()->_name);
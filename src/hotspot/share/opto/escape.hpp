@@ -582,6 +582,17 @@ private:
   // Compute the escape information
   bool compute_escape();
 
+  // Support for speculative escape analysis
+  static bool is_rare_call(Compile* C, CallNode* call);
+  static bool collect_rare_escapes(Compile* C, Node* res, Unique_Node_List& calls);
+  static void replace_call_with_trap(Compile* C, CallNode* call);
+
+  // Support for splitting allocation merges
+  static bool can_reduce_phi(PhaseIterGVN* igvn, PhiNode* phi,
+                             Unique_Node_List& loads, Unique_Node_List& cmps);
+  static void reduce_phi(PhaseIterGVN* igvn, PhiNode* phi,
+                         Unique_Node_List& loads, Unique_Node_List& cmps);
+
 public:
   ConnectionGraph(Compile *C, PhaseIterGVN *igvn);
 
@@ -591,6 +602,17 @@ public:
   // Perform escape analysis
   static void do_analysis(Compile *C, PhaseIterGVN *igvn);
 
+  // Replace rarely executed calls, which are the only places where an
+  // allocation escapes, with uncommon traps. The object is then only
+  // materialized by deoptimization on those paths and can be scalar
+  // replaced everywhere else. Returns true if the graph was changed.
+  static bool trap_rare_escapes(Compile *C);
+
+  // Split field loads and null checks of allocations merged by a Phi
+  // through the Phi, so that the merge goes away and each allocation
+  // can be scalar replaced. Returns true if the graph was changed.
+  static bool reduce_allocation_merges(Compile *C, PhaseIterGVN *igvn);
+
   bool not_global_escape(Node *n);
 
 #ifndef PRODUCT
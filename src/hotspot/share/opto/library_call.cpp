@@ -326,6 +326,12 @@ class LibraryCallKit : public GraphKit {
   bool inline_montgomeryMultiply();
   bool inline_montgomerySquare();
   bool inline_vectorizedMismatch();
+  bool inline_vectorizedHashCode(vmIntrinsics::ID id);
+  bool inline_vector_lane_count();
+  bool inline_vector_binary_op();
+  bool inline_vector_compare_eq();
+  bool inline_vector_blend();
+  bool inline_vector_rearrange();
   bool inline_fma(vmIntrinsics::ID id);
   bool inline_character_compare(vmIntrinsics::ID id);
   bool inline_fp_min_max(vmIntrinsics::ID id);
@@ -851,6 +857,21 @@ bool LibraryCallKit::try_to_inline(int predicate) {
   case vmIntrinsics::_vectorizedMismatch:
     return inline_vectorizedMismatch();
 
+  case vmIntrinsics::_hashCodeL:
+  case vmIntrinsics::_hashCodeI:
+    return inline_vectorizedHashCode(intrinsic_id());
+
+  case vmIntrinsics::_VectorSupport_laneCount:
+    return inline_vector_lane_count();
+  case vmIntrinsics::_VectorSupport_binaryOp:
+    return inline_vector_binary_op();
+  case vmIntrinsics::_VectorSupport_compareEq:
+    return inline_vector_compare_eq();
+  case vmIntrinsics::_VectorSupport_blend:
+    return inline_vector_blend();
+  case vmIntrinsics::_VectorSupport_rearrange:
+    return inline_vector_rearrange();
+
   case vmIntrinsics::_ghash_processBlocks:
     return inline_ghash_processBlocks();
   case vmIntrinsics::_base64_encodeBlock:
@@ -5463,6 +5484,253 @@ bool LibraryCallKit::inline_vectorizedMismatch() {
   return true;
 }
 
+//-------------inline_vectorizedHashCode------------------------------
+// int StringLatin1.hashCode(byte[] value)
+// int Arrays.hashCode(int[] a)
+bool LibraryCallKit::inline_vectorizedHashCode(vmIntrinsics::ID id) {
+  assert(UseVectorizedHashCodeIntrinsic, "not implementated on this platform");
+
+  BasicType bt = (id == vmIntrinsics::_hashCodeL) ? T_BYTE : T_INT;
+  address stubAddr = (bt == T_BYTE) ? StubRoutines::vectorizedHashCodeB() : StubRoutines::vectorizedHashCodeI();
+  if (stubAddr == NULL) {
+    return false; // Intrinsic's stub is not implemented on this platform
+  }
+  const char* stubName = (bt == T_BYTE) ? "vectorizedHashCodeB" : "vectorizedHashCodeI";
+  // String hashes start from 0, Arrays.hashCode() from 1.
+  int initial = (bt == T_BYTE) ? 0 : 1;
+
+  Node* array = argument(0);
+
+  // Arrays.hashCode(null) is 0.
+  RegionNode* region = new RegionNode(3);
+  PhiNode*    phi    = new PhiNode(region, TypeInt::INT);
+  Node* null_ctl = top();
+  if (bt == T_BYTE) {
+    array = must_be_not_null(array, true);
+  } else {
+    array = null_check_oop(array, &null_ctl);
+  }
+  region->init_req(2, null_ctl);
+  phi->init_req(2, intcon(0));
+
+  if (!stopped()) {
+    array = access_resolve(array, ACCESS_READ);
+
+    Node* array_start = array_element_address(array, intcon(0), bt);
+    Node* length = load_array_length(array);
+
+    Node* call = make_runtime_call(RC_LEAF|RC_NO_FP,
+                                   OptoRuntime::vectorizedHashCode_Type(),
+                                   stubAddr, stubName, TypeAryPtr::get_array_body_type(bt),
+                                   array_start, length, intcon(initial));
+    Node* result = _gvn.transform(new ProjNode(call, TypeFunc::Parms));
+    region->init_req(1, control());
+    phi->init_req(1, result);
+  }
+
+  set_control(_gvn.transform(region));
+  record_for_igvn(region);
+  set_result(_gvn.transform(phi));
+  return true;
+}
+
+//-------------inline_vector_support------------------------------------
+// Explicit SIMD operations of jdk.internal.misc.VectorSupport, for JDK
+// internal kernels that would otherwise need a hand written stub:
+//
+// int  laneCount(int bt)
+// void binaryOp(int op, int bt, int lanes, Object a, long aOffset,
+//               Object b, long bOffset, Object r, long rOffset)
+// int  compareEq(int bt, int lanes, Object a, long aOffset, Object b, long bOffset)
+// void blend(int bt, int lanes, Object a, long aOffset, Object b, long bOffset,
+//            Object m, long mOffset, Object r, long rOffset)
+// void rearrange(int lanes, Object a, long aOffset, Object idx, long idxOffset,
+//                Object r, long rOffset)
+//
+// bt is a BasicType and the operands are Unsafe style array base and byte
+// offset pairs; like Unsafe accesses they are not range checked. The
+// operation, element type and lane count must be constants, and operands
+// must be arrays of the element type. Otherwise, or when the platform has
+// no match rule for the shape, the Java implementation runs instead.
+
+// Element type and lane count of a vector operand, or false when they are
+// not constant or the platform has no vectors of that shape.
+static bool vector_support_shape(int bt_con, Node* lanes_arg, BasicType& bt, uint& vlen) {
+  int lanes = lanes_arg->find_int_con(-1);
+  if (bt_con < T_FLOAT || bt_con > T_LONG || lanes < 2 || !is_power_of_2(lanes)) {
+    return false;
+  }
+  bt = (BasicType)bt_con;
+  vlen = (uint)lanes;
+  return Matcher::vector_size_supported(bt, vlen);
+}
+
+// The masks and shuffles are defined for 128 and 256-bit vectors: the
+// compare result has one bit per lane in an int.
+static bool vector_support_mask_shape(BasicType bt, uint vlen) {
+  uint size = vlen * type2aelembytes(bt);
+  return size == 16 || size == 32;
+}
+
+static bool is_vector_support_array(PhaseGVN& gvn, Node* base, BasicType bt) {
+  const TypeAryPtr* top = gvn.type(base)->isa_aryptr();
+  return top != NULL && top->klass() != NULL &&
+         top->elem()->array_element_basic_type() == bt;
+}
+
+static Node* vector_support_load(GraphKit* kit, Node* adr, BasicType bt, uint vlen) {
+  const TypePtr* adr_type = TypeAryPtr::get_array_body_type(bt);
+  Node* ld = LoadVectorNode::make(0, kit->control(), kit->memory(adr_type), adr, adr_type, vlen, bt);
+  return kit->gvn().transform(ld);
+}
+
+static void vector_support_store(GraphKit* kit, Node* adr, BasicType bt, uint vlen, Node* val) {
+  const TypePtr* adr_type = TypeAryPtr::get_array_body_type(bt);
+  Node* st = StoreVectorNode::make(0, kit->control(), kit->memory(adr_type), adr, adr_type, val, vlen);
+  kit->set_memory(kit->gvn().transform(st), adr_type);
+}
+
+// Make sure the code generator handles vectors of this size, as SuperWord
+// does for the vectors it creates.
+static void vector_support_record_size(Compile* C, BasicType bt, uint vlen) {
+  uint size = vlen * type2aelembytes(bt);
+  if (C->max_vector_size() < size) {
+    C->set_max_vector_size(size);
+  }
+}
+
+// Lanes of the widest vector of bt whose masks and shuffles are supported;
+// 1 means there is no SIMD support for the type.
+bool LibraryCallKit::inline_vector_lane_count() {
+  int bt_con = argument(0)->find_int_con(T_ILLEGAL);
+  if (bt_con < T_FLOAT || bt_con > T_LONG) {
+    return false;
+  }
+  BasicType bt = (BasicType)bt_con;
+  int lanes = MIN2(Matcher::max_vector_size(bt), 32 / type2aelembytes(bt));
+  set_result(intcon(MAX2(lanes, 1)));
+  return true;
+}
+
+// r[i] = a[i] op b[i]
+bool LibraryCallKit::inline_vector_binary_op() {
+  BasicType bt;
+  uint vlen;
+  if (!vector_support_shape(argument(1)->find_int_con(T_ILLEGAL), argument(2), bt, vlen)) {
+    return false;
+  }
+  int sopc = VectorNode::vector_support_opcode(argument(0)->find_int_con(-1), bt);
+  if (sopc == 0 || !VectorNode::implemented(sopc, vlen, bt)) {
+    return false;
+  }
+  Node* a = argument(3);
+  Node* b = argument(6);
+  Node* r = argument(9);
+  if (!is_vector_support_array(_gvn, a, bt) ||
+      !is_vector_support_array(_gvn, b, bt) ||
+      !is_vector_support_array(_gvn, r, bt)) {
+    return false;
+  }
+
+  a = access_resolve(a, ACCESS_READ);
+  b = access_resolve(b, ACCESS_READ);
+  r = access_resolve(r, ACCESS_WRITE);
+  Node* va = vector_support_load(this, make_unsafe_address(a, argument(4), bt), bt, vlen);
+  Node* vb = vector_support_load(this, make_unsafe_address(b, argument(7), bt), bt, vlen);
+  Node* vr = _gvn.transform(VectorNode::make(sopc, va, vb, vlen, bt));
+  vector_support_store(this, make_unsafe_address(r, argument(10), bt), bt, vlen, vr);
+  vector_support_record_size(C, bt, vlen);
+  return true;
+}
+
+// Bit i of the result is set when a[i] == b[i]; byte and int lanes only.
+bool LibraryCallKit::inline_vector_compare_eq() {
+  BasicType bt;
+  uint vlen;
+  if (!vector_support_shape(argument(0)->find_int_con(T_ILLEGAL), argument(1), bt, vlen) ||
+      (bt != T_BYTE && bt != T_INT) || !vector_support_mask_shape(bt, vlen) ||
+      !Matcher::match_rule_supported_vector(Op_CmpEqMaskV, vlen)) {
+    return false;
+  }
+  Node* a = argument(2);
+  Node* b = argument(5);
+  if (!is_vector_support_array(_gvn, a, bt) ||
+      !is_vector_support_array(_gvn, b, bt)) {
+    return false;
+  }
+
+  a = access_resolve(a, ACCESS_READ);
+  b = access_resolve(b, ACCESS_READ);
+  Node* va = vector_support_load(this, make_unsafe_address(a, argument(3), bt), bt, vlen);
+  Node* vb = vector_support_load(this, make_unsafe_address(b, argument(6), bt), bt, vlen);
+  set_result(_gvn.transform(new CmpEqMaskVNode(va, vb)));
+  vector_support_record_size(C, bt, vlen);
+  return true;
+}
+
+// r[i] = (m[i] != 0) ? b[i] : a[i], where every lane of m is 0 or has all
+// bits set.
+bool LibraryCallKit::inline_vector_blend() {
+  BasicType bt;
+  uint vlen;
+  if (!vector_support_shape(argument(0)->find_int_con(T_ILLEGAL), argument(1), bt, vlen) ||
+      !vector_support_mask_shape(bt, vlen) ||
+      !Matcher::match_rule_supported_vector(Op_BlendV, vlen)) {
+    return false;
+  }
+  Node* a = argument(2);
+  Node* b = argument(5);
+  Node* m = argument(8);
+  Node* r = argument(11);
+  if (!is_vector_support_array(_gvn, a, bt) ||
+      !is_vector_support_array(_gvn, b, bt) ||
+      !is_vector_support_array(_gvn, m, bt) ||
+      !is_vector_support_array(_gvn, r, bt)) {
+    return false;
+  }
+
+  a = access_resolve(a, ACCESS_READ);
+  b = access_resolve(b, ACCESS_READ);
+  m = access_resolve(m, ACCESS_READ);
+  r = access_resolve(r, ACCESS_WRITE);
+  Node* va = vector_support_load(this, make_unsafe_address(a, argument(3), bt), bt, vlen);
+  Node* vb = vector_support_load(this, make_unsafe_address(b, argument(6), bt), bt, vlen);
+  Node* vm = vector_support_load(this, make_unsafe_address(m, argument(9), bt), bt, vlen);
+  Node* vr = _gvn.transform(new BlendVNode(vm, va, vb, TypeVect::make(bt, vlen)));
+  vector_support_store(this, make_unsafe_address(r, argument(12), bt), bt, vlen, vr);
+  vector_support_record_size(C, bt, vlen);
+  return true;
+}
+
+// r[i] = (idx[i] < 0) ? 0 : a[idx[i] & (lanes - 1)] for byte lanes.
+bool LibraryCallKit::inline_vector_rearrange() {
+  BasicType bt;
+  uint vlen;
+  if (!vector_support_shape(T_BYTE, argument(0), bt, vlen) ||
+      !vector_support_mask_shape(bt, vlen) ||
+      !Matcher::match_rule_supported_vector(Op_ShuffleVB, vlen)) {
+    return false;
+  }
+  Node* a = argument(1);
+  Node* idx = argument(4);
+  Node* r = argument(7);
+  if (!is_vector_support_array(_gvn, a, bt) ||
+      !is_vector_support_array(_gvn, idx, bt) ||
+      !is_vector_support_array(_gvn, r, bt)) {
+    return false;
+  }
+
+  a = access_resolve(a, ACCESS_READ);
+  idx = access_resolve(idx, ACCESS_READ);
+  r = access_resolve(r, ACCESS_WRITE);
+  Node* va = vector_support_load(this, make_unsafe_address(a, argument(2), bt), bt, vlen);
+  Node* vi = vector_support_load(this, make_unsafe_address(idx, argument(5), bt), bt, vlen);
+  Node* vr = _gvn.transform(new ShuffleVBNode(va, vi, TypeVect::make(bt, vlen)));
+  vector_support_store(this, make_unsafe_address(r, argument(8), bt), bt, vlen, vr);
+  vector_support_record_size(C, bt, vlen);
+  return true;
+}
+
 /**
  * Calculate CRC32 for byte.
  * int java.util.zip.CRC32.update(int crc, int b)
@@ -31,6 +31,8 @@
 #include "opto/connode.hpp"
 #include "opto/convertnode.hpp"
 #include "opto/divnode.hpp"
+#include "opto/intrinsicnode.hpp"
+#include "opto/locknode.hpp"
 #include "opto/loopnode.hpp"
 #include "opto/mulnode.hpp"
 #include "opto/movenode.hpp"
@@ -749,6 +751,9 @@ bool IdealLoopTree::policy_unroll(PhaseIdealLoop *phase) {
   _local_loop_unroll_limit = LoopUnrollLimit;
   _local_loop_unroll_factor = 4;
   int future_unroll_cnt = cl->unrolled_count() * 2;
+  if (phase->C->is_reduced_optimization() && future_unroll_cnt > 2) {
+    return false; // Only unroll once in a reduced optimization compilation
+  }
   if (!cl->is_vectorized_loop()) {
     if (future_unroll_cnt > LoopMaxUnroll) return false;
   } else {
@@ -852,6 +857,14 @@ bool IdealLoopTree::policy_unroll(PhaseIdealLoop *phase) {
     } // switch
   }
 
+  // A coarsened lock region on an invariant object spans all unrolled
+  // copies of the body, so stop unrolling before it would cover more than
+  // LoopLockCoarseningChunk iterations, to bound safepoint latency.
+  bool coarsen_locks = LoopLockCoarsening && has_invariant_lock_region(phase);
+  if (coarsen_locks && future_unroll_cnt > (int)LoopLockCoarseningChunk) {
+    return false;
+  }
+
   if (UseSuperWord) {
     if (!cl->is_reduction_loop()) {
       phase->mark_reductions(this);
@@ -882,6 +895,12 @@ bool IdealLoopTree::policy_unroll(PhaseIdealLoop *phase) {
     if ((cl->is_subword_loop() || xors_in_loop >= 4) && body_size < (uint)LoopUnrollLimit * 4) {
       return true;
     }
+    // Unroll a loop with a lock region on an invariant object past the
+    // size limit, up to the chunk cap above. The body size limit is the
+    // subword loop one.
+    if (coarsen_locks && body_size < (uint)LoopUnrollLimit * 4) {
+      return true;
+    }
     // Normal case: loop too big
     return false;
   }
@@ -896,6 +915,29 @@ bool IdealLoopTree::policy_unroll(PhaseIdealLoop *phase) {
   return true;
 }
 
+//------------------------------has_invariant_lock_region---------------------
+bool IdealLoopTree::has_invariant_lock_region(PhaseIdealLoop *phase) const {
+  if (!EliminateLocks || !phase->C->do_locks_coarsening()) {
+    return false;
+  }
+  for (uint i = 0; i < _body.size(); i++) {
+    Node* n = _body.at(i);
+    if (!n->is_Lock() || n->as_Lock()->is_eliminated() || !is_invariant(n->as_Lock()->obj_node())) {
+      continue;
+    }
+    LockNode* lock = n->as_Lock();
+    for (uint j = 0; j < _body.size(); j++) {
+      Node* m = _body.at(j);
+      if (m->is_Unlock() && !m->as_Unlock()->is_eliminated() &&
+          m->as_Unlock()->obj_node()->eqv_uncast(lock->obj_node()) &&
+          BoxLockNode::same_slot(lock->box_node(), m->as_Unlock()->box_node())) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
 void IdealLoopTree::policy_unroll_slp_analysis(CountedLoopNode *cl, PhaseIdealLoop *phase, int future_unroll_cnt) {
   // Enable this functionality target by target as needed
   if (SuperWordLoopUnrollAnalysis) {
@@ -3197,6 +3239,233 @@ bool IdealLoopTree::do_one_iteration_loop(PhaseIdealLoop *phase) {
   return true;
 }
 
+//------------------------------do_search_loop_fast_forward--------------------
+// Recognize a counted loop that does nothing but look for the first element
+// of a byte[] equal to a constant:
+//
+//   for (int i = init; i < limit; i++) {
+//     if (a[i] == c) break;
+//   }
+//
+// Iterations before the first match are no-ops, so the loop is started at
+// the index found by StrIndexOfChar over [init, min(limit, a.length)), or at
+// the last index of that range if there is no match.  The loop still runs
+// the remaining iterations, so exits, range check traps and the value of
+// the iv after the loop are unchanged.
+bool IdealLoopTree::do_search_loop_fast_forward(PhaseIdealLoop *phase) {
+  if (!OptimizeSearchLoops || !Matcher::has_latin1_indexof_char()) {
+    return false;
+  }
+  CountedLoopNode *cl = _head->as_CountedLoop();
+  if (!cl->is_normal_loop() || cl->is_search_fast_forwarded() || _child != NULL) {
+    return false;
+  }
+  if (cl->stride_con() != 1 || cl->loopexit()->test_trip() != BoolTest::lt) {
+    return false;
+  }
+  Node* iv = cl->phi();
+  Node* incr = cl->incr();
+  if (iv == NULL || incr == NULL || incr->Opcode() != Op_AddI || incr->in(1) != iv) {
+    return false;
+  }
+
+  // The body may only contain the iv, a single byte load indexed by the iv,
+  // the test of the loaded value and checks that end in an uncommon trap.
+  Node* load = NULL;
+  IfNode* match_iff = NULL;
+  Node_List traps;
+  for (uint i = 0; i < _body.size(); i++) {
+    Node* n = _body.at(i);
+    if (n == cl || n == iv || n == cl->loopexit()) {
+      continue;
+    }
+    if (n->is_Phi() || n->is_Region() || n->is_SafePoint() || n->is_MergeMem() ||
+        n->is_LoadStore() || n->bottom_type() == Type::MEMORY) {
+      return false;
+    }
+    if (n->is_Mem()) {
+      if (n->Opcode() == Op_LoadRange) {
+        continue;
+      }
+      if (load != NULL || (n->Opcode() != Op_LoadB && n->Opcode() != Op_LoadUB)) {
+        return false;
+      }
+      load = n;
+      continue;
+    }
+    if (n->is_If()) {
+      ProjNode* exit = NULL;
+      ProjNode* cont = NULL;
+      for (uint j = 0; j < 2; j++) {
+        ProjNode* proj = n->as_If()->proj_out(j);
+        if (is_member(phase->get_loop(proj))) {
+          cont = proj;
+        } else {
+          exit = proj;
+        }
+      }
+      if (exit == NULL || cont == NULL || !n->in(1)->is_Bool()) {
+        return false;
+      }
+      if (exit->is_uncommon_trap_proj(Deoptimization::Reason_none) != NULL) {
+        if (!is_invariant(n->in(1))) {
+          traps.push(n);
+        }
+      } else if (match_iff == NULL) {
+        match_iff = n->as_If();
+      } else {
+        return false;
+      }
+    }
+  }
+  if (load == NULL || match_iff == NULL) {
+    return false;
+  }
+
+  // The loaded element must be a[iv] of a loop invariant byte[].
+  Node* adr = load->in(MemNode::Address);
+  if (!adr->is_AddP()) {
+    return false;
+  }
+  Node* base = adr->in(AddPNode::Base);
+  const TypeAryPtr* ary_t = phase->_igvn.type(base)->isa_aryptr();
+  if (ary_t == NULL || ary_t->maybe_null() || ary_t->elem() == Type::BOTTOM ||
+      ary_t->elem()->array_element_basic_type() != T_BYTE) {
+    return false;
+  }
+  int iv_count = 0;
+  jlong con = 0;
+  for (Node* p = adr; p->is_AddP(); p = p->in(AddPNode::Address)) {
+    if (p->in(AddPNode::Base) != base) {
+      return false;
+    }
+    Node* off = p->in(AddPNode::Offset);
+    if (off->is_Con()) {
+      con += phase->_igvn.type(off)->is_long()->get_con();
+    } else if (off->Opcode() == Op_ConvI2L && off->in(1)->uncast() == iv) {
+      iv_count++;
+    } else {
+      return false;
+    }
+    if (!p->in(AddPNode::Address)->is_AddP() && p->in(AddPNode::Address) != base) {
+      return false;
+    }
+  }
+  if (iv_count != 1 || con != arrayOopDesc::base_offset_in_bytes(T_BYTE)) {
+    return false;
+  }
+  Node* mem = load->in(MemNode::Memory);
+  if (phase->C->get_alias_index(load->adr_type()) != phase->C->get_alias_index(TypeAryPtr::BYTES)) {
+    return false;
+  }
+
+  // The loop must exit when the loaded value is equal to a constant.
+  Node* bol = match_iff->in(1);
+  Node* cmp = bol->in(1);
+  if (cmp->Opcode() != Op_CmpI || cmp->in(1) != load || !cmp->in(2)->is_Con()) {
+    return false;
+  }
+  BoolTest::mask exit_test = bol->as_Bool()->_test._test;
+  if (match_iff->proj_out(1) != NULL && is_member(phase->get_loop(match_iff->proj_out(1)))) {
+    exit_test = BoolTest(exit_test).negate();
+  }
+  jint c = cmp->in(2)->get_int();
+  jint c_lo = (load->Opcode() == Op_LoadB) ? min_jbyte : 0;
+  jint c_hi = (load->Opcode() == Op_LoadB) ? max_jbyte : max_jubyte;
+  if (exit_test != BoolTest::eq || c < c_lo || c > c_hi) {
+    return false;
+  }
+
+  // Checks that depend on the iv must be range checks of the searched array:
+  // they pass for every iteration that is skipped.
+  for (uint i = 0; i < traps.size(); i++) {
+    IfNode* iff = traps.at(i)->as_If();
+    BoolNode* rc_bol = iff->in(1)->as_Bool();
+    Node* rc_cmp = rc_bol->in(1);
+    BoolTest::mask cont_test = rc_bol->_test._test;
+    if (!is_member(phase->get_loop(iff->proj_out(1)))) {
+      cont_test = BoolTest(cont_test).negate();
+    }
+    if (cont_test != BoolTest::lt || rc_cmp->Opcode() != Op_CmpU ||
+        rc_cmp->in(1)->uncast() != iv || rc_cmp->in(2)->Opcode() != Op_LoadRange ||
+        rc_cmp->in(2)->in(MemNode::Address)->in(AddPNode::Base)->uncast() != base->uncast()) {
+      return false;
+    }
+  }
+
+  Node* entry = cl->skip_strip_mined()->in(LoopNode::EntryControl);
+  Node* init = cl->init_trip();
+  Node* limit = cl->limit();
+  if (!phase->is_dominator(phase->get_ctrl(base), entry) ||
+      !phase->is_dominator(phase->get_ctrl(mem), entry) ||
+      !phase->is_dominator(phase->get_ctrl(init), entry) ||
+      !phase->is_dominator(phase->get_ctrl(limit), entry)) {
+    return false;
+  }
+
+#ifndef PRODUCT
+  if (TraceLoopOpts) {
+    tty->print("SearchLoop   ");
+    this->dump_head();
+  }
+#endif
+
+  // end   = min(limit, a.length)
+  // start = max(init, 0)
+  // cnt   = (init >= 0) ? max(end, start) - start : 0
+  Node* zero = phase->_igvn.intcon(0);
+  Node* len_adr = new AddPNode(base, base, phase->_igvn.MakeConX(arrayOopDesc::length_offset_in_bytes()));
+  phase->register_new_node(len_adr, entry);
+  Node* len = new LoadRangeNode(NULL, phase->C->immutable_memory(), len_adr, TypeInt::POS);
+  phase->register_new_node(len, entry);
+  Node* end = new MinINode(limit, len);
+  phase->register_new_node(end, entry);
+  Node* start = new MaxINode(init, zero);
+  phase->register_new_node(start, entry);
+  Node* end_start = new MaxINode(end, start);
+  phase->register_new_node(end_start, entry);
+  Node* range = new SubINode(end_start, start);
+  phase->register_new_node(range, entry);
+  Node* init_cmp = new CmpINode(init, zero);
+  phase->register_new_node(init_cmp, entry);
+  Node* init_bol = new BoolNode(init_cmp, BoolTest::ge);
+  phase->register_new_node(init_bol, entry);
+  Node* cnt = new CMoveINode(init_bol, zero, range, TypeInt::POS);
+  phase->register_new_node(cnt, entry);
+
+  Node* start_l = new ConvI2LNode(start);
+  phase->register_new_node(start_l, entry);
+  Node* src = new AddPNode(base, base, start_l);
+  phase->register_new_node(src, entry);
+  src = new AddPNode(base, src, phase->_igvn.MakeConX(arrayOopDesc::base_offset_in_bytes(T_BYTE)));
+  phase->register_new_node(src, entry);
+  Node* found = new StrIndexOfCharNode(entry, mem, src, cnt, phase->_igvn.intcon(c & 0xFF), StrIntrinsicNode::L);
+  phase->register_new_node(found, entry);
+
+  // new_init = (cnt > 0) ? start + ((found < 0) ? cnt - 1 : found) : init
+  Node* last = new AddINode(cnt, phase->_igvn.intcon(-1));
+  phase->register_new_node(last, entry);
+  Node* found_cmp = new CmpINode(found, zero);
+  phase->register_new_node(found_cmp, entry);
+  Node* found_bol = new BoolNode(found_cmp, BoolTest::lt);
+  phase->register_new_node(found_bol, entry);
+  Node* skip = new CMoveINode(found_bol, found, last, TypeInt::INT);
+  phase->register_new_node(skip, entry);
+  Node* skipped = new AddINode(start, skip);
+  phase->register_new_node(skipped, entry);
+  Node* cnt_cmp = new CmpINode(cnt, zero);
+  phase->register_new_node(cnt_cmp, entry);
+  Node* cnt_bol = new BoolNode(cnt_cmp, BoolTest::gt);
+  phase->register_new_node(cnt_bol, entry);
+  Node* new_init = new CMoveINode(cnt_bol, init, skipped, TypeInt::INT);
+  phase->register_new_node(new_init, entry);
+
+  phase->_igvn.replace_input_of(iv, LoopNode::EntryControl, new_init);
+  cl->set_nonexact_trip_count();
+  cl->mark_search_fast_forwarded();
+  return true;
+}
+
 //=============================================================================
 //------------------------------iteration_split_impl---------------------------
 bool IdealLoopTree::iteration_split_impl(PhaseIdealLoop *phase, Node_List &old_new) {
@@ -3255,6 +3524,7 @@ bool IdealLoopTree::iteration_split_impl(PhaseIdealLoop *phase, Node_List &old_n
       phase->do_maximally_unroll(this,old_new);
       return true;
     }
+    do_search_loop_fast_forward(phase);
   }
 
   // Skip next optimizations if running low on nodes. Note that
@@ -32,11 +32,13 @@
 #include "memory/resourceArea.hpp"
 #include "opto/addnode.hpp"
 #include "opto/callnode.hpp"
+#include "opto/castnode.hpp"
 #include "opto/connode.hpp"
 #include "opto/convertnode.hpp"
 #include "opto/divnode.hpp"
 #include "opto/idealGraphPrinter.hpp"
 #include "opto/loopnode.hpp"
+#include "opto/movenode.hpp"
 #include "opto/mulnode.hpp"
 #include "opto/rootnode.hpp"
 #include "opto/superword.hpp"
@@ -294,6 +296,21 @@ IdealLoopTree* PhaseIdealLoop::create_outer_strip_mined_loop(BoolNode *test, Nod
   LoopNode *outer_l = new OuterStripMinedLoopNode(C, init_control, outer_ift);
   entry_control = outer_l;
 
+  IdealLoopTree* outer_ilt = insert_outer_loop(loop, outer_l, outer_ift);
+
+  set_loop(iffalse, outer_ilt);
+  register_control(outer_le, outer_ilt, iffalse);
+  register_control(outer_ift, outer_ilt, outer_le);
+  set_idom(outer_iff, outer_le, dom_depth(outer_le));
+  _igvn.register_new_node_with_optimizer(outer_l);
+  set_loop(outer_l, outer_ilt);
+  set_idom(outer_l, init_control, dom_depth(init_control)+1);
+
+  return outer_ilt;
+}
+
+// Insert a new loop tree node for 'outer_l' between 'loop' and its parent.
+IdealLoopTree* PhaseIdealLoop::insert_outer_loop(IdealLoopTree* loop, LoopNode* outer_l, Node* outer_ift) {
   IdealLoopTree* outer_ilt = new IdealLoopTree(this, outer_l, outer_ift);
   IdealLoopTree* parent = loop->_parent;
   IdealLoopTree* sibling = parent->_child;
@@ -313,15 +330,6 @@ IdealLoopTree* PhaseIdealLoop::create_outer_strip_mined_loop(BoolNode *test, Nod
   loop->_next = NULL;
   loop->_nest++;
   assert(loop->_nest <= SHRT_MAX, "sanity");
-
-  set_loop(iffalse, outer_ilt);
-  register_control(outer_le, outer_ilt, iffalse);
-  register_control(outer_ift, outer_ilt, outer_le);
-  set_idom(outer_iff, outer_le, dom_depth(outer_le));
-  _igvn.register_new_node_with_optimizer(outer_l);
-  set_loop(outer_l, outer_ilt);
-  set_idom(outer_l, init_control, dom_depth(init_control)+1);
-
   return outer_ilt;
 }
 
@@ -350,6 +358,243 @@ void PhaseIdealLoop::insert_loop_limit_check(ProjNode* limit_check_proj, Node* c
 #endif
 }
 
+//------------------------------is_long_counted_loop---------------------------
+// Transform a loop with a long induction variable into a nest of an outer
+// long loop and an inner loop with an int induction variable that can be
+// converted to a counted loop:
+//
+//   for (long phi = init; phi < limit; phi += stride) {
+//     ... use phi ...
+//   }
+//
+// becomes
+//
+//   for (long outer_phi = init; outer_phi < limit; outer_phi += inner_phi) {
+//     int inner_limit = (int) MIN(limit - outer_phi, max_jint - 2 * stride);
+//     for (int inner_phi = 0; inner_phi < inner_limit; inner_phi += stride) {
+//       ... use (outer_phi + inner_phi) ...
+//     }
+//   }
+//
+// The exit test of the original loop is kept in the outer loop so the
+// inner limit only needs to be a lower bound of the remaining number of
+// iterations. The loop safepoint is cloned into the outer loop.
+bool PhaseIdealLoop::is_long_counted_loop(Node* x, IdealLoopTree*& loop) {
+  if (!UseLongLoopNest || x->Opcode() != Op_Loop || x->as_Loop()->is_long_loop_nest() ||
+      x->in(LoopNode::Self) == NULL || x->req() != 3 ||
+      loop->_irreducible || loop->_child != NULL) {
+    return false;
+  }
+  Node* init_control = x->in(LoopNode::EntryControl);
+  Node* back_control = x->in(LoopNode::LoopBackControl);
+  if (init_control == NULL || back_control == NULL ||
+      init_control->is_top() || back_control->is_top()) {
+    return false;
+  }
+
+  // The loop must be exited at the bottom by a long compare
+  // right after a safepoint.
+  Node* iftrue = back_control;
+  uint iftrue_op = iftrue->Opcode();
+  if (iftrue_op != Op_IfTrue && iftrue_op != Op_IfFalse) {
+    return false;
+  }
+  Node* iff = iftrue->in(0);
+  if (iff->Opcode() != Op_If || get_loop(iff) != loop || !iff->in(1)->is_Bool()) {
+    return false;
+  }
+  Node* sfpt = iff->in(0);
+  if (sfpt->Opcode() != Op_SafePoint || get_loop(sfpt) != loop) {
+    return false;
+  }
+  BoolNode* test = iff->in(1)->as_Bool();
+  BoolTest::mask bt = test->_test._test;
+  if (iftrue_op == Op_IfFalse) {
+    bt = BoolTest(bt).negate();
+  }
+  Node* cmp = test->in(1);
+  if (cmp->Opcode() != Op_CmpL) {
+    return false;
+  }
+  Node* incr  = cmp->in(1);
+  Node* limit = cmp->in(2);
+  bool swapped = false;
+  if (!is_member(loop, get_ctrl(incr))) {
+    Node* tmp = incr;
+    incr = limit;
+    limit = tmp;
+    bt = BoolTest(bt).commute();
+    swapped = true;
+  }
+  if (is_member(loop, get_ctrl(limit)) || !is_member(loop, get_ctrl(incr))) {
+    return false;
+  }
+
+  // Find the induction variable and its constant stride.
+  Node* phi_incr = NULL;
+  if (incr->is_Phi()) {
+    if (incr->in(0) != x || incr->req() != 3) {
+      return false;
+    }
+    phi_incr = incr;
+    incr = phi_incr->in(LoopNode::LoopBackControl);
+  }
+  if (incr->Opcode() != Op_AddL) {
+    return false;
+  }
+  Node* xphi = incr->in(1);
+  Node* stride = incr->in(2);
+  if (!stride->is_Con()) {
+    Node* tmp = xphi;
+    xphi = stride;
+    stride = tmp;
+  }
+  if (!stride->is_Con() || !xphi->is_Phi() || xphi->in(0) != x ||
+      (phi_incr != NULL && phi_incr != xphi) ||
+      xphi->in(LoopNode::LoopBackControl) != incr) {
+    return false;
+  }
+  PhiNode* phi = xphi->as_Phi();
+  jlong stride_con = stride->get_long();
+  if (stride_con == 0 || stride_con > (max_jint >> 2) || stride_con < -(max_jint >> 2)) {
+    return false;
+  }
+  if (stride_con > 0 ? (bt != BoolTest::lt && bt != BoolTest::le)
+                     : (bt != BoolTest::gt && bt != BoolTest::ge)) {
+    return false;
+  }
+
+  // =================================================
+  // ---- SUCCESS!   Found A Long Counted Loop!  -----
+  //
+  Node* iffalse = iff->as_If()->proj_out(iftrue_op != Op_IfTrue);
+
+  // Build the control flow of the outer loop: the inner loop now exits
+  // to a copy of the safepoint and the original exit test.
+  Node* inner_exit = iffalse->clone();
+  Node* outer_sfpt = sfpt->clone();
+  outer_sfpt->set_req(0, inner_exit);
+  IfNode* outer_iff = new IfNode(outer_sfpt, test, iff->as_If()->_prob, iff->as_If()->_fcnt);
+  Node* outer_back = iftrue->clone();
+  outer_back->set_req(0, outer_iff);
+  LoopNode* outer_head = new LoopNode(init_control, outer_back);
+  outer_head->mark_long_loop_nest();
+
+  IdealLoopTree* outer_ilt = insert_outer_loop(loop, outer_head, outer_back);
+  outer_ilt->_has_sfpt = 1;
+  outer_ilt->_has_call = loop->_has_call;
+  _igvn.register_new_node_with_optimizer(outer_head);
+  set_loop(outer_head, outer_ilt);
+  set_idom(outer_head, init_control, dom_depth(init_control)+1);
+  register_control(inner_exit, outer_ilt, iff);
+  register_control(outer_sfpt, outer_ilt, inner_exit);
+  register_control(outer_iff, outer_ilt, outer_sfpt);
+  register_control(outer_back, outer_ilt, outer_iff);
+  _igvn.replace_input_of(iffalse, 0, outer_iff);
+  set_idom(iffalse, outer_iff, dom_depth(outer_iff)+1);
+  _igvn.replace_input_of(x, LoopNode::EntryControl, outer_head);
+  set_idom(x, outer_head, dom_depth(outer_head)+1);
+
+  // Every Phi of the inner loop gets its value on entry from a Phi of
+  // the outer loop merging the value on the original loop backedge.
+  Node_List inner_phis;
+  for (DUIterator_Fast imax, i = x->fast_outs(imax); i < imax; i++) {
+    Node* u = x->fast_out(i);
+    if (u->is_Phi() && u != phi) {
+      inner_phis.push(u);
+    }
+  }
+  for (uint i = 0; i < inner_phis.size(); i++) {
+    Node* p = inner_phis.at(i);
+    Node* outer_p = p->clone();
+    outer_p->set_req(0, outer_head);
+    register_new_node(outer_p, outer_head);
+    _igvn.replace_input_of(p, LoopNode::EntryControl, outer_p);
+  }
+  Node* outer_phi = phi->clone();
+  outer_phi->set_req(0, outer_head);
+  register_new_node(outer_phi, outer_head);
+
+  // Number of remaining iterations, clamped to the int range of the
+  // inner loop. Computed with an unsigned compare since the long
+  // difference may overflow.
+  jlong iters_cap = max_jint - 2 * ABS(stride_con);
+  Node* diff = new SubLNode(limit, outer_phi);
+  register_new_node(diff, outer_head);
+  Node* dist = diff;
+  if (stride_con < 0) {
+    dist = new SubLNode(outer_phi, limit);
+    register_new_node(dist, outer_head);
+  }
+  Node* cap = _igvn.longcon(iters_cap);
+  set_ctrl(cap, C->root());
+  Node* cmp_cap = new CmpULNode(dist, cap);
+  register_new_node(cmp_cap, outer_head);
+  Node* bol_cap = new BoolNode(cmp_cap, BoolTest::lt);
+  register_new_node(bol_cap, outer_head);
+  Node* clamp = _igvn.longcon(stride_con > 0 ? iters_cap : -iters_cap);
+  set_ctrl(clamp, C->root());
+  Node* clamped = new CMoveLNode(bol_cap, clamp, diff, TypeLong::LONG);
+  register_new_node(clamped, outer_head);
+  // Limit already reached: the inner loop runs a single iteration.
+  Node* cmp_done = new CmpLNode(limit, outer_phi);
+  register_new_node(cmp_done, outer_head);
+  Node* bol_done = new BoolNode(cmp_done, stride_con > 0 ? BoolTest::lt : BoolTest::gt);
+  register_new_node(bol_done, outer_head);
+  Node* done = _igvn.longcon(stride_con > 0 ? -1 : 1);
+  set_ctrl(done, C->root());
+  Node* remaining = new CMoveLNode(bol_done, clamped, done, TypeLong::LONG);
+  register_new_node(remaining, outer_head);
+  Node* inner_limit = new ConvL2INode(remaining);
+  register_new_node(inner_limit, outer_head);
+  const TypeInt* inner_limit_t = (stride_con > 0) ? TypeInt::make(-1, (jint)iters_cap, Type::WidenMin)
+                                                  : TypeInt::make(-(jint)iters_cap, 1, Type::WidenMin);
+  inner_limit = new CastIINode(inner_limit, inner_limit_t);
+  register_new_node(inner_limit, outer_head);
+
+  // The int induction variable of the inner loop.
+  Node* int_zero = _igvn.intcon(0);
+  set_ctrl(int_zero, C->root());
+  Node* int_stride = _igvn.intcon((jint)stride_con);
+  set_ctrl(int_stride, C->root());
+  PhiNode* inner_phi = new PhiNode(x, TypeInt::INT);
+  Node* inner_incr = new AddINode(inner_phi, int_stride);
+  inner_phi->init_req(LoopNode::EntryControl, int_zero);
+  inner_phi->init_req(LoopNode::LoopBackControl, inner_incr);
+  register_new_node(inner_phi, x);
+  register_new_node(inner_incr, x);
+  Node* inner_iv = (phi_incr != NULL) ? (Node*)inner_phi : inner_incr;
+  Node* inner_cmp = swapped ? new CmpINode(inner_limit, inner_iv) : new CmpINode(inner_iv, inner_limit);
+  register_new_node(inner_cmp, x);
+  Node* inner_bol = new BoolNode(inner_cmp, test->_test._test);
+  register_new_node(inner_bol, x);
+  _igvn.replace_input_of(iff, 1, inner_bol);
+
+  // Replace the long induction variable.
+  Node* iv = new ConvI2LNode(inner_phi);
+  register_new_node(iv, x);
+  iv = new AddLNode(outer_phi, iv);
+  register_new_node(iv, x);
+  _igvn.replace_node(phi, iv);
+
+#ifndef PRODUCT
+  if (TraceLoopOpts) {
+    tty->print("LongLoopNest ");
+    loop->dump_head();
+  }
+#endif
+
+  // The inner loop and everything below its exit moved one level down
+  // in the dominator tree.
+  recompute_dom_depth();
+
+  C->set_major_progress();
+  IdealLoopTree* inner_ilt = loop;
+  bool counted = is_counted_loop(x, inner_ilt);
+  loop = outer_ilt;
+  return counted;
+}
+
 //------------------------------is_counted_loop--------------------------------
 bool PhaseIdealLoop::is_counted_loop(Node* x, IdealLoopTree*& loop) {
   PhaseGVN *gvn = &_igvn;
@@ -2442,7 +2687,8 @@ void IdealLoopTree::counted_loop( PhaseIdealLoop *phase ) {
 
   IdealLoopTree* loop = this;
   if (_head->is_CountedLoop() ||
-      phase->is_counted_loop(_head, loop)) {
+      phase->is_counted_loop(_head, loop) ||
+      phase->is_long_counted_loop(_head, loop)) {
 
     if (LoopStripMiningIter == 0 || (LoopStripMiningIter > 1 && _child == NULL)) {
       // Indicate we do not need a safepoint here
@@ -2463,9 +2709,10 @@ void IdealLoopTree::counted_loop( PhaseIdealLoop *phase ) {
   }
 
   // Recursively
-  assert(loop->_child != this || (loop->_head->as_Loop()->is_OuterStripMinedLoop() && _head->as_CountedLoop()->is_strip_mined()), "what kind of loop was added?");
-  assert(loop->_child != this || (loop->_child->_child == NULL && loop->_child->_next == NULL), "would miss some loops");
-  if (loop->_child && loop->_child != this) loop->_child->counted_loop(phase);
+  bool long_loop_nest = loop != this && loop->_head->as_Loop()->is_long_loop_nest();
+  assert(long_loop_nest || loop->_child != this || (loop->_head->as_Loop()->is_OuterStripMinedLoop() && _head->as_CountedLoop()->is_strip_mined()), "what kind of loop was added?");
+  assert(long_loop_nest || loop->_child != this || (loop->_child->_child == NULL && loop->_child->_next == NULL), "would miss some loops");
+  if (loop->_child && loop->_child != this && !long_loop_nest) loop->_child->counted_loop(phase);
   if (loop->_next)  loop->_next ->counted_loop(phase);
 }
 
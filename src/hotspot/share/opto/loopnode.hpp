@@ -76,7 +76,9 @@ protected:
          IsMultiversioned=16384,
          StripMined=32768,
          SubwordLoop=65536,
-         ProfileTripFailed=131072};
+         ProfileTripFailed=131072,
+         LongLoopNest=262144,
+         SearchFastForwarded=524288};
   char _unswitch_count;
   enum { _unswitch_max=3 };
   char _postloop_flags;
@@ -101,6 +103,8 @@ public:
   bool is_strip_mined() const { return _loop_flags & StripMined; }
   bool is_profile_trip_failed() const { return _loop_flags & ProfileTripFailed; }
   bool is_subword_loop() const { return _loop_flags & SubwordLoop; }
+  bool is_long_loop_nest() const { return _loop_flags & LongLoopNest; }
+  bool is_search_fast_forwarded() const { return _loop_flags & SearchFastForwarded; }
 
   void mark_partial_peel_failed() { _loop_flags |= PartialPeelFailed; }
   void mark_has_reductions() { _loop_flags |= HasReductions; }
@@ -115,6 +119,8 @@ public:
   void clear_strip_mined() { _loop_flags &= ~StripMined; }
   void mark_profile_trip_failed() { _loop_flags |= ProfileTripFailed; }
   void mark_subword_loop() { _loop_flags |= SubwordLoop; }
+  void mark_long_loop_nest() { _loop_flags |= LongLoopNest; }
+  void mark_search_fast_forwarded() { _loop_flags |= SearchFastForwarded; }
 
   int unswitch_max() { return _unswitch_max; }
   int unswitch_count() { return _unswitch_count; }
@@ -566,6 +572,9 @@ public:
   // Convert one iteration loop into normal code.
   bool do_one_iteration_loop( PhaseIdealLoop *phase );
 
+  // Start a byte[] search loop at the first match found by StrIndexOfChar.
+  bool do_search_loop_fast_forward( PhaseIdealLoop *phase );
+
   // Return TRUE or FALSE if the loop should be peeled or not.  Peel if we can
   // make some loop-invariant test (usually a null-check) happen before the
   // loop.
@@ -579,6 +588,10 @@ public:
   // the loop is a CountedLoop and the body is small enough.
   bool policy_unroll(PhaseIdealLoop *phase);
 
+  // Return TRUE if the loop body locks and unlocks a loop invariant object,
+  // so that unrolling lets the locks of adjacent iterations be coarsened.
+  bool has_invariant_lock_region(PhaseIdealLoop *phase) const;
+
   // Loop analyses to map to a maximal superword unrolling for vectorization.
   void policy_unroll_slp_analysis(CountedLoopNode *cl, PhaseIdealLoop *phase, int future_unroll_ct);
 
@@ -989,6 +1002,8 @@ public:
   virtual Node *transform( Node *a_node ) { return 0; }
 
   bool is_counted_loop(Node* x, IdealLoopTree*& loop);
+  bool is_long_counted_loop(Node* x, IdealLoopTree*& loop);
+  IdealLoopTree* insert_outer_loop(IdealLoopTree* loop, LoopNode* outer_l, Node* outer_ift);
   IdealLoopTree* create_outer_strip_mined_loop(BoolNode *test, Node *cmp, Node *init_control,
                                                IdealLoopTree* loop, float cl_prob, float le_fcnt,
                                                Node*& entry_control, Node*& iffalse);
@@ -1413,6 +1428,8 @@ class CountedLoopReserveKit {
     ~CountedLoopReserveKit();
     void use_new()                {_use_new = true;}
     void set_iff(IfNode* x)       {_iff = x;}
+    IfNode* iff()           const { return _iff;}
+    LoopNode* lp_reserved() const { return _lp_reserved;}
     bool has_reserved()     const { return _active && _has_reserved;}
   private:
     bool create_reserve();
@@ -1287,6 +1287,70 @@ Node* PhaseMacroExpand::make_store(Node* ctl, Node* mem, Node* base, int offset,
 // slow-path call.
 //
 
+//=============================================================================
+// Allocation coalescing: an instance allocation of constant size that is
+// reached from the fall-through path of another allocation without passing a
+// branch, call or safepoint gets its space reserved by the fast path of the
+// first allocation.  The TLAB top is bumped and checked once for both; the
+// second allocation only does its own TLAB bump when the first one took the
+// slow path.  Each object is still initialized by its own InitializeNode, so
+// captured stores keep eliding the zeroing of the fields they write.
+enum { CoalescingWalkLimit = 16 };
+
+// Find the allocation that the fast path of alloc can reserve space for.
+AllocateNode* PhaseMacroExpand::coalescing_follower(AllocateNode* alloc) {
+  if (!CoalesceAllocations || !UseTLAB ||
+      C->env()->dtrace_alloc_probes() || C->env()->dtrace_extended_probes()) {
+    return NULL;
+  }
+  // Only pairs are coalesced. An allocation whose space is reserved by a
+  // preceding one has no fast path result that dominates a follower.
+  if (_coalesced_oops[alloc->_idx] != NULL || coalescing_leader(alloc) != NULL) {
+    return NULL;
+  }
+  Node* n = alloc->proj_out_or_null(TypeFunc::Control);
+  for (int i = 0; n != NULL && i < CoalescingWalkLimit; i++) {
+    Node* next = n->is_Catch() ? n->as_Catch()->proj_out_or_null(CatchProjNode::fall_through_index)
+                               : n->unique_ctrl_out();
+    if (next == NULL) {
+      return NULL;
+    }
+    if (next->is_Allocate()) {
+      AllocateNode* follower = next->as_Allocate();
+      if (follower->is_AllocateArray() ||
+          _igvn.find_int_con(follower->in(AllocateNode::InitialTest), -1) != 0 ||
+          !follower->in(AllocateNode::AllocSize)->is_Con()) {
+        return NULL;
+      }
+      return follower;
+    }
+    if (!next->is_Proj() && !next->is_Catch() && !next->is_MemBar()) {
+      return NULL;
+    }
+    n = next;
+  }
+  return NULL;
+}
+
+// Find the not yet expanded allocation that reserves space for alloc.
+AllocateNode* PhaseMacroExpand::coalescing_leader(AllocateNode* alloc) {
+  if (!CoalesceAllocations) {
+    return NULL;
+  }
+  Node* n = alloc->in(TypeFunc::Control);
+  for (int i = 0; n != NULL && i < CoalescingWalkLimit; i++) {
+    if (n->is_Allocate()) {
+      AllocateNode* leader = n->as_Allocate();
+      return (coalescing_follower(leader) == alloc) ? leader : NULL;
+    }
+    if (!n->is_Proj() && !n->is_Catch() && !n->is_MemBar()) {
+      return NULL;
+    }
+    n = n->in(0);
+  }
+  return NULL;
+}
+
 void PhaseMacroExpand::expand_allocate_common(
             AllocateNode* alloc, // allocation node to be expanded
             Node* length,  // array length for an array allocation
@@ -1363,6 +1427,28 @@ void PhaseMacroExpand::expand_allocate_common(
       mem = mem->as_MergeMem()->memory_at(Compile::AliasIdxRaw);
     }
 
+    // Space for the next allocation is reserved together with this one.
+    AllocateNode* follower = coalescing_follower(alloc);
+
+    // Use the space the preceding allocation reserved, if it did.
+    Node* reserved_oop = UseTLAB ? _coalesced_oops[alloc->_idx] : NULL;
+    Node* reserved_ctrl = NULL;
+    Node* reserved_rawmem = mem;
+    Node* reserved_i_o = i_o;
+    if (reserved_oop != NULL) {
+      Node* reserved_cmp = new CmpPNode(reserved_oop, makecon(TypeRawPtr::NULL_PTR));
+      transform_later(reserved_cmp);
+      Node* reserved_bol = new BoolNode(reserved_cmp, BoolTest::ne);
+      transform_later(reserved_bol);
+      IfNode* reserved_iff = new IfNode(toobig_false, reserved_bol, PROB_LIKELY_MAG(4), COUNT_UNKNOWN);
+      transform_later(reserved_iff);
+      reserved_ctrl = new IfTrueNode(reserved_iff);
+      transform_later(reserved_ctrl);
+      toobig_false = new IfFalseNode(reserved_iff);
+      transform_later(toobig_false);
+      ctrl = toobig_false;
+    }
+
     Node* eden_top_adr;
     Node* eden_end_adr;
 
@@ -1414,8 +1500,19 @@ void PhaseMacroExpand::expand_allocate_common(
     // Add to heap top to get a new heap top
     Node *new_eden_top = new AddPNode(top(), old_eden_top, size_in_bytes);
     transform_later(new_eden_top);
+    // The following allocation starts at new_eden_top on the fast path
+    Node* reserved_top = new_eden_top;
+    if (follower != NULL) {
+      reserved_top = new AddPNode(top(), new_eden_top, follower->in(AllocateNode::AllocSize));
+      transform_later(reserved_top);
+      Node* follower_oop = new PhiNode(result_region, TypeRawPtr::BOTTOM);
+      follower_oop->init_req(slow_result_path, makecon(TypeRawPtr::NULL_PTR));
+      follower_oop->init_req(fast_result_path, new_eden_top);
+      transform_later(follower_oop);
+      _coalesced_oops.map(follower->_idx, follower_oop);
+    }
     // Check for needing a GC; compare against heap end
-    Node *needgc_cmp = new CmpPNode(new_eden_top, eden_end);
+    Node *needgc_cmp = new CmpPNode(reserved_top, eden_end);
     transform_later(needgc_cmp);
     Node *needgc_bol = new BoolNode(needgc_cmp, BoolTest::ge);
     transform_later(needgc_bol);
@@ -1442,7 +1539,7 @@ void PhaseMacroExpand::expand_allocate_common(
     result_phi_i_o->init_req(slow_result_path, i_o);
 
     i_o = prefetch_allocation(i_o, needgc_false, contended_phi_rawmem,
-                              old_eden_top, new_eden_top, length);
+                              old_eden_top, reserved_top, length);
 
     // Name successful fast-path variables
     Node* fast_oop = old_eden_top;
@@ -1455,7 +1552,7 @@ void PhaseMacroExpand::expand_allocate_common(
     if (UseTLAB) {
       Node* store_eden_top =
         new StorePNode(needgc_false, contended_phi_rawmem, eden_top_adr,
-                              TypeRawPtr::BOTTOM, new_eden_top, MemNode::unordered);
+                              TypeRawPtr::BOTTOM, reserved_top, MemNode::unordered);
       transform_later(store_eden_top);
       fast_oop_ctrl = needgc_false; // No contention, so this is the fast path
       fast_oop_rawmem = store_eden_top;
@@ -1502,6 +1599,31 @@ void PhaseMacroExpand::expand_allocate_common(
                                    0, new_alloc_bytes, T_LONG);
     }
 
+    if (reserved_ctrl != NULL) {
+      // Merge the reserved space with the regular TLAB bump, the object
+      // is initialized the same way on both paths.
+      RegionNode* reserved_region = new RegionNode(3);
+      PhiNode* reserved_phi_rawoop = new PhiNode(reserved_region, TypeRawPtr::BOTTOM);
+      PhiNode* reserved_phi_rawmem = new PhiNode(reserved_region, Type::MEMORY, TypeRawPtr::BOTTOM);
+      PhiNode* reserved_phi_i_o = new PhiNode(reserved_region, Type::ABIO);
+      reserved_region    ->init_req(1, fast_oop_ctrl);
+      reserved_phi_rawoop->init_req(1, fast_oop);
+      reserved_phi_rawmem->init_req(1, fast_oop_rawmem);
+      reserved_phi_i_o   ->init_req(1, i_o);
+      reserved_region    ->init_req(2, reserved_ctrl);
+      reserved_phi_rawoop->init_req(2, reserved_oop);
+      reserved_phi_rawmem->init_req(2, reserved_rawmem);
+      reserved_phi_i_o   ->init_req(2, reserved_i_o);
+      transform_later(reserved_region);
+      transform_later(reserved_phi_rawoop);
+      transform_later(reserved_phi_rawmem);
+      transform_later(reserved_phi_i_o);
+      fast_oop_ctrl = reserved_region;
+      fast_oop = reserved_phi_rawoop;
+      fast_oop_rawmem = reserved_phi_rawmem;
+      i_o = reserved_phi_i_o;
+    }
+
     InitializeNode* init = alloc->initialization();
     fast_oop_rawmem = initialize_object(alloc,
                                         fast_oop_ctrl, fast_oop_rawmem, fast_oop,
@@ -2648,6 +2770,7 @@ bool PhaseMacroExpand::expand_macro_nodes() {
   // Last attempt to eliminate macro nodes.
   eliminate_macro_nodes();
   if (C->failing())  return true;
+  AbstractLockNode::post_coarsening_events(C);
 
   // Make sure expansion will not cause node limit to be exceeded.
   // Worst case is a macro node gets expanded into about 200 nodes.
@@ -2740,6 +2863,13 @@ bool PhaseMacroExpand::expand_macro_nodes() {
       C->remove_macro_node(n);
       continue;
     }
+    if (n->is_Allocate()) {
+      // Expand an allocation that reserves space for this one first
+      AllocateNode* leader = coalescing_leader(n->as_Allocate());
+      if (leader != NULL) {
+        n = leader;
+      }
+    }
     switch (n->class_id()) {
     case Node::Class_Allocate:
       expand_allocate(n->as_Allocate());
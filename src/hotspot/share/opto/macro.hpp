@@ -92,7 +92,12 @@ private:
 
   // Additional data collected during macro expansion
   bool _has_locks;
+  // Address reserved for an allocation by the allocation preceding it,
+  // indexed by the _idx of the following allocation
+  Node_Array _coalesced_oops;
 
+  AllocateNode* coalescing_follower(AllocateNode* alloc);
+  AllocateNode* coalescing_leader(AllocateNode* alloc);
   void expand_allocate(AllocateNode *alloc);
   void expand_allocate_array(AllocateArrayNode *alloc);
   void expand_allocate_common(AllocateNode* alloc,
@@ -203,7 +208,8 @@ private:
   Node* make_arraycopy_load(ArrayCopyNode* ac, intptr_t offset, Node* ctl, Node* mem, BasicType ft, const Type *ftype, AllocateNode *alloc);
 
 public:
-  PhaseMacroExpand(PhaseIterGVN &igvn) : Phase(Macro_Expand), _igvn(igvn), _has_locks(false) {
+  PhaseMacroExpand(PhaseIterGVN &igvn) : Phase(Macro_Expand), _igvn(igvn), _has_locks(false),
+    _coalesced_oops(Thread::current()->resource_area()) {
     _igvn.set_delay_transform(true);
   }
   void eliminate_macro_nodes();
@@ -2310,7 +2310,8 @@ void Matcher::find_shared( Node *n ) {
       case Op_CMoveN:
       case Op_CMoveP:
       case Op_CMoveVF:
-      case Op_CMoveVD:  {
+      case Op_CMoveVD:
+      case Op_CMoveVI:  {
         // Restructure into a binary tree for Matching.  It's possible that
         // we could move this code up next to the graph reshaping for IfNodes
         // or vice-versa, but I do not want to debug this for Ladybird.
@@ -2369,7 +2370,8 @@ void Matcher::find_shared( Node *n ) {
       }
       case Op_CopySignD:
       case Op_SignumF:
-      case Op_SignumD: {
+      case Op_SignumD:
+      case Op_BlendV: {
         Node* pair = new BinaryNode(n->in(2), n->in(3));
         n->set_req(2, pair);
         n->del_req(3);
@@ -322,6 +322,9 @@ public:
   // USII has it, USIII doesn't
   static const bool convL2FSupported(void);
 
+  // Is StrIndexOfChar with Latin1 encoding supported (byte search loops)?
+  static const bool has_latin1_indexof_char(void);
+
   // Vector width in bytes
   static const int vector_width_in_bytes(BasicType bt);
 
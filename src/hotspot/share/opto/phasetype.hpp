@@ -31,6 +31,7 @@ enum CompilerPhaseType {
   PHASE_BEFORE_REMOVEUSELESS,
   PHASE_AFTER_PARSING,
   PHASE_ITER_GVN1,
+  PHASE_AFTER_RARE_ESCAPE_TRAPS,
   PHASE_PHASEIDEAL_BEFORE_EA,
   PHASE_ITER_GVN_AFTER_EA,
   PHASE_ITER_GVN_AFTER_ELIMINATION,
@@ -69,6 +70,7 @@ class CompilerPhaseTypeHelper {
       case PHASE_BEFORE_REMOVEUSELESS:       return "Before RemoveUseless";
       case PHASE_AFTER_PARSING:              return "After Parsing";
       case PHASE_ITER_GVN1:                  return "Iter GVN 1";
+      case PHASE_AFTER_RARE_ESCAPE_TRAPS:    return "After trapping rare escapes";
       case PHASE_PHASEIDEAL_BEFORE_EA:       return "PhaseIdealLoop before EA";
       case PHASE_ITER_GVN_AFTER_EA:          return "Iter GVN after EA";
       case PHASE_ITER_GVN_AFTER_ELIMINATION: return "Iter GVN after eliminating allocations and locks";
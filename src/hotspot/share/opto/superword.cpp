@@ -107,6 +107,7 @@ void SuperWord::transform_loop(IdealLoopTree* lpt, bool do_optimization) {
   bool post_loop_allowed = (PostLoopMultiversioning && Matcher::has_predicated_vectors() && cl->is_post_loop());
   if (post_loop_allowed) {
     if (cl->is_reduction_loop()) return; // no predication mapping
+    if (cl->stride_con() != 1) return; // the mask index counts unit stride iterations
     Node *limit = cl->limit();
     if (limit->is_Con()) return; // non constant limits only
     // Now check the limit for expressions we do not handle
@@ -558,6 +559,19 @@ void SuperWord::SLP_extract() {
 
         // map base types for vector usage
         compute_vector_element_type();
+
+        // Each lane of the masked vectors is one iteration, so every memory
+        // access has to advance by exactly one element per iteration.
+        for (int i = 0; i < _post_block.length(); i++) {
+          Node* n = _post_block.at(i);
+          if (n->is_Mem()) {
+            SWPointer p(n->as_Mem(), this, NULL, false);
+            if (!p.valid() || p.scale_in_bytes() != data_size(n)) {
+              NOT_PRODUCT(if (TraceSuperWord) {tty->print_cr("SuperWord::SLP_extract: post loop memory access is not unit stride"); n->dump();})
+              return;
+            }
+          }
+        }
       } else {
         return;
       }
@@ -1762,7 +1776,11 @@ Node_List* CMoveKit::make_cmovevd_pack(Node_List* cmovd_pk) {
   if (!cmovd->is_CMove()) {
     return NULL;
   }
-  if (cmovd->Opcode() != Op_CMoveF && cmovd->Opcode() != Op_CMoveD) {
+  if (cmovd->Opcode() != Op_CMoveF && cmovd->Opcode() != Op_CMoveD && cmovd->Opcode() != Op_CMoveI) {
+    return NULL;
+  }
+  if (cmovd->Opcode() == Op_CMoveI && !VectorNode::implemented(Op_CMoveI, cmovd_pk->size(), T_INT)) {
+    NOT_PRODUCT(if(_sw->is_trace_cmov()) {tty->print("CMoveKit::make_cmovevd_pack: CMoveI %d has no vector implementation, escaping...", cmovd->_idx); cmovd->dump();})
     return NULL;
   }
   if (pack(cmovd) != NULL) { // already in the cmov pack
@@ -1792,6 +1810,7 @@ Node_List* CMoveKit::make_cmovevd_pack(Node_List* cmovd_pk) {
       || cmpd->outcnt() != 1
       || !_sw->same_generation(cmpd, cmovd)
       || cmpd->in(0) != NULL  // CmpDNode has control flow!!
+      || (cmovd->Opcode() == Op_CMoveI && cmpd->Opcode() != Op_CmpI) // only signed int compares blend
       || _sw->my_pack(cmpd) == NULL) {
       NOT_PRODUCT(if(_sw->is_trace_cmov()) {tty->print("CMoveKit::make_cmovevd_pack: CmpD %d does not fit CMoveD %d for building vector, escaping...", cmpd->_idx, cmovd->_idx); cmpd->dump();})
       return NULL;
@@ -2331,6 +2350,12 @@ void SuperWord::output() {
     return;
   }
 
+  if (can_process_post_loop && !make_reversable.has_reserved()) {
+    // The scalar copy is needed for the trip counts the masked loop cannot handle
+    NOT_PRODUCT(if(is_trace_loop_reverse() || TraceLoopOpts) {tty->print_cr("SWPointer::output: post loop was not reserved, exiting SuperWord");})
+    return;
+  }
+
   for (int i = 0; i < _block.length(); i++) {
     Node* n = _block.at(i);
     Node_List* p = my_pack(n);
@@ -2467,11 +2492,17 @@ void SuperWord::output() {
           ShouldNotReachHere();
         }
 
-        int cond = (int)bol->as_Bool()->_test._test;
-        Node* in_cc  = _igvn.intcon(cond);
+        BoolTest::mask cond = bol->as_Bool()->_test._test;
+        if (bol->in(1)->in(1) == n->in(CMoveNode::IfTrue)) {
+          // The vector node compares IfFalse with IfTrue, test_cmpd_pack()
+          // also accepts compares with the operands the other way around.
+          cond = bol->as_Bool()->_test.commute();
+        }
+        Node* in_cc  = _igvn.intcon((int)cond);
         NOT_PRODUCT(if(is_trace_cmov()) {tty->print("SWPointer::output: created intcon in_cc node %d", in_cc->_idx); in_cc->dump();})
-        Node* cc = bol->clone();
-        cc->set_req(1, in_cc);
+        // The vector rules encode the condition of the Bool, so it must
+        // carry the commuted test as well.
+        Node* cc = new BoolNode(in_cc, cond);
         NOT_PRODUCT(if(is_trace_cmov()) {tty->print("SWPointer::output: created bool cc node %d", cc->_idx); cc->dump();})
 
         Node* src1 = vector_opd(p, 2); //2=CMoveNode::IfFalse
@@ -2492,12 +2523,14 @@ void SuperWord::output() {
         }
         BasicType bt = velt_basic_type(n);
         const TypeVect* vt = TypeVect::make(bt, vlen);
-        assert(bt == T_FLOAT || bt == T_DOUBLE, "Only vectorization for FP cmovs is supported");
+        assert(bt == T_FLOAT || bt == T_DOUBLE || bt == T_INT, "Only vectorization for FP and int cmovs is supported");
         if (bt == T_FLOAT) {
           vn = new CMoveVFNode(cc, src1, src2, vt);
-        } else {
-          assert(bt == T_DOUBLE, "Expected double");
+        } else if (bt == T_DOUBLE) {
           vn = new CMoveVDNode(cc, src1, src2, vt);
+        } else {
+          assert(bt == T_INT, "Expected int");
+          vn = new CMoveVINode(cc, src1, src2, vt);
         }
         NOT_PRODUCT(if(is_trace_cmov()) {tty->print("SWPointer::output: created new CMove node %d: ", vn->_idx); vn->dump();})
       } else if (opc == Op_FmaD || opc == Op_FmaF) {
@@ -2600,6 +2633,27 @@ void SuperWord::output() {
             _igvn.replace_node(incr, new_incr);
             cl->mark_is_multiversioned();
             cl->loopexit()->add_flag(Node::Flag_has_vector_mask_set);
+
+            // The single masked iteration covers at most max_vlen iterations.
+            // That is enough for what remains after the vector main loop, but
+            // not when the main loop was unrolled further or skipped for a
+            // short trip count. Turn the reserve check into a trip count test,
+            // so that the scalar copy handles the longer trips.
+            IfNode* iff = make_reversable.iff();
+            Node* entry = iff->in(0);
+            Node* trip_cnt = new SubINode(cl->limit(), cl->init_trip());
+            _igvn.register_new_node_with_optimizer(trip_cnt);
+            _phase->set_ctrl(trip_cnt, entry);
+            Node* max_trip = _igvn.intcon(max_vlen);
+            Node* cmp = new CmpUNode(trip_cnt, max_trip);
+            _igvn.register_new_node_with_optimizer(cmp);
+            _phase->set_ctrl(cmp, entry);
+            Node* bol = new BoolNode(cmp, BoolTest::le);
+            _igvn.register_new_node_with_optimizer(bol);
+            _phase->set_ctrl(bol, entry);
+            _igvn.replace_input_of(iff, 1, bol);
+            // Keep SuperWord away from the scalar copy
+            make_reversable.lp_reserved()->as_CountedLoop()->set_slp_max_unroll(0);
           }
         }
       }
@@ -2819,6 +2873,12 @@ bool SuperWord::construct_bb() {
         // nodes. Superword optimization does not work with them.
         return false;
       }
+      if (n->is_Vector() || n->is_LoadVector() || n->is_StoreVector() ||
+          n->Opcode() == Op_CmpEqMaskV) {
+        // The loop already uses explicit vector operations
+        // (VectorSupport intrinsics): leave it alone.
+        return false;
+      }
       bb_ct++;
       if (!n->is_CFG()) {
         bool found = false;
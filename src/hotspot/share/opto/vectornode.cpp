@@ -98,6 +98,8 @@ int VectorNode::opcode(int sopc, BasicType bt) {
   case Op_CMoveD:
     assert(bt == T_DOUBLE, "must be");
     return Op_CMoveVD;
+  case Op_CMoveI:
+    return (bt == T_INT ? Op_CMoveVI : 0);
   case Op_DivF:
     assert(bt == T_FLOAT, "must be");
     return Op_DivVF;
@@ -241,6 +243,43 @@ bool VectorNode::implemented(int opc, uint vlen, BasicType bt) {
   return false;
 }
 
+// Map a jdk.internal.misc.VectorSupport operation to the scalar opcode
+// whose vector form implements it for elements of type bt.
+int VectorNode::vector_support_opcode(int op, BasicType bt) {
+  bool is_int = (bt == T_BYTE || bt == T_SHORT || bt == T_INT);
+  switch (op) {
+  case VECTOR_OP_ADD:
+    switch (bt) {
+    case T_LONG:   return Op_AddL;
+    case T_FLOAT:  return Op_AddF;
+    case T_DOUBLE: return Op_AddD;
+    default:       return is_int ? Op_AddI : 0;
+    }
+  case VECTOR_OP_SUB:
+    switch (bt) {
+    case T_LONG:   return Op_SubL;
+    case T_FLOAT:  return Op_SubF;
+    case T_DOUBLE: return Op_SubD;
+    default:       return is_int ? Op_SubI : 0;
+    }
+  case VECTOR_OP_MUL:
+    switch (bt) {
+    case T_LONG:   return Op_MulL;
+    case T_FLOAT:  return Op_MulF;
+    case T_DOUBLE: return Op_MulD;
+    default:       return is_int ? Op_MulI : 0;
+    }
+  case VECTOR_OP_AND:
+    return (bt == T_LONG) ? Op_AndL : (is_int ? Op_AndI : 0);
+  case VECTOR_OP_OR:
+    return (bt == T_LONG) ? Op_OrL : (is_int ? Op_OrI : 0);
+  case VECTOR_OP_XOR:
+    return (bt == T_LONG) ? Op_XorL : (is_int ? Op_XorI : 0);
+  default:
+    return 0;
+  }
+}
+
 bool VectorNode::is_roundopD(Node *n) {
   if (n->Opcode() == Op_RoundDoubleMode) {
     return true;
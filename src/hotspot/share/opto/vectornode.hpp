@@ -71,6 +71,19 @@ class VectorNode : public TypeNode {
   static bool is_invariant_vector(Node* n);
   // [Start, end) half-open range defining which operands are vectors
   static void vector_operands(Node* n, uint* start, uint* end);
+
+  // Operations of jdk.internal.misc.VectorSupport.binaryOp(). The values
+  // must match the OP_* constants of the Java class.
+  enum VectorSupportOp {
+    VECTOR_OP_ADD = 0,
+    VECTOR_OP_SUB = 1,
+    VECTOR_OP_MUL = 2,
+    VECTOR_OP_AND = 3,
+    VECTOR_OP_OR  = 4,
+    VECTOR_OP_XOR = 5
+  };
+  // Scalar opcode of a VectorSupport operation for the element type, or 0
+  static int vector_support_opcode(int op, BasicType bt);
 };
 
 //===========================Vector=ALU=Operations=============================
@@ -302,6 +315,43 @@ public:
   virtual int Opcode() const;
 };
 
+//------------------------------CMoveVINode--------------------------------------
+// Vector int conditional move
+class CMoveVINode : public VectorNode {
+public:
+  CMoveVINode(Node* in1, Node* in2, Node* in3, const TypeVect* vt) : VectorNode(in1, in2, in3, vt) {}
+  virtual int Opcode() const;
+};
+
+//------------------------------BlendVNode-------------------------------------
+// Vector blend: selects the lane of in(3) where the lane of the mask in(1)
+// is all ones and the lane of in(2) where it is zero.
+class BlendVNode : public VectorNode {
+public:
+  BlendVNode(Node* mask, Node* in1, Node* in2, const TypeVect* vt) : VectorNode(mask, in1, in2, vt) {}
+  virtual int Opcode() const;
+};
+
+//------------------------------ShuffleVBNode----------------------------------
+// Vector byte shuffle: lane i is in(1)[in(2)[i] & (length - 1)], or zero
+// when the index lane in(2)[i] is negative.
+class ShuffleVBNode : public VectorNode {
+public:
+  ShuffleVBNode(Node* in1, Node* in2, const TypeVect* vt) : VectorNode(in1, in2, vt) {}
+  virtual int Opcode() const;
+};
+
+//------------------------------CmpEqMaskVNode---------------------------------
+// Compare two vectors lane by lane: bit i of the int result is set when
+// lane i of in(1) equals lane i of in(2).
+class CmpEqMaskVNode : public Node {
+public:
+  CmpEqMaskVNode(Node* in1, Node* in2) : Node(NULL, in1, in2) {}
+  virtual int Opcode() const;
+  virtual const Type* bottom_type() const { return TypeInt::INT; }
+  virtual uint ideal_reg() const { return Op_RegI; }
+};
+
 //------------------------------MulReductionVINode--------------------------------------
 // Vector multiply int as a reduction
 class MulReductionVINode : public ReductionNode {
@@ -48,6 +48,7 @@
 #include "runtime/objectMonitor.hpp"
 #include "runtime/objectMonitor.inline.hpp"
 #include "runtime/signature.hpp"
+#include "runtime/synchronizer.hpp"
 #include "runtime/thread.inline.hpp"
 #include "runtime/threadSMR.hpp"
 #include "runtime/vframe.hpp"
@@ -811,8 +812,10 @@ JvmtiEnvBase::get_stack_trace(JavaThread *java_thread,
   uint32_t debug_bits = 0;
 #endif
   assert((SafepointSynchronize::is_at_safepoint() ||
+          java_thread == Thread::current() ||
+          java_thread->has_handshake() ||
           java_thread->is_thread_fully_suspended(false, &debug_bits)),
-         "at safepoint or target thread is suspended");
+         "at safepoint, in a handshake or target thread is suspended");
   int count = 0;
   if (java_thread->has_last_Java_frame()) {
     RegisterMap reg_map(java_thread, false /* update_map */);
@@ -963,13 +966,17 @@ JvmtiEnvBase::get_object_monitor_usage(JavaThread* calling_thread, jobject objec
     }
 
     address owner = NULL;
+    bool on_lock_stack = false;
     {
       markOop mark = hobj()->mark();
 
       if (!mark->has_monitor()) {
         // this object has a lightweight monitor
 
-        if (mark->has_locker()) {
+        if (UseLightweightLocking) {
+          // a fast-locked object is on its owner's lock stack
+          on_lock_stack = mark->is_fast_locked();
+        } else if (mark->has_locker()) {
           owner = (address)mark->locker(); // save the address of the Lock word
         }
         // implied else: no owner
@@ -984,15 +991,21 @@ JvmtiEnvBase::get_object_monitor_usage(JavaThread* calling_thread, jobject objec
         // can change the owner field from the Lock word to the
         // JavaThread * and it may not have done that yet.
         owner = (address)mon->owner();
+        // An anonymously owned monitor is still fast-locked by its owner.
+        on_lock_stack = UseLightweightLocking && mon->is_owner_anonymous();
       }
     }
 
-    if (owner != NULL) {
+    if (owner != NULL || on_lock_stack) {
       // Use current thread since function can be called from a
       // JavaThread or the VMThread.
       ThreadsListHandle tlh;
       // This monitor is owned so we have to find the owning JavaThread.
-      owning_thread = Threads::owning_thread_from_monitor_owner(tlh.list(), owner);
+      if (on_lock_stack) {
+        owning_thread = Threads::owning_thread_from_object(tlh.list(), hobj());
+      } else {
+        owning_thread = Threads::owning_thread_from_monitor_owner(tlh.list(), owner);
+      }
       // Cannot assume (owning_thread != NULL) here because this function
       // may not have been called at a safepoint and the owning_thread
       // might not be suspended.
@@ -1447,7 +1460,7 @@ JvmtiMonitorClosure::do_monitor(ObjectMonitor* mon) {
     // to the list.
     return;
   }
-  if (mon->owner() == _java_thread ) {
+  if (ObjectSynchronizer::is_monitor_owner(mon, _java_thread)) {
     // Filter out on stack monitors collected during stack walk.
     oop obj = (oop)mon->object();
     bool found = false;
@@ -1562,12 +1575,11 @@ VM_GetCurrentContendedMonitor::doit() {
 }
 
 void
-VM_GetStackTrace::doit() {
-  _result = JVMTI_ERROR_THREAD_NOT_ALIVE;
-  ThreadsListHandle tlh;
-  if (_java_thread != NULL && tlh.includes(_java_thread)
-      && !_java_thread->is_exiting() && _java_thread->threadObj() != NULL) {
-    _result = ((JvmtiEnvBase *)_env)->get_stack_trace(_java_thread,
+GetStackTraceClosure::do_thread(Thread *target) {
+  assert(target->is_Java_thread(), "just checking");
+  JavaThread *jt = (JavaThread *)target;
+  if (!jt->is_exiting() && jt->threadObj() != NULL) {
+    _result = ((JvmtiEnvBase *)_env)->get_stack_trace(jt,
                                                       _start_depth, _max_count,
                                                       _frame_buffer, _count_ptr);
   }
@@ -204,6 +204,9 @@ void VM_RedefineClasses::doit() {
   HandleMark hm(thread);   // make sure any handles created are deleted
                            // before the stack walk again.
 
+  // Deoptimize all compiled code that depends on the redefined classes
+  flush_dependent_code(thread);
+
   for (int i = 0; i < _class_count; i++) {
     redefine_single_class(_class_defs[i].klass, _scratch_classes[i], thread);
   }
@@ -3847,7 +3850,9 @@ void VM_RedefineClasses::transfer_old_native_function_registrations(InstanceKlas
   transfer.transfer_registrations(_matching_old_methods, _matching_methods_length);
 }
 
-// Deoptimize all compiled code that depends on this class.
+// Deoptimize all compiled code that depends on the classes being redefined.
+// This is done once for all classes, before any of them is redefined, so
+// that the thread stacks and the code cache are not walked once per class.
 //
 // If the can_redefine_classes capability is obtained in the onload
 // phase then the compiler has recorded all dependencies from startup.
@@ -3862,13 +3867,18 @@ void VM_RedefineClasses::transfer_old_native_function_registrations(InstanceKlas
 // subsequent calls to RedefineClasses need only throw away code
 // that depends on the class.
 //
-void VM_RedefineClasses::flush_dependent_code(InstanceKlass* ik, TRAPS) {
+void VM_RedefineClasses::flush_dependent_code(TRAPS) {
   assert_locked_or_safepoint(Compile_lock);
 
   // All dependencies have been recorded from startup or this is a second or
   // subsequent use of RedefineClasses
   if (JvmtiExport::all_dependencies_are_recorded()) {
-    CodeCache::flush_evol_dependents_on(ik);
+    ResourceMark rm(THREAD);
+    InstanceKlass** classes = NEW_RESOURCE_ARRAY(InstanceKlass*, _class_count);
+    for (int i = 0; i < _class_count; i++) {
+      classes[i] = get_ik(_class_defs[i].klass);
+    }
+    CodeCache::flush_evol_dependents_on(classes, _class_count);
   } else {
     CodeCache::mark_all_nmethods_for_deoptimization();
 
@@ -3984,9 +3994,6 @@ void VM_RedefineClasses::redefine_single_class(jclass the_jclass,
   JvmtiBreakpoints& jvmti_breakpoints = JvmtiCurrentBreakpoints::get_jvmti_breakpoints();
   jvmti_breakpoints.clearall_in_class_at_safepoint(the_class);
 
-  // Deoptimize all compiled code that depends on this class
-  flush_dependent_code(the_class, THREAD);
-
   _old_methods = the_class->methods();
   _new_methods = scratch_class->methods();
   _the_class = the_class;
@@ -493,7 +493,7 @@ class VM_RedefineClasses: public VM_Operation {
          InstanceKlass* scratch_class,
          constantPoolHandle scratch_cp, int scratch_cp_length, TRAPS);
 
-  void flush_dependent_code(InstanceKlass* ik, TRAPS);
+  void flush_dependent_code(TRAPS);
 
   // lock classes to redefine since constant pool merging isn't thread safe.
   void lock_classes();
@@ -558,6 +558,11 @@ bool JvmtiTagMap::is_empty() {
 // not tagged
 //
 static inline jlong tag_for(JvmtiTagMap* tag_map, oop o) {
+  // Heap walks call this for every object and its class mirror; don't
+  // bother hashing the address when nothing is tagged.
+  if (tag_map->hashmap()->entry_count() == 0) {
+    return 0;
+  }
   JvmtiTagHashmapEntry* entry = tag_map->hashmap()->find(o);
   if (entry == NULL) {
     return 0;
@@ -611,7 +616,7 @@ class CallbackWrapper : public StackObj {
     // record the context
     _tag_map = tag_map;
     _hashmap = tag_map->hashmap();
-    _entry = _hashmap->find(_o);
+    _entry = (_hashmap->entry_count() == 0) ? NULL : _hashmap->find(_o);
 
     // get object tag
     _obj_tag = (_entry == NULL) ? 0 : _entry->tag();
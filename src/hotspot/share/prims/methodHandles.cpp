@@ -39,6 +39,7 @@
 #include "oops/typeArrayOop.inline.hpp"
 #include "prims/methodHandles.hpp"
 #include "runtime/compilationPolicy.hpp"
+#include "runtime/deoptimization.hpp"
 #include "runtime/fieldDescriptor.inline.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/javaCalls.hpp"
@@ -1095,6 +1096,11 @@ void MethodHandles::flush_dependent_nmethods(Handle call_site, Handle target) {
 
   int marked = 0;
   CallSiteDepChange changes(call_site, target);
+  GrowableArray<nmethod*>* marked_nmethods = NULL;
+  if (Deoptimization::use_handshake_deoptimization()) {
+    marked_nmethods = new (ResourceObj::C_HEAP, mtCode) GrowableArray<nmethod*>(16, true, mtCode);
+    changes.collect_marked(marked_nmethods);
+  }
   {
     NoSafepointVerifier nsv;
     MutexLockerEx mu2(CodeCache_lock, Mutex::_no_safepoint_check_flag);
@@ -1103,7 +1109,12 @@ void MethodHandles::flush_dependent_nmethods(Handle call_site, Handle target) {
     DependencyContext deps = java_lang_invoke_MethodHandleNatives_CallSiteContext::vmdependencies(context);
     marked = deps.mark_dependent_nmethods(changes);
   }
-  if (marked > 0) {
+  if (marked_nmethods != NULL) {
+    if (marked > 0) {
+      Deoptimization::deoptimize_marked_with_handshake(marked_nmethods);
+    }
+    delete marked_nmethods;
+  } else if (marked > 0) {
     // At least one nmethod has been marked for deoptimization.
     VM_Deoptimize op;
     VMThread::execute(&op);
@@ -1628,6 +1628,40 @@ size_t Arguments::max_heap_for_compressed_oops() {
   NOT_LP64(ShouldNotReachHere(); return 0);
 }
 
+#ifdef _LP64
+// Selects the smallest object alignment up to CompressedOopsMaxObjectAlignment
+// with which a heap of max_heap_size can still use compressed oops. Each
+// doubling of the alignment doubles the encodable heap. On average it costs
+// half of the added alignment per object in padding, and it saves four bytes
+// per reference field and object array element.
+void Arguments::set_object_alignment_for_compressed_oops(size_t max_heap_size) {
+  if (!FLAG_IS_DEFAULT(ObjectAlignmentInBytes) ||
+      !FLAG_IS_DEFAULT(SurvivorAlignmentInBytes) ||
+      (!FLAG_IS_DEFAULT(UseCompressedOops) && !UseCompressedOops) ||
+      !GCConfig::arguments()->supports_compressed_oops()) {
+    return;
+  }
+  // Space lost to the NULL page, independent of the alignment.
+  uint64_t displacement = OopEncodingHeapMax - max_heap_for_compressed_oops();
+  for (intx alignment = ObjectAlignmentInBytes * 2;
+       alignment <= CompressedOopsMaxObjectAlignment;
+       alignment *= 2) {
+    uint64_t encoding_heap_max = (uint64_t(max_juint) + 1) << exact_log2(alignment);
+    if ((uint64_t)max_heap_size <= encoding_heap_max - displacement) {
+      log_info(gc, heap, coops)("Using " INTX_FORMAT "-byte object alignment for compressed oops "
+                                "with a " SIZE_FORMAT "M heap: about " INTX_FORMAT " bytes of padding "
+                                "per object for 4 bytes saved per reference",
+                                alignment, max_heap_size / M, (alignment - ObjectAlignmentInBytes) / 2);
+      FLAG_SET_ERGO(intx, ObjectAlignmentInBytes, alignment);
+      // Recompute the alignment values, including the default survivor alignment.
+      SurvivorAlignmentInBytes = 0;
+      set_object_alignment();
+      return;
+    }
+  }
+}
+#endif // _LP64
+
 void Arguments::set_use_compressed_oops() {
 #ifndef ZERO
 #ifdef _LP64
@@ -1636,6 +1670,10 @@ void Arguments::set_use_compressed_oops() {
   // to use UseCompressedOops is InitialHeapSize.
   size_t max_heap_size = MAX2(MaxHeapSize, InitialHeapSize);
 
+  if (max_heap_size > max_heap_for_compressed_oops()) {
+    set_object_alignment_for_compressed_oops(max_heap_size);
+  }
+
   if (max_heap_size <= max_heap_for_compressed_oops()) {
 #if !defined(COMPILER1) || defined(TIERED)
     if (FLAG_IS_DEFAULT(UseCompressedOops)) {
@@ -4001,6 +4039,48 @@ jint Arguments::apply_ergo() {
     UseBiasedLocking = false;
   }
 
+  if (UseLightweightLocking) {
+#if !defined(AMD64) || defined(ZERO)
+    warning("Lightweight locking is not supported on this platform"
+            "; ignoring UseLightweightLocking flag." );
+    UseLightweightLocking = false;
+#else
+    // The JVMCI compilers and AOT code emit their own stack-locking
+    if (UseHeavyMonitors || UseAOT JVMCI_ONLY(|| UseJVMCICompiler)) {
+      warning("Lightweight locking is not supported with UseHeavyMonitors, "
+              "AOT or JVMCI compilers; ignoring UseLightweightLocking flag." );
+      UseLightweightLocking = false;
+    } else if (UseBiasedLocking) {
+      if (!FLAG_IS_DEFAULT(UseBiasedLocking)) {
+        warning("Biased Locking is not supported with lightweight locking"
+                "; ignoring UseBiasedLocking flag." );
+      }
+      UseBiasedLocking = false;
+    }
+    // RTM locking expects stack-locked headers
+    if (UseLightweightLocking && UseRTMLocking) {
+      warning("RTM locking optimization is not supported with lightweight locking"
+              "; ignoring UseRTMLocking flag." );
+      UseRTMLocking = false;
+    }
+#endif
+  }
+
+#if !defined(AMD64) || defined(ZERO)
+  if (CriticalNativesInJavaState) {
+    warning("Calling critical natives in the Java thread state is not supported on this platform"
+            "; ignoring CriticalNativesInJavaState flag." );
+    CriticalNativesInJavaState = false;
+  }
+#endif
+
+  // The snapshot process must not share the heap memory with the VM
+  if (HeapDumpInForkedProcess && (UseZGC || !FLAG_IS_DEFAULT(AllocateHeapAt))) {
+    warning("Heap dumps from a forked process are not supported with ZGC or AllocateHeapAt"
+            "; ignoring HeapDumpInForkedProcess flag." );
+    HeapDumpInForkedProcess = false;
+  }
+
 #ifdef CC_INTERP
   // Clear flags not supported on zero.
   FLAG_SET_DEFAULT(ProfileInterpreter, false);
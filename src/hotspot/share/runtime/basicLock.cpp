@@ -62,7 +62,10 @@ void BasicLock::move_to(oop obj, BasicLock* dest) {
   // is small (given the support for inflated fast-path locking in the fast_lock, etc)
   // we'll leave that optimization for another time.
 
-  if (displaced_header()->is_neutral()) {
+  if (UseLightweightLocking) {
+    // A fast-locked object is on the owner's lock stack rather than on
+    // this BasicLock, so there is nothing to move.
+  } else if (displaced_header()->is_neutral()) {
     ObjectSynchronizer::inflate_helper(obj);
     // WARNING: We can not put check here, because the inflation
     // will not update the displaced header. Once BasicLock is inflated,
@@ -36,6 +36,7 @@
 #include "runtime/biasedLocking.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/handshake.hpp"
+#include "runtime/mutexLocker.hpp"
 #include "runtime/task.hpp"
 #include "runtime/threadSMR.hpp"
 #include "runtime/vframe.hpp"
@@ -333,6 +334,7 @@ static HeuristicsResult update_heuristics(oop o, bool allow_rebias) {
   //    and don't allow rebiasing of these objects. Disable
   //    allocation of objects of that type with the bias bit set.
   Klass* k = o->klass();
+  k->atomic_incr_total_biased_lock_revocation_count();
   jlong cur_time = os::javaTimeMillis();
   jlong last_bulk_revocation_time = k->last_biased_lock_bulk_revocation_time();
   int revocation_count = k->biased_lock_revocation_count();
@@ -586,6 +588,60 @@ public:
   }
 };
 
+
+// Revokes the bias of a single object biased toward another live
+// thread. Only the biased thread is stopped, by a handshake, which is
+// sufficient as long as the bias is still held by that thread with the
+// current epoch: no other thread can then acquire or rebias the object
+// without coming back here. Otherwise the closure does nothing and the
+// caller falls back to a VM_RevokeBias safepoint.
+class RevokeOneBias : public HandshakeClosure {
+  Handle _obj;
+  JavaThread* _requesting_thread;
+  JavaThread* _biased_locker;
+  BiasedLocking::Condition _status_code;
+  bool _completed;
+
+public:
+  RevokeOneBias(Handle obj, JavaThread* requesting_thread, JavaThread* biased_locker)
+    : HandshakeClosure("RevokeOneBias")
+    , _obj(obj)
+    , _requesting_thread(requesting_thread)
+    , _biased_locker(biased_locker)
+    , _status_code(BiasedLocking::NOT_BIASED)
+    , _completed(false) {}
+
+  void do_thread(Thread* target) {
+    assert(target == _biased_locker, "wrong thread");
+    oop o = _obj();
+    markOop mark = o->mark();
+    if (!mark->has_bias_pattern()) {
+      _completed = true;
+      return;
+    }
+    markOop prototype_header = o->klass()->prototype_header();
+    if (prototype_header->has_bias_pattern() &&
+        mark->biased_locker() == _biased_locker &&
+        mark->bias_epoch() == prototype_header->bias_epoch()) {
+      ResourceMark rm;
+      log_info(biasedlocking)("Revoking bias with handshake:");
+      _status_code = revoke_bias(o, false, false, _requesting_thread, NULL);
+      _biased_locker->set_cached_monitor_info(NULL);
+      assert(!o->mark()->has_bias_pattern(), "must be revoked");
+      _completed = true;
+    }
+  }
+
+  bool completed() const {
+    return _completed;
+  }
+
+  BiasedLocking::Condition status_code() const {
+    return _status_code;
+  }
+};
+
+
 template <typename E>
 static void set_safepoint_id(E* event) {
   assert(event != NULL, "invariant");
@@ -612,6 +668,15 @@ static void post_revocation_event(EventBiasedLockRevocation* event, Klass* k, VM
   event->commit();
 }
 
+static void post_handshake_revocation_event(EventBiasedLockRevocation* event, Klass* k, JavaThread* biased_locker) {
+  assert(event != NULL, "invariant");
+  assert(k != NULL, "invariant");
+  assert(event->should_commit(), "invariant");
+  event->set_lockClass(k);
+  event->set_previousOwner(JFR_THREAD_ID(biased_locker));
+  event->commit();
+}
+
 static void post_class_revocation_event(EventBiasedLockClassRevocation* event, Klass* k, bool disabled_bias) {
   assert(event != NULL, "invariant");
   assert(k != NULL, "invariant");
@@ -712,6 +777,20 @@ BiasedLocking::Condition BiasedLocking::revoke_and_rebias(Handle obj, bool attem
       }
       return cond;
     } else {
+      JavaThread* biased_locker = mark->biased_locker();
+      if (BiasedLockingRevokeWithHandshakes &&
+          biased_locker != NULL && biased_locker != THREAD) {
+        EventBiasedLockRevocation event;
+        RevokeOneBias revoke(obj, (JavaThread*) THREAD, biased_locker);
+        // If the biased thread has exited, or the bias has moved on in
+        // the meantime, revoke at a safepoint below instead.
+        if (Handshake::execute(&revoke, biased_locker) && revoke.completed()) {
+          if (event.should_commit() && revoke.status_code() != NOT_BIASED) {
+            post_handshake_revocation_event(&event, k, biased_locker);
+          }
+          return revoke.status_code();
+        }
+      }
       EventBiasedLockRevocation event;
       VM_RevokeBias revoke(&obj, (JavaThread*) THREAD);
       VMThread::execute(&revoke);
@@ -858,6 +937,22 @@ int* BiasedLocking::fast_path_entry_count_addr()               { return _counter
 int* BiasedLocking::slow_path_entry_count_addr()               { return _counters.slow_path_entry_count_addr(); }
 
 
+static void print_klass_revocation_count(Klass* const k) {
+  int count = k->total_biased_lock_revocation_count();
+  if (count > 0) {
+    ResourceMark rm;
+    tty->print_cr("#   %s: %d", k->external_name(), count);
+  }
+}
+
+void BiasedLocking::print_counters() {
+  _counters.print();
+  tty->print_cr("# revocations per class:");
+  MutexLockerEx ml(SafepointSynchronize::is_at_safepoint() ? NULL : ClassLoaderDataGraph_lock);
+  ClassLoaderDataGraph::classes_do(print_klass_revocation_count);
+}
+
+
 // BiasedLockingCounters
 
 int BiasedLockingCounters::slow_path_entry_count() {
@@ -182,7 +182,8 @@ public:
   static void revoke_at_safepoint(Handle obj);
   static void revoke_at_safepoint(GrowableArray<Handle>* objs);
 
-  static void print_counters() { _counters.print(); }
+  // Also prints the number of revocations of each class
+  static void print_counters();
   static BiasedLockingCounters* counters() { return &_counters; }
 
   // These routines are GC-related and should not be called by end
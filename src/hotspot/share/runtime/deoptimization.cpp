@@ -33,6 +33,7 @@
 #include "interpreter/bytecode.hpp"
 #include "interpreter/interpreter.hpp"
 #include "interpreter/oopMapCache.hpp"
+#include "logging/log.hpp"
 #include "memory/allocation.inline.hpp"
 #include "memory/oopFactory.hpp"
 #include "memory/resourceArea.hpp"
@@ -47,8 +48,10 @@
 #include "runtime/compilationPolicy.hpp"
 #include "runtime/deoptimization.hpp"
 #include "runtime/frame.inline.hpp"
+#include "runtime/handshake.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/jniHandles.inline.hpp"
+#include "runtime/safepoint.hpp"
 #include "runtime/safepointVerifiers.hpp"
 #include "runtime/sharedRuntime.hpp"
 #include "runtime/signature.hpp"
@@ -795,6 +798,41 @@ int Deoptimization::deoptimize_dependents() {
   return 0;
 }
 
+class DeoptimizeMarkedClosure : public HandshakeClosure {
+ public:
+  DeoptimizeMarkedClosure() : HandshakeClosure("DeoptimizeMarked") {}
+  void do_thread(Thread* thread) {
+    JavaThread* jt = (JavaThread*)thread;
+    jt->deoptimized_wrt_marked_nmethods();
+  }
+};
+
+bool Deoptimization::use_handshake_deoptimization() {
+  // Revoking biases of monitors in deoptimized frames and the register
+  // window patching race both need the target threads at a safepoint.
+  return DeoptimizeWithHandshakes && ThreadLocalHandshakes &&
+         !UseBiasedLocking && !NeedsDeoptSuspend;
+}
+
+void Deoptimization::deoptimize_marked_with_handshake(GrowableArray<nmethod*>* marked) {
+  assert(use_handshake_deoptimization(), "must be");
+  assert(!SafepointSynchronize::is_at_safepoint(), "use VM_Deoptimize at a safepoint");
+
+  // Patch the entries first so that no new activations of the marked
+  // nmethods are created while the threads are handshaked.
+  for (int i = 0; i < marked->length(); i++) {
+    marked->at(i)->make_not_entrant();
+  }
+
+  DeoptimizeMarkedClosure cl;
+  Handshake::execute(&cl);
+
+  for (int i = 0; i < marked->length(); i++) {
+    nmethodLocker::unlock_nmethod(marked->at(i));
+  }
+  log_debug(handshake)("Deoptimized %d nmethods with handshake", marked->length());
+}
+
 Deoptimization::DeoptAction Deoptimization::_unloaded_action
   = Deoptimization::Action_reinterpret;
 
@@ -2283,6 +2321,7 @@ const char* Deoptimization::_trap_reason_name[] = {
   "rtm_state_change",
   "unstable_if",
   "unstable_fused_if",
+  "rare_escape",
 #if INCLUDE_JVMCI
   "aliasing",
   "transfer_to_interpreter",
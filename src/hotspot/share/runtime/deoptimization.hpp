@@ -32,6 +32,8 @@ class ProfileData;
 class vframeArray;
 class MonitorValue;
 class ObjectValue;
+class nmethod;
+template <class E> class GrowableArray;
 
 class Deoptimization : AllStatic {
   friend class VMStructs;
@@ -81,6 +83,7 @@ class Deoptimization : AllStatic {
     Reason_rtm_state_change,      // rtm state change detected
     Reason_unstable_if,           // a branch predicted always false was taken
     Reason_unstable_fused_if,     // fused two ifs that had each one untaken branch. One is now taken.
+    Reason_rare_escape,           // a rare call, through which an allocation escapes, was reached
 #if INCLUDE_JVMCI
     Reason_aliasing,              // optimistic assumption about aliasing failed
     Reason_transfer_to_interpreter, // explicit transferToInterpreter()
@@ -136,6 +139,13 @@ class Deoptimization : AllStatic {
   // corresponding activations are deoptimized.
   static int deoptimize_dependents();
 
+  // Handshake based alternative to a VM_Deoptimize operation for nmethods
+  // collected by a DepChange. The nmethods are made not entrant, then each
+  // thread deoptimizes its activations of marked nmethods in a handshake,
+  // and finally the nmethods are unlocked.
+  static bool use_handshake_deoptimization();
+  static void deoptimize_marked_with_handshake(GrowableArray<nmethod*>* marked);
+
   // Deoptimizes a frame lazily. nmethod gets patched deopt happens on return to the frame
   static void deoptimize(JavaThread* thread, frame fr, RegisterMap *reg_map);
   static void deoptimize(JavaThread* thread, frame fr, RegisterMap *reg_map, DeoptReason reason);
@@ -380,6 +390,8 @@ JVMCI_ONLY(public:)
       return Reason_intrinsic;
     else if (reason == Reason_unstable_fused_if)
       return Reason_range_check;
+    else if (reason == Reason_rare_escape)
+      return Reason_intrinsic;
     else
       return Reason_none;
   }
@@ -247,6 +247,13 @@ define_pd_global(uint64_t,MaxRAM,                    1ULL*G);
           range(8, 256)                                                     \
           constraint(ObjectAlignmentInBytesConstraintFunc,AtParse)          \
                                                                             \
+  experimental(intx, CompressedOopsMaxObjectAlignment, 8,                   \
+          "Largest object alignment that may be selected ergonomically "    \
+          "when the maximum heap size is too large for compressed oops "    \
+          "with the default alignment. 8 disables the selection")           \
+          range(8, 256)                                                     \
+          constraint(ObjectAlignmentInBytesConstraintFunc,AtParse)          \
+                                                                            \
   product(bool, AssumeMP, true,                                             \
           "(Deprecated) Instruct the VM to assume multiple processors are available")\
                                                                             \
@@ -266,6 +273,16 @@ define_pd_global(uint64_t,MaxRAM,                    1ULL*G);
   diagnostic(uint, HandshakeTimeout, 0,                                     \
           "If nonzero set a timeout in milliseconds for handshakes")        \
                                                                             \
+  experimental(bool, ParallelHandshakes, false,                             \
+          "Use the safepoint worker threads of the GC to help the VM "      \
+          "thread execute a handshake for blocked threads. Requires "       \
+          "ThreadLocalHandshakes")                                          \
+                                                                            \
+  experimental(bool, DeoptimizeWithHandshakes, false,                       \
+          "Deoptimize nmethods invalidated by class loading or call site "  \
+          "target changes with a handshake instead of a safepoint. "        \
+          "Requires ThreadLocalHandshakes and -UseBiasedLocking")           \
+                                                                            \
   experimental(bool, AlwaysSafeConstructors, false,                         \
           "Force safe construction, as if all fields are final.")           \
                                                                             \
@@ -435,6 +452,11 @@ define_pd_global(uint64_t,MaxRAM,                    1ULL*G);
   product(bool, CriticalJNINatives, true,                                   \
           "Check for critical JNI entry points")                            \
                                                                             \
+  experimental(bool, CriticalNativesInJavaState, false,                     \
+          "Call critical JNI entry points without leaving the Java "        \
+          "thread state. Safepoints wait for such calls to return, so "     \
+          "they must be short and must not block")                          \
+                                                                            \
   product(bool, UseLegacyJNINameEscaping, false,                            \
           "Use the original JNI name escaping scheme")                      \
                                                                             \
@@ -471,6 +493,10 @@ define_pd_global(uint64_t,MaxRAM,                    1ULL*G);
   diagnostic(bool, UseVectorizedMismatchIntrinsic, false,                   \
           "Enables intrinsification of ArraysSupport.vectorizedMismatch()") \
                                                                             \
+  diagnostic(bool, UseVectorizedHashCodeIntrinsic, false,                   \
+          "Enables intrinsification of StringLatin1.hashCode() and "        \
+          "Arrays.hashCode(int[])")                                         \
+                                                                            \
   diagnostic(bool, UseCopySignIntrinsic, false,                             \
           "Enables intrinsification of Math.copySign")                      \
                                                                             \
@@ -522,6 +548,10 @@ define_pd_global(uint64_t,MaxRAM,                    1ULL*G);
   diagnostic(bool, AbortVMOnSafepointTimeout, false,                        \
           "Abort upon failure to reach safepoint (see SafepointTimeout)")   \
                                                                             \
+  diagnostic(bool, RecordSafepointLastThread, false,                        \
+          "Record the last thread to reach each safepoint and keep the "    \
+          "slowest synchronizations for VM.safepoint_last_threads")         \
+                                                                            \
   diagnostic(bool, AbortVMOnVMOperationTimeout, false,                      \
           "Abort upon failure to complete VM operation promptly")           \
                                                                             \
@@ -674,6 +704,12 @@ define_pd_global(uint64_t,MaxRAM,                    1ULL*G);
           "compression. Otherwise the level must be between 1 and 9.")      \
           range(0, 9)                                                       \
                                                                             \
+  experimental(bool, HeapDumpInForkedProcess, false,                        \
+          "Write heap dumps from a forked copy-on-write snapshot of the "   \
+          "process, so the VM is only paused for the fork. The dump "       \
+          "completes in the background. Not supported on Windows, with "    \
+          "ZGC or with AllocateHeapAt")                                     \
+                                                                            \
   product(ccstr, NativeMemoryTracking, "off",                               \
           "Native memory tracking options")                                 \
                                                                             \
@@ -864,12 +900,23 @@ define_pd_global(uint64_t,MaxRAM,                    1ULL*G);
                                                                             \
   product(bool, MonitorInUseLists, true, "Track Monitors for Deflation")    \
                                                                             \
+  experimental(intx, MonitorSpinMaxWait, 0,                                 \
+          "Do not spin for a monitor whose recent contended enters waited " \
+          "longer than this many microseconds on average (0 is no limit)")  \
+          range(0, max_jint)                                                \
+                                                                            \
   experimental(intx, MonitorUsedDeflationThreshold, 90,                     \
                 "Percentage of used monitors before triggering cleanup "    \
                 "safepoint which deflates monitors (0 is off). "            \
                 "The check is performed on GuaranteedSafepointInterval.")   \
                 range(0, 100)                                               \
                                                                             \
+  experimental(intx, MonitorDeflationBudget, 0,                             \
+          "Maximum number of monitors of a thread's in-use list that are "  \
+          "examined for deflation in one safepoint. The next safepoint "    \
+          "continues where the previous one stopped (0 is unlimited)")      \
+          range(0, max_jint)                                                \
+                                                                            \
   experimental(intx, SyncFlags, 0, "(Unsafe, Unstable) "                    \
                "Experimental Sync flags")                                   \
                                                                             \
@@ -916,6 +963,11 @@ define_pd_global(uint64_t,MaxRAM,                    1ULL*G);
   product(bool, CheckJNICalls, false,                                       \
           "Verify all arguments to JNI calls")                              \
                                                                             \
+  experimental(bool, UseJNIHandleCache, false,                              \
+          "Keep a small per-thread cache of free JNI global and weak "      \
+          "global handles, refilled in batches, to reduce contention on "   \
+          "the handle storage lock. Not used with CheckJNICalls")           \
+                                                                            \
   product(bool, UseFastJNIAccessors, true,                                  \
           "Use optimized versions of Get<Primitive>Field")                  \
                                                                             \
@@ -996,6 +1048,11 @@ define_pd_global(uint64_t,MaxRAM,                    1ULL*G);
           range(500, max_intx)                                              \
           constraint(BiasedLockingDecayTimeFunc,AfterErgo)                  \
                                                                             \
+  experimental(bool, BiasedLockingRevokeWithHandshakes, false,              \
+          "Revoke the bias of an object biased toward another live "        \
+          "thread with a handshake that stops only that thread, "           \
+          "instead of a safepoint")                                         \
+                                                                            \
   product(bool, ExitOnOutOfMemoryError, false,                              \
           "JVM exits on the first occurrence of an out-of-memory error")    \
                                                                             \
@@ -1057,6 +1114,11 @@ define_pd_global(uint64_t,MaxRAM,                    1ULL*G);
   develop(bool, TraceICBuffer, false,                                       \
           "Trace usage of IC buffer")                                       \
                                                                             \
+  product(uintx, InlineCacheBufferSize, 32*K,                               \
+          "Size in bytes of the buffer for inline cache transition stubs. " \
+          "A safepoint is forced to empty it when it is full")              \
+          range(4*K, 1*M)                                                   \
+                                                                            \
   develop(bool, TraceCompiledIC, false,                                     \
           "Trace changes of compiled IC")                                   \
                                                                             \
@@ -1164,6 +1226,16 @@ define_pd_global(uint64_t,MaxRAM,                    1ULL*G);
              "Reduce the number of parallel compiler threads when they "    \
              "are not used")                                                \
                                                                             \
+  experimental(bool, UseCPUAwareCompilerThreads, false,                     \
+          "Start additional compiler threads only while compile tasks "     \
+          "wait longer than CompilerThreadQueueWaitTarget and a processor " \
+          "is idle, and at most for half of the available processors. "     \
+          "Requires UseDynamicNumberOfCompilerThreads")                     \
+                                                                            \
+  experimental(uintx, CompilerThreadQueueWaitTarget, 50,                    \
+          "Average compile queue wait time in milliseconds above which "    \
+          "UseCPUAwareCompilerThreads starts another compiler thread")      \
+                                                                            \
   diagnostic(bool, TraceCompilerThreads, false,                             \
              "Trace creation and removal of compiler threads")              \
                                                                             \
@@ -1268,6 +1340,16 @@ define_pd_global(uint64_t,MaxRAM,                    1ULL*G);
   product(bool, UseCodeAging, true,                                         \
           "Insert counter to detect warm methods")                          \
                                                                             \
+  experimental(bool, ConcurrentCodeCacheAging, false,                       \
+          "Reset nmethod hotness counters from the sweeper thread with "    \
+          "handshakes instead of scanning all stacks in every safepoint "   \
+          "cleanup. Requires ThreadLocalHandshakes")                        \
+                                                                            \
+  experimental(uintx, CodeCacheAgingInterval, 1000,                         \
+          "Interval in milliseconds between nmethod hotness resets with "   \
+          "ConcurrentCodeCacheAging")                                       \
+          range(1, max_jint)                                                \
+                                                                            \
   diagnostic(bool, StressCodeAging, false,                                  \
           "Start with counters compiled in")                                \
                                                                             \
@@ -1313,6 +1395,16 @@ define_pd_global(uint64_t,MaxRAM,                    1ULL*G);
           "If LogVMOutput or LogCompilation is on, save VM output to "      \
           "this file [default: ./hotspot_pid%p.log] (%p replaced with pid)")\
                                                                             \
+  experimental(bool, AsyncLogging, false,                                   \
+          "Write unified logging file outputs from a dedicated thread. "    \
+          "Logging threads only enqueue messages and never block on I/O")   \
+                                                                            \
+  experimental(size_t, AsyncLogBufferSize, 2*M,                             \
+          "Memory budget in bytes for messages waiting to be written "      \
+          "by the asynchronous log writer; messages are dropped when it "   \
+          "is exhausted")                                                   \
+          range(100*K, 50*M)                                                \
+                                                                            \
   product(ccstr, ErrorFile, NULL,                                           \
           "If an error occurs, save the error data to this file "           \
           "[default: ./hs_err_pid%p.log] (%p replaced with pid)")           \
@@ -1336,6 +1428,12 @@ define_pd_global(uint64_t,MaxRAM,                    1ULL*G);
   product(bool, UseHeavyMonitors, false,                                    \
           "use heavyweight instead of lightweight Java monitors")           \
                                                                             \
+  experimental(bool, UseLightweightLocking, false,                          \
+          "Lock objects by clearing the lock bits of their header and "     \
+          "recording them on a per-thread lock stack, instead of "          \
+          "displacing the header into the locking frame. Biased locking "   \
+          "is disabled. Only supported on x86_64")                          \
+                                                                            \
   product(bool, PrintStringTableStatistics, false,                          \
           "print statistics about the StringTable and SymbolTable")         \
                                                                             \
@@ -1658,6 +1756,10 @@ define_pd_global(uint64_t,MaxRAM,                    1ULL*G);
           "(0 means none)")                                                 \
           range(0, max_jint)                                                \
                                                                             \
+  experimental(bool, SafepointCleanupOnlyWhenNeeded, false,                 \
+          "Only run the safepoint cleanup tasks in a safepoint if one of "  \
+          "them has work to do")                                            \
+                                                                            \
   product(intx, SafepointTimeoutDelay, 10000,                               \
           "Delay in milliseconds for option SafepointTimeout")              \
   LP64_ONLY(range(0, max_intx/MICROUNITS))                                  \
@@ -1825,6 +1927,16 @@ define_pd_global(uint64_t,MaxRAM,                    1ULL*G);
           "Maximum size of Metaspaces (in bytes)")                          \
           constraint(MaxMetaspaceSizeConstraintFunc,AfterErgo)              \
                                                                             \
+  experimental(size_t, MetaspaceAllocationCacheSize, 0,                     \
+          "Size in bytes of the per-thread cache used to batch metadata "   \
+          "allocations while a class is parsed by a loader with a "         \
+          "standard metaspace. 0 disables the cache")                       \
+          range(0, 64*K)                                                    \
+                                                                            \
+  experimental(bool, MetaspaceReleaseFreeChunks, false,                     \
+          "Return the memory of free medium and humongous metaspace "       \
+          "chunks to the operating system")                                 \
+                                                                            \
   product(size_t, CompressedClassSpaceSize, 1*G,                            \
           "Maximum size of class area in Metaspace when compressed "        \
           "class pointers are used")                                        \
@@ -1949,6 +2061,26 @@ define_pd_global(uint64_t,MaxRAM,                    1ULL*G);
   product(bool, SegmentedCodeCache, false,                                  \
           "Use a segmented code cache")                                     \
                                                                             \
+  experimental(bool, CodeCacheUseHugePages, false,                          \
+          "Align the code cache and every code heap to "                    \
+          "CodeCacheHugePageSize and advise the OS to back them with "      \
+          "transparent huge pages. Linux only")                             \
+                                                                            \
+  experimental(size_t, CodeCacheHugePageSize, 2*M,                          \
+          "Huge page size used by CodeCacheUseHugePages when large pages "  \
+          "are not configured")                                             \
+          range(os::vm_page_size(), max_uintx)                              \
+                                                                            \
+  experimental(bool, MetaspaceUseHugePages, false,                          \
+          "Align metaspace reservations to the transparent huge page size " \
+          "and advise the OS to back committed metaspace with transparent " \
+          "huge pages. Linux only")                                         \
+                                                                            \
+  experimental(bool, GCDataUseHugePages, false,                             \
+          "Advise the OS to back GC data structures (card table, mark "     \
+          "bitmaps, block offset table) with transparent huge pages, "      \
+          "independently of UseTransparentHugePages. Linux only")           \
+                                                                            \
   product_pd(uintx, ReservedCodeCacheSize,                                  \
           "Reserved code cache size (in bytes) - maximum code cache size")  \
           range(os::vm_page_size(), max_uintx)                              \
@@ -1957,6 +2089,17 @@ define_pd_global(uint64_t,MaxRAM,                    1ULL*G);
           "Size of code heap with non-profiled methods (in bytes)")         \
           range(0, max_uintx)                                               \
                                                                             \
+  experimental(uintx, HotCodeHeapSize, 0,                                   \
+          "Size of a separate code heap at the top of the non-profiled "    \
+          "code heap for tier 4 code the sweeper finds active on stacks, "  \
+          "0 disables it. Requires SegmentedCodeCache")                     \
+          range(0, max_uintx)                                               \
+                                                                            \
+  experimental(intx, HotCodeMinSweeps, 4,                                   \
+          "Number of consecutive sweeps that must find an nmethod active "  \
+          "before it is recompiled into the hot code heap")                 \
+          range(1, max_intx)                                                \
+                                                                            \
   product_pd(uintx, ProfiledCodeHeapSize,                                   \
           "Size of code heap with profiled methods (in bytes)")             \
           range(0, max_uintx)                                               \
@@ -2299,6 +2442,12 @@ define_pd_global(uint64_t,MaxRAM,                    1ULL*G);
           "if coming from AOT")                                             \
           range(0, max_jint)                                                \
                                                                             \
+  experimental(intx, Tier4AOTHotThreshold, 0,                               \
+          "Compile AOT code at tier 4 directly, skipping the profiled "     \
+          "tier, once its invocations plus back edges cross this "          \
+          "threshold. 0 disables")                                          \
+          range(0, max_jint)                                                \
+                                                                            \
   product(intx, Tier4InvocationThreshold, 5000,                             \
           "Compile if number of method invocations crosses this "           \
           "threshold")                                                      \
@@ -2342,6 +2491,20 @@ define_pd_global(uint64_t,MaxRAM,                    1ULL*G);
           "given timeout in milliseconds")                                  \
           range(0, max_intx)                                                \
                                                                             \
+  product(bool, TieredCompileTaskCostAware, false,                          \
+          "Order queued compile tasks by event rate per unit of estimated " \
+          "compile cost instead of by event rate alone")                    \
+                                                                            \
+  product(intx, TieredCompileTaskDeferSize, 0,                              \
+          "Defer compile tasks of methods with more bytecodes than this "   \
+          "while other tasks are queued, 0 disables deferral")              \
+          range(0, max_jint)                                                \
+                                                                            \
+  product(intx, TieredCompileTaskMaxDeferral, 100,                          \
+          "Maximum time in milliseconds a compile task is deferred by "     \
+          "TieredCompileTaskDeferSize")                                     \
+          range(0, max_intx)                                                \
+                                                                            \
   product(intx, TieredStopAtLevel, 4,                                       \
           "Stop at given compilation level")                                \
           range(0, 4)                                                       \
@@ -2351,6 +2514,25 @@ define_pd_global(uint64_t,MaxRAM,                    1ULL*G);
           "thresholds by the specified percentage")                         \
           range(0, max_jint)                                                \
                                                                             \
+  experimental(intx, Tier0ProfilingMinRate, 0,                              \
+          "Only start profiling in interpreter if the rate of invocation "  \
+          "and backedge events, sampled when the profiling thresholds "     \
+          "are reached, is at least this many events per millisecond. "     \
+          "0 disables the sampling")                                        \
+          range(0, max_jint)                                                \
+                                                                            \
+  product(ccstr, CompilationProfileDumpFile, NULL,                          \
+          "Write the methods compiled at tier 4 to this file at VM exit")   \
+                                                                            \
+  product(ccstr, CompilationProfileLoadFile, NULL,                          \
+          "Compile the methods listed in this file, written by "            \
+          "CompilationProfileDumpFile, with lower tiered thresholds")       \
+                                                                            \
+  product(double, CompilationProfileThresholdScaling, 0.1,                  \
+          "Factor for the tier 4 thresholds of the methods listed in "      \
+          "CompilationProfileLoadFile")                                     \
+          range(0.01, 1.0)                                                  \
+                                                                            \
   product(uintx, IncreaseFirstTierCompileThresholdAt, 50,                   \
           "Increase the compile threshold for C1 compilation if the code "  \
           "cache is filled by the specified percentage")                    \
@@ -2499,6 +2681,10 @@ define_pd_global(uint64_t,MaxRAM,                    1ULL*G);
           "shared spaces, and dumps the shared spaces to a file to be "     \
           "used in future JVM runs")                                        \
                                                                             \
+  diagnostic(bool, ArchiveResolvedFieldReferences, true,                    \
+          "Keep the resolved references of boot classes to their own or "   \
+          "inherited instance fields when dumping the shared archive")      \
+                                                                            \
   product(bool, PrintSharedArchiveAndExit, false,                           \
           "Print shared archive file contents")                             \
                                                                             \
@@ -2586,6 +2772,11 @@ define_pd_global(uint64_t,MaxRAM,                    1ULL*G);
           "Number of buckets in the JVM internal Symbol table")             \
           range(minimumSymbolTableSize, 111*defaultSymbolTableSize)         \
                                                                             \
+  experimental(uintx, SymbolFreeListLimit, 8192,                            \
+          "Maximum number of freed C-heap symbols kept for reuse by "       \
+          "symbols of the same size. 0 returns them to the C-heap")         \
+          range(0, max_juint)                                               \
+                                                                            \
   product(bool, UseStringDeduplication, false,                              \
           "Use string deduplication")                                       \
                                                                             \
@@ -2623,6 +2814,15 @@ define_pd_global(uint64_t,MaxRAM,                    1ULL*G);
   product(ccstr, ExtraSharedClassListFile, NULL,                            \
           "Extra classlist for building the CDS archive file")              \
                                                                             \
+  experimental(ccstr, PreloadClassList, NULL,                               \
+          "Load and link the classes in the specified class list, as "      \
+          "written by DumpLoadedClassList, on background threads at "       \
+          "startup")                                                        \
+                                                                            \
+  experimental(uint, PreloadClassListThreads, 2,                            \
+          "Number of threads that load the classes in PreloadClassList")    \
+          range(1, 64)                                                      \
+                                                                            \
   experimental(size_t, ArrayAllocatorMallocLimit,                           \
           SOLARIS_ONLY(64*K) NOT_SOLARIS((size_t)-1),                       \
           "Allocation less than this value will be allocated "              \
@@ -2688,11 +2888,36 @@ define_pd_global(uint64_t,MaxRAM,                    1ULL*G);
   JFR_ONLY(product(ccstr, StartFlightRecording, NULL,                       \
           "Start flight recording with options"))                           \
                                                                             \
+  JFR_ONLY(experimental(uintx, JfrObjectAllocationSampleRate, 150,          \
+          "Maximum number of ObjectAllocationSample events per second. "    \
+          "0 means unlimited"))                                             \
+                                                                            \
+  JFR_ONLY(experimental(uintx, JfrJavaSamplesPerPeriod, 5,                  \
+          "Maximum number of Java threads sampled for ExecutionSample "     \
+          "events per sampling period")                                     \
+          range(1, 64))                                                     \
+                                                                            \
+  JFR_ONLY(experimental(uintx, JfrNativeSamplesPerPeriod, 1,                \
+          "Maximum number of threads in native sampled for "                \
+          "NativeMethodSample events per sampling period")                  \
+          range(1, 16))                                                     \
+                                                                            \
+  JFR_ONLY(experimental(uintx, JfrPathToGcRootsTimeLimit, 0,                \
+          "Maximum time in milliseconds spent searching for paths to GC "   \
+          "roots for old object samples. Chains not found in time are "     \
+          "omitted. 0 means limited only by the recording cutoff"))         \
+                                                                            \
+  JFR_ONLY(experimental(size_t, JfrPathToGcRootsMaxQueueSize, 0,            \
+          "Maximum size in bytes of the edge queue reserved for the "       \
+          "path to GC roots search (at least 32M). 0 means 5% of the "      \
+          "heap"))                                                          \
+                                                                            \
   experimental(bool, UseFastUnorderedTimeStamps, false,                     \
           "Use platform unstable time where supported for timestamps only") \
                                                                             \
   manageable(bool, FreeHeapPhysicalMemory, false,                           \
-          "Free physical memory after fullgc or shrink operation")          \
+          "Free physical memory after fullgc, periodic concurrent cycle "   \
+          "or shrink operation")                                            \
 
 #define VM_FLAGS(develop,                                                   \
                  develop_pd,                                                \
@@ -23,9 +23,11 @@
  */
 
 #include "precompiled.hpp"
+#include "gc/shared/workgroup.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "memory/resourceArea.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/handshake.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/orderAccess.hpp"
@@ -33,6 +35,8 @@
 #include "runtime/semaphore.inline.hpp"
 #include "runtime/task.hpp"
 #include "runtime/thread.hpp"
+#include "runtime/threadSMR.hpp"
+#include "runtime/vm_version.hpp"
 #include "runtime/vmThread.hpp"
 #include "utilities/formatBuffer.hpp"
 #include "utilities/preserveException.hpp"
@@ -61,6 +65,29 @@ public:
 
 Semaphore HandshakeThreadsOperation::_done(0);
 
+// The deferred handshake operation is armed at a safepoint and
+// completed later, so unlike HandshakeThreadsOperation there is no
+// fixed set of threads waiting to be counted down. Completion is
+// instead detected by observing that no thread on the ThreadsList
+// still has the operation.
+class HandshakeDeferredOperation: public HandshakeOperation {
+  HandshakeClosure* volatile _handshake_cl;
+  volatile int               _targets;
+
+public:
+  HandshakeDeferredOperation() : _handshake_cl(NULL), _targets(0) {}
+  void do_handshake(JavaThread* thread);
+
+  int targets() const { return _targets; }
+  const char* name() const { return _handshake_cl->name(); }
+  bool is_pending() const { return _handshake_cl != NULL; }
+
+  void arm(HandshakeClosure* cl, JavaThread* target);
+  void reset();
+};
+
+static HandshakeDeferredOperation _deferred_operation;
+
 // Performing handshakes requires a custom yielding strategy because without it
 // there is a clear performance regression vs plain spinning. We keep track of
 // when we last saw progress by looking at why each targeted thread has not yet
@@ -122,8 +149,8 @@ class HandshakeSpinYield : public StackObj {
     _spin_time_ns = _spin_time_ns > max_spin_time_ns ? max_spin_time_ns : _spin_time_ns;
   }
 
-  void add_result(HandshakeState::ProcessResult pr) {
-    _result_count[current_result_pos()][pr]++;
+  void add_result(HandshakeState::ProcessResult pr, int count = 1) {
+    _result_count[current_result_pos()][pr] += count;
   }
 
   void process() {
@@ -149,6 +176,72 @@ class HandshakeSpinYield : public StackObj {
   }
 };
 
+// The VM thread holds the Threads_lock while it, and any worker threads
+// helping it, execute handshake operations on behalf of other threads.
+static bool processing_for_vmthread() {
+  Thread* current = Thread::current();
+  if (current->is_VM_thread()) {
+    return Threads_lock->owned_by_self();
+  }
+  return current->is_Worker_thread() && Threads_lock->owner() == VMThread::vm_thread();
+}
+
+// Worker threads that help the VM thread execute a handshake operation
+// for threads that are blocked or in native. The threads are claimed one
+// at a time, so a thread that is slow to process does not hold up others.
+class ParallelHandshakeTask : public AbstractGangTask {
+  HandshakeOperation* const _op;
+  ThreadsList* const _list;
+  volatile uint _claimed;
+  volatile int _result_count[HandshakeState::_number_states];
+
+ public:
+  ParallelHandshakeTask(HandshakeOperation* op, ThreadsList* list) :
+      AbstractGangTask("Parallel Handshake"), _op(op), _list(list), _claimed(0) {
+    for (int i = 0; i < HandshakeState::_number_states; i++) {
+      _result_count[i] = 0;
+    }
+  }
+
+  void work(uint worker_id) {
+    for (;;) {
+      uint index = Atomic::add(1u, &_claimed) - 1;
+      if (index >= _list->length()) {
+        return;
+      }
+      HandshakeState::ProcessResult pr = _list->thread_at(index)->handshake_try_process_by_vmThread(_op);
+      Atomic::inc(&_result_count[pr]);
+    }
+  }
+
+  int result_count(int pr) const {
+    return _result_count[pr];
+  }
+};
+
+// Waking up the worker threads only pays off with enough threads to process
+static const uint MinThreadsPerHandshakeWorker = 16;
+
+// The GC's safepoint workers cannot be borrowed here, since handshakes
+// run outside of safepoints. The gang is only used by the VM thread and
+// created on first use.
+static WorkGang* _handshake_workers = NULL;
+
+static WorkGang* handshake_workers(int number_of_threads) {
+  if (!ParallelHandshakes ||
+      (uint)number_of_threads < 2 * MinThreadsPerHandshakeWorker) {
+    return NULL;
+  }
+  if (_handshake_workers == NULL) {
+    uint n = MAX2(1U, VM_Version::parallel_worker_threads());
+    WorkGang* workers = new WorkGang("Handshake Worker", n, false, false);
+    workers->initialize_workers();
+    workers->update_active_workers(n);
+    _handshake_workers = workers;
+  }
+  return _handshake_workers;
+}
+
 class VM_Handshake: public VM_Operation {
   const jlong _handshake_timeout;
  public:
@@ -174,6 +267,9 @@ class VM_Handshake: public VM_Operation {
 
   bool handshake_has_timed_out(jlong start_time);
   static void handle_timeout();
+
+  // Completes any pending deferred operation
+  static void complete_deferred();
 };
 
 bool VM_Handshake::handshake_has_timed_out(jlong start_time) {
@@ -208,6 +304,65 @@ static void log_handshake_info(jlong start_time_ns, const char* name, int target
   }
 }
 
+void VM_Handshake::complete_deferred() {
+  assert(Thread::current()->is_VM_thread(), "should call from vm thread");
+
+  HandshakeDeferredOperation* const op = &_deferred_operation;
+  if (!op->is_pending()) {
+    // Nothing to complete
+    return;
+  }
+
+  const jlong start_time_ns = os::javaTimeNanos();
+  const jlong timeout = TimeHelper::millis_to_counter(HandshakeTimeout);
+  int handshake_executed_by_vm_thread = 0;
+
+  log_trace(handshake)("Begin completing deferred operation by VMThread");
+  HandshakeSpinYield hsy(start_time_ns);
+  for (;;) {
+    if (timeout > 0 && os::javaTimeNanos() >= (start_time_ns + timeout)) {
+      handle_timeout();
+    }
+
+    // Threads that exit before the operation has been executed are
+    // no longer on the ThreadsList, and are not waited for.
+    bool pending = false;
+    {
+      JavaThreadIteratorWithHandle jtiwh;
+      MutexLockerEx ml(Threads_lock, Mutex::_no_safepoint_check_flag);
+      for (JavaThread *thr = jtiwh.next(); thr != NULL; thr = jtiwh.next()) {
+        HandshakeState::ProcessResult pr = thr->handshake_try_process_by_vmThread(op);
+        if (pr == HandshakeState::_success) {
+          handshake_executed_by_vm_thread++;
+        } else if (pr != HandshakeState::_no_operation) {
+          pending = true;
+        }
+        hsy.add_result(pr);
+      }
+    }
+
+    if (!pending) {
+      break;
+    }
+
+    hsy.process();
+  }
+
+  log_handshake_info(start_time_ns, op->name(), op->targets(), handshake_executed_by_vm_thread, "(deferred)");
+  op->reset();
+}
+
+class VM_HandshakeCompleteDeferred: public VM_Handshake {
+ public:
+  VM_HandshakeCompleteDeferred() : VM_Handshake(NULL) {}
+
+  void doit() {
+    complete_deferred();
+  }
+
+  VMOp_Type type() const { return VMOp_HandshakeCompleteDeferred; }
+};
+
 class VM_HandshakeOneThread: public VM_Handshake {
   JavaThread* _target;
   bool _thread_alive;
@@ -216,6 +371,10 @@ class VM_HandshakeOneThread: public VM_Handshake {
     VM_Handshake(op), _target(target), _thread_alive(false) {}
 
   void doit() {
+    // A pending deferred operation must be completed first, since
+    // a thread can only have one handshake operation at a time.
+    complete_deferred();
+
     DEBUG_ONLY(_op->check_state();)
     jlong start_time_ns = os::javaTimeNanos();
 
@@ -264,6 +423,10 @@ class VM_HandshakeAllThreads: public VM_Handshake {
   VM_HandshakeAllThreads(HandshakeThreadsOperation* op) : VM_Handshake(op) {}
 
   void doit() {
+    // A pending deferred operation must be completed first, since
+    // a thread can only have one handshake operation at a time.
+    complete_deferred();
+
     DEBUG_ONLY(_op->check_state();)
 
     jlong start_time_ns = os::javaTimeNanos();
@@ -288,6 +451,11 @@ class VM_HandshakeAllThreads: public VM_Handshake {
     log_trace(handshake)("Threads signaled, begin processing blocked threads by VMThread");
     HandshakeSpinYield hsy(start_time_ns);
     int number_of_threads_completed = 0;
+    // Created before the Threads_lock is taken below
+    WorkGang* workers = handshake_workers(number_of_threads_issued);
+    if (workers != NULL) {
+      log_debug(handshake)("Processing blocked threads with %u handshake workers", workers->active_workers());
+    }
     do {
       // Check if handshake operation has timed out
       if (handshake_has_timed_out(start_time_ns)) {
@@ -303,14 +471,23 @@ class VM_HandshakeAllThreads: public VM_Handshake {
           // be locked during certain phases.
           jtiwh.rewind();
           MutexLockerEx ml(Threads_lock, Mutex::_no_safepoint_check_flag);
-          for (JavaThread *thr = jtiwh.next(); thr != NULL; thr = jtiwh.next()) {
-            // A new thread on the ThreadsList will not have an operation,
-            // hence it is skipped in handshake_try_process_by_vmthread.
-            HandshakeState::ProcessResult pr = thr->handshake_try_process_by_vmThread(_op);
-            if (pr == HandshakeState::_success) {
-              handshake_executed_by_vm_thread++;
+          if (workers != NULL) {
+            ParallelHandshakeTask task(_op, jtiwh.list());
+            workers->run_task(&task);
+            handshake_executed_by_vm_thread += task.result_count(HandshakeState::_success);
+            for (int i = 0; i < HandshakeState::_number_states; i++) {
+              hsy.add_result((HandshakeState::ProcessResult)i, task.result_count(i));
+            }
+          } else {
+            for (JavaThread *thr = jtiwh.next(); thr != NULL; thr = jtiwh.next()) {
+              // A new thread on the ThreadsList will not have an operation,
+              // hence it is skipped in handshake_try_process_by_vmthread.
+              HandshakeState::ProcessResult pr = thr->handshake_try_process_by_vmThread(_op);
+              if (pr == HandshakeState::_success) {
+                handshake_executed_by_vm_thread++;
+              }
+              hsy.add_result(pr);
             }
-            hsy.add_result(pr);
           }
           hsy.process();
       }
@@ -378,6 +555,69 @@ void HandshakeThreadsOperation::do_handshake(JavaThread* thread) {
   }
 }
 
+void HandshakeDeferredOperation::do_handshake(JavaThread* thread) {
+  // Only actually execute the operation for non terminated threads.
+  // A thread that has been removed from the ThreadsList can still
+  // find the operation when it exits, after it was completed.
+  HandshakeClosure* const cl = OrderAccess::load_acquire(&_handshake_cl);
+  if (cl != NULL && !thread->is_terminated()) {
+    cl->do_thread(thread);
+  }
+}
+
+void HandshakeDeferredOperation::arm(HandshakeClosure* cl, JavaThread* target) {
+  assert(SafepointSynchronize::is_at_safepoint(), "Should be at safepoint");
+  assert(_handshake_cl == NULL || _handshake_cl == cl, "Only one deferred operation at a time");
+  assert(!target->has_handshake(), "Thread already has an operation");
+
+  // Can be armed concurrently by several GC worker threads
+  _handshake_cl = cl;
+  Atomic::inc(&_targets);
+  target->set_handshake_operation(this);
+}
+
+void HandshakeDeferredOperation::reset() {
+  OrderAccess::release_store(&_handshake_cl, (HandshakeClosure*)NULL);
+  _targets = 0;
+}
+
+void Handshake::arm_deferred(HandshakeClosure* thread_cl, JavaThread* target) {
+  assert(ThreadLocalHandshakes, "Deferred handshakes require thread-local handshakes");
+  _deferred_operation.arm(thread_cl, target);
+}
+
+void Handshake::complete_deferred() {
+  assert(ThreadLocalHandshakes, "Deferred handshakes require thread-local handshakes");
+  if (_deferred_operation.is_pending()) {
+    VM_HandshakeCompleteDeferred op;
+    VMThread::execute(&op);
+  }
+}
+
+void Handshake::complete_deferred_at_safepoint() {
+  assert(SafepointSynchronize::is_at_safepoint(), "Should be at safepoint");
+
+  HandshakeDeferredOperation* const op = &_deferred_operation;
+  if (!op->is_pending()) {
+    // Nothing to complete
+    return;
+  }
+
+  // Another safepoint operation was scheduled before the deferred
+  // operation was completed. It may walk the stacks of the threads
+  // that have not executed it yet, so execute it for them now.
+  const jlong start_time_ns = os::javaTimeNanos();
+  int handshake_executed_by_vm_thread = 0;
+  for (JavaThreadIteratorWithHandle jtiwh; JavaThread* thr = jtiwh.next(); ) {
+    if (thr->handshake_process_at_safepoint()) {
+      handshake_executed_by_vm_thread++;
+    }
+  }
+
+  log_handshake_info(start_time_ns, op->name(), op->targets(), handshake_executed_by_vm_thread, "(deferred, at safepoint)");
+  op->reset();
+}
+
 void Handshake::execute(HandshakeClosure* thread_cl) {
   if (ThreadLocalHandshakes) {
     HandshakeThreadsOperation cto(thread_cl);
@@ -390,6 +630,12 @@ void Handshake::execute(HandshakeClosure* thread_cl) {
 }
 
 bool Handshake::execute(HandshakeClosure* thread_cl, JavaThread* target) {
+  if (target == Thread::current()) {
+    // A thread is always safe to execute its own handshake operation
+    log_trace(handshake)("Operation: %s executed by the target thread itself", thread_cl->name());
+    thread_cl->do_thread(target);
+    return true;
+  }
   if (ThreadLocalHandshakes) {
     HandshakeThreadsOperation cto(thread_cl);
     VM_HandshakeOneThread handshake(&cto, target);
@@ -402,16 +648,108 @@ bool Handshake::execute(HandshakeClosure* thread_cl, JavaThread* target) {
   }
 }
 
-HandshakeState::HandshakeState() : _operation(NULL), _semaphore(1), _thread_in_process_handshake(false) {}
+// Runs an asynchronous operation at a safepoint when thread-local
+// handshakes are not available.
+class AsyncHandshakeFallbackClosure : public HandshakeClosure {
+  AsyncHandshakeClosure* _cl;
+ public:
+  AsyncHandshakeFallbackClosure(AsyncHandshakeClosure* cl) :
+    HandshakeClosure(cl->name()), _cl(cl) {}
+  void do_thread(Thread* thread) {
+    _cl->do_thread((JavaThread*)thread);
+  }
+};
+
+bool Handshake::execute_async(AsyncHandshakeClosure* thread_cl, JavaThread* target) {
+  bool alive;
+  if (ThreadLocalHandshakes) {
+    ThreadsListHandle tlh;
+    alive = tlh.includes(target);
+    if (alive) {
+      // Ownership of the closure passes to the target thread
+      target->add_async_handshake_operation(thread_cl);
+      log_trace(handshake)("Operation: %s queued for thread " PTR_FORMAT, thread_cl->name(), p2i(target));
+      return true;
+    }
+  } else {
+    AsyncHandshakeFallbackClosure cl(thread_cl);
+    VM_HandshakeFallbackOperation op(&cl, target);
+    VMThread::execute(&op);
+    alive = op.thread_alive();
+  }
+  delete thread_cl;
+  return alive;
+}
+
+HandshakeState::HandshakeState() :
+  _operation(NULL), _async_operations(NULL), _semaphore(1), _thread_in_process_handshake(false) {}
+
+HandshakeState::~HandshakeState() {
+  // The thread has exited, delete what it has not executed
+  AsyncHandshakeClosure* cl = _async_operations;
+  while (cl != NULL) {
+    AsyncHandshakeClosure* next = cl->_next;
+    delete cl;
+    cl = next;
+  }
+}
 
 void HandshakeState::set_operation(JavaThread* target, HandshakeOperation* op) {
   _operation = op;
   SafepointMechanism::arm_local_poll_release(target);
 }
 
+void HandshakeState::add_async_operation(JavaThread* target, AsyncHandshakeClosure* cl) {
+  AsyncHandshakeClosure* head;
+  do {
+    head = _async_operations;
+    cl->_next = head;
+  } while (Atomic::cmpxchg(cl, &_async_operations, head) != head);
+  // Armed after the operation is queued, see disarm_local_poll()
+  SafepointMechanism::arm_local_poll_release(target);
+}
+
+void HandshakeState::disarm_local_poll(JavaThread* target) {
+  SafepointMechanism::disarm_local_poll_release(target);
+  OrderAccess::fence();
+  if (has_operation() || has_async_operation()) {
+    // An operation was set or queued concurrently and may have armed
+    // the poll before it was disarmed above
+    SafepointMechanism::arm_local_poll_release(target);
+  }
+}
+
 void HandshakeState::clear_handshake(JavaThread* target) {
   _operation = NULL;
-  SafepointMechanism::disarm_local_poll_release(target);
+  disarm_local_poll(target);
+}
+
+void HandshakeState::process_async_operations(JavaThread* thread) {
+  AsyncHandshakeClosure* list = Atomic::xchg((AsyncHandshakeClosure*)NULL, &_async_operations);
+  if (list == NULL) {
+    return;
+  }
+  if (!has_operation()) {
+    disarm_local_poll(thread);
+  }
+
+  // Execute in the order the operations were queued
+  AsyncHandshakeClosure* ordered = NULL;
+  while (list != NULL) {
+    AsyncHandshakeClosure* next = list->_next;
+    list->_next = ordered;
+    ordered = list;
+    list = next;
+  }
+  while (ordered != NULL) {
+    AsyncHandshakeClosure* cl = ordered;
+    ordered = cl->_next;
+    HandleMark hm(thread);
+    CautiouslyPreserveExceptionMark pem(thread);
+    log_trace(handshake)("Operation: %s executed asynchronously by thread " PTR_FORMAT, cl->name(), p2i(thread));
+    cl->do_thread(thread);
+    delete cl;
+  }
 }
 
 void HandshakeState::process_self_inner(JavaThread* thread) {
@@ -431,6 +769,9 @@ void HandshakeState::process_self_inner(JavaThread* thread) {
     op->do_handshake(thread);
   }
   _semaphore.signal();
+
+  // Asynchronous operations are only executed by the thread itself
+  process_async_operations(thread);
 }
 
 bool HandshakeState::vmthread_can_process_handshake(JavaThread* target) {
@@ -438,7 +779,7 @@ bool HandshakeState::vmthread_can_process_handshake(JavaThread* target) {
   // suspended thread to be safe. However, this function must be called with
   // the Threads_lock held so an externally suspended thread cannot be
   // resumed thus it is safe.
-  assert(Threads_lock->owned_by_self(), "Not holding Threads_lock.");
+  assert(processing_for_vmthread(), "Not holding Threads_lock.");
   return SafepointSynchronize::safepoint_safe(target, target->thread_state()) ||
          target->is_ext_suspended() || target->is_terminated();
 }
@@ -447,7 +788,7 @@ static bool possibly_vmthread_can_process_handshake(JavaThread* target) {
   // An externally suspended thread cannot be resumed while the
   // Threads_lock is held so it is safe.
   // Note that this method is allowed to produce false positives.
-  assert(Threads_lock->owned_by_self(), "Not holding Threads_lock.");
+  assert(processing_for_vmthread(), "Not holding Threads_lock.");
   if (target->is_ext_suspended()) {
     return true;
   }
@@ -478,8 +819,30 @@ bool HandshakeState::claim_handshake_for_vmthread() {
   return false;
 }
 
+bool HandshakeState::process_at_safepoint(JavaThread* target) {
+  assert(SafepointSynchronize::is_at_safepoint() && Thread::current()->is_VM_thread(),
+         "should call from vm thread at safepoint");
+
+  HandshakeOperation* op = _operation;
+  if (op == NULL) {
+    return false;
+  }
+
+  // Handshake operations are only armed at a safepoint by deferred
+  // handshakes. A thread executing its own operation is in the VM and
+  // holds up the safepoint until it is done, so none can be in progress.
+  guarantee(_semaphore.trywait(), "handshake operation in progress at safepoint");
+  op->do_handshake(target);
+  // The local poll is left armed, SafepointSynchronize::end() disarms
+  // it once the thread has no operation.
+  _operation = NULL;
+  _semaphore.signal();
+  return true;
+}
+
 HandshakeState::ProcessResult HandshakeState::try_process_by_vmThread(JavaThread* target) {
-  assert(Thread::current()->is_VM_thread(), "should call from vm thread");
+  assert(Thread::current()->is_VM_thread() || Thread::current()->is_Worker_thread(),
+         "should call from vm thread or a worker thread helping it");
   // Threads_lock must be held here, but that is assert()ed in
   // possibly_vmthread_can_process_handshake().
 
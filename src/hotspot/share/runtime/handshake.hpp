@@ -47,11 +47,50 @@ class HandshakeClosure : public ThreadClosure {
   virtual void do_thread(Thread* thread) = 0;
 };
 
+// An asynchronous handshake closure is queued for a JavaThread without
+// waiting for it to be executed. It is executed by the target thread
+// itself at its next handshake poll, after any closures queued before
+// it, and is then deleted. Closures that are still queued when the
+// target thread exits are deleted without being executed.
+class AsyncHandshakeClosure : public CHeapObj<mtThread> {
+  friend class HandshakeState;
+  const char* const _name;
+  AsyncHandshakeClosure* _next;
+ public:
+  AsyncHandshakeClosure(const char* name) : _name(name), _next(NULL) {}
+  virtual ~AsyncHandshakeClosure() {}
+  const char* name() const {
+    return _name;
+  }
+  virtual void do_thread(JavaThread* thread) = 0;
+};
+
 class Handshake : public AllStatic {
  public:
-  // Execution of handshake operation
+  // Execution of handshake operation. A thread that is the target of its
+  // own single-thread handshake executes the operation directly.
   static void execute(HandshakeClosure* hs_cl);
   static bool execute(HandshakeClosure* hs_cl, JavaThread* target);
+
+  // Asynchronous execution of handshake operation. Returns false, after
+  // deleting hs_cl, if target is no longer alive. Without thread-local
+  // handshakes the operation is executed by the VM thread before this
+  // returns.
+  static bool execute_async(AsyncHandshakeClosure* hs_cl, JavaThread* target);
+
+  // Deferred execution of handshake operation. The operation is armed for
+  // a JavaThread at a safepoint, which guarantees that the thread executes
+  // it before it is allowed to continue in an unsafe state after the
+  // safepoint. Threads that have not executed the operation by themselves
+  // are processed by the VM thread when the operation is completed. Only
+  // one deferred operation can be pending at a time, and it is always
+  // completed before any other handshake operation is executed.
+  static void arm_deferred(HandshakeClosure* hs_cl, JavaThread* target);
+  static void complete_deferred();
+
+  // Completes any pending deferred operation for all threads at the
+  // start of a safepoint, before the safepoint operation inspects them.
+  static void complete_deferred_at_safepoint();
 };
 
 class HandshakeOperation;
@@ -62,6 +101,8 @@ class HandshakeOperation;
 // or the JavaThread itself.
 class HandshakeState {
   HandshakeOperation* volatile _operation;
+  // Asynchronous operations, most recently queued first
+  AsyncHandshakeClosure* volatile _async_operations;
 
   Semaphore _semaphore;
   bool _thread_in_process_handshake;
@@ -70,17 +111,25 @@ class HandshakeState {
   bool vmthread_can_process_handshake(JavaThread* target);
 
   void clear_handshake(JavaThread* thread);
+  void disarm_local_poll(JavaThread* thread);
 
   void process_self_inner(JavaThread* thread);
+  void process_async_operations(JavaThread* thread);
 public:
   HandshakeState();
+  ~HandshakeState();
 
   void set_operation(JavaThread* thread, HandshakeOperation* op);
+  void add_async_operation(JavaThread* thread, AsyncHandshakeClosure* cl);
 
   bool has_operation() const {
     return _operation != NULL;
   }
 
+  bool has_async_operation() const {
+    return _async_operations != NULL;
+  }
+
   void process_by_self(JavaThread* thread) {
     if (!_thread_in_process_handshake) {
       FlagSetting fs(_thread_in_process_handshake, true);
@@ -96,6 +145,7 @@ public:
     _number_states
   };
   HandshakeState::ProcessResult try_process_by_vmThread(JavaThread* target);
+  bool process_at_safepoint(JavaThread* target);
 };
 
 #endif // SHARE_VM_RUNTIME_HANDSHAKE_HPP
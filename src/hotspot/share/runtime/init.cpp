@@ -143,6 +143,7 @@ jint init_globals() {
   }
   stubRoutines_init2(); // note: StubRoutines need 2-phase init
   MethodHandles::generate_adapters();
+  AdapterHandlerLibrary::generate_common_adapters();
 
 #if INCLUDE_NMT
   // Solaris stack is walkable only after stubRoutines are set up.
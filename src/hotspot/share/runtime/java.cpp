@@ -30,8 +30,10 @@
 #include "classfile/stringTable.hpp"
 #include "classfile/systemDictionary.hpp"
 #include "code/codeCache.hpp"
+#include "compiler/compilationProfileCache.hpp"
 #include "compiler/compileBroker.hpp"
 #include "compiler/compilerOracle.hpp"
+#include "gc/shared/heapLimitPoller.hpp"
 #include "interpreter/bytecodeHistogram.hpp"
 #include "jfr/jfrEvents.hpp"
 #include "jfr/support/jfrThreadId.hpp"
@@ -40,6 +42,7 @@
 #include "jvmci/jvmciRuntime.hpp"
 #endif
 #include "logging/log.hpp"
+#include "logging/logAsyncWriter.hpp"
 #include "logging/logStream.hpp"
 #include "memory/oopFactory.hpp"
 #include "memory/resourceArea.hpp"
@@ -510,6 +513,8 @@ void before_exit(JavaThread* thread) {
   StatSampler::disengage();
   StatSampler::destroy();
 
+  HeapLimitPoller::disengage();
+
   // Stop concurrent GC threads
   Universe::heap()->stop();
 
@@ -543,9 +548,16 @@ void before_exit(JavaThread* thread) {
   // Note: we don't wait until it actually dies.
   os::terminate_signal_thread();
 
+  if (CompilationProfileDumpFile != NULL) {
+    CompilationProfileCache::dump_to_file(CompilationProfileDumpFile, tty);
+  }
+
   print_statistics();
   Universe::heap()->print_tracing_info();
 
+  // Write out any log messages still queued for asynchronous writing
+  AsyncLogWriter::flush();
+
   { MutexLocker ml(BeforeExit_lock);
     _before_exit_status = BEFORE_EXIT_DONE;
     BeforeExit_lock->notify_all();
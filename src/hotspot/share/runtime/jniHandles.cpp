@@ -24,6 +24,7 @@
 
 #include "precompiled.hpp"
 #include "gc/shared/oopStorage.inline.hpp"
+#include "gc/shared/oopStorageCache.hpp"
 #include "logging/log.hpp"
 #include "memory/iterator.hpp"
 #include "oops/access.inline.hpp"
@@ -87,6 +88,36 @@ jobject JNIHandles::make_local(JNIEnv* env, oop obj) {
 }
 
 
+// Returns the current thread's cache of free entries for the global or
+// weak global handle storage, or NULL if entries should be allocated and
+// released directly.  The cache would hide use of deleted handles from
+// CheckJNICalls, so it is not used then.
+static OopStorageCache* current_handle_cache(bool weak) {
+  if (!UseJNIHandleCache || CheckJNICalls) {
+    return NULL;
+  }
+  Thread* thread = Thread::current_or_null();
+  if (thread == NULL || !thread->is_Java_thread()) {
+    return NULL;
+  }
+  JavaThread* jt = (JavaThread*)thread;
+  return weak ? jt->jni_weak_global_handle_cache() : jt->jni_global_handle_cache();
+}
+
+static oop* allocate_handle(OopStorage* storage, bool weak) {
+  OopStorageCache* cache = current_handle_cache(weak);
+  return (cache != NULL) ? cache->allocate(storage) : storage->allocate();
+}
+
+static void release_handle(OopStorage* storage, bool weak, oop* ptr) {
+  OopStorageCache* cache = current_handle_cache(weak);
+  if (cache != NULL) {
+    cache->release(storage, ptr);
+  } else {
+    storage->release(ptr);
+  }
+}
+
 static void report_handle_allocation_failure(AllocFailType alloc_failmode,
                                              const char* handle_kind) {
   if (alloc_failmode == AllocFailStrategy::EXIT_OOM) {
@@ -105,7 +136,7 @@ jobject JNIHandles::make_global(Handle obj, AllocFailType alloc_failmode) {
   if (!obj.is_null()) {
     // ignore null handles
     assert(oopDesc::is_oop(obj()), "not an oop");
-    oop* ptr = global_handles()->allocate();
+    oop* ptr = allocate_handle(global_handles(), false);
     // Return NULL on allocation failure.
     if (ptr != NULL) {
       assert(*ptr == NULL, "invariant");
@@ -129,7 +160,7 @@ jobject JNIHandles::make_weak_global(Handle obj, AllocFailType alloc_failmode) {
   if (!obj.is_null()) {
     // ignore null handles
     assert(oopDesc::is_oop(obj()), "not an oop");
-    oop* ptr = weak_global_handles()->allocate();
+    oop* ptr = allocate_handle(weak_global_handles(), true);
     // Return NULL on allocation failure.
     if (ptr != NULL) {
       assert(*ptr == NULL, "invariant");
@@ -170,7 +201,7 @@ void JNIHandles::destroy_global(jobject handle) {
     assert(!is_jweak(handle), "wrong method for detroying jweak");
     oop* oop_ptr = jobject_ptr(handle);
     NativeAccess<>::oop_store(oop_ptr, (oop)NULL);
-    global_handles()->release(oop_ptr);
+    release_handle(global_handles(), false, oop_ptr);
   }
 }
 
@@ -180,7 +211,7 @@ void JNIHandles::destroy_weak_global(jobject handle) {
     assert(is_jweak(handle), "JNI handle not jweak");
     oop* oop_ptr = jweak_ptr(handle);
     NativeAccess<ON_PHANTOM_OOP_REF>::oop_store(oop_ptr, (oop)NULL);
-    weak_global_handles()->release(oop_ptr);
+    release_handle(weak_global_handles(), true, oop_ptr);
   }
 }
 
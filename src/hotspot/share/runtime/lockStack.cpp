@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "oops/oop.inline.hpp"
+#include "runtime/lockStack.inline.hpp"
+#include "runtime/safepoint.hpp"
+#include "runtime/thread.hpp"
+#include "utilities/ostream.hpp"
+
+LockStack::LockStack() : _top(start_offset()) {
+  for (int i = 0; i < CAPACITY; i++) {
+    _base[i] = NULL;
+  }
+}
+
+uint32_t LockStack::start_offset() {
+  return (uint32_t) in_bytes(JavaThread::lock_stack_base_offset());
+}
+
+uint32_t LockStack::end_offset() {
+  return start_offset() + CAPACITY * oopSize;
+}
+
+JavaThread* LockStack::get_thread() const {
+  char* addr = (char*) this;
+  return (JavaThread*) (addr - in_bytes(JavaThread::lock_stack_offset()));
+}
+
+bool LockStack::is_owning_thread() const {
+  Thread* current = Thread::current();
+  return current->is_Java_thread() && (JavaThread*) current == get_thread();
+}
+
+#ifndef PRODUCT
+void LockStack::verify(const char* msg) const {
+  assert(UseLightweightLocking, "lock stack is only used with UseLightweightLocking");
+  assert(_top <= end_offset(), "lock stack overflow: _top %u end_offset %u", _top, end_offset());
+  assert(_top >= start_offset(), "lock stack underflow: _top %u start_offset %u", _top, start_offset());
+  if (SafepointSynchronize::is_at_safepoint() || is_owning_thread()) {
+    int top = to_index(_top);
+    for (int i = 0; i < top; i++) {
+      assert(_base[i] != NULL, "no zapped before top");
+      for (int j = i + 1; j < top; j++) {
+        assert(_base[i] != _base[j], "entries must be unique: %s", msg);
+      }
+    }
+  }
+}
+#endif
+
+void LockStack::print_on(outputStream* st) const {
+  for (int i = to_index(_top); (--i) >= 0;) {
+    st->print("LockStack[%d]: ", i);
+    oop o = _base[i];
+    if (oopDesc::is_oop(o)) {
+      o->print_on(st);
+    } else {
+      st->print_cr("not an oop: " PTR_FORMAT, p2i(o));
+    }
+  }
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_VM_RUNTIME_LOCKSTACK_HPP
+#define SHARE_VM_RUNTIME_LOCKSTACK_HPP
+
+#include "oops/oopsHierarchy.hpp"
+#include "utilities/globalDefinitions.hpp"
+#include "utilities/sizes.hpp"
+
+class JavaThread;
+class OopClosure;
+class outputStream;
+
+// The lock stack of a JavaThread holds the objects the thread has
+// fast-locked with UseLightweightLocking. A fast-locked object keeps
+// its own header, with the lock bits cleared, instead of pointing to a
+// displaced header in a BasicLock on the stack, so the owner of a
+// fast-locked object is found by looking for it in the lock stacks.
+//
+// Recursive locking is not supported on the lock stack: locking an
+// object that is already on the lock stack, or locking with a full
+// lock stack, inflates the monitor.
+class LockStack {
+  friend class VMStructs;
+ public:
+  static const int CAPACITY = 8;
+
+ private:
+  // Offset, in bytes relative to the owning JavaThread, of the next free
+  // entry. Generated code pushes and pops with a single thread-relative
+  // address this way.
+  uint32_t _top;
+  oop _base[CAPACITY];
+
+  JavaThread* get_thread() const;
+  bool is_owning_thread() const;
+
+  static inline int to_index(uint32_t offset);
+
+  void verify(const char* msg) const PRODUCT_RETURN;
+
+ public:
+  LockStack();
+
+  static ByteSize top_offset()  { return byte_offset_of(LockStack, _top); }
+  static ByteSize base_offset() { return byte_offset_of(LockStack, _base); }
+
+  // Bounds of _top, relative to the owning JavaThread
+  static uint32_t start_offset();
+  static uint32_t end_offset();
+
+  inline bool is_empty() const;
+  inline bool can_push() const;
+  inline void push(oop o);
+  inline oop pop();
+  // Removes o from anywhere in the lock stack
+  inline void remove(oop o);
+  inline bool contains(oop o) const;
+
+  inline void oops_do(OopClosure* cl);
+
+  void print_on(outputStream* st) const;
+};
+
+#endif // SHARE_VM_RUNTIME_LOCKSTACK_HPP
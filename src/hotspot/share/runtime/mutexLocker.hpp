@@ -59,6 +59,7 @@ extern Mutex*   AdapterHandlerLibrary_lock;      // a lock on the AdapterHandler
 extern Mutex*   SignatureHandlerLibrary_lock;    // a lock on the SignatureHandlerLibrary
 extern Mutex*   VtableStubs_lock;                // a lock on the VtableStubs
 extern Mutex*   SymbolArena_lock;                // a lock on the symbol table arena
+extern Mutex*   SymbolFreeList_lock;             // a lock on the free lists of recycled symbols
 extern Mutex*   StringTable_lock;                // a lock on the interned string table
 extern Monitor* StringDedupQueue_lock;           // a lock on the string deduplication queue
 extern Mutex*   StringDedupTable_lock;           // a lock on the string deduplication table
@@ -175,6 +176,10 @@ extern Monitor* CodeHeapStateAnalytics_lock;     // lock print functions against
 // by fatal error handler.
 void print_owned_locks_on_error(outputStream* st);
 
+// Returns true if a mutex/monitor other than excluded is owned by a
+// thread other than the current one.
+bool is_lock_owned_by_other_thread(Monitor* excluded);
+
 char *lock_name(Mutex *mutex);
 
 class MutexLocker: StackObj {
@@ -320,6 +320,8 @@ void ObjectMonitor::enter(TRAPS) {
   // Ensure the object-monitor relationship remains stable while there's contention.
   Atomic::inc(&_count);
 
+  jlong contended_start = os::javaTimeNanos();
+
   JFR_ONLY(JfrConditionalFlushWithStacktrace<EventJavaMonitorEnter> flush(jt);)
   EventJavaMonitorEnter event;
   if (event.should_commit()) {
@@ -379,6 +381,17 @@ void ObjectMonitor::enter(TRAPS) {
     // acquire it.
   }
 
+  // This thread owns the monitor now, so the statistics can be updated without atomics
+  jlong wait = os::javaTimeNanos() - contended_start;
+  _contended_enters++;
+  _contended_wait_total += wait;
+  if (_contended_enters == 1) {
+    _contended_wait = wait;
+  } else {
+    // Decaying average, the new sample has a weight of 1/8
+    _contended_wait += (wait - _contended_wait) / 8;
+  }
+
   Atomic::dec(&_count);
   assert(_count >= 0, "invariant");
   Self->_Stalled = 0;
@@ -1910,6 +1923,14 @@ int ObjectMonitor::TrySpin(Thread * Self) {
   if (ctr < Knob_SpinBase) ctr = Knob_SpinBase;
   if (ctr <= 0) return 0;
 
+  // Don't spin if recent contended enters waited far longer than a spin
+  // lasts: the owners hold the monitor too long for spinning to pay off.
+  if (MonitorSpinMaxWait > 0 && _contended_enters >= 8 &&
+      _contended_wait > (jlong)MonitorSpinMaxWait * (NANOUNITS / MICROUNITS)) {
+    TEVENT(Spin abort - long contended waits);
+    return 0;
+  }
+
   if (Knob_SuccRestrict && _succ != NULL) return 0;
   if (Knob_OState && NotRunnable (Self, (Thread *) _owner)) {
     TEVENT(Spin abort - notrunnable [TOP]);
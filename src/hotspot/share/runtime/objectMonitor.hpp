@@ -166,6 +166,11 @@ class ObjectMonitor {
   volatile jint  _count;            // reference count to prevent reclamation/deflation
                                     // at stop-the-world time.  See deflate_idle_monitors().
                                     // _count is approximately |_WaitSet| + |_EntryList|
+
+  // Contention statistics, only updated by the owner after a contended enter
+  volatile int   _contended_enters;      // number of contended enters
+  volatile jlong _contended_wait;        // decaying average time to acquire in nanos
+  volatile jlong _contended_wait_total;  // total time to acquire in nanos
  protected:
   ObjectWaiter * volatile _WaitSet; // LL of threads wait()ing on the monitor
   volatile jint  _waiters;          // number of waiting threads
@@ -248,6 +253,13 @@ class ObjectMonitor {
   void*     owner() const;
   void      set_owner(void* owner);
 
+  // With UseLightweightLocking, a monitor inflated from an object that
+  // another thread has fast-locked is owned anonymously until the lock
+  // holder finds it and claims it, see ObjectSynchronizer::inflate().
+  static const uintptr_t ANONYMOUS_OWNER = 1;
+  void      set_owner_anonymous()       { _owner = (void*) ANONYMOUS_OWNER; _recursions = 0; }
+  bool      is_owner_anonymous() const  { return _owner == (void*) ANONYMOUS_OWNER; }
+
   jint      waiters() const;
 
   jint      count() const;
@@ -255,6 +267,10 @@ class ObjectMonitor {
   jint      contentions() const;
   intptr_t  recursions() const                                         { return _recursions; }
 
+  int       contended_enters() const                                   { return _contended_enters; }
+  jlong     contended_wait() const                                     { return _contended_wait; }
+  jlong     contended_wait_total() const                               { return _contended_wait_total; }
+
   // JVM/TI GetObjectMonitorUsage() needs this:
   ObjectWaiter* first_waiter()                                         { return _WaitSet; }
   ObjectWaiter* next_waiter(ObjectWaiter* o)                           { return o->_next; }
@@ -67,6 +67,9 @@ inline void ObjectMonitor::clear() {
 
   _header = NULL;
   _object = NULL;
+  _contended_enters = 0;
+  _contended_wait = 0;
+  _contended_wait_total = 0;
 }
 
 
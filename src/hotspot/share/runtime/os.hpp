@@ -562,6 +562,17 @@ class os: AllStatic {
   // run cmd in a separate process and return its exit code; or -1 on failures
   static int fork_and_exec(char *cmd, bool use_vfork_if_available = false);
 
+  // Fork a process that continues from the point of the call with a
+  // copy-on-write snapshot of this one and only the calling thread.
+  // Returns a positive value in the calling process, 0 in the snapshot
+  // process and -1 on failure or if not supported. The snapshot process
+  // is not a child of the VM, so it needs no reaping, and must end with
+  // exit_snapshot_process(). can_snapshot is called in a copy of the
+  // process before the snapshot process is created from it, and if it
+  // returns false the call fails.
+  static int fork_snapshot_process(bool (*can_snapshot)());
+  static void exit_snapshot_process(int status);
+
   // Call ::exit() on all platforms but Windows
   static void exit(int num);
 
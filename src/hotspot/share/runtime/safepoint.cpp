@@ -38,6 +38,7 @@
 #include "gc/shared/workgroup.hpp"
 #include "interpreter/interpreter.hpp"
 #include "jfr/jfrEvents.hpp"
+#include "jfr/support/jfrThreadId.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "memory/resourceArea.hpp"
@@ -48,6 +49,7 @@
 #include "runtime/compilationPolicy.hpp"
 #include "runtime/deoptimization.hpp"
 #include "runtime/frame.inline.hpp"
+#include "runtime/handshake.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/orderAccess.hpp"
@@ -146,6 +148,8 @@ volatile int SafepointSynchronize::_safepoint_counter = 0;
 int SafepointSynchronize::_current_jni_active_count = 0;
 long  SafepointSynchronize::_end_of_last_safepoint = 0;
 int SafepointSynchronize::_defer_thr_suspend_loop_count = 4000;
+JavaThread* SafepointSynchronize::_last_thread = NULL;
+SafepointLastThreadRecord SafepointSynchronize::_slowest_syncs[SafepointSynchronize::SlowestSyncRecords];
 static const int safepoint_spin_before_yield = 2000;
 static volatile int PageArmed = 0 ;        // safepoint polling page is RO|RW vs PROT_NONE
 static volatile int TryingToBlock = 0 ;    // proximate value -- for advisory use only
@@ -191,6 +195,13 @@ void SafepointSynchronize::begin() {
   jlong safepoint_limit_time = 0;
   timeout_error_printed = false;
 
+  // Start of the synchronization for RecordSafepointLastThread
+  jlong sync_begin_time = 0;
+  if (RecordSafepointLastThread) {
+    _last_thread = NULL;
+    sync_begin_time = os::javaTimeNanos();
+  }
+
   // PrintSafepointStatisticsTimeout can be specified separately. When
   // specified, PrintSafepointStatistics will be set to true in
   // deferred_initialize_stat method. The initialization has to be done
@@ -295,6 +306,9 @@ void SafepointSynchronize::begin() {
             cur_state->examine_state_of_thread();
             if (!cur_state->is_running()) {
               still_running--;
+              if (RecordSafepointLastThread) {
+                record_last_thread(cur);
+              }
               // consider adjusting steps downward:
               //   steps = 0
               //   steps -= NNN
@@ -458,6 +472,10 @@ void SafepointSynchronize::begin() {
     }
   }
 
+  if (RecordSafepointLastThread) {
+    record_sync_end(os::javaTimeNanos() - sync_begin_time);
+  }
+
 #ifdef ASSERT
   // Make sure all the threads were visited.
   for (JavaThreadIteratorWithHandle jtiwh; JavaThread *cur = jtiwh.next(); ) {
@@ -475,6 +493,10 @@ void SafepointSynchronize::begin() {
     update_statistics_on_sync_end(os::javaTimeNanos());
   }
 
+  // Finish deferred handshake operations before the safepoint operation
+  // walks thread stacks that are still waiting for them
+  Handshake::complete_deferred_at_safepoint();
+
   // Call stuff that needs to be run when a safepoint is just about to be completed
   {
     EventSafepointCleanup cleanup_event;
@@ -548,7 +570,17 @@ void SafepointSynchronize::end() {
         for (; JavaThread *current = jtiwh.next(); ) {
           ThreadSafepointState* cur_state = current->safepoint_state();
           cur_state->restart(); // TSS _running
-          SafepointMechanism::disarm_local_poll(current);
+          if (!current->has_handshake() && !current->has_async_handshake()) {
+            // Keep the poll armed for threads with a pending handshake
+            // operation, which was armed during the safepoint, or with
+            // queued asynchronous handshake operations
+            SafepointMechanism::disarm_local_poll(current);
+            OrderAccess::fence();
+            if (current->has_async_handshake()) {
+              // Queued concurrently, before the poll was armed again
+              SafepointMechanism::arm_local_poll(current);
+            }
+          }
         }
         log_info(safepoint)("Leaving safepoint region");
       } else {
@@ -617,7 +649,8 @@ private:
 
 public:
   ParallelSPCleanupThreadClosure(DeflateMonitorCounters* counters) :
-    _nmethod_cl(UseCodeAging ? NMethodSweeper::prepare_reset_hotness_counters() : NULL),
+    _nmethod_cl(UseCodeAging && !NMethodSweeper::concurrent_aging() ?
+                NMethodSweeper::prepare_reset_hotness_counters() : NULL),
     _counters(counters) {}
 
   void do_thread(Thread* thread) {
@@ -728,8 +761,27 @@ public:
   }
 };
 
+// Is there anything for do_cleanup_tasks() to do?
+bool SafepointSynchronize::has_cleanup_work() {
+  // Without a usage threshold, idle monitors are only deflated here.
+  // Unless it is done concurrently, the hotness counters of the nmethods
+  // on the stacks are reset here, so the sweeper would otherwise flush
+  // active code.
+  return MonitorUsedDeflationThreshold == 0 ||
+         ObjectSynchronizer::is_scavenge_pending() ||
+         (UseCodeAging && !NMethodSweeper::concurrent_aging()) ||
+         is_cleanup_needed() ||
+         ClassLoaderDataGraph::has_safepoint_cleanup_work();
+}
+
 // Various cleaning tasks that should be done periodically at safepoints.
 void SafepointSynchronize::do_cleanup_tasks() {
+  if (SafepointCleanupOnlyWhenNeeded && !has_cleanup_work()) {
+    // Counter decay is time based, keep doing it at every safepoint.
+    CompilationPolicy::policy()->do_safepoint_work();
+    log_debug(safepoint, cleanup)("Skipping safepoint cleanup tasks, no work");
+    return;
+  }
 
   TraceTime timer("safepoint cleanup tasks", TRACETIME_LOG(Info, safepoint, cleanup));
 
@@ -876,6 +928,9 @@ void SafepointSynchronize::block(JavaThread *thread) {
 
         // Consider (_waiting_to_block < 2) to pipeline the wakeup of the VM thread
         if (_waiting_to_block == 0) {
+          if (RecordSafepointLastThread) {
+            record_last_thread(thread);
+          }
           Safepoint_lock->notify_all();
         }
       }
@@ -980,6 +1035,124 @@ void SafepointSynchronize::handle_polling_page_exception(JavaThread *thread) {
 }
 
 
+// ------------------------------------------------------------------------------------------------------
+// Last thread to reach a safepoint
+
+static const char* thread_state_name(JavaThreadState state) {
+  switch (state) {
+    case _thread_new:             return "new";
+    case _thread_in_native:       return "in native";
+    case _thread_in_native_trans: return "in native (transition)";
+    case _thread_in_vm:           return "in VM";
+    case _thread_in_vm_trans:     return "in VM (transition)";
+    case _thread_in_Java:         return "in Java";
+    case _thread_blocked:         return "blocked";
+    case _thread_blocked_trans:   return "blocked (transition)";
+    default:                      return "unknown";
+  }
+}
+
+// Describe the top Java frame of a thread stopped at a safepoint.
+static Method* describe_top_frame(JavaThread* thread, char* buf, size_t buflen) {
+  if (thread->has_last_Java_frame()) {
+    RegisterMap map(thread, false);
+    frame fr = thread->last_frame();
+    // Skip the safepoint blob and other stubs
+    while (!fr.is_java_frame() && !fr.is_first_frame()) {
+      fr = fr.sender(&map);
+    }
+    if (fr.is_interpreted_frame()) {
+      Method* method = fr.interpreter_frame_method();
+      jio_snprintf(buf, buflen, "%s @ bci %d (interpreted)",
+                   method->name_and_sig_as_C_string(), fr.interpreter_frame_bci());
+      return method;
+    } else if (fr.is_compiled_frame()) {
+      CompiledMethod* cm = fr.cb()->as_compiled_method();
+      jio_snprintf(buf, buflen, "%s @ pc+%d (compiled, level %d)",
+                   cm->method()->name_and_sig_as_C_string(),
+                   (int)(fr.pc() - cm->code_begin()), cm->comp_level());
+      return cm->method();
+    }
+  }
+  jio_snprintf(buf, buflen, "no Java frame");
+  return NULL;
+}
+
+void SafepointSynchronize::record_sync_end(jlong sync_time) {
+  assert(Safepoint_lock->owned_by_self(), "must hold Safepoint_lock");
+  JavaThread* thread = _last_thread;
+  if (thread == NULL) {
+    return;
+  }
+
+  // Replace the fastest of the recorded synchronizations if this one was slower
+  int slot = 0;
+  for (int i = 1; i < SlowestSyncRecords; i++) {
+    if (_slowest_syncs[i]._sync_time < _slowest_syncs[slot]._sync_time) {
+      slot = i;
+    }
+  }
+  EventSafepointLastThread event;
+  bool keep = sync_time > _slowest_syncs[slot]._sync_time;
+  if (!keep && !event.should_commit()) {
+    return;
+  }
+
+  ResourceMark rm;
+  SafepointLastThreadRecord record;
+  record._sync_time = sync_time;
+  record._operation = VMThread::vm_safepoint_description();
+  record._state = thread->safepoint_state()->orig_thread_state();
+  jio_snprintf(record._thread_name, sizeof(record._thread_name), "%s", thread->get_thread_name());
+  Method* method = describe_top_frame(thread, record._top_frame, sizeof(record._top_frame));
+
+  log_debug(safepoint)("Last thread to reach safepoint: \"%s\" %s at %s",
+                       record._thread_name, thread_state_name(record._state), record._top_frame);
+
+  if (keep) {
+    _slowest_syncs[slot] = record;
+  }
+  if (event.should_commit()) {
+    set_current_safepoint_id(&event);
+    event.set_lastThread(JFR_THREAD_ID(thread));
+    event.set_threadState(thread_state_name(record._state));
+    event.set_topMethod(method);
+    event.set_timeToSafepoint(sync_time);
+    event.commit();
+  }
+}
+
+void SafepointSynchronize::print_slowest_syncs_on(outputStream* st) {
+  if (!RecordSafepointLastThread) {
+    st->print_cr("Recording is disabled, use -XX:+UnlockDiagnosticVMOptions -XX:+RecordSafepointLastThread");
+    return;
+  }
+
+  SafepointLastThreadRecord records[SlowestSyncRecords];
+  {
+    MutexLocker mu(Safepoint_lock);
+    memcpy(records, _slowest_syncs, sizeof(records));
+  }
+
+  // Sort by time to safepoint, slowest first
+  for (int i = 1; i < SlowestSyncRecords; i++) {
+    SafepointLastThreadRecord r = records[i];
+    int j = i - 1;
+    for (; j >= 0 && records[j]._sync_time < r._sync_time; j--) {
+      records[j + 1] = records[j];
+    }
+    records[j + 1] = r;
+  }
+
+  st->print_cr("Slowest safepoint synchronizations:");
+  for (int i = 0; i < SlowestSyncRecords && records[i]._sync_time > 0; i++) {
+    SafepointLastThreadRecord* r = &records[i];
+    st->print_cr("%10.3f ms  %-24s last thread \"%s\" %s at %s",
+                 (double)r->_sync_time / NANOSECS_PER_MILLISEC, r->_operation,
+                 r->_thread_name, thread_state_name(r->_state), r->_top_frame);
+  }
+}
+
 void SafepointSynchronize::print_safepoint_timeout(SafepointTimeoutReason reason) {
   if (!timeout_error_printed) {
     timeout_error_printed = true;
@@ -56,6 +56,16 @@ class nmethod;
 //
 // Implements roll-forward to safepoint (safepoint synchronization)
 //
+// The last thread to reach a safepoint, see RecordSafepointLastThread
+class SafepointLastThreadRecord {
+ public:
+  jlong           _sync_time;           // time to safepoint in nanos
+  const char*     _operation;           // name of the VM operation
+  JavaThreadState _state;               // state of the thread when the safepoint began
+  char            _thread_name[64];
+  char            _top_frame[256];      // top Java frame of the thread at the safepoint
+};
+
 class SafepointSynchronize : AllStatic {
  public:
   enum SynchronizeState {
@@ -143,6 +153,13 @@ private:
   // For debug long safepoint
   static void print_safepoint_timeout(SafepointTimeoutReason timeout_reason);
 
+  // Support for RecordSafepointLastThread
+  enum { SlowestSyncRecords = 10 };
+  static JavaThread*               _last_thread;       // last thread to reach the current safepoint
+  static SafepointLastThreadRecord _slowest_syncs[SlowestSyncRecords];
+  static void record_last_thread(JavaThread* thread) { _last_thread = thread; }
+  static void record_sync_end(jlong sync_time);
+
 public:
 
   // Main entry points
@@ -190,10 +207,12 @@ public:
     return _end_of_last_safepoint;
   }
   static bool is_cleanup_needed();
+  static bool has_cleanup_work();
   static void do_cleanup_tasks();
 
   static void deferred_initialize_stat();
   static void print_stat_on_exit();
+  static void print_slowest_syncs_on(outputStream* st);
   inline static void inc_vmop_coalesced_count() { _coalesced_vmop_count++; }
 
   static void set_is_at_safepoint()                        { _state = _synchronized; }
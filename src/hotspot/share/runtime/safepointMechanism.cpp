@@ -88,7 +88,8 @@ void SafepointMechanism::block_if_requested_slow(JavaThread *thread) {
   if (global_poll()) {
     SafepointSynchronize::block(thread);
   }
-  if (uses_thread_local_poll() && thread->has_handshake()) {
+  if (uses_thread_local_poll() &&
+      (thread->has_handshake() || thread->has_async_handshake())) {
       thread->handshake_process_by_self();
   }
 }
@@ -64,8 +64,10 @@
 #include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/java.hpp"
 #include "runtime/javaCalls.hpp"
+#include "runtime/orderAccess.hpp"
 #include "runtime/sharedRuntime.hpp"
 #include "runtime/stubRoutines.hpp"
+#include "runtime/timerTrace.hpp"
 #include "runtime/vframe.inline.hpp"
 #include "runtime/vframeArray.hpp"
 #include "utilities/copy.hpp"
@@ -99,6 +101,7 @@ UncommonTrapBlob*   SharedRuntime::_uncommon_trap_blob;
 
 //----------------------------generate_stubs-----------------------------------
 void SharedRuntime::generate_stubs() {
+  TraceTime timer("SharedRuntime stubs generation", TRACETIME_LOG(Info, startuptime));
   _wrong_method_blob                   = generate_resolve_blob(CAST_FROM_FN_PTR(address, SharedRuntime::handle_wrong_method),          "wrong_method_stub");
   _wrong_method_abstract_blob          = generate_resolve_blob(CAST_FROM_FN_PTR(address, SharedRuntime::handle_wrong_method_abstract), "wrong_method_abstract_stub");
   _ic_miss_blob                        = generate_resolve_blob(CAST_FROM_FN_PTR(address, SharedRuntime::handle_wrong_method_ic_miss),  "ic_miss_stub");
@@ -735,6 +738,27 @@ address SharedRuntime::compute_compiled_exc_handler(CompiledMethod* cm, address
   return nm->code_begin() + t->pco();
 }
 
+void SharedRuntime::post_exception_dispatch_event(EventCompiledExceptionDispatch& event, CompiledMethod* cm,
+                                                  address pc, Handle exception, bool cached) {
+  if (!event.should_commit()) {
+    return;
+  }
+  // Attribute the dispatch to the innermost inlined method at the throw site
+  ResourceMark rm;
+  Method* method = cm->method();
+  int bci = -1;
+  if (cm->pc_desc_at(pc) != NULL) {
+    ScopeDesc* sd = cm->scope_desc_at(pc);
+    method = sd->method();
+    bci = sd->bci();
+  }
+  event.set_method(method);
+  event.set_bci(bci);
+  event.set_exceptionClass(exception->klass());
+  event.set_cached(cached);
+  event.commit();
+}
+
 JRT_ENTRY(void, SharedRuntime::throw_AbstractMethodError(JavaThread* thread))
   // These errors occur only at call sites
   throw_and_post_jvmti_exception(thread, vmSymbols::java_lang_AbstractMethodError());
@@ -2615,6 +2639,12 @@ class AdapterHandlerTableIterator : public StackObj {
 // Implementation of AdapterHandlerLibrary
 AdapterHandlerTable* AdapterHandlerLibrary::_adapters = NULL;
 AdapterHandlerEntry* AdapterHandlerLibrary::_abstract_method_handler = NULL;
+AdapterHandlerEntry* AdapterHandlerLibrary::_no_arg_handler = NULL;
+AdapterHandlerEntry* AdapterHandlerLibrary::_int_arg_handler = NULL;
+AdapterHandlerEntry* AdapterHandlerLibrary::_obj_arg_handler = NULL;
+AdapterHandlerEntry* AdapterHandlerLibrary::_obj_int_arg_handler = NULL;
+AdapterHandlerEntry* AdapterHandlerLibrary::_obj_obj_arg_handler = NULL;
+volatile bool AdapterHandlerLibrary::_common_adapters_generated = false;
 const int AdapterHandlerLibrary_size = 16*K;
 BufferBlob* AdapterHandlerLibrary::_buffer = NULL;
 
@@ -2676,7 +2706,107 @@ AdapterHandlerEntry* AdapterHandlerLibrary::get_adapter(const methodHandle& meth
   return entry;
 }
 
+AdapterHandlerEntry* AdapterHandlerLibrary::get_simple_adapter(const methodHandle& method) {
+  if (!OrderAccess::load_acquire(&_common_adapters_generated) || VerifyAdapterSharing) {
+    return NULL;
+  }
+  if (method->is_abstract()) {
+    return _abstract_method_handler;
+  }
+  int total_args_passed = method->size_of_parameters(); // All args on stack
+  if (total_args_passed == 0) {
+    return _no_arg_handler;
+  } else if (total_args_passed == 1) {
+    if (!method->is_static()) {
+      return _obj_arg_handler;
+    }
+    switch (method->signature()->byte_at(1)) {
+      case JVM_SIGNATURE_CLASS:
+      case JVM_SIGNATURE_ARRAY:
+        return _obj_arg_handler;
+      case JVM_SIGNATURE_INT:
+      case JVM_SIGNATURE_BOOLEAN:
+      case JVM_SIGNATURE_CHAR:
+      case JVM_SIGNATURE_BYTE:
+      case JVM_SIGNATURE_SHORT:
+        return _int_arg_handler;
+    }
+  } else if (total_args_passed == 2 && !method->is_static()) {
+    switch (method->signature()->byte_at(1)) {
+      case JVM_SIGNATURE_CLASS:
+      case JVM_SIGNATURE_ARRAY:
+        return _obj_obj_arg_handler;
+      case JVM_SIGNATURE_INT:
+      case JVM_SIGNATURE_BOOLEAN:
+      case JVM_SIGNATURE_CHAR:
+      case JVM_SIGNATURE_BYTE:
+      case JVM_SIGNATURE_SHORT:
+        return _obj_int_arg_handler;
+    }
+  }
+  return NULL;
+}
+
+void AdapterHandlerLibrary::generate_common_adapters() {
+  // Called once StubRoutines::code2() is set up, so that the adapters
+  // contain all checks and can be shared through the table.
+  TraceTime timer("Common adapters generation", TRACETIME_LOG(Info, startuptime));
+  ResourceMark rm;
+  BasicType obj_args[]     = { T_OBJECT };
+  BasicType int_args[]     = { T_INT };
+  BasicType obj_int_args[] = { T_OBJECT, T_INT };
+  BasicType obj_obj_args[] = { T_OBJECT, T_OBJECT };
+
+  _no_arg_handler      = get_adapter_for(0, NULL, NULL);
+  _obj_arg_handler     = get_adapter_for(1, obj_args, NULL);
+  _int_arg_handler     = get_adapter_for(1, int_args, NULL);
+  _obj_int_arg_handler = get_adapter_for(2, obj_int_args, NULL);
+  _obj_obj_arg_handler = get_adapter_for(2, obj_obj_args, NULL);
+
+  if (_no_arg_handler != NULL && _obj_arg_handler != NULL && _int_arg_handler != NULL &&
+      _obj_int_arg_handler != NULL && _obj_obj_arg_handler != NULL) {
+    // Publish the handlers to the lock-free lookup in get_simple_adapter().
+    OrderAccess::release_store(&_common_adapters_generated, true);
+  }
+}
+
 AdapterHandlerEntry* AdapterHandlerLibrary::get_adapter0(const methodHandle& method) {
+  // Methods with the most common signatures share adapters generated
+  // at startup and are looked up without taking the lock.
+  AdapterHandlerEntry* entry = get_simple_adapter(method);
+  if (entry != NULL) {
+    return entry;
+  }
+
+  if (method->is_abstract()) {
+    MutexLocker mu(AdapterHandlerLibrary_lock);
+    // make sure data structure is initialized
+    initialize();
+    return _abstract_method_handler;
+  }
+
+  ResourceMark rm;
+
+  // Fill in the signature array, for the calling-convention call.
+  int total_args_passed = method->size_of_parameters(); // All args on stack
+
+  BasicType* sig_bt = NEW_RESOURCE_ARRAY(BasicType, total_args_passed);
+  int i = 0;
+  if (!method->is_static())  // Pass in receiver first
+    sig_bt[i++] = T_OBJECT;
+  for (SignatureStream ss(method->signature()); !ss.at_return_type(); ss.next()) {
+    sig_bt[i++] = ss.type();  // Collect remaining bits of signature
+    if (ss.type() == T_LONG || ss.type() == T_DOUBLE)
+      sig_bt[i++] = T_VOID;   // Longs & doubles take 2 Java slots
+  }
+  assert(i == total_args_passed, "");
+
+  return get_adapter_for(total_args_passed, sig_bt, &method);
+}
+
+AdapterHandlerEntry* AdapterHandlerLibrary::get_adapter_for(int total_args_passed,
+                                                            BasicType* sig_bt,
+                                                            const methodHandle* method) {
   // Use customized signature handler.  Need to lock around updates to
   // the AdapterHandlerTable (it is not safe for concurrent readers
   // and a single writer: this could be fixed if it becomes a
@@ -2693,24 +2823,7 @@ AdapterHandlerEntry* AdapterHandlerLibrary::get_adapter0(const methodHandle& met
     // make sure data structure is initialized
     initialize();
 
-    if (method->is_abstract()) {
-      return _abstract_method_handler;
-    }
-
-    // Fill in the signature array, for the calling-convention call.
-    int total_args_passed = method->size_of_parameters(); // All args on stack
-
-    BasicType* sig_bt = NEW_RESOURCE_ARRAY(BasicType, total_args_passed);
-    VMRegPair* regs   = NEW_RESOURCE_ARRAY(VMRegPair, total_args_passed);
-    int i = 0;
-    if (!method->is_static())  // Pass in receiver first
-      sig_bt[i++] = T_OBJECT;
-    for (SignatureStream ss(method->signature()); !ss.at_return_type(); ss.next()) {
-      sig_bt[i++] = ss.type();  // Collect remaining bits of signature
-      if (ss.type() == T_LONG || ss.type() == T_DOUBLE)
-        sig_bt[i++] = T_VOID;   // Longs & doubles take 2 Java slots
-    }
-    assert(i == total_args_passed, "");
+    VMRegPair* regs = NEW_RESOURCE_ARRAY(VMRegPair, total_args_passed);
 
     // Lookup method signature's fingerprint
     entry = _adapters->lookup(total_args_passed, sig_bt);
@@ -2783,9 +2896,14 @@ AdapterHandlerEntry* AdapterHandlerLibrary::get_adapter0(const methodHandle& met
     if (PrintAdapterHandlers || PrintStubCode) {
       ttyLocker ttyl;
       entry->print_adapter_on(tty);
-      tty->print_cr("i2c argument handler #%d for: %s %s %s (%d bytes generated)",
-                    _adapters->number_of_entries(), (method->is_static() ? "static" : "receiver"),
-                    method->signature()->as_C_string(), fingerprint->as_string(), insts_size);
+      if (method != NULL) {
+        tty->print_cr("i2c argument handler #%d for: %s %s %s (%d bytes generated)",
+                      _adapters->number_of_entries(), ((*method)->is_static() ? "static" : "receiver"),
+                      (*method)->signature()->as_C_string(), fingerprint->as_string(), insts_size);
+      } else {
+        tty->print_cr("i2c argument handler #%d for: %s (%d bytes generated)",
+                      _adapters->number_of_entries(), fingerprint->as_string(), insts_size);
+      }
       tty->print_cr("c2i argument handler starts at %p", entry->get_c2i_entry());
       if (Verbose || PrintStubCode) {
         address first_pc = entry->base_address();
@@ -3144,8 +3262,9 @@ JRT_LEAF(intptr_t*, SharedRuntime::OSR_migration_begin( JavaThread *thread) )
        kptr2 = fr.next_monitor_in_interpreter_frame(kptr2) ) {
     if (kptr2->obj() != NULL) {         // Avoid 'holes' in the monitor array
       BasicLock *lock = kptr2->lock();
-      // Inflate so the displaced header becomes position-independent
-      if (lock->displaced_header()->is_unlocked())
+      // Inflate so the displaced header becomes position-independent.
+      // Lightweight locking keeps no header in the BasicLock.
+      if (!UseLightweightLocking && lock->displaced_header()->is_unlocked())
         ObjectSynchronizer::inflate_helper(kptr2->obj());
       // Now the displaced header is free to move
       buf[i++] = (intptr_t)lock->displaced_header();
@@ -37,6 +37,7 @@ class AdapterHandlerEntry;
 class AdapterHandlerTable;
 class AdapterFingerPrint;
 class vframeStream;
+class EventCompiledExceptionDispatch;
 
 // Runtime is the base class for various runtime interfaces
 // (InterpreterRuntime, CompilerRuntime, etc.). It provides
@@ -188,6 +189,10 @@ class SharedRuntime: AllStatic {
   // exception handling and implicit exceptions
   static address compute_compiled_exc_handler(CompiledMethod* nm, address ret_pc, Handle& exception,
                                               bool force_unwind, bool top_frame_only, bool& recursive_exception_occurred);
+  // Commits the CompiledExceptionDispatch event of a handler lookup in cm at pc,
+  // cached telling whether the handler came from the exception cache
+  static void post_exception_dispatch_event(EventCompiledExceptionDispatch& event, CompiledMethod* cm,
+                                            address pc, Handle exception, bool cached);
   enum ImplicitExceptionKind {
     IMPLICIT_NULL,
     IMPLICIT_DIVIDE_BY_ZERO,
@@ -713,9 +718,19 @@ class AdapterHandlerLibrary: public AllStatic {
   static BufferBlob* _buffer; // the temporary code buffer in CodeCache
   static AdapterHandlerTable* _adapters;
   static AdapterHandlerEntry* _abstract_method_handler;
+  // Shared adapters for the most common signatures, see generate_common_adapters()
+  static AdapterHandlerEntry* _no_arg_handler;
+  static AdapterHandlerEntry* _int_arg_handler;
+  static AdapterHandlerEntry* _obj_arg_handler;
+  static AdapterHandlerEntry* _obj_int_arg_handler;
+  static AdapterHandlerEntry* _obj_obj_arg_handler;
+  static volatile bool _common_adapters_generated;
   static BufferBlob* buffer_blob();
   static void initialize();
+  static AdapterHandlerEntry* get_simple_adapter(const methodHandle& method);
   static AdapterHandlerEntry* get_adapter0(const methodHandle& method);
+  static AdapterHandlerEntry* get_adapter_for(int total_args_passed, BasicType* sig_bt,
+                                              const methodHandle* method);
 
  public:
 
@@ -723,6 +738,9 @@ class AdapterHandlerLibrary: public AllStatic {
                                         address i2c_entry, address c2i_entry, address c2i_unverified_entry);
   static void create_native_wrapper(const methodHandle& method);
   static AdapterHandlerEntry* get_adapter(const methodHandle& method);
+  // Generate the adapters for the most common signatures so that they
+  // can be looked up without taking AdapterHandlerLibrary_lock.
+  static void generate_common_adapters();
 
   static void print_handler(const CodeBlob* b) { print_handler_on(tty, b); }
   static void print_handler_on(outputStream* st, const CodeBlob* b);
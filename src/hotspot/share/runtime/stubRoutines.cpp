@@ -153,6 +153,8 @@ address StubRoutines::_montgomeryMultiply = NULL;
 address StubRoutines::_montgomerySquare = NULL;
 
 address StubRoutines::_vectorizedMismatch = NULL;
+address StubRoutines::_vectorizedHashCodeB = NULL;
+address StubRoutines::_vectorizedHashCodeI = NULL;
 
 address StubRoutines::_dexp = NULL;
 address StubRoutines::_dlog = NULL;
@@ -197,6 +197,8 @@ class StubRoutines: AllStatic {
   static address _montgomerySquare;
 
   static address _vectorizedMismatch;
+  static address _vectorizedHashCodeB;
+  static address _vectorizedHashCodeI;
 
   static address _dexp;
   static address _dlog;
@@ -374,6 +376,8 @@ class StubRoutines: AllStatic {
   static address montgomerySquare()    { return _montgomerySquare; }
 
   static address vectorizedMismatch()  { return _vectorizedMismatch; }
+  static address vectorizedHashCodeB() { return _vectorizedHashCodeB; }
+  static address vectorizedHashCodeI() { return _vectorizedHashCodeI; }
 
   static address dexp()                { return _dexp; }
   static address dlog()                { return _dlog; }
@@ -287,7 +287,14 @@ CodeBlobClosure* NMethodSweeper::prepare_mark_active_nmethods() {
 }
 
 CodeBlobClosure* NMethodSweeper::prepare_reset_hotness_counters() {
-  assert(SafepointSynchronize::is_at_safepoint(), "must be executed at a safepoint");
+#ifdef ASSERT
+  if (concurrent_aging()) {
+    assert(Thread::current()->is_Code_cache_sweeper_thread(), "must be executed under CodeCache_lock and in sweeper thread");
+    assert_lock_strong(CodeCache_lock);
+  } else {
+    assert(SafepointSynchronize::is_at_safepoint(), "must be executed at a safepoint");
+  }
+#endif
 
   // If we do not want to reclaim not-entrant or zombie methods there is no need
   // to scan stacks
@@ -336,16 +343,50 @@ void NMethodSweeper::do_stack_scanning() {
   }
 }
 
+/**
+  * Resets the hotness counters of the nmethods active on the stacks of all
+  * Java threads, one thread at a time. Replaces the reset done in every
+  * safepoint cleanup when ConcurrentCodeCacheAging is set.
+  */
+void NMethodSweeper::do_concurrent_aging() {
+  assert(!CodeCache_lock->owned_by_self(), "just checking");
+  CodeBlobClosure* code_cl;
+  {
+    MutexLockerEx ccl(CodeCache_lock, Mutex::_no_safepoint_check_flag);
+    code_cl = prepare_reset_hotness_counters();
+  }
+  if (code_cl != NULL) {
+    NMethodMarkingClosure nm_cl(code_cl);
+    Handshake::execute(&nm_cl);
+    log_debug(codecache, sweep)("Reset hotness counters of active nmethods, time counter %ld", _time_counter);
+  }
+}
+
 void NMethodSweeper::sweeper_loop() {
   bool timeout;
+  jlong last_aging = os::javaTimeNanos();
   while (true) {
     {
       ThreadBlockInVM tbivm(JavaThread::current());
       MutexLockerEx waiter(CodeCache_lock, Mutex::_no_safepoint_check_flag);
-      const long wait_time = 60*60*24 * 1000;
+      long wait_time = 60*60*24 * 1000;
+      if (concurrent_aging()) {
+        // Wake up when the next aging is due, however often we get notified
+        jlong since_aging = (os::javaTimeNanos() - last_aging) / NANOSECS_PER_MILLISEC;
+        wait_time = MAX2((long)CodeCacheAgingInterval - (long)since_aging, 1L);
+      }
       timeout = CodeCache_lock->wait(Mutex::_no_safepoint_check_flag, wait_time);
     }
-    if (!timeout) {
+    if (concurrent_aging()) {
+      jlong now = os::javaTimeNanos();
+      if ((now - last_aging) / NANOSECS_PER_MILLISEC >= (jlong)CodeCacheAgingInterval) {
+        do_concurrent_aging();
+        last_aging = now;
+      }
+      // The virtual time now advances with the aging interval instead of
+      // the safepoint rate, so periodic sweeps are checked on every wakeup.
+      possibly_sweep();
+    } else if (!timeout) {
       possibly_sweep();
     }
   }
@@ -741,6 +782,7 @@ NMethodSweeper::MethodStateChange NMethodSweeper::process_compiled_method(Compil
     }
   } else {
     if (cm->is_nmethod()) {
+      possibly_recompile_hot((nmethod*)cm);
       possibly_flush((nmethod*)cm);
     }
     // Clean inline caches that point to zombie/non-entrant/unloaded nmethods
@@ -751,6 +793,43 @@ NMethodSweeper::MethodStateChange NMethodSweeper::process_compiled_method(Compil
 }
 
 
+// With a hot code heap, a tier 4 nmethod that HotCodeMinSweeps consecutive
+// sweeps found active on a stack is made not entrant and its method marked,
+// so that the next tier 4 compile of the method is placed in the hot heap.
+// Every method is recompiled for this at most once.
+void NMethodSweeper::possibly_recompile_hot(nmethod* nm) {
+  if (!CodeCache::has_hot_heap()) {
+    return;
+  }
+  if (nm->hotness_counter() != hotness_counter_reset_val()) {
+    // Not seen on a stack since the last sweep
+    nm->reset_hot_sweeps();
+    return;
+  }
+  if (!UseCodeCacheFlushing) {
+    // possibly_flush() does not age the nmethod: do it here so that the
+    // counter is only back at the reset value if the next stack scan
+    // finds the nmethod active again.
+    nm->dec_hotness_counter();
+  }
+  if (nm->inc_hot_sweeps() < HotCodeMinSweeps) {
+    return;
+  }
+  if (!nm->is_in_use() || nm->is_locked_by_vm() || nm->is_osr_method() ||
+      nm->comp_level() != CompLevel_full_optimization || nm->method()->is_hot_code() ||
+      CodeCache::is_in_hot_heap(nm)) {
+    return;
+  }
+  // Leave room for the recompiled code, which may be larger
+  if (CodeCache::hot_heap_unallocated_capacity() < (size_t)nm->size() * 2) {
+    return;
+  }
+  nm->method()->set_hot_code(true);
+  nm->make_not_entrant();
+  log_debug(codecache, sweep)("Nmethod %d/" PTR_FORMAT " made not entrant for recompilation into the hot code heap",
+                              nm->compile_id(), p2i(nm));
+}
+
 void NMethodSweeper::possibly_flush(nmethod* nm) {
   if (UseCodeCacheFlushing) {
     if (!nm->is_locked_by_vm() && !nm->is_native_method() && !nm->is_not_installed() && !nm->is_unloading()) {
@@ -56,6 +56,9 @@ class CodeBlobClosure;
 //     cleared. After that, the nmethod can be evicted from the code cache. Each nmethod's
 //     state change happens during separate sweeps. It may take at least 3 sweeps before an
 //     nmethod's space is freed.
+// With ConcurrentCodeCacheAging, the hotness counters are not reset during safepoint
+// cleanup. The sweeper thread instead wakes up every CodeCacheAgingInterval milliseconds
+// and resets them with a handshake, which only stops one thread at a time.
 
 class NMethodSweeper : public AllStatic {
  private:
@@ -95,6 +98,7 @@ class NMethodSweeper : public AllStatic {
   static void sweep_code_cache();
   static void handle_safepoint_request();
   static void do_stack_scanning();
+  static void do_concurrent_aging();
   static void possibly_sweep();
  public:
   static long traversal_count()              { return _traversals; }
@@ -115,6 +119,11 @@ class NMethodSweeper : public AllStatic {
   static void mark_active_nmethods();      // Invoked at the end of each safepoint
   static CodeBlobClosure* prepare_mark_active_nmethods();
   static CodeBlobClosure* prepare_reset_hotness_counters();
+  // Age nmethods from the sweeper thread with handshakes instead of in
+  // every safepoint cleanup (see ConcurrentCodeCacheAging)
+  static bool concurrent_aging() {
+    return ConcurrentCodeCacheAging && ThreadLocalHandshakes && UseCodeAging;
+  }
   static void sweeper_loop();
   static void notify(int code_blob_type);  // Possibly start the sweeper thread.
   static void force_sweep();
@@ -123,6 +132,7 @@ class NMethodSweeper : public AllStatic {
   static void report_state_change(nmethod* nm);
   static void possibly_enable_sweeper();
   static void possibly_flush(nmethod* nm);
+  static void possibly_recompile_hot(nmethod* nm);
   static void print(outputStream* out);   // Printing/debugging
   static void print() { print(tty); }
 };
@@ -36,6 +36,7 @@
 #include "runtime/biasedLocking.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
+#include "runtime/lockStack.inline.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/objectMonitor.hpp"
 #include "runtime/objectMonitor.inline.hpp"
@@ -129,6 +130,13 @@ static volatile int gMonitorPopulation = 0;  // # Extant -- in circulation
 
 #define CHAINMARKER (cast_to_oop<intptr_t>(-1))
 
+// With UseLightweightLocking an object is fast-locked by the thread that
+// has it on its lock stack.
+static inline bool fast_locked_by(Thread* thread, oop obj) {
+  return thread->is_Java_thread() &&
+         ((JavaThread*) thread)->lock_stack().contains(obj);
+}
+
 
 // =====================> Quick functions
 
@@ -160,7 +168,13 @@ bool ObjectSynchronizer::quick_notify(oopDesc * obj, Thread * self, bool all) {
   if (obj == NULL) return false;  // slow-path for invalid obj
   const markOop mark = obj->mark();
 
-  if (mark->has_locker() && self->is_lock_owned((address)mark->locker())) {
+  if (UseLightweightLocking) {
+    if (mark->is_fast_locked() && fast_locked_by(self, obj)) {
+      // Degenerate notify
+      // fast-locked by caller so by definition the implied waitset is empty.
+      return true;
+    }
+  } else if (mark->has_locker() && self->is_lock_owned((address)mark->locker())) {
     // Degenerate notify
     // stack-locked by caller so by definition the implied waitset is empty.
     return true;
@@ -285,6 +299,28 @@ void ObjectSynchronizer::fast_exit(oop object, BasicLock* lock, TRAPS) {
   assert(mark == markOopDesc::INFLATING() ||
          !mark->has_bias_pattern(), "should not see bias pattern here");
 
+  if (UseLightweightLocking) {
+    // The BasicLock is not used: a fast-locked object is on the lock
+    // stack of its owner and its mark keeps the hash and age bits.
+    while (mark->is_fast_locked()) {
+      assert(fast_locked_by(THREAD, object), "must be fast-locked by current thread");
+      // Another thread may install a hash code or inflate concurrently,
+      // so retry the CAS until the mark is no longer fast-locked.
+      markOop unlocked_mark = mark->set_unlocked();
+      markOop old_mark = object->cas_set_mark(unlocked_mark, mark);
+      if (old_mark == mark) {
+        ((JavaThread*) THREAD)->lock_stack().remove(object);
+        TEVENT(fast_exit: release fast-lock);
+        return;
+      }
+      mark = old_mark;
+    }
+    ObjectSynchronizer::inflate(THREAD,
+                                object,
+                                inflate_cause_vm_internal)->exit(true, THREAD);
+    return;
+  }
+
   markOop dhw = lock->displaced_header();
   if (dhw == NULL) {
     // If the displaced header is NULL, then this exit matches up with
@@ -340,7 +376,24 @@ void ObjectSynchronizer::slow_enter(Handle obj, BasicLock* lock, TRAPS) {
   markOop mark = obj->mark();
   assert(!mark->has_bias_pattern(), "should not see bias pattern here");
 
-  if (mark->is_neutral()) {
+  if (UseLightweightLocking) {
+    if (THREAD->is_Java_thread()) {
+      LockStack& lock_stack = ((JavaThread*) THREAD)->lock_stack();
+      // A recursive enter, or an enter with a full lock stack, is not
+      // fast-locked but inflates below.
+      while (mark->is_neutral() && lock_stack.can_push()) {
+        markOop locked_mark = mark->set_fast_locked();
+        markOop old_mark = obj()->cas_set_mark(locked_mark, mark);
+        if (old_mark == mark) {
+          lock_stack.push(obj());
+          TEVENT(slow_enter: fast-lock);
+          return;
+        }
+        mark = old_mark;
+      }
+    }
+    // Fall through to inflate() ...
+  } else if (mark->is_neutral()) {
     // Anticipate successful CAS -- the ST of the displaced mark must
     // be visible <= the ST performed by the CAS.
     lock->set_displaced_header(mark);
@@ -520,7 +573,11 @@ void ObjectSynchronizer::notify(Handle obj, TRAPS) {
   }
 
   markOop mark = obj->mark();
-  if (mark->has_locker() && THREAD->is_lock_owned((address)mark->locker())) {
+  if (UseLightweightLocking) {
+    if (mark->is_fast_locked() && fast_locked_by(THREAD, obj())) {
+      return;
+    }
+  } else if (mark->has_locker() && THREAD->is_lock_owned((address)mark->locker())) {
     return;
   }
   ObjectSynchronizer::inflate(THREAD,
@@ -536,7 +593,11 @@ void ObjectSynchronizer::notifyall(Handle obj, TRAPS) {
   }
 
   markOop mark = obj->mark();
-  if (mark->has_locker() && THREAD->is_lock_owned((address)mark->locker())) {
+  if (UseLightweightLocking) {
+    if (mark->is_fast_locked() && fast_locked_by(THREAD, obj())) {
+      return;
+    }
+  } else if (mark->has_locker() && THREAD->is_lock_owned((address)mark->locker())) {
     return;
   }
   ObjectSynchronizer::inflate(THREAD,
@@ -583,7 +644,9 @@ static volatile int ForceMonitorScavenge = 0; // Scavenge required and pending
 
 static markOop ReadStableMark(oop obj) {
   markOop mark = obj->mark();
-  if (!mark->is_being_inflated()) {
+  if (!mark->is_being_inflated() || UseLightweightLocking) {
+    // Lightweight locking never publishes INFLATING: a fast-locked mark
+    // with no hash and age bits has the same encoding.
     return mark;       // normal fast-path return
   }
 
@@ -746,7 +809,9 @@ intptr_t ObjectSynchronizer::FastHashCode(Thread * Self, oop obj) {
   // object should remain ineligible for biased locking
   assert(!mark->has_bias_pattern(), "invariant");
 
-  if (mark->is_neutral()) {
+  if (mark->is_neutral() || (UseLightweightLocking && mark->is_fast_locked())) {
+    // A fast-locked mark keeps the hash bits of the unlocked header, so
+    // the hash is installed in place just as for a neutral mark.
     hash = mark->hash();              // this is a normal header
     if (hash) {                       // if it has hash, just return it
       return hash;
@@ -770,7 +835,7 @@ intptr_t ObjectSynchronizer::FastHashCode(Thread * Self, oop obj) {
       return hash;
     }
     // Skip to the following code to reduce code size
-  } else if (Self->is_lock_owned((address)mark->locker())) {
+  } else if (!UseLightweightLocking && Self->is_lock_owned((address)mark->locker())) {
     temp = mark->displaced_mark_helper(); // this is a lightweight monitor owned
     assert(temp->is_neutral(), "invariant");
     hash = temp->hash();              // by current thread, check if the displaced
@@ -831,13 +896,21 @@ bool ObjectSynchronizer::current_thread_holds_lock(JavaThread* thread,
 
   markOop mark = ReadStableMark(obj);
 
-  // Uncontended case, header points to stack
-  if (mark->has_locker()) {
+  if (UseLightweightLocking) {
+    // Uncontended case, object is on the owner's lock stack
+    if (mark->is_fast_locked()) {
+      return thread->lock_stack().contains(obj);
+    }
+  } else if (mark->has_locker()) {
+    // Uncontended case, header points to stack
     return thread->is_lock_owned((address)mark->locker());
   }
   // Contended case, header points to ObjectMonitor (tagged pointer)
   if (mark->has_monitor()) {
     ObjectMonitor* monitor = mark->monitor();
+    if (UseLightweightLocking && monitor->is_owner_anonymous()) {
+      return thread->lock_stack().contains(obj);
+    }
     return monitor->is_entered(thread) != 0;
   }
   // Unlocked case, header in place
@@ -870,8 +943,13 @@ ObjectSynchronizer::LockOwnership ObjectSynchronizer::query_lock_ownership
   oop obj = h_obj();
   markOop mark = ReadStableMark(obj);
 
-  // CASE: stack-locked.  Mark points to a BasicLock on the owner's stack.
-  if (mark->has_locker()) {
+  if (UseLightweightLocking) {
+    // CASE: fast-locked.  Object is on the owner's lock stack.
+    if (mark->is_fast_locked()) {
+      return self->lock_stack().contains(obj) ? owner_self : owner_other;
+    }
+  } else if (mark->has_locker()) {
+    // CASE: stack-locked.  Mark points to a BasicLock on the owner's stack.
     return self->is_lock_owned((address)mark->locker()) ?
       owner_self : owner_other;
   }
@@ -882,6 +960,9 @@ ObjectSynchronizer::LockOwnership ObjectSynchronizer::query_lock_ownership
   if (mark->has_monitor()) {
     void * owner = mark->monitor()->_owner;
     if (owner == NULL) return owner_none;
+    if (UseLightweightLocking && mark->monitor()->is_owner_anonymous()) {
+      return self->lock_stack().contains(obj) ? owner_self : owner_other;
+    }
     return (owner == self ||
             self->is_lock_owned((address)owner)) ? owner_self : owner_other;
   }
@@ -891,6 +972,13 @@ ObjectSynchronizer::LockOwnership ObjectSynchronizer::query_lock_ownership
   return owner_none;           // it's unlocked
 }
 
+bool ObjectSynchronizer::is_monitor_owner(ObjectMonitor* monitor, JavaThread* thread) {
+  if (UseLightweightLocking && monitor->is_owner_anonymous()) {
+    return thread->lock_stack().contains((oop)monitor->object());
+  }
+  return monitor->is_entered(thread) != 0;
+}
+
 // FIXME: jvmti should call this
 JavaThread* ObjectSynchronizer::get_lock_owner(ThreadsList * t_list, Handle h_obj) {
   if (UseBiasedLocking) {
@@ -907,8 +995,13 @@ JavaThread* ObjectSynchronizer::get_lock_owner(ThreadsList * t_list, Handle h_ob
 
   markOop mark = ReadStableMark(obj);
 
-  // Uncontended case, header points to stack
-  if (mark->has_locker()) {
+  if (UseLightweightLocking) {
+    // Uncontended case, object is on the owner's lock stack
+    if (mark->is_fast_locked()) {
+      return Threads::owning_thread_from_object(t_list, obj);
+    }
+  } else if (mark->has_locker()) {
+    // Uncontended case, header points to stack
     owner = (address) mark->locker();
   }
 
@@ -916,6 +1009,9 @@ JavaThread* ObjectSynchronizer::get_lock_owner(ThreadsList * t_list, Handle h_ob
   if (mark->has_monitor()) {
     ObjectMonitor* monitor = mark->monitor();
     assert(monitor != NULL, "monitor should be non-null");
+    if (UseLightweightLocking && monitor->is_owner_anonymous()) {
+      return Threads::owning_thread_from_object(t_list, obj);
+    }
     owner = (address) monitor->owner();
   }
 
@@ -949,6 +1045,60 @@ void ObjectSynchronizer::monitors_iterate(MonitorClosure* closure) {
   }
 }
 
+// Collects the monitors with the largest total contended wait
+class ContendedMonitorsClosure : public MonitorClosure {
+ private:
+  enum { Limit = 10 };
+  ObjectMonitor* _top[Limit];
+  int _count;
+
+ public:
+  ContendedMonitorsClosure() : _count(0) { }
+
+  void do_monitor(ObjectMonitor* mid) {
+    if (mid->contended_enters() == 0) {
+      return;
+    }
+    jlong total = mid->contended_wait_total();
+    if (_count == Limit && total <= _top[Limit - 1]->contended_wait_total()) {
+      return;
+    }
+    // Insertion sort, largest total wait first
+    int i = (_count < Limit) ? _count++ : Limit - 1;
+    while (i > 0 && _top[i - 1]->contended_wait_total() < total) {
+      _top[i] = _top[i - 1];
+      i--;
+    }
+    _top[i] = mid;
+  }
+
+  void print_on(outputStream* st) {
+    ResourceMark rm;
+    st->print_cr("Contended monitors:");
+    if (_count == 0) {
+      st->print_cr("\t- None");
+    }
+    for (int i = 0; i < _count; i++) {
+      ObjectMonitor* mid = _top[i];
+      oop obj = (oop) mid->object();
+      st->print_cr("\t- <" INTPTR_FORMAT "> (a %s) contended enters: %d, total wait: %.3f ms, "
+                   "recent average wait: %.3f us, threads entering: %d",
+                   p2i(obj), obj->klass()->external_name(), mid->contended_enters(),
+                   (double) mid->contended_wait_total() / NANOUNITS * MILLIUNITS,
+                   (double) mid->contended_wait() / NANOUNITS * MICROUNITS,
+                   mid->contentions());
+    }
+    st->cr();
+  }
+};
+
+void ObjectSynchronizer::print_contended_monitors(outputStream* st) {
+  assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
+  ContendedMonitorsClosure cl;
+  monitors_iterate(&cl);
+  cl.print_on(st);
+}
+
 // Get the next block in the block list.
 static inline PaddedEnd<ObjectMonitor>* next(PaddedEnd<ObjectMonitor>* block) {
   assert(block->object() == CHAINMARKER, "must be a block header");
@@ -973,6 +1123,11 @@ bool ObjectSynchronizer::is_cleanup_needed() {
   return false;
 }
 
+// A thread ran out of monitors and asked for a scavenge by InduceScavenge()
+bool ObjectSynchronizer::is_scavenge_pending() {
+  return ForceMonitorScavenge != 0;
+}
+
 void ObjectSynchronizer::oops_do(OopClosure* f) {
   if (MonitorInUseLists) {
     // When using thread local monitor lists, we only scan the
@@ -1257,6 +1412,10 @@ void ObjectSynchronizer::omRelease(Thread * Self, ObjectMonitor * m,
     bool extracted = false;
     for (ObjectMonitor* mid = Self->omInUseList; mid != NULL; cur_mid_in_use = mid, mid = mid->FreeNext) {
       if (m == mid) {
+        if (mid == Self->omInUseCursor) {
+          // Incremental deflation restarts from the head of the list
+          Self->omInUseCursor = NULL;
+        }
         // extract from per-thread in-use list
         if (mid == Self->omInUseList) {
           Self->omInUseList = mid->FreeNext;
@@ -1327,6 +1486,7 @@ void ObjectSynchronizer::omFlush(Thread * Self) {
   int inUseTally = 0;
   if (inUseList != NULL) {
     Self->omInUseList = NULL;
+    Self->omInUseCursor = NULL;
     ObjectMonitor *cur_om;
     // The thread is going away, however the omInUseList inflated
     // monitors may still be in-use by other threads.
@@ -1402,6 +1562,7 @@ ObjectMonitor* ObjectSynchronizer::inflate(Thread * Self,
     // The mark can be in one of the following states:
     // *  Inflated     - just return
     // *  Stack-locked - coerce it to inflated
+    // *  Fast-locked  - coerce it to inflated (UseLightweightLocking)
     // *  INFLATING    - busy wait for conversion to complete
     // *  Neutral      - aggressively inflate the object.
     // *  BIASED       - Illegal.  We should never see this
@@ -1412,9 +1573,62 @@ ObjectMonitor* ObjectSynchronizer::inflate(Thread * Self,
       assert(inf->header()->is_neutral(), "invariant");
       assert(inf->object() == object, "invariant");
       assert(ObjectSynchronizer::verify_objmon_isinpool(inf), "monitor is invalid");
+      if (UseLightweightLocking && inf->is_owner_anonymous() &&
+          fast_locked_by(Self, object)) {
+        // Another thread inflated over our fast-lock; claim the monitor.
+        inf->set_owner(Self);
+        ((JavaThread*) Self)->lock_stack().remove(object);
+      }
       return inf;
     }
 
+    // CASE: fast-locked
+    // Could be fast-locked either by this thread or by some other thread.
+    // There is no INFLATING protocol here: the mark keeps the header bits,
+    // so the monitor is published with a single CAS.  If the lock holder
+    // is some other thread, the monitor is owned anonymously until the
+    // holder claims it above.
+    if (UseLightweightLocking && mark->is_fast_locked()) {
+      ObjectMonitor * m = omAlloc(Self);
+      m->Recycle();
+      m->set_header(mark->set_unlocked());
+      const bool own = fast_locked_by(Self, object);
+      if (own) {
+        m->set_owner(Self);
+      } else {
+        m->set_owner_anonymous();
+      }
+      m->set_object(object);
+      m->_Responsible  = NULL;
+      m->_SpinDuration = ObjectMonitor::Knob_SpinLimit;
+
+      if (object->cas_set_mark(markOopDesc::encode(m), mark) != mark) {
+        m->set_object(NULL);
+        m->set_owner(NULL);
+        m->Recycle();
+        omRelease(Self, m, true);
+        continue;       // Interference -- just retry
+      }
+      if (own) {
+        ((JavaThread*) Self)->lock_stack().remove(object);
+      }
+
+      OM_PERFDATA_OP(Inflations, inc());
+      TEVENT(Inflate: overwrite fast-lock);
+      if (log_is_enabled(Debug, monitorinflation)) {
+        if (object->is_instance()) {
+          ResourceMark rm;
+          log_debug(monitorinflation)("Inflating object " INTPTR_FORMAT " , mark " INTPTR_FORMAT " , type %s",
+                                      p2i(object), p2i(object->mark()),
+                                      object->klass()->external_name());
+        }
+      }
+      if (event.should_commit()) {
+        post_monitor_inflate_event(&event, object, cause);
+      }
+      return m;
+    }
+
     // CASE: inflation in progress - inflating over a stack-lock.
     // Some other thread is converting from stack-locked to inflated.
     // Only that thread can complete inflation -- other threads must wait.
@@ -1706,6 +1920,41 @@ int ObjectSynchronizer::deflate_monitor_list(ObjectMonitor** listHeadp,
   return deflated_count;
 }
 
+// Walk at most MonitorDeflationBudget monitors of a thread's in-use list and
+// deflate the idle ones. The walk starts after the last monitor kept by the
+// previous walk (omInUseCursor), and wraps around to the head of the list
+// once the end is reached, so that every monitor is examined eventually.
+// The cursor is reset by omRelease() and omFlush() when they unlink it.
+int ObjectSynchronizer::deflate_monitor_list_incrementally(Thread* thread,
+                                                           ObjectMonitor** freeHeadp,
+                                                           ObjectMonitor** freeTailp) {
+  ObjectMonitor* cur_mid_in_use = thread->omInUseCursor;
+  ObjectMonitor* mid = (cur_mid_in_use != NULL) ? cur_mid_in_use->FreeNext : thread->omInUseList;
+  int deflated_count = 0;
+
+  for (int scanned = 0; mid != NULL && scanned < MonitorDeflationBudget; scanned++) {
+    ObjectMonitor* next = mid->FreeNext;
+    oop obj = (oop) mid->object();
+    if (obj != NULL && deflate_monitor(mid, obj, freeHeadp, freeTailp)) {
+      // extract from per-thread in-use list
+      if (cur_mid_in_use == NULL) {
+        thread->omInUseList = next;
+      } else {
+        cur_mid_in_use->FreeNext = next;
+      }
+      mid->FreeNext = NULL;  // This mid is current tail in the freeHeadp list
+      deflated_count++;
+    } else {
+      cur_mid_in_use = mid;
+    }
+    mid = next;
+  }
+
+  // Resume after the last kept monitor, or from the head at the end of the list
+  thread->omInUseCursor = (mid != NULL) ? cur_mid_in_use : NULL;
+  return deflated_count;
+}
+
 void ObjectSynchronizer::prepare_deflate_idle_monitors(DeflateMonitorCounters* counters) {
   counters->nInuse = 0;          // currently associated with objects
   counters->nInCirculation = 0;  // extant
@@ -1811,7 +2060,14 @@ void ObjectSynchronizer::deflate_thread_local_monitors(Thread* thread, DeflateMo
   ObjectMonitor * freeHeadp = NULL;  // Local SLL of scavenged monitors
   ObjectMonitor * freeTailp = NULL;
 
-  int deflated_count = deflate_monitor_list(thread->omInUseList_addr(), &freeHeadp, &freeTailp);
+  int deflated_count;
+  if (MonitorDeflationBudget > 0 && ForceMonitorScavenge == 0) {
+    deflated_count = deflate_monitor_list_incrementally(thread, &freeHeadp, &freeTailp);
+  } else {
+    // MonitorBound needs all idle monitors back, walk the whole list
+    thread->omInUseCursor = NULL;
+    deflated_count = deflate_monitor_list(thread->omInUseList_addr(), &freeHeadp, &freeTailp);
+  }
 
   Thread::muxAcquire(&gListLock, "scavenge - return");
 
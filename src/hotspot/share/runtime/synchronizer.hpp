@@ -128,9 +128,16 @@ class ObjectSynchronizer : AllStatic {
 
   static JavaThread* get_lock_owner(ThreadsList * t_list, Handle h_obj);
 
+  // Returns true if the inflated monitor is owned by thread. With
+  // UseLightweightLocking an anonymously owned monitor belongs to the
+  // thread that has its object on the lock stack.
+  static bool is_monitor_owner(ObjectMonitor* monitor, JavaThread* thread);
+
   // JNI detach support
   static void release_monitors_owned_by_thread(TRAPS);
   static void monitors_iterate(MonitorClosure* m);
+  // Print the monitors with the most contention, see ObjectMonitor::_contended_enters
+  static void print_contended_monitors(outputStream* st);
 
   // GC: we current use aggressive monitor deflation policy
   // Basically we deflate all monitors that are not busy.
@@ -144,10 +151,15 @@ class ObjectSynchronizer : AllStatic {
   static int deflate_monitor_list(ObjectMonitor** listheadp,
                                   ObjectMonitor** freeHeadp,
                                   ObjectMonitor** freeTailp);
+  // For a thread's in-use list, deflate idle monitors within MonitorDeflationBudget
+  static int deflate_monitor_list_incrementally(Thread* thread,
+                                                ObjectMonitor** freeHeadp,
+                                                ObjectMonitor** freeTailp);
   static bool deflate_monitor(ObjectMonitor* mid, oop obj,
                               ObjectMonitor** freeHeadp,
                               ObjectMonitor** freeTailp);
   static bool is_cleanup_needed();
+  static bool is_scavenge_pending();
   static void oops_do(OopClosure* f);
   // Process oops in thread local used monitors
   static void thread_local_used_oops_do(Thread* thread, OopClosure* f);
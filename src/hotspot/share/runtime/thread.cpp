@@ -26,6 +26,7 @@
 #include "precompiled.hpp"
 #include "jvm.h"
 #include "classfile/classLoader.hpp"
+#include "classfile/classPreloader.hpp"
 #include "classfile/javaClasses.hpp"
 #include "classfile/moduleEntry.hpp"
 #include "classfile/systemDictionary.hpp"
@@ -37,6 +38,7 @@
 #include "gc/shared/barrierSet.hpp"
 #include "gc/shared/gcId.hpp"
 #include "gc/shared/gcLocker.inline.hpp"
+#include "gc/shared/heapLimitPoller.hpp"
 #include "gc/shared/workgroup.hpp"
 #include "interpreter/interpreter.hpp"
 #include "interpreter/linkResolver.hpp"
@@ -44,6 +46,7 @@
 #include "jfr/jfrEvents.hpp"
 #include "jvmtifiles/jvmtiEnv.hpp"
 #include "logging/log.hpp"
+#include "logging/logAsyncWriter.hpp"
 #include "logging/logConfiguration.hpp"
 #include "logging/logStream.hpp"
 #include "memory/allocation.inline.hpp"
@@ -79,6 +82,7 @@
 #include "runtime/javaCalls.hpp"
 #include "runtime/jniHandles.inline.hpp"
 #include "runtime/jniPeriodicChecker.hpp"
+#include "runtime/lockStack.inline.hpp"
 #include "runtime/memprofiler.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/objectMonitor.hpp"
@@ -233,6 +237,7 @@ Thread::Thread() {
   DEBUG_ONLY(_current_resource_mark = NULL;)
   set_handle_area(new (mtThread) HandleArea(NULL));
   set_metadata_handles(new (ResourceObj::C_HEAP, mtClass) GrowableArray<Metadata*>(30, true));
+  set_metaspace_allocation_cache(NULL);
   set_active_handles(NULL);
   set_free_handle_block(NULL);
   set_last_handle_mark(NULL);
@@ -266,6 +271,7 @@ Thread::Thread() {
   omFreeProvision = 32;
   omInUseList = NULL;
   omInUseCount = 0;
+  omInUseCursor = NULL;
 
 #ifdef ASSERT
   _visited_for_critical_count = false;
@@ -1797,6 +1803,10 @@ JavaThread::~JavaThread() {
     delete deferred;
   }
 
+  // Handles released after exit may have been cached
+  _jni_global_handle_cache.flush();
+  _jni_weak_global_handle_cache.flush();
+
   // All Java related clean up happens in exit
   ThreadSafepointState::destroy(this);
   if (_thread_stat != NULL) delete _thread_stat;
@@ -2057,6 +2067,9 @@ void JavaThread::exit(bool destroy_vm, ExitType exit_type) {
     JNIHandleBlock::release_block(block);
   }
 
+  _jni_global_handle_cache.flush();
+  _jni_weak_global_handle_cache.flush();
+
   // These have to be removed while this is still a valid thread.
   remove_stack_guard_pages();
 
@@ -2113,6 +2126,9 @@ void JavaThread::cleanup_failed_attach_current_thread(bool is_daemon) {
     JNIHandleBlock::release_block(block);
   }
 
+  _jni_global_handle_cache.flush();
+  _jni_weak_global_handle_cache.flush();
+
   // These have to be removed while this is still a valid thread.
   remove_stack_guard_pages();
 
@@ -2912,6 +2928,10 @@ void JavaThread::oops_do(OopClosure* f, CodeBlobClosure* cf) {
       chunk->oops_do(f);
     }
 
+    if (UseLightweightLocking) {
+      lock_stack().oops_do(f);
+    }
+
     // Traverse the execution stack
     for (StackFrameStream fst(this); !fst.is_done(); fst.next()) {
       fst.current()->oops_do(f, cf, fst.register_map());
@@ -3894,6 +3914,7 @@ jint Threads::create_vm(JavaVMInitArgs* args, bool* canTryAgain) {
   set_init_completed();
 
   LogConfiguration::post_initialize();
+  AsyncLogWriter::initialize();
   Metaspace::post_initialize();
 
   HOTSPOT_VM_INIT_END();
@@ -4002,6 +4023,11 @@ jint Threads::create_vm(JavaVMInitArgs* args, bool* canTryAgain) {
   // Notify JVMTI agents that VM initialization is complete - nop if no agents.
   JvmtiExport::post_vm_initialized();
 
+  // Start loading the application's classes ahead of demand
+  if (PreloadClassList != NULL && !DumpSharedSpaces) {
+    ClassPreloader::initialize();
+  }
+
   JFR_ONLY(Jfr::on_create_vm_3();)
 
 #if INCLUDE_MANAGEMENT
@@ -4018,6 +4044,7 @@ jint Threads::create_vm(JavaVMInitArgs* args, bool* canTryAgain) {
   if (MemProfiling)                   MemProfiler::engage();
   StatSampler::engage();
   if (CheckJNICalls)                  JniPeriodicChecker::engage();
+  HeapLimitPoller::engage();
 
   BiasedLocking::init();
 
@@ -4652,6 +4679,23 @@ JavaThread *Threads::owning_thread_from_monitor_owner(ThreadsList * t_list,
   return the_owner;
 }
 
+JavaThread* Threads::owning_thread_from_object(ThreadsList* t_list, oop obj) {
+  assert(UseLightweightLocking, "Only with lightweight locking");
+  DO_JAVA_THREADS(t_list, q) {
+    if (q->lock_stack().contains(obj)) {
+      return q;
+    }
+  }
+  return NULL;
+}
+
+JavaThread* Threads::owning_thread_from_monitor(ThreadsList* t_list, ObjectMonitor* monitor) {
+  if (UseLightweightLocking && monitor->is_owner_anonymous()) {
+    return owning_thread_from_object(t_list, (oop) monitor->object());
+  }
+  return owning_thread_from_monitor_owner(t_list, (address) monitor->owner());
+}
+
 // Threads::print_on() is called at safepoint by VM_PrintThreads operation.
 void Threads::print_on(outputStream* st, bool print_stacks,
                        bool internal_format, bool print_concurrent_locks,
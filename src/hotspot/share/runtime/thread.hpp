@@ -28,6 +28,7 @@
 
 #include "jni.h"
 #include "gc/shared/gcThreadLocalData.hpp"
+#include "gc/shared/oopStorageCache.hpp"
 #include "gc/shared/threadLocalAllocBuffer.hpp"
 #include "memory/allocation.hpp"
 #include "oops/oop.hpp"
@@ -37,6 +38,7 @@
 #include "runtime/handshake.hpp"
 #include "runtime/javaFrameAnchor.hpp"
 #include "runtime/jniHandles.hpp"
+#include "runtime/lockStack.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/os.hpp"
 #include "runtime/osThread.hpp"
@@ -87,6 +89,7 @@ class ICRefillVerifier;
 class IdealGraphPrinter;
 
 class Metadata;
+class MetaspaceAllocationCache;
 template <class T, MEMFLAGS F> class ChunkedList;
 typedef ChunkedList<Metadata*, mtInternal> MetadataOnStackBuffer;
 
@@ -149,7 +152,7 @@ class Thread: public ThreadShadow {
 
   // JavaThread lifecycle support:
   friend class SafeThreadsListPtr;  // for _threads_list_ptr, cmpxchg_threads_hazard_ptr(), {dec_,inc_,}nested_threads_hazard_ptr_cnt(), {g,s}et_threads_hazard_ptr(), inc_nested_handle_cnt(), tag_hazard_ptr() access
-  friend class ScanHazardPtrGatherProtectedThreadsClosure;  // for cmpxchg_threads_hazard_ptr(), get_threads_hazard_ptr(), is_hazard_ptr_tagged() access
+  friend class ScanHazardPtrCheckProtectedThreadClosure;  // for cmpxchg_threads_hazard_ptr(), get_threads_hazard_ptr(), is_hazard_ptr_tagged() access
   friend class ScanHazardPtrGatherThreadsListClosure;  // for get_threads_hazard_ptr(), untag_hazard_ptr() access
   friend class ScanHazardPtrPrintMatchingThreadsClosure;  // for get_threads_hazard_ptr(), is_hazard_ptr_tagged() access
   friend class ThreadsSMRSupport;  // for _nested_threads_hazard_ptr_cnt, _threads_hazard_ptr, _threads_list_ptr access
@@ -386,6 +389,7 @@ class Thread: public ThreadShadow {
   int omFreeProvision;                          // reload chunk size
   ObjectMonitor* omInUseList;                   // SLL to track monitors in circulation
   int omInUseCount;                             // length of omInUseList
+  ObjectMonitor* omInUseCursor;                 // where MonitorDeflationBudget deflation resumes
 
 #ifdef ASSERT
  private:
@@ -537,6 +541,10 @@ class Thread: public ThreadShadow {
   GrowableArray<Metadata*>* metadata_handles() const          { return _metadata_handles; }
   void set_metadata_handles(GrowableArray<Metadata*>* handles){ _metadata_handles = handles; }
 
+  // Innermost metaspace allocation cache installed by this thread
+  MetaspaceAllocationCache* metaspace_allocation_cache() const { return _metaspace_allocation_cache; }
+  void set_metaspace_allocation_cache(MetaspaceAllocationCache* cache) { _metaspace_allocation_cache = cache; }
+
   // Thread-Local Allocation Buffer (TLAB) support
   ThreadLocalAllocBuffer& tlab()                 { return _tlab; }
   void initialize_tlab() {
@@ -641,6 +649,7 @@ protected:
   // Thread local handle area for allocation of handles within the VM
   HandleArea* _handle_area;
   GrowableArray<Metadata*>* _metadata_handles;
+  MetaspaceAllocationCache* _metaspace_allocation_cache;
 
   // Support for stack overflow handling, get_thread, etc.
   address          _stack_base;
@@ -974,6 +983,10 @@ class JavaThread: public Thread {
 
   JNIEnv        _jni_environment;
 
+  // Free JNI global and weak global handle entries; see UseJNIHandleCache
+  OopStorageCache _jni_global_handle_cache;
+  OopStorageCache _jni_weak_global_handle_cache;
+
   // Deopt support
   DeoptResourceMark*  _deopt_mark;               // Holds special ResourceMark for deoptimization
 
@@ -1306,6 +1319,14 @@ class JavaThread: public Thread {
     return _handshake.has_operation();
   }
 
+  void add_async_handshake_operation(AsyncHandshakeClosure* cl) {
+    _handshake.add_async_operation(this, cl);
+  }
+
+  bool has_async_handshake() const {
+    return _handshake.has_async_operation();
+  }
+
   void handshake_process_by_self() {
     _handshake.process_by_self(this);
   }
@@ -1314,6 +1335,10 @@ class JavaThread: public Thread {
     return _handshake.try_process_by_vmThread(this);
   }
 
+  bool handshake_process_at_safepoint() {
+    return _handshake.process_at_safepoint(this);
+  }
+
   // Suspend/resume support for JavaThread
  private:
   inline void set_ext_suspended();
@@ -1768,6 +1793,9 @@ class JavaThread: public Thread {
   // Returns the jni environment for this thread
   JNIEnv* jni_environment()                      { return &_jni_environment; }
 
+  OopStorageCache* jni_global_handle_cache()      { return &_jni_global_handle_cache; }
+  OopStorageCache* jni_weak_global_handle_cache() { return &_jni_weak_global_handle_cache; }
+
   static JavaThread* thread_from_jni_environment(JNIEnv* env) {
     JavaThread *thread_from_jni_env = (JavaThread*)((intptr_t)env - in_bytes(jni_environment_offset()));
     // Only return NULL if thread is off the thread list; starting to
@@ -2061,6 +2089,17 @@ class JavaThread: public Thread {
   GrowableArray<MonitorInfo*>* cached_monitor_info() { return _cached_monitor_info; }
   void set_cached_monitor_info(GrowableArray<MonitorInfo*>* info) { _cached_monitor_info = info; }
 
+  // Lightweight locking support
+ private:
+  LockStack _lock_stack;
+ public:
+  LockStack& lock_stack() { return _lock_stack; }
+
+  static ByteSize lock_stack_offset()      { return byte_offset_of(JavaThread, _lock_stack); }
+  // Offsets relative to the JavaThread, used by generated code
+  static ByteSize lock_stack_top_offset()  { return lock_stack_offset() + LockStack::top_offset(); }
+  static ByteSize lock_stack_base_offset() { return lock_stack_offset() + LockStack::base_offset(); }
+
   // clearing/querying jni attach status
   bool is_attaching_via_jni() const { return _jni_attach_state == _attaching_via_jni; }
   bool has_attached_via_jni() const { return is_attaching_via_jni() || _jni_attach_state == _attached_via_jni; }
@@ -2275,6 +2314,13 @@ class Threads: AllStatic {
   static JavaThread *owning_thread_from_monitor_owner(ThreadsList * t_list,
                                                       address owner);
 
+  // Get owning Java thread of an object fast-locked with UseLightweightLocking.
+  static JavaThread* owning_thread_from_object(ThreadsList* t_list, oop obj);
+
+  // Get owning Java thread of an inflated monitor, which may be owned
+  // anonymously after a fast-locked object was inflated by another thread.
+  static JavaThread* owning_thread_from_monitor(ThreadsList* t_list, ObjectMonitor* monitor);
+
   // Number of threads on the active threads list
   static int number_of_threads()                 { return _number_of_threads; }
   // Number of non-daemon threads on the active threads list
@@ -122,6 +122,14 @@ uint                  ThreadsSMRSupport::_to_delete_list_cnt = 0;
 // Impl note: See _to_delete_list_cnt note.
 uint                  ThreadsSMRSupport::_to_delete_list_max = 0;
 
+// # of ThreadsLists added to the to-delete list by Threads::add() since
+// the to-delete list was last scanned. Always maintained.
+uint                  ThreadsSMRSupport::_deferred_free_list_cnt = 0;
+
+// Max # of ThreadsLists Threads::add() puts on the to-delete list before
+// it scans the hazard ptrs to free them.
+static const uint DeferredFreeListLimit = 8;
+
 // 'inline' functions first so the definitions are before first use:
 
 inline void ThreadsSMRSupport::add_deleted_thread_times(uint add_value) {
@@ -204,43 +212,27 @@ class ThreadScanHashtable : public CHeapObj<mtThread> {
   }
 };
 
-// Closure to gather JavaThreads indirectly referenced by hazard ptrs
-// (ThreadsList references) into a hash table. This closure handles part 2
-// of the dance - adding all the JavaThreads referenced by the hazard
-// pointer (ThreadsList reference) to the hash table.
+// Closure to check if a JavaThread is indirectly referenced by a hazard
+// ptr (ThreadsList reference). Most hazard ptrs refer to the same few
+// ThreadsLists so each distinct ThreadsList is only searched once; with
+// many threads holding a ThreadsListHandle, gathering every JavaThread
+// referenced by every hazard ptr is quadratic in the number of threads.
 //
-class AddThreadHazardPointerThreadClosure : public ThreadClosure {
+class ScanHazardPtrCheckProtectedThreadClosure : public ThreadClosure {
  private:
-  ThreadScanHashtable *_table;
-
+  JavaThread *_thread;
+  ThreadScanHashtable *_lists;
+  bool _found;
  public:
-  AddThreadHazardPointerThreadClosure(ThreadScanHashtable *table) : _table(table) {}
+  ScanHazardPtrCheckProtectedThreadClosure(JavaThread *thread, ThreadScanHashtable *lists) :
+    _thread(thread), _lists(lists), _found(false) {}
 
-  virtual void do_thread(Thread *thread) {
-    if (!_table->has_entry((void*)thread)) {
-      // The same JavaThread might be on more than one ThreadsList or
-      // more than one thread might be using the same ThreadsList. In
-      // either case, we only need a single entry for a JavaThread.
-      _table->add_entry((void*)thread);
-    }
-  }
-};
-
-// Closure to gather JavaThreads indirectly referenced by hazard ptrs
-// (ThreadsList references) into a hash table. This closure handles part 1
-// of the dance - hazard ptr chain walking and dispatch to another
-// closure.
-//
-class ScanHazardPtrGatherProtectedThreadsClosure : public ThreadClosure {
- private:
-  ThreadScanHashtable *_table;
- public:
-  ScanHazardPtrGatherProtectedThreadsClosure(ThreadScanHashtable *table) : _table(table) {}
+  bool found() const { return _found; }
 
   virtual void do_thread(Thread *thread) {
     assert_locked_or_safepoint(Threads_lock);
 
-    if (thread == NULL) return;
+    if (thread == NULL || _found) return;
 
     // This code races with ThreadsSMRSupport::acquire_stable_list() which
     // is lock-free so we have to handle some special situations.
@@ -272,8 +264,10 @@ class ScanHazardPtrGatherProtectedThreadsClosure : public ThreadClosure {
     // ThreadsList that has been removed but not freed. In either case,
     // the hazard ptr is protecting all the JavaThreads on that
     // ThreadsList.
-    AddThreadHazardPointerThreadClosure add_cl(_table);
-    current_list->threads_do(&add_cl);
+    if (!_lists->has_entry((void*)current_list)) {
+      _lists->add_entry((void*)current_list);
+      _found = current_list->includes(_thread);
+    }
   }
 };
 
@@ -750,7 +744,7 @@ void ThreadsSMRSupport::add_thread(JavaThread *thread){
   log_debug(thread, smr)("tid=" UINTX_FORMAT ": Threads::add: new ThreadsList=" INTPTR_FORMAT, os::current_thread_id(), p2i(new_list));
 
   ThreadsList *old_list = xchg_java_thread_list(new_list);
-  free_list(old_list);
+  free_list_deferred(old_list);
   if (ThreadIdTable::is_initialized()) {
     jlong tid = SharedRuntime::get_java_tid(thread);
     ThreadIdTable::add_thread(tid, thread);
@@ -776,7 +770,7 @@ bool ThreadsSMRSupport::delete_notify() {
 // The specified ThreadsList may not get deleted during this call if it
 // is still in-use (referenced by a hazard ptr). Other ThreadsLists
 // in the chain may get deleted by this call if they are no longer in-use.
-void ThreadsSMRSupport::free_list(ThreadsList* threads) {
+void ThreadsSMRSupport::add_to_delete_list(ThreadsList* threads) {
   assert_locked_or_safepoint(Threads_lock);
 
   threads->set_next_list(_to_delete_list);
@@ -787,6 +781,30 @@ void ThreadsSMRSupport::free_list(ThreadsList* threads) {
       _to_delete_list_max = _to_delete_list_cnt;
     }
   }
+}
+
+// Adding a thread does not delete a JavaThread so nobody is waiting for
+// the previous ThreadsList to be freed. Scanning the hazard ptrs visits
+// every thread, so when many threads are started the scans are batched
+// to keep the Threads_lock hold time short.
+void ThreadsSMRSupport::free_list_deferred(ThreadsList* threads) {
+  assert_locked_or_safepoint(Threads_lock);
+
+  if (_deferred_free_list_cnt + 1 < DeferredFreeListLimit) {
+    _deferred_free_list_cnt++;
+    add_to_delete_list(threads);
+    log_debug(thread, smr)("tid=" UINTX_FORMAT ": ThreadsSMRSupport::free_list_deferred: threads=" INTPTR_FORMAT " is deferred.", os::current_thread_id(), p2i(threads));
+    return;
+  }
+  free_list(threads);
+}
+
+void ThreadsSMRSupport::free_list(ThreadsList* threads) {
+  assert_locked_or_safepoint(Threads_lock);
+
+  add_to_delete_list(threads);
+  // This scan also covers the deferred ThreadsLists
+  _deferred_free_list_cnt = 0;
 
   // Hash table size should be first power of two higher than twice the length of the ThreadsList
   int hash_table_size = MIN2((int)get_java_thread_list()->length(), 32) << 1;
@@ -850,45 +868,30 @@ void ThreadsSMRSupport::free_list(ThreadsList* threads) {
 bool ThreadsSMRSupport::is_a_protected_JavaThread(JavaThread *thread) {
   assert_locked_or_safepoint(Threads_lock);
 
-  // Hash table size should be first power of two higher than twice
-  // the length of the Threads list.
-  int hash_table_size = MIN2((int)get_java_thread_list()->length(), 32) << 1;
-  hash_table_size--;
-  hash_table_size |= hash_table_size >> 1;
-  hash_table_size |= hash_table_size >> 2;
-  hash_table_size |= hash_table_size >> 4;
-  hash_table_size |= hash_table_size >> 8;
-  hash_table_size |= hash_table_size >> 16;
-  hash_table_size++;
-
-  // Gather a hash table of the JavaThreads indirectly referenced by
-  // hazard ptrs.
-  ThreadScanHashtable *scan_table = new ThreadScanHashtable(hash_table_size);
-  ScanHazardPtrGatherProtectedThreadsClosure scan_cl(scan_table);
+  // Search each distinct ThreadsList referenced by a hazard ptr. The
+  // table only holds ThreadsLists so its size is not tied to the length
+  // of the Threads list.
+  ThreadScanHashtable *scan_table = new ThreadScanHashtable(32);
+  ScanHazardPtrCheckProtectedThreadClosure scan_cl(thread, scan_table);
   threads_do(&scan_cl);
   OrderAccess::acquire(); // Must order reads of hazard ptr before reads of
                           // nested reference counters
+  delete scan_table;
+  if (scan_cl.found()) {
+    return true;
+  }
 
   // Walk through the linked list of pending freeable ThreadsLists
-  // and include the ones that are currently in use by a nested
-  // ThreadsListHandle in the search set.
-  ThreadsList* current = _to_delete_list;
-  while (current != NULL) {
-    if (current->_nested_handle_cnt != 0) {
+  // and check the ones that are currently in use by a nested
+  // ThreadsListHandle.
+  for (ThreadsList* current = _to_delete_list; current != NULL; current = current->next_list()) {
+    if (current->_nested_handle_cnt != 0 && current->includes(thread)) {
       // 'current' is in use by a nested ThreadsListHandle so the hazard
       // ptr is protecting all the JavaThreads on that ThreadsList.
-      AddThreadHazardPointerThreadClosure add_cl(scan_table);
-      current->threads_do(&add_cl);
+      return true;
     }
-    current = current->next_list();
-  }
-
-  bool thread_is_protected = false;
-  if (scan_table->has_entry((void*)thread)) {
-    thread_is_protected = true;
   }
-  delete scan_table;
-  return thread_is_protected;
+  return false;
 }
 
 // Wake up portion of the release stable ThreadsList protocol;
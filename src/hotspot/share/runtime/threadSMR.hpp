@@ -93,6 +93,9 @@ class ThreadsSMRSupport : AllStatic {
   // reduce the traffic on the Threads_lock.
   static Monitor* delete_lock() { return ThreadsSMRDelete_lock; }
 
+  // Always maintained, see free_list_deferred():
+  static uint                  _deferred_free_list_cnt;
+
   // The '_cnt', '_max' and '_times" fields are enabled via
   // -XX:+EnableThreadSMRStatistics (see thread.cpp for a
   // description about each field):
@@ -120,10 +123,12 @@ class ThreadsSMRSupport : AllStatic {
   static ThreadsList *acquire_stable_list_fast_path(Thread *self);
   static ThreadsList *acquire_stable_list_nested_path(Thread *self);
   static void add_deleted_thread_times(uint add_value);
+  static void add_to_delete_list(ThreadsList* threads);
   static void add_tlh_times(uint add_value);
   static void clear_delete_notify();
   static bool delete_notify();
   static void free_list(ThreadsList* threads);
+  static void free_list_deferred(ThreadsList* threads);
   static void inc_deleted_thread_cnt();
   static void inc_java_thread_list_alloc_cnt();
   static void inc_tlh_cnt();
@@ -23,6 +23,7 @@
  */
 
 #include "precompiled.hpp"
+#include "compiler/compilationProfileCache.hpp"
 #include "compiler/compileBroker.hpp"
 #include "compiler/compilerOracle.hpp"
 #include "memory/resourceArea.hpp"
@@ -30,6 +31,7 @@
 #include "runtime/handles.inline.hpp"
 #include "runtime/safepointVerifiers.hpp"
 #include "runtime/tieredThresholdPolicy.hpp"
+#include "runtime/timer.hpp"
 #include "code/scopeDesc.hpp"
 #include "oops/method.inline.hpp"
 #if INCLUDE_JVMCI
@@ -80,6 +82,19 @@ bool TieredThresholdPolicy::loop_predicate_helper(int i, int b, double scale, Me
   return true;
 }
 
+// Determine if AOT code is hot enough to be recompiled by C2 right away.
+bool TieredThresholdPolicy::is_hot_aot(int i, int b, Method* method) {
+  if (Tier4AOTHotThreshold == 0) {
+    return false;
+  }
+  double k = threshold_scale(CompLevel_full_optimization, Tier4LoadFeedback);
+  double threshold_scaling;
+  if (CompilerOracle::has_option_value(method, "CompileThresholdScaling", threshold_scaling)) {
+    k *= threshold_scaling;
+  }
+  return i + b >= Tier4AOTHotThreshold * k;
+}
+
 // Simple methods are as good being compiled with C1 as C2.
 // Determine if a given method is such a case.
 bool TieredThresholdPolicy::is_trivial(Method* method) {
@@ -260,6 +275,10 @@ void TieredThresholdPolicy::initialize() {
   }
 #endif
 
+  if (CompilationProfileLoadFile != NULL) {
+    CompilationProfileCache::load(CompilationProfileLoadFile);
+  }
+
   set_increase_threshold_at_ratio();
   set_start_time(os::javaTimeMillis());
 }
@@ -287,6 +306,7 @@ void TieredThresholdPolicy::handle_counter_overflow(Method* method) {
 // Called with the queue locked and with at least one element
 CompileTask* TieredThresholdPolicy::select_task(CompileQueue* compile_queue) {
   CompileTask *max_blocking_task = NULL;
+  CompileTask *max_deferred_task = NULL;
   CompileTask *max_task = NULL;
   Method* max_method = NULL;
   jlong t = os::javaTimeMillis();
@@ -308,14 +328,22 @@ CompileTask* TieredThresholdPolicy::select_task(CompileQueue* compile_queue) {
       continue;
     }
     update_rate(t, method);
-    if (max_task == NULL || compare_methods(method, max_method)) {
+    if (is_deferred(task)) {
+      // Only picked when nothing else is queued
+      if (max_deferred_task == NULL || compare_tasks(task, max_deferred_task)) {
+        max_deferred_task = task;
+      }
+      task = next_task;
+      continue;
+    }
+    if (max_task == NULL || compare_tasks(task, max_task)) {
       // Select a method with the highest rate
       max_task = task;
       max_method = method;
     }
 
     if (task->is_blocking()) {
-      if (max_blocking_task == NULL || compare_methods(method, max_blocking_task->method())) {
+      if (max_blocking_task == NULL || compare_tasks(task, max_blocking_task)) {
         max_blocking_task = task;
       }
     }
@@ -323,6 +351,11 @@ CompileTask* TieredThresholdPolicy::select_task(CompileQueue* compile_queue) {
     task = next_task;
   }
 
+  if (max_task == NULL && max_deferred_task != NULL) {
+    max_task = max_deferred_task;
+    max_method = max_task->method();
+  }
+
   if (max_blocking_task != NULL) {
     // In blocking compilation mode, the CompileBroker will make
     // compilations submitted by a JVMCI compiler thread non-blocking. These
@@ -545,6 +578,49 @@ bool TieredThresholdPolicy::compare_methods(Method* x, Method* y) {
   return false;
 }
 
+// Estimate the benefit of a compile task per unit of compile cost. The cost
+// grows with the bytecode size; profiled tiers also emit the profiling code,
+// which roughly doubles the work of a tier 1 compile.
+double TieredThresholdPolicy::benefit_per_cost(CompileTask* task) {
+  Method* method = task->method();
+  double cost = (double)method->code_size() + 1;
+  if (task->comp_level() == CompLevel_limited_profile ||
+      task->comp_level() == CompLevel_full_profile) {
+    cost *= 2;
+  }
+  return weight(method) / cost;
+}
+
+// Return true if task x should be compiled before task y
+bool TieredThresholdPolicy::compare_tasks(CompileTask* x, CompileTask* y) {
+  Method* xm = x->method();
+  Method* ym = y->method();
+  if (!TieredCompileTaskCostAware) {
+    return compare_methods(xm, ym);
+  }
+  if (xm->highest_comp_level() != ym->highest_comp_level()) {
+    // recompilation after deopt goes first
+    return xm->highest_comp_level() > ym->highest_comp_level();
+  }
+  return benefit_per_cost(x) > benefit_per_cost(y);
+}
+
+// A task for a method larger than TieredCompileTaskDeferSize is only
+// selected when no smaller task is waiting, so that it does not hold a
+// compiler thread that could serve several small compiles. After
+// TieredCompileTaskMaxDeferral milliseconds in the queue it competes
+// normally again.
+bool TieredThresholdPolicy::is_deferred(CompileTask* task) {
+  if (TieredCompileTaskDeferSize == 0 || task->is_blocking()) {
+    return false;
+  }
+  if (task->method()->code_size() <= TieredCompileTaskDeferSize) {
+    return false;
+  }
+  jlong waited = (jlong)TimeHelper::counter_to_millis(os::elapsed_counter() - task->time_queued());
+  return waited < TieredCompileTaskMaxDeferral;
+}
+
 // Is method profiled enough?
 bool TieredThresholdPolicy::is_method_profiled(Method* method) {
   MethodData* mdo = method->method_data();
@@ -644,11 +720,21 @@ bool TieredThresholdPolicy::should_create_mdo(Method* method, CompLevel cur_leve
     int i = method->invocation_count();
     int b = method->backedge_count();
     double k = Tier0ProfilingStartPercentage / 100.0;
-    return call_predicate_helper<CompLevel_none>(i, b, k, method) || loop_predicate_helper<CompLevel_none>(i, b, k, method);
+    if (call_predicate_helper<CompLevel_none>(i, b, k, method) || loop_predicate_helper<CompLevel_none>(i, b, k, method)) {
+      return Tier0ProfilingMinRate == 0 || is_hot_by_sampling(method);
+    }
   }
   return false;
 }
 
+// Sample the event rate of a method that has reached the tier 0 profiling
+// thresholds. A method that got there slowly, e.g. over a long startup,
+// does not get an MDO until it is compiled at tier 3.
+bool TieredThresholdPolicy::is_hot_by_sampling(Method* method) {
+  update_rate(os::javaTimeMillis(), method);
+  return method->prev_time() != 0 && method->rate() >= Tier0ProfilingMinRate;
+}
+
 // Inlining control: if we're compiling a profiled method with C1 and the callee
 // is known to have OSRed in a C2 version, don't inline it.
 bool TieredThresholdPolicy::should_not_inline(ciEnv* env, ciMethod* callee) {
@@ -727,6 +813,10 @@ CompLevel TieredThresholdPolicy::common(Predicate p, Method* method, CompLevel c
       // If we were at full profile level, would we switch to full opt?
       if (common(p, method, CompLevel_full_profile, disable_feedback) == CompLevel_full_optimization) {
         next_level = CompLevel_full_optimization;
+      } else if (is_hot_aot(i, b, method)) {
+        // Tiered AOT code keeps invocation and back edge counters; a method
+        // that is already hot skips the slow fully profiled C1 tier.
+        next_level = CompLevel_full_optimization;
       } else if (disable_feedback || (CompileBroker::queue_size(CompLevel_full_optimization) <=
                                Tier3DelayOff * compiler_count(CompLevel_full_optimization) &&
                                (this->*p)(i, b, cur_level, method))) {
@@ -738,7 +828,7 @@ CompLevel TieredThresholdPolicy::common(Predicate p, Method* method, CompLevel c
       // If we were at full profile level, would we switch to full opt?
       if (common(p, method, CompLevel_full_profile, disable_feedback) == CompLevel_full_optimization) {
         next_level = CompLevel_full_optimization;
-      } else if ((this->*p)(i, b, cur_level, method)) {
+      } else if ((this->*p)(i, b, cur_level, method) || CompilationProfileCache::contains(method)) {
 #if INCLUDE_JVMCI
         if (EnableJVMCI && UseJVMCICompiler) {
           // Since JVMCI takes a while to warm up, its queue inevitably backs up during
@@ -802,6 +892,11 @@ CompLevel TieredThresholdPolicy::common(Predicate p, Method* method, CompLevel c
           if (mdo->would_profile()) {
             int mdo_i = mdo->invocation_count_delta();
             int mdo_b = mdo->backedge_count_delta();
+            if (CompilationProfileCache::contains(method)) {
+              // The method reached tier 4 in an earlier run, a shorter profile will do.
+              mdo_i = (int)MIN2(mdo_i / CompilationProfileThresholdScaling, (double)(max_jint / 4));
+              mdo_b = (int)MIN2(mdo_b / CompilationProfileThresholdScaling, (double)(max_jint / 4));
+            }
             if ((this->*p)(mdo_i, mdo_b, cur_level, method)) {
               next_level = CompLevel_full_optimization;
             }
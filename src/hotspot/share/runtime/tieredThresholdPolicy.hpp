@@ -197,6 +197,11 @@ class TieredThresholdPolicy : public CompilationPolicy {
   inline double weight(Method* method);
   // Apply heuristics and return true if x should be compiled before y
   inline bool compare_methods(Method* x, Method* y);
+  // Compile cost aware ordering of queued tasks, see TieredCompileTaskCostAware
+  inline double benefit_per_cost(CompileTask* task);
+  inline bool compare_tasks(CompileTask* x, CompileTask* y);
+  // Should a large task yield to the other queued tasks?
+  inline bool is_deferred(CompileTask* task);
   // Compute event rate for a given method. The rate is the number of event (invocations + backedges)
   // per millisecond.
   inline void update_rate(jlong t, Method* m);
@@ -206,6 +211,8 @@ class TieredThresholdPolicy : public CompilationPolicy {
   // start profiling without waiting for the compiled method to arrive. This function
   // determines whether we should do that.
   inline bool should_create_mdo(Method* method, CompLevel cur_level);
+  // Is the method's sampled event rate high enough to start profiling it in the interpreter?
+  bool is_hot_by_sampling(Method* method);
   // Create MDO if necessary.
   void create_mdo(const methodHandle& mh, JavaThread* thread);
   // Is method profiled enough?
@@ -232,6 +239,8 @@ protected:
   // Simple methods are as good being compiled with C1 as C2.
   // This function tells if it's such a function.
   inline bool is_trivial(Method* method);
+  // Tiered AOT code that crossed Tier4AOTHotThreshold goes to C2 directly.
+  bool is_hot_aot(int i, int b, Method* method);
 
   // Predicate helpers are used by .*_predicate() methods as well as others.
   // They check the given counter values, multiplied by the scale against the thresholds.
@@ -235,7 +235,7 @@ void javaVFrame::print_lock_info_on(outputStream* st, int frame_count) {
               ( // we have marked ourself as pending on this monitor
                 mark->monitor() == thread()->current_pending_monitor() ||
                 // we are not the owner of this monitor
-                !mark->monitor()->is_entered(thread())
+                !ObjectSynchronizer::is_monitor_owner(mark->monitor(), thread())
               )) {
             lock_state = "waiting to lock";
           } else {
@@ -254,7 +254,7 @@ void javaVFrame::print_lock_info_on(outputStream* st, int frame_count) {
               ( // we have marked ourself as pending on this monitor
                 mark->monitor() == thread()->current_pending_monitor() ||
                 // we are not the owner of this monitor
-                !mark->monitor()->is_entered(thread())
+                !ObjectSynchronizer::is_monitor_owner(mark->monitor(), thread())
               )) {
             lock_state = "waiting to re-lock in wait()";
           } else {
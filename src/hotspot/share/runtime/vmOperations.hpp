@@ -77,8 +77,10 @@
   template(G1CollectFull)                         \
   template(ZOperation)                            \
   template(ZVerify)                               \
+  template(EpsilonArena)                          \
   template(HandshakeOneThread)                    \
   template(HandshakeAllThreads)                   \
+  template(HandshakeCompleteDeferred)             \
   template(HandshakeFallback)                     \
   template(EnableBiasedLocking)                   \
   template(RevokeBias)                            \
@@ -91,7 +93,6 @@
   template(GetOwnedMonitorInfo)                   \
   template(GetObjectMonitorUsage)                 \
   template(GetCurrentContendedMonitor)            \
-  template(GetStackTrace)                         \
   template(GetMultipleStackTraces)                \
   template(GetAllStackTraces)                     \
   template(GetThreadListStackTraces)              \
@@ -24,11 +24,14 @@
 
 #include "precompiled.hpp"
 #include "jvm.h"
+#include "aot/aotLoader.hpp"
 #include "classfile/classLoaderHierarchyDCmd.hpp"
 #include "classfile/classLoaderStats.hpp"
 #include "classfile/compactHashtable.hpp"
+#include "compiler/compilationProfileCache.hpp"
 #include "compiler/compileBroker.hpp"
 #include "compiler/directivesParser.hpp"
+#include "gc/shared/gcPhaseTimingsDCmd.hpp"
 #include "gc/shared/vmGCOperations.hpp"
 #include "memory/metaspace/metaspaceDCmd.hpp"
 #include "memory/resourceArea.hpp"
@@ -38,9 +41,12 @@
 #include "runtime/fieldDescriptor.inline.hpp"
 #include "runtime/flags/jvmFlag.hpp"
 #include "runtime/handles.inline.hpp"
+#include "runtime/handshake.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/javaCalls.hpp"
 #include "runtime/os.hpp"
+#include "runtime/safepoint.hpp"
+#include "runtime/threadSMR.hpp"
 #include "services/diagnosticArgument.hpp"
 #include "services/diagnosticCommand.hpp"
 #include "services/diagnosticFramework.hpp"
@@ -50,6 +56,12 @@
 #include "utilities/debug.hpp"
 #include "utilities/formatBuffer.hpp"
 #include "utilities/macros.hpp"
+#if INCLUDE_EPSILONGC
+#include "gc/epsilon/epsilonArenaDCmd.hpp"
+#endif
+#if INCLUDE_G1GC
+#include "gc/g1/g1RegionStatsDCmd.hpp"
+#endif
 
 
 static void loadAgentModule(TRAPS) {
@@ -80,12 +92,21 @@ void DCmdRegistrant::register_dcmds(){
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<PrintVMFlagsDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<SetVMFlagDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<VMDynamicLibrariesDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<SafepointLastThreadsDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<VMUptimeDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<VMInfoDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<SystemGCDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<RunFinalizationDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<HeapInfoDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<TLABStatsDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<FinalizerInfoDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<GCPhaseTimingsDCmd>(full_export, true, false));
+#if INCLUDE_EPSILONGC
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<EpsilonArenaDCmd>(full_export, true, false));
+#endif
+#if INCLUDE_G1GC
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<G1RegionStatsDCmd>(full_export, true, false));
+#endif
 #if INCLUDE_SERVICES
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<HeapDumpDCmd>(DCmd_Source_Internal | DCmd_Source_AttachAPI, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<ClassHistogramDCmd>(full_export, true, false));
@@ -110,6 +131,8 @@ void DCmdRegistrant::register_dcmds(){
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<CodeCacheDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<TouchedMethodsDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<CodeHeapAnalyticsDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<CompilationProfileDumpDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<AOTMethodsDCmd>(full_export, true, false));
 
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<CompilerDirectivesPrintDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<CompilerDirectivesAddDCmd>(full_export, true, false));
@@ -454,6 +477,23 @@ void HeapInfoDCmd::execute(DCmdSource source, TRAPS) {
   Universe::heap()->print_on(output());
 }
 
+void TLABStatsDCmd::execute(DCmdSource source, TRAPS) {
+  if (!UseTLAB) {
+    output()->print_cr("TLAB statistics are only available with -XX:+UseTLAB.");
+    return;
+  }
+
+  // The statistics are read without a safepoint; they are approximate
+  // for threads that are allocating concurrently.
+  ResourceMark rm(THREAD);
+  MutexLockerEx ml(Threads_lock);
+  for (JavaThreadIteratorWithHandle jtiwh; JavaThread* jt = jtiwh.next(); ) {
+    ThreadLocalAllocBuffer& tlab = jt->tlab();
+    output()->print_cr("\"%s\" #" INTPTR_FORMAT, jt->get_thread_name(), p2i(jt));
+    tlab.print_history_on(output());
+  }
+}
+
 void FinalizerInfoDCmd::execute(DCmdSource source, TRAPS) {
   ResourceMark rm;
 
@@ -551,13 +591,26 @@ int HeapDumpDCmd::num_arguments() {
 ClassHistogramDCmd::ClassHistogramDCmd(outputStream* output, bool heap) :
                                        DCmdWithParser(output, heap),
   _all("-all", "Inspect all objects, including unreachable objects",
-       "BOOLEAN", false, "false") {
+       "BOOLEAN", false, "false"),
+  _sample("-sample", "Inspect about one in the given number of heap regions "
+          "and extrapolate the counts, for a cheaper approximate histogram. "
+          "Use with -all to also skip the full GC. Only supported by G1",
+          "INT", false, "0") {
   _dcmdparser.add_dcmd_option(&_all);
+  _dcmdparser.add_dcmd_option(&_sample);
 }
 
 void ClassHistogramDCmd::execute(DCmdSource source, TRAPS) {
+  jlong sample = _sample.value();
+  if (sample < 0 || sample > max_juint) {
+    Exceptions::fthrow(THREAD_AND_LOCATION, vmSymbols::java_lang_IllegalArgumentException(),
+                       "Invalid sample value " JLONG_FORMAT ". Must be between 0 and %u.\n",
+                       sample, max_juint);
+    return;
+  }
   VM_GC_HeapInspection heapop(output(),
                               !_all.value() /* request full gc if false */);
+  heapop.set_sample_rate((uint)sample);
   VMThread::execute(&heapop);
 }
 
@@ -628,12 +681,62 @@ int ClassStatsDCmd::num_arguments() {
 ThreadDumpDCmd::ThreadDumpDCmd(outputStream* output, bool heap) :
                                DCmdWithParser(output, heap),
   _locks("-l", "print java.util.concurrent locks", "BOOLEAN", false, "false"),
-  _extended("-e", "print extended thread information", "BOOLEAN", false, "false") {
+  _extended("-e", "print extended thread information", "BOOLEAN", false, "false"),
+  _handshake("-handshake", "print the Java threads one at a time using handshakes "
+             "instead of a safepoint. The stacks are not taken at the same point in time. "
+             "JNI global references and deadlocks are not reported",
+             "BOOLEAN", false, "false") {
   _dcmdparser.add_dcmd_option(&_locks);
   _dcmdparser.add_dcmd_option(&_extended);
+  _dcmdparser.add_dcmd_option(&_handshake);
+}
+
+// Prints a Java thread and its stack while it is stopped by a handshake.
+class PrintThreadHandshakeClosure : public HandshakeClosure {
+ private:
+  outputStream* _st;
+  bool _extended;
+ public:
+  PrintThreadHandshakeClosure(outputStream* st, bool extended) :
+    HandshakeClosure("PrintThread"), _st(st), _extended(extended) {}
+
+  void do_thread(Thread* thread) {
+    JavaThread* jt = (JavaThread*)thread;
+    ResourceMark rm;
+    jt->print_on(_st, _extended);
+    jt->print_stack_on(_st);
+    _st->cr();
+  }
+};
+
+void ThreadDumpDCmd::print_threads_with_handshakes() {
+  outputStream* st = output();
+  char buf[32];
+  st->print_raw_cr(os::local_time_string(buf, sizeof(buf)));
+  st->print_cr("Thread dump %s (%s %s), taken with per-thread handshakes:",
+               Abstract_VM_Version::vm_name(),
+               Abstract_VM_Version::vm_release(),
+               Abstract_VM_Version::vm_info_string());
+  st->cr();
+
+  // The caller waits for each handshake, so st is never written concurrently.
+  PrintThreadHandshakeClosure cl(st, _extended.value());
+  ThreadsListHandle tlh;
+  for (uint i = 0; i < tlh.length(); i++) {
+    // Threads that have exited in the meantime are skipped.
+    Handshake::execute(&cl, tlh.thread_at(i));
+  }
 }
 
 void ThreadDumpDCmd::execute(DCmdSource source, TRAPS) {
+  if (_handshake.value()) {
+    if (_locks.value()) {
+      output()->print_cr("Option -l is not supported with -handshake and is ignored");
+    }
+    print_threads_with_handshakes();
+    return;
+  }
+
   // thread stacks
   VM_PrintThreads op1(output(), _locks.value(), _extended.value());
   VMThread::execute(&op1);
@@ -935,6 +1038,10 @@ void VMDynamicLibrariesDCmd::execute(DCmdSource source, TRAPS) {
   output()->cr();
 }
 
+void SafepointLastThreadsDCmd::execute(DCmdSource source, TRAPS) {
+  SafepointSynchronize::print_slowest_syncs_on(output());
+}
+
 void CompileQueueDCmd::execute(DCmdSource source, TRAPS) {
   VM_PrintCompileQueue printCompileQueueOp(output());
   VMThread::execute(&printCompileQueueOp);
@@ -980,6 +1087,50 @@ int CodeHeapAnalyticsDCmd::num_arguments() {
 }
 //---<  END  >--- CodeHeap State Analytics.
 
+CompilationProfileDumpDCmd::CompilationProfileDumpDCmd(outputStream* output, bool heap) :
+                                                       DCmdWithParser(output, heap),
+  _filename("filename", "Name of the profile file", "STRING", true) {
+  _dcmdparser.add_dcmd_argument(&_filename);
+}
+
+void CompilationProfileDumpDCmd::execute(DCmdSource source, TRAPS) {
+  if (CompilationProfileCache::dump_to_file(_filename.value(), output())) {
+    output()->print_cr("Compilation profile written to %s", _filename.value());
+  }
+}
+
+int CompilationProfileDumpDCmd::num_arguments() {
+  ResourceMark rm;
+  CompilationProfileDumpDCmd* dcmd = new CompilationProfileDumpDCmd(NULL, false);
+  if (dcmd != NULL) {
+    DCmdMark mark(dcmd);
+    return dcmd->_dcmdparser.num_arguments();
+  } else {
+    return 0;
+  }
+}
+
+AOTMethodsDCmd::AOTMethodsDCmd(outputStream* output, bool heap) :
+                               DCmdWithParser(output, heap),
+  _verbose("-verbose", "Print one line per AOT method", "BOOLEAN", false, "false") {
+  _dcmdparser.add_dcmd_option(&_verbose);
+}
+
+void AOTMethodsDCmd::execute(DCmdSource source, TRAPS) {
+  AOTLoader::print_usage(output(), _verbose.value());
+}
+
+int AOTMethodsDCmd::num_arguments() {
+  ResourceMark rm;
+  AOTMethodsDCmd* dcmd = new AOTMethodsDCmd(NULL, false);
+  if (dcmd != NULL) {
+    DCmdMark mark(dcmd);
+    return dcmd->_dcmdparser.num_arguments();
+  } else {
+    return 0;
+  }
+}
+
 void CompilerDirectivesPrintDCmd::execute(DCmdSource source, TRAPS) {
   DirectivesStack::print(output());
 }
@@ -224,6 +224,30 @@ public:
   virtual void execute(DCmdSource source, TRAPS);
 };
 
+class SafepointLastThreadsDCmd : public DCmd {
+public:
+  SafepointLastThreadsDCmd(outputStream* output, bool heap) : DCmd(output, heap) { }
+  static const char* name() {
+    return "VM.safepoint_last_threads";
+  }
+  static const char* description() {
+    return "Print the slowest safepoint synchronizations and the last thread "
+           "to reach each of them (requires -XX:+RecordSafepointLastThread).";
+  }
+  static const char* impact() {
+    return "Low";
+  }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+                        "monitor", NULL};
+    return p;
+  }
+  static int num_arguments() {
+    return 0;
+  };
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
 class VMUptimeDCmd : public DCmdWithParser {
 protected:
   DCmdArgument<bool> _date;
@@ -305,6 +329,26 @@ public:
   virtual void execute(DCmdSource source, TRAPS);
 };
 
+class TLABStatsDCmd : public DCmd {
+public:
+  TLABStatsDCmd(outputStream* output, bool heap) : DCmd(output, heap) { }
+  static const char* name() { return "GC.tlab_stats"; }
+  static const char* description() {
+    return "Provide per thread TLAB sizing, refill and waste statistics.";
+  }
+  static const char* impact() {
+    return "Low: Depends on the number of threads";
+  }
+  static int num_arguments() { return 0; }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+      "monitor", NULL};
+      return p;
+  }
+
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
 class FinalizerInfoDCmd : public DCmd {
 public:
   FinalizerInfoDCmd(outputStream* output, bool heap) : DCmd(output, heap) { }
@@ -359,6 +403,7 @@ public:
 class ClassHistogramDCmd : public DCmdWithParser {
 protected:
   DCmdArgument<bool> _all;
+  DCmdArgument<jlong> _sample;
 public:
   ClassHistogramDCmd(outputStream* output, bool heap);
   static const char* name() {
@@ -449,6 +494,8 @@ class ThreadDumpDCmd : public DCmdWithParser {
 protected:
   DCmdArgument<bool> _locks;
   DCmdArgument<bool> _extended;
+  DCmdArgument<bool> _handshake;
+  void print_threads_with_handshakes();
 public:
   ThreadDumpDCmd(outputStream* output, bool heap);
   static const char* name() { return "Thread.print"; }
@@ -671,6 +718,54 @@ public:
 };
 //---<  END  >--- CodeHeap State Analytics.
 
+class CompilationProfileDumpDCmd : public DCmdWithParser {
+protected:
+  DCmdArgument<char*> _filename;
+public:
+  CompilationProfileDumpDCmd(outputStream* output, bool heap);
+  static const char* name() {
+    return "Compiler.dump_profile";
+  }
+  static const char* description() {
+    return "Write the methods compiled at tier 4 to a file that can be "
+           "passed to -XX:CompilationProfileLoadFile.";
+  }
+  static const char* impact() {
+    return "Low: Holds CodeCache_lock while the code cache is walked.";
+  }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+                        "monitor", NULL};
+    return p;
+  }
+  static int num_arguments();
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
+class AOTMethodsDCmd : public DCmdWithParser {
+protected:
+  DCmdArgument<bool> _verbose;
+public:
+  AOTMethodsDCmd(outputStream* output, bool heap);
+  static const char* name() {
+    return "Compiler.aot_methods";
+  }
+  static const char* description() {
+    return "Print usage and invalidation statistics of AOT compiled methods, "
+           "per library and optionally per method.";
+  }
+  static const char* impact() {
+    return "Low: Holds CodeCache_lock while the AOT methods are walked.";
+  }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+                        "monitor", NULL};
+    return p;
+  }
+  static int num_arguments();
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
 class CompilerDirectivesPrintDCmd : public DCmd {
 public:
   CompilerDirectivesPrintDCmd(outputStream* output, bool heap) : DCmd(output, heap) {}
@@ -43,8 +43,10 @@
 #include "runtime/handles.inline.hpp"
 #include "runtime/javaCalls.hpp"
 #include "runtime/jniHandles.hpp"
+#include "runtime/mutexLocker.hpp"
 #include "runtime/os.inline.hpp"
 #include "runtime/reflectionUtils.hpp"
+#include "runtime/threadCritical.hpp"
 #include "runtime/thread.inline.hpp"
 #include "runtime/threadSMR.hpp"
 #include "runtime/vframe.hpp"
@@ -377,10 +379,10 @@ enum {
   INITIAL_CLASS_COUNT = 200
 };
 
-// Supports I/O operations for a dump
-
-class DumpWriter : public StackObj {
- private:
+// Base class for the dump writers. Buffers the records and keeps
+// track of the heap dump segments they are written in.
+class AbstractDumpWriter : public StackObj {
+ protected:
   enum {
     io_buffer_max_size = 1*M,
     io_buffer_max_waste = 10*K,
@@ -396,9 +398,8 @@ class DumpWriter : public StackObj {
   DEBUG_ONLY(size_t _sub_record_left;) // The bytes not written for the current sub-record.
   DEBUG_ONLY(bool _sub_record_ended;) // True if we have called the end_sub_record().
 
-  CompressionBackend _backend; // Does the actual writing.
-
-  void flush();
+  // Writes out the buffered bytes and sets up a new buffer.
+  virtual void flush() = 0;
 
   char* buffer() const                          { return _buffer; }
   size_t buffer_size() const                    { return _size; }
@@ -412,15 +413,11 @@ class DumpWriter : public StackObj {
   bool can_write_fast(size_t len);
 
  public:
-  // Takes ownership of the writer and compressor.
-  DumpWriter(AbstractWriter* writer, AbstractCompressor* compressor);
-
-  ~DumpWriter();
-
-  // total number of bytes written to the disk
-  julong bytes_written() const          { return (julong) _backend.get_written(); }
-
-  char const* error() const             { return _backend.error(); }
+  AbstractDumpWriter() :
+    _buffer(NULL),
+    _size(0),
+    _pos(0),
+    _in_dump_segment(false) { }
 
   // writer functions
   void write_raw(void* s, size_t len);
@@ -439,28 +436,9 @@ class DumpWriter : public StackObj {
   void end_sub_record();
   // Finishes the current dump segment if not already finished.
   void finish_dump_segment();
-
-  // Called by threads used for parallel writing.
-  void writer_loop()                    { _backend.thread_loop(false); }
-  // Called when finished to release the threads.
-  void deactivate()                     { flush(); _backend.deactivate(); }
 };
 
-// Check for error after constructing the object and destroy it in case of an error.
-DumpWriter::DumpWriter(AbstractWriter* writer, AbstractCompressor* compressor) :
-  _buffer(NULL),
-  _size(0),
-  _pos(0),
-  _in_dump_segment(false),
-  _backend(writer, compressor, io_buffer_max_size, io_buffer_max_waste) {
-  flush();
-}
-
-DumpWriter::~DumpWriter() {
-  flush();
-}
-
-void DumpWriter::write_fast(void* s, size_t len) {
+void AbstractDumpWriter::write_fast(void* s, size_t len) {
   assert(!_in_dump_segment || (_sub_record_left >= len), "sub-record too large");
   assert(buffer_size() - position() >= len, "Must fit");
   debug_only(_sub_record_left -= len);
@@ -468,12 +446,12 @@ void DumpWriter::write_fast(void* s, size_t len) {
   set_position(position() + len);
 }
 
-bool DumpWriter::can_write_fast(size_t len) {
+bool AbstractDumpWriter::can_write_fast(size_t len) {
   return buffer_size() - position() >= len;
 }
 
 // write raw bytes
-void DumpWriter::write_raw(void* s, size_t len) {
+void AbstractDumpWriter::write_raw(void* s, size_t len) {
   assert(!_in_dump_segment || (_sub_record_left >= len), "sub-record too large");
   debug_only(_sub_record_left -= len);
 
@@ -494,38 +472,33 @@ void DumpWriter::write_raw(void* s, size_t len) {
   set_position(position() + len);
 }
 
-// flush any buffered bytes to the file
-void DumpWriter::flush() {
-  _backend.get_new_buffer(&_buffer, &_pos, &_size);
-}
-
 // Makes sure we inline the fast write into the write_u* functions. This is a big speedup.
 #define WRITE_KNOWN_TYPE(p, len) do { if (can_write_fast((len))) write_fast((p), (len)); \
                                       else write_raw((p), (len)); } while (0)
 
-void DumpWriter::write_u1(u1 x) {
+void AbstractDumpWriter::write_u1(u1 x) {
   WRITE_KNOWN_TYPE((void*) &x, 1);
 }
 
-void DumpWriter::write_u2(u2 x) {
+void AbstractDumpWriter::write_u2(u2 x) {
   u2 v;
   Bytes::put_Java_u2((address)&v, x);
   WRITE_KNOWN_TYPE((void*)&v, 2);
 }
 
-void DumpWriter::write_u4(u4 x) {
+void AbstractDumpWriter::write_u4(u4 x) {
   u4 v;
   Bytes::put_Java_u4((address)&v, x);
   WRITE_KNOWN_TYPE((void*)&v, 4);
 }
 
-void DumpWriter::write_u8(u8 x) {
+void AbstractDumpWriter::write_u8(u8 x) {
   u8 v;
   Bytes::put_Java_u8((address)&v, x);
   WRITE_KNOWN_TYPE((void*)&v, 8);
 }
 
-void DumpWriter::write_objectID(oop o) {
+void AbstractDumpWriter::write_objectID(oop o) {
   address a = (address)o;
 #ifdef _LP64
   write_u8((u8)a);
@@ -534,7 +507,7 @@ void DumpWriter::write_objectID(oop o) {
 #endif
 }
 
-void DumpWriter::write_symbolID(Symbol* s) {
+void AbstractDumpWriter::write_symbolID(Symbol* s) {
   address a = (address)((uintptr_t)s);
 #ifdef _LP64
   write_u8((u8)a);
@@ -543,7 +516,7 @@ void DumpWriter::write_symbolID(Symbol* s) {
 #endif
 }
 
-void DumpWriter::write_id(u4 x) {
+void AbstractDumpWriter::write_id(u4 x) {
 #ifdef _LP64
   write_u8((u8) x);
 #else
@@ -552,11 +525,11 @@ void DumpWriter::write_id(u4 x) {
 }
 
 // We use java mirror as the class ID
-void DumpWriter::write_classID(Klass* k) {
+void AbstractDumpWriter::write_classID(Klass* k) {
   write_objectID(k->java_mirror());
 }
 
-void DumpWriter::finish_dump_segment() {
+void AbstractDumpWriter::finish_dump_segment() {
   if (_in_dump_segment) {
     assert(_sub_record_left == 0, "Last sub-record not written completely");
     assert(_sub_record_ended, "sub-record must have ended");
@@ -569,12 +542,13 @@ void DumpWriter::finish_dump_segment() {
                          (u4) (position() - dump_segment_header_size));
     }
 
-    flush();
+    // Leave the segment before flushing, so that flush() sees a complete segment.
     _in_dump_segment = false;
+    flush();
   }
 }
 
-void DumpWriter::start_sub_record(u1 tag, u4 len) {
+void AbstractDumpWriter::start_sub_record(u1 tag, u4 len) {
   if (!_in_dump_segment) {
     if (position() > 0) {
       flush();
@@ -604,20 +578,114 @@ void DumpWriter::start_sub_record(u1 tag, u4 len) {
   write_u1(tag);
 }
 
-void DumpWriter::end_sub_record() {
+void AbstractDumpWriter::end_sub_record() {
   assert(_in_dump_segment, "must be in dump segment");
   assert(_sub_record_left == 0, "sub-record not written completely");
   assert(!_sub_record_ended, "Must not have ended yet");
   debug_only(_sub_record_ended = true);
 }
 
+// Supports I/O operations for a dump
+
+class DumpWriter : public AbstractDumpWriter {
+ private:
+  CompressionBackend _backend; // Does the actual writing.
+
+ protected:
+  virtual void flush();
+
+ public:
+  // Takes ownership of the writer and compressor.
+  DumpWriter(AbstractWriter* writer, AbstractCompressor* compressor);
+
+  ~DumpWriter();
+
+  // total number of bytes written to the disk
+  julong bytes_written() const          { return (julong) _backend.get_written(); }
+
+  char const* error() const             { return _backend.error(); }
+
+  // Called by threads used for parallel writing.
+  void writer_loop()                    { _backend.thread_loop(false); }
+  // Called when finished to release the threads.
+  void deactivate()                     { flush(); _backend.deactivate(); }
+};
+
+// Check for error after constructing the object and destroy it in case of an error.
+DumpWriter::DumpWriter(AbstractWriter* writer, AbstractCompressor* compressor) :
+  AbstractDumpWriter(),
+  _backend(writer, compressor, io_buffer_max_size, io_buffer_max_waste) {
+  flush();
+}
+
+DumpWriter::~DumpWriter() {
+  flush();
+}
+
+// flush any buffered bytes to the file
+void DumpWriter::flush() {
+  _backend.get_new_buffer(&_buffer, &_pos, &_size);
+}
+
+// Used by the heap dump workers that iterate the heap in parallel. Each
+// worker fills its own buffer with complete dump segments and appends them
+// to the shared DumpWriter under a lock, so segments of different workers
+// never interleave. A huge sub-record spans several buffers; the lock is
+// then held until its segment has been written completely.
+class ParDumpWriter : public AbstractDumpWriter {
+ private:
+  DumpWriter* _writer;  // the shared writer
+  Monitor*    _lock;    // serializes appends to _writer
+  bool        _holds_lock;
+
+ protected:
+  virtual void flush();
+
+ public:
+  // The buffer of buffer_size_bytes() bytes is owned by the caller.
+  ParDumpWriter(DumpWriter* writer, Monitor* lock, char* buffer);
+  ~ParDumpWriter();
+
+  static size_t buffer_size_bytes()     { return io_buffer_max_size; }
+};
+
+ParDumpWriter::ParDumpWriter(DumpWriter* writer, Monitor* lock, char* buffer) :
+  AbstractDumpWriter(),
+  _writer(writer),
+  _lock(lock),
+  _holds_lock(false) {
+  _buffer = buffer;
+  _size = io_buffer_max_size;
+}
+
+ParDumpWriter::~ParDumpWriter() {
+  finish_dump_segment();
+  flush();
+  assert(!_holds_lock, "must have released the lock");
+}
+
+void ParDumpWriter::flush() {
+  if (position() > 0) {
+    if (!_holds_lock) {
+      _lock->lock_without_safepoint_check();
+      _holds_lock = true;
+    }
+    _writer->write_raw(buffer(), position());
+    set_position(0);
+  }
+  if (_holds_lock && !(_in_dump_segment && _is_huge_sub_record)) {
+    _lock->unlock();
+    _holds_lock = false;
+  }
+}
+
 // Support class with a collection of functions used when dumping the heap
 
 class DumperSupport : AllStatic {
  public:
 
   // write a header of the given type
-  static void write_header(DumpWriter* writer, hprofTag tag, u4 len);
+  static void write_header(AbstractDumpWriter* writer, hprofTag tag, u4 len);
 
   // returns hprof tag for the given type signature
   static hprofTag sig2tag(Symbol* sig);
@@ -630,42 +698,42 @@ class DumperSupport : AllStatic {
   static u4 instance_size(Klass* k);
 
   // dump a jfloat
-  static void dump_float(DumpWriter* writer, jfloat f);
+  static void dump_float(AbstractDumpWriter* writer, jfloat f);
   // dump a jdouble
-  static void dump_double(DumpWriter* writer, jdouble d);
+  static void dump_double(AbstractDumpWriter* writer, jdouble d);
   // dumps the raw value of the given field
-  static void dump_field_value(DumpWriter* writer, char type, oop obj, int offset);
+  static void dump_field_value(AbstractDumpWriter* writer, char type, oop obj, int offset);
   // returns the size of the static fields; also counts the static fields
   static u4 get_static_fields_size(InstanceKlass* ik, u2& field_count);
   // dumps static fields of the given class
-  static void dump_static_fields(DumpWriter* writer, Klass* k);
+  static void dump_static_fields(AbstractDumpWriter* writer, Klass* k);
   // dump the raw values of the instance fields of the given object
-  static void dump_instance_fields(DumpWriter* writer, oop o);
+  static void dump_instance_fields(AbstractDumpWriter* writer, oop o);
   // get the count of the instance fields for a given class
   static u2 get_instance_fields_count(InstanceKlass* ik);
   // dumps the definition of the instance fields for a given class
-  static void dump_instance_field_descriptors(DumpWriter* writer, Klass* k);
+  static void dump_instance_field_descriptors(AbstractDumpWriter* writer, Klass* k);
   // creates HPROF_GC_INSTANCE_DUMP record for the given object
-  static void dump_instance(DumpWriter* writer, oop o);
+  static void dump_instance(AbstractDumpWriter* writer, oop o);
   // creates HPROF_GC_CLASS_DUMP record for the given class and each of its
   // array classes
-  static void dump_class_and_array_classes(DumpWriter* writer, Klass* k);
+  static void dump_class_and_array_classes(AbstractDumpWriter* writer, Klass* k);
   // creates HPROF_GC_CLASS_DUMP record for a given primitive array
   // class (and each multi-dimensional array class too)
-  static void dump_basic_type_array_class(DumpWriter* writer, Klass* k);
+  static void dump_basic_type_array_class(AbstractDumpWriter* writer, Klass* k);
 
   // creates HPROF_GC_OBJ_ARRAY_DUMP record for the given object array
-  static void dump_object_array(DumpWriter* writer, objArrayOop array);
+  static void dump_object_array(AbstractDumpWriter* writer, objArrayOop array);
   // creates HPROF_GC_PRIM_ARRAY_DUMP record for the given type array
-  static void dump_prim_array(DumpWriter* writer, typeArrayOop array);
+  static void dump_prim_array(AbstractDumpWriter* writer, typeArrayOop array);
   // create HPROF_FRAME record for the given method and bci
-  static void dump_stack_frame(DumpWriter* writer, int frame_serial_num, int class_serial_num, Method* m, int bci);
+  static void dump_stack_frame(AbstractDumpWriter* writer, int frame_serial_num, int class_serial_num, Method* m, int bci);
 
   // check if we need to truncate an array
-  static int calculate_array_max_length(DumpWriter* writer, arrayOop array, short header_size);
+  static int calculate_array_max_length(AbstractDumpWriter* writer, arrayOop array, short header_size);
 
   // fixes up the current dump record and writes HPROF_HEAP_DUMP_END record
-  static void end_of_dump(DumpWriter* writer);
+  static void end_of_dump(AbstractDumpWriter* writer);
 
   static oop mask_dormant_archived_object(oop o) {
     if (o != NULL && o->klass()->java_mirror() == NULL) {
@@ -679,7 +747,7 @@ class DumperSupport : AllStatic {
 };
 
 // write a header of the given type
-void DumperSupport:: write_header(DumpWriter* writer, hprofTag tag, u4 len) {
+void DumperSupport:: write_header(AbstractDumpWriter* writer, hprofTag tag, u4 len) {
   writer->write_u1((u1)tag);
   writer->write_u4(0);                  // current ticks
   writer->write_u4(len);
@@ -733,7 +801,7 @@ u4 DumperSupport::sig2size(Symbol* sig) {
 }
 
 // dump a jfloat
-void DumperSupport::dump_float(DumpWriter* writer, jfloat f) {
+void DumperSupport::dump_float(AbstractDumpWriter* writer, jfloat f) {
   if (g_isnan(f)) {
     writer->write_u4(0x7fc00000);    // collapsing NaNs
   } else {
@@ -747,7 +815,7 @@ void DumperSupport::dump_float(DumpWriter* writer, jfloat f) {
 }
 
 // dump a jdouble
-void DumperSupport::dump_double(DumpWriter* writer, jdouble d) {
+void DumperSupport::dump_double(AbstractDumpWriter* writer, jdouble d) {
   union {
     jlong l;
     double d;
@@ -762,7 +830,7 @@ void DumperSupport::dump_double(DumpWriter* writer, jdouble d) {
 }
 
 // dumps the raw value of the given field
-void DumperSupport::dump_field_value(DumpWriter* writer, char type, oop obj, int offset) {
+void DumperSupport::dump_field_value(AbstractDumpWriter* writer, char type, oop obj, int offset) {
   switch (type) {
     case JVM_SIGNATURE_CLASS :
     case JVM_SIGNATURE_ARRAY : {
@@ -883,7 +951,7 @@ u4 DumperSupport::get_static_fields_size(InstanceKlass* ik, u2& field_count) {
 }
 
 // dumps static fields of the given class
-void DumperSupport::dump_static_fields(DumpWriter* writer, Klass* k) {
+void DumperSupport::dump_static_fields(AbstractDumpWriter* writer, Klass* k) {
   HandleMark hm;
   InstanceKlass* ik = InstanceKlass::cast(k);
 
@@ -927,7 +995,7 @@ void DumperSupport::dump_static_fields(DumpWriter* writer, Klass* k) {
 }
 
 // dump the raw values of the instance fields of the given object
-void DumperSupport::dump_instance_fields(DumpWriter* writer, oop o) {
+void DumperSupport::dump_instance_fields(AbstractDumpWriter* writer, oop o) {
   HandleMark hm;
   InstanceKlass* ik = InstanceKlass::cast(o->klass());
 
@@ -952,7 +1020,7 @@ u2 DumperSupport::get_instance_fields_count(InstanceKlass* ik) {
 }
 
 // dumps the definition of the instance fields for a given class
-void DumperSupport::dump_instance_field_descriptors(DumpWriter* writer, Klass* k) {
+void DumperSupport::dump_instance_field_descriptors(AbstractDumpWriter* writer, Klass* k) {
   HandleMark hm;
   InstanceKlass* ik = InstanceKlass::cast(k);
 
@@ -968,7 +1036,7 @@ void DumperSupport::dump_instance_field_descriptors(DumpWriter* writer, Klass* k
 }
 
 // creates HPROF_GC_INSTANCE_DUMP record for the given object
-void DumperSupport::dump_instance(DumpWriter* writer, oop o) {
+void DumperSupport::dump_instance(AbstractDumpWriter* writer, oop o) {
   Klass* k = o->klass();
 
   InstanceKlass* ik = InstanceKlass::cast(k);
@@ -993,7 +1061,7 @@ void DumperSupport::dump_instance(DumpWriter* writer, oop o) {
 
 // creates HPROF_GC_CLASS_DUMP record for the given class and each of
 // its array classes
-void DumperSupport::dump_class_and_array_classes(DumpWriter* writer, Klass* k) {
+void DumperSupport::dump_class_and_array_classes(AbstractDumpWriter* writer, Klass* k) {
   InstanceKlass* ik = InstanceKlass::cast(k);
 
   // We can safepoint and do a heap dump at a point where we have a Klass,
@@ -1082,7 +1150,7 @@ void DumperSupport::dump_class_and_array_classes(DumpWriter* writer, Klass* k) {
 
 // creates HPROF_GC_CLASS_DUMP record for a given primitive array
 // class (and each multi-dimensional array class too)
-void DumperSupport::dump_basic_type_array_class(DumpWriter* writer, Klass* k) {
+void DumperSupport::dump_basic_type_array_class(AbstractDumpWriter* writer, Klass* k) {
  // array classes
  while (k != NULL) {
     Klass* klass = k;
@@ -1117,7 +1185,7 @@ void DumperSupport::dump_basic_type_array_class(DumpWriter* writer, Klass* k) {
 
 // Hprof uses an u4 as record length field,
 // which means we need to truncate arrays that are too long.
-int DumperSupport::calculate_array_max_length(DumpWriter* writer, arrayOop array, short header_size) {
+int DumperSupport::calculate_array_max_length(AbstractDumpWriter* writer, arrayOop array, short header_size) {
   BasicType type = ArrayKlass::cast(array->klass())->element_type();
   assert(type >= T_BOOLEAN && type <= T_OBJECT, "invalid array element type");
 
@@ -1144,7 +1212,7 @@ int DumperSupport::calculate_array_max_length(DumpWriter* writer, arrayOop array
 }
 
 // creates HPROF_GC_OBJ_ARRAY_DUMP record for the given object array
-void DumperSupport::dump_object_array(DumpWriter* writer, objArrayOop array) {
+void DumperSupport::dump_object_array(AbstractDumpWriter* writer, objArrayOop array) {
   // sizeof(u1) + 2 * sizeof(u4) + sizeof(objectID) + sizeof(classID)
   short header_size = 1 + 2 * 4 + 2 * sizeof(address);
   int length = calculate_array_max_length(writer, array, header_size);
@@ -1178,7 +1246,7 @@ void DumperSupport::dump_object_array(DumpWriter* writer, objArrayOop array) {
   for (int i = 0; i < Length; i++) { writer->write_##Size((Size)Array->Type##_at(i)); }
 
 // creates HPROF_GC_PRIM_ARRAY_DUMP record for the given type array
-void DumperSupport::dump_prim_array(DumpWriter* writer, typeArrayOop array) {
+void DumperSupport::dump_prim_array(AbstractDumpWriter* writer, typeArrayOop array) {
   BasicType type = TypeArrayKlass::cast(array->klass())->element_type();
 
   // 2 * sizeof(u1) + 2 * sizeof(u4) + sizeof(objectID)
@@ -1272,7 +1340,7 @@ void DumperSupport::dump_prim_array(DumpWriter* writer, typeArrayOop array) {
 }
 
 // create a HPROF_FRAME record of the given Method* and bci
-void DumperSupport::dump_stack_frame(DumpWriter* writer,
+void DumperSupport::dump_stack_frame(AbstractDumpWriter* writer,
                                      int frame_serial_num,
                                      int class_serial_num,
                                      Method* m,
@@ -1301,10 +1369,10 @@ void DumperSupport::dump_stack_frame(DumpWriter* writer,
 
 class SymbolTableDumper : public SymbolClosure {
  private:
-  DumpWriter* _writer;
-  DumpWriter* writer() const                { return _writer; }
+  AbstractDumpWriter* _writer;
+  AbstractDumpWriter* writer() const        { return _writer; }
  public:
-  SymbolTableDumper(DumpWriter* writer)     { _writer = writer; }
+  SymbolTableDumper(AbstractDumpWriter* writer) { _writer = writer; }
   void do_symbol(Symbol** p);
 };
 
@@ -1324,12 +1392,12 @@ void SymbolTableDumper::do_symbol(Symbol** p) {
 
 class JNILocalsDumper : public OopClosure {
  private:
-  DumpWriter* _writer;
+  AbstractDumpWriter* _writer;
   u4 _thread_serial_num;
   int _frame_num;
-  DumpWriter* writer() const                { return _writer; }
+  AbstractDumpWriter* writer() const        { return _writer; }
  public:
-  JNILocalsDumper(DumpWriter* writer, u4 thread_serial_num) {
+  JNILocalsDumper(AbstractDumpWriter* writer, u4 thread_serial_num) {
     _writer = writer;
     _thread_serial_num = thread_serial_num;
     _frame_num = -1;  // default - empty stack
@@ -1358,11 +1426,11 @@ void JNILocalsDumper::do_oop(oop* obj_p) {
 
 class JNIGlobalsDumper : public OopClosure {
  private:
-  DumpWriter* _writer;
-  DumpWriter* writer() const                { return _writer; }
+  AbstractDumpWriter* _writer;
+  AbstractDumpWriter* writer() const        { return _writer; }
 
  public:
-  JNIGlobalsDumper(DumpWriter* writer) {
+  JNIGlobalsDumper(AbstractDumpWriter* writer) {
     _writer = writer;
   }
   void do_oop(oop* obj_p);
@@ -1390,10 +1458,10 @@ void JNIGlobalsDumper::do_oop(oop* obj_p) {
 
 class MonitorUsedDumper : public OopClosure {
  private:
-  DumpWriter* _writer;
-  DumpWriter* writer() const                { return _writer; }
+  AbstractDumpWriter* _writer;
+  AbstractDumpWriter* writer() const        { return _writer; }
  public:
-  MonitorUsedDumper(DumpWriter* writer) {
+  MonitorUsedDumper(AbstractDumpWriter* writer) {
     _writer = writer;
   }
   void do_oop(oop* obj_p) {
@@ -1410,10 +1478,10 @@ class MonitorUsedDumper : public OopClosure {
 
 class StickyClassDumper : public KlassClosure {
  private:
-  DumpWriter* _writer;
-  DumpWriter* writer() const                { return _writer; }
+  AbstractDumpWriter* _writer;
+  AbstractDumpWriter* writer() const        { return _writer; }
  public:
-  StickyClassDumper(DumpWriter* writer) {
+  StickyClassDumper(AbstractDumpWriter* writer) {
     _writer = writer;
   }
   void do_klass(Klass* k) {
@@ -1435,13 +1503,13 @@ class VM_HeapDumper;
 class HeapObjectDumper : public ObjectClosure {
  private:
   VM_HeapDumper* _dumper;
-  DumpWriter* _writer;
+  AbstractDumpWriter* _writer;
 
   VM_HeapDumper* dumper()               { return _dumper; }
-  DumpWriter* writer()                  { return _writer; }
+  AbstractDumpWriter* writer()          { return _writer; }
 
  public:
-  HeapObjectDumper(VM_HeapDumper* dumper, DumpWriter* writer) {
+  HeapObjectDumper(VM_HeapDumper* dumper, AbstractDumpWriter* writer) {
     _dumper = dumper;
     _writer = writer;
   }
@@ -1488,6 +1556,18 @@ class VM_HeapDumper : public VM_GC_Operation, public AbstractGangTask {
   ThreadStackTrace** _stack_traces;
   int _num_threads;
 
+  // Parallel object dumping, set up by prepare_parallel_dump()
+  bool                    _parallel_objects; // may objects be dumped in parallel?
+  ParallelObjectIterator* _poi;
+  Monitor*                _dump_lock;        // guards the fields below and the appends to the writer
+  char**                  _dump_buffers;     // one ParDumpWriter buffer per dumper
+  uint                    _num_dumpers;
+  uint                    _dumpers_done;
+  bool                    _dump_started;
+
+  // Set if the dump is written by a snapshot process, see doit()
+  bool                    _dumped_in_snapshot;
+
   // accessors and setters
   static VM_HeapDumper* dumper()         {  assert(_global_dumper != NULL, "Error"); return _global_dumper; }
   static DumpWriter* writer()            {  assert(_global_writer != NULL, "Error"); return _global_writer; }
@@ -1527,8 +1607,15 @@ class VM_HeapDumper : public VM_GC_Operation, public AbstractGangTask {
   // HPROF_TRACE and HPROF_FRAME records
   void dump_stack_traces();
 
+  // Sets up dumping the objects with num_dumpers threads, if possible.
+  void prepare_parallel_dump(uint num_dumpers);
+  void cleanup_parallel_dump();
+  bool is_parallel_dump() const { return _poi != NULL; }
+  // Dumps this worker's share of the objects.
+  void dump_objects_parallel(uint worker_id);
+
  public:
-  VM_HeapDumper(DumpWriter* writer, bool gc_before_heap_dump, bool oome) :
+  VM_HeapDumper(DumpWriter* writer, bool gc_before_heap_dump, bool oome, bool parallel_objects) :
     VM_GC_Operation(0 /* total collections,      dummy, ignored */,
                     GCCause::_heap_dump /* GC Cause */,
                     0 /* total full collections, dummy, ignored */,
@@ -1539,6 +1626,14 @@ class VM_HeapDumper : public VM_GC_Operation, public AbstractGangTask {
     _klass_map = new (ResourceObj::C_HEAP, mtInternal) GrowableArray<Klass*>(INITIAL_CLASS_COUNT, true);
     _stack_traces = NULL;
     _num_threads = 0;
+    _parallel_objects = parallel_objects;
+    _poi = NULL;
+    _dump_lock = NULL;
+    _dump_buffers = NULL;
+    _num_dumpers = 0;
+    _dumpers_done = 0;
+    _dump_started = false;
+    _dumped_in_snapshot = false;
     if (oome) {
       assert(!Thread::current()->is_VM_thread(), "Dump from OutOfMemoryError cannot be called by the VMThread");
       // get OutOfMemoryError zero-parameter constructor
@@ -1560,11 +1655,14 @@ class VM_HeapDumper : public VM_GC_Operation, public AbstractGangTask {
       FREE_C_HEAP_ARRAY(ThreadStackTrace*, _stack_traces);
     }
     delete _klass_map;
+    cleanup_parallel_dump();
   }
 
   VMOp_Type type() const { return VMOp_HeapDumper; }
   void doit();
   void work(uint worker_id);
+
+  bool dumped_in_snapshot() const { return _dumped_in_snapshot; }
 };
 
 
@@ -1576,7 +1674,7 @@ bool VM_HeapDumper::skip_operation() const {
 }
 
 // fixes up the current dump record and writes HPROF_HEAP_DUMP_END record
-void DumperSupport::end_of_dump(DumpWriter* writer) {
+void DumperSupport::end_of_dump(AbstractDumpWriter* writer) {
   writer->finish_dump_segment();
 
   writer->write_u1(HPROF_HEAP_DUMP_END);
@@ -1775,6 +1873,14 @@ void VM_HeapDumper::do_threads() {
 // records as we go. Once that is done we write records for some of the GC
 // roots.
 
+// Called in a copy of the process that only has the VM thread. A lock
+// owned by another thread would never be released there, so do not take
+// the snapshot if one is. The Heap_lock is owned by the requester of the
+// operation and not taken by the dump.
+static bool can_dump_in_snapshot() {
+  return !is_lock_owned_by_other_thread(Heap_lock);
+}
+
 void VM_HeapDumper::doit() {
 
   HandleMark hm;
@@ -1791,6 +1897,30 @@ void VM_HeapDumper::doit() {
     }
   }
 
+  if (HeapDumpInForkedProcess) {
+    // Let a copy-on-write snapshot of the process write the dump, so this
+    // safepoint only lasts as long as the fork. ThreadCritical is held
+    // across the fork so that it is not held by a vanished thread in the
+    // snapshot process. HeapDumpInForkedProcess is turned off when the
+    // heap memory would be shared with the snapshot process.
+    int result;
+    {
+      ThreadCritical tc;
+      result = os::fork_snapshot_process(can_dump_in_snapshot);
+    }
+    if (result == 0) {
+      // In the snapshot process, with this thread only.
+      set_global_dumper();
+      set_global_writer();
+      work(0);
+      os::exit_snapshot_process(writer()->error() == NULL ? 0 : 1);
+    } else if (result > 0) {
+      _dumped_in_snapshot = true;
+      return;
+    }
+    warning("could not create a snapshot process for the heap dump, dumping in the VM");
+  }
+
   // At this point we should be the only dumper active, so
   // the following should be safe.
   set_global_dumper();
@@ -1801,7 +1931,10 @@ void VM_HeapDumper::doit() {
   if (gang == NULL) {
     work(0);
   } else {
+    // The VM thread takes part as the foreground worker.
+    prepare_parallel_dump(gang->active_workers() + 1);
     gang->run_task(this, gang->active_workers(), true);
+    cleanup_parallel_dump();
   }
 
   // Now we clear the global variables, so that a future dumper can run.
@@ -1809,8 +1942,79 @@ void VM_HeapDumper::doit() {
   clear_global_writer();
 }
 
+void VM_HeapDumper::prepare_parallel_dump(uint num_dumpers) {
+  assert(_poi == NULL, "invariant");
+  if (!_parallel_objects || num_dumpers < 2) {
+    return;
+  }
+  ParallelObjectIterator* poi = Universe::heap()->parallel_object_iterator(num_dumpers);
+  if (poi == NULL) {
+    // The GC does not support parallel object iteration.
+    return;
+  }
+  // Ranked above the compression backend lock, which is taken while appending.
+  _dump_lock = new (std::nothrow) PaddedMonitor(Mutex::leaf + 1, "HeapDumper Parallel Dump Lock",
+                                                true, Mutex::_safepoint_check_never);
+  _dump_buffers = NEW_C_HEAP_ARRAY_RETURN_NULL(char*, num_dumpers, mtInternal);
+  bool success = _dump_lock != NULL && _dump_buffers != NULL;
+  if (_dump_buffers != NULL) {
+    for (uint i = 0; i < num_dumpers; i++) {
+      _dump_buffers[i] = success ? NEW_C_HEAP_ARRAY_RETURN_NULL(char, ParDumpWriter::buffer_size_bytes(), mtInternal) : NULL;
+      success = success && _dump_buffers[i] != NULL;
+    }
+  }
+  _num_dumpers = num_dumpers;
+  _poi = poi;
+  if (!success) {
+    // Not enough memory, dump the objects serially.
+    cleanup_parallel_dump();
+  }
+}
+
+void VM_HeapDumper::cleanup_parallel_dump() {
+  if (_dump_buffers != NULL) {
+    for (uint i = 0; i < _num_dumpers; i++) {
+      if (_dump_buffers[i] != NULL) {
+        FREE_C_HEAP_ARRAY(char, _dump_buffers[i]);
+      }
+    }
+    FREE_C_HEAP_ARRAY(char*, _dump_buffers);
+    _dump_buffers = NULL;
+  }
+  delete _dump_lock;
+  _dump_lock = NULL;
+  delete _poi;
+  _poi = NULL;
+  _num_dumpers = 0;
+}
+
+void VM_HeapDumper::dump_objects_parallel(uint worker_id) {
+  assert(is_parallel_dump(), "must be");
+  assert(worker_id < _num_dumpers, "invalid worker id %u", worker_id);
+  {
+    ResourceMark rm;
+    ParDumpWriter par_writer(writer(), _dump_lock, _dump_buffers[worker_id]);
+    HeapObjectDumper obj_dumper(this, &par_writer);
+    _poi->object_iterate(&obj_dumper, worker_id);
+  }
+  MonitorLockerEx ml(_dump_lock, Mutex::_no_safepoint_check_flag);
+  _dumpers_done++;
+  ml.notify_all();
+}
+
 void VM_HeapDumper::work(uint worker_id) {
   if (!Thread::current()->is_VM_thread()) {
+    if (is_parallel_dump()) {
+      // Wait until the VM thread has written the records preceding the
+      // objects, help dump the objects, then help writing.
+      {
+        MonitorLockerEx ml(_dump_lock, Mutex::_no_safepoint_check_flag);
+        while (!_dump_started) {
+          ml.wait(Mutex::_no_safepoint_check_flag);
+        }
+      }
+      dump_objects_parallel(worker_id);
+    }
     writer()->writer_loop();
     return;
   }
@@ -1852,8 +2056,25 @@ void VM_HeapDumper::work(uint worker_id) {
   // segment is started.
   // The HPROF_GC_CLASS_DUMP and HPROF_GC_INSTANCE_DUMP are the vast bulk
   // of the heap dump.
-  HeapObjectDumper obj_dumper(this, writer());
-  Universe::heap()->safe_object_iterate(&obj_dumper);
+  if (is_parallel_dump()) {
+    // Every dumper appends complete segments of its own to the writer.
+    writer()->finish_dump_segment();
+    {
+      MonitorLockerEx ml(_dump_lock, Mutex::_no_safepoint_check_flag);
+      _dump_started = true;
+      ml.notify_all();
+    }
+    dump_objects_parallel(worker_id);
+    {
+      MonitorLockerEx ml(_dump_lock, Mutex::_no_safepoint_check_flag);
+      while (_dumpers_done < _num_dumpers) {
+        ml.wait(Mutex::_no_safepoint_check_flag);
+      }
+    }
+  } else {
+    HeapObjectDumper obj_dumper(this, writer());
+    Universe::heap()->safe_object_iterate(&obj_dumper);
+  }
 
   // HPROF_GC_ROOT_THREAD_OBJ + frames + jni locals
   do_threads();
@@ -1969,7 +2190,8 @@ int HeapDumper::dump(const char* path, outputStream* out, int compression, bool
   }
 
   // generate the dump
-  VM_HeapDumper dumper(&writer, _gc_before_heap_dump, _oome);
+  // Dump the objects in parallel only if the workers are not needed for compression.
+  VM_HeapDumper dumper(&writer, _gc_before_heap_dump, _oome, compressor == NULL);
   if (Thread::current()->is_VM_thread()) {
     assert(SafepointSynchronize::is_at_safepoint(), "Expected to be called at a safepoint");
     dumper.doit();
@@ -1977,6 +2199,17 @@ int HeapDumper::dump(const char* path, outputStream* out, int compression, bool
     VMThread::execute(&dumper);
   }
 
+  if (dumper.dumped_in_snapshot()) {
+    // The snapshot process writes the file, release our copy of it.
+    writer.deactivate();
+    if (out != NULL) {
+      timer()->stop();
+      out->print_cr("Heap dump is being written by a background process [snapshot taken in %3.3f secs]",
+                    timer()->seconds());
+    }
+    return 0;
+  }
+
   // record any error that the writer may have encountered
   set_error(writer.error());
 
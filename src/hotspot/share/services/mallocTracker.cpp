@@ -24,12 +24,19 @@
 #include "precompiled.hpp"
 
 #include "runtime/atomic.hpp"
+#include "runtime/thread.hpp"
 #include "services/mallocSiteTable.hpp"
 #include "services/mallocTracker.hpp"
 #include "services/mallocTracker.inline.hpp"
 #include "services/memTracker.hpp"
 
-size_t MallocMemorySummary::_snapshot[CALC_OBJ_SIZE_IN_TYPE(MallocMemorySnapshot, size_t)];
+size_t MallocMemorySummary::_snapshot[MallocMemorySummary::num_stripes][MallocMemorySummary::stripe_words];
+
+// The MallocHeader bit fields must hold every memory type and stripe.
+STATIC_ASSERT(mt_number_of_types <= 32);
+STATIC_ASSERT(MallocMemorySummary::num_stripes <= 8);
+// current_stripe() takes the top bits of a hash.
+STATIC_ASSERT((MallocMemorySummary::num_stripes & (MallocMemorySummary::num_stripes - 1)) == 0);
 
 // Total malloc'd memory amount
 size_t MallocMemorySnapshot::total() const {
@@ -60,17 +67,31 @@ void MallocMemorySnapshot::make_adjustment() {
 
 
 void MallocMemorySummary::initialize() {
-  assert(sizeof(_snapshot) >= sizeof(MallocMemorySnapshot), "Sanity Check");
+  assert(sizeof(_snapshot[0]) >= sizeof(MallocMemorySnapshot), "Sanity Check");
   // Uses placement new operator to initialize static area.
-  ::new ((void*)_snapshot)MallocMemorySnapshot();
+  for (uint stripe = 0; stripe < num_stripes; stripe++) {
+    ::new ((void*)_snapshot[stripe])MallocMemorySnapshot();
+  }
+}
+
+uint MallocMemorySummary::current_stripe() {
+  // Tell threads apart by a multiplicative hash of their Thread, so that
+  // threads created one after the other spread over the stripes. Threads
+  // not attached to the VM share stripe 0.
+  Thread* thread = Thread::current_or_null_safe();
+  if (thread == NULL) {
+    return 0;
+  }
+  uint64_t hash = (uint64_t)(uintptr_t)thread * CONST64(0x9E3779B97F4A7C15);
+  return (uint)(hash >> (BitsPerLong - log2_uint(num_stripes)));
 }
 
 void MallocHeader::release() const {
   // Tracking already shutdown, no housekeeping is needed anymore
   if (MemTracker::tracking_level() <= NMT_minimal) return;
 
-  MallocMemorySummary::record_free(size(), flags());
-  MallocMemorySummary::record_free_malloc_header(sizeof(MallocHeader));
+  MallocMemorySummary::record_free(size(), flags(), stripe());
+  MallocMemorySummary::record_free_malloc_header(sizeof(MallocHeader), stripe());
   if (MemTracker::tracking_level() == NMT_detail) {
     MallocSiteTable::deallocation_at(size(), _bucket_idx, _pos_idx);
   }
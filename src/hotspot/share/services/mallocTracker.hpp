@@ -78,6 +78,13 @@ class MemoryCounter {
     }
   }
 
+  // Adds the values of another counter, for summing up snapshot copies.
+  // The peaks are per counter and are not combined.
+  inline void add(const MemoryCounter& other) {
+    _count += other._count;
+    _size += other._size;
+  }
+
   inline size_t count() const { return _count; }
   inline size_t size()  const { return _size;  }
   DEBUG_ONLY(inline size_t peak_count() const { return _peak_count; })
@@ -118,6 +125,11 @@ class MallocMemory {
     _arena.resize(sz);
   }
 
+  inline void add(const MallocMemory& other) {
+    _malloc.add(other._malloc);
+    _arena.add(other._arena);
+  }
+
   inline size_t malloc_size()  const { return _malloc.size(); }
   inline size_t malloc_count() const { return _malloc.count();}
   inline size_t arena_size()   const { return _arena.size();  }
@@ -176,6 +188,14 @@ class MallocMemorySnapshot : public ResourceObj {
     }
   }
 
+  // Add the counters of this snapshot to s.
+  void add_to(MallocMemorySnapshot* s) const {
+    s->_tracking_header.add(_tracking_header);
+    for (int index = 0; index < mt_number_of_types; index ++) {
+      s->_malloc[index].add(_malloc[index]);
+    }
+  }
+
   // Make adjustment by subtracting chunks used by arenas
   // from total chunks to get total free chunk size
   void make_adjustment();
@@ -183,21 +203,40 @@ class MallocMemorySnapshot : public ResourceObj {
 
 /*
  * This class is for collecting malloc statistics at summary level
+ *
+ * The counters of tracked mallocs are spread over a number of stripes,
+ * so that threads mostly update counters of their own stripe instead of
+ * contending on the same cache lines. The stripe is recorded in the
+ * malloc header, so the free is counted in the same stripe. The arena
+ * and thread counters, which are not tied to a header, use stripe 0.
+ * The stripes are summed up when a snapshot is taken.
  */
 class MallocMemorySummary : AllStatic {
+ public:
+  // Must fit into MallocHeader::_stripe.
+  static const uint num_stripes = 8;
+
  private:
-  // Reserve memory for placement of MallocMemorySnapshot object
-  static size_t _snapshot[CALC_OBJ_SIZE_IN_TYPE(MallocMemorySnapshot, size_t)];
+  enum {
+    // Stripe size in words, rounded up to whole cache lines
+    stripe_words = align_up_(sizeof(MallocMemorySnapshot), DEFAULT_CACHE_LINE_SIZE) / sizeof(size_t)
+  };
+
+  // Reserve memory for placement of the MallocMemorySnapshot stripes
+  static size_t _snapshot[num_stripes][stripe_words];
 
  public:
    static void initialize();
 
-   static inline void record_malloc(size_t size, MEMFLAGS flag) {
-     as_snapshot()->by_type(flag)->record_malloc(size);
+   // The stripe for mallocs by the current thread
+   static uint current_stripe();
+
+   static inline void record_malloc(size_t size, MEMFLAGS flag, uint stripe = 0) {
+     as_snapshot(stripe)->by_type(flag)->record_malloc(size);
    }
 
-   static inline void record_free(size_t size, MEMFLAGS flag) {
-     as_snapshot()->by_type(flag)->record_free(size);
+   static inline void record_free(size_t size, MEMFLAGS flag, uint stripe = 0) {
+     as_snapshot(stripe)->by_type(flag)->record_free(size);
    }
 
    static inline void record_new_arena(MEMFLAGS flag) {
@@ -213,26 +252,37 @@ class MallocMemorySummary : AllStatic {
    }
 
    static void snapshot(MallocMemorySnapshot* s) {
+     // ThreadCritical is reentrant; holding it across all stripes keeps
+     // the chunk and arena counters consistent for make_adjustment().
+     ThreadCritical tc;
      as_snapshot()->copy_to(s);
+     for (uint stripe = 1; stripe < num_stripes; stripe++) {
+       as_snapshot(stripe)->add_to(s);
+     }
      s->make_adjustment();
    }
 
    // Record memory used by malloc tracking header
-   static inline void record_new_malloc_header(size_t sz) {
-     as_snapshot()->malloc_overhead()->allocate(sz);
+   static inline void record_new_malloc_header(size_t sz, uint stripe = 0) {
+     as_snapshot(stripe)->malloc_overhead()->allocate(sz);
    }
 
-   static inline void record_free_malloc_header(size_t sz) {
-     as_snapshot()->malloc_overhead()->deallocate(sz);
+   static inline void record_free_malloc_header(size_t sz, uint stripe = 0) {
+     as_snapshot(stripe)->malloc_overhead()->deallocate(sz);
    }
 
    // The memory used by malloc tracking headers
    static inline size_t tracking_overhead() {
-     return as_snapshot()->malloc_overhead()->size();
+     size_t overhead = 0;
+     for (uint stripe = 0; stripe < num_stripes; stripe++) {
+       overhead += as_snapshot(stripe)->malloc_overhead()->size();
+     }
+     return overhead;
    }
 
-  static MallocMemorySnapshot* as_snapshot() {
-    return (MallocMemorySnapshot*)_snapshot;
+  static MallocMemorySnapshot* as_snapshot(uint stripe = 0) {
+    assert(stripe < num_stripes, "invalid stripe");
+    return (MallocMemorySnapshot*)_snapshot[stripe];
   }
 };
 
@@ -246,14 +296,16 @@ class MallocMemorySummary : AllStatic {
 class MallocHeader {
 #ifdef _LP64
   size_t           _size      : 64;
-  size_t           _flags     : 8;
+  size_t           _flags     : 5;
+  size_t           _stripe    : 3;
   size_t           _pos_idx   : 16;
   size_t           _bucket_idx: 40;
 #define MAX_MALLOCSITE_TABLE_SIZE right_n_bits(40)
 #define MAX_BUCKET_LENGTH         right_n_bits(16)
 #else
   size_t           _size      : 32;
-  size_t           _flags     : 8;
+  size_t           _flags     : 5;
+  size_t           _stripe    : 3;
   size_t           _pos_idx   : 8;
   size_t           _bucket_idx: 16;
 #define MAX_MALLOCSITE_TABLE_SIZE  right_n_bits(16)
@@ -270,6 +322,7 @@ class MallocHeader {
     }
 
     _flags = flags;
+    _stripe = MallocMemorySummary::current_stripe();
     set_size(size);
     if (level == NMT_detail) {
       size_t bucket_idx;
@@ -282,12 +335,13 @@ class MallocHeader {
       }
     }
 
-    MallocMemorySummary::record_malloc(size, flags);
-    MallocMemorySummary::record_new_malloc_header(sizeof(MallocHeader));
+    MallocMemorySummary::record_malloc(size, flags, _stripe);
+    MallocMemorySummary::record_new_malloc_header(sizeof(MallocHeader), _stripe);
   }
 
   inline size_t   size()  const { return _size; }
   inline MEMFLAGS flags() const { return (MEMFLAGS)_flags; }
+  inline uint     stripe() const { return (uint)_stripe; }
   bool get_stack(NativeCallStack& stack) const;
 
   // Cleanup tracking information before the memory is released.
@@ -35,6 +35,7 @@
 #include "runtime/handles.inline.hpp"
 #include "runtime/init.hpp"
 #include "runtime/objectMonitor.inline.hpp"
+#include "runtime/synchronizer.hpp"
 #include "runtime/thread.inline.hpp"
 #include "runtime/threadSMR.inline.hpp"
 #include "runtime/vframe.hpp"
@@ -399,8 +400,8 @@ DeadlockCycle* ThreadService::find_deadlocks_at_safepoint(ThreadsList * t_list,
       if (waitingToLockMonitor != NULL) {
         address currentOwner = (address)waitingToLockMonitor->owner();
         if (currentOwner != NULL) {
-          currentThread = Threads::owning_thread_from_monitor_owner(t_list,
-                                                                    currentOwner);
+          currentThread = Threads::owning_thread_from_monitor(t_list,
+                                                              waitingToLockMonitor);
           if (currentThread == NULL) {
             // This function is called at a safepoint so the JavaThread
             // that owns waitingToLockMonitor should be findable, but
@@ -599,14 +600,14 @@ void StackFrameInfo::print_on(outputStream* st) const {
 class InflatedMonitorsClosure: public MonitorClosure {
 private:
   ThreadStackTrace* _stack_trace;
-  Thread* _thread;
+  JavaThread* _thread;
 public:
-  InflatedMonitorsClosure(Thread* t, ThreadStackTrace* st) {
+  InflatedMonitorsClosure(JavaThread* t, ThreadStackTrace* st) {
     _thread = t;
     _stack_trace = st;
   }
   void do_monitor(ObjectMonitor* mid) {
-    if (mid->owner() == _thread) {
+    if (ObjectSynchronizer::is_monitor_owner(mid, _thread)) {
       oop object = (oop) mid->object();
       if (!_stack_trace->is_owned_monitor_on_stack(object)) {
         _stack_trace->add_jni_locked_monitor(object);
@@ -977,15 +978,21 @@ void DeadlockCycle::print_on_with(ThreadsList * t_list, outputStream* st) const
         // No Java object associated - a JVMTI raw monitor
         owner_desc = " (JVMTI raw monitor),\n  which is held by";
       }
-      currentThread = Threads::owning_thread_from_monitor_owner(t_list,
-                                                                (address)waitingToLockMonitor->owner());
+      currentThread = Threads::owning_thread_from_monitor(t_list,
+                                                          waitingToLockMonitor);
       if (currentThread == NULL) {
         // The deadlock was detected at a safepoint so the JavaThread
         // that owns waitingToLockMonitor should be findable, but
         // if it is not findable, then the previous currentThread is
         // blocked permanently.
-        st->print("%s UNKNOWN_owner_addr=" PTR_FORMAT, owner_desc,
-                  p2i(waitingToLockMonitor->owner()));
+        if (UseLightweightLocking && waitingToLockMonitor->is_owner_anonymous()) {
+          // The owner address of an anonymously owned monitor means nothing
+          st->print("%s UNKNOWN_owner_obj=" PTR_FORMAT, owner_desc,
+                    p2i(waitingToLockMonitor->object()));
+        } else {
+          st->print("%s UNKNOWN_owner_addr=" PTR_FORMAT, owner_desc,
+                    p2i(waitingToLockMonitor->owner()));
+        }
         continue;
       }
     } else {
@@ -305,6 +305,24 @@ void BitMap::clear_large_range(idx_t beg, idx_t end) {
   clear_range_within_word(bit_index(end_full_word), end);
 }
 
+void BitMap::clear_large_range_nontemporal(idx_t beg, idx_t end) {
+  verify_range(beg, end);
+
+  idx_t beg_full_word = word_index_round_up(beg);
+  idx_t end_full_word = word_index(end);
+
+  if (is_small_range_of_words(beg_full_word, end_full_word)) {
+    clear_range(beg, end);
+    return;
+  }
+
+  // The range includes at least one full word.
+  clear_range_within_word(beg, bit_index(beg_full_word));
+  STATIC_ASSERT(sizeof(bm_word_t) == HeapWordSize);
+  Copy::zero_to_words_nontemporal((HeapWord*)(_map + beg_full_word), end_full_word - beg_full_word);
+  clear_range_within_word(bit_index(end_full_word), end);
+}
+
 void BitMap::at_put(idx_t offset, bool value) {
   if (value) {
     set_bit(offset);
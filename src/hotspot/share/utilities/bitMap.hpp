@@ -237,6 +237,8 @@ class BitMap {
   void clear_range (idx_t beg, idx_t end);
   void set_large_range   (idx_t beg, idx_t end);
   void clear_large_range (idx_t beg, idx_t end);
+  // Like clear_large_range(), but avoids polluting the caches where supported.
+  void clear_large_range_nontemporal(idx_t beg, idx_t end);
   void at_put_range(idx_t beg, idx_t end, bool value);
   void par_at_put_range(idx_t beg, idx_t end, bool value);
   void at_put_large_range(idx_t beg, idx_t end, bool value);
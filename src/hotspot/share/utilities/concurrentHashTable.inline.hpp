@@ -661,6 +661,10 @@ inline bool ConcurrentHashTable<VALUE, CONFIG, F>::
   Node* delete_me = NULL;
   Node* const volatile * even = new_table->get_bucket(even_index)->first_ptr();
   Node* const volatile * odd = new_table->get_bucket(odd_index)->first_ptr();
+  // Whether the even or odd chain has been changed since readers were last
+  // synchronized.
+  bool even_moved = false;
+  bool odd_moved = false;
   while (aux != NULL) {
     bool dead_hash = false;
     size_t aux_hash = CONFIG::get_hash(*aux->value(), &dead_hash);
@@ -668,22 +672,36 @@ inline bool ConcurrentHashTable<VALUE, CONFIG, F>::
     if (dead_hash) {
       delete_me = aux;
       // This item is dead, move both list to next
+      if (even_moved || odd_moved) {
+        write_synchonize_on_visible_epoch(thread);
+      }
       new_table->get_bucket(odd_index)->release_assign_node_ptr(odd,
                                                                 aux_next);
       new_table->get_bucket(even_index)->release_assign_node_ptr(even,
                                                                  aux_next);
+      even_moved = odd_moved = true;
     } else {
       size_t aux_index = bucket_idx_hash(new_table, aux_hash);
       if (aux_index == even_index) {
         // This is a even, so move odd to aux/even next
+        if (even_moved) {
+          write_synchonize_on_visible_epoch(thread);
+          even_moved = false;
+        }
         new_table->get_bucket(odd_index)->release_assign_node_ptr(odd,
                                                                   aux_next);
+        odd_moved = true;
         // Keep in even list
         even = aux->next_ptr();
       } else if (aux_index == odd_index) {
         // This is a odd, so move odd to aux/odd next
+        if (odd_moved) {
+          write_synchonize_on_visible_epoch(thread);
+          odd_moved = false;
+        }
         new_table->get_bucket(even_index)->release_assign_node_ptr(even,
                                                                    aux_next);
+        even_moved = true;
         // Keep in odd list
         odd = aux->next_ptr();
       } else {
@@ -694,13 +712,19 @@ inline bool ConcurrentHashTable<VALUE, CONFIG, F>::
 
     // We can only move 1 pointer otherwise a reader might be moved to the wrong
     // chain. E.g. looking for even hash value but got moved to the odd bucket
-    // chain.
-    write_synchonize_on_visible_epoch(thread);
+    // chain. A run of nodes with the same parity only ever moves the pointer
+    // of the other chain forward along the old chain, so readers need only be
+    // synchronized when the parity changes, and before a node is freed.
     if (delete_me != NULL) {
+      write_synchonize_on_visible_epoch(thread);
+      even_moved = odd_moved = false;
       Node::destroy_node(delete_me);
       delete_me = NULL;
     }
   }
+  if (even_moved || odd_moved) {
+    write_synchonize_on_visible_epoch(thread);
+  }
   return true;
 }
 
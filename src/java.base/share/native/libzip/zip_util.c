@@ -679,7 +679,16 @@ readCEN(jzfile *zip, jint knownTotal)
      * Keep this path alive even with the Zip64 END support added, just
      * for zip files that have more than 0xffff entries but don't have
      * the Zip64 enabled.
+     *
+     * A central directory that is too short to hold more than 0xffff
+     * headers can be trusted, so only count the headers up front when
+     * it is longer. This saves hashing the first 0xffff entries twice
+     * for large jar files without Zip64 END records.
      */
+    if (knownTotal == -1 && endhdrlen == ENDHDR &&
+        cenlen / CENHDR > 0xFFFF) {
+        knownTotal = countCENHeaders(cenbuf, cenend);
+    }
     total = (knownTotal != -1) ? knownTotal : total;
     entries  = zip->entries  = calloc(total, sizeof(entries[0]));
     tablelen = zip->tablelen = ((total/2) | 1); // Odd -> fewer collisions
@@ -119,6 +119,7 @@ JNIEXPORT jbyteArray JNICALL Java_sun_security_pkcs11_wrapper_PKCS11_C_1Sign
     CK_BYTE_PTR bufP;
     CK_ULONG ckSignatureLength;
     CK_BYTE BUF[MAX_STACK_BUFFER_LEN];
+    CK_BYTE INBUF[MAX_STACK_BUFFER_LEN];
     jbyteArray jSignature = NULL;
     CK_RV rv;
 
@@ -128,7 +129,8 @@ JNIEXPORT jbyteArray JNICALL Java_sun_security_pkcs11_wrapper_PKCS11_C_1Sign
     TRACE0("DEBUG: C_Sign\n");
 
     ckSessionHandle = jLongToCKULong(jSessionHandle);
-    jByteArrayToCKByteArray(env, jData, &ckpData, &ckDataLength);
+    // the data to sign is usually a digest, avoid allocating a copy of it
+    jByteArrayToCKByteBuffer(env, jData, INBUF, MAX_STACK_BUFFER_LEN, &ckpData, &ckDataLength);
     if ((*env)->ExceptionCheck(env)) {
         return NULL;
     }
@@ -149,7 +151,7 @@ JNIEXPORT jbyteArray JNICALL Java_sun_security_pkcs11_wrapper_PKCS11_C_1Sign
         TRACE1("DEBUG C_Sign: signature length = %lu\n", ckSignatureLength);
     }
 
-    free(ckpData);
+    if (ckpData != INBUF) { free(ckpData); }
     if (bufP != BUF) { free(bufP); }
 
     TRACE0("FINISHED\n");
@@ -440,6 +442,8 @@ JNIEXPORT void JNICALL Java_sun_security_pkcs11_wrapper_PKCS11_C_1Verify
     CK_BYTE_PTR ckpSignature = NULL_PTR;
     CK_ULONG ckDataLength;
     CK_ULONG ckSignatureLength;
+    CK_BYTE INBUF[MAX_STACK_BUFFER_LEN];
+    CK_BYTE SIGBUF[MAX_STACK_BUFFER_LEN];
     CK_RV rv = 0;
 
     CK_FUNCTION_LIST_PTR ckpFunctions = getFunctionList(env, obj);
@@ -447,12 +451,12 @@ JNIEXPORT void JNICALL Java_sun_security_pkcs11_wrapper_PKCS11_C_1Verify
 
     ckSessionHandle = jLongToCKULong(jSessionHandle);
 
-    jByteArrayToCKByteArray(env, jData, &ckpData, &ckDataLength);
+    jByteArrayToCKByteBuffer(env, jData, INBUF, MAX_STACK_BUFFER_LEN, &ckpData, &ckDataLength);
     if ((*env)->ExceptionCheck(env)) {
-        return;
+        goto cleanup;
     }
 
-    jByteArrayToCKByteArray(env, jSignature, &ckpSignature, &ckSignatureLength);
+    jByteArrayToCKByteBuffer(env, jSignature, SIGBUF, MAX_STACK_BUFFER_LEN, &ckpSignature, &ckSignatureLength);
     if ((*env)->ExceptionCheck(env)) {
         goto cleanup;
     }
@@ -461,8 +465,8 @@ JNIEXPORT void JNICALL Java_sun_security_pkcs11_wrapper_PKCS11_C_1Verify
     rv = (*ckpFunctions->C_Verify)(ckSessionHandle, ckpData, ckDataLength, ckpSignature, ckSignatureLength);
 
 cleanup:
-    free(ckpData);
-    free(ckpSignature);
+    if (ckpData != INBUF) { free(ckpData); }
+    if (ckpSignature != SIGBUF) { free(ckpSignature); }
 
     ckAssertReturnValueOK(env, rv);
 }
@@ -572,6 +572,32 @@ void jByteArrayToCKByteArray(JNIEnv *env, const jbyteArray jArray, CK_BYTE_PTR *
     }
 }
 
+/*
+ * converts a jbyteArray to a CK_BYTE array like jByteArrayToCKByteArray, but
+ * uses the caller supplied buffer if the array fits into it. The returned
+ * array has to be freed after use if it is not the supplied buffer!
+ *
+ * @param env - used to call JNI funktions to get the array informtaion
+ * @param jArray - the Java array to convert
+ * @param buf - the buffer to use for arrays of up to bufLen bytes
+ * @param bufLen - the length of buf
+ * @param ckpArray - the reference, where the pointer to the CK_BYTE array will be stored
+ * @param ckpLength - the reference, where the array length will be stored
+ */
+void jByteArrayToCKByteBuffer(JNIEnv *env, const jbyteArray jArray, CK_BYTE_PTR buf, CK_ULONG bufLen,
+                              CK_BYTE_PTR *ckpArray, CK_ULONG_PTR ckpLength)
+{
+    if (jArray != NULL && sizeof(CK_BYTE) == sizeof(jbyte)) {
+        *ckpLength = (*env)->GetArrayLength(env, jArray);
+        if (*ckpLength <= bufLen) {
+            *ckpArray = buf;
+            (*env)->GetByteArrayRegion(env, jArray, 0, *ckpLength, (jbyte *)buf);
+            return;
+        }
+    }
+    jByteArrayToCKByteArray(env, jArray, ckpArray, ckpLength);
+}
+
 /*
  * converts a jlongArray to a CK_ULONG array. The allocated memory has to be freed after use!
  *
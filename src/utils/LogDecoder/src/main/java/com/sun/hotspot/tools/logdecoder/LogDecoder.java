@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+
+package com.sun.hotspot.tools.logdecoder;
+
+import java.io.BufferedInputStream;
+import java.io.DataInputStream;
+import java.io.EOFException;
+import java.io.FileInputStream;
+import java.io.IOException;
+import java.io.InputStream;
+import java.io.PrintStream;
+import java.nio.charset.StandardCharsets;
+import java.util.HashMap;
+import java.util.Locale;
+import java.util.Map;
+
+/**
+ * Decodes unified logging files written with {@code format=binary}, for
+ * example {@code -Xlog:gc*=debug:file=gc.bin::format=binary}, back into
+ * the default text format {@code [uptime][level][tags] message}.
+ *
+ * <p>Usage: {@code java LogDecoder.java <file>...}
+ *
+ * <p>The format is described in logFileOutput.cpp.
+ */
+public class LogDecoder {
+    private static final byte[] MAGIC = "HSLOGBIN".getBytes(StandardCharsets.US_ASCII);
+    private static final int VERSION = 1;
+    private static final int TAGSET_RECORD = 1;
+    private static final int MESSAGE_RECORD = 2;
+    private static final String[] LEVELS = { "off", "trace", "debug", "info", "warning", "error" };
+
+    private final DataInputStream in;
+    private final PrintStream out;
+    private final Map<Long, String> tagsets = new HashMap<>();
+    private long uptimeNanos;
+
+    LogDecoder(InputStream in, PrintStream out) {
+        this.in = new DataInputStream(new BufferedInputStream(in));
+        this.out = out;
+    }
+
+    private long readVarint() throws IOException {
+        long value = 0;
+        int shift = 0;
+        int b;
+        do {
+            b = in.readUnsignedByte();
+            value |= (long) (b & 0x7f) << shift;
+            shift += 7;
+        } while ((b & 0x80) != 0);
+        return value;
+    }
+
+    private String readString() throws IOException {
+        long len = readVarint();
+        if (len > Integer.MAX_VALUE) {
+            throw new IOException("Invalid string length " + len);
+        }
+        byte[] bytes = new byte[(int) len];
+        in.readFully(bytes);
+        return new String(bytes, StandardCharsets.UTF_8);
+    }
+
+    void decode() throws IOException {
+        byte[] magic = new byte[MAGIC.length];
+        in.readFully(magic);
+        for (int i = 0; i < MAGIC.length; i++) {
+            if (magic[i] != MAGIC[i]) {
+                throw new IOException("Not a binary log file");
+            }
+        }
+        int version = in.readUnsignedByte();
+        if (version != VERSION) {
+            throw new IOException("Unsupported binary log version " + version);
+        }
+        long pid = readVarint();
+        long startTime = readVarint();
+        out.println("# pid " + pid + ", VM start time " + java.time.Instant.ofEpochMilli(startTime));
+
+        while (true) {
+            int type;
+            try {
+                type = in.readUnsignedByte();
+            } catch (EOFException e) {
+                return;
+            }
+            switch (type) {
+            case TAGSET_RECORD: {
+                long id = readVarint();
+                tagsets.put(id, readString());
+                break;
+            }
+            case MESSAGE_RECORD: {
+                long delta = readVarint();
+                uptimeNanos += (delta >>> 1) ^ -(delta & 1);
+                int level = in.readUnsignedByte();
+                long id = readVarint();
+                String msg = readString();
+                String tags = tagsets.getOrDefault(id, "tagset#" + id);
+                String levelName = level < LEVELS.length ? LEVELS[level] : "level#" + level;
+                out.printf(Locale.ROOT, "[%.3fs][%s][%s] %s%n", uptimeNanos / 1e9, levelName, tags, msg);
+                break;
+            }
+            default:
+                throw new IOException("Unknown record type " + type);
+            }
+        }
+    }
+
+    public static void main(String[] args) throws IOException {
+        if (args.length == 0) {
+            System.err.println("Usage: java LogDecoder.java <file>...");
+            System.exit(1);
+        }
+        for (String file : args) {
+            try (InputStream in = new FileInputStream(file)) {
+                new LogDecoder(in, System.out).decode();
+            }
+        }
+    }
+}
@@ -90,6 +90,51 @@ TEST_VM(SymbolTable, temp_new_symbol) {
   ASSERT_EQ(bigsym->refcount(), PERM_REFCOUNT) << "should be sticky";
 }
 
+TEST_VM(SymbolTable, recycle_freed_symbols) {
+  if (SymbolFreeListLimit == 0) {
+    return;
+  }
+  JavaThread* THREAD = JavaThread::current();
+  ThreadInVMfromNative ThreadInVMfromNative(THREAD);
+
+  const int count = 100;
+  Symbol* freed[count];
+  char name[32];
+  for (int i = 0; i < count; i++) {
+    jio_snprintf(name, sizeof(name), "recycle_freed_%06d", i);
+    TempNewSymbol sym = SymbolTable::new_symbol(name, CATCH);
+    ASSERT_EQ(sym->refcount(), 1) << "symbol should be new";
+    freed[i] = sym;
+  }
+
+  // Let the table remove the dead symbols, which puts them on the free lists.
+  // The service thread may be doing the same, so retry a few times.
+  for (int attempt = 0; attempt < 10; attempt++) {
+    SymbolTable::do_concurrent_work(THREAD);
+    jio_snprintf(name, sizeof(name), "recycle_freed_%06d", count - 1);
+    if (SymbolTable::probe(name, (int)strlen(name)) == NULL) {
+      break;
+    }
+  }
+
+  // New symbols of the same size reuse the freed blocks and are intact.
+  int reused = 0;
+  for (int i = 0; i < count; i++) {
+    jio_snprintf(name, sizeof(name), "recycle_other_%06d", i);
+    TempNewSymbol sym = SymbolTable::new_symbol(name, CATCH);
+    ASSERT_EQ(sym->refcount(), 1) << "symbol should be new";
+    ASSERT_EQ(sym->utf8_length(), (int)strlen(name)) << "wrong length";
+    ASSERT_TRUE(sym->equals(name, (int)strlen(name))) << "wrong contents";
+    for (int j = 0; j < count; j++) {
+      if ((Symbol*)sym == freed[j]) {
+        reused++;
+        break;
+      }
+    }
+  }
+  ASSERT_GT(reused, 0) << "no freed symbol was reused";
+}
+
 // TODO: Make two threads one decrementing the refcount and the other trying to increment.
 // try_increment_refcount should return false
 
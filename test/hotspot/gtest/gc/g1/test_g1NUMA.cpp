@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+#include "precompiled.hpp"
+#include "gc/g1/g1NUMA.hpp"
+#include "gc/g1/heapRegion.hpp"
+#include "unittest.hpp"
+
+// @requires UseG1GC
+TEST_VM(G1NUMA, node_indices_in_range) {
+  if (!UseG1GC) {
+    return;
+  }
+
+  G1NUMA* numa = G1NUMA::numa();
+  ASSERT_TRUE(numa != NULL);
+
+  uint num_nodes = numa->num_active_nodes();
+  EXPECT_GE(num_nodes, 1u);
+  EXPECT_LT(numa->index_of_current_thread(), num_nodes);
+
+  for (uint region_index = 0; region_index < 64; region_index++) {
+    EXPECT_LT(numa->preferred_node_index_for_index(region_index), num_nodes)
+      << "Preferred node index out of range for region " << region_index;
+  }
+}
+
+// @requires UseG1GC
+TEST_VM(G1NUMA, regions_in_same_page_share_node) {
+  if (!UseG1GC) {
+    return;
+  }
+
+  G1NUMA* numa = G1NUMA::numa();
+  size_t page_size = UseLargePages ? os::large_page_size() : os::vm_page_size();
+  if (page_size <= HeapRegion::GrainBytes) {
+    return;
+  }
+
+  uint regions_per_page = (uint)(page_size / HeapRegion::GrainBytes);
+  for (uint page = 0; page < 4; page++) {
+    uint first = page * regions_per_page;
+    for (uint i = 1; i < regions_per_page; i++) {
+      EXPECT_EQ(numa->preferred_node_index_for_index(first),
+                numa->preferred_node_index_for_index(first + i));
+    }
+  }
+}
@@ -23,6 +23,7 @@
 
 #include "precompiled.hpp"
 #include "gc/shared/oopStorage.inline.hpp"
+#include "gc/shared/oopStorageCache.hpp"
 #include "gc/shared/oopStorageParState.inline.hpp"
 #include "gc/shared/workgroup.hpp"
 #include "memory/allocation.inline.hpp"
@@ -414,6 +415,73 @@ TEST_VM_F(OopStorageTest, allocate_many) {
   }
 }
 
+TEST_VM_F(OopStorageTest, bulk_allocate) {
+  static const size_t max_entries = 1000;
+  oop* entries[max_entries];
+
+  AllocationList& allocation_list = TestAccess::allocation_list(_storage);
+
+  size_t allocated = 0;
+  while (allocated < max_entries) {
+    size_t request = MIN2((size_t)7, max_entries - allocated);
+    size_t count = _storage.allocate(entries + allocated, request);
+    ASSERT_NE(0u, count);
+    EXPECT_LE(count, request);
+    for (size_t i = allocated; i < allocated + count; ++i) {
+      ASSERT_TRUE(entries[i] != NULL);
+      EXPECT_TRUE(*entries[i] == NULL);
+      EXPECT_EQ(OopStorage::ALLOCATED_ENTRY, _storage.allocation_status(entries[i]));
+    }
+    // A bulk allocation only takes entries from a single block.
+    const OopBlock* block = OopBlock::block_for_ptr(&_storage, entries[allocated]);
+    EXPECT_EQ(block, OopBlock::block_for_ptr(&_storage, entries[allocated + count - 1]));
+    if (count < request) {
+      EXPECT_TRUE(TestAccess::block_is_full(*block));
+    }
+    allocated += count;
+    EXPECT_EQ(allocated, _storage.allocation_count());
+  }
+  EXPECT_EQ(0u, empty_block_count(_storage));
+
+  _storage.release(entries, max_entries);
+  EXPECT_EQ(0u, _storage.allocation_count());
+  EXPECT_EQ(active_count(_storage), list_length(allocation_list));
+  EXPECT_EQ(active_count(_storage), empty_block_count(_storage));
+}
+
+TEST_VM_F(OopStorageTest, allocation_cache) {
+  static const size_t max_entries = 3 * OopStorageCache::Capacity;
+  oop* entries[max_entries];
+
+  OopStorageCache cache;
+  for (size_t i = 0; i < max_entries; ++i) {
+    entries[i] = cache.allocate(&_storage);
+    ASSERT_TRUE(entries[i] != NULL);
+    EXPECT_EQ(OopStorage::ALLOCATED_ENTRY, _storage.allocation_status(entries[i]));
+    for (size_t j = 0; j < i; ++j) {
+      EXPECT_NE(entries[i], entries[j]);
+    }
+  }
+  // Allocated entries plus those still held by the cache.
+  EXPECT_EQ(max_entries + cache.count(), _storage.allocation_count());
+
+  for (size_t i = 0; i < max_entries; ++i) {
+    cache.release(&_storage, entries[i]);
+    EXPECT_LE(cache.count(), OopStorageCache::Capacity);
+  }
+  EXPECT_EQ(OopStorageCache::Capacity, cache.count());
+  EXPECT_EQ(OopStorageCache::Capacity, _storage.allocation_count());
+
+  // Released entries are reused.
+  oop* reused = cache.allocate(&_storage);
+  EXPECT_EQ(OopStorageCache::Capacity, _storage.allocation_count());
+  cache.release(&_storage, reused);
+
+  cache.flush();
+  EXPECT_EQ(0u, cache.count());
+  EXPECT_EQ(0u, _storage.allocation_count());
+}
+
 TEST_VM_F(OopStorageTestWithAllocation, random_release) {
   static const size_t step = 11;
   ASSERT_NE(0u, _max_entries % step); // max_entries and step are mutually prime
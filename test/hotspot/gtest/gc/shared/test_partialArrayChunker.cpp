@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "gc/shared/partialArrayChunker.hpp"
+#include "unittest.hpp"
+
+class ScopedAdaptiveChunk {
+  bool _orig;
+public:
+  ScopedAdaptiveChunk(bool value) : _orig(AdaptiveParGCArrayScanChunk) { AdaptiveParGCArrayScanChunk = value; }
+  ~ScopedAdaptiveChunk() { AdaptiveParGCArrayScanChunk = _orig; }
+};
+
+TEST_VM(PartialArrayChunker, fixed) {
+  ScopedAdaptiveChunk sac(false);
+  PartialArrayChunker chunker;
+  ASSERT_EQ(ParGCArrayScanChunk, chunker.chunk_size(0));
+  ASSERT_EQ(ParGCArrayScanChunk, chunker.chunk_size(1000));
+}
+
+TEST_VM(PartialArrayChunker, no_idle_workers) {
+  ScopedAdaptiveChunk sac(true);
+  PartialArrayChunker chunker;
+  ASSERT_EQ(0u, chunker.idle_workers());
+  // Nothing else queued: keep the base size.
+  ASSERT_EQ(ParGCArrayScanChunk, chunker.chunk_size(0));
+  // Grows with queue depth, up to MaxScale.
+  ASSERT_EQ(2 * ParGCArrayScanChunk, chunker.chunk_size(1));
+  ASSERT_EQ(4 * ParGCArrayScanChunk, chunker.chunk_size(3));
+  ASSERT_EQ((int)PartialArrayChunker::MaxScale * ParGCArrayScanChunk, chunker.chunk_size(1000));
+}
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "gc/shared/pretouchTask.hpp"
+#include "memory/allocation.hpp"
+#include "runtime/os.hpp"
+#include "utilities/align.hpp"
+#include "unittest.hpp"
+
+TEST_VM(PretouchTask, large_page_stride) {
+  const size_t page_size = os::vm_page_size();
+  const size_t large_page_size = 8 * page_size;
+  const size_t buffer_size = 48 * page_size;
+  char* buffer = NEW_C_HEAP_ARRAY(char, buffer_size + large_page_size, mtTest);
+  char* base = align_up(buffer, large_page_size);
+  memset(base, 1, buffer_size);
+
+  // Unaligned at both ends: pages 3..7 and 32..36 are small, 8..31 are large.
+  PretouchTask::pretouch("Test PreTouch", base + 3 * page_size, base + 37 * page_size,
+                         large_page_size, NULL);
+
+  for (size_t i = 0; i < 48; i++) {
+    bool head = i >= 3 && i < 8;
+    bool large = i >= 8 && i < 32 && (i % 8) == 0;
+    bool tail = i >= 32 && i < 37;
+    char expected = (head || large || tail) ? 0 : 1;
+    EXPECT_EQ(expected, base[i * page_size]) << "page " << i;
+  }
+
+  FREE_C_HEAP_ARRAY(char, buffer);
+}
+
+TEST_VM(PretouchTask, small_pages) {
+  const size_t page_size = os::vm_page_size();
+  char* buffer = NEW_C_HEAP_ARRAY(char, 4 * page_size, mtTest);
+  memset(buffer, 1, 4 * page_size);
+
+  PretouchTask::pretouch("Test PreTouch", buffer, buffer + 4 * page_size, page_size, NULL);
+
+  for (size_t i = 0; i < 4; i++) {
+    EXPECT_EQ(0, buffer[i * page_size]) << "page " << i;
+  }
+
+  FREE_C_HEAP_ARRAY(char, buffer);
+}
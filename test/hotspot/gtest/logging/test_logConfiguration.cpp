@@ -25,6 +25,7 @@
 #include "jvm.h"
 #include "logTestFixture.hpp"
 #include "logTestUtils.inline.hpp"
+#include "logging/log.hpp"
 #include "logging/logConfiguration.hpp"
 #include "logging/logFileStreamOutput.hpp"
 #include "logging/logLevel.hpp"
@@ -459,3 +460,38 @@ TEST_VM_F(LogConfigurationTest, suggest_similar_selection) {
               string_contains_substring(suggestion, "gc")) <<
                   "suggestion must contain AT LEAST one of the tags in user supplied selection";
 }
+
+TEST_VM_F(LogConfigurationTest, throttling) {
+  ResourceMark rm;
+  stringStream ss;
+  LogTagSet& ts = LogTagSetMapping<LOG_TAGS(logging, safepoint)>::tagset();
+  set_log_config(TestLogFileName, "logging+safepoint=debug");
+
+  // Sample one in four debug messages; warnings are never sampled
+  ASSERT_TRUE(LogConfiguration::configure_throttling("logging+safepoint", SIZE_MAX, 4, &ss)) << ss.as_string();
+  EXPECT_EQ((size_t)0, ts.rate_limit());
+  EXPECT_EQ((size_t)4, ts.sample_rate());
+  const size_t suppressed_before = ts.suppressed();
+  for (int i = 0; i < 8; i++) {
+    log_debug(logging, safepoint)("sampled message %d", i);
+  }
+  log_warning(logging, safepoint)("warning is not sampled");
+  EXPECT_EQ(suppressed_before + 6, ts.suppressed());
+  EXPECT_TRUE(file_contains_substring(TestLogFileName, "warning is not sampled"));
+  EXPECT_TRUE(is_described("Log rate limits:"));
+  EXPECT_TRUE(is_described("logging+safepoint: 1 in 4 sampled"));
+
+  // A rate limit is applied on top of sampling and leaves the sample rate unchanged
+  ASSERT_TRUE(LogConfiguration::configure_throttling("logging+safepoint", 1000, SIZE_MAX, &ss)) << ss.as_string();
+  EXPECT_EQ((size_t)1000, ts.rate_limit());
+  EXPECT_EQ((size_t)4, ts.sample_rate());
+
+  // Remove both limits again
+  ASSERT_TRUE(LogConfiguration::configure_throttling("logging+safepoint", 0, 0, &ss)) << ss.as_string();
+  EXPECT_EQ((size_t)0, ts.rate_limit());
+  EXPECT_EQ((size_t)0, ts.sample_rate());
+
+  // A selection is required, and must match some tag set
+  EXPECT_FALSE(LogConfiguration::configure_throttling("", 10, SIZE_MAX, &ss));
+  EXPECT_FALSE(LogConfiguration::configure_throttling("logging+safepoint+gc+heap+ergo", 10, SIZE_MAX, &ss));
+}
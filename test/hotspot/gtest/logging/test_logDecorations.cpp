@@ -224,3 +224,22 @@ TEST(LogDecorations, identifiers) {
     EXPECT_EQ(ids[i].expected, strtol(reported, NULL, 10));
   }
 }
+
+TEST_VM(LogDecorations, copy) {
+  LogDecorations decorations(LogLevel::Info, tagset, default_decorators);
+  LogDecorations copy(decorations);
+  for (uint i = 0; i < LogDecorators::Count; i++) {
+    LogDecorators::Decorator decorator = static_cast<LogDecorators::Decorator>(i);
+    const char* original = decorations.decoration(decorator);
+    const char* copied = copy.decoration(decorator);
+    if (original == NULL) {
+      EXPECT_TRUE(copied == NULL);
+    } else {
+      EXPECT_STREQ(original, copied);
+      // The copy must not refer to the original's buffer
+      if (decorator != LogDecorators::level_decorator) {
+        EXPECT_NE(original, copied);
+      }
+    }
+  }
+}
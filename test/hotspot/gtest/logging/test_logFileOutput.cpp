@@ -24,7 +24,9 @@
 #include "precompiled.hpp"
 #include "jvm.h"
 #include "logTestUtils.inline.hpp"
+#include "logging/logDecorations.hpp"
 #include "logging/logFileOutput.hpp"
+#include "logging/logTagSet.hpp"
 #include "memory/resourceArea.hpp"
 #include "runtime/os.hpp"
 #include "unittest.hpp"
@@ -41,7 +43,9 @@ TEST_VM(LogFileOutput, parse_valid) {
     "filesize=256,filecount=11",
     "filesize=0", "filecount=1",
     "filesize=1m", "filesize=1M",
-    "filesize=1k", "filesize=1G"
+    "filesize=1k", "filesize=1G",
+    "format=text", "format=binary",
+    "filecount=2,format=binary"
   };
 
   // Override LogOutput's vm_start time to get predictable file name
@@ -80,7 +84,8 @@ TEST_VM(LogFileOutput, parse_invalid) {
     "filecount=ab", "filesize=0xz",
     "filecount=1MB", "filesize=99bytes",
     "filesize=9999999999999999999999999",
-    "filecount=9999999999999999999999999"
+    "filecount=9999999999999999999999999",
+    "format=", "format=bin", "format=BINARY"
   };
 
   for (size_t i = 0; i < ARRAY_SIZE(invalid_options); i++) {
@@ -104,6 +109,50 @@ TEST_VM(LogFileOutput, filesize_overflow) {
   EXPECT_FALSE(fo.initialize(buf, &ss)) << "Accepted filesize that overflows";
 }
 
+TEST_VM(LogFileOutput, binary_format) {
+  const char* filename = "binary-format-test";
+  const char* message = "binary log message";
+  char output_name[256];
+  int ret = jio_snprintf(output_name, sizeof(output_name), "file=%s", filename);
+  ASSERT_NE(-1, ret);
+  delete_file(filename);
+
+  {
+    ResourceMark rm;
+    stringStream ss;
+    LogFileOutput fo(output_name);
+    ASSERT_TRUE(fo.initialize("filecount=0,format=binary", &ss)) << ss.as_string();
+    EXPECT_FALSE(fo.writes_decorations());
+    const LogTagSet& tagset = LogTagSetMapping<LOG_TAGS(logging)>::tagset();
+    LogDecorations decorations(LogLevel::Info, tagset, LogDecorators::None);
+    fo.write(decorations, message);
+    fo.write(decorations, message);
+  }
+
+  FILE* fp = fopen(filename, "rb");
+  ASSERT_TRUE(fp != NULL);
+  char buf[1 * K];
+  size_t len = fread(buf, 1, sizeof(buf), fp);
+  fclose(fp);
+  delete_file(filename);
+
+  ASSERT_GT(len, (size_t)8);
+  EXPECT_EQ(0, memcmp(buf, "HSLOGBIN", 8));
+  // The tagset label is written once, the message text once per record
+  size_t labels = 0;
+  size_t messages = 0;
+  for (size_t i = 0; i < len; i++) {
+    if (i + strlen("logging") <= len && memcmp(buf + i, "logging", strlen("logging")) == 0) {
+      labels++;
+    }
+    if (i + strlen(message) <= len && memcmp(buf + i, message, strlen(message)) == 0) {
+      messages++;
+    }
+  }
+  EXPECT_EQ((size_t)1, labels);
+  EXPECT_EQ((size_t)2, messages);
+}
+
 TEST_VM(LogFileOutput, startup_rotation) {
   const size_t rotations = 5;
   const char* filename = "start-rotate-test";
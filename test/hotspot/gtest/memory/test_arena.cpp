@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "memory/arena.hpp"
+#include "unittest.hpp"
+
+TEST_VM(Arena, big_chunks_use_size_classes) {
+  Arena ar(mtTest, Chunk::tiny_size);
+  size_t initial = ar.size_in_bytes();
+
+  // Just above the default chunk size: rounded up to the first big size class
+  void* p = ar.Amalloc(Chunk::size + 8);
+  ASSERT_TRUE(p != NULL);
+  ASSERT_EQ(initial + Chunk::big_size(0), ar.size_in_bytes());
+
+  // Between the first and the second size class
+  p = ar.Amalloc(Chunk::big_size(0) + 8);
+  ASSERT_TRUE(p != NULL);
+  ASSERT_EQ(initial + Chunk::big_size(0) + Chunk::big_size(1), ar.size_in_bytes());
+
+  // Bigger than all size classes: exactly as requested
+  size_t huge = Chunk::big_size(Chunk::num_big_sizes - 1) + 8;
+  p = ar.Amalloc(huge);
+  ASSERT_TRUE(p != NULL);
+  ASSERT_EQ(initial + Chunk::big_size(0) + Chunk::big_size(1) + huge, ar.size_in_bytes());
+}
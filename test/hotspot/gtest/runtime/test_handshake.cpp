@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "runtime/handshake.hpp"
+#include "runtime/interfaceSupport.inline.hpp"
+#include "runtime/thread.hpp"
+#include "unittest.hpp"
+
+class AsyncHandshakeTestClosure : public AsyncHandshakeClosure {
+  int* const _order;
+  int* const _executed;
+  const int _index;
+ public:
+  AsyncHandshakeTestClosure(int* order, int* executed, int index) :
+    AsyncHandshakeClosure("AsyncHandshakeTest"), _order(order), _executed(executed), _index(index) {}
+
+  void do_thread(JavaThread* thread) {
+    _order[(*_executed)++] = _index;
+  }
+};
+
+TEST_VM(Handshake, execute_async_self) {
+  if (!ThreadLocalHandshakes) {
+    return;
+  }
+
+  JavaThread* thread = JavaThread::current();
+  int order[3] = { -1, -1, -1 };
+  int executed = 0;
+
+  for (int i = 0; i < 3; i++) {
+    ASSERT_TRUE(Handshake::execute_async(new AsyncHandshakeTestClosure(order, &executed, i), thread));
+  }
+  ASSERT_TRUE(thread->has_async_handshake());
+  ASSERT_EQ(0, executed) << "Must not be executed before the thread polls";
+
+  {
+    // The transition out of native processes the queued operations
+    ThreadInVMfromNative invm(thread);
+  }
+
+  ASSERT_FALSE(thread->has_async_handshake());
+  ASSERT_EQ(3, executed);
+  for (int i = 0; i < 3; i++) {
+    ASSERT_EQ(i, order[i]) << "Must be executed in the order queued";
+  }
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/**
+ * @test
+ * @summary C1 code allocated with the fast LinearScan mode computes the
+ *          same results as the interpreter
+ * @requires vm.compiler1.enabled
+ *
+ * @run main/othervm -XX:TieredStopAtLevel=1 -Xbatch -XX:C1FastLinearScanLimit=0
+ *                   -XX:CompileCommand=dontinline,compiler.c1.TestFastLinearScan::callee
+ *                   compiler.c1.TestFastLinearScan
+ * @run main/othervm -XX:TieredStopAtLevel=3 -Xbatch -XX:C1FastLinearScanLimit=0
+ *                   compiler.c1.TestFastLinearScan
+ */
+
+package compiler.c1;
+
+public class TestFastLinearScan {
+    static long callee(long x) {
+        return x * 31 + 7;
+    }
+
+    // Keeps more values live across loops and calls than there are
+    // registers, so intervals are split and spilled in several places.
+    static long test(int n, long seed) {
+        long a = seed, b = seed + 1, c = seed + 2, d = seed + 3;
+        long e = seed + 4, f = seed + 5, g = seed + 6, h = seed + 7;
+        int i1 = n, i2 = n * 3, i3 = n ^ 0x55;
+        double x = seed * 0.5, y = seed * 0.25;
+        for (int i = 0; i < n; i++) {
+            a += b ^ i;
+            b = callee(b) - c;
+            if ((i & 3) == 0) {
+                c += d * e;
+                x += y * i;
+            } else {
+                d -= f + i1;
+                y -= x / (i + 1);
+            }
+            for (int j = 0; j < (i & 7); j++) {
+                e ^= g + j;
+                f += callee(h + i2);
+                i2 += j;
+            }
+            g = (g << 1) | (h >>> 63);
+            h = callee(h) + a;
+            i3 = i3 * 17 + (int) a;
+        }
+        return a + b + c + d + e + f + g + h + i1 + i2 + i3 +
+               (long) x + Double.doubleToLongBits(y);
+    }
+
+    public static void main(String[] args) {
+        long[] expected = new long[16];
+        for (int k = 0; k < expected.length; k++) {
+            expected[k] = test(100 + k, k);
+        }
+        for (int iter = 0; iter < 20_000; iter++) {
+            int k = iter % expected.length;
+            long result = test(100 + k, k);
+            if (result != expected[k]) {
+                throw new RuntimeException("iteration " + iter + ": " + result + " != " + expected[k]);
+            }
+        }
+    }
+}
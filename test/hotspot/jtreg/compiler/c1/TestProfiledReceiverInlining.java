@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+/**
+ * @test
+ * @summary Profiled receiver inlining in C1 profiling code deoptimizes
+ *          once a second receiver shows up, and is not done again after
+ * @requires vm.compiler1.enabled
+ * @library /test/lib /
+ *
+ * @build sun.hotspot.WhiteBox
+ * @run driver ClassFileInstaller sun.hotspot.WhiteBox
+ *                                sun.hotspot.WhiteBox$WhiteBoxPermission
+ * @run main/othervm -Xbootclasspath/a:. -XX:+UnlockDiagnosticVMOptions -XX:+WhiteBoxAPI
+ *                   -XX:-BackgroundCompilation -XX:-UseOnStackReplacement
+ *                   -XX:TieredStopAtLevel=3 -XX:Tier0ProfilingStartPercentage=0
+ *                   -XX:+C1InlineProfiledReceiver
+ *                   compiler.c1.TestProfiledReceiverInlining
+ */
+
+package compiler.c1;
+
+import java.lang.reflect.Method;
+import java.util.function.IntUnaryOperator;
+
+import sun.hotspot.WhiteBox;
+
+public class TestProfiledReceiverInlining {
+    private static final WhiteBox WB = WhiteBox.getWhiteBox();
+    private static final int LEVEL_FULL_PROFILE = 3;
+
+    interface Shape {
+        int area(int x);
+    }
+
+    static class Square implements Shape {
+        public int area(int x) { return x * x; }
+    }
+
+    static class Twice implements Shape {
+        public int area(int x) { return x + x; }
+    }
+
+    static abstract class Base {
+        abstract int value(int x);
+    }
+
+    static class One extends Base {
+        int value(int x) { return x + 1; }
+    }
+
+    static class Two extends Base {
+        int value(int x) { return x - 2; }
+    }
+
+    static int testInterface(Shape s, int x) {
+        return s.area(x) + 3;
+    }
+
+    static int testVirtual(Base b, int x) {
+        return b.value(x) * 5;
+    }
+
+    static void compile(Method m) {
+        if (WB.getMethodCompilationLevel(m) != LEVEL_FULL_PROFILE) {
+            WB.enqueueMethodForCompilation(m, LEVEL_FULL_PROFILE);
+        }
+        if (!WB.isMethodCompiled(m) || WB.getMethodCompilationLevel(m) != LEVEL_FULL_PROFILE) {
+            throw new RuntimeException(m.getName() + " is not compiled at level 3");
+        }
+    }
+
+    // first and second call the tested method with one of two receiver
+    // classes, and check the result.
+    static void test(Method m, IntUnaryOperator first, IntUnaryOperator second) {
+        // Monomorphic profile: the call is inlined behind a guard.
+        for (int i = 0; i < 10_000; i++) {
+            first.applyAsInt(i & 0xff);
+        }
+        compile(m);
+        first.applyAsInt(42);
+        if (!WB.isMethodCompiled(m)) {
+            throw new RuntimeException(m.getName() + " deoptimized for the profiled receiver");
+        }
+
+        // The second receiver class fails the guard and invalidates the code.
+        second.applyAsInt(42);
+        if (WB.isMethodCompiled(m)) {
+            throw new RuntimeException(m.getName() + " has no profiled receiver guard");
+        }
+
+        // The trap is recorded, so the recompiled call stays virtual and
+        // handles both receivers.
+        for (int i = 0; i < 10_000; i++) {
+            first.applyAsInt(i & 0xff);
+            second.applyAsInt(i & 0xff);
+        }
+        WB.deoptimizeMethod(m);
+        compile(m);
+        first.applyAsInt(42);
+        second.applyAsInt(42);
+        if (!WB.isMethodCompiled(m)) {
+            throw new RuntimeException(m.getName() + " guarded the profiled receiver again");
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        Shape square = new Square();
+        Shape twice = new Twice();
+        test(TestProfiledReceiverInlining.class.getDeclaredMethod("testInterface", Shape.class, int.class),
+             x -> check(testInterface(square, x), x * x + 3),
+             x -> check(testInterface(twice, x), x + x + 3));
+
+        Base one = new One();
+        Base two = new Two();
+        test(TestProfiledReceiverInlining.class.getDeclaredMethod("testVirtual", Base.class, int.class),
+             x -> check(testVirtual(one, x), (x + 1) * 5),
+             x -> check(testVirtual(two, x), (x - 2) * 5));
+    }
+
+    static int check(int actual, int expected) {
+        if (actual != expected) {
+            throw new RuntimeException("expected " + expected + " but got " + actual);
+        }
+        return actual;
+    }
+}
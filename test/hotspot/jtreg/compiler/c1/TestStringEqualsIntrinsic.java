@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+/**
+ * @test
+ * @summary C1 lowering of String.equals to the vectorizedMismatch stub
+ * @requires vm.compiler1.enabled
+ * @requires os.arch == "amd64" | os.arch == "x86_64"
+ *
+ * @run main/othervm -XX:TieredStopAtLevel=1 -Xbatch
+ *                   -XX:CompileCommand=compileonly,compiler.c1.TestStringEqualsIntrinsic::test
+ *                   compiler.c1.TestStringEqualsIntrinsic
+ * @run main/othervm -XX:TieredStopAtLevel=1 -Xbatch -XX:-CompactStrings
+ *                   -XX:CompileCommand=compileonly,compiler.c1.TestStringEqualsIntrinsic::test
+ *                   compiler.c1.TestStringEqualsIntrinsic
+ */
+
+package compiler.c1;
+
+public class TestStringEqualsIntrinsic {
+    static boolean test(String a, String b) {
+        return a.equals(b);
+    }
+
+    static String make(char base, int len, int diffAt) {
+        StringBuilder sb = new StringBuilder(len);
+        for (int i = 0; i < len; i++) {
+            sb.append(i == diffAt ? (char) (base + 1) : (char) (base + (i % 7)));
+        }
+        return sb.toString();
+    }
+
+    public static void main(String[] args) {
+        char[] bases = { 'a', 'Ѐ' };
+        for (int iter = 0; iter < 200; iter++) {
+            for (char base : bases) {
+                for (int len = 0; len < 80; len++) {
+                    String s = make(base, len, -1);
+                    check(test(s, make(base, len, -1)), true);
+                    check(test(s, make(base, len + 1, -1)), false);
+                    for (int d = 0; d < len; d++) {
+                        check(test(s, make(base, len, d)), false);
+                    }
+                }
+            }
+            check(test("abc", "Ѐbc"), false);
+            check(test("abc", null), false);
+        }
+    }
+
+    static void check(boolean actual, boolean expected) {
+        if (actual != expected) {
+            throw new RuntimeException("expected " + expected + " but got " + actual);
+        }
+    }
+}
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+/**
+ * @test
+ * @summary Megamorphic call sites inlined as a chain of receiver type checks
+ *          must inline the most frequent receivers and dispatch to the right
+ *          method, including for unprofiled receivers
+ * @requires vm.compiler2.enabled
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *
+ * @run driver compiler.calls.TestPolymorphicInlining
+ */
+
+package compiler.calls;
+
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestPolymorphicInlining {
+    static OutputAnalyzer run(String... flags) throws Exception {
+        List<String> opts = new ArrayList<>();
+        opts.add("-XX:-TieredCompilation");
+        opts.add("-XX:+UnlockDiagnosticVMOptions");
+        opts.add("-XX:+PrintInlining");
+        opts.add("-XX:CompileCommand=quiet");
+        opts.add("-XX:CompileCommand=compileonly," + Workload.class.getName() + "::test");
+        opts.addAll(Arrays.asList(flags));
+        opts.add(Workload.class.getName());
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(opts.toArray(new String[0]));
+        OutputAnalyzer out = new OutputAnalyzer(pb.start());
+        out.shouldHaveExitValue(0);
+        return out;
+    }
+
+    static String inlined(String receiver) {
+        return "\\$" + receiver + "::area \\(\\d+ bytes\\)\\s+inline";
+    }
+
+    public static void main(String[] args) throws Exception {
+        // A, B and C cover 95% of the calls, enough for the default
+        // TypeProfilePolymorphicPercent of 90. UsePolymorphicInlining sets
+        // TypeProfileWidth to 4.
+        OutputAnalyzer out = run("-XX:+UsePolymorphicInlining");
+        out.shouldMatch(inlined("A"));
+        out.shouldMatch(inlined("B"));
+        out.shouldMatch(inlined("C"));
+        out.shouldNotMatch(inlined("D"));
+
+        // All four profiled receivers are needed to cover 99% of the calls.
+        out = run("-XX:+UsePolymorphicInlining", "-XX:TypeProfileWidth=8",
+                  "-XX:TypeProfilePolymorphicPercent=99");
+        out.shouldMatch(inlined("A"));
+        out.shouldMatch(inlined("B"));
+        out.shouldMatch(inlined("C"));
+        out.shouldMatch(inlined("D"));
+
+        // Without polymorphic inlining the call site stays virtual.
+        out = run("-XX:-UsePolymorphicInlining", "-XX:TypeProfileWidth=4");
+        out.shouldNotMatch(inlined("A"));
+    }
+
+    public static class Workload {
+        private static final int ITERATIONS = 100_000;
+
+        static abstract class Shape {
+            abstract int area(int x);
+        }
+
+        static class A extends Shape {
+            int area(int x) { return x + 1; }
+        }
+
+        static class B extends Shape {
+            int area(int x) { return x * 2; }
+        }
+
+        static class C extends Shape {
+            int area(int x) { return x - 3; }
+        }
+
+        static class D extends Shape {
+            int area(int x) { return x ^ 0x55; }
+        }
+
+        static class E extends Shape {
+            int area(int x) { return -x; }
+        }
+
+        static int test(Shape s, int x) {
+            return s.area(x);
+        }
+
+        static int expected(int kind, int x) {
+            switch (kind) {
+                case 0: return x + 1;
+                case 1: return x * 2;
+                case 2: return x - 3;
+                case 3: return x ^ 0x55;
+                default: return -x;
+            }
+        }
+
+        public static void main(String[] args) {
+            Shape[] shapes = { new A(), new B(), new C(), new D(), new E() };
+            // Warm up with four receivers seen 50%, 30%, 15% and 5% of the time.
+            for (int i = 0; i < ITERATIONS; i++) {
+                int kind = (i % 20 < 10) ? 0 : (i % 20 < 16) ? 1 : (i % 20 < 19) ? 2 : 3;
+                int res = test(shapes[kind], i);
+                if (res != expected(kind, i)) {
+                    throw new RuntimeException("wrong result for kind " + kind + ": " + res);
+                }
+            }
+            // Now also call with a receiver that was never profiled.
+            for (int i = 0; i < ITERATIONS; i++) {
+                int kind = i % shapes.length;
+                int res = test(shapes[kind], i);
+                if (res != expected(kind, i)) {
+                    throw new RuntimeException("wrong result for kind " + kind + ": " + res);
+                }
+            }
+        }
+    }
+}
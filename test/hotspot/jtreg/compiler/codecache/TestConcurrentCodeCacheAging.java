@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+/**
+ * @test
+ * @summary ConcurrentCodeCacheAging keeps the sweeper flushing a small code
+ *          cache while compiled code runs
+ * @requires vm.compMode != "Xint"
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *
+ * @run driver compiler.codecache.TestConcurrentCodeCacheAging
+ */
+
+package compiler.codecache;
+
+import java.lang.invoke.MethodHandle;
+import java.lang.invoke.MethodHandles;
+import java.lang.invoke.MethodType;
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestConcurrentCodeCacheAging {
+    public static class Workload {
+        static int work(int x) {
+            return x * 31 + (x >>> 3);
+        }
+
+        public static void main(String[] args) throws Throwable {
+            MethodType type = MethodType.methodType(int.class, int.class);
+            MethodHandle work = MethodHandles.lookup().findStatic(Workload.class, "work", type);
+            long sum = 0;
+            long end = System.currentTimeMillis() + 3_000;
+            // Lambda forms and their compiled code fill the small code cache
+            for (int n = 0; System.currentTimeMillis() < end; n++) {
+                MethodHandle mh = MethodHandles.dropArguments(work, 1, new Class<?>[n % 50 + 1]);
+                sum += mh.hashCode() + work(n);
+            }
+            System.out.println("sum " + sum);
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+            "-XX:ReservedCodeCacheSize=16m",
+            "-XX:+UseCodeCacheFlushing",
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:+ConcurrentCodeCacheAging",
+            "-XX:CodeCacheAgingInterval=10",
+            "-XX:+UnlockDiagnosticVMOptions",
+            "-XX:+PrintMethodFlushingStatistics",
+            "-Xlog:codecache+sweep=debug",
+            "-XX:+PrintFlagsFinal",
+            Workload.class.getName());
+        OutputAnalyzer out = new OutputAnalyzer(pb.start());
+        out.shouldHaveExitValue(0);
+        out.shouldContain("sum ");
+        out.shouldMatch("ConcurrentCodeCacheAging +:?= true");
+        if (!out.getOutput().matches("(?s).*ThreadLocalHandshakes +:?= true.*")) {
+            // No thread-local handshakes on this platform
+            return;
+        }
+
+        // The workload notifies the sweeper all the time, aging must still
+        // happen about every 10 ms of the 3 s run.
+        Matcher m = Pattern.compile("Reset hotness counters of active nmethods").matcher(out.getOutput());
+        int agings = 0;
+        while (m.find()) {
+            agings++;
+        }
+        if (agings < 10) {
+            throw new RuntimeException("Only " + agings + " concurrent agings");
+        }
+
+        m = Pattern.compile("Total number of flushed methods: *([0-9]+)").matcher(out.getOutput());
+        if (!m.find()) {
+            throw new RuntimeException("No sweeper statistics");
+        }
+        if (Long.parseLong(m.group(1)) == 0) {
+            throw new RuntimeException("No methods were flushed");
+        }
+    }
+}
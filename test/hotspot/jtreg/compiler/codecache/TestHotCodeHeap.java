@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+/**
+ * @test
+ * @summary HotCodeHeapSize adds a hot nmethod code heap on top of the
+ *          non-profiled code heap and the sweeper moves hot code into it
+ * @requires vm.compiler2.enabled & vm.compMode != "Xint"
+ * @library /testlibrary /test/lib
+ * @modules java.base/jdk.internal.misc
+ * @build compiler.codecache.TestHotCodeHeap sun.hotspot.WhiteBox
+ * @run driver ClassFileInstaller sun.hotspot.WhiteBox
+ *                              sun.hotspot.WhiteBox$WhiteBoxPermission
+ * @run driver compiler.codecache.TestHotCodeHeap
+ */
+
+package compiler.codecache;
+
+import java.lang.reflect.Method;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+import sun.hotspot.WhiteBox;
+import sun.hotspot.code.NMethod;
+
+public class TestHotCodeHeap {
+    public static class Workload {
+        static volatile long sink;
+
+        // Runs long enough per call to be found on the stack by most scans
+        static long work(int n) {
+            long sum = 0;
+            for (int i = 0; i < n; i++) {
+                sum += i * 31 + (i >>> 3);
+            }
+            return sum;
+        }
+
+        public static void main(String[] args) throws Exception {
+            WhiteBox wb = WhiteBox.getWhiteBox();
+            Method work = Workload.class.getDeclaredMethod("work", int.class);
+            Thread worker = new Thread(() -> {
+                while (true) {
+                    sink += work(1_000_000);
+                }
+            });
+            worker.setDaemon(true);
+            worker.start();
+
+            // The safepoint of each GC resets the hotness counters of the
+            // nmethods on the stacks, the forced sweep then looks at them.
+            // Stop once work() was recompiled after its first C2 compile.
+            int firstId = -1;
+            long end = System.currentTimeMillis() + 60_000;
+            while (System.currentTimeMillis() < end) {
+                System.gc();
+                wb.forceNMethodSweep();
+                NMethod nm = NMethod.get(work, false);
+                if (nm != null && nm.comp_level == 4) {
+                    if (firstId == -1) {
+                        firstId = nm.compile_id;
+                    } else if (nm.compile_id != firstId) {
+                        break;
+                    }
+                }
+                Thread.sleep(10);
+            }
+            System.out.println("sink " + sink);
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+            "-Xbootclasspath/a:.",
+            "-XX:+UnlockDiagnosticVMOptions",
+            "-XX:+WhiteBoxAPI",
+            "-XX:-TieredCompilation",
+            "-XX:+SegmentedCodeCache",
+            "-XX:ReservedCodeCacheSize=64m",
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:HotCodeHeapSize=8m",
+            "-XX:HotCodeMinSweeps=2",
+            "-XX:-UseCodeCacheFlushing",
+            "-Xlog:codecache=debug,codecache+sweep=debug",
+            "-XX:+PrintCodeCache",
+            Workload.class.getName());
+        OutputAnalyzer out = new OutputAnalyzer(pb.start());
+        out.shouldHaveExitValue(0);
+        out.shouldContain("CodeHeap 'hot nmethods'");
+        out.shouldContain("made not entrant for recompilation into the hot code heap");
+        out.shouldContain("allocated in the hot code heap");
+    }
+}
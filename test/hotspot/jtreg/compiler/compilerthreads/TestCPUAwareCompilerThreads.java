@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+/**
+ * @test
+ * @summary UseCPUAwareCompilerThreads limits each compiler to half of the
+ *          available processors and adds threads while tasks wait
+ * @requires vm.compMode != "Xint" & vm.flavor == "server"
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *
+ * @run driver compiler.compilerthreads.TestCPUAwareCompilerThreads
+ */
+
+package compiler.compilerthreads;
+
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
+import java.util.stream.Collectors;
+import java.util.stream.IntStream;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestCPUAwareCompilerThreads {
+    public static class Workload {
+        static volatile long sink;
+
+        public static void main(String[] args) throws Exception {
+            // Many threads running a variety of library code fill the
+            // compile queues with the low thresholds below.
+            Thread[] threads = new Thread[8];
+            for (int t = 0; t < threads.length; t++) {
+                final int seed = t;
+                threads[t] = new Thread(() -> {
+                    long end = System.currentTimeMillis() + 3_000;
+                    for (int i = seed; System.currentTimeMillis() < end; i++) {
+                        String s = String.format("%d-%x-%s", i, i * 31, Integer.toOctalString(i));
+                        sink += s.split("-").length + (s.matches("[0-9a-f-]+") ? 1 : 0);
+                        sink += IntStream.range(0, 50).mapToObj(Integer::toString)
+                                         .collect(Collectors.joining(",")).length();
+                        sink += Arrays.asList(s.toUpperCase(), s.toLowerCase(), s.trim()).hashCode();
+                    }
+                });
+                threads[t].start();
+            }
+            for (Thread t : threads) {
+                t.join();
+            }
+            System.out.println("sink " + sink);
+        }
+    }
+
+    static OutputAnalyzer run(int processors, String... flags) throws Exception {
+        List<String> opts = new ArrayList<>();
+        opts.add("-XX:ActiveProcessorCount=" + processors);
+        opts.add("-XX:CICompilerCount=8");
+        opts.add("-XX:+UseDynamicNumberOfCompilerThreads");
+        opts.add("-XX:Tier3InvocationThreshold=20");
+        opts.add("-XX:Tier3CompileThreshold=50");
+        opts.add("-XX:Tier4InvocationThreshold=100");
+        opts.add("-XX:Tier4CompileThreshold=150");
+        opts.add("-XX:+UnlockExperimentalVMOptions");
+        opts.add("-XX:+UseCPUAwareCompilerThreads");
+        opts.add("-XX:+UnlockDiagnosticVMOptions");
+        opts.add("-XX:+TraceCompilerThreads");
+        opts.addAll(Arrays.asList(flags));
+        opts.add(Workload.class.getName());
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(opts.toArray(new String[0]));
+        OutputAnalyzer out = new OutputAnalyzer(pb.start());
+        out.shouldHaveExitValue(0);
+        return out;
+    }
+
+    public static void main(String[] args) throws Exception {
+        // With two processors, each compiler keeps its single thread even
+        // though the queues ask for more.
+        OutputAnalyzer out = run(2, "-XX:CompilerThreadQueueWaitTarget=0");
+        out.shouldMatch("thread limit: 1 of [0-9]+ requested");
+        out.shouldNotContain("Added compiler thread");
+
+        // With eight processors and no wait target, a thread is added unless
+        // the load of the machine running the test suppresses it.
+        out = run(8, "-XX:CompilerThreadQueueWaitTarget=0");
+        if (!out.getStdout().contains("suppressed by system load")) {
+            out.shouldContain("Added compiler thread");
+        }
+
+        // An unreachable wait target never adds a thread.
+        out = run(8, "-XX:CompilerThreadQueueWaitTarget=1000000");
+        out.shouldMatch("thread limit: [0-9]+ of [0-9]+ requested");
+        out.shouldNotContain("Added compiler thread");
+    }
+}
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/**
+ * @test
+ * @summary Field loads split through merges of allocations must see the
+ *          right values, and the merged allocations must be eliminated
+ * @requires vm.compiler2.enabled
+ * @library /test/lib /
+ * @modules java.management
+ *
+ * @build sun.hotspot.WhiteBox
+ * @run driver ClassFileInstaller sun.hotspot.WhiteBox
+ *                                sun.hotspot.WhiteBox$WhiteBoxPermission
+ * @run main/othervm -Xbootclasspath/a:. -XX:+UnlockDiagnosticVMOptions -XX:+WhiteBoxAPI
+ *                   -XX:-TieredCompilation -XX:-BackgroundCompilation -XX:-UseTLAB
+ *                   -XX:+UnlockExperimentalVMOptions -XX:+ReduceAllocationMerges
+ *                   -XX:CompileCommand=dontinline,compiler.escapeAnalysis.TestAllocationMerges::test*
+ *                   compiler.escapeAnalysis.TestAllocationMerges true
+ * @run main/othervm -Xbootclasspath/a:. -XX:+UnlockDiagnosticVMOptions -XX:+WhiteBoxAPI
+ *                   -XX:-TieredCompilation -XX:-BackgroundCompilation -XX:-UseTLAB
+ *                   -XX:+UnlockExperimentalVMOptions -XX:-ReduceAllocationMerges
+ *                   -XX:CompileCommand=dontinline,compiler.escapeAnalysis.TestAllocationMerges::test*
+ *                   compiler.escapeAnalysis.TestAllocationMerges false
+ */
+
+package compiler.escapeAnalysis;
+
+import java.lang.management.ManagementFactory;
+import java.lang.reflect.Method;
+
+import sun.hotspot.WhiteBox;
+
+public class TestAllocationMerges {
+    private static final WhiteBox WB = WhiteBox.getWhiteBox();
+    private static final int ITERATIONS = 100_000;
+
+    static class Point {
+        int x;
+        long y;
+
+        Point(int x, long y) {
+            this.x = x;
+            this.y = y;
+        }
+    }
+
+    static long testMerge(boolean cond, int a, int b) {
+        Point p = cond ? new Point(a, b) : new Point(b, a);
+        return p.x * 31L + p.y;
+    }
+
+    static long testMergeWithNull(boolean cond, int a, int b) {
+        Point p = cond ? new Point(a, b) : null;
+        if (p == null) {
+            return -1;
+        }
+        return p.x * 31L + p.y;
+    }
+
+    static long testMergeWithStore(boolean cond, int a, int b) {
+        Point p = cond ? new Point(a, b) : new Point(b, a);
+        if (cond) {
+            p.x += 1;
+        }
+        return p.x * 31L + p.y;
+    }
+
+    static void check(long res, long expected, String name, int i) {
+        if (res != expected) {
+            throw new RuntimeException(name + ": wrong result " + res + " for " + i + ", expected " + expected);
+        }
+    }
+
+    static long allocatedBytes() {
+        com.sun.management.ThreadMXBean bean =
+            (com.sun.management.ThreadMXBean) ManagementFactory.getThreadMXBean();
+        return bean.getThreadAllocatedBytes(Thread.currentThread().getId());
+    }
+
+    // Bytes allocated by ITERATIONS calls of the compiled testMerge and
+    // testMergeWithNull, which each allocate one Point unless reduced.
+    static long allocatedByMerges() throws Exception {
+        for (String name : new String[] { "testMerge", "testMergeWithNull" }) {
+            Method m = TestAllocationMerges.class.getDeclaredMethod(name, boolean.class, int.class, int.class);
+            if (!WB.isMethodCompiled(m)) {
+                WB.enqueueMethodForCompilation(m, 4);
+            }
+            if (!WB.isMethodCompiled(m)) {
+                throw new RuntimeException(name + " is not compiled");
+            }
+        }
+        long sum = 0;
+        long before = allocatedBytes();
+        for (int i = 0; i < ITERATIONS; i++) {
+            sum += testMerge((i & 1) == 0, i, 7);
+            sum += testMergeWithNull(true, i, 7);
+        }
+        long allocated = allocatedBytes() - before;
+        System.out.println("Allocated " + allocated + " bytes, sum " + sum);
+        return allocated;
+    }
+
+    public static void main(String[] args) throws Exception {
+        boolean reduced = Boolean.parseBoolean(args[0]);
+        for (int i = 0; i < ITERATIONS; i++) {
+            boolean cond = (i % 3) == 0;
+            int a = i;
+            int b = i >> 1;
+            check(testMerge(cond, a, b), cond ? a * 31L + b : b * 31L + a, "testMerge", i);
+            check(testMergeWithNull(cond, a, b), cond ? a * 31L + b : -1, "testMergeWithNull", i);
+            check(testMergeWithStore(cond, a, b), cond ? (a + 1) * 31L + b : b * 31L + a, "testMergeWithStore", i);
+        }
+
+        // Without the reduction, each call allocates a Point of at least
+        // 16 bytes. With it, only the measurement itself allocates.
+        long allocated = allocatedByMerges();
+        long unreduced = 2L * ITERATIONS * 16;
+        if (reduced && allocated >= unreduced / 10) {
+            throw new RuntimeException("Merged allocations not eliminated: " + allocated + " bytes allocated");
+        }
+        if (!reduced && allocated < unreduced) {
+            throw new RuntimeException("Expected at least " + unreduced + " bytes allocated, got " + allocated);
+        }
+    }
+}
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/**
+ * @test
+ * @summary Objects materialized by the rare escape trap must hold the right
+ *          field values, and the trap must fire with its own reason
+ * @requires vm.compiler2.enabled
+ * @library /test/lib /
+ * @modules jdk.jfr
+ *
+ * @build sun.hotspot.WhiteBox
+ * @run driver ClassFileInstaller sun.hotspot.WhiteBox
+ *                                sun.hotspot.WhiteBox$WhiteBoxPermission
+ * @run main/othervm -Xbootclasspath/a:. -XX:+UnlockDiagnosticVMOptions -XX:+WhiteBoxAPI
+ *                   -XX:-TieredCompilation -XX:-BackgroundCompilation
+ *                   -XX:+UnlockExperimentalVMOptions -XX:+SpeculativeEscapeAnalysis
+ *                   -XX:CompileCommand=dontinline,compiler.escapeAnalysis.TestRareEscape::log
+ *                   compiler.escapeAnalysis.TestRareEscape
+ */
+
+package compiler.escapeAnalysis;
+
+import java.lang.reflect.Method;
+import java.util.List;
+
+import jdk.jfr.Recording;
+import jdk.jfr.consumer.RecordedEvent;
+import jdk.test.lib.jfr.Events;
+import sun.hotspot.WhiteBox;
+
+public class TestRareEscape {
+    private static final WhiteBox WB = WhiteBox.getWhiteBox();
+    private static final int ITERATIONS = 100_000;
+
+    static class Builder {
+        int a;
+        long b;
+
+        Builder(int a, long b) {
+            this.a = a;
+            this.b = b;
+        }
+
+        long build() {
+            return a + b;
+        }
+    }
+
+    static long logged;
+
+    static void log(Builder builder) {
+        logged += builder.a * 31 + builder.b;
+    }
+
+    static long test(int i, boolean rare) {
+        Builder builder = new Builder(i, i * 2L);
+        builder.a += 3;
+        if (rare) {
+            log(builder);
+        }
+        builder.b -= 1;
+        return builder.build();
+    }
+
+    static long expected(int i) {
+        return (i + 3) + (i * 2L - 1);
+    }
+
+    public static void main(String[] args) throws Exception {
+        Method m = TestRareEscape.class.getDeclaredMethod("test", int.class, boolean.class);
+        for (int i = 0; i < ITERATIONS; i++) {
+            boolean rare = (i == 17);
+            long res = test(i, rare);
+            if (res != expected(i)) {
+                throw new RuntimeException("Wrong result " + res + " for " + i);
+            }
+        }
+        if (!WB.isMethodCompiled(m)) {
+            WB.enqueueMethodForCompilation(m, 4);
+        }
+        if (!WB.isMethodCompiled(m)) {
+            throw new RuntimeException("test is not compiled");
+        }
+
+        // Hit the rare path in the compiled code.
+        try (Recording recording = new Recording()) {
+            recording.enable("jdk.Deoptimization");
+            recording.start();
+            for (int i = 0; i < 10; i++) {
+                long before = logged;
+                long res = test(i, true);
+                if (res != expected(i)) {
+                    throw new RuntimeException("Wrong result " + res + " for " + i);
+                }
+                long diff = logged - before;
+                if (diff != (i + 3) * 31L + i * 2L) {
+                    throw new RuntimeException("Wrong logged value " + diff + " for " + i);
+                }
+            }
+            recording.stop();
+
+            List<RecordedEvent> events = Events.fromRecording(recording);
+            boolean trapped = false;
+            for (RecordedEvent e : events) {
+                System.out.println(e);
+                if ("rare_escape".equals(e.getValue("reason")) &&
+                    "test".equals(e.getValue("method.name"))) {
+                    trapped = true;
+                }
+            }
+            if (!trapped) {
+                throw new RuntimeException("No rare_escape trap in test");
+            }
+        }
+    }
+}
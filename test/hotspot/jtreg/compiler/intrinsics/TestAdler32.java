@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+/**
+ * @test
+ * @summary Intrinsified java.util.zip.Adler32 must match the scalar checksum
+ *          for all lengths, offsets and running checksum values
+ * @requires vm.compiler2.enabled
+ * @requires os.arch == "amd64" | os.arch == "x86_64"
+ *
+ * @run main/othervm -XX:-TieredCompilation -XX:+UseAdler32Intrinsics
+ *                   compiler.intrinsics.TestAdler32
+ * @run main/othervm -XX:-TieredCompilation -XX:-UseAdler32Intrinsics
+ *                   compiler.intrinsics.TestAdler32
+ */
+
+package compiler.intrinsics;
+
+import java.nio.ByteBuffer;
+import java.util.Random;
+import java.util.zip.Adler32;
+
+public class TestAdler32 {
+    private static final int ITERATIONS = 20_000;
+    private static final int MAX_LENGTH = 32 * 400;
+    private static final int BASE = 65521;
+
+    static long adler32(long adler, byte[] b, int off, int len) {
+        long s1 = adler & 0xffff;
+        long s2 = adler >>> 16;
+        for (int i = off; i < off + len; i++) {
+            s1 = (s1 + (b[i] & 0xff)) % BASE;
+            s2 = (s2 + s1) % BASE;
+        }
+        return (s2 << 16) | s1;
+    }
+
+    static void check(Adler32 checksum, long expected, String what) {
+        long actual = checksum.getValue();
+        if (actual != expected) {
+            throw new RuntimeException(what + ": expected 0x" + Long.toHexString(expected) +
+                                       " but got 0x" + Long.toHexString(actual));
+        }
+    }
+
+    public static void main(String[] args) {
+        Random rnd = new Random(42);
+        byte[] data = new byte[MAX_LENGTH + 64];
+        rnd.nextBytes(data);
+
+        // All-0xff input maximizes the partial sums and exercises the
+        // deferred modulo reduction at run boundaries.
+        byte[] ones = new byte[MAX_LENGTH];
+        java.util.Arrays.fill(ones, (byte)0xff);
+
+        ByteBuffer direct = ByteBuffer.allocateDirect(data.length);
+        direct.put(data).flip();
+
+        for (int i = 0; i < ITERATIONS; i++) {
+            int len = (i < 1024) ? i : rnd.nextInt(MAX_LENGTH);
+            int off = rnd.nextInt(64);
+
+            Adler32 a = new Adler32();
+            a.update(data, off, len);
+            check(a, adler32(1, data, off, len), "array off=" + off + " len=" + len);
+
+            // Chain a second update to start from a non-initial checksum.
+            long prefix = a.getValue();
+            int len2 = rnd.nextInt(MAX_LENGTH - len + 1);
+            a.update(ones, 0, len2);
+            check(a, adler32(prefix, ones, 0, len2), "chained len=" + len + "+" + len2);
+
+            Adler32 d = new Adler32();
+            direct.limit(off + len).position(off);
+            d.update(direct);
+            check(d, adler32(1, data, off, len), "direct off=" + off + " len=" + len);
+        }
+    }
+}
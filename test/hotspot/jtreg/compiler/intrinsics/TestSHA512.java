@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+/**
+ * @test
+ * @summary Intrinsified SHA-512 single- and multi-block compression must
+ *          agree with each other and with a known answer
+ * @requires vm.compiler2.enabled
+ *
+ * @run main/othervm -XX:-TieredCompilation compiler.intrinsics.TestSHA512
+ * @run main/othervm -XX:-TieredCompilation -XX:-UseSHA512Intrinsics
+ *                   compiler.intrinsics.TestSHA512
+ */
+
+package compiler.intrinsics;
+
+import java.security.MessageDigest;
+import java.util.Arrays;
+import java.util.Random;
+
+public class TestSHA512 {
+    private static final int ITERATIONS = 10_000;
+    private static final int MAX_LENGTH = 128 * 20;
+
+    private static final String ABC_DIGEST =
+        "ddaf35a193617abacc417349ae20413112e6fa4e89a97ea20a9eeee64b55d39a" +
+        "2192992a274fc1a836ba3c23a3feebbd454d4423643ce80e2a9ac94fa54ca49f";
+
+    static String hex(byte[] b) {
+        StringBuilder sb = new StringBuilder();
+        for (byte x : b) {
+            sb.append(String.format("%02x", x & 0xff));
+        }
+        return sb.toString();
+    }
+
+    public static void main(String[] args) throws Exception {
+        MessageDigest whole = MessageDigest.getInstance("SHA-512");
+        MessageDigest split = MessageDigest.getInstance("SHA-512");
+        Random rnd = new Random(42);
+        byte[] data = new byte[MAX_LENGTH];
+
+        for (int i = 0; i < ITERATIONS; i++) {
+            String abc = hex(whole.digest("abc".getBytes("US-ASCII")));
+            if (!abc.equals(ABC_DIGEST)) {
+                throw new RuntimeException("SHA-512(\"abc\") = " + abc);
+            }
+
+            // A single large update goes through the multi-block stub, while
+            // feeding one block at a time goes through the single-block one.
+            int len = rnd.nextInt(MAX_LENGTH);
+            rnd.nextBytes(data);
+            whole.update(data, 0, len);
+            for (int off = 0; off < len; off += 128) {
+                split.update(data, off, Math.min(128, len - off));
+            }
+            byte[] expected = whole.digest();
+            byte[] actual = split.digest();
+            if (!Arrays.equals(expected, actual)) {
+                throw new RuntimeException("len=" + len + ": " + hex(expected) + " != " + hex(actual));
+            }
+        }
+    }
+}
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+/**
+ * @test
+ * @summary Intrinsified StringLatin1.hashCode() and Arrays.hashCode(int[])
+ *          must match the scalar polynomial hash for all lengths
+ * @requires vm.compiler2.enabled
+ *
+ * @run main/othervm -XX:-TieredCompilation -XX:+UnlockDiagnosticVMOptions
+ *                   -XX:+UseVectorizedHashCodeIntrinsic
+ *                   compiler.intrinsics.TestVectorizedHashCode
+ * @run main/othervm -XX:-TieredCompilation -XX:+UnlockDiagnosticVMOptions
+ *                   -XX:+UseVectorizedHashCodeIntrinsic -XX:UseAVX=2
+ *                   compiler.intrinsics.TestVectorizedHashCode
+ */
+
+package compiler.intrinsics;
+
+import java.util.Arrays;
+import java.util.Random;
+
+public class TestVectorizedHashCode {
+    private static final int ITERATIONS = 20_000;
+    private static final int MAX_LENGTH = 300;
+
+    static int stringHash(byte[] b) {
+        int h = 0;
+        for (int i = 0; i < b.length; i++) {
+            h = 31 * h + (b[i] & 0xff);
+        }
+        return h;
+    }
+
+    static int arrayHash(int[] a) {
+        int h = 1;
+        for (int i = 0; i < a.length; i++) {
+            h = 31 * h + a[i];
+        }
+        return h;
+    }
+
+    static int testString(byte[] b) {
+        // A fresh String so that the cached hash is not used.
+        return new String(b, java.nio.charset.StandardCharsets.ISO_8859_1).hashCode();
+    }
+
+    static int testArray(int[] a) {
+        return Arrays.hashCode(a);
+    }
+
+    public static void main(String[] args) {
+        Random r = new Random(42);
+        byte[][] bytes = new byte[MAX_LENGTH][];
+        int[][] ints = new int[MAX_LENGTH][];
+        for (int len = 0; len < MAX_LENGTH; len++) {
+            bytes[len] = new byte[len];
+            r.nextBytes(bytes[len]);
+            ints[len] = new int[len];
+            for (int i = 0; i < len; i++) {
+                ints[len][i] = r.nextInt();
+            }
+        }
+        for (int i = 0; i < ITERATIONS; i++) {
+            int len = i % MAX_LENGTH;
+            int res = testString(bytes[len]);
+            if (res != stringHash(bytes[len])) {
+                throw new RuntimeException("wrong String hash for length " + len + ": " + res);
+            }
+            res = testArray(ints[len]);
+            if (res != arrayHash(ints[len])) {
+                throw new RuntimeException("wrong int[] hash for length " + len + ": " + res);
+            }
+            if (testArray(null) != 0) {
+                throw new RuntimeException("wrong hash for null array");
+            }
+        }
+    }
+}
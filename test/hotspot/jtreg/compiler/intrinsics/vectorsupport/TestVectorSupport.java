@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/**
+ * @test
+ * @summary Check the C2 intrinsics of jdk.internal.misc.VectorSupport
+ *          against a scalar computation
+ * @requires vm.compiler2.enabled
+ * @modules java.base/jdk.internal.misc
+ * @build java.base/jdk.internal.misc.VectorSupport
+ *
+ * @run main/othervm -XX:-TieredCompilation -XX:CompileThreshold=1000
+ *                   compiler.intrinsics.vectorsupport.TestVectorSupport
+ * @run main/othervm -XX:-TieredCompilation -XX:CompileThreshold=1000
+ *                   -XX:+UnlockDiagnosticVMOptions -XX:-UseVectorSupportIntrinsics
+ *                   compiler.intrinsics.vectorsupport.TestVectorSupport
+ */
+
+package compiler.intrinsics.vectorsupport;
+
+import java.util.Random;
+
+import jdk.internal.misc.Unsafe;
+import jdk.internal.misc.VectorSupport;
+
+public class TestVectorSupport {
+    private static final int ITERATIONS = 20_000;
+    private static final long BYTE_BASE = Unsafe.ARRAY_BYTE_BASE_OFFSET;
+    private static final long INT_BASE = Unsafe.ARRAY_INT_BASE_OFFSET;
+
+    private static final Random RANDOM = new Random(42);
+
+    static void addBytes(byte[] a, byte[] b, byte[] r) {
+        VectorSupport.binaryOp(VectorSupport.OP_ADD, VectorSupport.T_BYTE, 16,
+                               a, BYTE_BASE, b, BYTE_BASE, r, BYTE_BASE);
+        VectorSupport.binaryOp(VectorSupport.OP_ADD, VectorSupport.T_BYTE, 16,
+                               a, BYTE_BASE + 16, b, BYTE_BASE + 16, r, BYTE_BASE + 16);
+    }
+
+    static void xorInts(int[] a, int[] b, int[] r) {
+        VectorSupport.binaryOp(VectorSupport.OP_XOR, VectorSupport.T_INT, 8,
+                               a, INT_BASE, b, INT_BASE, r, INT_BASE);
+    }
+
+    static int compareBytes(byte[] a, byte[] b) {
+        return VectorSupport.compareEq(VectorSupport.T_BYTE, 32, a, BYTE_BASE, b, BYTE_BASE);
+    }
+
+    static int compareInts(int[] a, int[] b) {
+        return VectorSupport.compareEq(VectorSupport.T_INT, 4, a, INT_BASE, b, INT_BASE);
+    }
+
+    static void blendInts(int[] a, int[] b, int[] m, int[] r) {
+        VectorSupport.blend(VectorSupport.T_INT, 8, a, INT_BASE, b, INT_BASE,
+                            m, INT_BASE, r, INT_BASE);
+    }
+
+    static void reverseBytes(byte[] a, byte[] idx, byte[] r) {
+        VectorSupport.rearrange(16, a, BYTE_BASE, idx, BYTE_BASE, r, BYTE_BASE);
+    }
+
+    static void check(boolean ok, String msg) {
+        if (!ok) {
+            throw new RuntimeException(msg);
+        }
+    }
+
+    public static void main(String[] args) {
+        byte[] ba = new byte[32];
+        byte[] bb = new byte[32];
+        byte[] br = new byte[32];
+        int[] ia = new int[8];
+        int[] ib = new int[8];
+        int[] im = new int[8];
+        int[] ir = new int[8];
+        byte[] idx = new byte[16];
+        for (int i = 0; i < idx.length; i++) {
+            // Reverse, with a negative index zeroing the last lane
+            idx[i] = (byte) (i == 15 ? -1 : 15 - i);
+        }
+
+        check(VectorSupport.laneCount(VectorSupport.T_BYTE) > 0, "no lanes");
+
+        for (int iter = 0; iter < ITERATIONS; iter++) {
+            RANDOM.nextBytes(ba);
+            for (int i = 0; i < bb.length; i++) {
+                bb[i] = (i % 3 == 0) ? ba[i] : (byte) RANDOM.nextInt();
+            }
+            for (int i = 0; i < ia.length; i++) {
+                ia[i] = RANDOM.nextInt();
+                ib[i] = (i % 2 == 0) ? ia[i] : RANDOM.nextInt();
+                im[i] = RANDOM.nextBoolean() ? -1 : 0;
+            }
+
+            addBytes(ba, bb, br);
+            for (int i = 0; i < br.length; i++) {
+                check(br[i] == (byte) (ba[i] + bb[i]), "addBytes at " + i);
+            }
+
+            xorInts(ia, ib, ir);
+            for (int i = 0; i < ir.length; i++) {
+                check(ir[i] == (ia[i] ^ ib[i]), "xorInts at " + i);
+            }
+
+            int mask = compareBytes(ba, bb);
+            for (int i = 0; i < 32; i++) {
+                check(((mask >>> i) & 1) == (ba[i] == bb[i] ? 1 : 0), "compareBytes at " + i);
+            }
+
+            mask = compareInts(ia, ib);
+            check((mask & ~0xf) == 0, "compareInts sets bits past the lanes");
+            for (int i = 0; i < 4; i++) {
+                check(((mask >>> i) & 1) == (ia[i] == ib[i] ? 1 : 0), "compareInts at " + i);
+            }
+
+            blendInts(ia, ib, im, ir);
+            for (int i = 0; i < ir.length; i++) {
+                check(ir[i] == (im[i] != 0 ? ib[i] : ia[i]), "blendInts at " + i);
+            }
+
+            reverseBytes(ba, idx, br);
+            for (int i = 0; i < 16; i++) {
+                check(br[i] == (i == 15 ? 0 : ba[15 - i]), "reverseBytes at " + i);
+            }
+        }
+    }
+}
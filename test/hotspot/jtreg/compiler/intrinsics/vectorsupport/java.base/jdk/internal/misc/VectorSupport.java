@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package jdk.internal.misc;
+
+/**
+ * Java implementation of the explicit SIMD operations that C2 replaces
+ * with vector instructions. Operands are array base and byte offset pairs
+ * as for {@link Unsafe}, and are not range checked. Element types are
+ * HotSpot BasicType values.
+ */
+public class VectorSupport {
+    public static final int T_FLOAT  = 6;
+    public static final int T_DOUBLE = 7;
+    public static final int T_BYTE   = 8;
+    public static final int T_SHORT  = 9;
+    public static final int T_INT    = 10;
+    public static final int T_LONG   = 11;
+
+    public static final int OP_ADD = 0;
+    public static final int OP_SUB = 1;
+    public static final int OP_MUL = 2;
+    public static final int OP_AND = 3;
+    public static final int OP_OR  = 4;
+    public static final int OP_XOR = 5;
+
+    private static final Unsafe U = Unsafe.getUnsafe();
+
+    private static int elementSize(int bt) {
+        switch (bt) {
+            case T_BYTE:   return 1;
+            case T_SHORT:  return 2;
+            case T_INT:
+            case T_FLOAT:  return 4;
+            case T_LONG:
+            case T_DOUBLE: return 8;
+            default: throw new IllegalArgumentException("bt " + bt);
+        }
+    }
+
+    // Raw bits of a lane, sign extended.
+    private static long get(int bt, Object o, long offset) {
+        switch (elementSize(bt)) {
+            case 1:  return U.getByte(o, offset);
+            case 2:  return U.getShort(o, offset);
+            case 4:  return U.getInt(o, offset);
+            default: return U.getLong(o, offset);
+        }
+    }
+
+    private static void put(int bt, Object o, long offset, long bits) {
+        switch (elementSize(bt)) {
+            case 1:  U.putByte(o, offset, (byte) bits);   break;
+            case 2:  U.putShort(o, offset, (short) bits); break;
+            case 4:  U.putInt(o, offset, (int) bits);     break;
+            default: U.putLong(o, offset, bits);          break;
+        }
+    }
+
+    private static long apply(int op, int bt, long x, long y) {
+        if (bt == T_FLOAT) {
+            float fx = Float.intBitsToFloat((int) x);
+            float fy = Float.intBitsToFloat((int) y);
+            switch (op) {
+                case OP_ADD: return Float.floatToRawIntBits(fx + fy);
+                case OP_SUB: return Float.floatToRawIntBits(fx - fy);
+                case OP_MUL: return Float.floatToRawIntBits(fx * fy);
+                default: throw new IllegalArgumentException("op " + op);
+            }
+        }
+        if (bt == T_DOUBLE) {
+            double dx = Double.longBitsToDouble(x);
+            double dy = Double.longBitsToDouble(y);
+            switch (op) {
+                case OP_ADD: return Double.doubleToRawLongBits(dx + dy);
+                case OP_SUB: return Double.doubleToRawLongBits(dx - dy);
+                case OP_MUL: return Double.doubleToRawLongBits(dx * dy);
+                default: throw new IllegalArgumentException("op " + op);
+            }
+        }
+        switch (op) {
+            case OP_ADD: return x + y;
+            case OP_SUB: return x - y;
+            case OP_MUL: return x * y;
+            case OP_AND: return x & y;
+            case OP_OR:  return x | y;
+            case OP_XOR: return x ^ y;
+            default: throw new IllegalArgumentException("op " + op);
+        }
+    }
+
+    /**
+     * Number of lanes of the widest vector of {@code bt} that the compiled
+     * code uses, at most 256 bits; 1 when there is no SIMD support.
+     */
+    public static int laneCount(int bt) {
+        elementSize(bt);
+        return 1;
+    }
+
+    /** {@code r[i] = a[i] op b[i]} for {@code lanes} lanes. */
+    public static void binaryOp(int op, int bt, int lanes,
+                                Object a, long aOffset, Object b, long bOffset,
+                                Object r, long rOffset) {
+        int size = elementSize(bt);
+        for (int i = 0; i < lanes; i++) {
+            long d = (long) i * size;
+            put(bt, r, rOffset + d, apply(op, bt, get(bt, a, aOffset + d), get(bt, b, bOffset + d)));
+        }
+    }
+
+    /** Bit i of the result is set when {@code a[i] == b[i]}; byte and int lanes. */
+    public static int compareEq(int bt, int lanes,
+                                Object a, long aOffset, Object b, long bOffset) {
+        if (bt != T_BYTE && bt != T_INT) {
+            throw new IllegalArgumentException("bt " + bt);
+        }
+        int size = elementSize(bt);
+        int mask = 0;
+        for (int i = 0; i < lanes; i++) {
+            long d = (long) i * size;
+            if (get(bt, a, aOffset + d) == get(bt, b, bOffset + d)) {
+                mask |= 1 << i;
+            }
+        }
+        return mask;
+    }
+
+    /**
+     * {@code r[i] = (m[i] != 0) ? b[i] : a[i]}, where every lane of the
+     * mask is 0 or has all bits set.
+     */
+    public static void blend(int bt, int lanes,
+                             Object a, long aOffset, Object b, long bOffset,
+                             Object m, long mOffset, Object r, long rOffset) {
+        int size = elementSize(bt);
+        for (int i = 0; i < lanes; i++) {
+            long d = (long) i * size;
+            long bits = (get(bt, m, mOffset + d) != 0) ? get(bt, b, bOffset + d) : get(bt, a, aOffset + d);
+            put(bt, r, rOffset + d, bits);
+        }
+    }
+
+    /**
+     * {@code r[i] = (idx[i] < 0) ? 0 : a[idx[i] & (lanes - 1)]} for byte
+     * lanes; {@code lanes} is a power of two.
+     */
+    public static void rearrange(int lanes,
+                                 Object a, long aOffset, Object idx, long idxOffset,
+                                 Object r, long rOffset) {
+        byte[] tmp = new byte[lanes];
+        for (int i = 0; i < lanes; i++) {
+            byte index = U.getByte(idx, idxOffset + i);
+            tmp[i] = (index < 0) ? 0 : U.getByte(a, aOffset + (index & (lanes - 1)));
+        }
+        for (int i = 0; i < lanes; i++) {
+            U.putByte(r, rOffset + i, tmp[i]);
+        }
+    }
+}
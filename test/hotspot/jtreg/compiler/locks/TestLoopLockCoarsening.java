@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+/**
+ * @test
+ * @summary Locks coarsened across unrolled loop iterations must still
+ *          provide mutual exclusion and correct results, and a merged
+ *          lock region must cover at most LoopLockCoarseningChunk iterations
+ * @requires vm.compiler2.enabled
+ * @library /test/lib
+ * @modules jdk.jfr
+ *
+ * @run main/othervm -XX:-TieredCompilation -XX:+LoopLockCoarsening
+ *                   compiler.locks.TestLoopLockCoarsening 4
+ * @run main/othervm -XX:-TieredCompilation -XX:+LoopLockCoarsening
+ *                   -XX:LoopLockCoarseningChunk=16 -XX:-UseBiasedLocking
+ *                   compiler.locks.TestLoopLockCoarsening 16
+ */
+
+package compiler.locks;
+
+import jdk.jfr.Recording;
+import jdk.jfr.consumer.RecordedEvent;
+import jdk.test.lib.jfr.Events;
+
+public class TestLoopLockCoarsening {
+    private static final int ITERATIONS = 10_000;
+
+    static class Counter {
+        private long value;
+        synchronized void add(int v) { value += v; }
+        synchronized long get() { return value; }
+    }
+
+    static String build(int n) {
+        StringBuffer sb = new StringBuffer();
+        for (int i = 0; i < n; i++) {
+            sb.append((char) ('a' + i % 26));
+        }
+        return sb.toString();
+    }
+
+    static void addAll(Counter c, int n) {
+        for (int i = 0; i < n; i++) {
+            c.add(i & 3);
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        int chunk = Integer.parseInt(args[0]);
+        Recording recording = new Recording();
+        recording.enable("jdk.CompilerLockCoarsening");
+        recording.start();
+        for (int iter = 0; iter < ITERATIONS; iter++) {
+            String s = build(100);
+            if (s.length() != 100 || s.charAt(27) != 'b' || s.charAt(99) != 'v') {
+                throw new RuntimeException("wrong string: " + s);
+            }
+            Counter c = new Counter();
+            addAll(c, 100);
+            if (c.get() != 150) {
+                throw new RuntimeException("wrong sum: " + c.get());
+            }
+        }
+        recording.stop();
+
+        // The lock regions of the inlined Counter.add() in the unrolled
+        // copies of the loop in addAll() are merged into one, which covers
+        // at least two but never more than chunk iterations. Merging n
+        // regions removes the n - 1 unlocks between them.
+        boolean coarsened = false;
+        for (RecordedEvent e : Events.fromRecording(recording)) {
+            System.out.println(e);
+            if ("add".equals(e.getValue("method.name"))) {
+                int locks = e.getInt("lockCount");
+                int unlocks = e.getInt("unlockCount");
+                if (locks < 2 || locks > chunk) {
+                    throw new RuntimeException("Merged " + locks + " lock regions, chunk is " + chunk);
+                }
+                if (unlocks != locks - 1) {
+                    throw new RuntimeException("Removed " + unlocks + " unlocks in " + locks + " merged lock regions");
+                }
+                coarsened = true;
+            }
+        }
+        recording.close();
+        if (!coarsened) {
+            throw new RuntimeException("No locks coarsened in addAll");
+        }
+
+        final Counter shared = new Counter();
+        Thread[] threads = new Thread[4];
+        for (int t = 0; t < threads.length; t++) {
+            threads[t] = new Thread(() -> {
+                for (int i = 0; i < 2_000; i++) {
+                    addAll(shared, 1_000);
+                }
+            });
+            threads[t].start();
+        }
+        for (Thread t : threads) {
+            t.join();
+        }
+        long expected = (long) threads.length * 2_000 * 1_500;
+        if (shared.get() != expected) {
+            throw new RuntimeException("lost updates: " + shared.get() + " != " + expected);
+        }
+    }
+}
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/**
+ * @test
+ * @summary Loops with a long induction variable transformed into loop nests must keep their trip counts
+ * @requires vm.compiler2.enabled
+ *
+ * @run main/othervm -XX:-TieredCompilation
+ *                   -XX:+UnlockExperimentalVMOptions -XX:+UseLongLoopNest
+ *                   -XX:CompileCommand=dontinline,compiler.loopopts.TestLongLoopNest::test*
+ *                   -XX:CompileCommand=exclude,compiler.loopopts.TestLongLoopNest::ref*
+ *                   compiler.loopopts.TestLongLoopNest
+ * @run main/othervm -XX:-TieredCompilation -XX:LoopStripMiningIter=0
+ *                   -XX:+UnlockExperimentalVMOptions -XX:+UseLongLoopNest
+ *                   -XX:CompileCommand=dontinline,compiler.loopopts.TestLongLoopNest::test*
+ *                   -XX:CompileCommand=exclude,compiler.loopopts.TestLongLoopNest::ref*
+ *                   compiler.loopopts.TestLongLoopNest
+ */
+
+package compiler.loopopts;
+
+public class TestLongLoopNest {
+    private static final int ITERATIONS = 20_000;
+
+    static long testUp(long start, long stop) {
+        long sum = 0;
+        for (long i = start; i < stop; i++) {
+            sum += i;
+        }
+        return sum;
+    }
+
+    static long testUpInclusive(long start, long stop) {
+        long sum = 0;
+        for (long i = start; i <= stop; i += 3) {
+            sum += i ^ 0x55;
+        }
+        return sum;
+    }
+
+    static long testDown(long start, long stop) {
+        long sum = 0;
+        for (long i = start; i > stop; i -= 2) {
+            sum += i * 7;
+        }
+        return sum;
+    }
+
+    static long testCount(long start, long stop) {
+        long count = 0;
+        for (long i = start; i < stop; i += 1000) {
+            count++;
+        }
+        return count;
+    }
+
+    // The ref* methods are never compiled, see the @run lines
+    static long refUp(long start, long stop) {
+        long sum = 0;
+        long i = start;
+        while (i < stop) {
+            sum += i;
+            i++;
+        }
+        return sum;
+    }
+
+    static long refUpInclusive(long start, long stop) {
+        long sum = 0;
+        long i = start;
+        while (i <= stop) {
+            sum += i ^ 0x55;
+            i += 3;
+            if (i < start) {
+                break; // wrapped around
+            }
+        }
+        return sum;
+    }
+
+    static long refDown(long start, long stop) {
+        long sum = 0;
+        long i = start;
+        while (i > stop) {
+            sum += i * 7;
+            i -= 2;
+        }
+        return sum;
+    }
+
+    static void check(long res, long expected, String name, long start, long stop) {
+        if (res != expected) {
+            throw new RuntimeException(name + "(" + start + ", " + stop + "): " + res + " != " + expected);
+        }
+    }
+
+    public static void main(String[] args) {
+        for (int i = 0; i < ITERATIONS; i++) {
+            long start = i - 50;
+            long stop = i % 100;
+            check(testUp(start, stop), refUp(start, stop), "testUp", start, stop);
+            check(testUpInclusive(start, stop), refUpInclusive(start, stop), "testUpInclusive", start, stop);
+            check(testDown(stop, start), refDown(stop, start), "testDown", stop, start);
+            check(testCount(start, stop), (Math.max(stop - start, 0) + 999) / 1000, "testCount", start, stop);
+        }
+        long[][] bounds = {
+            { Long.MAX_VALUE - 100, Long.MAX_VALUE },
+            { Long.MIN_VALUE, Long.MIN_VALUE + 100 },
+            { Integer.MAX_VALUE - 10L, Integer.MAX_VALUE + 10L },
+            { -5, 3_000_000_000L },
+        };
+        for (long[] b : bounds) {
+            check(testUp(b[0], b[0] + 100 < b[1] ? b[0] + 100 : b[1]), refUp(b[0], b[0] + 100 < b[1] ? b[0] + 100 : b[1]), "testUp", b[0], b[1]);
+            check(testDown(b[1], b[1] - 100 > b[0] ? b[1] - 100 : b[0]), refDown(b[1], b[1] - 100 > b[0] ? b[1] - 100 : b[0]), "testDown", b[1], b[0]);
+        }
+        check(testCount(-5, 3_000_000_000L), (3_000_000_005L + 999) / 1000, "testCount", -5, 3_000_000_000L);
+        check(testCount(Long.MIN_VALUE, Long.MIN_VALUE + 5_000_000_000L), 5_000_000, "testCount", Long.MIN_VALUE, Long.MIN_VALUE + 5_000_000_000L);
+    }
+}
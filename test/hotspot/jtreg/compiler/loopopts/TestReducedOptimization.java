@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+/**
+ * @test
+ * @summary Methods compiled with reduced optimization while the compile
+ *          queue is backed up must compute the same results
+ * @requires vm.compiler2.enabled
+ * @library /test/lib /
+ * @modules java.base/jdk.internal.misc
+ *
+ * @run main/othervm -XX:-TieredCompilation -XX:ReducedOptimizationQueueLength=1
+ *                   compiler.loopopts.TestReducedOptimization
+ * @run main/othervm -XX:ReducedOptimizationQueueLength=1
+ *                   -XX:ReducedOptimizationLoopOptsCount=0
+ *                   compiler.loopopts.TestReducedOptimization
+ */
+
+/**
+ * @test
+ * @summary Code compiled with reduced optimization is replaced by a full
+ *          compilation once the compile queue has drained
+ * @requires vm.compiler2.enabled & vm.compMode != "Xint"
+ * @library /test/lib /
+ * @modules java.base/jdk.internal.misc
+ *
+ * @build sun.hotspot.WhiteBox
+ * @run driver ClassFileInstaller sun.hotspot.WhiteBox
+ *                                sun.hotspot.WhiteBox$WhiteBoxPermission
+ * @run main/othervm -Xbootclasspath/a:. -XX:+UnlockDiagnosticVMOptions -XX:+WhiteBoxAPI
+ *                   -XX:-TieredCompilation -XX:CICompilerCount=1
+ *                   -XX:-UseDynamicNumberOfCompilerThreads
+ *                   -XX:ReducedOptimizationQueueLength=1
+ *                   -XX:CompileCommand=quiet
+ *                   -XX:CompileCommand=compileonly,compiler.loopopts.TestReducedOptimization::*
+ *                   compiler.loopopts.TestReducedOptimization reoptimize
+ */
+
+package compiler.loopopts;
+
+import java.lang.reflect.Method;
+
+import sun.hotspot.WhiteBox;
+import sun.hotspot.code.NMethod;
+
+public class TestReducedOptimization {
+    private static final int ITERATIONS = 20_000;
+    private static final int SIZE = 1000;
+
+    static int sum(int[] a) {
+        int s = 0;
+        for (int i = 0; i < a.length; i++) {
+            s += a[i];
+        }
+        return s;
+    }
+
+    static long dot(int[] a, int[] b) {
+        long s = 0;
+        for (int i = 0; i < a.length; i++) {
+            s += (long) a[i] * b[i];
+        }
+        return s;
+    }
+
+    static void scale(int[] a, int[] b, int k) {
+        for (int i = 0; i < a.length; i++) {
+            b[i] = a[i] * k + i;
+        }
+    }
+
+    static int nested(int n) {
+        int s = 0;
+        for (int i = 0; i < n; i++) {
+            for (int j = i; j < n; j++) {
+                s += i ^ j;
+            }
+        }
+        return s;
+    }
+
+    static class Reoptimize {
+        private static final WhiteBox WB = WhiteBox.getWhiteBox();
+        private static final int LEVEL_FULL_OPTIMIZATION = 4;
+
+        static int compileId(Method m) throws Exception {
+            NMethod nm;
+            while ((nm = NMethod.get(m, false)) == null) {
+                Thread.sleep(10);
+            }
+            return nm.compile_id;
+        }
+
+        static void run() throws Exception {
+            Method sum = TestReducedOptimization.class.getDeclaredMethod("sum", int[].class);
+            Method dot = TestReducedOptimization.class.getDeclaredMethod("dot", int[].class, int[].class);
+            Method scale = TestReducedOptimization.class.getDeclaredMethod("scale", int[].class, int[].class, int.class);
+            Method nested = TestReducedOptimization.class.getDeclaredMethod("nested", int.class);
+
+            // The only C2 thread waits for the unlock in the compiler, so
+            // that the first compilation starts with the other three
+            // methods in the queue and is done with reduced optimization.
+            WB.lockCompilation();
+            WB.enqueueMethodForCompilation(sum, LEVEL_FULL_OPTIMIZATION);
+            WB.enqueueMethodForCompilation(dot, LEVEL_FULL_OPTIMIZATION);
+            WB.enqueueMethodForCompilation(scale, LEVEL_FULL_OPTIMIZATION);
+            WB.enqueueMethodForCompilation(nested, LEVEL_FULL_OPTIMIZATION);
+            WB.unlockCompilation();
+
+            int reduced = compileId(sum);
+            compileId(nested);
+
+            // Once the queue has drained, sum() is compiled again with all
+            // optimizations, and the new code replaces the reduced code.
+            while (compileId(sum) == reduced) {
+                Thread.sleep(10);
+            }
+            if (WB.getMethodCompilationLevel(sum) != LEVEL_FULL_OPTIMIZATION) {
+                throw new RuntimeException("sum() is not compiled by C2 after the recompilation");
+            }
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        if (args.length > 0 && args[0].equals("reoptimize")) {
+            Reoptimize.run();
+            return;
+        }
+        int[] a = new int[SIZE];
+        int[] b = new int[SIZE];
+        for (int i = 0; i < SIZE; i++) {
+            a[i] = i * 7 - 300;
+        }
+        int expectedSum = 0;
+        long expectedDot = 0;
+        for (int i = 0; i < SIZE; i++) {
+            expectedSum += a[i];
+        }
+        int expectedNested = 0;
+        for (int i = 0; i < 50; i++) {
+            for (int j = i; j < 50; j++) {
+                expectedNested += i ^ j;
+            }
+        }
+        for (int iter = 0; iter < ITERATIONS; iter++) {
+            if (sum(a) != expectedSum) {
+                throw new RuntimeException("wrong sum");
+            }
+            scale(a, b, 3);
+            for (int i = 0; i < SIZE; i += 97) {
+                if (b[i] != a[i] * 3 + i) {
+                    throw new RuntimeException("wrong scale at " + i);
+                }
+            }
+            long d = dot(a, b);
+            if (iter == 0) {
+                expectedDot = d;
+            } else if (d != expectedDot) {
+                throw new RuntimeException("wrong dot product");
+            }
+            if (nested(50) != expectedNested) {
+                throw new RuntimeException("wrong nested loop result");
+            }
+        }
+    }
+}
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+/**
+ * @test
+ * @summary Counted loops searching a byte[] for a constant must find the
+ *          same index and throw the same exceptions when fast-forwarded
+ * @requires vm.compiler2.enabled
+ *
+ * @run main/othervm -XX:-TieredCompilation -XX:+OptimizeSearchLoops
+ *                   -XX:CompileCommand=exclude,compiler.loopopts.TestSearchLoopFastForward::reference
+ *                   compiler.loopopts.TestSearchLoopFastForward
+ * @run main/othervm -XX:-TieredCompilation -XX:+OptimizeSearchLoops
+ *                   -XX:LoopStripMiningIter=0
+ *                   -XX:CompileCommand=exclude,compiler.loopopts.TestSearchLoopFastForward::reference
+ *                   compiler.loopopts.TestSearchLoopFastForward
+ */
+
+package compiler.loopopts;
+
+public class TestSearchLoopFastForward {
+    private static final int ITERATIONS = 20_000;
+
+    static int find(byte[] a, int from, int to) {
+        int i = from;
+        for (; i < to; i++) {
+            if (a[i] == ':') {
+                break;
+            }
+        }
+        return i;
+    }
+
+    static int findNegative(byte[] a, int from) {
+        for (int i = from; i < a.length; i++) {
+            if (a[i] == (byte) 0xE9) {
+                return i;
+            }
+        }
+        return -1;
+    }
+
+    // Never compiled, see the @run lines
+    static int reference(byte[] a, int from, int to, byte c) {
+        int i = from;
+        for (; i < to; i++) {
+            if (a[i] == c) {
+                break;
+            }
+        }
+        return i;
+    }
+
+    static void checkFind(byte[] a, int from, int to) {
+        int expected;
+        boolean expectedThrow = false;
+        try {
+            expected = reference(a, from, to, (byte) ':');
+        } catch (ArrayIndexOutOfBoundsException e) {
+            expectedThrow = true;
+            expected = -1;
+        }
+        try {
+            int r = find(a, from, to);
+            if (expectedThrow || r != expected) {
+                throw new RuntimeException("find(" + from + ", " + to + ") = " + r + ", expected " + expected);
+            }
+        } catch (ArrayIndexOutOfBoundsException e) {
+            if (!expectedThrow) {
+                throw new RuntimeException("unexpected exception for find(" + from + ", " + to + ")", e);
+            }
+        }
+    }
+
+    public static void main(String[] args) {
+        byte[] a = new byte[300];
+        for (int i = 0; i < a.length; i++) {
+            a[i] = (byte) ('a' + i % 26);
+        }
+        a[77] = ':';
+        a[250] = ':';
+        a[133] = (byte) 0xE9;
+        int[][] ranges = {
+            {0, 300}, {0, 77}, {0, 78}, {78, 300}, {251, 300}, {251, 301},
+            {78, 250}, {5, 5}, {10, 3}, {-1, 50}, {290, 400}, {0, 1}, {299, 300}
+        };
+        for (int iter = 0; iter < ITERATIONS; iter++) {
+            for (int[] r : ranges) {
+                checkFind(a, r[0], r[1]);
+            }
+            if (findNegative(a, 0) != 133 || findNegative(a, 134) != -1) {
+                throw new RuntimeException("wrong result for negative byte search");
+            }
+        }
+    }
+}
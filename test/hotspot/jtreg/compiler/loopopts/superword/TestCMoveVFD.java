@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/**
+ * @test
+ * @summary Vectorized float and double conditional moves must select the
+ *          same values as the scalar code for both operand orders
+ * @requires vm.compiler2.enabled
+ *
+ * @run main/othervm -XX:-TieredCompilation -XX:+UseVectorCmov
+ *                   -XX:CompileCommand=dontinline,compiler.loopopts.superword.TestCMoveVFD::*
+ *                   compiler.loopopts.superword.TestCMoveVFD
+ */
+
+package compiler.loopopts.superword;
+
+import java.util.Random;
+
+public class TestCMoveVFD {
+    private static final int SIZE = 1024;
+    private static final int ITERATIONS = 20_000;
+
+    static void gtFalseF(float[] a, float[] b, float[] c) {
+        for (int i = 0; i < c.length; i++) {
+            c[i] = (a[i] > b[i]) ? b[i] : a[i];
+        }
+    }
+
+    // The compare operands are in the reverse order of the selected values.
+    static void gtTrueF(float[] a, float[] b, float[] c) {
+        for (int i = 0; i < c.length; i++) {
+            c[i] = (a[i] > b[i]) ? a[i] : b[i];
+        }
+    }
+
+    static void ltTrueF(float[] a, float[] b, float[] c) {
+        for (int i = 0; i < c.length; i++) {
+            c[i] = (a[i] < b[i]) ? a[i] : b[i];
+        }
+    }
+
+    static void gtFalseD(double[] a, double[] b, double[] c) {
+        for (int i = 0; i < c.length; i++) {
+            c[i] = (a[i] > b[i]) ? b[i] : a[i];
+        }
+    }
+
+    static void gtTrueD(double[] a, double[] b, double[] c) {
+        for (int i = 0; i < c.length; i++) {
+            c[i] = (a[i] > b[i]) ? a[i] : b[i];
+        }
+    }
+
+    static void ltTrueD(double[] a, double[] b, double[] c) {
+        for (int i = 0; i < c.length; i++) {
+            c[i] = (a[i] < b[i]) ? a[i] : b[i];
+        }
+    }
+
+    static void verify(String name, float[] a, float[] b, float[] c, boolean max) {
+        for (int i = 0; i < c.length; i++) {
+            float expected = max ? (a[i] > b[i] ? a[i] : b[i]) : (a[i] < b[i] ? a[i] : b[i]);
+            if (c[i] != expected) {
+                throw new RuntimeException(name + ": c[" + i + "] = " + c[i] + ", expected " + expected +
+                                           " for a = " + a[i] + ", b = " + b[i]);
+            }
+        }
+    }
+
+    static void verify(String name, double[] a, double[] b, double[] c, boolean max) {
+        for (int i = 0; i < c.length; i++) {
+            double expected = max ? (a[i] > b[i] ? a[i] : b[i]) : (a[i] < b[i] ? a[i] : b[i]);
+            if (c[i] != expected) {
+                throw new RuntimeException(name + ": c[" + i + "] = " + c[i] + ", expected " + expected +
+                                           " for a = " + a[i] + ", b = " + b[i]);
+            }
+        }
+    }
+
+    public static void main(String[] args) {
+        Random random = new Random(42);
+        float[] af = new float[SIZE];
+        float[] bf = new float[SIZE];
+        float[] cf = new float[SIZE];
+        double[] ad = new double[SIZE];
+        double[] bd = new double[SIZE];
+        double[] cd = new double[SIZE];
+        for (int i = 0; i < SIZE; i++) {
+            af[i] = random.nextInt(16) - 8;
+            bf[i] = (i % 5 == 0) ? af[i] : random.nextInt(16) - 8;
+            ad[i] = af[i];
+            bd[i] = bf[i];
+        }
+
+        for (int i = 0; i < ITERATIONS; i++) {
+            gtFalseF(af, bf, cf); verify("gtFalseF", af, bf, cf, false);
+            gtTrueF(af, bf, cf);  verify("gtTrueF", af, bf, cf, true);
+            ltTrueF(af, bf, cf);  verify("ltTrueF", af, bf, cf, false);
+            gtFalseD(ad, bd, cd); verify("gtFalseD", ad, bd, cd, false);
+            gtTrueD(ad, bd, cd);  verify("gtTrueD", ad, bd, cd, true);
+            ltTrueD(ad, bd, cd);  verify("ltTrueD", ad, bd, cd, false);
+        }
+    }
+}
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/**
+ * @test
+ * @summary Vectorized int conditional moves must select the same values as the scalar code
+ * @requires vm.compiler2.enabled
+ *
+ * @run main/othervm -XX:-TieredCompilation -XX:+UseVectorCmov
+ *                   -XX:CompileCommand=dontinline,compiler.loopopts.superword.TestCMoveVI::*
+ *                   compiler.loopopts.superword.TestCMoveVI
+ */
+
+package compiler.loopopts.superword;
+
+import java.util.Random;
+
+public class TestCMoveVI {
+    private static final int SIZE = 1024;
+    private static final int ITERATIONS = 20_000;
+
+    static void gtFalse(int[] a, int[] b, int[] c) {
+        for (int i = 0; i < c.length; i++) {
+            c[i] = (a[i] > b[i]) ? b[i] : a[i];
+        }
+    }
+
+    static void geFalse(int[] a, int[] b, int[] c) {
+        for (int i = 0; i < c.length; i++) {
+            c[i] = (a[i] >= b[i]) ? b[i] : a[i];
+        }
+    }
+
+    static void ltFalse(int[] a, int[] b, int[] c) {
+        for (int i = 0; i < c.length; i++) {
+            c[i] = (a[i] < b[i]) ? b[i] : a[i];
+        }
+    }
+
+    static void leFalse(int[] a, int[] b, int[] c) {
+        for (int i = 0; i < c.length; i++) {
+            c[i] = (a[i] <= b[i]) ? b[i] : a[i];
+        }
+    }
+
+    static void neFalse(int[] a, int[] b, int[] c) {
+        for (int i = 0; i < c.length; i++) {
+            c[i] = (a[i] != b[i]) ? b[i] : a[i];
+        }
+    }
+
+    // The compare operands are in the reverse order of the selected values.
+    static void gtTrue(int[] a, int[] b, int[] c) {
+        for (int i = 0; i < c.length; i++) {
+            c[i] = (a[i] > b[i]) ? a[i] : b[i];
+        }
+    }
+
+    static void ltTrue(int[] a, int[] b, int[] c) {
+        for (int i = 0; i < c.length; i++) {
+            c[i] = (a[i] < b[i]) ? a[i] : b[i];
+        }
+    }
+
+    static void verify(String name, int[] a, int[] b, int[] c, boolean max) {
+        for (int i = 0; i < c.length; i++) {
+            int expected = max ? Math.max(a[i], b[i]) : Math.min(a[i], b[i]);
+            if (c[i] != expected) {
+                throw new RuntimeException(name + ": c[" + i + "] = " + c[i] + ", expected " + expected +
+                                           " for a = " + a[i] + ", b = " + b[i]);
+            }
+        }
+    }
+
+    static void verifyEqual(String name, int[] expected, int[] c) {
+        for (int i = 0; i < c.length; i++) {
+            if (c[i] != expected[i]) {
+                throw new RuntimeException(name + ": c[" + i + "] = " + c[i] + ", expected " + expected[i]);
+            }
+        }
+    }
+
+    public static void main(String[] args) {
+        Random random = new Random(42);
+        int[] a = new int[SIZE];
+        int[] b = new int[SIZE];
+        int[] c = new int[SIZE];
+        for (int i = 0; i < SIZE; i++) {
+            a[i] = random.nextInt(16) - 8;
+            b[i] = (i % 5 == 0) ? a[i] : random.nextInt(16) - 8;
+        }
+
+        for (int i = 0; i < ITERATIONS; i++) {
+            gtFalse(a, b, c); verify("gtFalse", a, b, c, false);
+            geFalse(a, b, c); verify("geFalse", a, b, c, false);
+            ltFalse(a, b, c); verify("ltFalse", a, b, c, true);
+            leFalse(a, b, c); verify("leFalse", a, b, c, true);
+            neFalse(a, b, c); verifyEqual("neFalse", b, c);
+            gtTrue(a, b, c);  verify("gtTrue", a, b, c, true);
+            ltTrue(a, b, c);  verify("ltTrue", a, b, c, false);
+        }
+    }
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/**
+ * @test
+ * @summary Masked post loops must compute the same results as the scalar loops for all trip counts
+ * @requires vm.compiler2.enabled
+ *
+ * @run main/othervm -XX:-TieredCompilation -XX:+UnlockExperimentalVMOptions -XX:+PostLoopMultiversioning
+ *                   -XX:CompileCommand=dontinline,compiler.loopopts.superword.TestPostLoopVectorization::*
+ *                   compiler.loopopts.superword.TestPostLoopVectorization
+ */
+
+package compiler.loopopts.superword;
+
+public class TestPostLoopVectorization {
+    private static final int MAX_LENGTH = 200;
+    private static final int ITERATIONS = 2_000;
+
+    static void add(int[] a, int[] b, int[] c, int n) {
+        for (int i = 0; i < n; i++) {
+            c[i] = a[i] + b[i];
+        }
+    }
+
+    static void scale(float[] a, float[] c, int n) {
+        for (int i = 0; i < n; i++) {
+            c[i] = a[i] * 2.0f;
+        }
+    }
+
+    // Not unit stride: must not be mapped to masked lanes.
+    static void strided(int[] a, int[] c, int n) {
+        for (int i = 0; i < n; i++) {
+            c[2 * i] = a[i] + 1;
+        }
+    }
+
+    public static void main(String[] args) {
+        int[] a = new int[MAX_LENGTH];
+        int[] b = new int[MAX_LENGTH];
+        float[] f = new float[MAX_LENGTH];
+        for (int i = 0; i < MAX_LENGTH; i++) {
+            a[i] = i;
+            b[i] = 3 * i;
+            f[i] = i;
+        }
+        int[] c = new int[2 * MAX_LENGTH + 1];
+        float[] g = new float[MAX_LENGTH + 1];
+
+        for (int iter = 0; iter < ITERATIONS; iter++) {
+            int n = iter % (MAX_LENGTH + 1);
+
+            java.util.Arrays.fill(c, -1);
+            add(a, b, c, n);
+            for (int i = 0; i < c.length; i++) {
+                int expected = (i < n) ? 4 * i : -1;
+                if (c[i] != expected) {
+                    throw new RuntimeException("add(" + n + "): c[" + i + "] = " + c[i] + ", expected " + expected);
+                }
+            }
+
+            java.util.Arrays.fill(g, -1.0f);
+            scale(f, g, n);
+            for (int i = 0; i < g.length; i++) {
+                float expected = (i < n) ? 2.0f * i : -1.0f;
+                if (g[i] != expected) {
+                    throw new RuntimeException("scale(" + n + "): g[" + i + "] = " + g[i] + ", expected " + expected);
+                }
+            }
+
+            java.util.Arrays.fill(c, -1);
+            strided(a, c, n);
+            for (int i = 0; i < c.length; i++) {
+                int expected = (i % 2 == 0 && i / 2 < n) ? i / 2 + 1 : -1;
+                if (c[i] != expected) {
+                    throw new RuntimeException("strided(" + n + "): c[" + i + "] = " + c[i] + ", expected " + expected);
+                }
+            }
+        }
+    }
+}
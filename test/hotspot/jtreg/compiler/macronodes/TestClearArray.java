@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+/**
+ * @test
+ * @summary Arrays zeroed by ClearArray must be fully cleared for every size,
+ *          on both sides of the rep stosb threshold
+ * @requires vm.compiler2.enabled
+ * @requires os.arch == "amd64" | os.arch == "x86_64" | os.arch == "x86" | os.arch == "i386"
+ *
+ * @run main/othervm -XX:-TieredCompilation
+ *                   compiler.macronodes.TestClearArray
+ * @run main/othervm -XX:-TieredCompilation -XX:+UnlockDiagnosticVMOptions
+ *                   -XX:FastStosbThreshold=0
+ *                   compiler.macronodes.TestClearArray
+ * @run main/othervm -XX:-TieredCompilation -XX:+UnlockDiagnosticVMOptions
+ *                   -XX:FastStosbThreshold=65536 -XX:AVX3Threshold=0
+ *                   compiler.macronodes.TestClearArray
+ */
+
+package compiler.macronodes;
+
+public class TestClearArray {
+    private static final int ITERATIONS = 20_000;
+    private static final int MAX_LENGTH = 8192;
+
+    static long[] sink;
+
+    static long[] allocate(int length) {
+        return new long[length];
+    }
+
+    static void dirty() {
+        // Leave non-zero garbage behind in memory that later TLABs reuse.
+        for (int i = 0; i < 64; i++) {
+            long[] a = new long[MAX_LENGTH / 8];
+            java.util.Arrays.fill(a, -1L);
+            sink = a;
+        }
+        System.gc();
+    }
+
+    public static void main(String[] args) {
+        for (int i = 0; i < ITERATIONS; i++) {
+            if (i % 1000 == 0) {
+                dirty();
+            }
+            int length = i % (MAX_LENGTH / 8 + 1);
+            long[] a = allocate(length);
+            for (int j = 0; j < length; j++) {
+                if (a[j] != 0) {
+                    throw new RuntimeException("length " + length + ": a[" + j + "] = " + a[j]);
+                }
+            }
+            java.util.Arrays.fill(a, -1L);
+            sink = a;
+        }
+    }
+}
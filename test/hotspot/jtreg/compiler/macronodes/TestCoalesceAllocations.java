@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+/**
+ * @test
+ * @summary Adjacent allocations sharing one TLAB bump must be fully
+ *          initialized and leave the heap parsable
+ * @requires vm.compiler2.enabled
+ *
+ * @run main/othervm -XX:-TieredCompilation -XX:+CoalesceAllocations
+ *                   -XX:-DoEscapeAnalysis
+ *                   compiler.macronodes.TestCoalesceAllocations
+ * @run main/othervm -XX:-TieredCompilation -XX:+CoalesceAllocations
+ *                   -XX:-DoEscapeAnalysis -XX:-ResizeTLAB -XX:TLABSize=2k
+ *                   -XX:+UnlockDiagnosticVMOptions -XX:+VerifyBeforeGC -XX:+VerifyAfterGC
+ *                   compiler.macronodes.TestCoalesceAllocations
+ */
+
+package compiler.macronodes;
+
+public class TestCoalesceAllocations {
+    private static final int ITERATIONS = 20_000;
+
+    static class Key {
+        final int hash;
+        Key(int hash) { this.hash = hash; }
+    }
+
+    static class Entry {
+        Key key;
+        Object value;
+        long seq;
+    }
+
+    static Object[] sink = new Object[64];
+
+    static Entry makeEntry(int i) {
+        Entry e = new Entry();
+        Key k = new Key(i);
+        e.key = k;
+        return e;
+    }
+
+    static Object[] makeArrayAndBox(int i) {
+        Object[] a = new Object[i & 7];
+        Key k = new Key(i);
+        if (a.length > 0) {
+            a[0] = k;
+        }
+        sink[i & 63] = k;
+        return a;
+    }
+
+    static Entry makeThree(int i) {
+        Entry e = new Entry();
+        Key k = new Key(i);
+        Entry n = new Entry();
+        e.key = k;
+        e.value = n;
+        n.seq = i;
+        return e;
+    }
+
+    public static void main(String[] args) {
+        for (int iter = 0; iter < ITERATIONS; iter++) {
+            Entry e = makeEntry(iter);
+            if (e.key.hash != iter || e.value != null || e.seq != 0) {
+                throw new RuntimeException("wrong entry at " + iter);
+            }
+            sink[iter & 63] = e;
+            Object[] a = makeArrayAndBox(iter);
+            if (a.length != (iter & 7)) {
+                throw new RuntimeException("wrong array length at " + iter);
+            }
+            for (int i = 1; i < a.length; i++) {
+                if (a[i] != null) {
+                    throw new RuntimeException("array not zeroed at " + iter);
+                }
+            }
+            Entry t = makeThree(iter);
+            Entry n = (Entry) t.value;
+            if (t.key.hash != iter || n.seq != iter || n.key != null || n.value != null) {
+                throw new RuntimeException("wrong chained allocation at " + iter);
+            }
+            if (t == n || (Object) t.key == n) {
+                throw new RuntimeException("overlapping chained allocations at " + iter);
+            }
+            if (iter % 5_000 == 0) {
+                System.gc();
+            }
+        }
+    }
+}
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+/**
+ * @test
+ * @summary Loading a class that invalidates a CHA dependency deoptimizes the
+ *          dependent nmethods with a handshake when DeoptimizeWithHandshakes
+ *          is enabled
+ * @requires vm.compMode != "Xint" & vm.opt.TieredStopAtLevel == null
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *
+ * @run driver compiler.runtime.TestDeoptimizeWithHandshakes
+ */
+
+package compiler.runtime;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestDeoptimizeWithHandshakes {
+    public static class Workload {
+        static class Base {
+            int value() { return 1; }
+        }
+
+        static class Sub extends Base {
+            int value() { return 2; }
+        }
+
+        static int call(Base b) {
+            // Inlined without a type check while Base has no subclass
+            return b.value();
+        }
+
+        public static void main(String[] args) throws Exception {
+            Base base = new Base();
+            int sum = 0;
+            for (int i = 0; i < 200_000; i++) {
+                sum += call(base);
+            }
+            // Loads Sub and invalidates the dependency of call()
+            Base sub = (Base) Class.forName(Workload.class.getName() + "$Sub")
+                                   .getDeclaredConstructor().newInstance();
+            if (call(sub) != 2) {
+                throw new RuntimeException("stale CHA inlining after class load");
+            }
+            System.out.println("sum " + sum);
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:+DeoptimizeWithHandshakes",
+            "-XX:-UseBiasedLocking",
+            "-XX:-BackgroundCompilation",
+            "-Xlog:handshake=debug",
+            Workload.class.getName());
+        OutputAnalyzer out = new OutputAnalyzer(pb.start());
+        out.shouldHaveExitValue(0);
+        out.shouldContain("sum 200000");
+        out.shouldMatch("Deoptimized [1-9][0-9]* nmethods with handshake");
+    }
+}
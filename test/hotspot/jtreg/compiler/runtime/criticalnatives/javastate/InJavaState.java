@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Call a critical native in the Java thread state while other
+ *          threads allocate and request GCs
+ * @requires os.arch == "amd64" | os.arch == "x86_64"
+ * @library /test/lib
+ * @run main/othervm/native -Xcomp -XX:+UnlockExperimentalVMOptions -XX:+CriticalJNINatives
+ *                          -XX:+CriticalNativesInJavaState
+ *                          compiler.runtime.criticalnatives.javastate.InJavaState
+ */
+
+/*
+ * @test
+ * @summary CriticalNativesInJavaState is ignored with a warning on other ports
+ * @requires os.arch != "amd64" & os.arch != "x86_64"
+ * @library /test/lib
+ * @run driver compiler.runtime.criticalnatives.javastate.InJavaState unsupported
+ */
+
+package compiler.runtime.criticalnatives.javastate;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class InJavaState {
+    static final int THREADS = 4;
+    static final int CALLS = 200_000;
+
+    static native long sum(int[] a);
+
+    public static void main(String[] args) throws Exception {
+        if (args.length > 0 && args[0].equals("unsupported")) {
+            ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+                "-XX:+UnlockExperimentalVMOptions",
+                "-XX:+CriticalNativesInJavaState",
+                "-XX:+PrintFlagsFinal",
+                "-version");
+            OutputAnalyzer out = new OutputAnalyzer(pb.start());
+            out.shouldHaveExitValue(0);
+            out.shouldContain("ignoring CriticalNativesInJavaState flag");
+            out.shouldMatch("bool CriticalNativesInJavaState\\s+= false");
+            return;
+        }
+
+        System.loadLibrary("CNInJavaState");
+
+        // Safepoints are requested all the time, so that they have to wait
+        // for calls in progress. The arrays must not move under the calls.
+        Thread gc = new Thread(() -> {
+            for (int i = 0; i < 200; i++) {
+                System.gc();
+            }
+        });
+        gc.setDaemon(true);
+        gc.start();
+
+        Thread[] threads = new Thread[THREADS];
+        Throwable[] failure = new Throwable[1];
+        for (int t = 0; t < THREADS; t++) {
+            threads[t] = new Thread(() -> {
+                try {
+                    for (int i = 0; i < CALLS; i++) {
+                        int[] a = new int[1 + i % 64];
+                        long expected = 0;
+                        for (int j = 0; j < a.length; j++) {
+                            a[j] = i + j;
+                            expected += i + j;
+                        }
+                        long s = sum(a);
+                        // The regular JNI function returns -1. Only compiled
+                        // callers use the critical native, hence -Xcomp.
+                        if (s == -1) {
+                            throw new RuntimeException("critical native was not used");
+                        }
+                        if (s != expected) {
+                            throw new RuntimeException("sum is " + s + ", expected " + expected);
+                        }
+                    }
+                } catch (Throwable e) {
+                    synchronized (failure) {
+                        failure[0] = e;
+                    }
+                }
+            });
+            threads[t].start();
+        }
+        for (Thread t : threads) {
+            t.join();
+        }
+        if (failure[0] != null) {
+            throw new RuntimeException(failure[0]);
+        }
+    }
+}
@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "jni.h"
+
+/*
+ * The critical entry point returns the sum of the array elements. The
+ * JNI entry point, which is only called if the critical one is not
+ * used, returns -1.
+ */
+JNIEXPORT jlong JNICALL JavaCritical_compiler_runtime_criticalnatives_javastate_InJavaState_sum
+  (jint length, jint* a) {
+  jlong sum = 0;
+  jint i;
+  for (i = 0; i < length; i++) {
+    sum += a[i];
+  }
+  return sum;
+}
+
+JNIEXPORT jlong JNICALL Java_compiler_runtime_criticalnatives_javastate_InJavaState_sum
+  (JNIEnv* env, jclass jclazz, jintArray a) {
+  return -1;
+}
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+/**
+ * @test
+ * @summary Methods compiled at tier 4 are written by CompilationProfileDumpFile
+ *          and read back by CompilationProfileLoadFile
+ * @requires vm.compiler2.enabled & vm.compMode != "Xint"
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *
+ * @run driver compiler.tiered.TestCompilationProfileCache
+ */
+
+package compiler.tiered;
+
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.nio.file.Paths;
+import java.util.List;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestCompilationProfileCache {
+    static final String ENTRY = "compiler/tiered/TestCompilationProfileCache$Workload hot (I)I";
+
+    public static class Workload {
+        static int hot(int x) {
+            return x * 31 + (x >>> 3);
+        }
+
+        public static void main(String[] args) {
+            int sum = 0;
+            for (int i = 0; i < 200_000; i++) {
+                sum += hot(i);
+            }
+            System.out.println("sum " + sum);
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        Path profile = Paths.get("compilation.profile");
+
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+            "-XX:+TieredCompilation", "-Xbatch",
+            "-XX:CompileCommand=dontinline,*Workload::hot",
+            "-XX:CompilationProfileDumpFile=" + profile,
+            Workload.class.getName());
+        new OutputAnalyzer(pb.start()).shouldHaveExitValue(0);
+
+        List<String> lines = Files.readAllLines(profile);
+        boolean found = false;
+        for (String line : lines) {
+            if (line.startsWith(ENTRY + " ")) {
+                found = true;
+            }
+        }
+        if (!found) {
+            throw new RuntimeException("No entry for Workload.hot in " + lines);
+        }
+
+        pb = ProcessTools.createJavaProcessBuilder(
+            "-XX:+TieredCompilation", "-Xbatch",
+            "-XX:CompileCommand=dontinline,*Workload::hot",
+            "-XX:CompilationProfileLoadFile=" + profile,
+            "-Xlog:jit+compilation=info",
+            Workload.class.getName());
+        OutputAnalyzer out = new OutputAnalyzer(pb.start());
+        out.shouldHaveExitValue(0);
+        out.shouldMatch("Loaded [1-9][0-9]* methods from compilation profile");
+    }
+}
@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+/**
+ * @test
+ * @summary Cost aware compile task selection compiles a small method queued
+ *          after a large one first, and the C1 queue statistics account for
+ *          the tasks in the perf counters and the CompilerQueueUtilization event
+ * @requires vm.compiler1.enabled & vm.compMode != "Xint" & vm.hasJFR
+ * @library /test/lib /
+ * @modules java.base/jdk.internal.misc
+ *          jdk.jfr
+ *
+ * @build sun.hotspot.WhiteBox
+ * @run driver ClassFileInstaller sun.hotspot.WhiteBox
+ *                                sun.hotspot.WhiteBox$WhiteBoxPermission
+ * @run driver compiler.tiered.TestCompileQueueCostAware
+ */
+
+package compiler.tiered;
+
+import java.lang.reflect.Method;
+import java.util.List;
+
+import jdk.jfr.Recording;
+import jdk.jfr.consumer.RecordedEvent;
+import jdk.test.lib.dcmd.PidJcmdExecutor;
+import jdk.test.lib.jfr.Events;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+import sun.hotspot.WhiteBox;
+
+public class TestCompileQueueCostAware {
+    private static final String SMALL = "TestCompileQueueCostAware$Workload::small";
+    private static final String LARGE = "TestCompileQueueCostAware$Workload::large";
+
+    public static class Workload {
+        private static final WhiteBox WB = WhiteBox.getWhiteBox();
+        private static final int LEVEL_SIMPLE = 1;
+
+        static int blocker(int x) {
+            return x - 1;
+        }
+
+        static int small(int x) {
+            return x + 1;
+        }
+
+        static int large(int x) {
+            int r = x;
+            for (int i = 0; i < 8; i++) {
+                r = r * 31 + (r >>> 3);
+                r ^= (r << 7) + i;
+                r += (r & 0xff) * (i + 1);
+                r -= (r >> 5) | i;
+            }
+            return r;
+        }
+
+        static void waitForCompiled(Method m) throws Exception {
+            while (!WB.isMethodCompiled(m)) {
+                Thread.sleep(10);
+            }
+        }
+
+        // Compiler.queue lists the tasks the compiler threads work on
+        // before the queues.
+        static void waitForCurrentCompile(String name) throws Exception {
+            PidJcmdExecutor jcmd = new PidJcmdExecutor();
+            while (true) {
+                String queue = jcmd.execute("Compiler.queue").getStdout();
+                int queues = queue.indexOf("compile queue:");
+                if (queues > 0 && queue.substring(0, queues).contains(name)) {
+                    return;
+                }
+                Thread.sleep(10);
+            }
+        }
+
+        static long counter(OutputAnalyzer out, String name) {
+            String value = out.firstMatch("sun\\.ci\\." + name.replace(".", "\\.") + "=(\\d+)", 1);
+            if (value == null) {
+                throw new RuntimeException("Perf counter sun.ci." + name + " missing");
+            }
+            return Long.parseLong(value);
+        }
+
+        public static void main(String[] args) throws Exception {
+            Method blocker = Workload.class.getDeclaredMethod("blocker", int.class);
+            Method small = Workload.class.getDeclaredMethod("small", int.class);
+            Method large = Workload.class.getDeclaredMethod("large", int.class);
+
+            try (Recording recording = new Recording()) {
+                recording.enable("jdk.CompilerQueueUtilization");
+                recording.start();
+
+                // The only C1 thread takes the blocker and waits for the
+                // unlock in the compiler, so that the large and the small
+                // method are both in the queue at the next selection.
+                WB.lockCompilation();
+                WB.enqueueMethodForCompilation(blocker, LEVEL_SIMPLE);
+                waitForCurrentCompile("Workload::blocker");
+                WB.enqueueMethodForCompilation(large, LEVEL_SIMPLE);
+                WB.enqueueMethodForCompilation(small, LEVEL_SIMPLE);
+                WB.unlockCompilation();
+
+                waitForCompiled(small);
+                waitForCompiled(large);
+                recording.stop();
+
+                RecordedEvent c1 = null;
+                for (RecordedEvent e : Events.fromRecording(recording)) {
+                    if ("c1".equals(e.getString("compiler"))) {
+                        c1 = e;
+                    }
+                }
+                if (c1 == null) {
+                    throw new RuntimeException("No CompilerQueueUtilization event for c1");
+                }
+                System.out.println(c1);
+                // Only the three methods of Workload are compiled, and the large
+                // and the small method were queued at the same time.
+                if (c1.getLong("totalAddedCount") != 3 || c1.getLong("totalRemovedCount") != 3) {
+                    throw new RuntimeException("Expected 3 tasks added and removed");
+                }
+                if (c1.getInt("queueSize") != 0 || c1.getInt("peakQueueSize") != 2) {
+                    throw new RuntimeException("Expected an empty queue with a peak of 2 tasks");
+                }
+                if (c1.getInt("compilerThreadCount") != 1) {
+                    throw new RuntimeException("Expected 1 compiler thread");
+                }
+                if (c1.getLong("totalWaitTime") < 0) {
+                    throw new RuntimeException("Negative wait time");
+                }
+            }
+
+            OutputAnalyzer out = new PidJcmdExecutor().execute("PerfCounter.print");
+            long added = counter(out, "c1Queue.added");
+            long removed = counter(out, "c1Queue.removed");
+            long waited = 0;
+            for (String bucket : new String[] { "wait1ms", "wait10ms", "wait100ms", "wait1s", "waitOver1s" }) {
+                waited += counter(out, "c1Queue." + bucket);
+            }
+            if (added != 3 || removed != 3 || waited != 3) {
+                throw new RuntimeException("Expected 3 tasks in the perf counters: added " + added +
+                                           ", removed " + removed + ", wait histogram " + waited);
+            }
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        // A single C1 thread that only compiles Workload, and a deferral that
+        // does not expire during the test: the large method is only selected
+        // once the small one is gone.
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+            "-Xbootclasspath/a:.",
+            "-XX:+UnlockDiagnosticVMOptions",
+            "-XX:+WhiteBoxAPI",
+            "-XX:+TieredCompilation",
+            "-XX:CICompilerCount=2",
+            "-XX:-UseDynamicNumberOfCompilerThreads",
+            "-XX:+UsePerfData",
+            "-XX:+TieredCompileTaskCostAware",
+            "-XX:TieredCompileTaskDeferSize=20",
+            "-XX:TieredCompileTaskMaxDeferral=600000",
+            "-XX:CompileCommand=quiet",
+            "-XX:CompileCommand=compileonly," + Workload.class.getName() + "::*",
+            "-XX:+PrintCompilation",
+            Workload.class.getName());
+        OutputAnalyzer out = new OutputAnalyzer(pb.start());
+        out.shouldHaveExitValue(0);
+        String stdout = out.getStdout();
+        int small = stdout.indexOf(SMALL);
+        int large = stdout.indexOf(LARGE);
+        if (small < 0 || large < 0) {
+            throw new RuntimeException("Both methods must be compiled");
+        }
+        if (small > large) {
+            throw new RuntimeException("The deferred large method was compiled before the small one");
+        }
+    }
+}
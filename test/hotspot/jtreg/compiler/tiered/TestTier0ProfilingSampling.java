@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+/**
+ * @test
+ * @summary Sampling the event rate before profiling in the interpreter
+ *          still lets hot methods reach the highest tier
+ * @requires vm.compiler2.enabled & vm.compMode != "Xint"
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *
+ * @run driver compiler.tiered.TestTier0ProfilingSampling
+ */
+
+package compiler.tiered;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestTier0ProfilingSampling {
+    public static class Workload {
+        static int hot(int x) {
+            return (x * 31) ^ (x >>> 7);
+        }
+
+        public static void main(String[] args) {
+            int sum = 0;
+            for (int i = 0; i < 1_000_000; i++) {
+                sum += hot(i);
+            }
+            System.out.println("sum " + sum);
+        }
+    }
+
+    static void run(String rate) throws Exception {
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+            "-XX:+TieredCompilation",
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:Tier0ProfilingMinRate=" + rate,
+            "-XX:+PrintCompilation",
+            Workload.class.getName());
+        OutputAnalyzer out = new OutputAnalyzer(pb.start());
+        out.shouldHaveExitValue(0);
+        out.shouldMatch("4 +compiler\\.tiered\\.TestTier0ProfilingSampling\\$Workload::hot");
+    }
+
+    public static void main(String[] args) throws Exception {
+        run("0");
+        run("10");
+        run("1000000");
+    }
+}
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test TestCPUAwareConcRefinement
+ * @requires vm.gc.G1
+ * @key gc
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.management
+ * @summary Ensure that the CPU aware refinement thread limit is computed and
+ * reported for various numbers of concurrent refinement threads.
+ * @run main/othervm TestCPUAwareConcRefinement
+ */
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestCPUAwareConcRefinement {
+
+  private static void runTest(int refinementThreads) throws Exception {
+    ProcessBuilder pb = ProcessTools.createJavaProcessBuilder("-XX:+UseG1GC",
+                                                              "-XX:+UnlockExperimentalVMOptions",
+                                                              "-XX:+G1UseCPUAwareConcRefinement",
+                                                              "-XX:G1ConcRefinementThreads=" + refinementThreads,
+                                                              "-Xmn4m",
+                                                              "-Xmx64m",
+                                                              "-Xlog:gc+phases=debug,gc+ergo+refine=debug",
+                                                              GCTest.class.getName());
+
+    OutputAnalyzer output = new OutputAnalyzer(pb.start());
+    output.shouldHaveExitValue(0);
+    if (refinementThreads > 0) {
+      output.shouldContain("Updated Active Refinement Threads Limit");
+    }
+    output.shouldContain("Active Refinement Threads Limit: ");
+  }
+
+  public static void main(String[] args) throws Exception {
+    runTest(0);
+    runTest(1);
+    runTest(4);
+  }
+
+  static class GCTest {
+    private static byte[] garbage;
+
+    public static void main(String[] args) {
+      for (int i = 0; i < 64 * 1024; i++) {
+        garbage = new byte[1024];
+      }
+      System.gc();
+    }
+  }
+}
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test TestEagerReclaimHumongousObjArrays
+ * @summary Test to make sure that humongous object arrays that die young are
+ * eagerly reclaimed at young GCs outside of concurrent marking. We fill up the
+ * heap with short-lived humongous object arrays referencing young objects; if
+ * they are not reclaimed eagerly the VM has to resort to Full GCs.
+ * @key gc
+ * @requires vm.gc.G1
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.management
+ */
+
+import java.util.regex.Pattern;
+import java.util.regex.Matcher;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+import static jdk.test.lib.Asserts.*;
+
+class ReclaimObjArrays {
+
+    public static final int M = 1024*1024;
+
+    public static void main(String[] args) {
+        Object[] large = null;
+        for (int i = 0; i < 100; i++) {
+            // A large object array that will be reclaimed eagerly.
+            large = new Object[4*M];
+            for (int j = 0; j < large.length; j += 1024) {
+                large[j] = new int[16];
+            }
+        }
+        System.out.println(large.length);
+    }
+}
+
+public class TestEagerReclaimHumongousObjArrays {
+
+    private static int countFullGCs(boolean objArrays) throws Exception {
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+            "-XX:+UseG1GC",
+            "-Xms128M",
+            "-Xmx128M",
+            "-Xmn16M",
+            "-XX:+UseCompressedOops",
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:" + (objArrays ? "+" : "-") + "G1EagerReclaimHumongousObjArrays",
+            // Avoid concurrent cycles, object arrays are not reclaimed during them.
+            "-XX:-G1UseAdaptiveIHOP",
+            "-XX:InitiatingHeapOccupancyPercent=100",
+            "-Xlog:gc,gc+humongous=debug",
+            ReclaimObjArrays.class.getName());
+
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+
+        int found = 0;
+        Matcher m = Pattern.compile("Pause Full").matcher(output.getStdout());
+        while (m.find()) {
+            found++;
+        }
+        System.out.println("Issued " + found + " Full GCs with G1EagerReclaimHumongousObjArrays " + objArrays);
+        if (objArrays) {
+            output.shouldContain("Dead humongous region");
+        }
+        return found;
+    }
+
+    public static void main(String[] args) throws Exception {
+        int found = countFullGCs(true);
+        assertLessThan(found, 10, "Found that " + found + " Full GCs were issued. This is larger than the bound. Eager reclaim of humongous object arrays seems to not work at all");
+        countFullGCs(false);
+    }
+}
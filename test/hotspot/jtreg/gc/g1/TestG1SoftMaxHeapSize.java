@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/**
+ * @test TestG1SoftMaxHeapSize
+ * @requires vm.gc.G1
+ * @summary G1 shrinks the heap to a G1SoftMaxHeapSize set with jcmd
+ *          VM.set_flag and does not expand it past it
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.management
+ * @run main/othervm -XX:+UseG1GC -Xms16m -Xmx512m -XX:MaxNewSize=16m
+ *                   -XX:G1HeapRegionSize=1m -Xlog:gc,gc+ergo+heap=debug
+ *                   TestG1SoftMaxHeapSize
+ */
+
+/**
+ * @test TestG1SoftMaxHeapSize
+ * @requires vm.gc.G1
+ * @summary HeapLimitPollInterval starts polling the available memory,
+ *          unless MaxRAM is set
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.management
+ * @run driver TestG1SoftMaxHeapSize poll
+ */
+
+import java.lang.management.ManagementFactory;
+
+import com.sun.management.HotSpotDiagnosticMXBean;
+
+import jdk.test.lib.dcmd.PidJcmdExecutor;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestG1SoftMaxHeapSize {
+    private static final long M = 1024 * 1024;
+    private static final long SOFT_MAX = 64 * M;
+    private static final long LOWER_SOFT_MAX = 32 * M;
+
+    private static Object[] live;
+    private static Object sink;
+
+    private static long committed() {
+        return ManagementFactory.getMemoryMXBean().getHeapMemoryUsage().getCommitted();
+    }
+
+    private static void setSoftMax(long size) {
+        new PidJcmdExecutor().execute("VM.set_flag G1SoftMaxHeapSize " + size);
+        String value = ManagementFactory.getPlatformMXBean(HotSpotDiagnosticMXBean.class)
+                                        .getVMOption("G1SoftMaxHeapSize").getValue();
+        if (!value.equals(Long.toString(size))) {
+            throw new RuntimeException("G1SoftMaxHeapSize is " + value + ", expected " + size);
+        }
+    }
+
+    private static void checkCommitted(long limit, String when) {
+        long committed = committed();
+        System.out.println(when + ": committed " + committed / M + "M");
+        if (committed > limit) {
+            throw new RuntimeException(when + ": committed heap " + committed / M +
+                                       "M is above the soft max heap size " + limit / M + "M");
+        }
+    }
+
+    private static void checkPolling() throws Exception {
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+            "-XX:+UseG1GC", "-XX:HeapLimitPollInterval=100", "-Xlog:gc+ergo=info", "-version");
+        OutputAnalyzer out = new OutputAnalyzer(pb.start());
+        out.shouldHaveExitValue(0);
+        out.shouldContain("Polling the available memory every 100 ms");
+
+        pb = ProcessTools.createJavaProcessBuilder(
+            "-XX:+UseG1GC", "-XX:HeapLimitPollInterval=100", "-XX:MaxRAM=1g", "-Xlog:gc+ergo=info", "-version");
+        out = new OutputAnalyzer(pb.start());
+        out.shouldHaveExitValue(0);
+        out.shouldNotContain("Polling the available memory");
+    }
+
+    public static void main(String[] args) throws Exception {
+        if (args.length > 0 && args[0].equals("poll")) {
+            checkPolling();
+            return;
+        }
+
+        // Grow the heap well past the soft max heap size.
+        live = new Object[200];
+        for (int i = 0; i < live.length; i++) {
+            live[i] = new byte[(int) M];
+        }
+        if (committed() <= SOFT_MAX) {
+            throw new RuntimeException("The heap did not grow past " + SOFT_MAX / M + "M");
+        }
+        live = null;
+
+        // A full collection shrinks the heap to the soft max heap size.
+        setSoftMax(SOFT_MAX);
+        System.gc();
+        checkCommitted(SOFT_MAX, "after full GC");
+
+        // Young collections with a small live set do not expand it again.
+        for (int i = 0; i < 1_000_000; i++) {
+            sink = new byte[1024];
+        }
+        checkCommitted(SOFT_MAX, "after young GCs");
+
+        // Without any collection by the application, a lower soft max heap
+        // size makes G1 start one that shrinks the heap. It only does so
+        // when less than the new soft max heap size is used, which the
+        // MaxNewSize makes sure of.
+        setSoftMax(LOWER_SOFT_MAX);
+        while (committed() > LOWER_SOFT_MAX) {
+            Thread.sleep(100);
+        }
+        checkCommitted(LOWER_SOFT_MAX, "after lowering the soft max heap size");
+    }
+}
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test TestPinnedHumongous
+ * @summary A humongous array in a JNI critical section is pinned without
+ *          the GCLocker, so young and full collections still run
+ * @key gc
+ * @requires vm.gc.G1
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.management
+ * @run main/othervm/native TestPinnedHumongous
+ */
+
+import java.lang.management.GarbageCollectorMXBean;
+import java.lang.management.ManagementFactory;
+
+import jdk.test.lib.Utils;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestPinnedHumongous {
+    public static void main(String[] args) throws Exception {
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+            "-Djava.library.path=" + Utils.TEST_NATIVE_PATH,
+            "-XX:+UseG1GC",
+            "-Xmx256m",
+            "-XX:G1HeapRegionSize=1m",
+            "-Xlog:gc",
+            Workload.class.getName());
+        OutputAnalyzer out = new OutputAnalyzer(pb.start());
+        out.shouldHaveExitValue(0);
+        out.shouldContain("Pause Young");
+        out.shouldContain("Pause Full");
+        out.shouldNotContain("GCLocker Initiated GC");
+        out.shouldContain("done");
+    }
+
+    public static class Workload {
+        // Four regions, so the array is humongous
+        static final int LENGTH = 1024 * 1024;
+        static volatile Object sink;
+
+        static long collections() {
+            long count = 0;
+            for (GarbageCollectorMXBean gc : ManagementFactory.getGarbageCollectorMXBeans()) {
+                count += gc.getCollectionCount();
+            }
+            return count;
+        }
+
+        public static void main(String[] args) {
+            System.loadLibrary("TestPinnedHumongous");
+
+            int[] array = new int[LENGTH];
+            long expected = 0;
+            for (int i = 0; i < LENGTH; i++) {
+                array[i] = i;
+                expected += i;
+            }
+
+            long before = collections();
+            pin(array);
+            // Young collections, while this thread is in the critical section
+            for (int i = 0; i < 2_000_000; i++) {
+                sink = new byte[256];
+            }
+            System.gc();
+            if (collections() <= before + 1) {
+                throw new RuntimeException("No young collections while the array was pinned");
+            }
+
+            // The array has not moved, the pinned address still sees its updates.
+            array[0] = 42;
+            expected += 42;
+            long sum = sumPinned();
+            unpin(array);
+            if (sum != expected) {
+                throw new RuntimeException("Pinned array sum " + sum + ", expected " + expected);
+            }
+            System.out.println("done");
+        }
+    }
+
+    static native void pin(int[] a);
+    static native void unpin(int[] a);
+    static native long sumPinned();
+}
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test TestStringDeduplicationParallel
+ * @summary Test string deduplication with young and full GCs of Parallel GC,
+ *          and of strings that stay in the young generation
+ * @key gc
+ * @requires vm.gc.Parallel
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.management
+ * @run main TestStringDeduplicationParallel
+ */
+
+import java.lang.reflect.Field;
+import java.util.ArrayList;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestStringDeduplicationParallel {
+    private static final int Xmn = 50;  // MB
+    private static final int MB = 1024 * 1024;
+    private static final int Unique = 100;
+    private static final int Total = 10000;
+    private static final int AgeThreshold = 2;
+
+    private static byte[] dummy;
+
+    public static void main(String[] args) throws Exception {
+        for (String fullGC : new String[] { "-XX:-UseParallelOldGC", "-XX:+UseParallelOldGC" }) {
+            ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+                "-Xmn" + Xmn + "m",
+                "-Xms100m",
+                "-Xmx100m",
+                "-XX:+UseParallelGC",
+                fullGC,
+                "-XX:+UseStringDeduplication",
+                "-XX:StringDeduplicationAgeThreshold=" + AgeThreshold,
+                "-XX:+UnlockDiagnosticVMOptions",
+                "-XX:+VerifyAfterGC",
+                "-XX:+StringDeduplicationResizeALot",
+                "--add-opens=java.base/java.lang=ALL-UNNAMED",
+                "-Xlog:gc+stringdedup=debug",
+                Tester.class.getName());
+            OutputAnalyzer output = new OutputAnalyzer(pb.start());
+            System.out.println(output.getStdout());
+            output.shouldContain("Deduplication completed");
+            output.shouldHaveExitValue(0);
+        }
+
+        // Strings that survive young GCs without being promoted must be
+        // deduplicated too, from their copies in the survivor space.
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+            "-Xmn" + Xmn + "m",
+            "-Xms100m",
+            "-Xmx100m",
+            "-XX:+UseParallelGC",
+            "-XX:-UseAdaptiveSizePolicy",
+            "-XX:SurvivorRatio=4",
+            "-XX:InitialTenuringThreshold=15",
+            "-XX:MaxTenuringThreshold=15",
+            "-XX:+UseStringDeduplication",
+            "-XX:StringDeduplicationAgeThreshold=" + AgeThreshold,
+            "-XX:+UnlockDiagnosticVMOptions",
+            "-XX:+VerifyAfterGC",
+            "--add-opens=java.base/java.lang=ALL-UNNAMED",
+            "-Xlog:gc+stringdedup=debug",
+            Tester.class.getName(),
+            "young");
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        System.out.println(output.getStdout());
+        output.shouldContain("Deduplication completed");
+        output.shouldNotContain("Pause Full");
+        output.shouldHaveExitValue(0);
+    }
+
+    static class Tester {
+        public static void main(String[] args) throws Exception {
+            boolean youngOnly = args.length > 0 && args[0].equals("young");
+            Field valueField = String.class.getDeclaredField("value");
+            valueField.setAccessible(true);
+
+            ArrayList<String> list = new ArrayList<String>(Total);
+            for (int i = 0; i < Total; i++) {
+                list.add(new StringBuilder("DeduplicationTestString:").append(i % Unique).toString());
+            }
+
+            // Age the strings past the threshold with young GCs, then move
+            // them around with a full GC while the queue may be non-empty.
+            for (int gc = 0; gc < AgeThreshold + 3; gc++) {
+                for (int j = 0; j < (Xmn * MB) / 128 + 1; j++) {
+                    dummy = new byte[128];
+                }
+            }
+            if (!youngOnly) {
+                System.gc();
+            }
+
+            for (int attempts = 0; attempts < 10; attempts++) {
+                ArrayList<Object> unique = new ArrayList<Object>();
+                for (String s : list) {
+                    Object value = valueField.get(s);
+                    boolean found = false;
+                    for (Object obj : unique) {
+                        if (obj == value) {
+                            found = true;
+                            break;
+                        }
+                    }
+                    if (!found) {
+                        unique.add(value);
+                    }
+                }
+                System.out.println("Verifying strings: uniqueFound=" + unique.size() +
+                                   ", uniqueExpected=" + Unique);
+                if (unique.size() == Unique) {
+                    System.out.println("Deduplication completed");
+                    return;
+                }
+                Thread.sleep(1000);
+            }
+            throw new RuntimeException("String verification failed");
+        }
+    }
+}
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test TestConcurrentWeakRoots
+ * @summary Clean the StringTable, the ResolvedMethodTable and VM weak
+ *          handles, and purge unloaded classes, in the concurrent weak
+ *          roots phase
+ * @requires vm.gc.Shenandoah & !vm.graal.enabled
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ * @run driver TestConcurrentWeakRoots
+ */
+
+import java.io.InputStream;
+import java.lang.invoke.MethodHandle;
+import java.lang.invoke.MethodHandles;
+import java.lang.invoke.MethodType;
+import java.util.ArrayList;
+import java.util.List;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestConcurrentWeakRoots {
+    public static void main(String[] args) throws Exception {
+        String[][] configs = {
+            { "-XX:ShenandoahGCHeuristics=aggressive", "-XX:+ShenandoahVerify" },
+            { "-XX:ShenandoahGCHeuristics=aggressive" },
+            { "-XX:ShenandoahGCMode=iu", "-XX:ShenandoahGCHeuristics=aggressive" },
+        };
+        for (String[] config : configs) {
+            List<String> opts = new ArrayList<>();
+            opts.add("-Xmx256m");
+            opts.add("-XX:+UnlockExperimentalVMOptions");
+            opts.add("-XX:+UnlockDiagnosticVMOptions");
+            opts.add("-XX:+UseShenandoahGC");
+            opts.add("-XX:+ShenandoahConcurrentWeakRoots");
+            for (String c : config) {
+                opts.add(c);
+            }
+            opts.add("-Xlog:gc,class+unload=info");
+            opts.add(Workload.class.getName());
+            ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(opts.toArray(new String[0]));
+            OutputAnalyzer out = new OutputAnalyzer(pb.start());
+            out.shouldHaveExitValue(0);
+            out.shouldContain("Concurrent weak roots");
+            out.shouldContain("[class,unload");
+            out.shouldContain("done");
+        }
+    }
+
+    public static class Payload {
+        public static int twice(int x) {
+            return 2 * x;
+        }
+    }
+
+    static class PayloadLoader extends ClassLoader {
+        private final byte[] bytes;
+
+        PayloadLoader(byte[] bytes) {
+            super(TestConcurrentWeakRoots.class.getClassLoader());
+            this.bytes = bytes;
+        }
+
+        @Override
+        protected Class<?> loadClass(String name, boolean resolve) throws ClassNotFoundException {
+            if (name.equals(Payload.class.getName())) {
+                synchronized (getClassLoadingLock(name)) {
+                    Class<?> c = findLoadedClass(name);
+                    if (c == null) {
+                        c = defineClass(name, bytes, 0, bytes.length);
+                    }
+                    return c;
+                }
+            }
+            return super.loadClass(name, resolve);
+        }
+    }
+
+    public static class Workload {
+        static final int KEPT = 10_000;
+
+        public static void main(String[] args) throws Throwable {
+            String resource = Payload.class.getName().replace('.', '/') + ".class";
+            byte[] bytes;
+            try (InputStream in = TestConcurrentWeakRoots.class.getClassLoader().getResourceAsStream(resource)) {
+                bytes = in.readAllBytes();
+            }
+
+            // Interned strings that stay live must survive the cleaning of
+            // the StringTable, the others are dropped.
+            String[] kept = new String[KEPT];
+            for (int i = 0; i < KEPT; i++) {
+                kept[i] = ("kept" + i).intern();
+            }
+
+            long end = System.currentTimeMillis() + 5_000;
+            int round = 0;
+            while (System.currentTimeMillis() < end) {
+                for (int i = 0; i < 1_000; i++) {
+                    ("dropped" + round + "_" + i).intern();
+                }
+
+                // The method handle adds a ResolvedMethodTable entry, which
+                // dies with the class.
+                Class<?> c = new PayloadLoader(bytes).loadClass(Payload.class.getName());
+                MethodHandle mh = MethodHandles.lookup().findStatic(c, "twice",
+                                                                    MethodType.methodType(int.class, int.class));
+                int v = (int) mh.invokeExact(round);
+                if (v != 2 * round) {
+                    throw new RuntimeException("twice(" + round + ") = " + v);
+                }
+
+                for (int i = 0; i < KEPT; i += 97) {
+                    String s = new String(("kept" + i).toCharArray());
+                    if (s.intern() != kept[i]) {
+                        throw new RuntimeException("Interned string kept" + i + " was lost");
+                    }
+                }
+                round++;
+            }
+            System.out.println("done");
+        }
+    }
+}
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test TestGenerationalMode
+ * @summary Regions that survive enough cycles become old, and the
+ *          heuristics skip old regions with little garbage
+ * @requires vm.gc.Shenandoah & !vm.graal.enabled
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ * @run driver TestGenerationalMode
+ */
+
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestGenerationalMode {
+    public static void main(String[] args) throws Exception {
+        // The retained data is never collected, so its regions become old.
+        OutputAnalyzer out = run("-XX:ShenandoahTenuringThreshold=3");
+        long[] max = maxGenerations(out);
+        if (max[1] == 0) {
+            throw new RuntimeException("No region became old");
+        }
+        if (max[2] == 0) {
+            throw new RuntimeException("No old region was skipped");
+        }
+
+        // With the highest threshold and every old region considered for
+        // collection, the mode still runs correctly.
+        out = run("-XX:ShenandoahTenuringThreshold=16", "-XX:ShenandoahOldGarbageThreshold=0");
+        max = maxGenerations(out);
+        if (max[2] != 0) {
+            throw new RuntimeException("Old regions skipped with ShenandoahOldGarbageThreshold=0");
+        }
+    }
+
+    static OutputAnalyzer run(String... flags) throws Exception {
+        String[] opts = new String[flags.length + 8];
+        int i = 0;
+        opts[i++] = "-Xmx256m";
+        opts[i++] = "-XX:+UnlockExperimentalVMOptions";
+        opts[i++] = "-XX:+UnlockDiagnosticVMOptions";
+        opts[i++] = "-XX:+UseShenandoahGC";
+        opts[i++] = "-XX:ShenandoahGCMode=generational";
+        opts[i++] = "-XX:ShenandoahGCHeuristics=aggressive";
+        opts[i++] = "-Xlog:gc+ergo=info";
+        for (String f : flags) {
+            opts[i++] = f;
+        }
+        opts[i++] = Workload.class.getName();
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(opts);
+        OutputAnalyzer out = new OutputAnalyzer(pb.start());
+        out.shouldHaveExitValue(0);
+        out.shouldContain("done");
+        return out;
+    }
+
+    // Returns the highest young, old and skipped region counts logged
+    static long[] maxGenerations(OutputAnalyzer out) {
+        Pattern p = Pattern.compile("Generations: (\\d+) young regions, (\\d+) old regions, (\\d+) old regions skipped");
+        Matcher m = p.matcher(out.getStdout());
+        long[] max = new long[3];
+        boolean found = false;
+        while (m.find()) {
+            found = true;
+            for (int g = 0; g < 3; g++) {
+                max[g] = Math.max(max[g], Long.parseLong(m.group(g + 1)));
+            }
+        }
+        if (!found) {
+            throw new RuntimeException("No generations were logged");
+        }
+        return max;
+    }
+
+    public static class Workload {
+        static final int RETAINED = 500_000;
+        static Integer[] retained;
+        static volatile Object sink;
+
+        public static void main(String[] args) {
+            retained = new Integer[RETAINED];
+            for (int i = 0; i < RETAINED; i++) {
+                retained[i] = new Integer(i);
+            }
+            long end = System.currentTimeMillis() + 5_000;
+            while (System.currentTimeMillis() < end) {
+                for (int i = 0; i < 10_000; i++) {
+                    sink = new byte[128];
+                }
+            }
+            for (int i = 0; i < RETAINED; i++) {
+                if (retained[i].intValue() != i) {
+                    throw new RuntimeException("retained[" + i + "] = " + retained[i]);
+                }
+            }
+            System.out.println("done");
+        }
+    }
+}
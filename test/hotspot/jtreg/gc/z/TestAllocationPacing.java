@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test TestAllocationPacing
+ * @requires vm.gc.Z
+ * @key gc
+ * @library /test/lib
+ * @summary Test ZGC allocation pacing when running low on memory
+ * @run main/othervm TestAllocationPacing
+ */
+
+import java.util.ArrayList;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestAllocationPacing {
+
+  private static void runTest(boolean pacing) throws Exception {
+    ProcessBuilder pb = ProcessTools.createJavaProcessBuilder("-XX:+UnlockExperimentalVMOptions",
+                                                              "-XX:+UseZGC",
+                                                              "-Xms256m",
+                                                              "-Xmx256m",
+                                                              "-XX:" + (pacing ? "+" : "-") + "ZAllocationPacing",
+                                                              "-XX:ZAllocationPacingThreshold=50",
+                                                              "-Xlog:gc=debug",
+                                                              Allocate.class.getName());
+
+    OutputAnalyzer output = new OutputAnalyzer(pb.start());
+    output.shouldHaveExitValue(0);
+    if (pacing) {
+      output.shouldContain("Allocation Pacing");
+    } else {
+      output.shouldNotContain("Allocation Pacing");
+    }
+  }
+
+  public static void main(String[] args) throws Exception {
+    runTest(true);
+    runTest(false);
+  }
+
+  static class Allocate {
+    private static ArrayList<byte[]> keepAlive;
+    private static volatile byte[] sink;
+
+    public static void main(String[] args) throws Exception {
+      // Keep a large live set, so that free memory stays below the threshold
+      keepAlive = new ArrayList<>();
+      for (int i = 0; i < 160; i++) {
+        keepAlive.add(new byte[1024 * 1024]);
+      }
+
+      // Churn through short-lived objects
+      final long end = System.currentTimeMillis() + 5000;
+      while (System.currentTimeMillis() < end) {
+        sink = new byte[64 * 1024];
+      }
+    }
+  }
+}
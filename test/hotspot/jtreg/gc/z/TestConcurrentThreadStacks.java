@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test TestConcurrentThreadStacks
+ * @requires vm.gc.Z
+ * @key gc
+ * @summary Test ZGC concurrent scanning of thread stacks
+ * @run main/othervm -XX:+UnlockExperimentalVMOptions -XX:+UseZGC -XX:+ZConcurrentThreadStacks
+ *                   -XX:+UnlockDiagnosticVMOptions -XX:+ZVerifyRoots -XX:+ZVerifyObjects
+ *                   -Xmx256m TestConcurrentThreadStacks
+ */
+
+public class TestConcurrentThreadStacks {
+  private static final int Threads = 32;
+  private static final int Depth = 200;
+  private static final int Collections = 20;
+
+  private static volatile boolean done = false;
+  private static volatile Object sink;
+  private static volatile Throwable failure;
+
+  private static class Node {
+    final int value;
+    final Node next;
+
+    Node(int value, Node next) {
+      this.value = value;
+      this.next = next;
+    }
+  }
+
+  private static class Worker extends Thread {
+    private final boolean sleeping;
+
+    Worker(boolean sleeping) {
+      this.sleeping = sleeping;
+    }
+
+    // Keeps a chain of objects reachable only from the stack,
+    // and verifies it after returning from each frame
+    private void recurse(Node node, int depth) throws InterruptedException {
+      if (depth == 0) {
+        while (!done) {
+          if (sleeping) {
+            Thread.sleep(1);
+          } else {
+            sink = new byte[128];
+          }
+        }
+        return;
+      }
+
+      final Node local = new Node(depth, node);
+      recurse(local, depth - 1);
+
+      if (local.value != depth || local.next != node) {
+        throw new RuntimeException("Corrupt stack reference at depth " + depth);
+      }
+    }
+
+    @Override
+    public void run() {
+      try {
+        recurse(null, Depth);
+      } catch (Throwable t) {
+        failure = t;
+      }
+    }
+  }
+
+  public static void main(String[] args) throws Exception {
+    final Worker[] workers = new Worker[Threads];
+    for (int i = 0; i < Threads; i++) {
+      workers[i] = new Worker(i % 2 == 0);
+      workers[i].start();
+    }
+
+    for (int i = 0; i < Collections; i++) {
+      System.gc();
+      Thread.sleep(10);
+    }
+
+    done = true;
+
+    for (Worker worker : workers) {
+      worker.join();
+    }
+
+    if (failure != null) {
+      throw new RuntimeException("Worker failed", failure);
+    }
+  }
+}
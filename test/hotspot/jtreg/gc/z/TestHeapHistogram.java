@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test TestHeapHistogram
+ * @requires vm.gc.Z
+ * @key gc
+ * @library /test/lib
+ * @summary Test ZGC parallel heap iteration used by class histograms
+ * @run main/othervm -XX:+UnlockExperimentalVMOptions -XX:+UseZGC -Xmx256m TestHeapHistogram
+ */
+
+import java.util.ArrayList;
+import jdk.test.lib.JDKToolLauncher;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestHeapHistogram {
+  private static final int Instances = 100_000;
+
+  private static class Marker {
+    final Marker next;
+
+    Marker(Marker next) {
+      this.next = next;
+    }
+  }
+
+  private static ArrayList<Marker> keepAlive;
+
+  private static OutputAnalyzer histogram(String option) throws Exception {
+    final JDKToolLauncher launcher = JDKToolLauncher.createUsingTestJDK("jmap");
+    launcher.addToolArg(option);
+    launcher.addToolArg(Long.toString(ProcessTools.getProcessId()));
+
+    final OutputAnalyzer output = ProcessTools.executeProcess(new ProcessBuilder(launcher.getCommand()));
+    output.shouldHaveExitValue(0);
+    return output;
+  }
+
+  public static void main(String[] args) throws Exception {
+    // Create both short chains and one long chain, to give
+    // the workers a mix of wide and deep object graphs.
+    keepAlive = new ArrayList<>();
+    Marker chain = null;
+    for (int i = 0; i < Instances; i++) {
+      if (i % 2 == 0) {
+        keepAlive.add(new Marker(null));
+      } else {
+        chain = new Marker(chain);
+      }
+    }
+    keepAlive.add(chain);
+
+    // Every reachable instance must be visited exactly once,
+    // regardless of the number of workers.
+    final String expected = "\\s" + Instances + "\\s+\\d+\\s+TestHeapHistogram\\$Marker";
+    histogram("-histo:parallel=1").shouldMatch(expected);
+    histogram("-histo:parallel=4").shouldMatch(expected);
+  }
+}
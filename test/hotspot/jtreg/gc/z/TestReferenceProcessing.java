@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test TestReferenceProcessing
+ * @requires vm.gc.Z
+ * @key gc
+ * @library /test/lib
+ * @summary Test ZGC parallel processing of many discovered references
+ * @run main/othervm TestReferenceProcessing
+ */
+
+import java.lang.ref.PhantomReference;
+import java.lang.ref.ReferenceQueue;
+import java.lang.ref.WeakReference;
+import java.util.ArrayList;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestReferenceProcessing {
+
+  public static void main(String[] args) throws Exception {
+    ProcessBuilder pb = ProcessTools.createJavaProcessBuilder("-XX:+UnlockExperimentalVMOptions",
+                                                              "-XX:+UseZGC",
+                                                              "-Xmx256m",
+                                                              "-XX:ConcGCThreads=4",
+                                                              "-Xlog:gc+ref=debug",
+                                                              Allocate.class.getName());
+
+    OutputAnalyzer output = new OutputAnalyzer(pb.start());
+    output.shouldHaveExitValue(0);
+    output.shouldMatch("Reference Chunks: [1-9]");
+    output.shouldMatch("Phantom: [0-9]+ encountered, [0-9]+ discovered, [0-9]+ enqueued, [0-9.]+ms processed");
+  }
+
+  static class Allocate {
+    private static final int References = 100_000;
+
+    public static void main(String[] args) throws Exception {
+      final ReferenceQueue<Object> queue = new ReferenceQueue<>();
+      final ArrayList<Object> refs = new ArrayList<>();
+
+      // Create many references, with referents that are immediately unreachable
+      for (int i = 0; i < References; i++) {
+        if (i % 2 == 0) {
+          refs.add(new PhantomReference<>(new Object(), queue));
+        } else {
+          refs.add(new WeakReference<>(new Object(), queue));
+        }
+      }
+
+      System.gc();
+
+      // All references should eventually be enqueued
+      for (int enqueued = 0; enqueued < References; enqueued++) {
+        if (queue.remove(60_000) == null) {
+          throw new RuntimeException("Only " + enqueued + " of " + References + " references enqueued");
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test TestUncommit
+ * @requires vm.gc.Z
+ * @key gc
+ * @library /test/lib
+ * @summary Test ZGC uncommit of unused memory
+ * @run main/othervm TestUncommit
+ */
+
+import java.util.ArrayList;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestUncommit {
+
+  private static void runTest(boolean uncommit) throws Exception {
+    ProcessBuilder pb = ProcessTools.createJavaProcessBuilder("-XX:+UnlockExperimentalVMOptions",
+                                                              "-XX:+UseZGC",
+                                                              "-Xms128m",
+                                                              "-Xmx512m",
+                                                              "-XX:" + (uncommit ? "+" : "-") + "ZUncommit",
+                                                              "-XX:ZUncommitDelay=1",
+                                                              "-Xlog:gc+heap=info",
+                                                              Allocate.class.getName());
+
+    OutputAnalyzer output = new OutputAnalyzer(pb.start());
+    output.shouldHaveExitValue(0);
+    if (uncommit) {
+      output.shouldContain("Uncommitted: ");
+    } else {
+      output.shouldNotContain("Uncommitted: ");
+    }
+  }
+
+  public static void main(String[] args) throws Exception {
+    runTest(true);
+    runTest(false);
+  }
+
+  static class Allocate {
+    private static ArrayList<byte[]> keepAlive;
+
+    public static void main(String[] args) throws Exception {
+      // Grow the heap well above the initial heap size
+      keepAlive = new ArrayList<>();
+      for (int i = 0; i < 256; i++) {
+        keepAlive.add(new byte[1024 * 1024]);
+      }
+
+      // Drop everything and let the pages end up in the page cache
+      keepAlive = null;
+      System.gc();
+      System.gc();
+
+      // Wait for the uncommit delay to expire
+      Thread.sleep(5000);
+    }
+  }
+}
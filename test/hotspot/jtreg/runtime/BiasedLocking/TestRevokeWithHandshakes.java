@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/**
+ * @test
+ * @summary Revoking the bias of an object biased toward another live thread
+ *          with a handshake keeps the lock state consistent
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ * @run driver TestRevokeWithHandshakes
+ */
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestRevokeWithHandshakes {
+    static class Lock { }
+
+    static int counter;
+
+    static class Worker {
+        public static void main(String[] args) throws Exception {
+            Lock[] locks = new Lock[10];
+            for (int i = 0; i < locks.length; i++) {
+                locks[i] = new Lock();
+            }
+            Object holding = new Object();
+            Object release = new Object();
+            boolean[] state = new boolean[2];
+
+            // Bias every lock toward the owner and keep it alive, holding
+            // one of the locks while the main thread revokes the others.
+            Thread owner = new Thread(() -> {
+                for (Lock l : locks) {
+                    synchronized (l) {
+                        counter++;
+                    }
+                }
+                synchronized (locks[0]) {
+                    synchronized (holding) {
+                        state[0] = true;
+                        holding.notifyAll();
+                    }
+                    synchronized (release) {
+                        while (!state[1]) {
+                            try {
+                                release.wait();
+                            } catch (InterruptedException e) {
+                                throw new RuntimeException(e);
+                            }
+                        }
+                    }
+                    counter++;
+                }
+            });
+            owner.start();
+            synchronized (holding) {
+                while (!state[0]) {
+                    holding.wait();
+                }
+            }
+            for (int i = 1; i < locks.length; i++) {
+                synchronized (locks[i]) {
+                    counter++;
+                }
+            }
+            synchronized (release) {
+                state[1] = true;
+                release.notifyAll();
+            }
+            synchronized (locks[0]) {
+                counter++;
+            }
+            owner.join();
+            int expected = 2 * locks.length + 1;
+            if (counter != expected) {
+                throw new RuntimeException("expected " + expected + " but got " + counter);
+            }
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+                "-XX:+UseBiasedLocking",
+                "-XX:BiasedLockingStartupDelay=0",
+                "-XX:+UnlockExperimentalVMOptions",
+                "-XX:+BiasedLockingRevokeWithHandshakes",
+                "-XX:+UnlockDiagnosticVMOptions",
+                "-XX:+PrintBiasedLockingStatistics",
+                "-Xlog:biasedlocking=info",
+                Worker.class.getName());
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+        output.shouldContain("Revoking bias with handshake");
+        output.shouldContain("# revocations per class:");
+        output.shouldContain(Lock.class.getName() + ": ");
+    }
+}
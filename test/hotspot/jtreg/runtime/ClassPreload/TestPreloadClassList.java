@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+/**
+ * @test
+ * @summary Classes in a PreloadClassList are loaded and linked on background
+ *          threads; missing and broken entries do not affect the application
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ * @run driver TestPreloadClassList
+ */
+
+import java.io.File;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestPreloadClassList {
+    static class Listed {
+        static int initialized;
+        static {
+            initialized++;
+        }
+    }
+
+    public static class Workload {
+        public static void main(String[] args) throws Exception {
+            // Preloading links but never initializes
+            Class<?> c = Class.forName("TestPreloadClassList$Listed", false,
+                                       TestPreloadClassList.class.getClassLoader());
+            if (Listed.initialized != 1) {
+                throw new RuntimeException("initialized " + Listed.initialized + " times");
+            }
+            if (c != Listed.class) {
+                throw new RuntimeException("different class");
+            }
+            try {
+                Class.forName("does.not.Exist");
+                throw new RuntimeException("loaded a missing class");
+            } catch (ClassNotFoundException expected) {
+            }
+            java.util.concurrent.ConcurrentSkipListMap<String, String> m =
+                new java.util.concurrent.ConcurrentSkipListMap<>();
+            m.put("a", "b");
+
+            // The summary is logged by the last preloading thread to finish
+            while (preloading()) {
+                Thread.sleep(10);
+            }
+        }
+
+        static boolean preloading() {
+            for (Thread t : Thread.getAllStackTraces().keySet()) {
+                if (t.getName().startsWith("Class Preloader #")) {
+                    return true;
+                }
+            }
+            return false;
+        }
+    }
+
+    static OutputAnalyzer run(String classList) throws Exception {
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:PreloadClassList=" + classList,
+            "-XX:PreloadClassListThreads=3",
+            "-Xlog:class+load=debug",
+            Workload.class.getName());
+        OutputAnalyzer out = new OutputAnalyzer(pb.start());
+        out.shouldHaveExitValue(0);
+        return out;
+    }
+
+    public static void main(String[] args) throws Exception {
+        String classList = System.getProperty("test.src") + File.separator + "preload.classlist";
+
+        // Comments and @ lines are skipped; does/not/Exist is the only entry
+        // of the remaining 7 that does not load.
+        OutputAnalyzer out = run(classList);
+        out.shouldContain("Preloading 7 classes from " + classList + " with 3 threads");
+        out.shouldContain("Preloaded 6 of 7 classes from " + classList);
+
+        out = run(classList + ".missing");
+        out.shouldContain("Cannot open class list " + classList + ".missing");
+        out.shouldNotContain("Preloaded ");
+    }
+}
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/**
+ * @test
+ * @summary A heap too large for compressed oops with 8-byte alignment gets
+ *          a larger object alignment when CompressedOopsMaxObjectAlignment
+ *          allows it
+ * @requires vm.bits == 64 & vm.gc != "Z"
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *
+ * @run driver TestObjectAlignmentErgo
+ */
+
+/**
+ * @test
+ * @summary No alignment is selected for a collector without compressed oops
+ * @requires vm.bits == 64 & vm.gc.Z
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *
+ * @run driver TestObjectAlignmentErgo zgc
+ */
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestObjectAlignmentErgo {
+    static OutputAnalyzer run(String... flags) throws Exception {
+        String[] args = new String[flags.length + 4];
+        args[0] = "-XX:+UnlockExperimentalVMOptions";
+        args[1] = "-Xmx40g";
+        System.arraycopy(flags, 0, args, 2, flags.length);
+        args[flags.length + 2] = "-XX:+PrintFlagsFinal";
+        args[flags.length + 3] = "-version";
+        OutputAnalyzer out = new OutputAnalyzer(ProcessTools.createJavaProcessBuilder(args).start());
+        out.shouldHaveExitValue(0);
+        return out;
+    }
+
+    public static void main(String[] args) throws Exception {
+        if (args.length > 0 && args[0].equals("zgc")) {
+            run("-XX:CompressedOopsMaxObjectAlignment=32", "-XX:+UseZGC")
+                .shouldMatch("ObjectAlignmentInBytes\\s+= 8\\s")
+                .shouldMatch("UseCompressedOops\\s+= false\\s");
+            return;
+        }
+
+        // Default: no ergonomic alignment, so compressed oops are off.
+        run().shouldMatch("ObjectAlignmentInBytes\\s+= 8\\s")
+             .shouldMatch("UseCompressedOops\\s+= false\\s");
+
+        // 16-byte alignment covers 64 GB.
+        run("-XX:CompressedOopsMaxObjectAlignment=32")
+            .shouldMatch("ObjectAlignmentInBytes\\s+= 16\\s")
+            .shouldMatch("UseCompressedOops\\s+= true\\s");
+
+        // An explicit alignment or -UseCompressedOops is left alone.
+        run("-XX:CompressedOopsMaxObjectAlignment=32", "-XX:ObjectAlignmentInBytes=8")
+            .shouldMatch("ObjectAlignmentInBytes\\s+= 8\\s");
+        run("-XX:CompressedOopsMaxObjectAlignment=32", "-XX:-UseCompressedOops")
+            .shouldMatch("ObjectAlignmentInBytes\\s+= 8\\s");
+    }
+}
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test TestMetaspaceAllocationCache
+ * @summary Define, use and unload classes in parallel with the metaspace
+ *          allocation cache enabled
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ * @run driver TestMetaspaceAllocationCache
+ */
+
+import java.io.InputStream;
+import java.lang.reflect.Method;
+import java.util.ArrayList;
+import java.util.List;
+import java.util.function.IntUnaryOperator;
+
+import jdk.test.lib.Platform;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestMetaspaceAllocationCache {
+    public static void main(String[] args) throws Exception {
+        // Cache sizes below, at and above the quarter size limit of the
+        // typical metadata objects, and the disabled cache.
+        for (String size : new String[] { "0", "256", "4k", "64k" }) {
+            List<String> opts = new ArrayList<>();
+            opts.add("-XX:+UnlockExperimentalVMOptions");
+            opts.add("-XX:MetaspaceAllocationCacheSize=" + size);
+            opts.add("-XX:+UnlockDiagnosticVMOptions");
+            opts.add("-XX:+VerifyBeforeGC");
+            opts.add("-XX:+VerifyAfterGC");
+            if (Platform.isDebugBuild()) {
+                opts.add("-XX:+VerifyMetaspace");
+            }
+            opts.add("-Xlog:class+unload=info");
+            opts.add("-Dsun.reflect.inflationThreshold=0");
+            opts.add(Workload.class.getName());
+            ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(opts.toArray(new String[0]));
+            OutputAnalyzer out = new OutputAnalyzer(pb.start());
+            out.shouldHaveExitValue(0);
+            out.shouldContain("[class,unload");
+            out.shouldContain("done");
+        }
+    }
+
+    public static class Payload {
+        public int value(int x) {
+            IntUnaryOperator op = y -> y * 3 + 1;   // anonymous class metaspace
+            return op.applyAsInt(x);
+        }
+    }
+
+    static class PayloadLoader extends ClassLoader {
+        private final byte[] bytes;
+
+        PayloadLoader(byte[] bytes) {
+            super(TestMetaspaceAllocationCache.class.getClassLoader());
+            this.bytes = bytes;
+        }
+
+        @Override
+        protected Class<?> loadClass(String name, boolean resolve) throws ClassNotFoundException {
+            if (name.equals(Payload.class.getName())) {
+                synchronized (getClassLoadingLock(name)) {
+                    Class<?> c = findLoadedClass(name);
+                    if (c == null) {
+                        c = defineClass(name, bytes, 0, bytes.length);
+                    }
+                    return c;
+                }
+            }
+            return super.loadClass(name, resolve);
+        }
+    }
+
+    public static class Workload {
+        static final int THREADS = 8;
+        static final int LOADERS_PER_THREAD = 200;
+
+        public static void main(String[] args) throws Exception {
+            String resource = Payload.class.getName().replace('.', '/') + ".class";
+            byte[] bytes;
+            try (InputStream in = TestMetaspaceAllocationCache.class.getClassLoader().getResourceAsStream(resource)) {
+                bytes = in.readAllBytes();
+            }
+
+            Thread[] threads = new Thread[THREADS];
+            Throwable[] failure = new Throwable[1];
+            for (int t = 0; t < THREADS; t++) {
+                threads[t] = new Thread(() -> {
+                    try {
+                        for (int i = 0; i < LOADERS_PER_THREAD; i++) {
+                            Class<?> c = new PayloadLoader(bytes).loadClass(Payload.class.getName());
+                            Object o = c.getDeclaredConstructor().newInstance();
+                            // Reflection metaspace via the generated accessor
+                            Method m = c.getMethod("value", int.class);
+                            int v = (Integer) m.invoke(o, i);
+                            if (v != i * 3 + 1) {
+                                throw new RuntimeException("Wrong value " + v + " for " + i);
+                            }
+                            if (i % 50 == 0) {
+                                System.gc();
+                            }
+                        }
+                    } catch (Throwable e) {
+                        synchronized (failure) {
+                            failure[0] = e;
+                        }
+                    }
+                });
+                threads[t].start();
+            }
+            for (Thread t : threads) {
+                t.join();
+            }
+            if (failure[0] != null) {
+                throw new RuntimeException(failure[0]);
+            }
+            System.gc();
+            System.out.println("done");
+        }
+    }
+}
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test TestMetaspaceReleaseFreeChunks
+ * @summary Unload classes with MetaspaceReleaseFreeChunks and allocate the
+ *          released chunks again
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ * @run driver TestMetaspaceReleaseFreeChunks
+ */
+
+import java.io.InputStream;
+import java.util.ArrayList;
+import java.util.List;
+
+import jdk.test.lib.Platform;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestMetaspaceReleaseFreeChunks {
+    public static void main(String[] args) throws Exception {
+        OutputAnalyzer out = run(true);
+        out.shouldMatch("(metaspace|class space): releasing payload \\[0x\\p{XDigit}+-0x\\p{XDigit}+\\) of free chunk");
+
+        // Off by default
+        out = run(false);
+        out.shouldNotContain("releasing payload");
+    }
+
+    static OutputAnalyzer run(boolean release) throws Exception {
+        List<String> opts = new ArrayList<>();
+        opts.add("-XX:+UnlockExperimentalVMOptions");
+        if (release) {
+            opts.add("-XX:+MetaspaceReleaseFreeChunks");
+        }
+        opts.add("-XX:+UnlockDiagnosticVMOptions");
+        opts.add("-XX:+VerifyBeforeGC");
+        opts.add("-XX:+VerifyAfterGC");
+        if (Platform.isDebugBuild()) {
+            opts.add("-XX:+VerifyMetaspace");
+        }
+        opts.add("-Xlog:gc+metaspace+freelist=trace");
+        opts.add(Workload.class.getName());
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(opts.toArray(new String[0]));
+        OutputAnalyzer out = new OutputAnalyzer(pb.start());
+        out.shouldHaveExitValue(0);
+        out.shouldContain("done");
+        return out;
+    }
+
+    // Defines renamed copies of MRFPayload0000, so that every loader gets
+    // enough metadata to use medium chunks.
+    static class PayloadLoader extends ClassLoader {
+        static final String TEMPLATE = "MRFPayload0000";
+        private final byte[] bytes;
+
+        PayloadLoader(byte[] bytes) {
+            super(TestMetaspaceReleaseFreeChunks.class.getClassLoader());
+            this.bytes = bytes;
+        }
+
+        Class<?> define(int i) {
+            String name = String.format("MRFPayload%04d", i);
+            byte[] b = bytes.clone();
+            byte[] from = TEMPLATE.getBytes();
+            byte[] to = name.getBytes();
+            for (int p = 0; p + from.length <= b.length; p++) {
+                boolean match = true;
+                for (int q = 0; q < from.length && match; q++) {
+                    match = b[p + q] == from[q];
+                }
+                if (match) {
+                    System.arraycopy(to, 0, b, p, to.length);
+                }
+            }
+            return defineClass(name, b, 0, b.length);
+        }
+    }
+
+    public static class Workload {
+        static final int LOADERS = 20;
+        static final int CLASSES_PER_LOADER = 200;
+
+        static List<Class<?>> load(byte[] bytes, int first) throws Exception {
+            List<Class<?>> classes = new ArrayList<>();
+            for (int l = 0; l < LOADERS; l++) {
+                PayloadLoader loader = new PayloadLoader(bytes);
+                for (int i = 0; i < CLASSES_PER_LOADER; i++) {
+                    int n = first + l * CLASSES_PER_LOADER + i;
+                    Class<?> c = loader.define(n % 10000);
+                    Object o = c.getDeclaredConstructor().newInstance();
+                    if (o.hashCode() != 42) {
+                        throw new RuntimeException("Wrong hash code for " + c.getName());
+                    }
+                    classes.add(c);
+                }
+            }
+            return classes;
+        }
+
+        public static void main(String[] args) throws Exception {
+            byte[] bytes;
+            try (InputStream in = TestMetaspaceReleaseFreeChunks.class.getClassLoader()
+                                      .getResourceAsStream(PayloadLoader.TEMPLATE + ".class")) {
+                bytes = in.readAllBytes();
+            }
+            for (int round = 0; round < 5; round++) {
+                List<Class<?>> classes = load(bytes, round * 7);
+                // The classes of the earlier round are unloaded and their
+                // chunks, with the payload released, are allocated again.
+                classes = null;
+                System.gc();
+            }
+            System.out.println("done");
+        }
+    }
+}
+
+class MRFPayload0000 {
+    int a, b, c, d;
+    String s = "MRFPayload0000";
+
+    int sum(int x) {
+        return a + b * x + c * x * x + d * x * x * x;
+    }
+
+    @Override
+    public int hashCode() {
+        return 42;
+    }
+}
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/**
+ * @test
+ * @summary Lightweight locking keeps monitor semantics: hash codes, recursion,
+ *          lock stack overflow, wait/notify and contended locking
+ * @run main/othervm -XX:+UnlockExperimentalVMOptions -XX:+UseLightweightLocking
+ *                   -Xint TestLightweightLocking
+ * @run main/othervm -XX:+UnlockExperimentalVMOptions -XX:+UseLightweightLocking
+ *                   -XX:TieredStopAtLevel=1 TestLightweightLocking
+ * @run main/othervm -XX:+UnlockExperimentalVMOptions -XX:+UseLightweightLocking
+ *                   -XX:-TieredCompilation TestLightweightLocking
+ */
+
+public class TestLightweightLocking {
+    static final int THREADS = 4;
+    static final int ITERATIONS = 100_000;
+    // More than the lock stack holds
+    static final int DEPTH = 20;
+
+    static final Object shared = new Object();
+    static int counter;
+
+    static void check(boolean condition, String message) {
+        if (!condition) {
+            throw new RuntimeException(message);
+        }
+    }
+
+    static void hashWhileLocked() {
+        Object o = new Object();
+        synchronized (o) {
+            int h = o.hashCode();
+            check(Thread.holdsLock(o), "lock lost after hashCode");
+            synchronized (o) {
+                check(o.hashCode() == h, "hash changed on recursive lock");
+            }
+            check(o.hashCode() == h, "hash changed on recursive unlock");
+        }
+        check(!Thread.holdsLock(o), "lock still held");
+    }
+
+    static void nested(Object[] objs, int i) {
+        if (i == objs.length) {
+            for (Object o : objs) {
+                check(Thread.holdsLock(o), "nested lock not held");
+            }
+            return;
+        }
+        synchronized (objs[i]) {
+            nested(objs, i + 1);
+        }
+        check(!Thread.holdsLock(objs[i]), "nested lock still held");
+    }
+
+    static void waitNotify() throws Exception {
+        Object o = new Object();
+        boolean[] done = new boolean[1];
+        Thread waiter = new Thread(() -> {
+            synchronized (o) {
+                while (!done[0]) {
+                    try {
+                        o.wait();
+                    } catch (InterruptedException e) {
+                        throw new RuntimeException(e);
+                    }
+                }
+            }
+        });
+        waiter.start();
+        while (waiter.getState() != Thread.State.WAITING) {
+            Thread.sleep(1);
+        }
+        synchronized (o) {
+            done[0] = true;
+            o.notifyAll();
+        }
+        waiter.join();
+        // notify() on an object that is fast-locked by the caller
+        Object p = new Object();
+        synchronized (p) {
+            p.notify();
+        }
+    }
+
+    static void contended() throws Exception {
+        Thread[] threads = new Thread[THREADS];
+        for (int t = 0; t < THREADS; t++) {
+            threads[t] = new Thread(() -> {
+                for (int i = 0; i < ITERATIONS; i++) {
+                    synchronized (shared) {
+                        counter++;
+                    }
+                }
+            });
+            threads[t].start();
+        }
+        for (Thread t : threads) {
+            t.join();
+        }
+        check(counter == THREADS * ITERATIONS, "counter is " + counter);
+    }
+
+    public static void main(String[] args) throws Exception {
+        Object[] objs = new Object[DEPTH];
+        for (int i = 0; i < DEPTH; i++) {
+            objs[i] = new Object();
+        }
+        for (int i = 0; i < 20_000; i++) {
+            hashWhileLocked();
+            nested(objs, 0);
+        }
+        waitNotify();
+        contended();
+    }
+}
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/**
+ * @test
+ * @summary A monitor that is inflated by a contending thread while the
+ *          object is fast-locked is reported as owned by the lock holder
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.management
+ * @run main/othervm -XX:+UnlockExperimentalVMOptions -XX:+UseLightweightLocking
+ *                   TestLightweightLockingOwner
+ */
+
+import java.lang.management.ManagementFactory;
+import java.lang.management.MonitorInfo;
+import java.lang.management.ThreadInfo;
+import java.lang.management.ThreadMXBean;
+import java.util.concurrent.CountDownLatch;
+
+import jdk.test.lib.dcmd.PidJcmdExecutor;
+import jdk.test.lib.process.OutputAnalyzer;
+
+public class TestLightweightLockingOwner {
+    static class LockObject { }
+
+    public static void main(String[] args) throws Exception {
+        LockObject lock = new LockObject();
+        CountDownLatch locked = new CountDownLatch(1);
+        CountDownLatch release = new CountDownLatch(1);
+
+        // The holder fast-locks the object and then does not reach the
+        // runtime until it is released, so the monitor installed by the
+        // contender stays anonymously owned.
+        Thread holder = new Thread(() -> {
+            synchronized (lock) {
+                locked.countDown();
+                try {
+                    release.await();
+                } catch (InterruptedException e) {
+                    throw new RuntimeException(e);
+                }
+            }
+        }, "Holder");
+        holder.start();
+        locked.await();
+
+        Thread contender = new Thread(() -> {
+            synchronized (lock) {
+            }
+        }, "Contender");
+        contender.start();
+        while (contender.getState() != Thread.State.BLOCKED) {
+            Thread.sleep(10);
+        }
+
+        try {
+            ThreadMXBean mbean = ManagementFactory.getThreadMXBean();
+            ThreadInfo info = mbean.getThreadInfo(new long[] { contender.getId() }, false, false)[0];
+            if (info.getLockOwnerId() != holder.getId()) {
+                throw new RuntimeException("Lock owner is " + info.getLockOwnerName() + ", expected Holder");
+            }
+
+            info = mbean.getThreadInfo(new long[] { holder.getId() }, true, false)[0];
+            boolean found = false;
+            for (MonitorInfo mi : info.getLockedMonitors()) {
+                if (mi.getIdentityHashCode() == System.identityHashCode(lock)) {
+                    found = true;
+                }
+            }
+            if (!found) {
+                throw new RuntimeException("Holder does not report the lock as locked");
+            }
+
+            OutputAnalyzer output = new PidJcmdExecutor().execute("Thread.print");
+            output.shouldMatch("- locked <0x\\p{XDigit}+> \\(a TestLightweightLockingOwner\\$LockObject\\)");
+            output.shouldMatch("- waiting to lock <0x\\p{XDigit}+> \\(a TestLightweightLockingOwner\\$LockObject\\)");
+            output.shouldNotContain("waiting to re-lock in wait()");
+        } finally {
+            release.countDown();
+            holder.join();
+            contender.join();
+        }
+    }
+}
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/**
+ * @test
+ * @summary Incremental deflation of idle monitors with a per-safepoint
+ *          budget keeps monitor semantics intact
+ * @run main/othervm -XX:+UnlockExperimentalVMOptions -XX:+UnlockDiagnosticVMOptions
+ *                   -XX:MonitorDeflationBudget=16 -XX:GuaranteedSafepointInterval=1
+ *                   TestMonitorDeflationBudget
+ * @run main/othervm -XX:+UnlockExperimentalVMOptions -XX:MonitorDeflationBudget=1
+ *                   -XX:MonitorBound=64 TestMonitorDeflationBudget
+ */
+
+public class TestMonitorDeflationBudget {
+    static final int OBJECTS = 2_000;
+    static final int THREADS = 4;
+    static final int ROUNDS = 50;
+
+    static final Object[] locks = new Object[OBJECTS];
+    static final int[] counts = new int[OBJECTS];
+
+    public static void main(String[] args) throws Exception {
+        for (int i = 0; i < OBJECTS; i++) {
+            locks[i] = new Object();
+        }
+        Thread[] threads = new Thread[THREADS];
+        for (int t = 0; t < THREADS; t++) {
+            threads[t] = new Thread(() -> {
+                for (int r = 0; r < ROUNDS; r++) {
+                    for (int i = 0; i < OBJECTS; i++) {
+                        synchronized (locks[i]) {
+                            counts[i]++;
+                            if ((i & 63) == 0) {
+                                // Inflate the monitor
+                                try {
+                                    locks[i].wait(0, 1);
+                                } catch (InterruptedException e) {
+                                    throw new RuntimeException(e);
+                                }
+                            }
+                        }
+                    }
+                    if ((r & 7) == 0) {
+                        System.gc();
+                    }
+                }
+            });
+            threads[t].start();
+        }
+        for (Thread t : threads) {
+            t.join();
+        }
+        for (int i = 0; i < OBJECTS; i++) {
+            if (counts[i] != THREADS * ROUNDS) {
+                throw new RuntimeException("count " + i + " is " + counts[i]);
+            }
+        }
+    }
+}
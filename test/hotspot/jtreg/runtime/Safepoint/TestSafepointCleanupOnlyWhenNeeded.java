@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/**
+ * @test
+ * @summary Safepoints skip the cleanup tasks when none of them has work,
+ *          while monitors are still deflated and the VM keeps working
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *
+ * @run driver TestSafepointCleanupOnlyWhenNeeded
+ */
+
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestSafepointCleanupOnlyWhenNeeded {
+    public static class Workload {
+        public static void main(String[] args) {
+            Object[] locks = new Object[10_000];
+            for (int i = 0; i < locks.length; i++) {
+                locks[i] = new Object();
+                // Inflate the monitor with a wait
+                synchronized (locks[i]) {
+                    try {
+                        locks[i].wait(0, 1);
+                    } catch (InterruptedException e) {
+                        throw new RuntimeException(e);
+                    }
+                }
+            }
+            for (int i = 0; i < 20; i++) {
+                // Each stack dump is a safepoint
+                Thread.getAllStackTraces();
+            }
+            System.gc();
+            System.out.println("done");
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        // Without code aging there is only occasional work
+        OutputAnalyzer out = run("-XX:-UseCodeAging");
+        out.shouldContain("Skipping safepoint cleanup tasks");
+
+        // Code aging in the cleanup tasks has work at every safepoint
+        out = run("-XX:+UseCodeAging", "-XX:-ConcurrentCodeCacheAging");
+        out.shouldNotContain("Skipping safepoint cleanup tasks");
+    }
+
+    private static OutputAnalyzer run(String... flags) throws Exception {
+        List<String> opts = new ArrayList<>();
+        opts.add("-XX:+UnlockExperimentalVMOptions");
+        opts.add("-XX:+SafepointCleanupOnlyWhenNeeded");
+        opts.add("-Xlog:safepoint+cleanup=debug");
+        opts.addAll(Arrays.asList(flags));
+        opts.add(Workload.class.getName());
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(opts.toArray(new String[0]));
+        OutputAnalyzer out = new OutputAnalyzer(pb.start());
+        out.shouldHaveExitValue(0);
+        out.shouldContain("done");
+        return out;
+    }
+}
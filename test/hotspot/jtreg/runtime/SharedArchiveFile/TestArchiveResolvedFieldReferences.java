@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/**
+ * @test
+ * @summary Resolved instance field references of boot classes kept in the
+ *          CDS archive are used correctly at runtime
+ * @requires vm.cds
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.management
+ * @run driver TestArchiveResolvedFieldReferences
+ */
+
+import java.util.ArrayList;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Map;
+import java.util.TreeMap;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestArchiveResolvedFieldReferences {
+    public static class Workload {
+        public static void main(String[] args) {
+            // Exercise getfield/putfield in archived collection and string code
+            Map<String, Integer> hash = new HashMap<>();
+            Map<String, Integer> tree = new TreeMap<>();
+            List<String> list = new ArrayList<>();
+            for (int i = 0; i < 10_000; i++) {
+                String s = "key" + i;
+                hash.put(s, i);
+                tree.put(s, i);
+                list.add(s);
+            }
+            long sum = 0;
+            for (String s : list) {
+                sum += hash.get(s) + tree.get(s) + s.length();
+            }
+            StringBuilder sb = new StringBuilder();
+            for (int i = 0; i < 100; i++) {
+                sb.append(i).append(',');
+            }
+            long expected = 2L * (10_000L * 9_999L / 2);
+            for (int i = 0; i < 10_000; i++) {
+                expected += ("key" + i).length();
+            }
+            if (sum != expected || sb.length() != 290) {
+                throw new RuntimeException("Wrong result " + sum + " " + sb.length());
+            }
+            System.out.println("done");
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        String archive = "./TestArchiveResolvedFieldReferences.jsa";
+
+        // Running java code at dump time resolves field references of boot classes
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+            "-XX:+UnlockDiagnosticVMOptions",
+            "-XX:SharedArchiveFile=" + archive,
+            "-XX:+ArchiveResolvedFieldReferences",
+            "-Xlog:cds=trace",
+            "-Xshare:dump");
+        OutputAnalyzer out = new OutputAnalyzer(pb.start());
+        out.shouldHaveExitValue(0);
+        out.shouldMatch("Kept [0-9]+ resolved field references of java.lang.String");
+
+        pb = ProcessTools.createJavaProcessBuilder(
+            "-XX:+UnlockDiagnosticVMOptions",
+            "-XX:SharedArchiveFile=" + archive,
+            "-Xshare:on",
+            "-Xlog:cds=trace",
+            "-Xlog:class+load=info",
+            Workload.class.getName());
+        out = new OutputAnalyzer(pb.start());
+        if (out.getOutput().contains("Unable to use shared archive")) {
+            // CDS turned off, e.g. by address space layout randomization
+            out.shouldHaveExitValue(1);
+            return;
+        }
+        out.shouldHaveExitValue(0);
+        out.shouldContain("java.util.HashMap source: shared objects file");
+        out.shouldContain("done");
+        // Only the pool holder and its superclasses are kept, and those are
+        // loaded from the archive with the pool holder
+        out.shouldNotContain("Reset resolved field reference");
+    }
+}
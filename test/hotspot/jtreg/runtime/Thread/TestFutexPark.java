@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/**
+ * @test
+ * @summary Park and unpark with and without futexes: handoffs, timeouts
+ *          and contended monitors
+ * @requires os.family == "linux"
+ * @run main/othervm -XX:+UnlockDiagnosticVMOptions -XX:+UseFutexPark TestFutexPark
+ * @run main/othervm -XX:+UnlockDiagnosticVMOptions -XX:-UseFutexPark TestFutexPark
+ */
+
+import java.util.concurrent.TimeUnit;
+import java.util.concurrent.locks.LockSupport;
+
+public class TestFutexPark {
+    static final int HANDOFFS = 20_000;
+
+    static volatile int turn;
+
+    // Two threads take turns, each parking until the other unparks it
+    static void handoff() throws Exception {
+        Thread[] threads = new Thread[2];
+        for (int i = 0; i < 2; i++) {
+            final int me = i;
+            threads[i] = new Thread(() -> {
+                for (int n = 0; n < HANDOFFS; n++) {
+                    while (turn != me) {
+                        LockSupport.park();
+                    }
+                    turn = 1 - me;
+                    LockSupport.unpark(threads[1 - me]);
+                }
+            });
+        }
+        for (Thread t : threads) t.start();
+        for (Thread t : threads) t.join();
+    }
+
+    static void timeouts() throws Exception {
+        LockSupport.parkNanos(TimeUnit.MILLISECONDS.toNanos(50));
+        // Spurious returns are allowed, but not when a permit is pending
+        LockSupport.unpark(Thread.currentThread());
+        long start = System.nanoTime();
+        LockSupport.parkNanos(TimeUnit.SECONDS.toNanos(60));
+        if (System.nanoTime() - start > TimeUnit.SECONDS.toNanos(30)) {
+            throw new RuntimeException("pending permit not consumed");
+        }
+        LockSupport.parkUntil(System.currentTimeMillis() + 50);
+
+        Object lock = new Object();
+        long elapsed;
+        synchronized (lock) {
+            start = System.nanoTime();
+            lock.wait(50);
+            elapsed = System.nanoTime() - start;
+        }
+        if (elapsed < TimeUnit.MILLISECONDS.toNanos(40)) {
+            throw new RuntimeException("wait(50) returned after " + elapsed + "ns");
+        }
+    }
+
+    static int counter;
+
+    // Contended monitors block on the ParkEvent of the thread
+    static void contended() throws Exception {
+        Object lock = new Object();
+        Thread[] threads = new Thread[4];
+        for (int i = 0; i < threads.length; i++) {
+            threads[i] = new Thread(() -> {
+                for (int n = 0; n < 100_000; n++) {
+                    synchronized (lock) {
+                        counter++;
+                        if ((n & 0xfff) == 0) {
+                            lock.notifyAll();
+                        }
+                    }
+                }
+            });
+        }
+        for (Thread t : threads) t.start();
+        for (Thread t : threads) t.join();
+        if (counter != threads.length * 100_000) {
+            throw new RuntimeException("lost updates: " + counter);
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        handoff();
+        timeouts();
+        contended();
+    }
+}
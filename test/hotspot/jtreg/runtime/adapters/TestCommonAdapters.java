@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+/**
+ * @test
+ * @summary Calls between interpreted and compiled code through the adapters
+ *          shared for the most common signatures pass arguments correctly
+ * @run main/othervm -XX:-BackgroundCompilation TestCommonAdapters
+ * @run main/othervm -Xcomp TestCommonAdapters
+ * @run main/othervm -XX:+UnlockDiagnosticVMOptions -XX:+VerifyAdapterCalls TestCommonAdapters
+ */
+
+public class TestCommonAdapters {
+    private final int base;
+
+    TestCommonAdapters(int base) {
+        this.base = base;
+    }
+
+    static int noArgs() { return 7; }
+    static int intArg(int x) { return x + 1; }
+    static int byteArg(byte x) { return x + 2; }
+    static int objArg(Object o) { return o.hashCode() & 0xff; }
+    static int arrayArg(int[] a) { return a.length; }
+
+    int receiverOnly() { return base; }
+    int receiverInt(int x) { return base + x; }
+    int receiverChar(char c) { return base + c; }
+    int receiverObj(String s) { return base + s.length(); }
+    int receiverArray(long[] a) { return base + a.length; }
+
+    static void check(int actual, int expected) {
+        if (actual != expected) {
+            throw new RuntimeException("expected " + expected + " but got " + actual);
+        }
+    }
+
+    public static void main(String[] args) {
+        TestCommonAdapters t = new TestCommonAdapters(100);
+        Integer boxed = 42;
+        int[] ints = new int[3];
+        long[] longs = new long[5];
+        for (int i = 0; i < 20_000; i++) {
+            check(noArgs(), 7);
+            check(intArg(i), i + 1);
+            check(byteArg((byte) 3), 5);
+            check(objArg(boxed), 42);
+            check(arrayArg(ints), 3);
+            check(t.receiverOnly(), 100);
+            check(t.receiverInt(i), 100 + i);
+            check(t.receiverChar('a'), 100 + 'a');
+            check(t.receiverObj("abcd"), 104);
+            check(t.receiverArray(longs), 105);
+        }
+    }
+}
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test HandshakeParallelTest
+ * @summary Handshake all threads with enough blocked threads for the
+ *          handshake workers to help the VM thread
+ * @library /testlibrary /test/lib
+ * @build HandshakeParallelTest
+ * @run driver ClassFileInstaller sun.hotspot.WhiteBox
+ *                              sun.hotspot.WhiteBox$WhiteBoxPermission
+ * @run driver HandshakeParallelTest
+ */
+
+import jdk.test.lib.Asserts;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+import sun.hotspot.WhiteBox;
+
+public class HandshakeParallelTest {
+    private static final int Threads = 64;
+
+    public static void main(String... args) throws Exception {
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+            "-Xbootclasspath/a:.",
+            "-XX:+UnlockDiagnosticVMOptions",
+            "-XX:+WhiteBoxAPI",
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:+ParallelHandshakes",
+            "-Xlog:handshake=debug",
+            Tester.class.getName());
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+        output.shouldContain("Processing blocked threads with");
+    }
+
+    static class Tester {
+        public static void main(String... args) throws Exception {
+            Object lock = new Object();
+            Thread[] threads = new Thread[Threads];
+            for (int i = 0; i < Threads; i++) {
+                threads[i] = new Thread(() -> {
+                    synchronized (lock) {
+                        try {
+                            lock.wait();
+                        } catch (InterruptedException ie) {}
+                    }
+                });
+                threads[i].setDaemon(true);
+                threads[i].start();
+            }
+            Thread.sleep(500);
+
+            WhiteBox wb = WhiteBox.getWhiteBox();
+            for (int i = 0; i < 3; i++) {
+                int walked = wb.handshakeWalkStack(null, true);
+                Asserts.assertGTE(walked, Threads, "Must have walked all waiting thread stacks");
+            }
+        }
+    }
+}
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/**
+ * @test
+ * @summary aload_0 followed by a boolean, byte or long getfield is rewritten
+ *          into a pair bytecode that must load the same values
+ * @run main/othervm -Xint -XX:+RewriteFrequentPairs TestAload0FieldPairs
+ * @run main/othervm -Xint -XX:-RewriteFrequentPairs TestAload0FieldPairs
+ */
+
+public class TestAload0FieldPairs {
+    private boolean flag;
+    private byte small;
+    private long big;
+
+    TestAload0FieldPairs(boolean flag, byte small, long big) {
+        this.flag = flag;
+        this.small = small;
+        this.big = big;
+    }
+
+    boolean flag()  { return flag; }
+    byte small()    { return small; }
+    long big()      { return big; }
+
+    long sum() {
+        // aload_0; getfield pairs inside a larger method
+        long r = flag ? 1 : 0;
+        r += small;
+        r += big;
+        return r;
+    }
+
+    static void check(long actual, long expected) {
+        if (actual != expected) {
+            throw new RuntimeException("expected " + expected + " but got " + actual);
+        }
+    }
+
+    public static void main(String[] args) {
+        TestAload0FieldPairs a = new TestAload0FieldPairs(true, (byte) -7, 0x1234_5678_9abc_def0L);
+        TestAload0FieldPairs b = new TestAload0FieldPairs(false, (byte) 127, Long.MIN_VALUE);
+        // Run more than once so the rewritten bytecodes execute
+        for (int i = 0; i < 100; i++) {
+            check(a.flag() ? 1 : 0, 1);
+            check(b.flag() ? 1 : 0, 0);
+            check(a.small(), -7);
+            check(b.small(), 127);
+            check(a.big(), 0x1234_5678_9abc_def0L);
+            check(b.big(), Long.MIN_VALUE);
+            check(a.sum(), 1 - 7 + 0x1234_5678_9abc_def0L);
+            check(b.sum(), 127 + Long.MIN_VALUE);
+        }
+        try {
+            TestAload0FieldPairs n = null;
+            n.big();
+            throw new RuntimeException("no NullPointerException");
+        } catch (NullPointerException expected) {
+        }
+    }
+}
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+/**
+ * @test
+ * @summary invokeinterface must dispatch correctly both when the referenced
+ *          interface declares the method and when it only inherits it
+ * @run main/othervm -Xint TestInvokeInterfaceRefc
+ */
+
+public class TestInvokeInterfaceRefc {
+    interface Base {
+        int value();
+        default int twice() { return 2 * value(); }
+    }
+
+    interface Derived extends Base {
+        int other();
+    }
+
+    static class A implements Derived {
+        public int value() { return 1; }
+        public int other() { return 10; }
+    }
+
+    static class B implements Derived {
+        public int value() { return 2; }
+        public int other() { return 20; }
+        public int twice() { return 42; }
+    }
+
+    static class C implements Base {
+        public int value() { return 3; }
+    }
+
+    // REFC is Base, which declares value() and twice().
+    static int viaBase(Base b) {
+        return b.value() + b.twice();
+    }
+
+    // REFC is Derived, while value() and twice() are declared in Base.
+    static int viaDerived(Derived d) {
+        return d.value() + d.twice() + d.other();
+    }
+
+    static void check(int actual, int expected) {
+        if (actual != expected) {
+            throw new RuntimeException("expected " + expected + " but got " + actual);
+        }
+    }
+
+    public static void main(String[] args) {
+        Base[] bases = { new A(), new B(), new C() };
+        Derived[] deriveds = { new A(), new B() };
+        for (int i = 0; i < 10_000; i++) {
+            check(viaBase(bases[0]), 3);
+            check(viaBase(bases[1]), 44);
+            check(viaBase(bases[2]), 9);
+            check(viaDerived(deriveds[0]), 13);
+            check(viaDerived(deriveds[1]), 64);
+        }
+    }
+}
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Asynchronous logging flushes the queued messages on exit, and
+ *          reports the messages it drops when the buffer is full
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ * @run driver AsyncLoggingTest
+ */
+
+import java.io.File;
+import java.nio.file.Files;
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class AsyncLoggingTest {
+    public static void main(String[] args) throws Exception {
+        // The class loaded right before exit is in the file, so the queue
+        // was drained before the VM went away.
+        String log = run("class+load=info", "1M", "exit");
+        if (!log.contains(LastClass.class.getName())) {
+            throw new RuntimeException("Last class load was not flushed on exit");
+        }
+        if (log.contains("dropped due to async logging")) {
+            throw new RuntimeException("Messages dropped with a large enough buffer");
+        }
+
+        // Everything at trace level overflows the smallest buffer.
+        log = run("all=trace", "100k", "return");
+        Matcher m = Pattern.compile("(\\d+) messages dropped due to async logging").matcher(log);
+        long dropped = 0;
+        while (m.find()) {
+            dropped += Long.parseLong(m.group(1));
+        }
+        if (dropped == 0) {
+            throw new RuntimeException("No dropped messages reported");
+        }
+        System.out.println(dropped + " messages dropped");
+    }
+
+    static String run(String what, String bufferSize, String mode) throws Exception {
+        File file = new File("async-" + mode + ".log");
+        file.delete();
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:+AsyncLogging",
+            "-XX:AsyncLogBufferSize=" + bufferSize,
+            "-Xlog:" + what + ":file=" + file.getPath() + "::filecount=0",
+            Workload.class.getName(),
+            mode);
+        OutputAnalyzer out = new OutputAnalyzer(pb.start());
+        out.shouldHaveExitValue(0);
+        return new String(Files.readAllBytes(file.toPath()));
+    }
+
+    public static class LastClass {
+        static void touch() { }
+    }
+
+    public static class Workload {
+        public static void main(String[] args) throws Exception {
+            // Some class loading, compilation and GC to log about
+            for (int i = 0; i < 100; i++) {
+                StringBuilder sb = new StringBuilder();
+                for (int j = 0; j < 10_000; j++) {
+                    sb.append(j);
+                }
+                if (sb.length() == 0) {
+                    throw new RuntimeException();
+                }
+            }
+            System.gc();
+            LastClass.touch();
+            if (args[0].equals("exit")) {
+                System.exit(0);
+            }
+        }
+    }
+}
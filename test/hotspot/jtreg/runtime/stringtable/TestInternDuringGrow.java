@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/**
+ * @test
+ * @summary Intern strings from several threads while the StringTable grows
+ * @run main/othervm -XX:StringTableSize=1024 -XX:+UnlockDiagnosticVMOptions
+ *                   -XX:+VerifyStringTableAtExit
+ *                   TestInternDuringGrow
+ */
+
+public class TestInternDuringGrow {
+    static final int THREADS = 4;
+    static final int COUNT = 200_000;
+
+    public static void main(String[] args) throws Exception {
+        Thread[] threads = new Thread[THREADS];
+        for (int t = 0; t < THREADS; t++) {
+            final int id = t;
+            threads[t] = new Thread(() -> {
+                for (int i = 0; i < COUNT; i++) {
+                    // Every thread interns the same strings, so each must
+                    // get back the one canonical instance.
+                    String s = ("grow-" + i).intern();
+                    String again = new String("grow-" + i).intern();
+                    if (s != again) {
+                        throw new RuntimeException("Thread " + id + ": two instances for " + s);
+                    }
+                }
+            });
+            threads[t].start();
+        }
+        for (Thread t : threads) {
+            t.join();
+        }
+    }
+}
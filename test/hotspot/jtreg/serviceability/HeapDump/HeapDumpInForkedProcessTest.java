@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Write a heap dump from a forked snapshot process, and check that
+ *          the dump holds the heap as of the request
+ * @requires os.family != "windows" & vm.gc != "Z"
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.compiler
+ *          java.management
+ *          jdk.internal.jvmstat/sun.jvmstat.monitor
+ * @run main/othervm -XX:+UnlockExperimentalVMOptions -XX:+HeapDumpInForkedProcess
+ *                   HeapDumpInForkedProcessTest
+ */
+
+import java.io.File;
+import java.util.ArrayList;
+import java.util.List;
+
+import jdk.test.lib.dcmd.PidJcmdExecutor;
+import jdk.test.lib.hprof.model.JavaClass;
+import jdk.test.lib.hprof.model.Snapshot;
+import jdk.test.lib.hprof.parser.Reader;
+import jdk.test.lib.process.OutputAnalyzer;
+
+public class HeapDumpInForkedProcessTest {
+    static final int BEFORE = 100_000;
+    static final int AFTER = 50_000;
+
+    static class Marker {
+        int value;
+        Marker(int value) { this.value = value; }
+    }
+
+    static List<Marker> live = new ArrayList<>();
+
+    public static void main(String[] args) throws Exception {
+        for (int i = 0; i < BEFORE; i++) {
+            live.add(new Marker(i));
+        }
+
+        File dump = new File("HeapDumpInForkedProcessTest.hprof");
+        dump.delete();
+        OutputAnalyzer output = new PidJcmdExecutor().execute("GC.heap_dump " + dump.getAbsolutePath());
+        output.shouldContain("Heap dump is being written by a background process");
+
+        // Objects allocated after the snapshot must not show up in the dump.
+        for (int i = 0; i < AFTER; i++) {
+            live.add(new Marker(BEFORE + i));
+        }
+
+        waitForDump(dump);
+        Snapshot snapshot = Reader.readFile(dump.getPath(), false, 0);
+        try {
+            snapshot.resolve(true);
+            JavaClass jc = snapshot.findClass(Marker.class.getName());
+            if (jc == null) {
+                throw new RuntimeException("Marker not found in the dump");
+            }
+            int count = jc.getInstancesCount(false);
+            if (count != BEFORE) {
+                throw new RuntimeException(count + " Marker instances in the dump, expected " + BEFORE);
+            }
+        } finally {
+            snapshot.close();
+            dump.delete();
+        }
+        if (live.size() != BEFORE + AFTER) {
+            throw new RuntimeException("Lost objects in the VM");
+        }
+    }
+
+    // The snapshot process is not a child of this one, so wait until the
+    // file stops growing.
+    static void waitForDump(File dump) throws Exception {
+        long size = -1;
+        for (int stable = 0; stable < 10; ) {
+            Thread.sleep(200);
+            long s = dump.length();
+            if (s > 0 && s == size) {
+                stable++;
+            } else {
+                stable = 0;
+            }
+            size = s;
+        }
+    }
+}
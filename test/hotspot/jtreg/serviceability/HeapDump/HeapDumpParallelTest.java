@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Dump the heap with the safepoint workers dumping objects in
+ *          parallel, and check that every object is in the dump
+ * @requires vm.gc.G1
+ * @library /test/lib
+ * @modules java.management
+ * @run main/othervm -XX:+UseG1GC -XX:ParallelGCThreads=8 -Xmx512m HeapDumpParallelTest
+ * @run main/othervm -XX:+UseG1GC -XX:ParallelGCThreads=1 -Xmx512m HeapDumpParallelTest
+ */
+
+import java.io.File;
+import java.lang.management.ManagementFactory;
+
+import com.sun.management.HotSpotDiagnosticMXBean;
+
+import jdk.test.lib.hprof.model.JavaClass;
+import jdk.test.lib.hprof.model.Snapshot;
+import jdk.test.lib.hprof.parser.Reader;
+
+public class HeapDumpParallelTest {
+    static final int SMALL = 200_000;
+    // Larger than the 1M buffer of a dumper, so that the sub-record is
+    // written while the dumper holds the lock
+    static final int LARGE = 4;
+    static final int LARGE_LENGTH = 1_000_000;
+
+    static class Small {
+        int value;
+        Small(int value) { this.value = value; }
+    }
+
+    static class Large {
+        int[] payload = new int[LARGE_LENGTH];
+    }
+
+    static Object[] live;
+
+    public static void main(String[] args) throws Exception {
+        live = new Object[SMALL + LARGE];
+        for (int i = 0; i < SMALL; i++) {
+            live[i] = new Small(i);
+        }
+        for (int i = 0; i < LARGE; i++) {
+            live[SMALL + i] = new Large();
+        }
+
+        File dump = new File("HeapDumpParallelTest.hprof");
+        dump.delete();
+        HotSpotDiagnosticMXBean bean = ManagementFactory.getPlatformMXBean(HotSpotDiagnosticMXBean.class);
+        bean.dumpHeap(dump.getPath(), true);
+
+        Snapshot snapshot = Reader.readFile(dump.getPath(), false, 0);
+        try {
+            snapshot.resolve(true);
+            check(snapshot, Small.class, SMALL);
+            check(snapshot, Large.class, LARGE);
+        } finally {
+            snapshot.close();
+            dump.delete();
+        }
+    }
+
+    static void check(Snapshot snapshot, Class<?> c, int expected) {
+        JavaClass jc = snapshot.findClass(c.getName());
+        if (jc == null) {
+            throw new RuntimeException(c.getName() + " not found in the dump");
+        }
+        int count = jc.getInstancesCount(false);
+        if (count != expected) {
+            throw new RuntimeException(count + " instances of " + c.getName() + " in the dump, expected " + expected);
+        }
+    }
+}
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+import java.lang.reflect.Method;
+
+import org.testng.annotations.Test;
+
+import jdk.test.lib.JDKToolLauncher;
+import jdk.test.lib.Utils;
+import jdk.test.lib.dcmd.CommandExecutor;
+import jdk.test.lib.dcmd.JMXExecutor;
+import jdk.test.lib.dcmd.PidJcmdExecutor;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+import sun.hotspot.WhiteBox;
+
+/*
+ * @test
+ * @summary Test of diagnostic command Compiler.aot_methods
+ * @requires vm.aot
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.compiler
+ *          java.management
+ *          jdk.internal.jvmstat/sun.jvmstat.monitor
+ * @run testng/othervm -XX:+UnlockExperimentalVMOptions -XX:-UseAOT AOTMethodsTest
+ */
+
+/*
+ * @test
+ * @summary Test of diagnostic command Compiler.aot_methods with a library
+ *          compiled by jaotc: a method that is invoked, one that is never
+ *          invoked and one whose AOT code is deoptimized
+ * @requires vm.aot
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.compiler
+ *          java.management
+ *          jdk.internal.jvmstat/sun.jvmstat.monitor
+ * @build sun.hotspot.WhiteBox
+ * @run driver ClassFileInstaller sun.hotspot.WhiteBox
+ *                                sun.hotspot.WhiteBox$WhiteBoxPermission
+ * @run driver AOTMethodsTest
+ */
+public class AOTMethodsTest {
+
+    public void run(CommandExecutor executor) {
+        OutputAnalyzer output = executor.execute("Compiler.aot_methods");
+        output.shouldContain("AOT is not enabled");
+
+        output = executor.execute("Compiler.aot_methods -verbose");
+        output.shouldContain("AOT is not enabled");
+    }
+
+    @Test
+    public void jmx() {
+        run(new JMXExecutor());
+    }
+
+    @Test
+    public void cli() {
+        run(new PidJcmdExecutor());
+    }
+
+    public static class Workload {
+        private static final WhiteBox WB = WhiteBox.getWhiteBox();
+
+        static int used(int x) {
+            return x + 1;
+        }
+
+        static int unused(int x) {
+            return x - 1;
+        }
+
+        static int deopt(int x) {
+            return x * 3;
+        }
+
+        public static void main(String[] args) throws Exception {
+            // Fewer invocations than the tier 3 thresholds, so that the
+            // AOT code is not replaced by JIT code.
+            int sum = 0;
+            for (int i = 0; i < 100; i++) {
+                sum += used(i) + deopt(i);
+            }
+            System.out.println("sum " + sum);
+
+            Method deopt = Workload.class.getDeclaredMethod("deopt", int.class);
+            if (WB.deoptimizeMethod(deopt) == 0) {
+                throw new RuntimeException("No AOT code to deoptimize for " + deopt);
+            }
+
+            OutputAnalyzer output = new PidJcmdExecutor().execute("Compiler.aot_methods -verbose");
+            System.out.println(output.getStdout());
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        String lib = "libAOTMethodsTest.so";
+        JDKToolLauncher jaotc = JDKToolLauncher.createUsingTestJDK("jaotc")
+                                               .addToolArg("--compile-for-tiered")
+                                               .addToolArg("--output")
+                                               .addToolArg(lib)
+                                               .addToolArg("--class-name")
+                                               .addToolArg(Workload.class.getName())
+                                               .addToolArg("-J-cp")
+                                               .addToolArg("-J" + Utils.TEST_CLASS_PATH);
+        ProcessTools.executeCommand(jaotc.getCommand()).shouldHaveExitValue(0);
+
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+            "-Xbootclasspath/a:.",
+            "-XX:+UnlockDiagnosticVMOptions",
+            "-XX:+WhiteBoxAPI",
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:+UseAOT",
+            "-XX:AOTLibrary=./" + lib,
+            "-XX:+TieredCompilation",
+            Workload.class.getName());
+        OutputAnalyzer out = new OutputAnalyzer(pb.start());
+        out.shouldHaveExitValue(0);
+        out.shouldContain("AOT libraries loaded: 1");
+        out.shouldMatch(lib + ": [1-9][0-9]* methods");
+        out.shouldMatch("invalidated by dependency: 0, deoptimized: 1");
+        out.shouldMatch("in_use +invocations=[1-9][0-9]* +replaced=0 +invalidated=none +AOTMethodsTest\\$Workload\\.used\\(I\\)I");
+        out.shouldMatch("in_use +invocations=0 +replaced=0 +invalidated=none +AOTMethodsTest\\$Workload\\.unused\\(I\\)I");
+        out.shouldMatch("not_entrant +invocations=[1-9][0-9]* +replaced=0 +invalidated=deopt +AOTMethodsTest\\$Workload\\.deopt\\(I\\)I");
+    }
+}
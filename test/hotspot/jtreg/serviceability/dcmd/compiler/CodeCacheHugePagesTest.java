@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+
+import org.testng.annotations.Test;
+
+import jdk.test.lib.dcmd.CommandExecutor;
+import jdk.test.lib.dcmd.JMXExecutor;
+import jdk.test.lib.dcmd.PidJcmdExecutor;
+import jdk.test.lib.process.OutputAnalyzer;
+
+/*
+ * @test
+ * @summary Test of diagnostic command Compiler.codecache with CodeCacheUseHugePages
+ * @requires os.family == "linux"
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.compiler
+ *          java.management
+ *          jdk.internal.jvmstat/sun.jvmstat.monitor
+ * @run testng/othervm -XX:+SegmentedCodeCache -XX:+UnlockExperimentalVMOptions -XX:+CodeCacheUseHugePages CodeCacheHugePagesTest
+ */
+public class CodeCacheHugePagesTest {
+    static final long HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+    public void run(CommandExecutor executor) {
+        OutputAnalyzer output = executor.execute("Compiler.codecache");
+        output.shouldMatch("backing: page_size=\\d+Kb huge_page_backed=\\d+Kb of \\d+Kb committed");
+
+        // Every code heap starts on a huge page boundary
+        Matcher m = Pattern.compile("bounds \\[0x(\\p{XDigit}+),").matcher(output.getStdout());
+        int heaps = 0;
+        while (m.find()) {
+            long low = Long.parseUnsignedLong(m.group(1), 16);
+            if (low % HUGE_PAGE_SIZE != 0) {
+                throw new RuntimeException("Code heap at 0x" + m.group(1) + " is not 2M aligned");
+            }
+            heaps++;
+        }
+        if (heaps == 0) {
+            throw new RuntimeException("No code heap bounds in output");
+        }
+    }
+
+    @Test
+    public void jmx() {
+        run(new JMXExecutor());
+    }
+
+    @Test
+    public void cli() {
+        run(new PidJcmdExecutor());
+    }
+}
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+import org.testng.annotations.Test;
+
+import jdk.test.lib.dcmd.CommandExecutor;
+import jdk.test.lib.dcmd.JMXExecutor;
+import jdk.test.lib.dcmd.PidJcmdExecutor;
+import jdk.test.lib.process.OutputAnalyzer;
+
+/*
+ * @test
+ * @summary Test of diagnostic command GC.class_histogram -sample
+ * @requires vm.gc.G1
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.compiler
+ *          java.management
+ *          jdk.internal.jvmstat/sun.jvmstat.monitor
+ * @run testng/othervm -XX:+UseG1GC -Xmx128m -XX:G1HeapRegionSize=1m ClassHistogramSampleTest
+ */
+public class ClassHistogramSampleTest {
+    static Object[] retained;
+
+    public void run(CommandExecutor executor) {
+        retained = new Object[64 * 1024];
+        for (int i = 0; i < retained.length; i++) {
+            retained[i] = new byte[64];
+        }
+
+        OutputAnalyzer output = executor.execute("GC.class_histogram -all -sample=4");
+        output.shouldContain("Approximate histogram, extrapolated from one in 4 parts of the heap:");
+        output.shouldMatch("\\s+\\d+:\\s+\\d+\\s+\\d+\\s+\\[B");
+        output.shouldMatch("Total\\s+\\d+\\s+\\d+");
+
+        output = executor.execute("GC.class_histogram -sample=0");
+        output.shouldNotContain("Approximate histogram");
+        output.shouldMatch("\\s+\\d+:\\s+\\d+\\s+\\d+\\s+\\[B");
+    }
+
+    @Test
+    public void jmx() {
+        run(new JMXExecutor());
+    }
+
+    @Test
+    public void cli() {
+        run(new PidJcmdExecutor());
+    }
+}
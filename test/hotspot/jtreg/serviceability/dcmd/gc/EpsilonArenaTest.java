@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+import java.io.BufferedReader;
+import java.io.InputStreamReader;
+import java.io.OutputStream;
+
+import jdk.test.lib.dcmd.PidJcmdExecutor;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+/*
+ * @test
+ * @summary Test of diagnostic command GC.epsilon_arena: a reset with
+ *          -verify is refused while an older object refers into the
+ *          arena, and otherwise discards the arena and keeps older objects
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.compiler
+ *          java.management
+ *          jdk.internal.jvmstat/sun.jvmstat.monitor
+ * @run driver EpsilonArenaTest
+ */
+public class EpsilonArenaTest {
+    public static void main(String[] args) throws Exception {
+        // Interpreter only, so that no compiled code embeds arena objects.
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+            "-Xint",
+            "-Xmx256m",
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:+UseEpsilonGC",
+            "-XX:+EpsilonArenaMode",
+            "-XX:+ZapUnusedHeapArea",
+            Workload.class.getName());
+        Process p = pb.start();
+        try {
+            BufferedReader in = new BufferedReader(new InputStreamReader(p.getInputStream()));
+            OutputStream out = p.getOutputStream();
+            PidJcmdExecutor jcmd = new PidJcmdExecutor(Long.toString(p.pid()));
+
+            expect(in, "ready");
+
+            // Also starts the attach listener before the watermark.
+            OutputAnalyzer output = jcmd.execute("GC.epsilon_arena status");
+            output.shouldContain("Arena: no watermark");
+
+            output = jcmd.execute("GC.epsilon_arena watermark");
+            output.shouldMatch("Arena: epoch 1, watermark 0x\\p{XDigit}+");
+
+            send(out, in, "keep");
+            output = jcmd.execute("GC.epsilon_arena status");
+            output.shouldMatch("Arena: epoch 1, .*[0-9]+M used since watermark");
+
+            // The static field of an older class mirror is only found by the
+            // heap walk below the watermark.
+            output = jcmd.execute("GC.epsilon_arena -verify reset");
+            output.shouldMatch("Reset refused: 0 root and [1-9][0-9]* heap references into the arena");
+
+            send(out, in, "drop");
+            output = jcmd.execute("GC.epsilon_arena -verify reset");
+            output.shouldNotContain("Reset refused");
+            output.shouldMatch("Arena: epoch 2, .* 0B used since watermark");
+
+            // The objects allocated before the watermark are intact, and the
+            // released space can be allocated again.
+            send(out, in, "check");
+            out.write('x');
+            out.flush();
+            if (p.waitFor() != 0) {
+                throw new RuntimeException("Workload failed with exit code " + p.exitValue());
+            }
+        } finally {
+            p.destroy();
+        }
+    }
+
+    static void send(OutputStream out, BufferedReader in, String cmd) throws Exception {
+        out.write(cmd.charAt(0));
+        out.flush();
+        expect(in, cmd);
+    }
+
+    static void expect(BufferedReader in, String reply) throws Exception {
+        String line;
+        while ((line = in.readLine()) != null) {
+            System.out.println("workload: " + line);
+            if (line.equals(reply)) {
+                return;
+            }
+        }
+        throw new RuntimeException("Workload exited before printing \"" + reply + "\"");
+    }
+
+    public static class Workload {
+        static int[][] survivors;
+        static Object kept;
+
+        static Object garbage(int seed) {
+            Object[] list = new Object[20_000];
+            for (int i = 0; i < list.length; i++) {
+                list[i] = new int[256 + seed];
+            }
+            return list;
+        }
+
+        static void check() {
+            for (int i = 0; i < survivors.length; i++) {
+                for (int j = 0; j < survivors[i].length; j++) {
+                    if (survivors[i][j] != i * j) {
+                        throw new RuntimeException("survivors[" + i + "][" + j + "] = " + survivors[i][j]);
+                    }
+                }
+            }
+        }
+
+        public static void main(String[] args) throws Exception {
+            survivors = new int[100][];
+            for (int i = 0; i < survivors.length; i++) {
+                survivors[i] = new int[1000];
+                for (int j = 0; j < survivors[i].length; j++) {
+                    survivors[i][j] = i * j;
+                }
+            }
+            // Resolve the replies before the watermark, or the constant pool
+            // of this class would refer into the arena.
+            String[] replies = { "keep", "drop", "check" };
+            replies = null;
+            System.out.println("ready");
+
+            // Commands are read byte by byte, which allocates nothing, so
+            // that no frame refers into the arena while waiting for input.
+            int c;
+            while ((c = System.in.read()) != -1) {
+                switch (c) {
+                    case 'k':
+                        kept = garbage(1);
+                        System.out.println("keep");
+                        break;
+                    case 'd':
+                        kept = null;
+                        System.out.println("drop");
+                        break;
+                    case 'c':
+                        check();
+                        garbage(2);
+                        check();
+                        System.out.println("check");
+                        break;
+                    case 'x':
+                        return;
+                }
+            }
+        }
+    }
+}
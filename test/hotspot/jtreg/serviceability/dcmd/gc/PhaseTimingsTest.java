@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+import org.testng.annotations.Test;
+
+import jdk.test.lib.dcmd.CommandExecutor;
+import jdk.test.lib.dcmd.JMXExecutor;
+import jdk.test.lib.dcmd.PidJcmdExecutor;
+import jdk.test.lib.process.OutputAnalyzer;
+
+/*
+ * @test
+ * @summary Test of diagnostic command GC.phase_timings
+ * @requires vm.gc.G1
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.compiler
+ *          java.management
+ *          jdk.internal.jvmstat/sun.jvmstat.monitor
+ * @run testng/othervm -XX:+UseG1GC -XX:+UnlockDiagnosticVMOptions -XX:GCPhaseTimingHistory=8 PhaseTimingsTest
+ */
+public class PhaseTimingsTest {
+    public void run(CommandExecutor executor) {
+        System.gc();
+        System.gc();
+
+        OutputAnalyzer output = executor.execute("GC.phase_timings");
+        output.shouldContain("{\"gcs\":[{\"gc_id\":");
+        output.shouldContain("\"name\":\"G1Full\"");
+        output.shouldContain("\"cause\":\"System.gc()\"");
+        output.shouldMatch("\"phases\":\\[\\{\"name\":\"[^\"]+\",\"type\":\"pause\",\"level\":0");
+
+        output = executor.execute("GC.phase_timings -count=1");
+        output.shouldMatch("^\\{\"gcs\":\\[\\{\"gc_id\":\\d+,[^\\n]*\\}\\]\\}$");
+    }
+
+    @Test
+    public void jmx() {
+        run(new JMXExecutor());
+    }
+
+    @Test
+    public void cli() {
+        run(new PidJcmdExecutor());
+    }
+}
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+import org.testng.annotations.Test;
+
+import jdk.test.lib.dcmd.CommandExecutor;
+import jdk.test.lib.dcmd.JMXExecutor;
+import jdk.test.lib.dcmd.PidJcmdExecutor;
+import jdk.test.lib.process.OutputAnalyzer;
+
+/*
+ * @test
+ * @summary Test of Thread.print -handshake
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.compiler
+ *          java.management
+ *          jdk.internal.jvmstat/sun.jvmstat.monitor
+ * @run testng/othervm HandshakeThreadDumpTest
+ * @run testng/othervm -XX:-ThreadLocalHandshakes HandshakeThreadDumpTest
+ */
+public class HandshakeThreadDumpTest {
+    static final Object lock = new Object();
+
+    static void waitForever() {
+        synchronized (lock) {
+            try {
+                lock.wait();
+            } catch (InterruptedException e) {
+                throw new RuntimeException(e);
+            }
+        }
+    }
+
+    public void run(CommandExecutor executor) throws InterruptedException {
+        Thread waiter = new Thread(HandshakeThreadDumpTest::waitForever, "HandshakeThreadDumpTest-waiter");
+        waiter.start();
+        while (waiter.getState() != Thread.State.WAITING) {
+            Thread.sleep(1);
+        }
+
+        OutputAnalyzer output = executor.execute("Thread.print -handshake");
+        output.shouldContain("taken with per-thread handshakes:");
+        output.shouldContain("\"HandshakeThreadDumpTest-waiter\"");
+        output.shouldContain("at HandshakeThreadDumpTest.waitForever");
+        output.shouldNotContain("JNI global refs");
+
+        synchronized (lock) {
+            lock.notifyAll();
+        }
+        waiter.join();
+    }
+
+    @Test
+    public void jmx() throws InterruptedException {
+        run(new JMXExecutor());
+    }
+
+    @Test
+    public void cli() throws InterruptedException {
+        run(new PidJcmdExecutor());
+    }
+}
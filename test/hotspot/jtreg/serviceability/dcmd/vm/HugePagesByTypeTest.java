@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+import java.nio.file.Files;
+import java.nio.file.Paths;
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+
+import org.testng.annotations.Test;
+
+import jdk.test.lib.dcmd.CommandExecutor;
+import jdk.test.lib.dcmd.JMXExecutor;
+import jdk.test.lib.dcmd.PidJcmdExecutor;
+import jdk.test.lib.process.OutputAnalyzer;
+
+/*
+ * @test
+ * @summary Test of the transparent huge pages by memory type line of VM.info
+ *          with the heap, metaspace and GC data structures advised
+ * @requires os.family == "linux" & vm.gc.G1
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.compiler
+ *          java.management
+ *          jdk.internal.jvmstat/sun.jvmstat.monitor
+ * @run testng/othervm -XX:NativeMemoryTracking=summary -XX:+UseG1GC -Xms128m -Xmx128m
+ *                     -XX:+AlwaysPreTouch -XX:+UseTransparentHugePages
+ *                     -XX:+UnlockExperimentalVMOptions -XX:+MetaspaceUseHugePages
+ *                     -XX:+GCDataUseHugePages HugePagesByTypeTest
+ */
+public class HugePagesByTypeTest {
+    static final String THP_ENABLED = "/sys/kernel/mm/transparent_hugepage/enabled";
+
+    public void run(CommandExecutor executor) throws Exception {
+        if (!Files.exists(Paths.get(THP_ENABLED))) {
+            System.out.println("Skipped: the kernel does not support transparent huge pages");
+            return;
+        }
+
+        OutputAnalyzer output = executor.execute("VM.info");
+        String line = output.firstMatch("Transparent huge pages by memory type:.*");
+        if (line == null) {
+            throw new RuntimeException("No transparent huge pages line in VM.info");
+        }
+        System.out.println(line);
+
+        // The per-type figures come from the same smaps mappings as the
+        // process total, so together they cannot be much larger. Whether
+        // the kernel backs any of them with huge pages is not checked, as
+        // that depends on its settings and on memory fragmentation.
+        Matcher m = Pattern.compile(" ([A-Za-z][A-Za-z ]*?) (\\d+)k").matcher(line.substring(line.indexOf(':') + 1));
+        long sum = 0;
+        while (m.find()) {
+            sum += Long.parseLong(m.group(2)) * 1024;
+        }
+        long total = anonHugePages();
+        if (sum > total + total / 10 + 4 * 1024 * 1024) {
+            throw new RuntimeException("Types add up to " + sum + " bytes, smaps has " + total);
+        }
+    }
+
+    static long anonHugePages() throws Exception {
+        long total = 0;
+        for (String l : Files.readAllLines(Paths.get("/proc/self/smaps"))) {
+            if (l.startsWith("AnonHugePages:")) {
+                total += Long.parseLong(l.replaceAll("\\D+", "")) * 1024;
+            }
+        }
+        return total;
+    }
+
+    @Test
+    public void jmx() throws Exception {
+        run(new JMXExecutor());
+    }
+
+    @Test
+    public void cli() throws Exception {
+        run(new PidJcmdExecutor());
+    }
+}
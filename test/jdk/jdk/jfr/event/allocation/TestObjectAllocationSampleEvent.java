@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package jdk.jfr.event.allocation;
+
+import java.lang.management.ManagementFactory;
+import java.util.List;
+
+import jdk.jfr.Recording;
+import jdk.jfr.consumer.RecordedClass;
+import jdk.jfr.consumer.RecordedEvent;
+import jdk.test.lib.jfr.Events;
+
+/*
+ * @test
+ * @summary The weights of the ObjectAllocationSample events add up to the
+ *          bytes allocated by a thread, with and without throttling
+ * @key jfr
+ * @requires vm.hasJFR
+ * @library /test/lib
+ * @modules jdk.management
+ * @run main/othervm -XX:+UnlockExperimentalVMOptions -XX:JfrObjectAllocationSampleRate=0
+ *                   jdk.jfr.event.allocation.TestObjectAllocationSampleEvent 0
+ * @run main/othervm -XX:+UnlockExperimentalVMOptions -XX:JfrObjectAllocationSampleRate=20
+ *                   jdk.jfr.event.allocation.TestObjectAllocationSampleEvent 20
+ */
+public class TestObjectAllocationSampleEvent {
+    private static final String EVENT_NAME = "jdk.ObjectAllocationSample";
+    private static final int OBJECT_SIZE = 1024;
+    private static final long ALLOCATION_BYTES = 512L * 1024 * 1024;
+
+    public static volatile Object sink;
+
+    public static void main(String[] args) throws Exception {
+        long rate = Long.parseLong(args[0]);
+        com.sun.management.ThreadMXBean mbean =
+            (com.sun.management.ThreadMXBean) ManagementFactory.getThreadMXBean();
+        long tid = Thread.currentThread().getId();
+
+        long weights = 0;
+        long samples = 0;
+        long allocated;
+        long nanos;
+        try (Recording recording = new Recording()) {
+            recording.enable(EVENT_NAME);
+            recording.start();
+            long startBytes = mbean.getThreadAllocatedBytes(tid);
+            long startNanos = System.nanoTime();
+            for (long i = 0; i < ALLOCATION_BYTES / OBJECT_SIZE; i++) {
+                sink = new byte[OBJECT_SIZE];
+            }
+            allocated = mbean.getThreadAllocatedBytes(tid) - startBytes;
+            nanos = System.nanoTime() - startNanos;
+            recording.stop();
+
+            List<RecordedEvent> events = Events.fromRecording(recording);
+            for (RecordedEvent event : events) {
+                if (event.getThread().getJavaThreadId() != tid) {
+                    continue;
+                }
+                RecordedClass objectClass = event.getValue("objectClass");
+                long weight = event.getLong("weight");
+                if (weight <= 0) {
+                    throw new RuntimeException("Sample of " + objectClass.getName() + " with weight " + weight);
+                }
+                samples++;
+                weights += weight;
+            }
+        }
+        System.out.println(samples + " samples, weights " + weights + " of " + allocated
+                           + " allocated bytes in " + nanos / 1_000_000 + " ms");
+
+        if (samples == 0) {
+            throw new RuntimeException("No " + EVENT_NAME + " events for the main thread");
+        }
+        if (rate != 0) {
+            // One window of slack at each end of the measured interval
+            long limit = rate * nanos / 1_000_000_000L + 2 * Math.max(1, rate / 10);
+            if (samples > limit) {
+                throw new RuntimeException(samples + " samples, expected at most " + limit);
+            }
+        }
+        // Throttled samples carry their bytes over, so the weights only
+        // miss what was allocated after the last sample, and the bytes
+        // allocated before the recording started are at most one TLAB.
+        if (weights < allocated / 2) {
+            throw new RuntimeException("Weights " + weights + " are less than half of " + allocated);
+        }
+        if (weights > allocated * 2) {
+            throw new RuntimeException("Weights " + weights + " are more than twice " + allocated);
+        }
+    }
+}
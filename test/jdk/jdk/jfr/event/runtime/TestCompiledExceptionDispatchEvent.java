@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package jdk.jfr.event.runtime;
+
+import java.util.List;
+
+import jdk.jfr.Recording;
+import jdk.jfr.consumer.RecordedEvent;
+import jdk.jfr.consumer.RecordedMethod;
+import jdk.test.lib.jfr.Events;
+
+/*
+ * @test
+ * @summary CompiledExceptionDispatch events name the compiled throw site and
+ *          report handlers found in the exception cache
+ * @key jfr
+ * @requires vm.hasJFR & vm.compMode != "Xint"
+ * @library /test/lib
+ * @run main/othervm -XX:CompileCommand=dontinline,jdk.jfr.event.runtime.TestCompiledExceptionDispatchEvent::fail
+ *                   jdk.jfr.event.runtime.TestCompiledExceptionDispatchEvent
+ */
+public class TestCompiledExceptionDispatchEvent {
+    private static final String EVENT_NAME = "jdk.CompiledExceptionDispatch";
+    private static final int ITERATIONS = 200_000;
+
+    static void fail(int i) {
+        throw new IllegalStateException();
+    }
+
+    static int site(int i) {
+        try {
+            fail(i);
+        } catch (IllegalStateException e) {
+            return 1;
+        }
+        return 0;
+    }
+
+    public static void main(String[] args) throws Exception {
+        try (Recording recording = new Recording()) {
+            recording.enable(EVENT_NAME);
+            recording.start();
+            int caught = 0;
+            for (int i = 0; i < ITERATIONS; i++) {
+                caught += site(i);
+            }
+            recording.stop();
+            if (caught != ITERATIONS) {
+                throw new RuntimeException("Caught " + caught + " of " + ITERATIONS);
+            }
+
+            int atSite = 0;
+            int cached = 0;
+            List<RecordedEvent> events = Events.fromRecording(recording);
+            for (RecordedEvent event : events) {
+                RecordedMethod method = event.getValue("method");
+                if (!method.getType().getName().equals(TestCompiledExceptionDispatchEvent.class.getName()) ||
+                    !method.getName().equals("site")) {
+                    continue;
+                }
+                Events.assertField(event, "exceptionClass.name").equal(IllegalStateException.class.getName());
+                Events.assertField(event, "bci").atLeast(0);
+                atSite++;
+                if (event.getBoolean("cached")) {
+                    cached++;
+                }
+            }
+            System.out.println(atSite + " dispatches in site(), " + cached + " cached");
+            if (atSite == 0) {
+                throw new RuntimeException("No dispatch event for the compiled site()");
+            }
+            if (cached == 0) {
+                throw new RuntimeException("The handler of site() was never found in the exception cache");
+            }
+        }
+    }
+}